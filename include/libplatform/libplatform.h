@@ -20,6 +20,32 @@ enum class MessageLoopBehavior : bool {
   kWaitForWork = true
 };
 
+/**
+ * Scheduling options for the worker threads running background tasks.
+ */
+struct WorkerThreadOptions {
+  /**
+   * Worker threads are named |name_prefix| followed by their number. Names
+   * are truncated to 15 characters on Linux.
+   */
+  const char* name_prefix = "V8 Worker";
+
+  /**
+   * If non-zero, worker threads only run on the CPUs whose bits are set, e.g.
+   * the CPUs of the NUMA node the isolates run on. Supported on Linux and
+   * Windows.
+   */
+  uint64_t cpu_affinity_mask = 0;
+
+  /**
+   * Scheduling priority of the worker threads on the nice scale from -20
+   * (highest) to 19 (lowest), so that background work does not compete with
+   * latency sensitive threads. Zero keeps the priority of the creating
+   * thread. Supported on Linux and Windows.
+   */
+  int nice_level = 0;
+};
+
 /**
  * Returns a new instance of the default v8::Platform implementation.
  *
@@ -30,12 +56,15 @@ enum class MessageLoopBehavior : bool {
  * If |idle_task_support| is enabled then the platform will accept idle
  * tasks (IdleTasksEnabled will return true) and will rely on the embedder
  * calling v8::platform::RunIdleTasks to process the idle tasks.
+ * |worker_thread_options| configures the names, CPU affinity and priority of
+ * the worker threads.
  */
 V8_PLATFORM_EXPORT v8::Platform* CreateDefaultPlatform(
     int thread_pool_size = 0,
     IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
     InProcessStackDumping in_process_stack_dumping =
-        InProcessStackDumping::kEnabled);
+        InProcessStackDumping::kEnabled,
+    const WorkerThreadOptions& worker_thread_options = WorkerThreadOptions());
 
 /**
  * Pumps the message loop for the given isolate.
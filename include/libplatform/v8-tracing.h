@@ -112,6 +112,7 @@ class V8_PLATFORM_EXPORT TraceWriter {
   virtual void Flush() = 0;
 
   static TraceWriter* CreateJSONTraceWriter(std::ostream& stream);
+  static TraceWriter* CreateBinaryTraceWriter(std::ostream& stream);
 
  private:
   // Disallow copy and assign
@@ -123,11 +123,14 @@ class Platform {
   /**
    * This enum is used to indicate whether a task is potentially long running,
    * or causes a long wait. The embedder might want to use this hint to decide
-   * whether to execute the task on a dedicated thread.
+   * whether to execute the task on a dedicated thread, or to prioritize short
+   * running tasks over long running ones. Best effort tasks are not latency
+   * sensitive and may wait until all other background work is done.
    */
   enum ExpectedRuntime {
     kShortRunningTask,
-    kLongRunningTask
+    kLongRunningTask,
+    kBestEffortTask
   };
 
   virtual ~Platform() = default;
@@ -151,6 +154,24 @@ class Platform {
   virtual void CallOnBackgroundThread(Task* task,
                                       ExpectedRuntime expected_runtime) = 0;
 
+  /**
+   * Schedules a task to be invoked on a background thread after the given
+   * number of seconds |delay_in_seconds|. Requires that
+   * DelayedBackgroundTasksEnabled() is true. The Platform implementation takes
+   * ownership of |task|, and may destroy it without running it if the
+   * platform is shut down before the delay has passed.
+   */
+  virtual void CallDelayedOnBackgroundThread(Task* task,
+                                             ExpectedRuntime expected_runtime,
+                                             double delay_in_seconds) {
+    CallOnBackgroundThread(task, expected_runtime);
+  }
+
+  /**
+   * Returns true if CallDelayedOnBackgroundThread honors the delay.
+   */
+  virtual bool DelayedBackgroundTasksEnabled() { return false; }
+
   /**
    * Schedules a task to be invoked on a foreground thread wrt a specific
    * |isolate|. Tasks posted for the same isolate should be execute in order of
@@ -172,6 +172,14 @@ class V8_EXPORT CpuProfileNode {
    */
   int GetLineNumber() const;
 
+  /**
+   * Returns the number, 1-based, of the line in the parent node's function
+   * from which this function was called. Only profiles recorded in the
+   * kCallerLineNumbers mode have this information, for all other nodes this
+   * returns kNoLineNumberInfo.
+   */
+  int GetCallerLineNumber() const;
+
   /**
    * Returns 1-based number of the column where the function originates.
    * kNoColumnNumberInfo if no column number information is available.
@@ -273,6 +281,20 @@ class V8_EXPORT CpuProfile {
   void Delete();
 };
 
+/**
+ * How the ticks of a CPU profile are attributed to source lines.
+ */
+enum CpuProfilingMode {
+  // Only the function a sample was taken in gets the line of the tick, see
+  // CpuProfileNode::GetLineTicks. The nodes of the call tree are functions.
+  kLeafNodeLineNumbers,
+  // Calls of the same function from different lines of its caller get
+  // different nodes, see CpuProfileNode::GetCallerLineNumber. Together with
+  // the line ticks of the leaf nodes, this attributes every frame of every
+  // sample to a source line.
+  kCallerLineNumbers,
+};
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -298,6 +320,18 @@ class V8_EXPORT CpuProfiler {
    */
   void SetSamplingInterval(int us);
 
+  /**
+   * Makes the profiles started after this call stream their new nodes and
+   * samples, with the time deltas between samples, at least every |us|
+   * microseconds. Streaming uses "ProfileChunk" trace events in the
+   * "disabled-by-default-v8.cpu_profiler" category. After a chunk is
+   * emitted, the profile releases its samples, so memory use no longer
+   * grows with the duration of the profile. GetSample then only returns the
+   * samples recorded since the last chunk. Pass 0 to stop streaming again.
+   * This method must be called when there are no profiles being recorded.
+   */
+  void SetStreamingInterval(int us);
+
   /**
    * Starts collecting CPU profile. Title may be an empty string. It
    * is allowed to have several profiles being collected at
@@ -311,6 +345,13 @@ class V8_EXPORT CpuProfiler {
    */
   void StartProfiling(Local<String> title, bool record_samples = false);
 
+  /**
+   * Like StartProfiling above, but with the given way of attributing ticks
+   * to source lines, see CpuProfilingMode.
+   */
+  void StartProfiling(Local<String> title, CpuProfilingMode mode,
+                      bool record_samples = false);
+
   /**
    * Stops collecting CPU profile with a given title and returns it.
    * If the title given is empty, finishes the last profile started.
@@ -603,6 +644,46 @@ class V8_EXPORT AllocationProfile {
      * List of self allocations done by this node in the call-graph.
      */
     std::vector<Allocation> allocations;
+
+    /**
+     * Id of the node, unique within the lifetime of the sampling heap
+     * profiler. Referenced by Sample::node_id.
+     */
+    uint32_t node_id;
+  };
+
+  /**
+   * Represent a single sampled object that is still alive.
+   */
+  struct Sample {
+    /**
+     * Id of the node in the call-graph the object was allocated in.
+     */
+    uint32_t node_id;
+
+    /**
+     * Size of the sampled object.
+     */
+    size_t size;
+
+    /**
+     * Name of the constructor for JavaScript objects, and the name of the
+     * instance type for other heap objects.
+     */
+    Local<String> type_name;
+
+    /**
+     * Number of scavenges and full garbage collections the object survived.
+     * Objects that keep surviving full garbage collections are likely
+     * retained for good, while short-lived allocations rarely survive one.
+     */
+    unsigned int scavenges_survived;
+    unsigned int full_gcs_survived;
+
+    /**
+     * Unique id of the sample. Ids grow monotonically with allocation time.
+     */
+    uint64_t sample_id;
   };
 
   /**
@@ -612,6 +693,11 @@ class V8_EXPORT AllocationProfile {
    */
   virtual Node* GetRootNode() = 0;
 
+  /**
+   * Returns the live samples of the profile, sorted by sample id.
+   */
+  virtual const std::vector<Sample>& GetSamples() = 0;
+
   virtual ~AllocationProfile() {}
 
   static const int kNoLineNumberInfo = Message::kNoLineNumberInfo;
@@ -711,6 +797,18 @@ class V8_EXPORT HeapProfiler {
       ActivityControl* control = NULL,
       ObjectNameResolver* global_object_name_resolver = NULL);
 
+  /**
+   * Takes a heap snapshot and serializes it to |stream| in the format of
+   * HeapSnapshot::Serialize, without keeping the snapshot. This needs
+   * considerably less memory than TakeHeapSnapshot followed by Serialize,
+   * as no graph for HeapGraphNode is built and the snapshot is released
+   * right after serialization. Returns false if taking the snapshot was
+   * aborted through |control|.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream, ActivityControl* control = NULL,
+      ObjectNameResolver* global_object_name_resolver = NULL);
+
   /**
    * Starts tracking of heap objects population statistics. After calling
    * this method, all heap objects relocations done by the garbage collector
@@ -789,6 +887,14 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Like GetAllocationProfile, but AllocationProfile::GetSamples only
+   * includes the samples with a sample id greater than |since_sample_id|.
+   * The call-graph still covers all live samples. This allows periodically
+   * exporting the samples taken since the previous export.
+   */
+  AllocationProfile* GetAllocationProfile(uint64_t since_sample_id);
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
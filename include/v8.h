@@ -148,6 +148,10 @@ template<typename T> class CustomArguments;
 class PropertyCallbackArguments;
 class FunctionCallbackArguments;
 class GlobalHandles;
+
+namespace wasm {
+class StreamingDecoder;
+}  // namespace wasm
 }  // namespace internal
 
 namespace debug {
@@ -416,8 +420,11 @@ class WeakCallbackInfo {
 
   WeakCallbackInfo(Isolate* isolate, T* parameter,
                    void* embedder_fields[kEmbedderFieldsInWeakCallback],
-                   Callback* callback)
-      : isolate_(isolate), parameter_(parameter), callback_(callback) {
+                   Callback* callback, bool* thread_safe = nullptr)
+      : isolate_(isolate),
+        parameter_(parameter),
+        callback_(callback),
+        thread_safe_(thread_safe) {
     for (int i = 0; i < kEmbedderFieldsInWeakCallback; ++i) {
       embedder_fields_[i] = embedder_fields[i];
     }
@@ -449,10 +456,20 @@ class WeakCallbackInfo {
   // Calling SetSecondPassCallback on the second pass will immediately crash.
   void SetSecondPassCallback(Callback callback) const { *callback_ = callback; }
 
+  // Like SetSecondPassCallback(), but declares that the second pass callback
+  // neither calls into V8 nor uses the isolate, so that it may be invoked on a
+  // background thread while JavaScript keeps running. GetIsolate() must not be
+  // used from such a callback.
+  void SetThreadSafeSecondPassCallback(Callback callback) const {
+    *callback_ = callback;
+    if (thread_safe_ != nullptr) *thread_safe_ = true;
+  }
+
  private:
   Isolate* isolate_;
   T* parameter_;
   Callback* callback_;
+  bool* thread_safe_;
   void* embedder_fields_[kEmbedderFieldsInWeakCallback];
 };
 
@@ -567,6 +584,15 @@ template <class T> class PersistentBase {
    */
   V8_INLINE void RegisterExternalReference(Isolate* isolate) const;
 
+  /**
+   * Like RegisterExternalReference(), but may be called from any thread while
+   * the embedder traces its heap concurrently, see EmbedderHeapTracer. The
+   * object is marked by the main thread in a later marking step, at the latest
+   * in the final pause, so the handle must stay alive until the garbage
+   * collection is done.
+   */
+  V8_INLINE void RegisterExternalReferenceConcurrently(Isolate* isolate) const;
+
   /**
    * Marks the reference to this object independent. Garbage collector is free
    * to ignore any object groups containing this object. Weak callback for an
@@ -1807,6 +1833,33 @@ class V8_EXPORT ValueSerializer {
 
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmCompiledModule> module);
+
+    /**
+     * Called for ArrayBuffer contents of at least the size passed to
+     * ValueSerializer::SetOutOfBandThreshold. The embedder may copy |data|
+     * into memory it manages (e.g. a block shared with the receiving
+     * isolate) and return an ID for it. When deserializing, this ID is
+     * passed to ValueDeserializer::Delegate::GetOutOfBandArrayBufferData.
+     *
+     * |data| points into the V8 heap and is only valid during this call,
+     * which must not call back into V8. Returning Nothing<uint32_t>() writes
+     * the contents inline, as usual.
+     */
+    virtual Maybe<uint32_t> GetOutOfBandArrayBufferId(Isolate* isolate,
+                                                      const void* data,
+                                                      size_t byte_length);
+
+    /**
+     * Similar to GetOutOfBandArrayBufferId, but for the characters of a
+     * string. |length| is in characters, which are Latin-1 if |is_one_byte|
+     * and UTF-16 otherwise. When deserializing, the ID is passed to
+     * ValueDeserializer::Delegate::GetOutOfBandString.
+     */
+    virtual Maybe<uint32_t> GetOutOfBandStringId(Isolate* isolate,
+                                                 const void* data,
+                                                 size_t length,
+                                                 bool is_one_byte);
+
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -1823,6 +1876,18 @@ class V8_EXPORT ValueSerializer {
      * Frees a buffer allocated with |ReallocateBufferMemory|.
      */
     virtual void FreeBufferMemory(void* buffer);
+
+    /**
+     * Called with the data written so far if a chunk size was set with
+     * ValueSerializer::SetChunkSize. The data is only valid during this call
+     * and is not part of the buffer returned by Release, which only holds the
+     * data written after the last chunk.
+     *
+     * If the data cannot be written, Nothing<bool>() should be returned, and
+     * a DataCloneError is thrown unless the embedder throws an exception.
+     */
+    virtual Maybe<bool> WriteChunk(Isolate* isolate, const uint8_t* data,
+                                   size_t size);
   };
 
   explicit ValueSerializer(Isolate* isolate);
@@ -1879,6 +1944,27 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Sets the size in bytes from which ArrayBuffer contents and string
+   * characters are offered to Delegate::GetOutOfBandArrayBufferId and
+   * Delegate::GetOutOfBandStringId instead of being copied into the buffer.
+   * This should not be called when no Delegate was passed.
+   *
+   * The default of 0 never writes data out of band.
+   */
+  void SetOutOfBandThreshold(size_t threshold);
+
+  /**
+   * Enables streaming output. Once at least |chunk_size| bytes have been
+   * written, they are passed to Delegate::WriteChunk before the next value
+   * is written, so that the buffer stays around |chunk_size| bytes plus the
+   * largest single string, ArrayBuffer or array of numbers. This should not
+   * be called when no Delegate was passed.
+   *
+   * The default of 0 keeps all data in the buffer until it is released.
+   */
+  void SetChunkSize(size_t chunk_size);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -1924,6 +2010,46 @@ class V8_EXPORT ValueDeserializer {
      */
     virtual MaybeLocal<WasmCompiledModule> GetWasmModuleFromId(
         Isolate* isolate, uint32_t transfer_id);
+
+    /**
+     * Returns the contents of an ArrayBuffer written out of band by
+     * ValueSerializer::Delegate::GetOutOfBandArrayBufferId. The memory must
+     * hold at least |byte_length| bytes and is used as the backing store of
+     * an externalized ArrayBuffer without being copied, so it must stay
+     * valid for the lifetime of that buffer and must not be handed out to
+     * another buffer, since writes through either would be visible to both.
+     *
+     * If the data cannot be provided, an exception should be thrown and
+     * nullptr returned.
+     */
+    virtual void* GetOutOfBandArrayBufferData(Isolate* isolate, uint32_t id,
+                                              size_t byte_length);
+
+    /**
+     * Returns a string written out of band by
+     * ValueSerializer::Delegate::GetOutOfBandStringId. Embedders can avoid
+     * copying the characters by returning an external string backed by the
+     * shared memory. Strings are immutable, so several strings may share the
+     * same characters.
+     *
+     * If the string cannot be provided, an exception should be thrown and
+     * MaybeLocal<String>() returned.
+     */
+    virtual MaybeLocal<String> GetOutOfBandString(Isolate* isolate,
+                                                  uint32_t id);
+
+    /**
+     * Called when all data passed to the ValueDeserializer constructor has
+     * been read and more is needed, which allows large inputs to be streamed
+     * in chunks, e.g. from a file or socket. The embedder copies up to
+     * |capacity| bytes of the remaining input into |buffer| and returns how
+     * many bytes were copied, or zero at the end of the input. This must not
+     * call back into V8.
+     *
+     * The default provides no further input.
+     */
+    virtual size_t ReadMoreData(Isolate* isolate, uint8_t* buffer,
+                                size_t capacity);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
@@ -1982,6 +2108,8 @@ class V8_EXPORT ValueDeserializer {
    * Reads raw data in various common formats to the buffer.
    * Note that integer types are read in base-128 varint format, not with a
    * binary copy. For use during an override of Delegate::ReadHostObject.
+   * If input is streamed with Delegate::ReadMoreData, data returned by
+   * ReadRawBytes is only valid until the next read.
    */
   V8_WARN_UNUSED_RESULT bool ReadUint32(uint32_t* value);
   V8_WARN_UNUSED_RESULT bool ReadUint64(uint64_t* value);
@@ -3097,6 +3225,17 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Reads the properties |names| of this object into |values|, which must
+   * have room for |length| values. This is equivalent to calling Get for
+   * each name in order, but only pays for entering V8 once. If a getter
+   * throws, reading stops and Nothing is returned.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> GetProperties(Local<Context> context,
+                                                  Local<Name>* names,
+                                                  Local<Value>* values,
+                                                  size_t length);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -3460,6 +3599,18 @@ class V8_EXPORT Object : public Value {
 
   static Local<Object> New(Isolate* isolate);
 
+  /**
+   * Creates a JavaScript object with the given prototype and the writable,
+   * enumerable and configurable data properties |names| set to |values|.
+   * |prototype_or_null| must be null or an object. If a name occurs more
+   * than once, the last value wins. Objects created with the same
+   * prototype and list of names share their map, and with fewer than 128
+   * names the properties are stored inside the object.
+   */
+  static Local<Object> New(Isolate* isolate, Local<Value> prototype_or_null,
+                           Local<Name>* names, Local<Value>* values,
+                           size_t length);
+
   V8_INLINE static Object* Cast(Value* obj);
 
  private:
@@ -4133,10 +4284,6 @@ class V8_EXPORT WasmCompiledModule : public Object {
   V8_INLINE static WasmCompiledModule* Cast(Value* obj);
 
  private:
-  // TODO(ahaas): please remove the friend once streamed compilation is
-  // implemented
-  friend class WasmModuleObjectBuilder;
-
   static MaybeLocal<WasmCompiledModule> Deserialize(
       Isolate* isolate, const CallerOwnedBuffer& serialized_module,
       const CallerOwnedBuffer& wire_bytes);
@@ -4152,18 +4299,19 @@ class V8_EXPORT WasmCompiledModule : public Object {
   static void CheckCast(Value* obj);
 };
 
+/**
+ * Compiles a WebAssembly module while its bytes are received. Function bodies
+ * get compiled in the background as soon as they are complete.
+ */
 class V8_EXPORT WasmModuleObjectBuilder final {
  public:
-  WasmModuleObjectBuilder(Isolate* isolate) : isolate_(isolate) {}
+  WasmModuleObjectBuilder(Isolate* isolate);
   // The buffer passed into OnBytesReceived is owned by the caller.
   void OnBytesReceived(const uint8_t*, size_t size);
   MaybeLocal<WasmCompiledModule> Finish();
 
  private:
   Isolate* isolate_ = nullptr;
-  // TODO(ahaas): We probably need none of this below here once streamed
-  // compilation is implemented.
-  typedef std::pair<std::unique_ptr<const uint8_t[]>, size_t> Buffer;
 
   // Disable copy semantics *in this implementation*. We can choose to
   // relax this, albeit it's not clear why.
@@ -4172,8 +4320,7 @@ class V8_EXPORT WasmModuleObjectBuilder final {
   WasmModuleObjectBuilder& operator=(const WasmModuleObjectBuilder&) = delete;
   WasmModuleObjectBuilder& operator=(WasmModuleObjectBuilder&&) = default;
 
-  std::vector<Buffer> received_buffers_;
-  size_t total_size_ = 0;
+  std::shared_ptr<internal::wasm::StreamingDecoder> streaming_decoder_;
 };
 
 #ifndef V8_ARRAY_BUFFER_INTERNAL_FIELD_COUNT
@@ -4264,6 +4411,17 @@ class V8_EXPORT ArrayBuffer : public Object {
      * |delete allocator| once it is no longer in use.
      */
     static Allocator* NewDefaultAllocator();
+
+    /**
+     * Allocator which keeps freed backing stores of up to 4MB in size class
+     * pools for reuse, for embedders allocating buffers at a high rate. Large
+     * blocks are backed by virtual memory and zeroed lazily by the OS. The
+     * pools are emptied by Isolate::MemoryPressureNotification.
+     *
+     * Caller takes ownership, i.e. the returned object needs to be freed using
+     * |delete allocator| once it is no longer in use.
+     */
+    static Allocator* NewPoolingAllocator();
   };
 
   /**
@@ -5298,6 +5456,37 @@ typedef bool (*AccessCheckCallback)(Local<Context> accessing_context,
                                     Local<Object> accessed_object,
                                     Local<Value> data);
 
+/**
+ * A C++ function that optimized code may call directly instead of going
+ * through the FunctionCallback of a FunctionTemplate, see
+ * FunctionTemplate::SetFastCallHandler.
+ *
+ * The function takes |argument_count| arguments of type int32_t, which are
+ * the JavaScript arguments converted as by ToInt32, and returns either void
+ * or an int32_t. It is not passed the receiver, the holder or any data, and it
+ * must not call into V8, allocate on the JavaScript heap or throw.
+ */
+class FastApiCallback {
+ public:
+  enum class ReturnType : uint8_t { kVoid, kInt32 };
+
+  static const int kMaxArgumentCount = 4;
+
+  FastApiCallback(void* function, ReturnType return_type, int argument_count)
+      : function_(function),
+        return_type_(return_type),
+        argument_count_(argument_count) {}
+
+  void* function() const { return function_; }
+  ReturnType return_type() const { return return_type_; }
+  int argument_count() const { return argument_count_; }
+
+ private:
+  void* function_;
+  ReturnType return_type_;
+  int argument_count_;
+};
+
 /**
  * A FunctionTemplate is used to create functions at runtime. There
  * can only be one function created from a FunctionTemplate in a
@@ -5440,6 +5629,15 @@ class V8_EXPORT FunctionTemplate : public Template {
   void SetCallHandler(FunctionCallback callback,
                       Local<Value> data = Local<Value>());
 
+  /**
+   * Set a fast C++ handler that optimized code calls instead of the
+   * call-handler callback when the function is called with exactly
+   * |fast_callback.argument_count()| arguments that are all numbers and a
+   * receiver that passes the signature check. Both handlers must compute the
+   * same result; the call-handler callback is still used for all other calls.
+   */
+  void SetFastCallHandler(const FastApiCallback& fast_callback);
+
   /** Set the predefined length property for the FunctionTemplate. */
   void SetLength(int length);
 
@@ -6421,6 +6619,124 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Aggregated count and time of one runtime call counter. With
+ * --runtime-call-stats-sampling the time is estimated from periodic samples
+ * of the current counter.
+ */
+class V8_EXPORT RuntimeCallCounterStatistics {
+ public:
+  RuntimeCallCounterStatistics();
+  const char* name() { return name_; }
+  int64_t count() { return count_; }
+  int64_t time_in_us() { return time_in_us_; }
+
+ private:
+  const char* name_;
+  int64_t count_;
+  int64_t time_in_us_;
+
+  friend class Isolate;
+};
+
+/**
+ * Histogram of the pause times of one garbage collection phase since the
+ * isolate was created. Bucket i counts the pauses that took at least
+ * BucketUpperBoundInMs(i - 1) and less than BucketUpperBoundInMs(i)
+ * milliseconds. The last bucket has no upper bound.
+ */
+class V8_EXPORT GCPauseHistogram {
+ public:
+  static const int kBucketCount = 12;
+
+  GCPauseHistogram();
+  static double BucketUpperBoundInMs(int bucket);
+  size_t bucket(int bucket) const { return buckets_[bucket]; }
+  size_t count() const { return count_; }
+  double total_time_in_ms() const { return total_time_in_ms_; }
+  double max_time_in_ms() const { return max_time_in_ms_; }
+
+ private:
+  size_t buckets_[kBucketCount];
+  size_t count_;
+  double total_time_in_ms_;
+  double max_time_in_ms_;
+
+  friend class Isolate;
+};
+
+/**
+ * Pause time histograms of the garbage collection phases and the throughput
+ * of the collectors. Filling these in is cheap, so that they can be sampled
+ * periodically.
+ */
+class V8_EXPORT GCStatistics {
+ public:
+  enum Phase {
+    // Whole pauses of young generation collections.
+    kScavenge,
+    // Whole atomic pauses of full collections.
+    kMarkCompact,
+    // Parts of the atomic pause of full collections.
+    kMarking,
+    kSweeping,
+    kEvacuation,
+    kPointerUpdate,
+    kEmbedderTracing,
+    // Steps of incremental marking.
+    kIncrementalMarking,
+    kPhaseCount
+  };
+
+  GCStatistics();
+  const GCPauseHistogram& phase(Phase phase) const { return phases_[phase]; }
+  double scavenge_speed_in_bytes_per_ms() const {
+    return scavenge_speed_in_bytes_per_ms_;
+  }
+  double mark_compact_speed_in_bytes_per_ms() const {
+    return mark_compact_speed_in_bytes_per_ms_;
+  }
+  double incremental_marking_speed_in_bytes_per_ms() const {
+    return incremental_marking_speed_in_bytes_per_ms_;
+  }
+
+ private:
+  GCPauseHistogram phases_[kPhaseCount];
+  double scavenge_speed_in_bytes_per_ms_;
+  double mark_compact_speed_in_bytes_per_ms_;
+  double incremental_marking_speed_in_bytes_per_ms_;
+
+  friend class Isolate;
+};
+
+/**
+ * Usage of the blocks that back the local handles of an isolate. Each block
+ * holds handles_per_block() handles. Blocks are taken from a pool of free
+ * blocks when a HandleScope grows and returned to it when the scope closes.
+ */
+class V8_EXPORT HandleScopeStatistics {
+ public:
+  HandleScopeStatistics();
+  size_t handles_per_block() { return handles_per_block_; }
+  // Blocks that had to be allocated because the pool was empty.
+  size_t allocated_block_count() { return allocated_block_count_; }
+  // Blocks that were taken from the pool.
+  size_t reused_block_count() { return reused_block_count_; }
+  // Blocks that are in the pool right now.
+  size_t pooled_block_count() { return pooled_block_count_; }
+  // The largest number of blocks in use at the same time.
+  size_t peak_block_count() { return peak_block_count_; }
+
+ private:
+  size_t handles_per_block_;
+  size_t allocated_block_count_;
+  size_t reused_block_count_;
+  size_t pooled_block_count_;
+  size_t peak_block_count_;
+
+  friend class Isolate;
+};
+
 class RetainedObjectInfo;
 
 
@@ -6572,6 +6888,37 @@ class V8_EXPORT PersistentHandleVisitor {  // NOLINT
  */
 enum class MemoryPressureLevel { kNone, kModerate, kCritical };
 
+/**
+ * Interface for telling V8 how much memory the embedder wants the process to
+ * use. When the estimated resident set size approaches the target, V8 grows
+ * the heap more slowly, lowers the external memory limit, and starts memory
+ * reducing garbage collections more eagerly. The methods are called on the
+ * isolate's thread during garbage collection and memory reducer events.
+ */
+class V8_EXPORT MemoryTarget {
+ public:
+  virtual ~MemoryTarget() {}
+
+  /**
+   * Returns the resident set size in bytes that the embedder would like the
+   * process to stay below.
+   */
+  virtual size_t TargetResidentSetSize() = 0;
+
+  /**
+   * Returns the current resident set size of the process in bytes. When 0 is
+   * returned, V8 estimates it from the memory committed by the heap and the
+   * external memory reported via AdjustAmountOfExternalAllocatedMemory.
+   */
+  virtual size_t CurrentResidentSetSize() { return 0; }
+
+  /**
+   * Returns the amount of external memory in bytes that may be allocated
+   * before V8 collects garbage to free it, or 0 to use V8's default limit.
+   */
+  virtual size_t ExternalMemoryBudget() { return 0; }
+};
+
 /**
  * Interface for tracing through the embedder heap. During a v8 garbage
  * collection, v8 collects hidden fields of all potential wrappers, and at the
@@ -6599,6 +6946,16 @@ class V8_EXPORT EmbedderHeapTracer {
    *
    * The embedder is expected to store them somewhere and trace reachable
    * wrappers from them when called through |AdvanceTracing|.
+   *
+   * Wrappers are always registered on the main thread, including those found
+   * by v8's concurrent marking threads. Instead of tracing only within
+   * |AdvanceTracing|, the embedder may also trace from registered wrappers on
+   * its own threads while JavaScript runs, reporting the v8 objects it finds
+   * through PersistentBase::RegisterExternalReferenceConcurrently. Such an
+   * embedder must keep the objects behind the registered internal fields
+   * alive until |TraceEpilogue| or |AbortTracing|, and must finish its
+   * concurrent tracing before returning from |AdvanceTracing| with
+   * FORCE_COMPLETION.
    */
   virtual void RegisterV8References(
       const std::vector<std::pair<void*, void*> >& embedder_fields) = 0;
@@ -6978,6 +7335,13 @@ class V8_EXPORT Isolate {
    */
   void MemoryPressureNotification(MemoryPressureLevel level);
 
+  /**
+   * Sets the memory target that guides V8's memory reducer and heap growing
+   * heuristics, or clears it if |target| is nullptr. The target is not owned
+   * by V8 and must outlive the isolate or be cleared before it is destroyed.
+   */
+  void SetMemoryTarget(MemoryTarget* target);
+
   /**
    * Methods below this point require holding a lock (using Locker) in
    * a multi-threaded environment.
@@ -7005,6 +7369,19 @@ class V8_EXPORT Isolate {
    */
   void Dispose();
 
+  /**
+   * Prepares the isolate to run unrelated scripts, as a cheaper alternative to
+   * disposing it and creating a new one. Pending exceptions and microtasks, the
+   * Symbol.for registry and the compilation cache are discarded, and all
+   * contexts and objects no longer referenced by the embedder are collected.
+   * The heap, builtins and embedder settings such as callbacks are kept.
+   *
+   * Contexts, handles and templates the embedder still holds on to stay
+   * valid, so these should be released first. The isolate must not be
+   * entered by any thread.
+   */
+  void ResetForReuse();
+
   /**
    * Dumps activated low-level V8 internal stats. This can be used instead
    * of performing a full isolate disposal.
@@ -7086,6 +7463,49 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Returns the number of runtime call counters.
+   */
+  size_t NumberOfRuntimeCallCounters();
+
+  /**
+   * Get the statistics of a runtime call counter.
+   *
+   * \param counter_statistics The RuntimeCallCounterStatistics object to fill
+   *   in.
+   * \param index The index of the counter, which ranges from 0 to
+   *   NumberOfRuntimeCallCounters() - 1.
+   * \returns true on success, false if runtime call stats are disabled.
+   */
+  bool GetRuntimeCallCounterStatistics(
+      RuntimeCallCounterStatistics* counter_statistics, size_t index);
+
+  /**
+   * Get pause time histograms and throughput of the garbage collector.
+   *
+   * \param gc_statistics The GCStatistics object to fill in.
+   * \returns true on success.
+   */
+  bool GetGCStatistics(GCStatistics* gc_statistics);
+
+  /**
+   * Get statistics about the handle blocks used by HandleScopes.
+   *
+   * \param handle_scope_statistics The HandleScopeStatistics object to fill
+   *   in.
+   * \returns true on success.
+   */
+  bool GetHandleScopeStatistics(HandleScopeStatistics* handle_scope_statistics);
+
+  /**
+   * Sets how many free handle blocks the isolate keeps for reuse, instead of
+   * freeing them when the HandleScopes that used them close. Embedders that
+   * open and close deep scopes at a high rate can raise this to avoid
+   * allocating blocks; see GetHandleScopeStatistics for sizing it. The
+   * default is 4.
+   */
+  void SetHandleBlockPoolSize(size_t block_count);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -7482,6 +7902,23 @@ class V8_EXPORT Isolate {
    */
   bool IsHeapLimitIncreasedForDebugging();
 
+  /**
+   * Returns the pretenuring decisions that allocation-site feedback has made
+   * for object and array literals in this isolate, so that they can be passed
+   * to SetPretenuringDecisions() of an isolate in a later run. Ownership of
+   * the returned data is transferred to the caller, who must delete[] it.
+   */
+  StartupData GetPretenuringDecisions();
+
+  /**
+   * Makes object and array literals that were pretenured in a previous run,
+   * as recorded by GetPretenuringDecisions(), start out pretenured in this
+   * isolate. Should be called before any scripts are run. Returns false if
+   * the data was produced by a different V8 version or flag configuration,
+   * in which case no decisions are loaded. The data is copied.
+   */
+  bool SetPretenuringDecisions(const StartupData& data);
+
   /**
    * Allows the host application to provide the address of a function that is
    * notified each time code is added, moved or removed.
@@ -7668,6 +8105,52 @@ class V8_EXPORT Isolate {
   void CheckMemoryPressure();
 };
 
+/**
+ * A pool of isolates created with the same parameters, for embedders that run
+ * each short-lived script in an isolate of its own. Isolates returned to the
+ * pool are reset with Isolate::ResetForReuse and handed out again, which is
+ * much cheaper than creating new ones. The pool is thread-safe.
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  /**
+   * |params| are used to create isolates when the pool is empty, and must
+   * outlive the pool. At most |max_idle_isolates| are kept for reuse; further
+   * isolates are disposed when they are released.
+   */
+  IsolatePool(const Isolate::CreateParams& params, size_t max_idle_isolates);
+
+  /**
+   * Disposes the isolates in the pool. All isolates acquired from the pool
+   * must have been released before.
+   */
+  ~IsolatePool();
+
+  /**
+   * Returns an isolate that is not entered by any thread, reusing one from
+   * the pool if possible.
+   */
+  Isolate* Acquire();
+
+  /**
+   * Returns an isolate acquired from this pool. It must not be entered by any
+   * thread, and the embedder must not use it afterwards.
+   */
+  void Release(Isolate* isolate);
+
+  /**
+   * Returns the number of isolates currently kept for reuse.
+   */
+  size_t idle_isolate_count();
+
+ private:
+  IsolatePool(const IsolatePool&) = delete;
+  void operator=(const IsolatePool&) = delete;
+
+  struct PrivateData;
+  PrivateData* private_;
+};
+
 class V8_EXPORT StartupData {
  public:
   const char* data;
@@ -8053,7 +8536,23 @@ class V8_EXPORT V8 {
    * Enable the default signal handler rather than using one provided by the
    * embedder.
    */
-  static bool RegisterDefaultSignalHandler();
+  V8_DEPRECATE_SOON("Use EnableWebAssemblyTrapHandler",
+                    static bool RegisterDefaultSignalHandler());
+
+  /**
+   * Activate trap-based bounds checking for WebAssembly, where it is
+   * supported (currently Linux x64). Out of bounds memory accesses are then
+   * caught by a SIGSEGV handler instead of explicit checks in the generated
+   * code. This must be called before any WebAssembly module is compiled.
+   *
+   * \param use_v8_signal_handler Whether V8 should install its own SIGSEGV
+   * handler. Any handler installed before it is called for faults that V8 does
+   * not handle. Embedders that install their own handler instead must pass
+   * the signal to TryHandleSignal first.
+   *
+   * Returns false if trap-based bounds checks are not available.
+   */
+  static bool EnableWebAssemblyTrapHandler(bool use_v8_signal_handler);
 
  private:
   V8();
@@ -8077,6 +8576,8 @@ class V8_EXPORT V8 {
 
   static void RegisterExternallyReferencedObject(internal::Object** object,
                                                  internal::Isolate* isolate);
+  static void RegisterExternallyReferencedObjectConcurrently(
+      internal::Object** object, internal::Isolate* isolate);
 
   template <class K, class V, class T>
   friend class PersistentValueMapBase;
@@ -8102,7 +8603,7 @@ class V8_EXPORT V8 {
  */
 class V8_EXPORT SnapshotCreator {
  public:
-  enum class FunctionCodeHandling { kClear, kKeep };
+  enum class FunctionCodeHandling { kClear, kKeep, kKeepWithFeedback };
 
   /**
    * Create and enter an isolate, and set it up for serialization.
@@ -8151,7 +8652,9 @@ class V8_EXPORT SnapshotCreator {
    * Created a snapshot data blob.
    * This must not be called from within a handle scope.
    * \param function_code_handling whether to include compiled function code
-   *        in the snapshot.
+   *        in the snapshot. With kKeepWithFeedback, functions in the
+   *        serialized contexts also keep the type feedback they collected, so
+   *        that they start out warm. Optimized code is never included.
    * \returns { nullptr, 0 } on failure, and a startup snapshot on success. The
    *        caller acquires ownership of the data array in the return value.
    */
@@ -9201,6 +9704,15 @@ void PersistentBase<T>::RegisterExternalReference(Isolate* isolate) const {
       reinterpret_cast<internal::Isolate*>(isolate));
 }
 
+template <class T>
+void PersistentBase<T>::RegisterExternalReferenceConcurrently(
+    Isolate* isolate) const {
+  if (IsEmpty()) return;
+  V8::RegisterExternallyReferencedObjectConcurrently(
+      reinterpret_cast<internal::Object**>(this->val_),
+      reinterpret_cast<internal::Isolate*>(isolate));
+}
+
 template <class T>
 void PersistentBase<T>::MarkIndependent() {
   typedef internal::Internals I;
@@ -547,6 +547,18 @@ MaybeHandle<JSObject> ApiNatives::InstantiateObject(
                                            false);
 }
 
+MaybeHandle<JSObject> ApiNatives::CopyCachedInstance(
+    Isolate* isolate, Handle<ObjectTemplateInfo> data) {
+  int serial_number = Smi::cast(data->serial_number())->value();
+  Handle<JSObject> boilerplate;
+  if (serial_number == 0 ||
+      !ProbeInstantiationsCache(isolate, serial_number, CachingMode::kLimited)
+           .ToHandle(&boilerplate)) {
+    return MaybeHandle<JSObject>();
+  }
+  return isolate->factory()->CopyJSObject(boilerplate);
+}
+
 MaybeHandle<JSObject> ApiNatives::InstantiateRemoteObject(
     Handle<ObjectTemplateInfo> data) {
   Isolate* isolate = data->GetIsolate();
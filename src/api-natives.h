@@ -29,6 +29,12 @@ class ApiNatives {
   MUST_USE_RESULT static MaybeHandle<JSObject> InstantiateRemoteObject(
       Handle<ObjectTemplateInfo> data);
 
+  // Returns a copy of the instance of |data| cached in the current native
+  // context, or an empty handle if |data| was not instantiated there yet.
+  // Unlike InstantiateObject, this never runs script or throws.
+  static MaybeHandle<JSObject> CopyCachedInstance(
+      Isolate* isolate, Handle<ObjectTemplateInfo> data);
+
   enum ApiInstanceType {
     JavaScriptObjectType,
     GlobalObjectType,
@@ -41,6 +41,9 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/embedder-tracing.h"
+#include "src/heap/gc-tracer.h"
+#include "src/heap/pretenuring-decisions.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
@@ -50,6 +53,7 @@
 #include "src/parsing/parser.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/pending-compilation-error-handler.h"
+#include "src/pooling-array-buffer-allocator.h"
 #include "src/profiler/cpu-profiler.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
@@ -62,6 +66,7 @@
 #include "src/runtime-profiler.h"
 #include "src/runtime/runtime.h"
 #include "src/simulator.h"
+#include "src/snapshot/builtin-serializer.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/snapshot.h"
@@ -74,6 +79,7 @@
 #include "src/value-serializer.h"
 #include "src/version.h"
 #include "src/vm-state-inl.h"
+#include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/wasm/wasm-result.h"
@@ -671,6 +677,17 @@ StartupData SnapshotCreator::CreateBlob(
       i::GarbageCollectionReason::kSnapshotCreator);
   isolate->heap()->CompactWeakFixedArrays();
 
+  // Builtins that are deserialized lazily are represented by placeholders in
+  // the startup snapshot, which have to be allocated up front. They are only
+  // held on to by raw pointer, as there must not be any handles left.
+  i::FixedArray* lazy_builtin_placeholders = nullptr;
+  {
+    i::HandleScope scope(isolate);
+    i::Handle<i::FixedArray> placeholders =
+        i::BuiltinSerializer::CreateLazyBuiltinPlaceholders(isolate);
+    if (!placeholders.is_null()) lazy_builtin_placeholders = *placeholders;
+  }
+
   i::DisallowHeapAllocation no_gc_from_here_on;
 
   i::List<i::Object*> contexts(num_additional_contexts);
@@ -694,13 +711,24 @@ StartupData SnapshotCreator::CreateBlob(
     if (!current_obj->IsJSFunction()) continue;
     i::JSFunction* fun = i::JSFunction::cast(current_obj);
     fun->CompleteInobjectSlackTrackingIfActive();
+    if (function_code_handling ==
+        SnapshotCreator::FunctionCodeHandling::kKeepWithFeedback) {
+      // Feedback is kept, but optimized code is not serialized. Send
+      // functions back to their unoptimized code.
+      if (fun->IsOptimized()) fun->ReplaceCode(fun->shared()->code());
+      if (fun->has_feedback_vector()) {
+        fun->ClearOptimizedCodeSlot("snapshot");
+        if (fun->HasOptimizationMarker()) fun->ClearOptimizationMarker();
+      }
+    }
   }
 
 #ifdef DEBUG
   i::ExternalReferenceTable::instance(isolate)->ResetCount();
 #endif  // DEBUG
 
-  i::StartupSerializer startup_serializer(isolate, function_code_handling);
+  i::StartupSerializer startup_serializer(isolate, function_code_handling,
+                                          lazy_builtin_placeholders);
   startup_serializer.SerializeStrongReferences();
 
   // Serialize each context with a new partial serializer.
@@ -721,6 +749,20 @@ StartupData SnapshotCreator::CreateBlob(
     context_snapshots.Add(new i::SnapshotData(&partial_serializer));
   }
 
+  // Serialize each lazily deserialized builtin with a new builtin serializer.
+  i::List<i::SnapshotData*> builtin_snapshots(i::Builtins::builtin_count);
+  for (int i = 0; i < i::Builtins::builtin_count; i++) {
+    i::SnapshotData* builtin_snapshot = nullptr;
+    if (lazy_builtin_placeholders != nullptr &&
+        lazy_builtin_placeholders->get(i)->IsCode()) {
+      i::BuiltinSerializer builtin_serializer(isolate, &startup_serializer);
+      builtin_serializer.Serialize(
+          isolate->builtins()->builtin(static_cast<i::Builtins::Name>(i)));
+      builtin_snapshot = new i::SnapshotData(&builtin_serializer);
+    }
+    builtin_snapshots.Add(builtin_snapshot);
+  }
+
   startup_serializer.SerializeWeakReferencesAndDeferred();
 
 #ifdef DEBUG
@@ -730,10 +772,13 @@ StartupData SnapshotCreator::CreateBlob(
 #endif  // DEBUG
 
   i::SnapshotData startup_snapshot(&startup_serializer);
-  StartupData result =
-      i::Snapshot::CreateSnapshotBlob(&startup_snapshot, &context_snapshots);
+  StartupData result = i::Snapshot::CreateSnapshotBlob(
+      &startup_snapshot, &builtin_snapshots, &context_snapshots);
 
-  // Delete heap-allocated context snapshot instances.
+  // Delete heap-allocated builtin and context snapshot instances.
+  for (const auto& builtin_snapshot : builtin_snapshots) {
+    delete builtin_snapshot;
+  }
   for (const auto& context_snapshot : context_snapshots) {
     delete context_snapshot;
   }
@@ -940,6 +985,12 @@ void V8::RegisterExternallyReferencedObject(i::Object** object,
   isolate->heap()->RegisterExternallyReferencedObject(object);
 }
 
+void V8::RegisterExternallyReferencedObjectConcurrently(i::Object** object,
+                                                        i::Isolate* isolate) {
+  isolate->heap()->local_embedder_heap_tracer()
+      ->AddExternalReferenceConcurrently(object);
+}
+
 void V8::MakeWeak(i::Object** location, void* parameter,
                   int embedder_field_index1, int embedder_field_index2,
                   WeakCallbackInfo<void>::Callback weak_callback) {
@@ -1423,6 +1474,30 @@ void FunctionTemplate::SetCallHandler(FunctionCallback callback,
   info->set_call_code(*obj);
 }
 
+void FunctionTemplate::SetFastCallHandler(
+    const FastApiCallback& fast_callback) {
+  auto info = Utils::OpenHandle(this);
+  EnsureNotInstantiated(info, "v8::FunctionTemplate::SetFastCallHandler");
+  i::Isolate* isolate = info->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  Utils::ApiCheck(fast_callback.argument_count() >= 0 &&
+                      fast_callback.argument_count() <=
+                          FastApiCallback::kMaxArgumentCount,
+                  "v8::FunctionTemplate::SetFastCallHandler",
+                  "Too many arguments");
+  i::HandleScope scope(isolate);
+  i::Handle<i::Tuple2> obj = i::Handle<i::Tuple2>::cast(
+      isolate->factory()->NewStruct(i::TUPLE2_TYPE));
+  SET_FIELD_WRAPPED(obj, set_value1, fast_callback.function());
+  int signature =
+      i::FunctionTemplateInfo::FastCallReturnsValueBit::encode(
+          fast_callback.return_type() != FastApiCallback::ReturnType::kVoid) |
+      i::FunctionTemplateInfo::FastCallArgumentCountBits::encode(
+          fast_callback.argument_count());
+  obj->set_value2(i::Smi::FromInt(signature));
+  info->set_fast_call_info(*obj);
+}
+
 
 static i::Handle<i::AccessorInfo> SetAccessorInfoProperties(
     i::Handle<i::AccessorInfo> obj, v8::Local<Name> name,
@@ -2538,7 +2613,7 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   if (source->info->literal() != nullptr) {
     // Parsing has succeeded.
     result = i::Compiler::GetSharedFunctionInfoForStreamedScript(
-        script, source->info.get(), str->length());
+        script, source->info.get(), str->length(), source->compile_jobs.get());
   }
   has_pending_exception = result.is_null();
   if (has_pending_exception) isolate->ReportPendingMessages();
@@ -3249,6 +3324,16 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetOutOfBandArrayBufferId(
+    Isolate* v8_isolate, const void* data, size_t byte_length) {
+  return Nothing<uint32_t>();
+}
+
+Maybe<uint32_t> ValueSerializer::Delegate::GetOutOfBandStringId(
+    Isolate* v8_isolate, const void* data, size_t length, bool is_one_byte) {
+  return Nothing<uint32_t>();
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3260,6 +3345,12 @@ void ValueSerializer::Delegate::FreeBufferMemory(void* buffer) {
   return free(buffer);
 }
 
+Maybe<bool> ValueSerializer::Delegate::WriteChunk(Isolate* v8_isolate,
+                                                  const uint8_t* data,
+                                                  size_t size) {
+  return Nothing<bool>();
+}
+
 struct ValueSerializer::PrivateData {
   explicit PrivateData(i::Isolate* i, ValueSerializer::Delegate* delegate)
       : isolate(i), serializer(i, delegate) {}
@@ -3282,6 +3373,14 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetOutOfBandThreshold(size_t threshold) {
+  private_->serializer.SetOutOfBandThreshold(threshold);
+}
+
+void ValueSerializer::SetChunkSize(size_t chunk_size) {
+  private_->serializer.SetChunkSize(chunk_size);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -3348,6 +3447,30 @@ MaybeLocal<WasmCompiledModule> ValueDeserializer::Delegate::GetWasmModuleFromId(
   return MaybeLocal<WasmCompiledModule>();
 }
 
+void* ValueDeserializer::Delegate::GetOutOfBandArrayBufferData(
+    Isolate* v8_isolate, uint32_t id, size_t byte_length) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return nullptr;
+}
+
+MaybeLocal<String> ValueDeserializer::Delegate::GetOutOfBandString(
+    Isolate* v8_isolate, uint32_t id) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<String>();
+}
+
+size_t ValueDeserializer::Delegate::ReadMoreData(Isolate* v8_isolate,
+                                               uint8_t* buffer,
+                                               size_t capacity) {
+  return 0;
+}
+
 struct ValueDeserializer::PrivateData {
   PrivateData(i::Isolate* i, i::Vector<const uint8_t> data, Delegate* delegate)
       : isolate(i), deserializer(i, data, delegate) {}
@@ -4537,6 +4660,39 @@ MaybeLocal<Value> v8::Object::Get(Local<v8::Context> context,
 }
 
 
+Maybe<bool> v8::Object::GetProperties(Local<Context> context,
+                                      Local<Name>* names,
+                                      Local<Value>* values, size_t length) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  i::Handle<i::FixedArray> results;
+  {
+    // Collect the values in a FixedArray so that the temporary handles for
+    // the lookups do not outlive this call.
+    ENTER_V8(isolate, context, Object, GetProperties, Nothing<bool>(),
+             i::HandleScope);
+    auto self = Utils::OpenHandle(this);
+    i::Handle<i::FixedArray> array =
+        isolate->factory()->NewFixedArray(static_cast<int>(length));
+    for (size_t i = 0; i < length; i++) {
+      i::HandleScope scope(isolate);
+      i::LookupIterator it = i::LookupIterator::PropertyOrElement(
+          isolate, self, Utils::OpenHandle(*names[i]));
+      i::Handle<i::Object> result;
+      has_pending_exception = !i::Object::GetProperty(&it).ToHandle(&result);
+      if (has_pending_exception) break;
+      array->set(static_cast<int>(i), *result);
+    }
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    results = handle_scope.CloseAndEscape(array);
+  }
+  for (size_t i = 0; i < length; i++) {
+    values[i] =
+        Utils::ToLocal(i::handle(results->get(static_cast<int>(i)), isolate));
+  }
+  return Just(true);
+}
+
+
 Local<Value> v8::Object::Get(v8::Local<Value> key) {
   auto context = ContextFromHeapObject(Utils::OpenHandle(this));
   RETURN_TO_LOCAL_UNCHECKED(Get(context, key), Value);
@@ -6334,7 +6490,11 @@ bool V8::TryHandleSignal(int signum, void* info, void* context) {
 #endif
 
 bool V8::RegisterDefaultSignalHandler() {
-  return v8::internal::trap_handler::RegisterDefaultSignalHandler();
+  return v8::internal::trap_handler::EnableTrapHandler(true);
+}
+
+bool V8::EnableWebAssemblyTrapHandler(bool use_v8_signal_handler) {
+  return v8::internal::trap_handler::EnableTrapHandler(use_v8_signal_handler);
 }
 
 void v8::V8::SetEntropySource(EntropySource entropy_source) {
@@ -6367,6 +6527,31 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(0) {}
 
+GCPauseHistogram::GCPauseHistogram()
+    : count_(0), total_time_in_ms_(0), max_time_in_ms_(0) {
+  for (int i = 0; i < kBucketCount; i++) buckets_[i] = 0;
+}
+
+// static
+double GCPauseHistogram::BucketUpperBoundInMs(int bucket) {
+  Utils::ApiCheck(0 <= bucket && bucket < kBucketCount,
+                  "v8::GCPauseHistogram::BucketUpperBoundInMs",
+                  "Invalid bucket");
+  return i::GCTracer::PauseHistogram::BucketUpperBound(bucket);
+}
+
+GCStatistics::GCStatistics()
+    : scavenge_speed_in_bytes_per_ms_(0),
+      mark_compact_speed_in_bytes_per_ms_(0),
+      incremental_marking_speed_in_bytes_per_ms_(0) {}
+
+HandleScopeStatistics::HandleScopeStatistics()
+    : handles_per_block_(0),
+      allocated_block_count_(0),
+      reused_block_count_(0),
+      pooled_block_count_(0),
+      peak_block_count_(0) {}
+
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
                                             space_size_(0),
                                             space_used_size_(0),
@@ -6383,6 +6568,9 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0), bytecode_and_metadata_size_(0) {}
 
+RuntimeCallCounterStatistics::RuntimeCallCounterStatistics()
+    : name_(nullptr), count_(0), time_in_us_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -6694,6 +6882,22 @@ void Context::SetErrorMessageForCodeGenerationFromStrings(Local<String> error) {
 size_t Context::EstimatedSize() { return 0; }
 
 MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
+  {
+    // Once the template was instantiated in the current context, new
+    // instances are copies of the cached one. Copying runs no script, so it
+    // does not need the full setup for execution.
+    i::Isolate* isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+    if (isolate->context() != nullptr &&
+        isolate->raw_native_context() == *Utils::OpenHandle(*context)) {
+      LOG_API(isolate, ObjectTemplate, NewInstance);
+      ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+      i::Handle<i::JSObject> result;
+      if (i::ApiNatives::CopyCachedInstance(isolate, Utils::OpenHandle(this))
+              .ToHandle(&result)) {
+        return Utils::ToLocal(result);
+      }
+    }
+  }
   PREPARE_FOR_EXECUTION(context, ObjectTemplate, NewInstance, Object);
   auto self = Utils::OpenHandle(this);
   Local<Object> result;
@@ -7066,6 +7270,42 @@ Local<v8::Object> v8::Object::New(Isolate* isolate) {
   return Utils::ToLocal(obj);
 }
 
+Local<v8::Object> v8::Object::New(Isolate* isolate,
+                                  Local<Value> prototype_or_null,
+                                  Local<Name>* names, Local<Value>* values,
+                                  size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Handle<i::Object> proto = Utils::OpenHandle(*prototype_or_null);
+  if (!Utils::ApiCheck(proto->IsNull(i_isolate) || proto->IsJSReceiver(),
+                       "v8::Object::New",
+                       "prototype must be null or an object")) {
+    return Local<v8::Object>();
+  }
+  LOG_API(i_isolate, Object, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+
+  // Start from a map with room for all properties in the object, and let the
+  // transitions out of it cache the final map for each list of names.
+  i::Handle<i::Map> map;
+  if (*proto == i_isolate->native_context()->initial_object_prototype()) {
+    map = i_isolate->factory()->ObjectLiteralMapFromCache(
+        i_isolate->native_context(), static_cast<int>(length));
+  } else {
+    map = i::Map::GetObjectCreateMap(i::Handle<i::HeapObject>::cast(proto));
+  }
+  i::Handle<i::JSObject> obj =
+      map->is_dictionary_map()
+          ? i_isolate->factory()->NewSlowJSObjectFromMap(map)
+          : i_isolate->factory()->NewJSObjectFromMap(map);
+  for (size_t i = 0; i < length; i++) {
+    i::Handle<i::Name> name = Utils::OpenHandle(*names[i]);
+    i::Handle<i::Object> value = Utils::OpenHandle(*values[i]);
+    i::JSObject::DefinePropertyOrElementIgnoreAttributes(obj, name, value)
+        .Assert();
+  }
+  return Utils::ToLocal(obj);
+}
+
 
 Local<v8::Value> v8::NumberObject::New(Isolate* isolate, double value) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
@@ -7189,6 +7429,7 @@ void v8::Date::DateTimeConfigurationChangeNotification(Isolate* isolate) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   LOG_API(i_isolate, Date, DateTimeConfigurationChangeNotification);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::DateCache::ResetSharedTimezoneData();
   i_isolate->date_cache()->ResetDateCache();
   if (!i_isolate->eternal_handles()->Exists(
           i::EternalHandles::DATE_CACHE_VERSION)) {
@@ -7799,27 +8040,23 @@ MaybeLocal<WasmCompiledModule> WasmCompiledModule::Compile(Isolate* isolate,
       Utils::ToLocal(maybe_compiled.ToHandleChecked()));
 }
 
+WasmModuleObjectBuilder::WasmModuleObjectBuilder(Isolate* isolate)
+    : isolate_(isolate),
+      streaming_decoder_(new i::wasm::StreamingDecoder(
+          reinterpret_cast<i::Isolate*>(isolate))) {}
+
 void WasmModuleObjectBuilder::OnBytesReceived(const uint8_t* bytes,
                                               size_t size) {
-  std::unique_ptr<uint8_t[]> cloned_bytes(new uint8_t[size]);
-  memcpy(cloned_bytes.get(), bytes, size);
-  received_buffers_.push_back(
-      Buffer(std::unique_ptr<const uint8_t[]>(
-                 const_cast<const uint8_t*>(cloned_bytes.release())),
-             size));
-  total_size_ += size;
+  streaming_decoder_->OnBytesReceived(i::Vector<const uint8_t>(bytes, size));
 }
 
 MaybeLocal<WasmCompiledModule> WasmModuleObjectBuilder::Finish() {
-  std::unique_ptr<uint8_t[]> wire_bytes(new uint8_t[total_size_]);
-  uint8_t* insert_at = wire_bytes.get();
-
-  for (size_t i = 0; i < received_buffers_.size(); ++i) {
-    const Buffer& buff = received_buffers_[i];
-    memcpy(insert_at, buff.first.get(), buff.second);
-    insert_at += buff.second;
-  }
-  return WasmCompiledModule::Compile(isolate_, wire_bytes.get(), total_size_);
+  i::MaybeHandle<i::WasmModuleObject> maybe_module =
+      streaming_decoder_->Finish();
+  if (maybe_module.is_null()) return MaybeLocal<WasmCompiledModule>();
+  return Local<WasmCompiledModule>::Cast(
+      Utils::ToLocal(i::Handle<i::JSObject>::cast(
+          maybe_module.ToHandleChecked())));
 }
 
 // static
@@ -7827,6 +8064,11 @@ v8::ArrayBuffer::Allocator* v8::ArrayBuffer::Allocator::NewDefaultAllocator() {
   return new ArrayBufferAllocator();
 }
 
+// static
+v8::ArrayBuffer::Allocator* v8::ArrayBuffer::Allocator::NewPoolingAllocator() {
+  return new i::PoolingArrayBufferAllocator();
+}
+
 bool v8::ArrayBuffer::IsExternal() const {
   return Utils::OpenHandle(this)->is_external();
 }
@@ -8472,6 +8714,77 @@ void Isolate::Dispose() {
   isolate->TearDown();
 }
 
+void Isolate::ResetForReuse() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!Utils::ApiCheck(!isolate->IsInUse(), "v8::Isolate::ResetForReuse()",
+                       "Resetting the isolate that is entered by a thread.")) {
+    return;
+  }
+  isolate->ResetForReuse();
+}
+
+struct IsolatePool::PrivateData {
+  PrivateData(const Isolate::CreateParams& params, size_t max_idle_isolates)
+      : params(params), max_idle_isolates(max_idle_isolates) {}
+  Isolate::CreateParams params;
+  size_t max_idle_isolates;
+  base::Mutex mutex;
+  std::vector<Isolate*> idle_isolates;
+  size_t acquired_isolates = 0;
+  // Released isolates that are being reset, and already count as idle.
+  size_t resetting_isolates = 0;
+};
+
+IsolatePool::IsolatePool(const Isolate::CreateParams& params,
+                         size_t max_idle_isolates)
+    : private_(new PrivateData(params, max_idle_isolates)) {}
+
+IsolatePool::~IsolatePool() {
+  Utils::ApiCheck(private_->acquired_isolates == 0, "v8::IsolatePool::~",
+                  "Isolates acquired from the pool were not released.");
+  for (Isolate* isolate : private_->idle_isolates) isolate->Dispose();
+  delete private_;
+}
+
+Isolate* IsolatePool::Acquire() {
+  {
+    base::LockGuard<base::Mutex> lock_guard(&private_->mutex);
+    private_->acquired_isolates++;
+    if (!private_->idle_isolates.empty()) {
+      Isolate* isolate = private_->idle_isolates.back();
+      private_->idle_isolates.pop_back();
+      return isolate;
+    }
+  }
+  // Creating an isolate takes a while, so do it outside of the lock.
+  return Isolate::New(private_->params);
+}
+
+void IsolatePool::Release(Isolate* isolate) {
+  bool keep;
+  {
+    base::LockGuard<base::Mutex> lock_guard(&private_->mutex);
+    DCHECK_LT(0u, private_->acquired_isolates);
+    private_->acquired_isolates--;
+    keep = private_->idle_isolates.size() + private_->resetting_isolates <
+           private_->max_idle_isolates;
+    if (keep) private_->resetting_isolates++;
+  }
+  if (!keep) {
+    isolate->Dispose();
+    return;
+  }
+  isolate->ResetForReuse();
+  base::LockGuard<base::Mutex> lock_guard(&private_->mutex);
+  private_->resetting_isolates--;
+  private_->idle_isolates.push_back(isolate);
+}
+
+size_t IsolatePool::idle_isolate_count() {
+  base::LockGuard<base::Mutex> lock_guard(&private_->mutex);
+  return private_->idle_isolates.size();
+}
+
 void Isolate::DumpAndResetStats() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->DumpAndResetStats();
@@ -8651,6 +8964,72 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+size_t Isolate::NumberOfRuntimeCallCounters() {
+  return static_cast<size_t>(i::RuntimeCallStats::counters_count);
+}
+
+bool Isolate::GetRuntimeCallCounterStatistics(
+    RuntimeCallCounterStatistics* counter_statistics, size_t index) {
+  if (!counter_statistics) return false;
+  if (V8_LIKELY(!i::FLAG_runtime_stats)) return false;
+  if (index >= NumberOfRuntimeCallCounters()) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::RuntimeCallCounter* counter =
+      &(isolate->counters()->runtime_call_stats()->*
+        i::RuntimeCallStats::counters[index]);
+  counter_statistics->name_ = counter->name();
+  counter_statistics->count_ = counter->count();
+  counter_statistics->time_in_us_ = counter->time().InMicroseconds();
+  return true;
+}
+
+bool Isolate::GetHandleScopeStatistics(
+    HandleScopeStatistics* handle_scope_statistics) {
+  if (!handle_scope_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::HandleScopeImplementer* impl = isolate->handle_scope_implementer();
+  handle_scope_statistics->handles_per_block_ = i::kHandleBlockSize;
+  handle_scope_statistics->allocated_block_count_ =
+      impl->allocated_block_count();
+  handle_scope_statistics->reused_block_count_ = impl->reused_block_count();
+  handle_scope_statistics->pooled_block_count_ = impl->spare_block_count();
+  handle_scope_statistics->peak_block_count_ = impl->peak_block_count();
+  return true;
+}
+
+void Isolate::SetHandleBlockPoolSize(size_t block_count) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->handle_scope_implementer()->set_max_spare_blocks(
+      static_cast<int>(std::min(block_count, static_cast<size_t>(i::kMaxInt))));
+}
+
+bool Isolate::GetGCStatistics(GCStatistics* gc_statistics) {
+  if (!gc_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::GCTracer* tracer = isolate->heap()->tracer();
+  for (int i = 0; i < GCStatistics::kPhaseCount; i++) {
+    const i::GCTracer::PauseHistogram& source =
+        tracer->pause_histogram(static_cast<GCStatistics::Phase>(i));
+    GCPauseHistogram* target = &gc_statistics->phases_[i];
+    for (int j = 0; j < GCPauseHistogram::kBucketCount; j++) {
+      target->buckets_[j] = source.buckets[j];
+    }
+    target->count_ = source.count;
+    target->total_time_in_ms_ = source.total;
+    target->max_time_in_ms_ = source.max;
+  }
+  gc_statistics->scavenge_speed_in_bytes_per_ms_ =
+      tracer->ScavengeSpeedInBytesPerMillisecond();
+  gc_statistics->mark_compact_speed_in_bytes_per_ms_ =
+      tracer->CombinedMarkCompactSpeedInBytesPerMillisecond();
+  gc_statistics->incremental_marking_speed_in_bytes_per_ms_ =
+      tracer->IncrementalMarkingSpeedInBytesPerMillisecond();
+  return true;
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -8880,10 +9259,16 @@ void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
           : i::ThreadId::Current().Equals(isolate->thread_id());
   isolate->heap()->MemoryPressureNotification(level, on_isolate_thread);
   isolate->allocator()->MemoryPressureNotification(level);
+  i::PoolingArrayBufferAllocator::MemoryPressureNotification(level);
   isolate->compiler_dispatcher()->MemoryPressureNotification(level,
                                                              on_isolate_thread);
 }
 
+void Isolate::SetMemoryTarget(MemoryTarget* target) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetMemoryTarget(target);
+}
+
 void Isolate::SetRAILMode(RAILMode rail_mode) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->SetRAILMode(rail_mode);
@@ -8904,6 +9289,22 @@ bool Isolate::IsHeapLimitIncreasedForDebugging() {
   return isolate->heap()->IsHeapLimitIncreasedForDebugging();
 }
 
+StartupData Isolate::GetPretenuringDecisions() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  std::vector<i::byte> data =
+      isolate->heap()->pretenuring_decisions()->Serialize();
+  char* copy = new char[data.size()];
+  memcpy(copy, data.data(), data.size());
+  return {copy, static_cast<int>(data.size())};
+}
+
+bool Isolate::SetPretenuringDecisions(const StartupData& data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->heap()->pretenuring_decisions()->Load(
+      reinterpret_cast<const i::byte*>(data.data),
+      static_cast<size_t>(data.raw_size));
+}
+
 void Isolate::SetJitCodeEventHandler(JitCodeEventOptions options,
                                      JitCodeEventHandler event_handler) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -9819,6 +10220,12 @@ Local<Function> debug::GetBuiltin(Isolate* v8_isolate, Builtin builtin) {
 void debug::SetConsoleDelegate(Isolate* v8_isolate, ConsoleDelegate* delegate) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  // Optimized code may have dropped console calls that the delegate would
+  // have seen.
+  if (delegate != nullptr && isolate->IsConsoleDelegateProtectorIntact()) {
+    i::HandleScope scope(isolate);
+    isolate->InvalidateConsoleDelegateProtector();
+  }
   isolate->set_console_delegate(delegate);
 }
 
@@ -9980,6 +10387,11 @@ int CpuProfileNode::GetLineNumber() const {
 }
 
 
+int CpuProfileNode::GetCallerLineNumber() const {
+  return reinterpret_cast<const i::ProfileNode*>(this)->line_number();
+}
+
+
 int CpuProfileNode::GetColumnNumber() const {
   return reinterpret_cast<const i::ProfileNode*>(this)->
       entry()->column_number();
@@ -10102,6 +10514,12 @@ void CpuProfiler::SetSamplingInterval(int us) {
       base::TimeDelta::FromMicroseconds(us));
 }
 
+void CpuProfiler::SetStreamingInterval(int us) {
+  DCHECK_GE(us, 0);
+  return reinterpret_cast<i::CpuProfiler*>(this)->set_streaming_interval(
+      base::TimeDelta::FromMicroseconds(us));
+}
+
 void CpuProfiler::CollectSample() {
   reinterpret_cast<i::CpuProfiler*>(this)->CollectSample();
 }
@@ -10111,6 +10529,12 @@ void CpuProfiler::StartProfiling(Local<String> title, bool record_samples) {
       *Utils::OpenHandle(*title), record_samples);
 }
 
+void CpuProfiler::StartProfiling(Local<String> title, CpuProfilingMode mode,
+                                 bool record_samples) {
+  reinterpret_cast<i::CpuProfiler*>(this)->StartProfiling(
+      *Utils::OpenHandle(*title), record_samples, mode);
+}
+
 
 CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
   return reinterpret_cast<CpuProfile*>(
@@ -10315,6 +10739,16 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
           ->TakeSnapshot(control, resolver));
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(OutputStream* stream,
+                                            ActivityControl* control,
+                                            ObjectNameResolver* resolver) {
+  Utils::ApiCheck(stream->GetChunkSize() > 0,
+                  "v8::HeapProfiler::TakeHeapSnapshotToStream",
+                  "Invalid stream chunk size");
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      stream, control, resolver);
+}
+
 
 void HeapProfiler::StartTrackingHeapObjects(bool track_allocations) {
   reinterpret_cast<i::HeapProfiler*>(this)->StartHeapObjectsTracking(
@@ -10351,6 +10785,13 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
 }
 
 
+AllocationProfile* HeapProfiler::GetAllocationProfile(
+    uint64_t since_sample_id) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile(
+      since_sample_id);
+}
+
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
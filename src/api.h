@@ -399,7 +399,11 @@ class HandleScopeImplementer {
         entered_contexts_(0),
         saved_contexts_(0),
         microtask_context_(nullptr),
-        spare_(NULL),
+        spare_blocks_(0),
+        max_spare_blocks_(kDefaultMaxSpareBlocks),
+        allocated_block_count_(0),
+        reused_block_count_(0),
+        peak_block_count_(0),
         call_depth_(0),
         microtasks_depth_(0),
         microtasks_suppressions_(0),
@@ -411,9 +415,13 @@ class HandleScopeImplementer {
         last_handle_before_deferred_block_(NULL) { }
 
   ~HandleScopeImplementer() {
-    DeleteArray(spare_);
+    DeleteSpareBlocks(0);
+    spare_blocks_.Free();
   }
 
+  // Number of free handle blocks kept for reuse by default.
+  static const int kDefaultMaxSpareBlocks = 4;
+
   // Threading support for handle data.
   static int ArchiveSpacePerThread();
   char* RestoreThread(char* from);
@@ -427,6 +435,20 @@ class HandleScopeImplementer {
   inline internal::Object** GetSpareOrNewBlock();
   inline void DeleteExtensions(internal::Object** prev_limit);
 
+  // Sets how many free handle blocks are kept instead of being deleted, so
+  // that scopes that repeatedly grow and shrink do not allocate.
+  void set_max_spare_blocks(int max_spare_blocks) {
+    DCHECK_LE(0, max_spare_blocks);
+    max_spare_blocks_ = max_spare_blocks;
+    DeleteSpareBlocks(max_spare_blocks);
+  }
+
+  // Statistics about handle block usage since the isolate was created.
+  size_t allocated_block_count() const { return allocated_block_count_; }
+  size_t reused_block_count() const { return reused_block_count_; }
+  size_t peak_block_count() const { return peak_block_count_; }
+  size_t spare_block_count() const { return spare_blocks_.length(); }
+
   // Call depth represents nested v8 api calls.
   inline void IncrementCallDepth() {call_depth_++;}
   inline void DecrementCallDepth() {call_depth_--;}
@@ -483,18 +505,27 @@ class HandleScopeImplementer {
 
   void ReturnBlock(Object** block) {
     DCHECK(block != NULL);
-    if (spare_ != NULL) DeleteArray(spare_);
-    spare_ = block;
+    if (spare_blocks_.length() < max_spare_blocks_) {
+      spare_blocks_.Add(block);
+    } else {
+      DeleteArray(block);
+    }
   }
 
  private:
+  void DeleteSpareBlocks(int keep) {
+    while (spare_blocks_.length() > keep) {
+      DeleteArray(spare_blocks_.RemoveLast());
+    }
+  }
+
   void ResetAfterArchive() {
     blocks_.Initialize(0);
     entered_contexts_.Initialize(0);
     saved_contexts_.Initialize(0);
     microtask_context_ = nullptr;
     entered_context_count_during_microtasks_ = 0;
-    spare_ = NULL;
+    spare_blocks_.Initialize(0);
     last_handle_before_deferred_block_ = NULL;
     call_depth_ = 0;
   }
@@ -507,10 +538,8 @@ class HandleScopeImplementer {
     blocks_.Free();
     entered_contexts_.Free();
     saved_contexts_.Free();
-    if (spare_ != NULL) {
-      DeleteArray(spare_);
-      spare_ = NULL;
-    }
+    DeleteSpareBlocks(0);
+    spare_blocks_.Free();
     DCHECK(call_depth_ == 0);
   }
 
@@ -524,7 +553,12 @@ class HandleScopeImplementer {
   // Used as a stack to keep track of saved contexts.
   List<Context*> saved_contexts_;
   Context* microtask_context_;
-  Object** spare_;
+  // Free handle blocks, at most max_spare_blocks_ of them.
+  List<Object**> spare_blocks_;
+  int max_spare_blocks_;
+  size_t allocated_block_count_;
+  size_t reused_block_count_;
+  size_t peak_block_count_;
   int call_depth_;
   int microtasks_depth_;
   int microtasks_suppressions_;
@@ -616,10 +650,16 @@ Handle<Context> HandleScopeImplementer::MicrotaskContext() {
 
 // If there's a spare block, use it for growing the current scope.
 internal::Object** HandleScopeImplementer::GetSpareOrNewBlock() {
-  internal::Object** block = (spare_ != NULL) ?
-      spare_ :
-      NewArray<internal::Object*>(kHandleBlockSize);
-  spare_ = NULL;
+  internal::Object** block;
+  if (!spare_blocks_.is_empty()) {
+    block = spare_blocks_.RemoveLast();
+    reused_block_count_++;
+  } else {
+    block = NewArray<internal::Object*>(kHandleBlockSize);
+    allocated_block_count_++;
+  }
+  size_t block_count = static_cast<size_t>(blocks_.length()) + 1;
+  if (block_count > peak_block_count_) peak_block_count_ = block_count;
   return block;
 }
 
@@ -641,10 +681,7 @@ void HandleScopeImplementer::DeleteExtensions(internal::Object** prev_limit) {
 #ifdef ENABLE_HANDLE_ZAPPING
     internal::HandleScope::ZapRange(block_start, block_limit);
 #endif
-    if (spare_ != NULL) {
-      DeleteArray(spare_);
-    }
-    spare_ = block_start;
+    ReturnBlock(block_start);
   }
   DCHECK((blocks_.is_empty() && prev_limit == NULL) ||
          (!blocks_.is_empty() && prev_limit != NULL));
@@ -8,7 +8,9 @@
 #include "src/asmjs/asm-parser.h"
 #include "src/assert-scope.h"
 #include "src/ast/ast.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/semaphore.h"
 #include "src/compilation-info.h"
 #include "src/execution.h"
 #include "src/factory.h"
@@ -17,6 +19,7 @@
 #include "src/objects-inl.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/parsing/scanner.h"
+#include "src/v8.h"
 
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-js.h"
@@ -166,66 +169,197 @@ void ReportInstantiationFailure(Handle<Script> script, int position,
 
 }  // namespace
 
-MaybeHandle<FixedArray> AsmJs::CompileAsmViaWasm(CompilationInfo* info) {
-  wasm::ZoneBuffer* module = nullptr;
-  wasm::ZoneBuffer* asm_offsets = nullptr;
+// Parses, validates and translates an asm.js module to a wasm module. This
+// does not touch the heap, so it can run on a background thread.
+class AsmJsTranslationJob {
+ public:
+  // {source} may be null if {stream} does not depend on the heap.
+  AsmJsTranslationJob(std::unique_ptr<uint16_t[]> source,
+                      std::unique_ptr<Utf16CharacterStream> stream,
+                      int start_position, int end_position)
+      : source_(std::move(source)),
+        stream_(std::move(stream)),
+        start_position_(start_position),
+        end_position_(end_position),
+        state_(kPending),
+        done_(0),
+        zone_(&allocator_, ZONE_NAME) {}
+
+  // Translates the module, unless another thread has already started to.
+  void TryTranslateOnBackgroundThread() {
+    if (!state_.TrySetValue(kPending, kRunning)) return;
+    Translate(GetCurrentStackPosition() - FLAG_stack_size * KB);
+    state_.SetValue(kDone);
+    done_.Signal();
+  }
+
+  // Returns once the module is translated, translating it on the main thread
+  // if no background thread has started yet.
+  void WaitForTranslation(uintptr_t stack_limit) {
+    if (state_.TrySetValue(kPending, kRunning)) {
+      Translate(stack_limit);
+      state_.SetValue(kDone);
+      return;
+    }
+    if (state_.Value() != kDone) done_.Wait();
+    DCHECK_EQ(kDone, state_.Value());
+  }
+
+  int start_position() const { return start_position_; }
+  int end_position() const { return end_position_; }
+
+  bool succeeded() const { return module_ != nullptr; }
+  int failure_location() const { return failure_location_; }
+  const char* failure_message() const { return failure_message_; }
+
+  wasm::ZoneBuffer* module() const { return module_; }
+  wasm::ZoneBuffer* asm_offsets() const { return asm_offsets_; }
+  const std::vector<int>& stdlib_uses() const { return stdlib_uses_; }
+  double translate_time() const { return translate_time_; }
+  size_t translate_zone_size() const { return translate_zone_size_; }
+
+ private:
+  enum State { kPending, kRunning, kDone };
+
+  void Translate(uintptr_t stack_limit) {
+    base::ElapsedTimer translate_timer;
+    translate_timer.Start();
+    Zone translate_zone(&allocator_, ZONE_NAME);
+    wasm::AsmJsParser parser(&translate_zone, stack_limit, std::move(stream_));
+    if (!parser.Run()) {
+      failure_location_ = parser.failure_location();
+      failure_message_ = parser.failure_message();
+    } else {
+      module_ = new (&zone_) wasm::ZoneBuffer(&zone_);
+      parser.module_builder()->WriteTo(*module_);
+      asm_offsets_ = new (&zone_) wasm::ZoneBuffer(&zone_);
+      parser.module_builder()->WriteAsmJsOffsetTable(*asm_offsets_);
+      for (auto i : *parser.stdlib_uses()) stdlib_uses_.push_back(i);
+    }
+    translate_zone_size_ = translate_zone.allocation_size();
+    translate_time_ = translate_timer.Elapsed().InMillisecondsF();
+    source_.reset();
+  }
+
+  std::unique_ptr<uint16_t[]> source_;
+  std::unique_ptr<Utf16CharacterStream> stream_;
+  const int start_position_;
+  const int end_position_;
+  base::AtomicValue<State> state_;
+  base::Semaphore done_;
+
+  // The job has its own allocator, so that it does not depend on the isolate
+  // if a background thread runs after the isolate is gone.
+  AccountingAllocator allocator_;
+  Zone zone_;
+
+  wasm::ZoneBuffer* module_ = nullptr;
+  wasm::ZoneBuffer* asm_offsets_ = nullptr;
+  std::vector<int> stdlib_uses_;
+  int failure_location_ = kNoSourcePosition;
+  const char* failure_message_ = nullptr;
+  double translate_time_ = 0;
+  size_t translate_zone_size_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(AsmJsTranslationJob);
+};
+
+namespace {
+
+class AsmJsTranslationTask : public v8::Task {
+ public:
+  explicit AsmJsTranslationTask(std::shared_ptr<AsmJsTranslationJob> job)
+      : job_(std::move(job)) {}
+
+  void Run() override { job_->TryTranslateOnBackgroundThread(); }
+
+ private:
+  std::shared_ptr<AsmJsTranslationJob> job_;
+
+  DISALLOW_COPY_AND_ASSIGN(AsmJsTranslationTask);
+};
+
+}  // namespace
+
+std::shared_ptr<AsmJsTranslationJob> AsmJs::StartTranslation(
+    Isolate* isolate, Handle<Script> script, FunctionLiteral* literal) {
+  int start_position = literal->start_position();
+  int end_position = literal->end_position();
+  Handle<String> source(String::cast(script->source()), isolate);
+  std::unique_ptr<uint16_t[]> copy;
+  std::unique_ptr<Utf16CharacterStream> stream;
+  if (source->IsExternalString()) {
+    // Streams over external strings only keep a pointer to their characters.
+    stream.reset(ScannerStream::For(source, start_position, end_position));
+  } else {
+    // Other strings may move, so the background thread gets a copy.
+    copy.reset(new uint16_t[end_position - start_position]);
+    String::WriteToFlat(*source, copy.get(), start_position, end_position);
+    stream.reset(ScannerStream::For(copy.get(), start_position, end_position));
+  }
+  std::shared_ptr<AsmJsTranslationJob> job =
+      std::make_shared<AsmJsTranslationJob>(std::move(copy), std::move(stream),
+                                            start_position, end_position);
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new AsmJsTranslationTask(job), v8::Platform::kLongRunningTask);
+  return job;
+}
+
+MaybeHandle<FixedArray> AsmJs::CompileAsmViaWasm(CompilationInfo* info,
+                                                 AsmJsTranslationJob* job) {
+  Isolate* isolate = info->isolate();
   Handle<FixedArray> uses_array;
   Handle<WasmModuleObject> compiled;
 
   // The compilation of asm.js modules is split into two distinct steps:
   //  [1] The asm.js module source is parsed, validated, and translated to a
   //      valid WebAssembly module. The result are two vectors representing the
-  //      encoded module as well as encoded source position information.
+  //      encoded module as well as encoded source position information. This
+  //      step may have started on a background thread, see {StartTranslation}.
   //  [2] The module is handed to WebAssembly which decodes it into an internal
   //      representation and eventually compiles it to machine code.
   double translate_time;  // Time (milliseconds) taken to execute step [1].
   double compile_time;    // Time (milliseconds) taken to execute step [2].
 
   // Step 1: Translate asm.js module to WebAssembly module.
-  {
-    HistogramTimerScope translate_time_scope(
-        info->isolate()->counters()->asm_wasm_translation_time());
-    size_t compile_zone_start = info->zone()->allocation_size();
-    base::ElapsedTimer translate_timer;
-    translate_timer.Start();
-
-    Zone* compile_zone = info->zone();
-    Zone translate_zone(info->isolate()->allocator(), ZONE_NAME);
-    std::unique_ptr<Utf16CharacterStream> stream(ScannerStream::For(
-        handle(String::cast(info->script()->source())),
+  std::unique_ptr<AsmJsTranslationJob> main_thread_job;
+  if (job == nullptr) {
+    main_thread_job.reset(new AsmJsTranslationJob(
+        nullptr,
+        std::unique_ptr<Utf16CharacterStream>(ScannerStream::For(
+            handle(String::cast(info->script()->source())),
+            info->literal()->start_position(),
+            info->literal()->end_position())),
         info->literal()->start_position(), info->literal()->end_position()));
-    uintptr_t stack_limit = info->isolate()->stack_guard()->real_climit();
-    wasm::AsmJsParser parser(&translate_zone, stack_limit, std::move(stream));
-    if (!parser.Run()) {
-      DCHECK(!info->isolate()->has_pending_exception());
-      ReportCompilationFailure(info->script(), parser.failure_location(),
-                               parser.failure_message());
-      return MaybeHandle<FixedArray>();
-    }
-    module = new (compile_zone) wasm::ZoneBuffer(compile_zone);
-    parser.module_builder()->WriteTo(*module);
-    asm_offsets = new (compile_zone) wasm::ZoneBuffer(compile_zone);
-    parser.module_builder()->WriteAsmJsOffsetTable(*asm_offsets);
-    uses_array = info->isolate()->factory()->NewFixedArray(
-        static_cast<int>(parser.stdlib_uses()->size()));
-    int count = 0;
-    for (auto i : *parser.stdlib_uses()) {
-      uses_array->set(count++, Smi::FromInt(i));
-    }
-    size_t compile_zone_size =
-        info->zone()->allocation_size() - compile_zone_start;
-    size_t translate_zone_size = translate_zone.allocation_size();
-    info->isolate()
-        ->counters()
-        ->asm_wasm_translation_peak_memory_bytes()
-        ->AddSample(static_cast<int>(translate_zone_size));
-    translate_time = translate_timer.Elapsed().InMillisecondsF();
-    if (FLAG_trace_asm_parser) {
-      PrintF(
-          "[asm.js translation successful: time=%0.3fms, "
-          "translate_zone=%" PRIuS "KB, compile_zone+=%" PRIuS "KB]\n",
-          translate_time, translate_zone_size / KB, compile_zone_size / KB);
-    }
+    job = main_thread_job.get();
+  }
+  DCHECK_EQ(info->literal()->start_position(), job->start_position());
+  DCHECK_EQ(info->literal()->end_position(), job->end_position());
+  job->WaitForTranslation(isolate->stack_guard()->real_climit());
+  if (!job->succeeded()) {
+    DCHECK(!isolate->has_pending_exception());
+    ReportCompilationFailure(info->script(), job->failure_location(),
+                             job->failure_message());
+    return MaybeHandle<FixedArray>();
+  }
+  wasm::ZoneBuffer* module = job->module();
+  wasm::ZoneBuffer* asm_offsets = job->asm_offsets();
+  uses_array = isolate->factory()->NewFixedArray(
+      static_cast<int>(job->stdlib_uses().size()));
+  int count = 0;
+  for (int i : job->stdlib_uses()) {
+    uses_array->set(count++, Smi::FromInt(i));
+  }
+  translate_time = job->translate_time();
+  isolate->counters()->asm_wasm_translation_time()->AddSample(static_cast<int>(
+      translate_time * base::Time::kMicrosecondsPerMillisecond));
+  isolate->counters()->asm_wasm_translation_peak_memory_bytes()->AddSample(
+      static_cast<int>(job->translate_zone_size()));
+  if (FLAG_trace_asm_parser) {
+    PrintF(
+        "[asm.js translation successful: time=%0.3fms, "
+        "translate_zone=%" PRIuS "KB, module=%" PRIuS "KB]\n",
+        translate_time, job->translate_zone_size() / KB, module->size() / KB);
   }
 
   // Step 2: Compile and decode the WebAssembly module.
@@ -7,19 +7,31 @@
 
 // Clients of this interface shouldn't depend on lots of asmjs internals.
 // Do not include anything from src/asmjs here!
+#include <memory>
+
 #include "src/globals.h"
 
 namespace v8 {
 namespace internal {
 
+class AsmJsTranslationJob;
 class CompilationInfo;
+class FunctionLiteral;
 class JSArrayBuffer;
 class SharedFunctionInfo;
 
 // Interface to compile and instantiate for asm.js modules.
 class AsmJs {
  public:
-  static MaybeHandle<FixedArray> CompileAsmViaWasm(CompilationInfo* info);
+  // Starts translating the asm.js module {literal} of {script} to wasm on a
+  // background thread. Pass the job to {CompileAsmViaWasm} for the same
+  // literal to pick up the result; if no background thread got to the job
+  // by then, it is translated on the main thread.
+  static std::shared_ptr<AsmJsTranslationJob> StartTranslation(
+      Isolate* isolate, Handle<Script> script, FunctionLiteral* literal);
+
+  static MaybeHandle<FixedArray> CompileAsmViaWasm(
+      CompilationInfo* info, AsmJsTranslationJob* job = nullptr);
   static MaybeHandle<Object> InstantiateAsmWasm(Isolate* isolate,
                                                 Handle<SharedFunctionInfo>,
                                                 Handle<FixedArray> wasm_data,
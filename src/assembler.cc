@@ -1180,6 +1180,11 @@ ExternalReference ExternalReference::address_of_regexp_dotall_flag(
   return ExternalReference(&FLAG_harmony_regexp_dotall);
 }
 
+ExternalReference ExternalReference::address_of_await_optimization_flag(
+    Isolate* isolate) {
+  return ExternalReference(&FLAG_harmony_await_optimization);
+}
+
 ExternalReference ExternalReference::store_buffer_top(Isolate* isolate) {
   return ExternalReference(isolate->heap()->store_buffer_top_address());
 }
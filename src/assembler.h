@@ -941,6 +941,10 @@ class ExternalReference BASE_EMBEDDED {
   // Direct access to FLAG_harmony_regexp_dotall.
   static ExternalReference address_of_regexp_dotall_flag(Isolate* isolate);
 
+  // Direct access to FLAG_harmony_await_optimization.
+  static ExternalReference address_of_await_optimization_flag(
+      Isolate* isolate);
+
   // Static variables for RegExp.
   static ExternalReference address_of_static_offsets_vector(Isolate* isolate);
   static ExternalReference address_of_regexp_stack_memory_address(
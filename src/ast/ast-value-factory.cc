@@ -90,6 +90,19 @@ void AstRawString::Internalize(Isolate* isolate) {
   }
 }
 
+bool AstRawString::InternalizeIfExists(Isolate* isolate) {
+  DCHECK(!has_string_);
+  if (literal_bytes_.length() == 0) {
+    set_string(isolate->factory()->empty_string());
+    return true;
+  }
+  AstRawStringInternalizationKey key(this);
+  String* string = StringTable::LookupKeyIfExists(isolate, &key);
+  if (string == nullptr) return false;
+  set_string(handle(string, isolate));
+  return true;
+}
+
 bool AstRawString::AsArrayIndex(uint32_t* index) const {
   // The StringHasher will set up the hash in such a way that we can use it to
   // figure out whether the string is convertible to an array index.
@@ -298,8 +311,27 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 
 void AstValueFactory::Internalize(Isolate* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. Strings that are in the string table already are resolved first,
+  // so that the table grows at most once for the rest of the batch instead
+  // of repeatedly while they are added one by one.
+  AstRawString* new_strings = nullptr;
+  AstRawString** new_strings_end = &new_strings;
+  int new_string_count = 0;
   for (AstRawString* current = strings_; current != nullptr;) {
+    AstRawString* next = current->next();
+    if (!current->InternalizeIfExists(isolate)) {
+      *new_strings_end = current;
+      new_strings_end = current->next_location();
+      new_string_count++;
+    }
+    current = next;
+  }
+  *new_strings_end = nullptr;
+
+  if (new_string_count > 0) {
+    StringTable::EnsureCapacityForBulkInsert(isolate, new_string_count);
+  }
+  for (AstRawString* current = new_strings; current != nullptr;) {
     AstRawString* next = current->next();
     current->Internalize(isolate);
     current = next;
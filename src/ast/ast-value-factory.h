@@ -55,6 +55,9 @@ class AstRawString final : public ZoneObject {
   uint16_t FirstCharacter() const;
 
   void Internalize(Isolate* isolate);
+  // Like Internalize, but only succeeds if the string table already holds an
+  // equal string. Never allocates.
+  bool InternalizeIfExists(Isolate* isolate);
 
   // Access the physical representation:
   bool is_one_byte() const { return is_one_byte_; }
@@ -428,6 +428,136 @@ void ClassLiteral::AssignFeedbackSlots(FeedbackVectorSpec* spec,
   }
 }
 
+bool ClassLiteral::IsBoilerplateSupported() const {
+  int length = properties()->length();
+  // The prototype additionally holds the "constructor" property.
+  if (length == 0 || length >= kMaxNumberOfDescriptors) return false;
+  for (int i = 0; i < length; i++) {
+    ClassLiteral::Property* property = properties()->at(i);
+    if (property->is_computed_name()) return false;
+    if (property->kind() == ClassLiteral::Property::FIELD) return false;
+    if (!property->key()->IsPropertyName()) return false;
+  }
+  return true;
+}
+
+namespace {
+
+Handle<FixedArray> BuildClassBoilerplateProperties(
+    Isolate* isolate, ZoneList<ClassLiteral::Property*>* properties,
+    bool is_static) {
+  int capacity = 0;
+  for (int i = 0; i < properties->length(); i++) {
+    if (properties->at(i)->is_static() == is_static) capacity++;
+  }
+  if (capacity == 0) return isolate->factory()->empty_fixed_array();
+
+  Handle<FixedArray> entries = isolate->factory()->NewFixedArray(
+      capacity * ClassBoilerplate::kEntrySize, TENURED);
+  Smi* none = Smi::FromInt(ClassBoilerplate::kNoArgument);
+  Smi* data = Smi::FromInt(ClassBoilerplate::kData);
+  Smi* accessor = Smi::FromInt(ClassBoilerplate::kAccessor);
+  int end = 0;
+  for (int i = 0; i < properties->length(); i++) {
+    ClassLiteral::Property* property = properties->at(i);
+    if (property->is_static() != is_static) continue;
+    Handle<String> name = property->key()->AsLiteral()->AsPropertyName();
+
+    // Later definitions of the same name replace earlier ones, except that a
+    // getter and a setter are combined into one accessor pair. Names are
+    // internalized, so comparing the pointers is sufficient.
+    int base = 0;
+    while (base < end &&
+           entries->get(base + ClassBoilerplate::kEntryNameIndex) != *name) {
+      base += ClassBoilerplate::kEntrySize;
+    }
+    if (base == end) {
+      entries->set(base + ClassBoilerplate::kEntryNameIndex, *name);
+      entries->set(base + ClassBoilerplate::kEntryKindIndex, data);
+      entries->set(base + ClassBoilerplate::kEntryFirstIndex, none);
+      entries->set(base + ClassBoilerplate::kEntrySecondIndex, none);
+      end += ClassBoilerplate::kEntrySize;
+    }
+
+    bool was_data =
+        entries->get(base + ClassBoilerplate::kEntryKindIndex) == data;
+    int first = base + ClassBoilerplate::kEntryFirstIndex;
+    int second = base + ClassBoilerplate::kEntrySecondIndex;
+    Smi* index = Smi::FromInt(i);
+    switch (property->kind()) {
+      case ClassLiteral::Property::METHOD:
+        entries->set(base + ClassBoilerplate::kEntryKindIndex, data);
+        entries->set(first, index);
+        entries->set(second, none);
+        break;
+      case ClassLiteral::Property::GETTER:
+        entries->set(base + ClassBoilerplate::kEntryKindIndex, accessor);
+        entries->set(first, index);
+        if (was_data) entries->set(second, none);
+        break;
+      case ClassLiteral::Property::SETTER:
+        entries->set(base + ClassBoilerplate::kEntryKindIndex, accessor);
+        if (was_data) entries->set(first, none);
+        entries->set(second, index);
+        break;
+      case ClassLiteral::Property::FIELD:
+        UNREACHABLE();
+        break;
+    }
+  }
+  entries->Shrink(end);
+  return entries;
+}
+
+Handle<FixedArray> BuildClassBoilerplateHomeObjects(
+    Isolate* isolate, ZoneList<ClassLiteral::Property*>* properties,
+    bool is_static) {
+  int count = 0;
+  for (int i = 0; i < properties->length(); i++) {
+    ClassLiteral::Property* property = properties->at(i);
+    if (property->is_static() == is_static &&
+        FunctionLiteral::NeedsHomeObject(property->value())) {
+      count++;
+    }
+  }
+  if (count == 0) return isolate->factory()->empty_fixed_array();
+
+  Handle<FixedArray> indices =
+      isolate->factory()->NewFixedArray(count, TENURED);
+  int position = 0;
+  for (int i = 0; i < properties->length(); i++) {
+    ClassLiteral::Property* property = properties->at(i);
+    if (property->is_static() == is_static &&
+        FunctionLiteral::NeedsHomeObject(property->value())) {
+      indices->set(position++, Smi::FromInt(i));
+    }
+  }
+  return indices;
+}
+
+}  // namespace
+
+Handle<ClassBoilerplate> ClassLiteral::BuildClassBoilerplate(Isolate* isolate) {
+  DCHECK(IsBoilerplateSupported());
+  Handle<FixedArray> prototype_properties =
+      BuildClassBoilerplateProperties(isolate, properties(), false);
+  Handle<FixedArray> static_properties =
+      BuildClassBoilerplateProperties(isolate, properties(), true);
+  Handle<FixedArray> prototype_home_objects =
+      BuildClassBoilerplateHomeObjects(isolate, properties(), false);
+  Handle<FixedArray> static_home_objects =
+      BuildClassBoilerplateHomeObjects(isolate, properties(), true);
+
+  Handle<ClassBoilerplate> boilerplate =
+      Handle<ClassBoilerplate>::cast(isolate->factory()->NewFixedArray(
+          ClassBoilerplate::kBoilerplateLength, TENURED));
+  boilerplate->set_prototype_properties(*prototype_properties);
+  boilerplate->set_static_properties(*static_properties);
+  boilerplate->set_prototype_home_objects(*prototype_home_objects);
+  boilerplate->set_static_home_objects(*static_home_objects);
+  return boilerplate;
+}
+
 bool ObjectLiteral::Property::IsCompileTimeValue() const {
   return kind_ == CONSTANT ||
       (kind_ == MATERIALIZED_LITERAL &&
@@ -689,6 +819,13 @@ bool ObjectLiteral::IsFastCloningSupported() const {
              ConstructorBuiltins::kMaximumClonedShallowObjectProperties;
 }
 
+bool ObjectLiteral::IsFastDeepCloningSupported() const {
+  return fast_elements() && !has_shallow_properties() &&
+         depth() <= ConstructorBuiltins::kMaximumClonedDeepLiteralDepth &&
+         properties_count() <=
+             ConstructorBuiltins::kMaximumClonedShallowObjectProperties;
+}
+
 void ArrayLiteral::InitDepthAndFlags() {
   DCHECK_LT(first_spread_index_, 0);
 
@@ -789,6 +926,13 @@ bool ArrayLiteral::IsFastCloningSupported() const {
              ConstructorBuiltins::kMaximumClonedShallowArrayElements;
 }
 
+bool ArrayLiteral::IsFastDeepCloningSupported() const {
+  return depth() > 1 &&
+         depth() <= ConstructorBuiltins::kMaximumClonedDeepLiteralDepth &&
+         values()->length() <=
+             ConstructorBuiltins::kMaximumClonedShallowArrayElements;
+}
+
 void ArrayLiteral::RewindSpreads() {
   values_->Rewind(first_spread_index_);
   first_spread_index_ = -1;
@@ -898,10 +1042,12 @@ void CompareOperation::AssignFeedbackSlots(FeedbackVectorSpec* spec,
   // Feedback vector slot is only used by interpreter for binary operations.
   // Full-codegen uses AstId to record type feedback.
   switch (op()) {
-    // instanceof and in do not collect type feedback.
     case Token::INSTANCEOF:
+      feedback_slot_ = spec->AddInstanceOfSlot();
+      break;
     case Token::IN:
-      return;
+      feedback_slot_ = spec->AddHasPropertySlot();
+      break;
     default:
       feedback_slot_ = spec->AddInterpreterCompareICSlot();
   }
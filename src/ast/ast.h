@@ -1322,6 +1322,9 @@ class ObjectLiteral final : public MaterializedLiteral {
   // Determines whether the {FastCloneShallowObject} builtin can be used.
   bool IsFastCloningSupported() const;
 
+  // Determines whether the {FastCloneDeepObject} builtin can be used.
+  bool IsFastDeepCloningSupported() const;
+
   // Assemble bitfield of flags for the CreateObjectLiteral helper.
   int ComputeFlags(bool disable_mementos = false) const {
     int flags = fast_elements() ? kFastElements : kNoFlags;
@@ -1471,6 +1474,9 @@ class ArrayLiteral final : public MaterializedLiteral {
   // Determines whether the {FastCloneShallowArray} builtin can be used.
   bool IsFastCloningSupported() const;
 
+  // Determines whether the {FastCloneDeepArray} builtin can be used.
+  bool IsFastDeepCloningSupported() const;
+
   // Assemble bitfield of flags for the CreateArrayLiteral helper.
   int ComputeFlags(bool disable_mementos = false) const {
     int flags = depth() == 1 ? kShallowElements : kNoFlags;
@@ -2711,6 +2717,16 @@ class ClassLiteral final : public Expression {
   FeedbackSlot HomeObjectSlot() const { return home_object_slot_; }
   FeedbackSlot ProxySlot() const { return proxy_slot_; }
 
+  // Determines whether the class can be defined from a {ClassBoilerplate},
+  // i.e. it has at least one property and all property names are constant
+  // non-index names.
+  bool IsBoilerplateSupported() const;
+
+  // Builds the boilerplate describing the properties of this class. The
+  // value of the i-th property is expected as the i-th closure argument of
+  // {Runtime_DefineClassWithBoilerplate}.
+  Handle<ClassBoilerplate> BuildClassBoilerplate(Isolate* isolate);
+
  private:
   friend class AstNodeFactory;
 
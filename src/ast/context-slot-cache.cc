@@ -23,22 +23,32 @@ int ContextSlotCache::Hash(Object* data, String* name) {
   // Uses only lower 32 bits if pointers are larger.
   uintptr_t addr_hash =
       static_cast<uint32_t>(reinterpret_cast<uintptr_t>(data)) >> 2;
-  return static_cast<int>((addr_hash ^ name->Hash()) % kLength);
+  return static_cast<int>((addr_hash ^ name->Hash()) % kBuckets) * kWays;
 }
 
 int ContextSlotCache::Lookup(Object* data, String* name, VariableMode* mode,
                              InitializationFlag* init_flag,
                              MaybeAssignedFlag* maybe_assigned_flag) {
-  int index = Hash(data, name);
+  int bucket = Hash(data, name);
   DCHECK(name->IsInternalizedString());
-  Key& key = keys_[index];
-  if (key.data == data && key.name == name) {
-    Value result(values_[index]);
-    if (mode != nullptr) *mode = result.mode();
-    if (init_flag != nullptr) *init_flag = result.initialization_flag();
-    if (maybe_assigned_flag != nullptr)
-      *maybe_assigned_flag = result.maybe_assigned_flag();
-    return result.index() + kNotFound;
+  for (int index = bucket; index < bucket + kWays; index++) {
+    Key& key = keys_[index];
+    if (key.data == data && key.name == name) {
+      Value result(values_[index]);
+      // Move the entry to the front of its bucket.
+      for (int i = index; i > bucket; i--) {
+        keys_[i] = keys_[i - 1];
+        values_[i] = values_[i - 1];
+      }
+      keys_[bucket].data = data;
+      keys_[bucket].name = name;
+      values_[bucket] = result.raw();
+      if (mode != nullptr) *mode = result.mode();
+      if (init_flag != nullptr) *init_flag = result.initialization_flag();
+      if (maybe_assigned_flag != nullptr)
+        *maybe_assigned_flag = result.maybe_assigned_flag();
+      return result.index() + kNotFound;
+    }
   }
   return kNotFound;
 }
@@ -50,6 +60,11 @@ void ContextSlotCache::Update(Handle<Object> data, Handle<String> name,
   DCHECK(name->IsInternalizedString());
   DCHECK_LT(kNotFound, slot_index);
   int index = Hash(*data, *name);
+  // Evict the least recently used entry of the bucket.
+  for (int i = index + kWays - 1; i > index; i--) {
+    keys_[i] = keys_[i - 1];
+    values_[i] = values_[i - 1];
+  }
   Key& key = keys_[index];
   key.data = *data;
   key.name = *name;
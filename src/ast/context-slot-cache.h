@@ -15,6 +15,9 @@ namespace internal {
 // The cache contains both positive and negative results.
 // Slot index equals -1 means the property is absent.
 // Cleared at startup and prior to mark sweep collection.
+// The cache is two-way set associative: each (data, name) pair hashes to a
+// bucket of kWays entries that are kept in most recently used order, so two
+// hot names that hash to the same bucket do not keep evicting each other.
 class ContextSlotCache {
  public:
   // Lookup context slot index for (data, name).
@@ -50,7 +53,9 @@ class ContextSlotCache {
                      MaybeAssignedFlag maybe_assigned_flag, int slot_index);
 #endif
 
-  static const int kLength = 256;
+  static const int kWays = 2;
+  static const int kBuckets = 512;
+  static const int kLength = kBuckets * kWays;
   struct Key {
     Object* data;
     String* name;
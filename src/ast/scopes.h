@@ -868,6 +868,16 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   // doesn't re-allocate variables repeatedly.
   static void Analyze(ParseInfo* info, Isolate* isolate, AnalyzeMode mode);
 
+  // Resolves and allocates the variables of top-level code without touching
+  // the heap, so it can run on a background thread. Must be followed by
+  // AllocateScopeInfos on the main thread before the scopes are used for
+  // anything but bytecode generation.
+  static void AnalyzeOnBackgroundThread(ParseInfo* info);
+
+  // Allocates the ScopeInfos of all scopes that need one. Part of Analyze.
+  static void AllocateScopeInfos(ParseInfo* info, Isolate* isolate,
+                                 AnalyzeMode mode);
+
   // To be called during parsing. Do just enough scope analysis that we can
   // discard the Scope for lazily compiled functions. In particular, this
   // records variables which cannot be resolved inside the Scope (we don't yet
@@ -919,7 +929,7 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   // In the case of code compiled and run using 'eval', the context
   // parameter is the context in which eval was called.  In all other
   // cases the context parameter is an empty handle.
-  void AllocateVariables(ParseInfo* info, Isolate* isolate, AnalyzeMode mode);
+  void AllocateVariables(ParseInfo* info);
 
   void SetDefaults();
 
@@ -4,6 +4,7 @@
 
 #include "src/background-parsing-task.h"
 
+#include "src/compiler.h"
 #include "src/objects-inl.h"
 #include "src/parsing/parser.h"
 
@@ -11,6 +12,7 @@ namespace v8 {
 namespace internal {
 
 void StreamedSource::Release() {
+  compile_jobs.reset();
   parser.reset();
   info.reset();
 }
@@ -18,7 +20,11 @@ void StreamedSource::Release() {
 BackgroundParsingTask::BackgroundParsingTask(
     StreamedSource* source, ScriptCompiler::CompileOptions options,
     int stack_size, Isolate* isolate)
-    : source_(source), stack_size_(stack_size), script_data_(nullptr) {
+    : source_(source),
+      stack_size_(stack_size),
+      script_data_(nullptr),
+      isolate_(isolate),
+      compile_on_background_thread_(false) {
   // We don't set the context to the CompilationInfo yet, because the background
   // thread cannot do anything with it anyway. We set it just before compilation
   // on the foreground thread.
@@ -47,6 +53,12 @@ BackgroundParsingTask::BackgroundParsingTask(
   source_->parser.reset(new Parser(source_->info.get()));
   source_->parser->DeserializeScopeChain(source_->info.get(),
                                          MaybeHandle<ScopeInfo>());
+
+  // Producing a code cache needs the code on the heap, which only exists
+  // after compilation on the main thread.
+  compile_on_background_thread_ =
+      options != ScriptCompiler::kProduceCodeCache &&
+      Compiler::CanCompileOnBackgroundThread(info, isolate);
 }
 
 
@@ -62,6 +74,11 @@ void BackgroundParsingTask::Run() {
 
   source_->parser->ParseOnBackground(source_->info.get());
 
+  if (compile_on_background_thread_ && source_->info->literal() != nullptr) {
+    source_->compile_jobs.reset(Compiler::CompileOnBackgroundThread(
+        source_->info.get(), isolate_, stack_limit));
+  }
+
   if (script_data_ != nullptr) {
     source_->cached_data.reset(new ScriptCompiler::CachedData(
         script_data_->data(), script_data_->length(),
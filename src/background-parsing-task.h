@@ -16,12 +16,14 @@
 namespace v8 {
 namespace internal {
 
+struct BackgroundCompileJobs;
 class Parser;
 class ScriptData;
 
 // Internal representation of v8::ScriptCompiler::StreamedSource. Contains all
-// data which needs to be transmitted between threads for background parsing,
-// finalizing it on the main thread, and compiling on the main thread.
+// data which needs to be transmitted between threads for background parsing
+// (and optionally compiling), finalizing it on the main thread, and compiling
+// on the main thread.
 struct StreamedSource {
   StreamedSource(ScriptCompiler::ExternalSourceStream* source_stream,
                  ScriptCompiler::StreamedSource::Encoding encoding)
@@ -40,6 +42,8 @@ struct StreamedSource {
   UnicodeCache unicode_cache;
   std::unique_ptr<ParseInfo> info;
   std::unique_ptr<Parser> parser;
+  // Bytecode generated on the background thread, if any. Refers to {info}.
+  std::unique_ptr<BackgroundCompileJobs> compile_jobs;
 
   // Prevent copying.
   StreamedSource(const StreamedSource&) = delete;
@@ -59,6 +63,8 @@ class BackgroundParsingTask : public ScriptCompiler::ScriptStreamingTask {
   StreamedSource* source_;  // Not owned.
   int stack_size_;
   ScriptData* script_data_;
+  Isolate* isolate_;
+  bool compile_on_background_thread_;
 };
 }  // namespace internal
 }  // namespace v8
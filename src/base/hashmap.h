@@ -120,6 +120,7 @@ class TemplateHashMapImpl {
 
   Entry* map_end() const { return map_ + capacity_; }
   Entry* Probe(const Key& key, uint32_t hash) const;
+  Entry* ProbeEmpty(uint32_t hash) const;
   Entry* FillEmptyEntry(Entry* entry, const Key& key, const Value& value,
                         uint32_t hash,
                         AllocationPolicy allocator = AllocationPolicy());
@@ -309,6 +310,24 @@ TemplateHashMapImpl<Key, Value, MatchFun, AllocationPolicy>::Probe(
   return &map_[i];
 }
 
+// Finds the first empty entry for |hash| without comparing keys. Only valid
+// for keys that are known not to be in the map yet.
+template <typename Key, typename Value, typename MatchFun,
+          class AllocationPolicy>
+typename TemplateHashMapImpl<Key, Value, MatchFun, AllocationPolicy>::Entry*
+TemplateHashMapImpl<Key, Value, MatchFun, AllocationPolicy>::ProbeEmpty(
+    uint32_t hash) const {
+  DCHECK(base::bits::IsPowerOfTwo32(capacity_));
+  size_t i = hash & (capacity_ - 1);
+
+  DCHECK(occupancy_ < capacity_);  // Guarantees loop termination.
+  while (map_[i].exists()) {
+    i = (i + 1) & (capacity_ - 1);
+  }
+
+  return &map_[i];
+}
+
 template <typename Key, typename Value, typename MatchFun,
           class AllocationPolicy>
 typename TemplateHashMapImpl<Key, Value, MatchFun, AllocationPolicy>::Entry*
@@ -348,20 +367,22 @@ template <typename Key, typename Value, typename MatchFun,
 void TemplateHashMapImpl<Key, Value, MatchFun, AllocationPolicy>::Resize(
     AllocationPolicy allocator) {
   Entry* map = map_;
-  uint32_t n = occupancy_;
+  uint32_t occupancy = occupancy_;
+  uint32_t n = occupancy;
 
   // Allocate larger map.
   Initialize(capacity_ * 2, allocator);
 
-  // Rehash all current entries.
+  // Rehash all current entries. The keys are distinct and the new map is at
+  // most 40% full, so neither key comparisons nor a further resize are needed.
   for (Entry* entry = map; n > 0; entry++) {
     if (entry->exists()) {
-      Entry* new_entry = Probe(entry->key, entry->hash);
-      new_entry = FillEmptyEntry(new_entry, entry->key, entry->value,
-                                 entry->hash, allocator);
+      Entry* new_entry = ProbeEmpty(entry->hash);
+      *new_entry = *entry;
       n--;
     }
   }
+  occupancy_ = occupancy;
 
   // Delete old map.
   AllocationPolicy::Delete(map);
@@ -245,5 +245,12 @@ bool VirtualMemory::ReleaseRegion(void* base, size_t size) {
 
 
 bool VirtualMemory::HasLazyCommits() { return true; }
+
+bool VirtualMemory::AdviseHugePages(void* base, size_t size) { return false; }
+
+bool VirtualMemory::SetPreferredNumaNode(void* base, size_t size,
+                                         int node) {
+  return false;
+}
 }  // namespace base
 }  // namespace v8
@@ -253,5 +253,12 @@ bool VirtualMemory::HasLazyCommits() {
   return false;
 }
 
+bool VirtualMemory::AdviseHugePages(void* base, size_t size) { return false; }
+
+bool VirtualMemory::SetPreferredNumaNode(void* base, size_t size,
+                                         int node) {
+  return false;
+}
+
 }  // namespace base
 }  // namespace v8
@@ -313,5 +313,31 @@ bool VirtualMemory::ReleaseRegion(void* base, size_t size) {
 
 bool VirtualMemory::HasLazyCommits() { return true; }
 
+bool VirtualMemory::AdviseHugePages(void* base, size_t size) {
+#if defined(MADV_HUGEPAGE)
+  return madvise(base, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+bool VirtualMemory::SetPreferredNumaNode(void* base, size_t size,
+                                         int node) {
+#if defined(__NR_mbind)
+  // Mirrors MPOL_PREFERRED from <numaif.h>, which would pull in libnuma.
+  const int kMpolPreferred = 1;
+  const int kBitsPerWord = static_cast<int>(sizeof(unsigned long) * 8);
+  const int kMaxNodes = 1024;
+  unsigned long node_mask[kMaxNodes / kBitsPerWord] = {0};  // NOLINT
+  if (node < 0 || node >= kMaxNodes) return false;
+  node_mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  // The kernel only looks at the first {maxnode} - 1 bits of the mask.
+  return syscall(__NR_mbind, base, size, kMpolPreferred, node_mask,
+                 kMaxNodes + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
 }  // namespace base
 }  // namespace v8
@@ -305,14 +305,17 @@ class PosixMemoryMappedFile final : public OS::MemoryMappedFile {
 
 
 // static
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
-  if (FILE* file = fopen(name, "r+")) {
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                 FileMode mode) {
+  const char* fopen_mode = (mode == FileMode::kReadOnly) ? "r" : "r+";
+  if (FILE* file = fopen(name, fopen_mode)) {
     if (fseek(file, 0, SEEK_END) == 0) {
       long size = ftell(file);  // NOLINT(runtime/int)
       if (size >= 0) {
-        void* const memory =
-            mmap(OS::GetRandomMmapAddr(), size, PROT_READ | PROT_WRITE,
-                 MAP_SHARED, fileno(file), 0);
+        int prot = PROT_READ;
+        if (mode == FileMode::kReadWrite) prot |= PROT_WRITE;
+        void* const memory = mmap(OS::GetRandomMmapAddr(), size, prot,
+                                  MAP_SHARED, fileno(file), 0);
         if (memory != MAP_FAILED) {
           return new PosixMemoryMappedFile(file, memory, size);
         }
@@ -371,6 +374,17 @@ int OS::GetCurrentThreadId() {
 #endif
 }
 
+int OS::GetCurrentNumaNode() {
+#if V8_OS_LINUX && defined(__NR_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) != 0) return -1;
+  return static_cast<int>(node);
+#else
+  return -1;
+#endif
+}
+
 
 // ----------------------------------------------------------------------------
 // POSIX date/time support.
@@ -618,6 +632,34 @@ static void* ThreadEntry(void* arg) {
 }
 
 
+// static
+bool Thread::SetCurrentThreadAffinity(uint64_t cpu_mask) {
+#if V8_OS_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; cpu++) {
+    if (cpu_mask & (static_cast<uint64_t>(1) << cpu)) CPU_SET(cpu, &set);
+  }
+  // On Linux, pid 0 refers to the calling thread.
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  return false;
+#endif
+}
+
+
+// static
+bool Thread::SetCurrentThreadNiceLevel(int nice_level) {
+#if V8_OS_LINUX
+  // Linux applies nice values per thread when passed a thread id.
+  return setpriority(PRIO_PROCESS, OS::GetCurrentThreadId(), nice_level) == 0;
+#else
+  // Elsewhere setpriority would change the priority of the whole process.
+  return false;
+#endif
+}
+
+
 void Thread::set_name(const char* name) {
   strncpy(name_, name, sizeof(name_));
   name_[sizeof(name_) - 1] = '\0';
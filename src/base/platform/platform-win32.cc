@@ -493,6 +493,8 @@ int OS::GetCurrentThreadId() {
   return static_cast<int>(::GetCurrentThreadId());
 }
 
+int OS::GetCurrentNumaNode() { return -1; }
+
 
 // ----------------------------------------------------------------------------
 // Win32 console output.
@@ -888,21 +890,28 @@ class Win32MemoryMappedFile final : public OS::MemoryMappedFile {
 
 
 // static
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                 FileMode mode) {
   // Open a physical file
-  HANDLE file = CreateFileA(name, GENERIC_READ | GENERIC_WRITE,
-      FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
+  DWORD access = GENERIC_READ;
+  if (mode == FileMode::kReadWrite) access |= GENERIC_WRITE;
+  HANDLE file = CreateFileA(name, access, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                            NULL, OPEN_EXISTING, 0, NULL);
   if (file == INVALID_HANDLE_VALUE) return NULL;
 
   DWORD size = GetFileSize(file, NULL);
 
   // Create a file mapping for the physical file
+  DWORD protection =
+      (mode == FileMode::kReadOnly) ? PAGE_READONLY : PAGE_READWRITE;
   HANDLE file_mapping =
-      CreateFileMapping(file, NULL, PAGE_READWRITE, 0, size, NULL);
+      CreateFileMapping(file, NULL, protection, 0, size, NULL);
   if (file_mapping == NULL) return NULL;
 
   // Map a view of the file into memory
-  void* memory = MapViewOfFile(file_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  DWORD view_access =
+      (mode == FileMode::kReadOnly) ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS;
+  void* memory = MapViewOfFile(file_mapping, view_access, 0, 0, size);
   return new Win32MemoryMappedFile(file, file_mapping, memory, size);
 }
 
@@ -1314,6 +1323,13 @@ bool VirtualMemory::HasLazyCommits() {
   return false;
 }
 
+bool VirtualMemory::AdviseHugePages(void* base, size_t size) { return false; }
+
+bool VirtualMemory::SetPreferredNumaNode(void* base, size_t size,
+                                         int node) {
+  return false;
+}
+
 
 // ----------------------------------------------------------------------------
 // Win32 thread support.
@@ -1351,6 +1367,29 @@ Thread::Thread(const Options& options)
 }
 
 
+// static
+bool Thread::SetCurrentThreadAffinity(uint64_t cpu_mask) {
+  return SetThreadAffinityMask(GetCurrentThread(),
+                               static_cast<DWORD_PTR>(cpu_mask)) != 0;
+}
+
+
+// static
+bool Thread::SetCurrentThreadNiceLevel(int nice_level) {
+  int priority = THREAD_PRIORITY_NORMAL;
+  if (nice_level >= 10) {
+    priority = THREAD_PRIORITY_LOWEST;
+  } else if (nice_level > 0) {
+    priority = THREAD_PRIORITY_BELOW_NORMAL;
+  } else if (nice_level <= -10) {
+    priority = THREAD_PRIORITY_HIGHEST;
+  } else if (nice_level < 0) {
+    priority = THREAD_PRIORITY_ABOVE_NORMAL;
+  }
+  return SetThreadPriority(GetCurrentThread(), priority) != 0;
+}
+
+
 void Thread::set_name(const char* name) {
   OS::StrNCpy(name_, sizeof(name_), name, strlen(name));
   name_[sizeof(name_) - 1] = '\0';
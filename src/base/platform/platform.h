@@ -218,11 +218,14 @@ class V8_BASE_EXPORT OS {
 
   class V8_BASE_EXPORT MemoryMappedFile {
    public:
+    enum class FileMode { kReadOnly, kReadWrite };
+
     virtual ~MemoryMappedFile() {}
     virtual void* memory() const = 0;
     virtual size_t size() const = 0;
 
-    static MemoryMappedFile* open(const char* name);
+    static MemoryMappedFile* open(const char* name,
+                                  FileMode mode = FileMode::kReadWrite);
     static MemoryMappedFile* create(const char* name, size_t size,
                                     void* initial);
   };
@@ -276,6 +279,10 @@ class V8_BASE_EXPORT OS {
 
   static int GetCurrentThreadId();
 
+  // Returns the NUMA node of the processor the current thread is running on,
+  // or -1 if it is unknown.
+  static int GetCurrentNumaNode();
+
  private:
   static const int msPerSecond = 1000;
 
@@ -409,6 +416,16 @@ class V8_BASE_EXPORT VirtualMemory {
   // Otherwise returns false.
   static bool HasLazyCommits();
 
+  // Hints to the OS that the committed region [base, base + size) should be
+  // backed by transparent huge pages. Returns false if the OS does not
+  // support the hint.
+  static bool AdviseHugePages(void* base, size_t size);
+
+  // Asks the OS to back the committed region [base, base + size) with
+  // physical pages of NUMA node {node} when they are first touched. Returns
+  // false if the OS does not support the hint.
+  static bool SetPreferredNumaNode(void* base, size_t size, int node);
+
  private:
   bool InVM(void* address, size_t size) {
     return (reinterpret_cast<uintptr_t>(address_) <=
@@ -475,6 +492,15 @@ class V8_BASE_EXPORT Thread {
   // Abstract method for run handler.
   virtual void Run() = 0;
 
+  // Restricts the calling thread to the CPUs whose bits are set in |cpu_mask|.
+  // Returns false if this is not supported or fails.
+  static bool SetCurrentThreadAffinity(uint64_t cpu_mask);
+
+  // Sets the scheduling priority of the calling thread, using the nice scale
+  // from -20 (highest) to 19 (lowest). Returns false if this is not supported
+  // or fails, e.g. when raising the priority needs privileges.
+  static bool SetCurrentThreadNiceLevel(int nice_level);
+
   // Thread-local storage.
   static LocalStorageKey CreateThreadLocalKey();
   static void DeleteThreadLocalKey(LocalStorageKey key);
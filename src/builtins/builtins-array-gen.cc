@@ -1180,6 +1180,135 @@ TF_BUILTIN(FastArrayShift, CodeStubAssembler) {
   }
 }
 
+TF_BUILTIN(FastArraySlice, CodeStubAssembler) {
+  Node* argc = Parameter(BuiltinDescriptor::kArgumentsCount);
+  Node* context = Parameter(BuiltinDescriptor::kContext);
+  CSA_ASSERT(this, WordEqual(Parameter(BuiltinDescriptor::kNewTarget),
+                             UndefinedConstant()));
+
+  CodeStubArguments args(this, ChangeInt32ToIntPtr(argc));
+  Node* receiver = args.GetReceiver();
+
+  Label runtime(this, Label::kDeferred);
+  Label fast(this);
+
+  // Only slice in this stub if
+  // 1) the array has fast elements and no elements on the prototype chain,
+  // 2) the array has the initial Array.prototype and @@species is intact,
+  //    so the result is a plain JSArray,
+  // 3) start and end are Smis or undefined,
+  // 4) the result fits into a regular new space object.
+
+  // 1) Check that the array has fast elements.
+  BranchIfFastJSArray(receiver, context, FastJSArrayAccessMode::ANY_ACCESS,
+                      &fast, &runtime);
+
+  BIND(&fast);
+  {
+    // 2) Check the prototype and the species protector.
+    Node* native_context = LoadNativeContext(context);
+    Node* map = LoadMap(receiver);
+    GotoIf(WordNotEqual(LoadMapPrototype(map),
+                        LoadContextElement(
+                            native_context,
+                            Context::INITIAL_ARRAY_PROTOTYPE_INDEX)),
+           &runtime);
+    GotoIf(WordEqual(LoadObjectField(SpeciesProtectorConstant(),
+                                     Cell::kValueOffset),
+                     SmiConstant(Isolate::kProtectorInvalid)),
+           &runtime);
+
+    // 3) Compute the actual start and end, see BUILTIN(ArraySlice).
+    Node* length = LoadAndUntagObjectField(receiver, JSArray::kLengthOffset);
+    auto clamp_index = [&](Node* arg, Node* if_undefined) {
+      VARIABLE(var_index, MachineType::PointerRepresentation(), if_undefined);
+      Label done(this, &var_index), negative(this);
+      GotoIf(WordEqual(arg, UndefinedConstant()), &done);
+      GotoIfNot(TaggedIsSmi(arg), &runtime);
+      Node* relative = SmiUntag(arg);
+      GotoIf(IntPtrLessThan(relative, IntPtrConstant(0)), &negative);
+      var_index.Bind(IntPtrMin(relative, length));
+      Goto(&done);
+
+      BIND(&negative);
+      var_index.Bind(
+          IntPtrMax(IntPtrAdd(length, relative), IntPtrConstant(0)));
+      Goto(&done);
+
+      BIND(&done);
+      return var_index.value();
+    };
+    Node* start = clamp_index(args.GetOptionalArgumentValue(0),
+                              IntPtrConstant(0));
+    Node* end = clamp_index(args.GetOptionalArgumentValue(1), length);
+    Node* count = IntPtrMax(IntPtrSub(end, start), IntPtrConstant(0));
+
+    // 4) Check that the result is small enough for new space.
+    GotoIf(IntPtrGreaterThan(
+               count, IntPtrConstant(JSArray::kInitialMaxFastElementArray)),
+           &runtime);
+
+    // The result has the elements kind of the receiver, holes are preserved
+    // as there are no elements on the prototype chain.
+    Node* elements_kind = LoadMapElementsKind(map);
+    Node* result_map = LoadContextElement(
+        native_context,
+        IntPtrAdd(ChangeInt32ToIntPtr(elements_kind),
+                  IntPtrConstant(Context::FIRST_JS_ARRAY_MAP_SLOT)));
+    Node* elements = LoadElements(receiver);
+
+    Label empty(this), double_elements(this);
+    GotoIf(IntPtrEqual(count, IntPtrConstant(0)), &empty);
+    GotoIf(Int32GreaterThan(elements_kind,
+                            Int32Constant(TERMINAL_FAST_ELEMENTS_KIND)),
+           &double_elements);
+
+    // Bulk copy the selected range into the freshly allocated backing store.
+    // The result is in new space, so no write barrier is needed.
+    auto copy_elements = [&](ElementsKind kind, Heap::RootListIndex map_index) {
+      Node* result = nullptr;
+      Node* result_elements = nullptr;
+      std::tie(result, result_elements) =
+          AllocateUninitializedJSArrayWithElements(
+              kind, result_map, SmiTag(count), nullptr, count);
+      StoreMapNoWriteBarrier(result_elements, map_index);
+      StoreObjectFieldNoWriteBarrier(result_elements, FixedArray::kLengthOffset,
+                                     SmiTag(count));
+      int32_t header_size = FixedArray::kHeaderSize - kHeapObjectTag;
+      STATIC_ASSERT(FixedArray::kHeaderSize == FixedDoubleArray::kHeaderSize);
+      Node* memcpy =
+          ExternalConstant(ExternalReference::libc_memcpy_function(isolate()));
+      Node* from = IntPtrAdd(
+          BitcastTaggedToWord(elements),
+          ElementOffsetFromIndex(start, kind, INTPTR_PARAMETERS, header_size));
+      Node* to = IntPtrAdd(BitcastTaggedToWord(result_elements),
+                           IntPtrConstant(header_size));
+      Node* size = ElementOffsetFromIndex(count, kind, INTPTR_PARAMETERS, 0);
+      CallCFunction3(MachineType::AnyTagged(), MachineType::Pointer(),
+                     MachineType::Pointer(), MachineType::UintPtr(), memcpy,
+                     to, from, size);
+      args.PopAndReturn(result);
+    };
+    copy_elements(FAST_HOLEY_ELEMENTS, Heap::kFixedArrayMapRootIndex);
+
+    BIND(&double_elements);
+    copy_elements(FAST_HOLEY_DOUBLE_ELEMENTS,
+                  Heap::kFixedDoubleArrayMapRootIndex);
+
+    BIND(&empty);
+    args.PopAndReturn(AllocateJSArray(FAST_SMI_ELEMENTS, result_map,
+                                      IntPtrConstant(0), SmiConstant(0)));
+  }
+
+  BIND(&runtime);
+  {
+    Node* target = LoadFromFrame(StandardFrameConstants::kFunctionOffset,
+                                 MachineType::TaggedPointer());
+    TailCallStub(CodeFactory::ArraySlice(isolate()), context, target,
+                 UndefinedConstant(), argc);
+  }
+}
+
 TF_BUILTIN(ArrayForEachLoopContinuation, ArrayBuiltinCodeStubAssembler) {
   Node* context = Parameter(Descriptor::kContext);
   Node* receiver = Parameter(Descriptor::kReceiver);
@@ -1294,6 +1423,45 @@ TF_BUILTIN(ArraySomeLoopContinuation, ArrayBuiltinCodeStubAssembler) {
       &ArrayBuiltinCodeStubAssembler::NullPostLoopAction);
 }
 
+TF_BUILTIN(ArraySomeLoopEagerDeoptContinuation,
+           ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* this_arg = Parameter(Descriptor::kThisArg);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArraySomeLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, this_arg,
+                  FalseConstant(), receiver, initial_k, len,
+                  UndefinedConstant()));
+}
+
+TF_BUILTIN(ArraySomeLoopLazyDeoptContinuation, ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* this_arg = Parameter(Descriptor::kThisArg);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+  Node* result = Parameter(Descriptor::kResult);
+
+  // The {result} of the callback for {initial_k} decides whether we are done.
+  Label return_true(this), false_continue(this);
+  BranchIfToBooleanIsTrue(result, &return_true, &false_continue);
+  BIND(&return_true);
+  Return(TrueConstant());
+
+  BIND(&false_continue);
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArraySomeLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, this_arg,
+                  FalseConstant(), receiver, NumberInc(initial_k), len,
+                  UndefinedConstant()));
+}
+
 TF_BUILTIN(ArraySome, ArrayBuiltinCodeStubAssembler) {
   Node* argc =
       ChangeInt32ToIntPtr(Parameter(BuiltinDescriptor::kArgumentsCount));
@@ -1416,6 +1584,38 @@ TF_BUILTIN(ArrayReduceLoopContinuation, ArrayBuiltinCodeStubAssembler) {
       &ArrayBuiltinCodeStubAssembler::ReducePostLoopAction);
 }
 
+TF_BUILTIN(ArrayReduceLoopEagerDeoptContinuation,
+           ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+  Node* accumulator = Parameter(Descriptor::kAccumulator);
+
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArrayReduceLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, UndefinedConstant(),
+                  accumulator, receiver, initial_k, len, UndefinedConstant()));
+}
+
+TF_BUILTIN(ArrayReduceLoopLazyDeoptContinuation,
+           ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+  Node* result = Parameter(Descriptor::kResult);
+
+  // The {result} of the callback for {initial_k} is the new accumulator.
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArrayReduceLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, UndefinedConstant(),
+                  result, receiver, NumberInc(initial_k), len,
+                  UndefinedConstant()));
+}
+
 TF_BUILTIN(ArrayReduce, ArrayBuiltinCodeStubAssembler) {
   Node* argc =
       ChangeInt32ToIntPtr(Parameter(BuiltinDescriptor::kArgumentsCount));
@@ -1542,6 +1742,56 @@ TF_BUILTIN(ArrayFilterLoopContinuation, ArrayBuiltinCodeStubAssembler) {
       &ArrayBuiltinCodeStubAssembler::NullPostLoopAction);
 }
 
+TF_BUILTIN(ArrayFilterLoopEagerDeoptContinuation,
+           ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* this_arg = Parameter(Descriptor::kThisArg);
+  Node* array = Parameter(Descriptor::kArray);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+  Node* to = Parameter(Descriptor::kTo);
+
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArrayFilterLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, this_arg, array,
+                  receiver, initial_k, len, to));
+}
+
+TF_BUILTIN(ArrayFilterLoopLazyDeoptContinuation,
+           ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* this_arg = Parameter(Descriptor::kThisArg);
+  Node* array = Parameter(Descriptor::kArray);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+  Node* value_k = Parameter(Descriptor::kValueK);
+  Node* result = Parameter(Descriptor::kResult);
+
+  VARIABLE(to, MachineRepresentation::kTagged, Parameter(Descriptor::kTo));
+
+  // If the {result} of the callback for {initial_k} is true, {value_k} still
+  // has to be added to the {array}.
+  Label true_continue(this, &to), false_continue(this, &to);
+  BranchIfToBooleanIsTrue(result, &true_continue, &false_continue);
+  BIND(&true_continue);
+  {
+    CallRuntime(Runtime::kCreateDataProperty, context, array, to.value(),
+                value_k);
+    to.Bind(NumberInc(to.value()));
+    Goto(&false_continue);
+  }
+
+  BIND(&false_continue);
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArrayFilterLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, this_arg, array,
+                  receiver, NumberInc(initial_k), len, to.value()));
+}
+
 TF_BUILTIN(ArrayFilter, ArrayBuiltinCodeStubAssembler) {
   Node* argc =
       ChangeInt32ToIntPtr(Parameter(BuiltinDescriptor::kArgumentsCount));
@@ -1583,6 +1833,41 @@ TF_BUILTIN(ArrayMapLoopContinuation, ArrayBuiltinCodeStubAssembler) {
       &ArrayBuiltinCodeStubAssembler::NullPostLoopAction);
 }
 
+TF_BUILTIN(ArrayMapLoopEagerDeoptContinuation, ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* this_arg = Parameter(Descriptor::kThisArg);
+  Node* array = Parameter(Descriptor::kArray);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArrayMapLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, this_arg, array,
+                  receiver, initial_k, len, UndefinedConstant()));
+}
+
+TF_BUILTIN(ArrayMapLoopLazyDeoptContinuation, ArrayBuiltinCodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* callbackfn = Parameter(Descriptor::kCallbackFn);
+  Node* this_arg = Parameter(Descriptor::kThisArg);
+  Node* array = Parameter(Descriptor::kArray);
+  Node* initial_k = Parameter(Descriptor::kInitialK);
+  Node* len = Parameter(Descriptor::kLength);
+  Node* result = Parameter(Descriptor::kResult);
+
+  // The {result} of the callback for {initial_k} still has to be stored into
+  // the {array}.
+  CallRuntime(Runtime::kCreateDataProperty, context, array, initial_k, result);
+
+  Callable stub(
+      Builtins::CallableFor(isolate(), Builtins::kArrayMapLoopContinuation));
+  Return(CallStub(stub, context, receiver, callbackfn, this_arg, array,
+                  receiver, NumberInc(initial_k), len, UndefinedConstant()));
+}
+
 TF_BUILTIN(ArrayMap, ArrayBuiltinCodeStubAssembler) {
   Node* argc =
       ChangeInt32ToIntPtr(Parameter(BuiltinDescriptor::kArgumentsCount));
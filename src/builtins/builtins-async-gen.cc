@@ -23,13 +23,44 @@ Node* AsyncBuiltinsAssembler::Await(
     Node* context, Node* generator, Node* value, Node* outer_promise,
     const NodeGenerator1& create_closure_context, int on_resolve_context_index,
     int on_reject_context_index, bool is_predicted_as_caught) {
-  // Let promiseCapability be ! NewPromiseCapability(%Promise%).
-  Node* const wrapped_value = AllocateAndInitJSPromise(context);
+  Node* const native_context = LoadNativeContext(context);
 
-  // Perform ! Call(promiseCapability.[[Resolve]], undefined, « promise »).
-  CallBuiltin(Builtins::kResolveNativePromise, context, wrapped_value, value);
+  // With --harmony-await-optimization, an unmodified native promise is awaited
+  // directly. This saves allocating a wrapper promise, and the two microtask
+  // ticks it takes to resolve the wrapper with {value}.
+  VARIABLE(var_wrapped_value, MachineRepresentation::kTagged);
+  Label if_wrap(this), if_nativepromise(this),
+      done_wrap(this, &var_wrapped_value);
+  Node* const flag_value = Load(
+      MachineType::Int8(),
+      ExternalConstant(
+          ExternalReference::address_of_await_optimization_flag(isolate())));
+  GotoIf(Word32Equal(flag_value, Int32Constant(0)), &if_wrap);
+  GotoIf(TaggedIsSmi(value), &if_wrap);
+  Node* const promise_fun =
+      LoadContextElement(native_context, Context::PROMISE_FUNCTION_INDEX);
+  BranchIfFastPath(native_context, promise_fun, value, &if_nativepromise,
+                   &if_wrap);
+
+  BIND(&if_nativepromise);
+  {
+    var_wrapped_value.Bind(value);
+    Goto(&done_wrap);
+  }
 
-  Node* const native_context = LoadNativeContext(context);
+  BIND(&if_wrap);
+  {
+    // Let promiseCapability be ! NewPromiseCapability(%Promise%).
+    Node* const promise = AllocateAndInitJSPromise(context);
+
+    // Perform ! Call(promiseCapability.[[Resolve]], undefined, « promise »).
+    CallBuiltin(Builtins::kResolveNativePromise, context, promise, value);
+    var_wrapped_value.Bind(promise);
+    Goto(&done_wrap);
+  }
+
+  BIND(&done_wrap);
+  Node* const wrapped_value = var_wrapped_value.value();
 
   Node* const closure_context = create_closure_context(native_context);
   Node* const map = LoadContextElement(
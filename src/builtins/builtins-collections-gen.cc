@@ -28,6 +28,30 @@ class CollectionsBuiltinsAssembler : public CodeStubAssembler {
   Node* CallGetRaw(Node* const table, Node* const key);
   template <typename CollectionType, int entrysize>
   Node* CallHasRaw(Node* const table, Node* const key);
+
+  // Compares a candidate key from a bucket chain with the key being looked
+  // up and jumps to {if_same} or {if_not_same}.
+  typedef std::function<void(Node* candidate_key, Label* if_same,
+                             Label* if_not_same)>
+      KeyComparator;
+
+  // Walks the bucket chain for {hash} in {table}. On success, jumps to
+  // {if_found} with the FixedArray index of the entry's key in
+  // {var_key_index}.
+  template <typename CollectionType>
+  void FindOrderedHashTableEntry(Node* const table, Node* const hash,
+                                 const KeyComparator& key_compare,
+                                 Variable* var_key_index, Label* if_found,
+                                 Label* if_not_found);
+
+  // Looks up {key} in {table} without leaving generated code if {key} is a
+  // Smi or a string whose hash is already computed. Jumps to {if_slow} for
+  // all other keys, which have to go through the C++ lookup.
+  template <typename CollectionType>
+  void TryLookupOrderedHashTableIndex(Node* const table, Node* const key,
+                                      Node* const context,
+                                      Variable* var_key_index, Label* if_found,
+                                      Label* if_not_found, Label* if_slow);
 };
 
 template <typename CollectionType>
@@ -372,6 +396,103 @@ Node* CollectionsBuiltinsAssembler::CallHasRaw(Node* const table,
       Word32NotEqual(Word32And(result, Int32Constant(0xFF)), Int32Constant(0)));
 }
 
+template <typename CollectionType>
+void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
+    Node* const table, Node* const hash, const KeyComparator& key_compare,
+    Variable* var_key_index, Label* if_found, Label* if_not_found) {
+  // Get the first entry of the bucket.
+  Node* const number_of_buckets = SmiUntag(
+      LoadFixedArrayElement(table, CollectionType::kNumberOfBucketsIndex));
+  Node* const bucket =
+      WordAnd(hash, IntPtrSub(number_of_buckets, IntPtrConstant(1)));
+  Node* const first_entry = SmiUntag(LoadFixedArrayElement(
+      table, bucket, CollectionType::kHashTableStartIndex * kPointerSize));
+
+  // Walk the bucket chain.
+  VARIABLE(var_entry, MachineType::PointerRepresentation(), first_entry);
+  Label loop(this, &var_entry), if_same(this), continue_next_entry(this);
+  Goto(&loop);
+  BIND(&loop);
+  {
+    Node* const entry = var_entry.value();
+    GotoIf(WordEqual(entry, IntPtrConstant(CollectionType::kNotFound)),
+           if_not_found);
+
+    Node* const key_index = IntPtrAdd(
+        IntPtrAdd(IntPtrMul(entry, IntPtrConstant(CollectionType::kEntrySize)),
+                  number_of_buckets),
+        IntPtrConstant(CollectionType::kHashTableStartIndex));
+    Node* const candidate_key = LoadFixedArrayElement(table, key_index);
+    key_compare(candidate_key, &if_same, &continue_next_entry);
+
+    BIND(&if_same);
+    var_key_index->Bind(key_index);
+    Goto(if_found);
+
+    BIND(&continue_next_entry);
+    var_entry.Bind(SmiUntag(LoadFixedArrayElement(
+        table, key_index, CollectionType::kChainOffset * kPointerSize)));
+    Goto(&loop);
+  }
+}
+
+template <typename CollectionType>
+void CollectionsBuiltinsAssembler::TryLookupOrderedHashTableIndex(
+    Node* const table, Node* const key, Node* const context,
+    Variable* var_key_index, Label* if_found, Label* if_not_found,
+    Label* if_slow) {
+  Label if_key_smi(this), if_key_string(this);
+  GotoIf(TaggedIsSmi(key), &if_key_smi);
+  Node* const key_instance_type = LoadInstanceType(key);
+  Branch(IsStringInstanceType(key_instance_type), &if_key_string, if_slow);
+
+  BIND(&if_key_smi);
+  {
+    // See OrderedHashTable::KeyToFirstEntry().
+    Node* const hash = ChangeUint32ToWord(
+        ComputeIntegerHash(SmiUntag(key), Int32Constant(kZeroHashSeed)));
+    FindOrderedHashTableEntry<CollectionType>(
+        table, hash,
+        [&](Node* candidate_key, Label* if_same, Label* if_not_same) {
+          GotoIf(WordEqual(candidate_key, key), if_same);
+          GotoIf(TaggedIsSmi(candidate_key), if_not_same);
+          GotoIfNot(IsHeapNumber(candidate_key), if_not_same);
+          Branch(Float64Equal(SmiToFloat64(key),
+                              LoadHeapNumberValue(candidate_key)),
+                 if_same, if_not_same);
+        },
+        var_key_index, if_found, if_not_found);
+  }
+
+  BIND(&if_key_string);
+  {
+    // A string that might be equal to one of the keys does not necessarily
+    // have its hash computed yet, so let the runtime compute it.
+    Node* const hash = ChangeUint32ToWord(LoadNameHash(key, if_slow));
+    FindOrderedHashTableEntry<CollectionType>(
+        table, hash,
+        [&](Node* candidate_key, Label* if_same, Label* if_not_same) {
+          GotoIf(WordEqual(candidate_key, key), if_same);
+          GotoIf(TaggedIsSmi(candidate_key), if_not_same);
+          Node* const candidate_instance_type = LoadInstanceType(candidate_key);
+          GotoIfNot(IsStringInstanceType(candidate_instance_type),
+                    if_not_same);
+          // Two different internalized strings are never equal.
+          GotoIf(Word32Equal(
+                     Word32And(Word32Or(key_instance_type,
+                                        candidate_instance_type),
+                               Int32Constant(kIsNotInternalizedMask)),
+                     Int32Constant(kInternalizedTag)),
+                 if_not_same);
+          Branch(WordEqual(CallBuiltin(Builtins::kStringEqual, context, key,
+                                       candidate_key),
+                           TrueConstant()),
+                 if_same, if_not_same);
+        },
+        var_key_index, if_found, if_not_found);
+  }
+}
+
 TF_BUILTIN(MapGet, CollectionsBuiltinsAssembler) {
   Node* const receiver = Parameter(Descriptor::kReceiver);
   Node* const key = Parameter(Descriptor::kKey);
@@ -380,6 +501,21 @@ TF_BUILTIN(MapGet, CollectionsBuiltinsAssembler) {
   ThrowIfNotInstanceType(context, receiver, JS_MAP_TYPE, "Map.prototype.get");
 
   Node* const table = LoadObjectField(receiver, JSMap::kTableOffset);
+
+  VARIABLE(var_key_index, MachineType::PointerRepresentation());
+  Label if_found(this, &var_key_index), if_not_found(this), if_slow(this);
+  TryLookupOrderedHashTableIndex<OrderedHashMap>(table, key, context,
+                                                 &var_key_index, &if_found,
+                                                 &if_not_found, &if_slow);
+
+  BIND(&if_found);
+  Return(LoadFixedArrayElement(table, var_key_index.value(),
+                               OrderedHashMap::kValueOffset * kPointerSize));
+
+  BIND(&if_not_found);
+  Return(UndefinedConstant());
+
+  BIND(&if_slow);
   Return(CallGetRaw(table, key));
 }
 
@@ -391,6 +527,20 @@ TF_BUILTIN(MapHas, CollectionsBuiltinsAssembler) {
   ThrowIfNotInstanceType(context, receiver, JS_MAP_TYPE, "Map.prototype.has");
 
   Node* const table = LoadObjectField(receiver, JSMap::kTableOffset);
+
+  VARIABLE(var_key_index, MachineType::PointerRepresentation());
+  Label if_found(this, &var_key_index), if_not_found(this), if_slow(this);
+  TryLookupOrderedHashTableIndex<OrderedHashMap>(table, key, context,
+                                                     &var_key_index, &if_found,
+                                                     &if_not_found, &if_slow);
+
+  BIND(&if_found);
+  Return(TrueConstant());
+
+  BIND(&if_not_found);
+  Return(FalseConstant());
+
+  BIND(&if_slow);
   Return(CallHasRaw<OrderedHashMap, 2>(table, key));
 }
 
@@ -402,6 +552,20 @@ TF_BUILTIN(SetHas, CollectionsBuiltinsAssembler) {
   ThrowIfNotInstanceType(context, receiver, JS_SET_TYPE, "Set.prototype.has");
 
   Node* const table = LoadObjectField(receiver, JSMap::kTableOffset);
+
+  VARIABLE(var_key_index, MachineType::PointerRepresentation());
+  Label if_found(this, &var_key_index), if_not_found(this), if_slow(this);
+  TryLookupOrderedHashTableIndex<OrderedHashSet>(table, key, context,
+                                                     &var_key_index, &if_found,
+                                                     &if_not_found, &if_slow);
+
+  BIND(&if_found);
+  Return(TrueConstant());
+
+  BIND(&if_not_found);
+  Return(FalseConstant());
+
+  BIND(&if_slow);
   Return(CallHasRaw<OrderedHashSet, 1>(table, key));
 }
 
@@ -197,8 +197,22 @@ Node* ConstructorBuiltinsAssembler::LoadFeedbackVectorSlot(
     Node* closure, Node* literal_index) {
   Node* cell = LoadObjectField(closure, JSFunction::kFeedbackVectorOffset);
   Node* feedback_vector = LoadObjectField(cell, Cell::kValueOffset);
-  return LoadFixedArrayElement(feedback_vector, literal_index, 0,
-                               CodeStubAssembler::SMI_PARAMETERS);
+
+  // Closures that run without a feedback vector have no literal sites; the
+  // Smi result makes the callers take their runtime path.
+  Label done(this), no_feedback(this, Label::kDeferred);
+  VARIABLE(var_literal_site, MachineRepresentation::kTagged);
+  GotoIf(IsUndefined(feedback_vector), &no_feedback);
+  var_literal_site.Bind(LoadFixedArrayElement(
+      feedback_vector, literal_index, 0, CodeStubAssembler::SMI_PARAMETERS));
+  Goto(&done);
+
+  BIND(&no_feedback);
+  var_literal_site.Bind(SmiConstant(Smi::kZero));
+  Goto(&done);
+
+  BIND(&done);
+  return var_literal_site.value();
 }
 
 Node* ConstructorBuiltinsAssembler::NotHasBoilerplate(Node* literal_site) {
@@ -743,5 +757,231 @@ TF_BUILTIN(FastCloneShallowObject, ConstructorBuiltinsAssembler) {
                   literals_index, boilerplate_description, flags);
 }
 
+Node* ConstructorBuiltinsAssembler::CloneLiteralValue(Node* value,
+                                                      Variable* var_site,
+                                                      int depth,
+                                                      Label* call_runtime) {
+  VARIABLE(var_result, MachineRepresentation::kTagged, value);
+  Label done(this, {&var_result, var_site}), if_mutable_heap_number(this),
+      if_object(this);
+  GotoIf(TaggedIsSmi(value), &done);
+  Node* instance_type = LoadInstanceType(value);
+  GotoIf(Word32Equal(instance_type, Int32Constant(MUTABLE_HEAP_NUMBER_TYPE)),
+         &if_mutable_heap_number);
+  Branch(IsJSReceiverInstanceType(instance_type), &if_object, &done);
+
+  BIND(&if_mutable_heap_number);
+  {
+    var_result.Bind(
+        AllocateHeapNumberWithValue(LoadHeapNumberValue(value), MUTABLE));
+    Goto(&done);
+  }
+
+  BIND(&if_object);
+  {
+    if (depth <= 1) {
+      Goto(call_runtime);
+    } else {
+      // Every nested literal has its own allocation site. The sites form a
+      // list in the same depth-first order that we visit the literals in.
+      Node* nested_site =
+          LoadObjectField(var_site->value(), AllocationSite::kNestedSiteOffset);
+      GotoIf(TaggedIsSmi(nested_site), call_runtime);
+      var_site->Bind(nested_site);
+      var_result.Bind(
+          CloneLiteralBoilerplate(value, var_site, depth - 1, call_runtime));
+      Goto(&done);
+    }
+  }
+
+  BIND(&done);
+  return var_result.value();
+}
+
+Node* ConstructorBuiltinsAssembler::CloneLiteralBoilerplate(
+    Node* boilerplate, Variable* var_site, int depth, Label* call_runtime) {
+  Node* allocation_site = var_site->value();
+  Node* boilerplate_map = LoadMap(boilerplate);
+  Node* instance_type = LoadMapInstanceType(boilerplate_map);
+  Node* is_array = Word32Equal(instance_type, Int32Constant(JS_ARRAY_TYPE));
+  GotoIfNot(Word32Or(is_array, Word32Equal(instance_type,
+                                           Int32Constant(JS_OBJECT_TYPE))),
+            call_runtime);
+  Node* bit_field_3 = LoadMapBitField3(boilerplate_map);
+  GotoIf(IsSetWord32<Map::Deprecated>(bit_field_3), call_runtime);
+  GotoIf(IsSetWord32<Map::DictionaryMap>(bit_field_3), call_runtime);
+  GotoIfNot(IsEmptyFixedArray(LoadProperties(boilerplate)), call_runtime);
+#if V8_DOUBLE_FIELDS_UNBOXING
+  // The in-object fields are visited below, which needs to know which of
+  // them hold raw doubles. Only the Smi encoded layout is supported here.
+  Node* layout_descriptor =
+      LoadObjectField(boilerplate_map, Map::kLayoutDescriptorOffset);
+  GotoIfNot(TaggedIsSmi(layout_descriptor), call_runtime);
+  Node* layout_bits =
+      ChangeUint32ToWord(TruncateWordToWord32(SmiUntag(layout_descriptor)));
+#endif
+
+  VARIABLE(var_elements, MachineRepresentation::kTagged,
+           LoadElements(boilerplate));
+  {
+    // Empty and copy-on-write elements are shared with the boilerplate.
+    Label done(this, &var_elements);
+    Node* boilerplate_elements = var_elements.value();
+    Node* elements_map = LoadMap(boilerplate_elements);
+    GotoIf(IsEmptyFixedArray(boilerplate_elements), &done);
+    GotoIf(IsFixedCOWArrayMap(elements_map), &done);
+    GotoIfNot(Word32Or(IsFixedArrayMap(elements_map),
+                       IsFixedDoubleArrayMap(elements_map)),
+              call_runtime);
+    GotoIf(SmiAbove(LoadFixedArrayBaseLength(boilerplate_elements),
+                    SmiConstant(Smi::FromInt(
+                        ConstructorBuiltins::
+                            kMaximumClonedShallowArrayElements))),
+           call_runtime);
+    var_elements.Bind(CopyFixedArrayBase(boilerplate_elements));
+    Goto(&done);
+    BIND(&done);
+  }
+
+  // Create mementos for all literals that JSObject::DeepCopy would create
+  // them for, so that the pretenuring feedback covers the nested sites too.
+  Node* track_allocation_site = FLAG_allocation_site_pretenuring
+                                    ? Int32Constant(1)
+                                    : is_array;
+  Node* instance_size = TimesPointerSize(LoadMapInstanceSize(boilerplate_map));
+  Node* allocation_size = IntPtrAdd(
+      instance_size, SelectIntPtrConstant(track_allocation_site,
+                                          AllocationMemento::kSize, 0));
+  Node* copy = AllocateInNewSpace(allocation_size);
+  {
+    Comment("Initialize deep literal copy");
+    StoreMapNoWriteBarrier(copy, boilerplate_map);
+    BuildFastLoop(IntPtrConstant(JSObject::kPropertiesOffset), instance_size,
+                  [=](Node* offset) {
+                    Node* field = LoadObjectField(boilerplate, offset);
+                    StoreObjectFieldNoWriteBarrier(copy, offset, field);
+                  },
+                  kPointerSize, INTPTR_PARAMETERS, IndexAdvanceMode::kPost);
+    StoreObjectFieldNoWriteBarrier(copy, JSObject::kElementsOffset,
+                                   var_elements.value());
+  }
+  {
+    Label done(this);
+    GotoIfNot(track_allocation_site, &done);
+    Node* memento = InnerAllocate(copy, instance_size);
+    StoreMapNoWriteBarrier(memento, Heap::kAllocationMementoMapRootIndex);
+    StoreObjectFieldNoWriteBarrier(
+        memento, AllocationMemento::kAllocationSiteOffset, allocation_site);
+    if (FLAG_allocation_site_pretenuring) {
+      Node* memento_create_count = LoadObjectField(
+          allocation_site, AllocationSite::kPretenureCreateCountOffset);
+      memento_create_count =
+          SmiAdd(memento_create_count, SmiConstant(Smi::FromInt(1)));
+      StoreObjectFieldNoWriteBarrier(
+          allocation_site, AllocationSite::kPretenureCreateCountOffset,
+          memento_create_count);
+    }
+    Goto(&done);
+    BIND(&done);
+  }
+
+  // The copy is fully initialized at this point, so nested values can be
+  // allocated. Properties are visited before elements, like DeepCopy does.
+  Comment("Copy nested in-object values");
+  VariableList vars({var_site}, zone());
+  BuildFastLoop(vars, IntPtrConstant(JSObject::kHeaderSize), instance_size,
+                [=](Node* offset) {
+                  Label continue_loop(this);
+#if V8_DOUBLE_FIELDS_UNBOXING
+                  // Unboxed doubles were already copied above. Fields past the
+                  // Smi layout capacity are always tagged.
+                  Label check_field(this);
+                  Node* field_index = WordShr(
+                      IntPtrSub(offset, IntPtrConstant(JSObject::kHeaderSize)),
+                      kPointerSizeLog2);
+                  GotoIfNot(UintPtrLessThan(field_index,
+                                            IntPtrConstant(kSmiValueSize)),
+                            &check_field);
+                  GotoIf(WordNotEqual(WordAnd(WordShr(layout_bits, field_index),
+                                              IntPtrConstant(1)),
+                                      IntPtrConstant(0)),
+                         &continue_loop);
+                  Goto(&check_field);
+                  BIND(&check_field);
+#endif
+                  Node* field = LoadObjectField(copy, offset);
+                  Node* value =
+                      CloneLiteralValue(field, var_site, depth, call_runtime);
+                  GotoIf(WordEqual(field, value), &continue_loop);
+                  StoreObjectField(copy, offset, value);
+                  Goto(&continue_loop);
+                  BIND(&continue_loop);
+                },
+                kPointerSize, INTPTR_PARAMETERS, IndexAdvanceMode::kPost);
+
+  Comment("Copy nested elements");
+  {
+    Label done(this, var_site);
+    Node* elements = var_elements.value();
+    GotoIfNot(IsFixedArrayMap(LoadMap(elements)), &done);
+    BuildFastLoop(vars, IntPtrConstant(0),
+                  LoadAndUntagFixedArrayBaseLength(elements),
+                  [=](Node* index) {
+                    Node* element = LoadFixedArrayElement(elements, index);
+                    Node* value = CloneLiteralValue(element, var_site, depth,
+                                                    call_runtime);
+                    Label continue_loop(this);
+                    GotoIf(WordEqual(element, value), &continue_loop);
+                    StoreFixedArrayElement(elements, index, value);
+                    Goto(&continue_loop);
+                    BIND(&continue_loop);
+                  },
+                  1, INTPTR_PARAMETERS, IndexAdvanceMode::kPost);
+    Goto(&done);
+    BIND(&done);
+  }
+  return copy;
+}
+
+Node* ConstructorBuiltinsAssembler::EmitFastCloneDeepLiteral(
+    Label* call_runtime, Node* closure, Node* literal_index) {
+  Node* allocation_site = LoadFeedbackVectorSlot(closure, literal_index);
+  GotoIf(NotHasBoilerplate(allocation_site), call_runtime);
+  VARIABLE(var_site, MachineRepresentation::kTagged, allocation_site);
+  Node* boilerplate = LoadAllocationSiteBoilerplate(allocation_site);
+  return CloneLiteralBoilerplate(
+      boilerplate, &var_site,
+      ConstructorBuiltins::kMaximumClonedDeepLiteralDepth, call_runtime);
+}
+
+TF_BUILTIN(FastCloneDeepObject, ConstructorBuiltinsAssembler) {
+  Label call_runtime(this, Label::kDeferred);
+  Node* closure = Parameter(Descriptor::kClosure);
+  Node* literal_index = Parameter(Descriptor::kLiteralIndex);
+  Return(EmitFastCloneDeepLiteral(&call_runtime, closure, literal_index));
+
+  BIND(&call_runtime);
+  Node* boilerplate_description =
+      Parameter(Descriptor::kBoilerplateDescription);
+  Node* flags = Parameter(Descriptor::kFlags);
+  Node* context = Parameter(Descriptor::kContext);
+  TailCallRuntime(Runtime::kCreateObjectLiteral, context, closure,
+                  literal_index, boilerplate_description, flags);
+}
+
+TF_BUILTIN(FastCloneDeepArray, ConstructorBuiltinsAssembler) {
+  Label call_runtime(this, Label::kDeferred);
+  Node* closure = Parameter(Descriptor::kClosure);
+  Node* literal_index = Parameter(Descriptor::kLiteralIndex);
+  Return(EmitFastCloneDeepLiteral(&call_runtime, closure, literal_index));
+
+  BIND(&call_runtime);
+  Node* constant_elements = Parameter(Descriptor::kConstantElements);
+  Node* context = Parameter(Descriptor::kContext);
+  Node* flags = SmiConstant(Smi::FromInt(ArrayLiteral::kNoFlags));
+  TailCallRuntime(Runtime::kCreateArrayLiteral, context, closure,
+                  literal_index, constant_elements, flags);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -32,6 +32,11 @@ class ConstructorBuiltinsAssembler : public CodeStubAssembler {
   Node* EmitFastCloneShallowObject(Label* call_runtime, Node* closure,
                                    Node* literals_index);
 
+  // Deep-copies a nested object or array literal boilerplate of at most
+  // ConstructorBuiltins::kMaximumClonedDeepLiteralDepth levels.
+  Node* EmitFastCloneDeepLiteral(Label* call_runtime, Node* closure,
+                                 Node* literal_index);
+
   Node* EmitFastNewObject(Node* context, Node* target, Node* new_target);
 
   Node* EmitFastNewObject(Node* context, Node* target, Node* new_target,
@@ -43,6 +48,11 @@ class ConstructorBuiltinsAssembler : public CodeStubAssembler {
                              Node* capacity, ElementsKind kind);
   Node* CopyFixedArrayBase(Node* elements);
 
+  Node* CloneLiteralBoilerplate(Node* boilerplate, Variable* var_site,
+                                int depth, Label* call_runtime);
+  Node* CloneLiteralValue(Node* value, Variable* var_site, int depth,
+                          Label* call_runtime);
+
   Node* LoadFeedbackVectorSlot(Node* closure, Node* literal_index);
   Node* NotHasBoilerplate(Node* literal_site);
   Node* LoadAllocationSiteBoilerplate(Node* allocation_site);
@@ -28,6 +28,10 @@ class ConstructorBuiltins {
   // NameDictionaries are 50% over-allocated.
   static const int kMaximumClonedShallowObjectProperties =
       NameDictionary::kMaxRegularCapacity / 3 * 2;
+  // Maximum nesting depth of literals copied by the FastCloneDeepObject and
+  // FastCloneDeepArray builtins, including the outermost literal. The copy
+  // code is unrolled for each level.
+  static const int kMaximumClonedDeepLiteralDepth = 3;
 
  private:
   static const int kMaximumSlots = 0x8000;
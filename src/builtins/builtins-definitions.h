@@ -52,6 +52,7 @@ namespace internal {
                                                                                \
   /* Declared first for dependency reasons */                                  \
   ASM(CompileLazy)                                                             \
+  ASM(DeserializeLazy)                                                         \
   TFC(ToObject, TypeConversion, 1)                                             \
   TFC(FastNewObject, FastNewObject, 1)                                         \
   TFS(HasProperty, kKey, kObject)                                              \
@@ -110,6 +111,8 @@ namespace internal {
   TFC(FastCloneShallowArrayTrack, FastCloneShallowArray, 1)                    \
   TFC(FastCloneShallowArrayDontTrack, FastCloneShallowArray, 1)                \
   TFC(FastCloneShallowObject, FastCloneShallowObject, 1)                       \
+  TFC(FastCloneDeepArray, FastCloneShallowArray, 1)                            \
+  TFC(FastCloneDeepObject, FastCloneShallowObject, 1)                          \
                                                                                \
   /* Apply and entries */                                                      \
   ASM(JSEntryTrampoline)                                                       \
@@ -250,9 +253,12 @@ namespace internal {
   TFH(LoadIC_FunctionPrototype, HANDLER, Code::LOAD_IC, LoadWithVector)        \
   ASM(LoadIC_Getter_ForDeopt)                                                  \
   TFH(LoadIC_Miss, BUILTIN, kNoExtraICState, LoadWithVector)                   \
+  TFH(LoadIC_Proxy, HANDLER, Code::LOAD_IC, LoadWithVector)                    \
   TFH(LoadIC_Slow, HANDLER, Code::LOAD_IC, LoadWithVector)                     \
   TFH(LoadIC_Uninitialized, BUILTIN, kNoExtraICState, LoadWithVector)          \
   TFH(StoreIC_Miss, BUILTIN, kNoExtraICState, StoreWithVector)                 \
+  TFH(StoreIC_Proxy, HANDLER, Code::STORE_IC, StoreWithVector)                 \
+  TFH(StoreICStrict_Proxy, HANDLER, Code::STORE_IC, StoreWithVector)           \
   ASM(StoreIC_Setter_ForDeopt)                                                 \
   TFH(StoreIC_Uninitialized, BUILTIN, kNoExtraICState, StoreWithVector)        \
   TFH(StoreICStrict_Uninitialized, BUILTIN, kNoExtraICState, StoreWithVector)  \
@@ -294,6 +300,7 @@ namespace internal {
   TFJ(FastArrayShift, SharedFunctionInfo::kDontAdaptArgumentsSentinel)         \
   /* ES6 #sec-array.prototype.slice */                                         \
   CPP(ArraySlice)                                                              \
+  TFJ(FastArraySlice, SharedFunctionInfo::kDontAdaptArgumentsSentinel)         \
   /* ES6 #sec-array.prototype.splice */                                        \
   CPP(ArraySplice)                                                             \
   /* ES6 #sec-array.prototype.unshift */                                       \
@@ -313,18 +320,34 @@ namespace internal {
   /* ES6 #sec-array.prototype.some */                                          \
   TFS(ArraySomeLoopContinuation, kReceiver, kCallbackFn, kThisArg, kArray,     \
       kObject, kInitialK, kLength, kTo)                                        \
+  TFJ(ArraySomeLoopEagerDeoptContinuation, 4, kCallbackFn, kThisArg,           \
+      kInitialK, kLength)                                                      \
+  TFJ(ArraySomeLoopLazyDeoptContinuation, 5, kCallbackFn, kThisArg, kInitialK, \
+      kLength, kResult)                                                        \
   TFJ(ArraySome, SharedFunctionInfo::kDontAdaptArgumentsSentinel)              \
   /* ES6 #sec-array.prototype.filter */                                        \
   TFS(ArrayFilterLoopContinuation, kReceiver, kCallbackFn, kThisArg, kArray,   \
       kObject, kInitialK, kLength, kTo)                                        \
+  TFJ(ArrayFilterLoopEagerDeoptContinuation, 6, kCallbackFn, kThisArg,         \
+      kArray, kInitialK, kLength, kTo)                                         \
+  TFJ(ArrayFilterLoopLazyDeoptContinuation, 8, kCallbackFn, kThisArg, kArray,  \
+      kInitialK, kLength, kValueK, kTo, kResult)                               \
   TFJ(ArrayFilter, SharedFunctionInfo::kDontAdaptArgumentsSentinel)            \
   /* ES6 #sec-array.prototype.foreach */                                       \
   TFS(ArrayMapLoopContinuation, kReceiver, kCallbackFn, kThisArg, kArray,      \
       kObject, kInitialK, kLength, kTo)                                        \
+  TFJ(ArrayMapLoopEagerDeoptContinuation, 5, kCallbackFn, kThisArg, kArray,    \
+      kInitialK, kLength)                                                      \
+  TFJ(ArrayMapLoopLazyDeoptContinuation, 6, kCallbackFn, kThisArg, kArray,     \
+      kInitialK, kLength, kResult)                                             \
   TFJ(ArrayMap, SharedFunctionInfo::kDontAdaptArgumentsSentinel)               \
   /* ES6 #sec-array.prototype.reduce */                                        \
   TFS(ArrayReduceLoopContinuation, kReceiver, kCallbackFn, kThisArg,           \
       kAccumulator, kObject, kInitialK, kLength, kTo)                          \
+  TFJ(ArrayReduceLoopEagerDeoptContinuation, 4, kCallbackFn, kInitialK,        \
+      kLength, kAccumulator)                                                   \
+  TFJ(ArrayReduceLoopLazyDeoptContinuation, 4, kCallbackFn, kInitialK,         \
+      kLength, kResult)                                                        \
   TFJ(ArrayReduce, SharedFunctionInfo::kDontAdaptArgumentsSentinel)            \
   /* ES6 #sec-array.prototype.reduceRight */                                   \
   TFS(ArrayReduceRightLoopContinuation, kReceiver, kCallbackFn, kThisArg,      \
@@ -709,6 +732,7 @@ namespace internal {
   CPP(ObjectDefineProperty)                                                    \
   CPP(ObjectDefineSetter)                                                      \
   CPP(ObjectEntries)                                                           \
+  TFJ(FastObjectEntries, SharedFunctionInfo::kDontAdaptArgumentsSentinel)      \
   CPP(ObjectFreeze)                                                            \
   CPP(ObjectGetOwnPropertyDescriptor)                                          \
   CPP(ObjectGetOwnPropertyDescriptors)                                         \
@@ -736,6 +760,7 @@ namespace internal {
   CPP(ObjectPrototypeSetProto)                                                 \
   CPP(ObjectSeal)                                                              \
   CPP(ObjectValues)                                                            \
+  TFJ(FastObjectValues, SharedFunctionInfo::kDontAdaptArgumentsSentinel)       \
                                                                                \
   /* instanceof */                                                             \
   TFC(OrdinaryHasInstance, Compare, 1)                                         \
@@ -769,6 +794,7 @@ namespace internal {
   TFS(PromiseHandleReject, kPromise, kOnReject, kException)                    \
   TFJ(PromiseHandle, 5, kValue, kHandler, kDeferredPromise,                    \
       kDeferredOnResolve, kDeferredOnReject)                                   \
+  TFJ(RunPromiseReactionJobs, 3, kQueue, kStart, kEnd)                         \
   /* ES #sec-promise.resolve */                                                \
   TFJ(PromiseResolve, 1, kValue)                                               \
   /* ES #sec-promise.reject */                                                 \
@@ -785,6 +811,10 @@ namespace internal {
   /* Proxy */                                                                  \
   CPP(ProxyConstructor)                                                        \
   CPP(ProxyConstructor_ConstructStub)                                          \
+  TFS(ProxyGetProperty, kProxy, kName)                                         \
+  TFS(ProxySetProperty, kProxy, kName, kValue, kLanguageMode)                  \
+  TFS(ProxyHasProperty, kProxy, kName)                                         \
+  TFS(ProxyDeleteProperty, kProxy, kName, kLanguageMode)                       \
                                                                                \
   /* Reflect */                                                                \
   ASM(ReflectApply)                                                            \
@@ -880,6 +910,7 @@ namespace internal {
   TFJ(AtomicsXor, 3, kArray, kIndex, kValue)                                   \
   CPP(AtomicsIsLockFree)                                                       \
   CPP(AtomicsWait)                                                             \
+  CPP(AtomicsWaitAsync)                                                        \
   CPP(AtomicsWake)                                                             \
                                                                                \
   /* String */                                                                 \
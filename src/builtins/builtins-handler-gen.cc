@@ -146,6 +146,14 @@ TF_BUILTIN(LoadIC_Miss, CodeStubAssembler) {
   TailCallRuntime(Runtime::kLoadIC_Miss, context, receiver, name, slot, vector);
 }
 
+TF_BUILTIN(LoadIC_Proxy, CodeStubAssembler) {
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* name = Parameter(Descriptor::kName);
+  Node* context = Parameter(Descriptor::kContext);
+
+  TailCallBuiltin(Builtins::kProxyGetProperty, context, receiver, name);
+}
+
 TF_BUILTIN(LoadIC_Slow, CodeStubAssembler) {
   Node* receiver = Parameter(Descriptor::kReceiver);
   Node* name = Parameter(Descriptor::kName);
@@ -166,6 +174,26 @@ TF_BUILTIN(StoreIC_Miss, CodeStubAssembler) {
                   receiver, name);
 }
 
+TF_BUILTIN(StoreIC_Proxy, CodeStubAssembler) {
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* name = Parameter(Descriptor::kName);
+  Node* value = Parameter(Descriptor::kValue);
+  Node* context = Parameter(Descriptor::kContext);
+
+  TailCallBuiltin(Builtins::kProxySetProperty, context, receiver, name, value,
+                  SmiConstant(SLOPPY));
+}
+
+TF_BUILTIN(StoreICStrict_Proxy, CodeStubAssembler) {
+  Node* receiver = Parameter(Descriptor::kReceiver);
+  Node* name = Parameter(Descriptor::kName);
+  Node* value = Parameter(Descriptor::kValue);
+  Node* context = Parameter(Descriptor::kContext);
+
+  TailCallBuiltin(Builtins::kProxySetProperty, context, receiver, name, value,
+                  SmiConstant(STRICT));
+}
+
 void Builtins::Generate_StoreIC_Setter_ForDeopt(MacroAssembler* masm) {
   NamedStoreHandlerCompiler::GenerateStoreViaSetterForDeopt(masm);
 }
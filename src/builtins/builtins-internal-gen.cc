@@ -221,17 +221,30 @@ TF_BUILTIN(DeleteProperty, DeletePropertyBaseAssembler) {
   VARIABLE(var_index, MachineType::PointerRepresentation());
   VARIABLE(var_unique, MachineRepresentation::kTagged, key);
   Label if_index(this), if_unique_name(this), if_notunique(this),
-      if_notfound(this), slow(this);
+      if_notfound(this), if_proxy(this, Label::kDeferred), slow(this);
 
   GotoIf(TaggedIsSmi(receiver), &slow);
   Node* receiver_map = LoadMap(receiver);
   Node* instance_type = LoadMapInstanceType(receiver_map);
+  GotoIf(InstanceTypeEqual(instance_type, JS_PROXY_TYPE), &if_proxy);
   GotoIf(Int32LessThanOrEqual(instance_type,
                               Int32Constant(LAST_CUSTOM_ELEMENTS_RECEIVER)),
          &slow);
   TryToName(key, &if_index, &var_index, &if_unique_name, &var_unique, &slow,
             &if_notunique);
 
+  BIND(&if_proxy);
+  {
+    // Call the deleteProperty trap directly for unique names.
+    Label if_proxy_name(this);
+    TryToName(key, &slow, &var_index, &if_proxy_name, &var_unique, &slow);
+
+    BIND(&if_proxy_name);
+    GotoIf(IsPrivateSymbol(var_unique.value()), &slow);
+    TailCallBuiltin(Builtins::kProxyDeleteProperty, context, receiver,
+                    var_unique.value(), language_mode);
+  }
+
   BIND(&if_index);
   {
     Comment("integer index");
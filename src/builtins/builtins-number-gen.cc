@@ -224,7 +224,13 @@ TF_BUILTIN(NumberParseFloat, CodeStubAssembler) {
 
         BIND(&if_inputnotcached);
         {
+          // Try to parse a short decimal {input} inline.
+          Label if_slow(this, Label::kDeferred);
+          const bool allow_fraction = true;
+          Return(TryStringToNumberFast(input, allow_fraction, &if_slow));
+
           // Need to fall back to the runtime to convert {input} to double.
+          BIND(&if_slow);
           Return(CallRuntime(Runtime::kStringParseFloat, context, input));
         }
       }
@@ -321,15 +327,21 @@ TF_BUILTIN(NumberParseInt, CodeStubAssembler) {
     BIND(&if_inputisstring);
     {
       // Check if the String {input} has a cached array index.
+      Label if_inputnotcached(this);
       Node* input_hash = LoadNameHashField(input);
       GotoIf(IsSetWord32(input_hash, Name::kDoesNotContainCachedArrayIndexMask),
-             &if_generic);
+             &if_inputnotcached);
 
       // Return the cached array index as result.
       Node* input_index =
           DecodeWordFromWord32<String::ArrayIndexValueBits>(input_hash);
       Node* result = SmiTag(input_index);
       Return(result);
+
+      // Try to parse a short decimal integer {input} inline.
+      BIND(&if_inputnotcached);
+      const bool allow_fraction = false;
+      Return(TryStringToNumberFast(input, allow_fraction, &if_generic));
     }
   }
 
@@ -22,6 +22,10 @@ class ObjectBuiltinsAssembler : public CodeStubAssembler {
  protected:
   void IsString(Node* object, Label* if_string, Label* if_notstring);
   void ReturnToStringFormat(Node* context, Node* string);
+
+  // Implements Object.values and Object.entries for objects whose enum cache
+  // records field indices, falls back to the |slow| C++ builtin otherwise.
+  void GetOwnValuesOrEntries(bool get_entries, Builtins::Name slow);
 };
 
 void ObjectBuiltinsAssembler::IsString(Node* object, Label* if_string,
@@ -49,6 +53,118 @@ void ObjectBuiltinsAssembler::ReturnToStringFormat(Node* context,
                   rhs));
 }
 
+void ObjectBuiltinsAssembler::GetOwnValuesOrEntries(bool get_entries,
+                                                    Builtins::Name slow) {
+  Node* argc = Parameter(BuiltinDescriptor::kArgumentsCount);
+  Node* context = Parameter(BuiltinDescriptor::kContext);
+  CodeStubArguments args(this, ChangeInt32ToIntPtr(argc));
+  Node* object = args.GetOptionalArgumentValue(0);
+
+  Label if_slow(this, Label::kDeferred);
+
+  // Check if the {object} has a usable enum cache with field indices, which
+  // exists only if all enumerable own properties are data fields.
+  GotoIf(TaggedIsSmi(object), &if_slow);
+  Node* object_map = LoadMap(object);
+  Node* object_enum_length =
+      DecodeWordFromWord32<Map::EnumLengthBits>(LoadMapBitField3(object_map));
+  GotoIf(
+      WordEqual(object_enum_length, IntPtrConstant(kInvalidEnumCacheSentinel)),
+      &if_slow);
+  CSA_ASSERT(this, IsJSObjectMap(object_map));
+  GotoIfNot(IsEmptyFixedArray(LoadElements(object)), &if_slow);
+
+  Node* native_context = LoadNativeContext(context);
+  Node* array_map = LoadJSArrayElementsMap(FAST_ELEMENTS, native_context);
+  Label if_empty(this);
+  GotoIf(WordEqual(object_enum_length, IntPtrConstant(0)), &if_empty);
+
+  Node* object_enum_cache_bridge =
+      LoadObjectField(LoadMapDescriptors(object_map),
+                      DescriptorArray::kEnumCacheBridgeOffset);
+  Node* object_enum_cache = LoadFixedArrayElement(
+      object_enum_cache_bridge, DescriptorArray::kEnumCacheBridgeCacheIndex);
+  Node* object_enum_indices =
+      LoadFixedArrayElement(object_enum_cache_bridge,
+                            DescriptorArray::kEnumCacheBridgeIndicesCacheIndex);
+  GotoIf(TaggedIsSmi(object_enum_indices), &if_slow);
+
+  // Mutable double boxes have to be copied, leave them to the runtime. The
+  // encoding of the indices is described in FieldIndex::GetLoadByFieldIndex.
+  BuildFastLoop(IntPtrConstant(0), object_enum_length,
+                [&](Node* index) {
+                  Node* field_index = SmiUntag(
+                      LoadFixedArrayElement(object_enum_indices, index));
+                  GotoIf(WordNotEqual(WordAnd(field_index, IntPtrConstant(1)),
+                                      IntPtrConstant(0)),
+                         &if_slow);
+                },
+                1, ParameterMode::INTPTR_PARAMETERS, IndexAdvanceMode::kPost);
+
+  Node* array = AllocateJSArray(FAST_ELEMENTS, array_map, object_enum_length,
+                                SmiTag(object_enum_length));
+  Node* elements = LoadElements(array);
+  Node* properties = LoadProperties(object);
+  BuildFastLoop(
+      IntPtrConstant(0), object_enum_length,
+      [&](Node* index) {
+        Node* field_index =
+            WordSar(SmiUntag(LoadFixedArrayElement(object_enum_indices, index)),
+                    IntPtrConstant(1));
+        VARIABLE(var_value, MachineRepresentation::kTagged);
+        Label if_inobject(this), if_backing_store(this), done(this, &var_value);
+        Branch(IntPtrLessThan(field_index, IntPtrConstant(0)),
+               &if_backing_store, &if_inobject);
+
+        BIND(&if_inobject);
+        var_value.Bind(LoadObjectField(
+            object, IntPtrAdd(TimesPointerSize(field_index),
+                              IntPtrConstant(JSObject::kHeaderSize))));
+        Goto(&done);
+
+        BIND(&if_backing_store);
+        var_value.Bind(LoadFixedArrayElement(
+            properties, IntPtrSub(IntPtrConstant(-1), field_index)));
+        Goto(&done);
+
+        BIND(&done);
+        Node* value = var_value.value();
+        if (get_entries) {
+          Node* entry = AllocateJSArray(FAST_ELEMENTS, array_map,
+                                        IntPtrConstant(2), SmiConstant(2));
+          Node* entry_elements = LoadElements(entry);
+          Node* key = LoadFixedArrayElement(object_enum_cache, index);
+          StoreFixedArrayElement(entry_elements, 0, key, SKIP_WRITE_BARRIER);
+          StoreFixedArrayElement(entry_elements, 1, value, SKIP_WRITE_BARRIER);
+          value = entry;
+        }
+        StoreFixedArrayElement(elements, index, value);
+      },
+      1, ParameterMode::INTPTR_PARAMETERS, IndexAdvanceMode::kPost);
+  args.PopAndReturn(array);
+
+  BIND(&if_empty);
+  args.PopAndReturn(AllocateJSArray(FAST_ELEMENTS, array_map,
+                                    IntPtrConstant(0), SmiConstant(0)));
+
+  BIND(&if_slow);
+  {
+    Node* target = LoadFromFrame(StandardFrameConstants::kFunctionOffset,
+                                 MachineType::TaggedPointer());
+    Callable callable(isolate()->builtins()->builtin_handle(slow),
+                      BuiltinDescriptor(isolate()));
+    TailCallStub(callable, context, target, UndefinedConstant(), argc);
+  }
+}
+
+TF_BUILTIN(FastObjectEntries, ObjectBuiltinsAssembler) {
+  GetOwnValuesOrEntries(true, Builtins::kObjectEntries);
+}
+
+TF_BUILTIN(FastObjectValues, ObjectBuiltinsAssembler) {
+  GetOwnValuesOrEntries(false, Builtins::kObjectValues);
+}
+
 TF_BUILTIN(ObjectHasOwnProperty, ObjectBuiltinsAssembler) {
   Node* object = Parameter(Descriptor::kReceiver);
   Node* key = Parameter(Descriptor::kKey);
@@ -524,7 +640,31 @@ TF_BUILTIN(HasProperty, ObjectBuiltinsAssembler) {
   Node* object = Parameter(Descriptor::kObject);
   Node* context = Parameter(Descriptor::kContext);
 
+  Label if_proxy(this, Label::kDeferred), if_not_proxy(this);
+  GotoIf(TaggedIsSmi(object), &if_not_proxy);
+  Branch(HasInstanceType(object, JS_PROXY_TYPE), &if_proxy, &if_not_proxy);
+
+  BIND(&if_not_proxy);
   Return(HasProperty(object, key, context, Runtime::kHasProperty));
+
+  BIND(&if_proxy);
+  {
+    // Call the has trap directly for unique names. Indices, keys that still
+    // need conversion and private symbols take the runtime path.
+    VARIABLE(var_index, MachineType::PointerRepresentation());
+    VARIABLE(var_unique, MachineRepresentation::kTagged);
+    Label if_unique_name(this), if_runtime(this);
+    TryToName(key, &if_runtime, &var_index, &if_unique_name, &var_unique,
+              &if_runtime);
+
+    BIND(&if_unique_name);
+    GotoIf(IsPrivateSymbol(var_unique.value()), &if_runtime);
+    TailCallBuiltin(Builtins::kProxyHasProperty, context, object,
+                    var_unique.value());
+
+    BIND(&if_runtime);
+    TailCallRuntime(Runtime::kHasProperty, context, object, key);
+  }
 }
 
 TF_BUILTIN(InstanceOf, ObjectBuiltinsAssembler) {
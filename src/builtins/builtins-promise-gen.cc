@@ -1356,6 +1356,63 @@ TF_BUILTIN(PromiseHandle, PromiseBuiltinsAssembler) {
   }
 }
 
+// Runs the microtasks in {queue} from {start} up to {end} by calling
+// PromiseHandle for each of them, so that a sequence of promise reactions
+// does not return to C++ between jobs. Stops at the first microtask that is
+// not a PromiseReactionJobInfo with a single reaction from this native
+// context, and returns its index. The slot of each job is cleared before the
+// job runs, which lets the caller find where to continue if a job throws.
+TF_BUILTIN(RunPromiseReactionJobs, PromiseBuiltinsAssembler) {
+  Node* const queue = Parameter(Descriptor::kQueue);
+  Node* const start = Parameter(Descriptor::kStart);
+  Node* const end = Parameter(Descriptor::kEnd);
+  Node* const context = Parameter(Descriptor::kContext);
+
+  Node* const native_context = LoadNativeContext(context);
+  Node* const promise_handle =
+      LoadContextElement(native_context, Context::PROMISE_HANDLE_INDEX);
+  Callable call_callable = CodeFactory::Call(isolate());
+
+  VARIABLE(var_index, MachineType::PointerRepresentation(), SmiUntag(start));
+  Label loop(this, &var_index), done(this);
+  Goto(&loop);
+  BIND(&loop);
+  {
+    Node* const index = var_index.value();
+    GotoIfNot(IntPtrLessThan(index, SmiUntag(end)), &done);
+
+    Node* const info = LoadFixedArrayElement(queue, index);
+    GotoIfNot(HasInstanceType(info, PROMISE_REACTION_JOB_INFO_TYPE), &done);
+    Node* const info_context =
+        LoadObjectField(info, PromiseReactionJobInfo::kContextOffset);
+    GotoIfNot(WordEqual(LoadNativeContext(info_context), native_context),
+              &done);
+    Node* const deferred_promise =
+        LoadObjectField(info, PromiseReactionJobInfo::kDeferredPromiseOffset);
+    GotoIf(IsFixedArray(deferred_promise), &done);
+
+    Node* const value =
+        LoadObjectField(info, PromiseReactionJobInfo::kValueOffset);
+    Node* const tasks =
+        LoadObjectField(info, PromiseReactionJobInfo::kTasksOffset);
+    Node* const deferred_on_resolve =
+        LoadObjectField(info, PromiseReactionJobInfo::kDeferredOnResolveOffset);
+    Node* const deferred_on_reject =
+        LoadObjectField(info, PromiseReactionJobInfo::kDeferredOnRejectOffset);
+
+    StoreFixedArrayElement(queue, index, UndefinedConstant());
+    CallJS(call_callable, info_context, promise_handle, UndefinedConstant(),
+           value, tasks, deferred_promise, deferred_on_resolve,
+           deferred_on_reject);
+
+    var_index.Bind(IntPtrAdd(index, IntPtrConstant(1)));
+    Goto(&loop);
+  }
+
+  BIND(&done);
+  Return(SmiTag(var_index.value()));
+}
+
 // ES#sec-promise.prototype.catch
 // Promise.prototype.catch ( onRejected )
 TF_BUILTIN(PromiseCatch, PromiseBuiltinsAssembler) {
@@ -0,0 +1,311 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/builtins/builtins-utils-gen.h"
+#include "src/builtins/builtins.h"
+#include "src/code-factory.h"
+#include "src/code-stub-assembler.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+using compiler::Node;
+
+class ProxiesCodeStubAssembler : public CodeStubAssembler {
+ public:
+  explicit ProxiesCodeStubAssembler(compiler::CodeAssemblerState* state)
+      : CodeStubAssembler(state) {}
+
+ protected:
+  // Loads the [[ProxyHandler]] of {proxy} and throws a TypeError mentioning
+  // {trap_name} if the proxy has been revoked.
+  Node* LoadProxyHandler(Node* context, Node* proxy,
+                         Handle<String> trap_name) {
+    Label if_revoked(this, Label::kDeferred), if_not_revoked(this);
+    Node* handler = LoadObjectField(proxy, JSProxy::kHandlerOffset);
+    Branch(IsJSReceiver(handler), &if_not_revoked, &if_revoked);
+
+    BIND(&if_revoked);
+    {
+      CallRuntime(Runtime::kThrowTypeError, context,
+                  SmiConstant(MessageTemplate::kProxyRevoked),
+                  HeapConstant(trap_name));
+      Unreachable();
+    }
+
+    BIND(&if_not_revoked);
+    return handler;
+  }
+
+  // Implements GetMethod(handler, trap_name). Jumps to {if_undefined} if the
+  // trap is undefined or null and throws if it is not callable.
+  Node* GetTrap(Node* context, Node* handler, Handle<String> trap_name,
+                Label* if_undefined) {
+    Label if_not_callable(this, Label::kDeferred), if_callable(this);
+    Node* trap = GetProperty(context, handler, trap_name);
+    GotoIf(IsUndefined(trap), if_undefined);
+    GotoIf(IsNull(trap), if_undefined);
+    GotoIf(TaggedIsSmi(trap), &if_not_callable);
+    Branch(IsCallable(trap), &if_callable, &if_not_callable);
+
+    BIND(&if_not_callable);
+    {
+      CallRuntime(Runtime::kThrowTypeError, context,
+                  SmiConstant(MessageTemplate::kPropertyNotFunction), trap,
+                  HeapConstant(trap_name), handler);
+      Unreachable();
+    }
+
+    BIND(&if_callable);
+    return trap;
+  }
+
+  // The trap invariants only constrain properties that are non-configurable
+  // on the target. Checks inline whether {target} has an own property called
+  // {name}, and jumps to {if_needs_check} whenever the answer requires the
+  // full property descriptor, which is left to the runtime.
+  void LookupTargetProperty(Node* target, Node* name, Label* if_absent,
+                            Label* if_configurable, Label* if_needs_check) {
+    Node* map = LoadMap(target);
+    GotoIf(IsSpecialReceiverMap(map), if_needs_check);
+    Node* instance_type = LoadMapInstanceType(map);
+
+    VARIABLE(var_meta_storage, MachineRepresentation::kTagged);
+    VARIABLE(var_name_index, MachineType::PointerRepresentation());
+    Label if_found_fast(this), if_found_dict(this);
+    TryLookupProperty(target, map, instance_type, name, &if_found_fast,
+                      &if_found_dict, if_needs_check, &var_meta_storage,
+                      &var_name_index, if_absent, if_needs_check);
+
+    BIND(&if_found_fast);
+    {
+      Node* details = LoadDetailsByKeyIndex<DescriptorArray>(
+          var_meta_storage.value(), var_name_index.value());
+      Branch(IsSetWord32(details, PropertyDetails::kAttributesDontDeleteMask),
+             if_needs_check, if_configurable);
+    }
+
+    BIND(&if_found_dict);
+    {
+      Node* details = LoadDetailsByKeyIndex<NameDictionary>(
+          var_meta_storage.value(), var_name_index.value());
+      Branch(IsSetWord32(details, PropertyDetails::kAttributesDontDeleteMask),
+             if_needs_check, if_configurable);
+    }
+  }
+
+  void ThrowIfStrict(Node* context, Node* language_mode,
+                     Handle<String> trap_name, Node* name) {
+    Label if_sloppy(this);
+    STATIC_ASSERT(LANGUAGE_END == 2);
+    GotoIf(SmiEqual(language_mode, SmiConstant(SLOPPY)), &if_sloppy);
+    CallRuntime(Runtime::kThrowTypeError, context,
+                SmiConstant(MessageTemplate::kProxyTrapReturnedFalsishFor),
+                HeapConstant(trap_name), name);
+    Unreachable();
+    BIND(&if_sloppy);
+  }
+};
+
+// ES6 section 9.5.8 [[Get]] (P, Receiver), with the proxy as the receiver.
+TF_BUILTIN(ProxyGetProperty, ProxiesCodeStubAssembler) {
+  Node* proxy = Parameter(Descriptor::kProxy);
+  Node* name = Parameter(Descriptor::kName);
+  Node* context = Parameter(Descriptor::kContext);
+
+  CSA_ASSERT(this, HasInstanceType(proxy, JS_PROXY_TYPE));
+  CSA_ASSERT(this, IsName(name));
+  CSA_ASSERT(this, Word32BinaryNot(IsPrivateSymbol(name)));
+
+  Handle<String> trap_name = factory()->get_string();
+  Label trap_undefined(this, Label::kDeferred);
+
+  // 2.-4. Let handler be O.[[ProxyHandler]], throw if it is null.
+  Node* handler = LoadProxyHandler(context, proxy, trap_name);
+  // 5. Let target be O.[[ProxyTarget]].
+  Node* target = LoadObjectField(proxy, JSProxy::kTargetOffset);
+  // 6. Let trap be ? GetMethod(handler, "get").
+  Node* trap = GetTrap(context, handler, trap_name, &trap_undefined);
+  // 8. Let trapResult be ? Call(trap, handler, «target, P, Receiver»).
+  Node* trap_result = CallJS(CodeFactory::Call(isolate()), context, trap,
+                             handler, target, name, proxy);
+
+  // 9.-10. Enforce the invariants for non-configurable target properties.
+  Label return_result(this), check_in_runtime(this, Label::kDeferred);
+  LookupTargetProperty(target, name, &return_result, &return_result,
+                       &check_in_runtime);
+
+  BIND(&check_in_runtime);
+  {
+    CallRuntime(Runtime::kCheckProxyGetSetTrapResult, context, name, target,
+                trap_result, SmiConstant(JSProxy::kGet));
+    Goto(&return_result);
+  }
+
+  // 11. Return trapResult.
+  BIND(&return_result);
+  Return(trap_result);
+
+  // 7.a. Return ? target.[[Get]](P, Receiver).
+  BIND(&trap_undefined);
+  TailCallRuntime(Runtime::kGetPropertyWithReceiver, context, target, name,
+                  proxy);
+}
+
+// ES6 section 9.5.9 [[Set]] (P, V, Receiver), with the proxy as the receiver.
+// Returns {value}, like a store IC would.
+TF_BUILTIN(ProxySetProperty, ProxiesCodeStubAssembler) {
+  Node* proxy = Parameter(Descriptor::kProxy);
+  Node* name = Parameter(Descriptor::kName);
+  Node* value = Parameter(Descriptor::kValue);
+  Node* language_mode = Parameter(Descriptor::kLanguageMode);
+  Node* context = Parameter(Descriptor::kContext);
+
+  CSA_ASSERT(this, HasInstanceType(proxy, JS_PROXY_TYPE));
+  CSA_ASSERT(this, IsName(name));
+  CSA_ASSERT(this, Word32BinaryNot(IsPrivateSymbol(name)));
+
+  Handle<String> trap_name = factory()->set_string();
+  Label trap_undefined(this, Label::kDeferred),
+      trap_returned_falsish(this, Label::kDeferred), check_invariants(this);
+
+  Node* handler = LoadProxyHandler(context, proxy, trap_name);
+  Node* target = LoadObjectField(proxy, JSProxy::kTargetOffset);
+  Node* trap = GetTrap(context, handler, trap_name, &trap_undefined);
+  Node* trap_result = CallJS(CodeFactory::Call(isolate()), context, trap,
+                             handler, target, name, value, proxy);
+  BranchIfToBooleanIsTrue(trap_result, &check_invariants,
+                          &trap_returned_falsish);
+
+  BIND(&check_invariants);
+  {
+    Label return_value(this), check_in_runtime(this, Label::kDeferred);
+    LookupTargetProperty(target, name, &return_value, &return_value,
+                         &check_in_runtime);
+
+    BIND(&check_in_runtime);
+    {
+      CallRuntime(Runtime::kCheckProxyGetSetTrapResult, context, name, target,
+                  value, SmiConstant(JSProxy::kSet));
+      Goto(&return_value);
+    }
+
+    BIND(&return_value);
+    Return(value);
+  }
+
+  BIND(&trap_returned_falsish);
+  {
+    ThrowIfStrict(context, language_mode, trap_name, name);
+    Return(value);
+  }
+
+  BIND(&trap_undefined);
+  {
+    CallRuntime(Runtime::kSetPropertyWithReceiver, context, target, name,
+                value, proxy, language_mode);
+    Return(value);
+  }
+}
+
+// ES6 section 9.5.7 [[HasProperty]] (P)
+TF_BUILTIN(ProxyHasProperty, ProxiesCodeStubAssembler) {
+  Node* proxy = Parameter(Descriptor::kProxy);
+  Node* name = Parameter(Descriptor::kName);
+  Node* context = Parameter(Descriptor::kContext);
+
+  CSA_ASSERT(this, HasInstanceType(proxy, JS_PROXY_TYPE));
+  CSA_ASSERT(this, IsName(name));
+  CSA_ASSERT(this, Word32BinaryNot(IsPrivateSymbol(name)));
+
+  Handle<String> trap_name = factory()->has_string();
+  Label trap_undefined(this, Label::kDeferred), return_true(this),
+      trap_returned_false(this);
+
+  Node* handler = LoadProxyHandler(context, proxy, trap_name);
+  Node* target = LoadObjectField(proxy, JSProxy::kTargetOffset);
+  Node* trap = GetTrap(context, handler, trap_name, &trap_undefined);
+  Node* trap_result = CallJS(CodeFactory::Call(isolate()), context, trap,
+                             handler, target, name);
+  BranchIfToBooleanIsTrue(trap_result, &return_true, &trap_returned_false);
+
+  BIND(&return_true);
+  Return(TrueConstant());
+
+  // 9. If booleanTrapResult is false, then the target must neither have the
+  // property as non-configurable nor be non-extensible while having it.
+  BIND(&trap_returned_false);
+  {
+    Label return_false(this), check_in_runtime(this, Label::kDeferred);
+    LookupTargetProperty(target, name, &return_false, &check_in_runtime,
+                         &check_in_runtime);
+
+    BIND(&check_in_runtime);
+    {
+      CallRuntime(Runtime::kCheckProxyHasTrap, context, name, target);
+      Goto(&return_false);
+    }
+
+    BIND(&return_false);
+    Return(FalseConstant());
+  }
+
+  // 7.a. Return ? target.[[HasProperty]](P).
+  BIND(&trap_undefined);
+  TailCallBuiltin(Builtins::kHasProperty, context, name, target);
+}
+
+// ES6 section 9.5.10 [[Delete]] (P)
+TF_BUILTIN(ProxyDeleteProperty, ProxiesCodeStubAssembler) {
+  Node* proxy = Parameter(Descriptor::kProxy);
+  Node* name = Parameter(Descriptor::kName);
+  Node* language_mode = Parameter(Descriptor::kLanguageMode);
+  Node* context = Parameter(Descriptor::kContext);
+
+  CSA_ASSERT(this, HasInstanceType(proxy, JS_PROXY_TYPE));
+  CSA_ASSERT(this, IsName(name));
+  CSA_ASSERT(this, Word32BinaryNot(IsPrivateSymbol(name)));
+
+  Handle<String> trap_name = factory()->deleteProperty_string();
+  Label trap_undefined(this, Label::kDeferred),
+      trap_returned_falsish(this, Label::kDeferred), check_invariants(this);
+
+  Node* handler = LoadProxyHandler(context, proxy, trap_name);
+  Node* target = LoadObjectField(proxy, JSProxy::kTargetOffset);
+  Node* trap = GetTrap(context, handler, trap_name, &trap_undefined);
+  Node* trap_result = CallJS(CodeFactory::Call(isolate()), context, trap,
+                             handler, target, name);
+  BranchIfToBooleanIsTrue(trap_result, &check_invariants,
+                          &trap_returned_falsish);
+
+  BIND(&check_invariants);
+  {
+    Label return_true(this), check_in_runtime(this, Label::kDeferred);
+    LookupTargetProperty(target, name, &return_true, &return_true,
+                         &check_in_runtime);
+
+    BIND(&check_in_runtime);
+    {
+      CallRuntime(Runtime::kCheckProxyDeleteTrap, context, name, target);
+      Goto(&return_true);
+    }
+
+    BIND(&return_true);
+    Return(TrueConstant());
+  }
+
+  BIND(&trap_returned_falsish);
+  {
+    ThrowIfStrict(context, language_mode, trap_name, name);
+    Return(FalseConstant());
+  }
+
+  BIND(&trap_undefined);
+  TailCallBuiltin(Builtins::kDeleteProperty, context, target, name,
+                  language_mode);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -10,6 +10,7 @@
 #include "src/code-factory.h"
 #include "src/code-stub-assembler.h"
 #include "src/objects/regexp-match-info.h"
+#include "src/regexp/jsregexp.h"
 #include "src/regexp/regexp-macro-assembler.h"
 
 namespace v8 {
@@ -322,6 +323,15 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
                capture_count,
                SmiConstant(Isolate::kJSRegexpStaticOffsetsVectorSize / 2 - 1)),
            &runtime);
+
+    // The runtime searches long subjects for the prefilter literal first.
+    Node* const prefilter =
+        LoadFixedArrayElement(data, JSRegExp::kIrregexpPrefilterIndex);
+    GotoIf(Word32And(TaggedIsNotSmi(prefilter),
+                     SmiGreaterThanOrEqual(
+                         smi_string_length,
+                         SmiConstant(RegExpImpl::kPrefilterMinSubjectLength))),
+           &runtime);
   }
 
   // Ensure that a RegExp stack is allocated. This check is after branching off
@@ -382,7 +392,10 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
 
   Node* const code = var_code.value();
   GotoIf(TaggedIsSmi(code), &runtime);
-  CSA_ASSERT(this, HasInstanceType(code, CODE_TYPE));
+
+  // With --regexp-tier-up, the field may contain bytecode for the
+  // interpreter, which is run by the runtime.
+  GotoIfNot(HasInstanceType(code, CODE_TYPE), &runtime);
 
   Label if_success(this), if_exception(this, Label::kDeferred);
   {
@@ -2587,6 +2600,31 @@ Node* RegExpBuiltinsAssembler::ReplaceGlobalCallableFastPath(
   // Set last index to 0.
   FastStoreLastIndex(regexp, smi_zero);
 
+  // If {regexp} has explicit captures, they are passed to {replace_callable}.
+  // The runtime calls it directly instead of going through an arguments
+  // array per match. Regexps that have not been compiled yet go there too.
+  {
+    Label next(this), if_runtime(this);
+    Node* const data = LoadObjectField(regexp, JSRegExp::kDataOffset);
+    Node* const tag = LoadFixedArrayElement(data, JSRegExp::kTagIndex);
+    GotoIf(SmiEqual(tag, SmiConstant(JSRegExp::ATOM)), &next);
+    GotoIfNot(SmiEqual(tag, SmiConstant(JSRegExp::IRREGEXP)), &if_runtime);
+    Node* const capture_count =
+        LoadFixedArrayElement(data, JSRegExp::kIrregexpCaptureCountIndex);
+    Branch(SmiEqual(capture_count, smi_zero), &next, &if_runtime);
+
+    BIND(&if_runtime);
+    {
+      Node* const result =
+          CallRuntime(Runtime::kStringReplaceGlobalRegExpWithFunction, context,
+                      string, regexp, replace_callable);
+      var_result.Bind(result);
+      Goto(&out);
+    }
+
+    BIND(&next);
+  }
+
   // Allocate {result_array}.
   Node* result_array;
   {
@@ -2614,27 +2652,15 @@ Node* RegExpBuiltinsAssembler::ReplaceGlobalCallableFastPath(
   var_result.Bind(string);
   GotoIf(WordEqual(res, null), &out);
 
-  // Reload last match info since it might have changed.
-  last_match_info =
-      LoadContextElement(native_context, Context::REGEXP_LAST_MATCH_INFO_INDEX);
-
   Node* const res_length = LoadJSArrayLength(res);
   Node* const res_elems = LoadElements(res);
   CSA_ASSERT(this, HasInstanceType(res_elems, FIXED_ARRAY_TYPE));
 
-  Node* const num_capture_registers = LoadFixedArrayElement(
-      last_match_info, RegExpMatchInfo::kNumberOfCapturesIndex);
-
-  Label if_hasexplicitcaptures(this), if_noexplicitcaptures(this),
-      create_result(this);
-  Branch(SmiEqual(num_capture_registers, SmiConstant(Smi::FromInt(2))),
-         &if_noexplicitcaptures, &if_hasexplicitcaptures);
-
-  BIND(&if_noexplicitcaptures);
+  Label create_result(this);
   {
-    // If the number of captures is two then there are no explicit captures in
-    // the regexp, just the implicit capture that captures the whole match. In
-    // this case we can simplify quite a bit and end up with something faster.
+    // There are no explicit captures in the regexp, just the implicit capture
+    // that captures the whole match. In this case we can simplify quite a bit
+    // and end up with something faster.
     // The builder will consist of some integers that indicate slices of the
     // input string and some replacements that were returned from the replace
     // function.
@@ -2717,52 +2743,6 @@ Node* RegExpBuiltinsAssembler::ReplaceGlobalCallableFastPath(
     }
   }
 
-  BIND(&if_hasexplicitcaptures);
-  {
-    Node* const from = int_zero;
-    Node* const to = SmiUntag(res_length);
-    const int increment = 1;
-
-    BuildFastLoop(from, to,
-                  [this, res_elems, isolate, native_context, context, undefined,
-                   replace_callable](Node* index) {
-                    Node* const elem = LoadFixedArrayElement(res_elems, index);
-
-                    Label do_continue(this);
-                    GotoIf(TaggedIsSmi(elem), &do_continue);
-
-                    // elem must be an Array.
-                    // Use the apply argument as backing for global RegExp
-                    // properties.
-
-                    CSA_ASSERT(this, HasInstanceType(elem, JS_ARRAY_TYPE));
-
-                    // TODO(jgruber): Remove indirection through
-                    // Call->ReflectApply.
-                    Callable call_callable = CodeFactory::Call(isolate);
-                    Node* const reflect_apply = LoadContextElement(
-                        native_context, Context::REFLECT_APPLY_INDEX);
-
-                    Node* const replacement_obj =
-                        CallJS(call_callable, context, reflect_apply, undefined,
-                               replace_callable, undefined, elem);
-
-                    // Overwrite the i'th element in the results with the string
-                    // we got back from the callback function.
-
-                    Node* const replacement_str =
-                        ToString_Inline(context, replacement_obj);
-                    StoreFixedArrayElement(res_elems, index, replacement_str);
-
-                    Goto(&do_continue);
-                    BIND(&do_continue);
-                  },
-                  increment, CodeStubAssembler::INTPTR_PARAMETERS,
-                  CodeStubAssembler::IndexAdvanceMode::kPost);
-
-    Goto(&create_result);
-  }
-
   BIND(&create_result);
   {
     Node* const result = CallRuntime(Runtime::kStringBuilderConcat, context,
@@ -116,15 +116,11 @@ BUILTIN(AtomicsWake) {
   return FutexEmulation::Wake(isolate, array_buffer, addr, c);
 }
 
-// ES #sec-atomics.wait
-// Atomics.wait( typedArray, index, value, timeout )
-BUILTIN(AtomicsWait) {
-  HandleScope scope(isolate);
-  Handle<Object> array = args.atOrUndefined(isolate, 1);
-  Handle<Object> index = args.atOrUndefined(isolate, 2);
-  Handle<Object> value = args.atOrUndefined(isolate, 3);
-  Handle<Object> timeout = args.atOrUndefined(isolate, 4);
+namespace {
 
+Object* DoWait(Isolate* isolate, bool is_async, Handle<Object> array,
+               Handle<Object> index, Handle<Object> value,
+               Handle<Object> timeout) {
   Handle<JSTypedArray> sta;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, sta, ValidateSharedIntegerTypedArray(isolate, array, true));
@@ -150,7 +146,8 @@ BUILTIN(AtomicsWait) {
       timeout_number = 0;
   }
 
-  if (!isolate->allow_atomics_wait()) {
+  // Waiting asynchronously doesn't block, so it is allowed everywhere.
+  if (!is_async && !isolate->allow_atomics_wait()) {
     THROW_NEW_ERROR_RETURN_FAILURE(
         isolate, NewTypeError(MessageTemplate::kAtomicsWaitNotAllowed));
   }
@@ -158,9 +155,36 @@ BUILTIN(AtomicsWait) {
   Handle<JSArrayBuffer> array_buffer = sta->GetBuffer();
   size_t addr = (i << 2) + NumberToSize(sta->byte_offset());
 
+  if (is_async) {
+    return FutexEmulation::WaitAsync(isolate, array_buffer, addr, value_int32,
+                                     timeout_number);
+  }
   return FutexEmulation::Wait(isolate, array_buffer, addr, value_int32,
                               timeout_number);
 }
 
+}  // namespace
+
+// ES #sec-atomics.wait
+// Atomics.wait( typedArray, index, value, timeout )
+BUILTIN(AtomicsWait) {
+  HandleScope scope(isolate);
+  Handle<Object> array = args.atOrUndefined(isolate, 1);
+  Handle<Object> index = args.atOrUndefined(isolate, 2);
+  Handle<Object> value = args.atOrUndefined(isolate, 3);
+  Handle<Object> timeout = args.atOrUndefined(isolate, 4);
+  return DoWait(isolate, false, array, index, value, timeout);
+}
+
+// Atomics.waitAsync( typedArray, index, value, timeout )
+BUILTIN(AtomicsWaitAsync) {
+  HandleScope scope(isolate);
+  Handle<Object> array = args.atOrUndefined(isolate, 1);
+  Handle<Object> index = args.atOrUndefined(isolate, 2);
+  Handle<Object> value = args.atOrUndefined(isolate, 3);
+  Handle<Object> timeout = args.atOrUndefined(isolate, 4);
+  return DoWait(isolate, true, array, index, value, timeout);
+}
+
 }  // namespace internal
 }  // namespace v8
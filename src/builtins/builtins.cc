@@ -22,6 +22,7 @@ BUILTIN_LIST_C(FORWARD_DECLARE)
 
 Builtins::Builtins() : initialized_(false) {
   memset(builtins_, 0, sizeof(builtins_[0]) * builtin_count);
+  memset(lazy_placeholders_, 0, sizeof(lazy_placeholders_[0]) * builtin_count);
 }
 
 Builtins::~Builtins() {}
@@ -121,6 +122,12 @@ Handle<Code> Builtins::builtin_handle(Name name) {
   return Handle<Code>(reinterpret_cast<Code**>(builtin_address(name)));
 }
 
+void Builtins::set_builtin(int index, HeapObject* builtin) {
+  DCHECK(0 <= index && index < builtin_count);
+  DCHECK(builtin->IsCode());
+  builtins_[index] = builtin;
+}
+
 // static
 int Builtins::GetBuiltinParameterCount(Name name) {
   switch (name) {
@@ -169,6 +176,46 @@ Callable Builtins::CallableFor(Isolate* isolate, Name name) {
           isolate->builtins()->ArrayForEachLoopLazyDeoptContinuation();
       return Callable(code, BuiltinDescriptor(isolate));
     }
+    case kArraySomeLoopEagerDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArraySomeLoopEagerDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
+    case kArraySomeLoopLazyDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArraySomeLoopLazyDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
+    case kArrayFilterLoopEagerDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArrayFilterLoopEagerDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
+    case kArrayFilterLoopLazyDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArrayFilterLoopLazyDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
+    case kArrayMapLoopEagerDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArrayMapLoopEagerDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
+    case kArrayMapLoopLazyDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArrayMapLoopLazyDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
+    case kArrayReduceLoopEagerDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArrayReduceLoopEagerDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
+    case kArrayReduceLoopLazyDeoptContinuation: {
+      Handle<Code> code =
+          isolate->builtins()->ArrayReduceLoopLazyDeoptContinuation();
+      return Callable(code, BuiltinDescriptor(isolate));
+    }
     default:
       UNREACHABLE();
   }
@@ -274,6 +321,22 @@ bool Builtins::HasCppImplementation(int index) {
   UNREACHABLE();
 }
 
+// static
+bool Builtins::IsLazyDeserializationCandidate(int index) {
+  DCHECK(0 <= index && index < builtin_count);
+  switch (index) {
+#define CASE(Name, ...) \
+  case k##Name:         \
+    return true;
+    BUILTIN_LIST(CASE, IGNORE_BUILTIN, CASE, IGNORE_BUILTIN, IGNORE_BUILTIN,
+                 IGNORE_BUILTIN, IGNORE_BUILTIN, IGNORE_BUILTIN)
+#undef CASE
+    default:
+      return false;
+  }
+  UNREACHABLE();
+}
+
 #define DEFINE_BUILTIN_ACCESSOR(Name, ...)                                    \
   Handle<Code> Builtins::Name() {                                             \
     Code** code_address = reinterpret_cast<Code**>(builtin_address(k##Name)); \
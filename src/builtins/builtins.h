@@ -82,6 +82,20 @@ class Builtins {
 
   Handle<Code> builtin_handle(Name name);
 
+  // Used by the snapshot to install lazily deserialized builtins.
+  void set_builtin(int index, HeapObject* builtin);
+
+  // Lazily deserialized builtins are represented by a placeholder in the
+  // builtins table until their first call.
+  bool is_lazy_placeholder(int index) const {
+    DCHECK(0 <= index && index < builtin_count);
+    return lazy_placeholders_[index];
+  }
+  void set_lazy_placeholder(int index, bool value) {
+    DCHECK(0 <= index && index < builtin_count);
+    lazy_placeholders_[index] = value;
+  }
+
   static int GetBuiltinParameterCount(Name name);
 
   V8_EXPORT_PRIVATE static Callable CallableFor(Isolate* isolate, Name name);
@@ -98,6 +112,10 @@ class Builtins {
   static bool IsApi(int index);
   static bool HasCppImplementation(int index);
 
+  // Returns true for builtins that are only ever entered through a JSFunction
+  // and can thus be deserialized lazily on their first call.
+  static bool IsLazyDeserializationCandidate(int index);
+
   bool is_initialized() const { return initialized_; }
 
   // Used by SetupIsolateDelegate and Deserializer.
@@ -159,6 +177,7 @@ class Builtins {
   // IterateBuiltins() above which assumes Object**'s for the callback
   // function f, we use an Object* array here.
   Object* builtins_[builtin_count];
+  bool lazy_placeholders_[builtin_count];
   bool initialized_;
 
   friend class Isolate;
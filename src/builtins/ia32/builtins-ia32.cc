@@ -789,10 +789,18 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   __ mov(feedback_vector,
          FieldOperand(closure, JSFunction::kFeedbackVectorOffset));
   __ mov(feedback_vector, FieldOperand(feedback_vector, Cell::kValueOffset));
+  // Functions that run without a feedback vector have neither optimized code
+  // nor an invocation count to check.
+  Label push_stack_frame;
+  __ JumpIfRoot(feedback_vector, Heap::kUndefinedValueRootIndex,
+                &push_stack_frame);
+
   // Read off the optimized code slot in the feedback vector, and if there
   // is optimized code or an optimization marker, call that instead.
   MaybeTailCallOptimizedCodeSlot(masm, feedback_vector, ecx);
 
+  __ bind(&push_stack_frame);
+
   // Open a frame scope to indicate that there is a frame on the stack.  The
   // MANUAL indicates that the scope shouldn't actually generate code to set
   // up the frame (that is done below).
@@ -822,10 +830,14 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   __ j(not_equal, &switch_to_different_code_kind);
 
   // Increment invocation count for the function.
+  Label invocation_count_updated;
+  __ JumpIfRoot(feedback_vector, Heap::kUndefinedValueRootIndex,
+                &invocation_count_updated);
   __ add(FieldOperand(feedback_vector,
                       FeedbackVector::kInvocationCountIndex * kPointerSize +
                           FeedbackVector::kHeaderSize),
          Immediate(Smi::FromInt(1)));
+  __ bind(&invocation_count_updated);
 
   // Check function data field is actually a BytecodeArray object.
   if (FLAG_debug_code) {
@@ -1377,6 +1389,15 @@ void Builtins::Generate_CompileLazy(MacroAssembler* masm) {
   GenerateTailCallToReturnedCode(masm, Runtime::kCompileLazy);
 }
 
+void Builtins::Generate_DeserializeLazy(MacroAssembler* masm) {
+  // ----------- S t a t e -------------
+  //  -- eax : argument count (preserved for callee)
+  //  -- edx : new target (preserved for callee)
+  //  -- edi : target function (preserved for callee)
+  // -----------------------------------
+  GenerateTailCallToReturnedCode(masm, Runtime::kDeserializeLazy);
+}
+
 void Builtins::Generate_InstantiateAsmJs(MacroAssembler* masm) {
   // ----------- S t a t e -------------
   //  -- eax : argument count (preserved for callee)
@@ -1117,10 +1117,18 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   __ lw(feedback_vector,
         FieldMemOperand(closure, JSFunction::kFeedbackVectorOffset));
   __ lw(feedback_vector, FieldMemOperand(feedback_vector, Cell::kValueOffset));
+  // Functions that run without a feedback vector have neither optimized code
+  // nor an invocation count to check.
+  Label push_stack_frame;
+  __ JumpIfRoot(feedback_vector, Heap::kUndefinedValueRootIndex,
+                &push_stack_frame);
+
   // Read off the optimized code slot in the feedback vector, and if there
   // is optimized code or an optimization marker, call that instead.
   MaybeTailCallOptimizedCodeSlot(masm, feedback_vector, t0, t3, t1);
 
+  __ bind(&push_stack_frame);
+
   // Open a frame scope to indicate that there is a frame on the stack.  The
   // MANUAL indicates that the scope shouldn't actually generate code to set up
   // the frame (that is done below).
@@ -1146,6 +1154,9 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
             Operand(masm->CodeObject()));  // Self-reference to this code.
 
   // Increment invocation count for the function.
+  Label invocation_count_updated;
+  __ JumpIfRoot(feedback_vector, Heap::kUndefinedValueRootIndex,
+                &invocation_count_updated);
   __ lw(t0,
         FieldMemOperand(feedback_vector,
                         FeedbackVector::kInvocationCountIndex * kPointerSize +
@@ -1155,6 +1166,7 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
         FieldMemOperand(feedback_vector,
                         FeedbackVector::kInvocationCountIndex * kPointerSize +
                             FeedbackVector::kHeaderSize));
+  __ bind(&invocation_count_updated);
 
   // Check function data field is actually a BytecodeArray object.
   if (FLAG_debug_code) {
@@ -1562,6 +1574,15 @@ void Builtins::Generate_CompileLazy(MacroAssembler* masm) {
   GenerateTailCallToReturnedCode(masm, Runtime::kCompileLazy);
 }
 
+void Builtins::Generate_DeserializeLazy(MacroAssembler* masm) {
+  // ----------- S t a t e -------------
+  //  -- a0 : argument count (preserved for callee)
+  //  -- a3 : new target (preserved for callee)
+  //  -- a1 : target function (preserved for callee)
+  // -----------------------------------
+  GenerateTailCallToReturnedCode(masm, Runtime::kDeserializeLazy);
+}
+
 void Builtins::Generate_InstantiateAsmJs(MacroAssembler* masm) {
   // ----------- S t a t e -------------
   //  -- a0 : argument count (preserved for callee)
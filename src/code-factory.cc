@@ -437,6 +437,12 @@ Callable CodeFactory::ArrayShift(Isolate* isolate) {
                   BuiltinDescriptor(isolate));
 }
 
+// static
+Callable CodeFactory::ArraySlice(Isolate* isolate) {
+  return Callable(isolate->builtins()->ArraySlice(),
+                  BuiltinDescriptor(isolate));
+}
+
 // static
 Callable CodeFactory::ArrayPush(Isolate* isolate) {
   return Callable(isolate->builtins()->ArrayPush(), BuiltinDescriptor(isolate));
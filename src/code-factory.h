@@ -116,6 +116,7 @@ class V8_EXPORT_PRIVATE CodeFactory final {
   static Callable ArrayPop(Isolate* isolate);
   static Callable ArrayPush(Isolate* isolate);
   static Callable ArrayShift(Isolate* isolate);
+  static Callable ArraySlice(Isolate* isolate);
   static Callable FunctionPrototypeBind(Isolate* isolate);
 };
 
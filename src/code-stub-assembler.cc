@@ -1220,7 +1220,7 @@ Node* CodeStubAssembler::LoadNameHashField(Node* name) {
 Node* CodeStubAssembler::LoadNameHash(Node* name, Label* if_hash_not_computed) {
   Node* hash_field = LoadNameHashField(name);
   if (if_hash_not_computed != nullptr) {
-    GotoIf(IsClearWord32(hash_field, Name::kHashNotComputedMask),
+    GotoIf(IsSetWord32(hash_field, Name::kHashNotComputedMask),
            if_hash_not_computed);
   }
   return Word32Shr(hash_field, Int32Constant(Name::kHashShift));
@@ -4085,6 +4085,69 @@ Node* CodeStubAssembler::StringAdd(Node* context, Node* left, Node* right,
     GotoIf(SmiLessThan(new_length, SmiConstant(ConsString::kMinLength)),
            &non_cons);
 
+    // Repeated appends produce a list of cons strings. Merge short sequential
+    // right parts into flat chunks so that the list is shorter by a constant
+    // factor, see Factory::NewConsString.
+    Label plain_cons(this);
+    {
+      GotoIf(SmiAbove(right_length,
+                      SmiConstant(ConsString::kMaxAppendChunkLength)),
+             &plain_cons);
+      GotoIfNot(IsConsStringInstanceType(LoadInstanceType(left)), &plain_cons);
+      Node* left_first = LoadObjectField(left, ConsString::kFirstOffset);
+      Node* left_second = LoadObjectField(left, ConsString::kSecondOffset);
+      Node* second_length = LoadStringLength(left_second);
+      Node* chunk_length = SmiAdd(second_length, right_length);
+      GotoIf(SmiAbove(chunk_length,
+                      SmiConstant(ConsString::kMaxAppendChunkLength)),
+             &plain_cons);
+      Node* second_instance_type = LoadInstanceType(left_second);
+      Node* right_instance_type = LoadInstanceType(right);
+      GotoIf(IsSetWord32(Word32Or(second_instance_type, right_instance_type),
+                         kStringRepresentationMask),
+             &plain_cons);
+      GotoIf(IsSetWord32(Word32Xor(second_instance_type, right_instance_type),
+                         kStringEncodingMask),
+             &plain_cons);
+
+      Label two_byte_chunk(this);
+      GotoIfNot(IsOneByteStringInstanceType(right_instance_type),
+                &two_byte_chunk);
+      {
+        Node* chunk = AllocateSeqOneByteString(context, chunk_length,
+                                               SMI_PARAMETERS, flags);
+        CopyStringCharacters(left_second, chunk, SmiConstant(Smi::kZero),
+                             SmiConstant(Smi::kZero), second_length,
+                             String::ONE_BYTE_ENCODING,
+                             String::ONE_BYTE_ENCODING, SMI_PARAMETERS);
+        CopyStringCharacters(right, chunk, SmiConstant(Smi::kZero),
+                             second_length, right_length,
+                             String::ONE_BYTE_ENCODING,
+                             String::ONE_BYTE_ENCODING, SMI_PARAMETERS);
+        result.Bind(
+            NewConsString(context, new_length, left_first, chunk, flags));
+        Goto(&done_native);
+      }
+
+      BIND(&two_byte_chunk);
+      {
+        Node* chunk = AllocateSeqTwoByteString(context, chunk_length,
+                                               SMI_PARAMETERS, flags);
+        CopyStringCharacters(left_second, chunk, SmiConstant(Smi::kZero),
+                             SmiConstant(Smi::kZero), second_length,
+                             String::TWO_BYTE_ENCODING,
+                             String::TWO_BYTE_ENCODING, SMI_PARAMETERS);
+        CopyStringCharacters(right, chunk, SmiConstant(Smi::kZero),
+                             second_length, right_length,
+                             String::TWO_BYTE_ENCODING,
+                             String::TWO_BYTE_ENCODING, SMI_PARAMETERS);
+        result.Bind(
+            NewConsString(context, new_length, left_first, chunk, flags));
+        Goto(&done_native);
+      }
+    }
+
+    BIND(&plain_cons);
     result.Bind(NewConsString(context, new_length, var_left.value(),
                               var_right.value(), flags));
     Goto(&done_native);
@@ -4234,6 +4297,12 @@ Node* CodeStubAssembler::StringToNumber(Node* context, Node* input) {
 
   BIND(&runtime);
   {
+    Label if_slow(this, Label::kDeferred);
+    const bool allow_fraction = true;
+    var_result.Bind(TryStringToNumberFast(input, allow_fraction, &if_slow));
+    Goto(&end);
+
+    BIND(&if_slow);
     var_result.Bind(CallRuntime(Runtime::kStringToNumber, context, input));
     Goto(&end);
   }
@@ -4242,6 +4311,101 @@ Node* CodeStubAssembler::StringToNumber(Node* context, Node* input) {
   return var_result.value();
 }
 
+Node* CodeStubAssembler::TryStringToNumberFast(Node* string,
+                                               bool allow_fraction,
+                                               Label* if_bailout) {
+  CSA_SLOW_ASSERT(this, IsString(string));
+  // Up to 15 decimal digits fit into the 53 bits of a double's significand,
+  // and powers of ten up to 10^22 are exact doubles, so the quotient below is
+  // correctly rounded.
+  const int kMaxDigits = 15;
+
+  Node* instance_type = LoadInstanceType(string);
+  GotoIfNot(IsSequentialStringInstanceType(instance_type), if_bailout);
+  GotoIfNot(IsOneByteStringInstanceType(instance_type), if_bailout);
+  Node* length = SmiUntag(LoadStringLength(string));
+  // Leave room for the sign and the decimal point.
+  GotoIf(IntPtrGreaterThan(length, IntPtrConstant(kMaxDigits + 2)),
+         if_bailout);
+  GotoIf(IntPtrEqual(length, IntPtrConstant(0)), if_bailout);
+  Node* data = PointerToSeqStringData(string);
+
+  VARIABLE(var_index, MachineType::PointerRepresentation(), IntPtrConstant(0));
+  VARIABLE(var_sign, MachineRepresentation::kFloat64, Float64Constant(1.0));
+  {
+    Label if_minus(this), if_plus(this), if_nosign(this);
+    Node* first = Load(MachineType::Uint8(), data);
+    GotoIf(Word32Equal(first, Int32Constant('-')), &if_minus);
+    Branch(Word32Equal(first, Int32Constant('+')), &if_plus, &if_nosign);
+
+    BIND(&if_minus);
+    var_sign.Bind(Float64Constant(-1.0));
+    Goto(&if_plus);
+
+    BIND(&if_plus);
+    var_index.Bind(IntPtrConstant(1));
+    Goto(&if_nosign);
+
+    BIND(&if_nosign);
+  }
+
+  // {var_scale_step} becomes 10 after the decimal point, so that {var_scale}
+  // is ten to the power of the number of fraction digits.
+  VARIABLE(var_mantissa, MachineRepresentation::kFloat64,
+           Float64Constant(0.0));
+  VARIABLE(var_scale, MachineRepresentation::kFloat64, Float64Constant(1.0));
+  VARIABLE(var_scale_step, MachineRepresentation::kFloat64,
+           Float64Constant(1.0));
+  VARIABLE(var_digits, MachineType::PointerRepresentation(),
+           IntPtrConstant(0));
+  Variable* loop_vars[] = {&var_index, &var_mantissa, &var_scale,
+                           &var_scale_step, &var_digits};
+  Label loop(this, arraysize(loop_vars), loop_vars), done(this);
+  Goto(&loop);
+  BIND(&loop);
+  {
+    Node* index = var_index.value();
+    GotoIf(IntPtrEqual(index, length), &done);
+    Node* c = Load(MachineType::Uint8(), data, index);
+    var_index.Bind(IntPtrAdd(index, IntPtrConstant(1)));
+
+    Label if_digit(this), if_notdigit(this);
+    Node* digit = Int32Sub(c, Int32Constant('0'));
+    Branch(Uint32LessThan(digit, Int32Constant(10)), &if_digit, &if_notdigit);
+
+    BIND(&if_digit);
+    {
+      var_mantissa.Bind(
+          Float64Add(Float64Mul(var_mantissa.value(), Float64Constant(10.0)),
+                     ChangeInt32ToFloat64(digit)));
+      var_scale.Bind(Float64Mul(var_scale.value(), var_scale_step.value()));
+      var_digits.Bind(IntPtrAdd(var_digits.value(), IntPtrConstant(1)));
+      Goto(&loop);
+    }
+
+    BIND(&if_notdigit);
+    {
+      if (allow_fraction) {
+        GotoIfNot(Word32Equal(c, Int32Constant('.')), if_bailout);
+        // A second decimal point.
+        GotoIfNot(Float64Equal(var_scale_step.value(), Float64Constant(1.0)),
+                  if_bailout);
+        var_scale_step.Bind(Float64Constant(10.0));
+        Goto(&loop);
+      } else {
+        Goto(if_bailout);
+      }
+    }
+  }
+
+  BIND(&done);
+  Node* digits = var_digits.value();
+  GotoIf(IntPtrEqual(digits, IntPtrConstant(0)), if_bailout);
+  GotoIf(IntPtrGreaterThan(digits, IntPtrConstant(kMaxDigits)), if_bailout);
+  Node* value = Float64Div(var_mantissa.value(), var_scale.value());
+  return ChangeFloat64ToTagged(Float64Mul(var_sign.value(), value));
+}
+
 Node* CodeStubAssembler::NumberToString(Node* context, Node* argument) {
   VARIABLE(result, MachineRepresentation::kTagged);
   Label runtime(this, Label::kDeferred), smi(this), done(this, &result);
@@ -6165,9 +6329,11 @@ void CodeStubAssembler::UpdateFeedback(Node* feedback, Node* feedback_vector,
   // This method is used for binary op and compare feedback. These
   // vector nodes are initialized with a smi 0, so we can simply OR
   // our new feedback in place.
+  Label end(this);
+  // Interpreted functions may run without a feedback vector.
+  GotoIf(IsUndefined(feedback_vector), &end);
   Node* previous_feedback = LoadFixedArrayElement(feedback_vector, slot_id);
   Node* combined_feedback = SmiOr(previous_feedback, feedback);
-  Label end(this);
 
   GotoIf(SmiEqual(previous_feedback, combined_feedback), &end);
   {
@@ -879,6 +879,12 @@ class V8_EXPORT_PRIVATE CodeStubAssembler : public compiler::CodeAssembler {
   // Type conversion helpers.
   // Convert a String to a Number.
   Node* StringToNumber(Node* context, Node* input);
+  // Converts a sequential one-byte {string} that consists of an optional
+  // sign and at most 15 decimal digits (with a decimal point in between if
+  // {allow_fraction}) to a Number, whose value is exact or correctly rounded.
+  // Jumps to {if_bailout} for any other string.
+  Node* TryStringToNumberFast(Node* string, bool allow_fraction,
+                              Label* if_bailout);
   Node* NumberToString(Node* context, Node* input);
   // Convert an object to a name.
   Node* ToName(Node* context, Node* input);
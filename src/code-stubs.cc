@@ -586,6 +586,11 @@ TF_STUB(CallICStub, CodeStubAssembler) {
                     WeakCell::kValueOffset &&
                 WeakCell::kValueOffset == Symbol::kHashFieldSlot);
 
+  Label call_function(this), extra_checks(this), call(this);
+
+  // Interpreted functions may run without a feedback vector.
+  GotoIf(IsUndefined(vector), &call);
+
   // Increment the call count.
   // TODO(bmeurer): Would it be beneficial to use Int32Add on 64-bit?
   Comment("increment call count");
@@ -595,8 +600,6 @@ TF_STUB(CallICStub, CodeStubAssembler) {
   StoreFixedArrayElement(vector, slot, new_count, SKIP_WRITE_BARRIER,
                          1 * kPointerSize);
 
-  Label call_function(this), extra_checks(this), call(this);
-
   // The checks. First, does function match the recorded monomorphic target?
   Node* feedback_element = LoadFixedArrayElement(vector, slot);
   Node* feedback_value = LoadWeakCellValueUnchecked(feedback_element);
@@ -185,6 +185,9 @@ void CompilationCacheScript::Put(Handle<String> source, Handle<Context> context,
       table, source, context, language_mode, function_info, literals));
 }
 
+CompilationCacheEval::CompilationCacheEval(Isolate* isolate)
+    : CompilationSubCache(isolate, Max(1, FLAG_eval_cache_generations)) {}
+
 InfoVectorPair CompilationCacheEval::Lookup(
     Handle<String> source, Handle<SharedFunctionInfo> outer_info,
     Handle<Context> native_context, LanguageMode language_mode, int position) {
@@ -193,12 +196,24 @@ InfoVectorPair CompilationCacheEval::Lookup(
   // scope. Otherwise, we risk keeping old tables around even after
   // having cleared the cache.
   InfoVectorPair result;
-  const int generation = 0;
-  DCHECK(generations() == 1);
-  Handle<CompilationCacheTable> table = GetTable(generation);
-  result = table->LookupEval(source, outer_info, native_context, language_mode,
-                             position);
+  int generation;
+  for (generation = 0; generation < generations(); generation++) {
+    Handle<CompilationCacheTable> table = GetTable(generation);
+    result = table->LookupEval(source, outer_info, native_context,
+                               language_mode, position);
+    if (result.has_shared()) break;
+  }
   if (result.has_shared()) {
+    if (generation != 0 && result.has_vector()) {
+      // Move the entry to the youngest generation so that it is evicted in
+      // least recently used order. Without literals for this native context
+      // the caller puts the entry itself.
+      Handle<SharedFunctionInfo> function_info(result.shared(), isolate());
+      Handle<Cell> literals(result.vector(), isolate());
+      PutInFirstTable(source, outer_info, function_info, native_context,
+                      literals, position);
+      result = InfoVectorPair(*function_info, *literals);
+    }
     isolate()->counters()->compilation_cache_hits()->Increment();
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
@@ -212,6 +227,7 @@ void CompilationCacheEval::Put(Handle<String> source,
                                Handle<Context> native_context,
                                Handle<Cell> literals, int position) {
   HandleScope scope(isolate());
+  AgeIfFull();
   Handle<CompilationCacheTable> table = GetFirstTable();
   table =
       CompilationCacheTable::PutEval(table, source, outer_info, function_info,
@@ -219,6 +235,31 @@ void CompilationCacheEval::Put(Handle<String> source,
   SetFirstTable(table);
 }
 
+void CompilationCacheEval::AgeIfFull() {
+  // Keep the memory held by a multi-generation cache bounded between GCs.
+  // Single-generation tables are aged by code age, which only makes sense
+  // during GC.
+  if (generations() > 1 && FLAG_eval_cache_max_entries > 0 &&
+      GetFirstTable()->NumberOfElements() >= FLAG_eval_cache_max_entries) {
+    Age();
+  }
+}
+
+void CompilationCacheEval::PutInFirstTable(
+    Handle<String> source, Handle<SharedFunctionInfo> outer_info,
+    Handle<SharedFunctionInfo> function_info, Handle<Context> native_context,
+    Handle<Cell> literals, int position) {
+  HandleScope scope(isolate());
+  AgeIfFull();
+  // The first PutEval of a source only records its hash, the second one
+  // stores the actual entry; the entry was already in use, so do both.
+  for (int i = 0; i < 2; i++) {
+    SetFirstTable(CompilationCacheTable::PutEval(
+        GetFirstTable(), source, outer_info, function_info, native_context,
+        literals, position));
+  }
+}
+
 MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(
     Handle<String> source,
     JSRegExp::Flags flags) {
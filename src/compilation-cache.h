@@ -109,10 +109,12 @@ class CompilationCacheScript : public CompilationSubCache {
 //    More specifically these are the CompileString, DebugEvaluate and
 //    DebugEvaluateGlobal runtime functions.
 // 4. The start position of the calling scope.
+// With --eval-cache-generations > 1 the sub-cache keeps that many
+// generations; entries found in an older generation are moved back to the
+// youngest one, so that only entries unused for that many GCs are evicted.
 class CompilationCacheEval: public CompilationSubCache {
  public:
-  explicit CompilationCacheEval(Isolate* isolate)
-      : CompilationSubCache(isolate, 1) {}
+  explicit CompilationCacheEval(Isolate* isolate);
 
   InfoVectorPair Lookup(Handle<String> source,
                         Handle<SharedFunctionInfo> outer_info,
@@ -124,6 +126,13 @@ class CompilationCacheEval: public CompilationSubCache {
            Handle<Context> native_context, Handle<Cell> literals, int position);
 
  private:
+  void PutInFirstTable(Handle<String> source,
+                       Handle<SharedFunctionInfo> outer_info,
+                       Handle<SharedFunctionInfo> function_info,
+                       Handle<Context> native_context, Handle<Cell> literals,
+                       int position);
+  void AgeIfFull();
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheEval);
 };
 
@@ -69,7 +69,7 @@ CompilationInfo::CompilationInfo(Zone* zone, ParseInfo* parse_info,
     MarkAsSourcePositionsEnabled();
   }
 
-  if (FLAG_block_coverage && isolate->is_block_count_code_coverage() &&
+  if (FLAG_block_coverage && isolate->is_block_code_coverage() &&
       parse_info->script()->IsUserJavaScript()) {
     MarkAsBlockCoverageEnabled();
   }
@@ -202,6 +202,14 @@ CompilationInfo::SourcePositionRecordingMode() const {
              : SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS;
 }
 
+bool CompilationInfo::HasLazySourcePositions() const {
+  if (!FLAG_enable_lazy_source_positions) return false;
+  if (parse_info() == nullptr || parse_info()->is_native()) return false;
+  return !is_debug() && !is_collecting_source_positions() &&
+         !is_block_coverage_enabled() &&
+         !isolate()->NeedsSourcePositionsForProfiling();
+}
+
 bool CompilationInfo::ExpectsJSReceiverAsReceiver() {
   return is_sloppy(parse_info()->language_mode()) && !parse_info()->is_native();
 }
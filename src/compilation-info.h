@@ -52,6 +52,8 @@ class V8_EXPORT_PRIVATE CompilationInfo final {
     kOptimizeFromBytecode = 1 << 14,
     kLoopPeelingEnabled = 1 << 15,
     kBlockCoverageEnabled = 1 << 16,
+    kCollectSourcePositions = 1 << 17,
+    kNativeContextIndependent = 1 << 18,
   };
 
   CompilationInfo(Zone* zone, ParseInfo* parse_info, Isolate* isolate,
@@ -136,6 +138,14 @@ class V8_EXPORT_PRIVATE CompilationInfo final {
 
   bool is_frame_specializing() const { return GetFlag(kFrameSpecializing); }
 
+  void MarkAsNativeContextIndependent() {
+    SetFlag(kNativeContextIndependent);
+  }
+
+  bool is_native_context_independent() const {
+    return GetFlag(kNativeContextIndependent);
+  }
+
   void MarkAsDeoptimizationEnabled() { SetFlag(kDeoptimizationEnabled); }
 
   bool is_deoptimization_enabled() const {
@@ -184,6 +194,14 @@ class V8_EXPORT_PRIVATE CompilationInfo final {
     return GetFlag(kBlockCoverageEnabled);
   }
 
+  // Compiles marked as collecting source positions regenerate the bytecode of
+  // a function only to recover its source position table.
+  void MarkAsCollectingSourcePositions() { SetFlag(kCollectSourcePositions); }
+
+  bool is_collecting_source_positions() const {
+    return GetFlag(kCollectSourcePositions);
+  }
+
   bool GeneratePreagedPrologue() const {
     // Generate a pre-aged prologue if we are optimizing for size, which
     // will make code old more aggressive. Only apply to Code::FUNCTION,
@@ -222,6 +240,7 @@ class V8_EXPORT_PRIVATE CompilationInfo final {
     osr_ast_id_ = osr_ast_id;
     osr_frame_ = osr_frame;
   }
+  void ClearOsrFrame() { osr_frame_ = nullptr; }
 
   // Deoptimization support.
   bool ShouldEnsureSpaceForLazyDeopt() { return !IsStub(); }
@@ -314,6 +333,10 @@ class V8_EXPORT_PRIVATE CompilationInfo final {
 
   SourcePositionTableBuilder::RecordingMode SourcePositionRecordingMode() const;
 
+  // Returns true if the source positions of the bytecode are left out and
+  // only collected once they are needed.
+  bool HasLazySourcePositions() const;
+
   bool has_coverage_info() const { return !coverage_info_.is_null(); }
   Handle<CoverageInfo> coverage_info() const { return coverage_info_; }
   void set_coverage_info(Handle<CoverageInfo> coverage_info) {
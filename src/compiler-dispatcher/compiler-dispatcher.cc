@@ -31,6 +31,13 @@ bool CanRunOnAnyThread(CompilerDispatcherJob* job) {
          job->status() == CompileJobStatus::kReadyToCompile;
 }
 
+// Returns true if the job finished a background step and its next step has to
+// run on the main thread.
+bool IsWaitingForMainThread(CompilerDispatcherJob* job) {
+  return job->status() == CompileJobStatus::kParsed ||
+         job->status() == CompileJobStatus::kCompiled;
+}
+
 bool DoNextStepOnMainThread(Isolate* isolate, CompilerDispatcherJob* job,
                             ExceptionHandling exception_handling) {
   DCHECK(ThreadId::Current().Equals(isolate->thread_id()));
@@ -217,12 +224,39 @@ void CompilerDispatcher::IdleTask::RunInternal(double deadline_in_seconds) {
   dispatcher_->DoIdleWork(deadline_in_seconds);
 }
 
+class CompilerDispatcher::PublishTask : public CancelableTask {
+ public:
+  PublishTask(Isolate* isolate, CancelableTaskManager* task_manager,
+              CompilerDispatcher* dispatcher);
+  ~PublishTask() override;
+
+  // CancelableTask implementation.
+  void RunInternal() override;
+
+ private:
+  CompilerDispatcher* dispatcher_;
+
+  DISALLOW_COPY_AND_ASSIGN(PublishTask);
+};
+
+CompilerDispatcher::PublishTask::PublishTask(
+    Isolate* isolate, CancelableTaskManager* task_manager,
+    CompilerDispatcher* dispatcher)
+    : CancelableTask(task_manager), dispatcher_(dispatcher) {}
+
+CompilerDispatcher::PublishTask::~PublishTask() {}
+
+void CompilerDispatcher::PublishTask::RunInternal() {
+  dispatcher_->PublishJobs();
+}
+
 CompilerDispatcher::CompilerDispatcher(Isolate* isolate, Platform* platform,
                                        size_t max_stack_size)
     : isolate_(isolate),
       platform_(platform),
       max_stack_size_(max_stack_size),
       trace_compiler_dispatcher_(FLAG_trace_compiler_dispatcher),
+      batch_publish_(FLAG_compiler_dispatcher_batch_publish),
       tracer_(new CompilerDispatcherTracer(isolate_)),
       task_manager_(new CancelableTaskManager()),
       next_job_id_(0),
@@ -230,6 +264,7 @@ CompilerDispatcher::CompilerDispatcher(Isolate* isolate, Platform* platform,
       memory_pressure_level_(MemoryPressureLevel::kNone),
       abort_(false),
       idle_task_scheduled_(false),
+      publish_task_scheduled_(false),
       num_background_tasks_(0),
       main_thread_blocking_on_job_(nullptr),
       block_for_testing_(false),
@@ -523,6 +558,7 @@ void CompilerDispatcher::AbortAll(BlockingBehavior blocking) {
       base::LockGuard<base::Mutex> lock(&mutex_);
       DCHECK(pending_background_jobs_.empty());
       DCHECK(running_background_jobs_.empty());
+      jobs_to_publish_.clear();
       abort_ = false;
     }
     return;
@@ -532,6 +568,7 @@ void CompilerDispatcher::AbortAll(BlockingBehavior blocking) {
     base::LockGuard<base::Mutex> lock(&mutex_);
     abort_ = true;
     pending_background_jobs_.clear();
+    jobs_to_publish_.clear();
   }
   AbortInactiveJobs();
 
@@ -630,6 +667,17 @@ void CompilerDispatcher::ScheduleIdleTaskIfNeeded() {
   ScheduleIdleTaskFromAnyThread();
 }
 
+void CompilerDispatcher::SchedulePublishTaskFromAnyThread() {
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    if (publish_task_scheduled_ || jobs_to_publish_.empty()) return;
+    publish_task_scheduled_ = true;
+  }
+  platform_->CallOnForegroundThread(
+      reinterpret_cast<v8::Isolate*>(isolate_),
+      new PublishTask(isolate_, task_manager_.get(), this));
+}
+
 void CompilerDispatcher::ScheduleAbortTask() {
   v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
   platform_->CallOnForegroundThread(
@@ -660,7 +708,7 @@ void CompilerDispatcher::ScheduleMoreBackgroundTasksIfNeeded() {
   }
   platform_->CallOnBackgroundThread(
       new BackgroundTask(isolate_, task_manager_.get(), this),
-      v8::Platform::kShortRunningTask);
+      v8::Platform::kLongRunningTask);
 }
 
 void CompilerDispatcher::DoBackgroundWork() {
@@ -687,19 +735,21 @@ void CompilerDispatcher::DoBackgroundWork() {
     }
 
     DoNextStepOnBackgroundThread(job);
-    // Unconditionally schedule an idle task, as all background steps have to be
-    // followed by a main thread step.
-    ScheduleIdleTaskFromAnyThread();
+    // Unconditionally schedule an idle task (or a publish task), as all
+    // background steps have to be followed by a main thread step.
+    if (!batch_publish_) ScheduleIdleTaskFromAnyThread();
 
     {
       base::LockGuard<base::Mutex> lock(&mutex_);
       running_background_jobs_.erase(job);
+      if (batch_publish_ && !abort_) jobs_to_publish_.insert(job);
 
       if (main_thread_blocking_on_job_ == job) {
         main_thread_blocking_on_job_ = nullptr;
         main_thread_blocking_signal_.NotifyOne();
       }
     }
+    if (batch_publish_) SchedulePublishTaskFromAnyThread();
   }
 
   {
@@ -792,6 +842,39 @@ void CompilerDispatcher::DoIdleWork(double deadline_in_seconds) {
   if (jobs_.size() > too_long_jobs) ScheduleIdleTaskIfNeeded();
 }
 
+void CompilerDispatcher::PublishJobs() {
+  std::unordered_set<CompilerDispatcherJob*> jobs;
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    publish_task_scheduled_ = false;
+    if (abort_) return;
+    jobs.swap(jobs_to_publish_);
+  }
+  if (jobs.empty()) return;
+
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompilerDispatcherPublishJobs");
+  if (trace_compiler_dispatcher_) {
+    PrintF("CompilerDispatcher: publishing %zu jobs\n", jobs.size());
+  }
+  for (auto it = jobs_.cbegin(); it != jobs_.cend();) {
+    CompilerDispatcherJob* job = it->second.get();
+    // Jobs that were advanced by FinishNow or DoIdleWork in the meantime are
+    // no longer waiting for us and might even run on a background thread.
+    if (jobs.find(job) == jobs.end() || !IsWaitingForMainThread(job)) {
+      ++it;
+      continue;
+    }
+    while (!IsFinished(job) && !CanRunOnAnyThread(job)) {
+      DoNextStepOnMainThread(isolate_, job, ExceptionHandling::kSwallow);
+    }
+    ConsiderJobForBackgroundProcessing(job);
+    JobMap::const_iterator next = RemoveIfFinished(it);
+    if (next == it) ++next;
+    it = next;
+  }
+}
+
 CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::RemoveIfFinished(
     JobMap::const_iterator job) {
   if (!IsFinished(job->second.get())) {
@@ -812,6 +895,10 @@ CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::RemoveIfFinished(
 CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::RemoveJob(
     CompilerDispatcher::JobMap::const_iterator job) {
   job->second->ResetOnMainThread();
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    jobs_to_publish_.erase(job->second.get());
+  }
   if (!job->second->shared().is_null()) {
     shared_to_job_id_.Delete(job->second->shared());
   }
@@ -66,6 +66,12 @@ class Handle;
 // CompilerDispatcher::DoBackgroundWork advances one of the pending jobs, and
 // then spins of another idle task to potentially do the final step on the main
 // thread.
+//
+// With --compiler-dispatcher-batch-publish, jobs that finished a background
+// step are instead collected in CompilerDispatcher::jobs_to_publish_. A single
+// foreground task then runs the remaining main-thread steps of all collected
+// jobs in one batch (CompilerDispatcher::PublishJobs), so results are
+// installed without waiting for idle time.
 class V8_EXPORT_PRIVATE CompilerDispatcher {
  public:
   typedef uintptr_t JobId;
@@ -145,12 +151,16 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   FRIEND_TEST(CompilerDispatcherTest, AsyncAbortAllRunningBackgroundTask);
   FRIEND_TEST(CompilerDispatcherTest, FinishNowDuringAbortAll);
   FRIEND_TEST(CompilerDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(CompilerDispatcherTest, PublishAfterBackgroundCompile);
+  FRIEND_TEST(CompilerDispatcherTest, PublishMultipleJobsInOneBatch);
+  FRIEND_TEST(CompilerDispatcherTest, PublishSkipsFinishedJobs);
 
   typedef std::map<JobId, std::unique_ptr<CompilerDispatcherJob>> JobMap;
   typedef IdentityMap<JobId, FreeStoreAllocationPolicy> SharedToJobIdMap;
   class AbortTask;
   class BackgroundTask;
   class IdleTask;
+  class PublishTask;
 
   void WaitForJobIfRunningOnBackground(CompilerDispatcherJob* job);
   void AbortInactiveJobs();
@@ -162,8 +172,10 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   void ScheduleIdleTaskFromAnyThread();
   void ScheduleIdleTaskIfNeeded();
   void ScheduleAbortTask();
+  void SchedulePublishTaskFromAnyThread();
   void DoBackgroundWork();
   void DoIdleWork(double deadline_in_seconds);
+  void PublishJobs();
   JobId Enqueue(std::unique_ptr<CompilerDispatcherJob> job);
   JobId EnqueueAndStep(std::unique_ptr<CompilerDispatcherJob> job);
   // Returns job if not removed otherwise iterator following the removed job.
@@ -179,6 +191,10 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // Copy of FLAG_trace_compiler_dispatcher to allow for access from any thread.
   bool trace_compiler_dispatcher_;
 
+  // Copy of FLAG_compiler_dispatcher_batch_publish to allow for access from
+  // any thread.
+  bool batch_publish_;
+
   std::unique_ptr<CompilerDispatcherTracer> tracer_;
 
   std::unique_ptr<CancelableTaskManager> task_manager_;
@@ -203,6 +219,8 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
 
   bool idle_task_scheduled_;
 
+  bool publish_task_scheduled_;
+
   // Number of scheduled or running BackgroundTask objects.
   size_t num_background_tasks_;
 
@@ -213,6 +231,10 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // threads.
   std::unordered_set<CompilerDispatcherJob*> running_background_jobs_;
 
+  // The set of CompilerDispatcherJobs that finished a background step and
+  // wait for the next PublishTask to run their main thread steps.
+  std::unordered_set<CompilerDispatcherJob*> jobs_to_publish_;
+
   // If not nullptr, then the main thread waits for the task processing
   // this job, and blocks on the ConditionVariable main_thread_blocking_signal_.
   CompilerDispatcherJob* main_thread_blocking_on_job_;
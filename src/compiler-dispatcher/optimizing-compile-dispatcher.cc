@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/compilation-info.h"
 #include "src/compiler.h"
@@ -16,10 +18,11 @@
 namespace v8 {
 namespace internal {
 
-namespace {
-
-void DisposeCompilationJob(CompilationJob* job, bool restore_function_code) {
-  if (restore_function_code) {
+void OptimizingCompileDispatcher::DisposeCompilationJob(
+    CompilationJob* job, bool restore_function_code) {
+  ForgetOsrJob(job);
+  // OSR jobs never replaced the code of the function.
+  if (restore_function_code && !job->info()->is_osr()) {
     Handle<JSFunction> function = job->info()->closure();
     function->ReplaceCode(function->shared()->code());
     if (function->IsInOptimizationQueue()) {
@@ -33,7 +36,25 @@ void DisposeCompilationJob(CompilationJob* job, bool restore_function_code) {
   delete job;
 }
 
-}  // namespace
+void OptimizingCompileDispatcher::ForgetOsrJob(CompilationJob* job) {
+  if (!job->info()->is_osr()) return;
+  base::LockGuard<base::Mutex> access_osr_jobs(&osr_jobs_mutex_);
+  auto it = std::find(osr_jobs_.begin(), osr_jobs_.end(), job);
+  DCHECK(it != osr_jobs_.end());
+  osr_jobs_.erase(it);
+}
+
+bool OptimizingCompileDispatcher::IsQueuedForOsr(JSFunction* function,
+                                                 BailoutId osr_ast_id) {
+  base::LockGuard<base::Mutex> access_osr_jobs(&osr_jobs_mutex_);
+  for (CompilationJob* job : osr_jobs_) {
+    CompilationInfo* info = job->info();
+    if (*info->closure() == function && info->osr_ast_id() == osr_ast_id) {
+      return true;
+    }
+  }
+  return false;
+}
 
 class OptimizingCompileDispatcher::CompileTask : public v8::Task {
  public:
@@ -199,7 +220,7 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
     }
     CompilationInfo* info = job->info();
     Handle<JSFunction> function(*info->closure());
-    if (function->HasOptimizedCode()) {
+    if (function->HasOptimizedCode() && !info->is_osr()) {
       if (FLAG_trace_concurrent_recompilation) {
         PrintF("  ** Aborting compilation for ");
         function->ShortPrint();
@@ -207,6 +228,7 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
       }
       DisposeCompilationJob(job, false);
     } else {
+      ForgetOsrJob(job);
       Compiler::FinalizeCompilationJob(job);
     }
   }
@@ -214,6 +236,10 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
 
 void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  if (job->info()->is_osr()) {
+    base::LockGuard<base::Mutex> access_osr_jobs(&osr_jobs_mutex_);
+    osr_jobs_.push_back(job);
+  }
   {
     // Add job to the back of the input queue.
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
@@ -225,14 +251,14 @@ void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
     blocked_jobs_++;
   } else {
     V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        new CompileTask(isolate_, this), v8::Platform::kShortRunningTask);
+        new CompileTask(isolate_, this), v8::Platform::kLongRunningTask);
   }
 }
 
 void OptimizingCompileDispatcher::Unblock() {
   while (blocked_jobs_ > 0) {
     V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        new CompileTask(isolate_, this), v8::Platform::kShortRunningTask);
+        new CompileTask(isolate_, this), v8::Platform::kLongRunningTask);
     blocked_jobs_--;
   }
 }
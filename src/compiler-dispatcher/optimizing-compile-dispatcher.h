@@ -6,6 +6,7 @@
 #define V8_COMPILER_DISPATCHER_OPTIMIZING_COMPILE_DISPATCHER_H_
 
 #include <queue>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/platform/condition-variable.h"
@@ -14,11 +15,13 @@
 #include "src/flags.h"
 #include "src/globals.h"
 #include "src/list.h"
+#include "src/utils.h"
 
 namespace v8 {
 namespace internal {
 
 class CompilationJob;
+class JSFunction;
 class SharedFunctionInfo;
 
 class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
@@ -53,11 +56,17 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
+  // Returns whether an OSR compilation of {function} for the loop at
+  // {osr_ast_id} has been queued and not been installed or disposed yet.
+  bool IsQueuedForOsr(JSFunction* function, BailoutId osr_ast_id);
+
  private:
   class CompileTask;
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  void DisposeCompilationJob(CompilationJob* job, bool restore_function_code);
+  void ForgetOsrJob(CompilationJob* job);
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(CompilationJob* job);
   CompilationJob* NextInput(bool check_if_flushing = false);
@@ -78,12 +87,16 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   int input_queue_shift_;
   base::Mutex input_queue_mutex_;
 
-  // Queue of recompilation tasks ready to be installed (excluding OSR).
+  // Queue of recompilation tasks ready to be installed (including OSR).
   std::queue<CompilationJob*> output_queue_;
   // Used for job based recompilation which has multiple producers on
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // OSR jobs that are in one of the queues or being compiled.
+  std::vector<CompilationJob*> osr_jobs_;
+  base::Mutex osr_jobs_mutex_;
+
   volatile base::AtomicWord mode_;
 
   int blocked_jobs_;
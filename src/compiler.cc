@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 
 #include "src/asmjs/asm-js.h"
 #include "src/assembler-inl.h"
@@ -35,6 +36,7 @@
 #include "src/parsing/rewriter.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/runtime-profiler.h"
+#include "src/snapshot/code-cache-directory.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/vm-state-inl.h"
 
@@ -111,6 +113,19 @@ CompilationJob::Status CompilationJob::PrepareJob() {
   return UpdateState(PrepareJobImpl(), State::kReadyToExecute);
 }
 
+CompilationJob::Status CompilationJob::PrepareJobOnBackgroundThread() {
+  DCHECK(!info()->IsOptimizing());
+  DCHECK(can_execute_on_background_thread());
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+
+  // Delegate to the underlying implementation.
+  DCHECK(state() == State::kReadyToPrepare);
+  ScopedTimer t(&time_taken_to_prepare_);
+  return UpdateState(PrepareJobImpl(), State::kReadyToExecute);
+}
+
 CompilationJob::Status CompilationJob::ExecuteJob() {
   std::unique_ptr<DisallowHeapAllocation> no_allocation;
   std::unique_ptr<DisallowHandleAllocation> no_handles;
@@ -245,6 +260,16 @@ void RecordFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
     PROFILE(info->isolate(),
             CodeCreateEvent(log_tag, *abstract_code, *shared, script_name,
                             line_num, column_num));
+    // Also log the function's own copy of the interpreter entry trampoline,
+    // which is what native profilers see on the stack.
+    if (FLAG_interpreted_frames_native_stack && info->has_bytecode_array() &&
+        info->code()->is_interpreter_trampoline_builtin() &&
+        !info->code().is_identical_to(
+            info->isolate()->builtins()->InterpreterEntryTrampoline())) {
+      PROFILE(info->isolate(),
+              CodeCreateEvent(log_tag, AbstractCode::cast(*info->code()),
+                              *shared, script_name, line_num, column_num));
+    }
   }
 }
 
@@ -450,11 +475,12 @@ bool Renumber(ParseInfo* parse_info,
   return true;
 }
 
-bool GenerateUnoptimizedCode(CompilationInfo* info) {
+bool GenerateUnoptimizedCode(CompilationInfo* info,
+                             AsmJsTranslationJob* asm_job = nullptr) {
   if (UseAsmWasm(info->scope(), info->shared_info(), info->is_debug())) {
     EnsureFeedbackMetadata(info);
     MaybeHandle<FixedArray> wasm_data;
-    wasm_data = AsmJs::CompileAsmViaWasm(info);
+    wasm_data = AsmJs::CompileAsmViaWasm(info, asm_job);
     if (!wasm_data.is_null()) {
       info->shared_info()->set_asm_wasm_data(*wasm_data.ToHandleChecked());
       info->SetCode(info->isolate()->builtins()->InstantiateAsmJs());
@@ -473,6 +499,27 @@ bool GenerateUnoptimizedCode(CompilationInfo* info) {
   return true;
 }
 
+bool GenerateUnoptimizedCodeForInnerFunction(
+    FunctionLiteral* literal, Handle<SharedFunctionInfo> shared,
+    CompilationInfo* outer_info, AsmJsTranslationJob* asm_job = nullptr) {
+  ParseInfo parse_info(outer_info->script());
+  CompilationInfo info(parse_info.zone(), &parse_info, outer_info->isolate(),
+                       Handle<JSFunction>::null());
+
+  parse_info.set_literal(literal);
+  parse_info.set_shared_info(shared);
+  parse_info.set_function_literal_id(shared->function_literal_id());
+  parse_info.set_language_mode(literal->scope()->language_mode());
+  parse_info.set_ast_value_factory(
+      outer_info->parse_info()->ast_value_factory());
+  parse_info.set_ast_value_factory_owned(false);
+
+  if (outer_info->will_serialize()) info.PrepareForSerializing();
+  if (outer_info->is_debug()) info.MarkAsDebug();
+
+  return GenerateUnoptimizedCode(&info, asm_job);
+}
+
 bool CompileUnoptimizedInnerFunctions(
     Compiler::EagerInnerFunctionLiterals* literals,
     ConcurrencyMode inner_function_mode, std::shared_ptr<Zone> parse_zone,
@@ -486,11 +533,28 @@ bool CompileUnoptimizedInnerFunctions(
   RuntimeCallTimerScope runtimeTimer(isolate,
                                      &RuntimeCallStats::CompileInnerFunction);
 
+  // Start translating asm.js modules on background threads first, so that
+  // they are translated while the other inner functions are compiled.
+  std::unordered_map<FunctionLiteral*, std::shared_ptr<AsmJsTranslationJob>>
+      asm_jobs;
+  if (FLAG_concurrent_asm_translation) {
+    for (auto it : *literals) {
+      FunctionLiteral* literal = it->value();
+      Handle<SharedFunctionInfo> shared =
+          Compiler::GetSharedFunctionInfo(literal, script, outer_info);
+      if (shared->is_compiled()) continue;
+      if (!literal->scope()->asm_module()) continue;
+      if (!UseAsmWasm(literal->scope(), shared, is_debug)) continue;
+      asm_jobs[literal] = AsmJs::StartTranslation(isolate, script, literal);
+    }
+  }
+
   for (auto it : *literals) {
     FunctionLiteral* literal = it->value();
     Handle<SharedFunctionInfo> shared =
         Compiler::GetSharedFunctionInfo(literal, script, outer_info);
     if (shared->is_compiled()) continue;
+    auto asm_job = asm_jobs.find(literal);
 
     // The {literal} has already been numbered because AstNumbering decends into
     // eagerly compiled function literals.
@@ -509,22 +573,9 @@ bool CompileUnoptimizedInnerFunctions(
       continue;
     } else {
       // Otherwise generate unoptimized code now.
-      ParseInfo parse_info(script);
-      CompilationInfo info(parse_info.zone(), &parse_info, isolate,
-                           Handle<JSFunction>::null());
-
-      parse_info.set_literal(literal);
-      parse_info.set_shared_info(shared);
-      parse_info.set_function_literal_id(shared->function_literal_id());
-      parse_info.set_language_mode(literal->scope()->language_mode());
-      parse_info.set_ast_value_factory(
-          outer_info->parse_info()->ast_value_factory());
-      parse_info.set_ast_value_factory_owned(false);
-
-      if (will_serialize) info.PrepareForSerializing();
-      if (is_debug) info.MarkAsDebug();
-
-      if (!GenerateUnoptimizedCode(&info)) {
+      if (!GenerateUnoptimizedCodeForInnerFunction(
+              literal, shared, outer_info,
+              asm_job == asm_jobs.end() ? nullptr : asm_job->second.get())) {
         if (!isolate->has_pending_exception()) isolate->StackOverflow();
         return false;
       }
@@ -783,6 +834,9 @@ bool GetOptimizedCodeLater(CompilationJob* job) {
                "V8.RecompileSynchronous");
 
   if (job->PrepareJob() != CompilationJob::SUCCEEDED) return false;
+  // The OSR frame is only needed to build the graph. The loop keeps running
+  // in the interpreter while the job is compiled.
+  if (info->is_osr()) info->ClearOsrFrame();
   isolate->optimizing_compile_dispatcher()->QueueForOptimization(job);
 
   if (FLAG_trace_concurrent_recompilation) {
@@ -824,6 +878,23 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     return cached_code;
   }
 
+  // Reuse the code that a closure of another native context got optimized to,
+  // if it didn't embed anything specific to that native context.
+  if (FLAG_turbo_native_context_independent && osr_ast_id.IsNone()) {
+    Code* code = isolate->heap()->FindContextIndependentCode(*shared);
+    if (code != nullptr) {
+      if (FLAG_trace_opt) {
+        PrintF("[found native context independent optimized code for ");
+        function->ShortPrint();
+        PrintF("]\n");
+      }
+      cached_code = handle(code, isolate);
+      Handle<FeedbackVector> vector(function->feedback_vector(), isolate);
+      FeedbackVector::SetOptimizedCode(vector, cached_code);
+      return cached_code;
+    }
+  }
+
   // Reset profiler ticks, function is no longer considered hot.
   DCHECK(shared->is_compiled());
   shared->set_profiler_ticks(0);
@@ -908,6 +979,9 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     if (GetOptimizedCodeLater(job.get())) {
       job.release();  // The background recompile job owns this now.
 
+      // OSR code is picked up from the OSR code cache at a later back edge.
+      if (!osr_ast_id.IsNone()) return MaybeHandle<Code>();
+
       // Set the optimization marker and return a code object which checks it.
       function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
       if (function->IsInterpreted()) {
@@ -960,7 +1034,15 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
         info->closure()->ShortPrint();
         PrintF("]\n");
       }
-      info->closure()->ReplaceCode(*info->code());
+      if (info->is_osr()) {
+        // Arm the back edges again so that the next one enters the code.
+        if (shared->HasBytecodeArray()) {
+          shared->bytecode_array()->set_osr_loop_nesting_level(
+              AbstractCode::kMaxLoopNestingMarker);
+        }
+      } else {
+        info->closure()->ReplaceCode(*info->code());
+      }
       return CompilationJob::SUCCEEDED;
     }
   }
@@ -971,6 +1053,8 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
     info->closure()->ShortPrint();
     PrintF(" because: %s]\n", GetBailoutReason(info->bailout_reason()));
   }
+  // A failed OSR compilation leaves the function as it is.
+  if (info->is_osr()) return CompilationJob::FAILED;
   info->closure()->ReplaceCode(shared->code());
   // Clear the InOptimizationQueue marker, if it exists.
   if (info->closure()->IsInOptimizationQueue()) {
@@ -1016,12 +1100,19 @@ MaybeHandle<Code> GetLazyCode(Handle<JSFunction> function) {
     ParseInfo parse_info(handle(function->shared()));
     Zone compile_zone(isolate->allocator(), ZONE_NAME);
     CompilationInfo info(&compile_zone, &parse_info, isolate, function);
+    Handle<Script> script(Script::cast(function->shared()->script()));
+    PreParsedScopeData* preparsed_scope_data =
+        parse_info.preparsed_scope_data();
     if (FLAG_experimental_preparser_scope_analysis) {
-      Handle<SharedFunctionInfo> shared(function->shared());
-      Handle<Script> script(Script::cast(function->shared()->script()));
       if (script->HasPreparsedScopeData()) {
-        parse_info.preparsed_scope_data()->Deserialize(
-            script->preparsed_scope_data());
+        preparsed_scope_data->Deserialize(script->preparsed_scope_data());
+        // Inner functions can only be skipped if there is data for allocating
+        // the variables of this function. Otherwise produce new data for the
+        // inner functions instead.
+        if (!preparsed_scope_data->HasFunctionData(
+                function->shared()->start_position())) {
+          preparsed_scope_data->Clear();
+        }
       }
     }
     ConcurrencyMode inner_function_mode = FLAG_compiler_dispatcher_eager_inner
@@ -1031,6 +1122,19 @@ MaybeHandle<Code> GetLazyCode(Handle<JSFunction> function) {
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, result, GetUnoptimizedCode(&info, inner_function_mode), Code);
 
+    if (FLAG_experimental_preparser_scope_analysis &&
+        preparsed_scope_data->Producing() && !preparsed_scope_data->IsEmpty()) {
+      // Keep the data for the inner functions which were preparsed now, so
+      // that compiling them later does not preparse them again.
+      Handle<PodArray<uint32_t>> data =
+          preparsed_scope_data->Serialize(isolate);
+      if (script->HasPreparsedScopeData()) {
+        data = PreParsedScopeData::Merge(
+            isolate, handle(script->preparsed_scope_data(), isolate), data);
+      }
+      script->set_preparsed_scope_data(*data);
+    }
+
     if (FLAG_always_opt && !info.shared_info()->HasAsmWasmData()) {
       if (FLAG_trace_opt) {
         PrintF("[optimizing ");
@@ -1133,6 +1237,100 @@ Handle<SharedFunctionInfo> CompileToplevel(CompilationInfo* info) {
   return result;
 }
 
+bool FinalizeBackgroundInnerFunction(
+    BackgroundCompileJobs::InnerFunction* inner, CompilationInfo* outer_info) {
+  FunctionLiteral* literal = inner->literal;
+  Handle<Script> script = outer_info->script();
+  Handle<SharedFunctionInfo> shared =
+      Compiler::GetSharedFunctionInfo(literal, script, outer_info);
+  if (shared->is_compiled()) return true;
+
+  // The {literal} has already been numbered on the background thread.
+  SetSharedFunctionFlagsFromLiteral(literal, shared);
+
+  if (!inner->job) {
+    return GenerateUnoptimizedCodeForInnerFunction(literal, shared, outer_info);
+  }
+  inner->parse_info->set_script(script);
+  inner->parse_info->set_shared_info(shared);
+  return FinalizeUnoptimizedCompilationJob(inner->job.get()) ==
+         CompilationJob::SUCCEEDED;
+}
+
+Handle<SharedFunctionInfo> FinalizeBackgroundCompileJobs(
+    ParseInfo* parse_info, Isolate* isolate, BackgroundCompileJobs* jobs) {
+  TimerEventScope<TimerEventCompileCode> timer(isolate);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
+  PostponeInterruptsScope postpone(isolate);
+  DCHECK(!isolate->native_context().is_null());
+  RuntimeCallTimerScope runtimeTimer(isolate,
+                                     &RuntimeCallStats::CompileScript);
+  Handle<Script> script = parse_info->script();
+  VMState<COMPILER> state(isolate);
+
+  if (jobs->failed) {
+    if (!isolate->has_pending_exception()) isolate->StackOverflow();
+    return Handle<SharedFunctionInfo>::null();
+  }
+
+  CompilationInfo* info = jobs->compile_info.get();
+  DCHECK_EQ(parse_info, info->parse_info());
+  EnsureSharedFunctionInfosArrayOnScript(info);
+
+  HistogramTimerScope compile_timer(isolate->counters()->compile());
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.Compile");
+
+  // Variables were allocated on the background thread, but the scope infos
+  // live on the heap.
+  DeclarationScope::AllocateScopeInfos(parse_info, isolate,
+                                       AnalyzeMode::kRegular);
+
+  // Allocate a shared function info object.
+  FunctionLiteral* lit = parse_info->literal();
+  DCHECK_EQ(kNoSourcePosition, lit->function_token_position());
+  Handle<SharedFunctionInfo> result =
+      isolate->factory()->NewSharedFunctionInfoForLiteral(lit, script);
+  result->set_is_toplevel(true);
+  parse_info->set_shared_info(result);
+  parse_info->set_function_literal_id(result->function_literal_id());
+  SetSharedFunctionFlagsFromLiteral(lit, result);
+
+  // Install the code of the inner functions before the top-level code, which
+  // refers to their shared function infos.
+  {
+    RuntimeCallTimerScope inner_timer(isolate,
+                                      &RuntimeCallStats::CompileInnerFunction);
+    for (auto& inner : jobs->inner_functions) {
+      if (!FinalizeBackgroundInnerFunction(inner.get(), info)) {
+        if (!isolate->has_pending_exception()) isolate->StackOverflow();
+        return Handle<SharedFunctionInfo>::null();
+      }
+    }
+  }
+  if (FinalizeUnoptimizedCompilationJob(jobs->job.get()) !=
+      CompilationJob::SUCCEEDED) {
+    if (!isolate->has_pending_exception()) isolate->StackOverflow();
+    return Handle<SharedFunctionInfo>::null();
+  }
+
+  Handle<String> script_name =
+      script->name()->IsString()
+          ? Handle<String>(String::cast(script->name()))
+          : isolate->factory()->empty_string();
+  CodeEventListener::LogEventsAndTags log_tag =
+      Logger::ToNativeByScript(CodeEventListener::SCRIPT_TAG, *script);
+  PROFILE(isolate, CodeCreateEvent(log_tag, result->abstract_code(), *result,
+                                   *script_name));
+
+  script->set_compilation_state(Script::COMPILATION_STATE_COMPILED);
+  if (FLAG_experimental_preparser_scope_analysis) {
+    Handle<PodArray<uint32_t>> data =
+        parse_info->preparsed_scope_data()->Serialize(isolate);
+    script->set_preparsed_scope_data(*data);
+  }
+  return result;
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------------
@@ -1172,6 +1370,22 @@ bool Compiler::ParseAndAnalyze(CompilationInfo* info) {
   return Compiler::ParseAndAnalyze(info->parse_info(), info->isolate());
 }
 
+namespace {
+
+// Interpreted functions get their feedback vector allocated by the runtime
+// profiler once they have used up their initial interrupt budget, unless
+// something else needs the vector from the start.
+bool ShouldAllocateFeedbackLazily(Handle<JSFunction> function) {
+  if (!FLAG_lazy_feedback_allocation || FLAG_always_opt) return false;
+  Isolate* isolate = function->GetIsolate();
+  if (!isolate->is_best_effort_code_coverage()) return false;
+  SharedFunctionInfo* shared = function->shared();
+  return shared->IsInterpreted() &&
+         !shared->feedback_metadata()->HasTypeProfileSlot();
+}
+
+}  // namespace
+
 bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag) {
   if (function->is_compiled()) return true;
   Isolate* isolate = function->GetIsolate();
@@ -1200,7 +1414,9 @@ bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag) {
 
   // Install code on closure.
   function->ReplaceCode(*code);
-  JSFunction::EnsureLiterals(function);
+  if (!ShouldAllocateFeedbackLazily(function)) {
+    JSFunction::EnsureLiterals(function);
+  }
 
   // Check postconditions on success.
   DCHECK(!isolate->has_pending_exception());
@@ -1263,6 +1479,42 @@ bool Compiler::CompileDebugCode(Handle<SharedFunctionInfo> shared) {
   return true;
 }
 
+bool Compiler::CollectSourcePositions(Handle<SharedFunctionInfo> shared) {
+  Isolate* isolate = shared->GetIsolate();
+  DCHECK(AllowCompilation::IsAllowed(isolate));
+  DCHECK(shared->HasBytecodeArray());
+  Handle<BytecodeArray> bytecode(shared->bytecode_array(), isolate);
+  if (bytecode->HasSourcePositionTable()) return true;
+
+  VMState<COMPILER> state(isolate);
+  PostponeInterruptsScope postpone(isolate);
+
+  // Reparse the function and generate its bytecode once more. Nothing but the
+  // source position table of the result is kept.
+  ParseInfo parse_info(shared);
+  CompilationInfo info(parse_info.zone(), &parse_info, isolate,
+                       Handle<JSFunction>::null());
+  info.MarkAsCollectingSourcePositions();
+  if (!Compiler::ParseAndAnalyze(&info)) {
+    isolate->clear_pending_exception();
+    return false;
+  }
+  std::unique_ptr<CompilationJob> job(
+      interpreter::Interpreter::NewCompilationJob(&info));
+  if (job->PrepareJob() != CompilationJob::SUCCEEDED ||
+      job->ExecuteJob() != CompilationJob::SUCCEEDED ||
+      job->FinalizeJob() != CompilationJob::SUCCEEDED) {
+    isolate->clear_pending_exception();
+    return false;
+  }
+
+  // Source positions never influence the generated bytecode.
+  DCHECK_EQ(bytecode->length(), info.bytecode_array()->length());
+  bytecode->set_source_position_table(
+      info.bytecode_array()->source_position_table());
+  return true;
+}
+
 MaybeHandle<JSArray> Compiler::CompileForLiveEdit(Handle<Script> script) {
   Isolate* isolate = script->GetIsolate();
   DCHECK(AllowCompilation::IsAllowed(isolate));
@@ -1538,6 +1790,17 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
   CompilationCache* compilation_cache = isolate->compilation_cache();
 
+  // Scripts for which the embedder doesn't manage a cache itself can use the
+  // on-disk code cache instead.
+  bool consume_code_cache =
+      FLAG_serialize_toplevel &&
+      compile_options == ScriptCompiler::kConsumeCodeCache;
+  bool use_code_cache_dir =
+      FLAG_serialize_toplevel && CodeCacheDirectory::IsEnabled() &&
+      compile_options == ScriptCompiler::kNoCompileOptions &&
+      natives == NOT_NATIVES_CODE && extension == NULL &&
+      !isolate->debug()->is_loaded();
+
   // Do a lookup in the compilation cache but not for extensions.
   Handle<SharedFunctionInfo> result;
   Handle<Cell> vector;
@@ -1546,18 +1809,20 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     InfoVectorPair pair = compilation_cache->LookupScript(
         source, script_name, line_offset, column_offset, resource_options,
         context, language_mode);
-    if (!pair.has_shared() && FLAG_serialize_toplevel &&
-        compile_options == ScriptCompiler::kConsumeCodeCache &&
+    if (!pair.has_shared() && (consume_code_cache || use_code_cache_dir) &&
         !isolate->debug()->is_loaded()) {
-      // Then check cached code provided by embedder.
+      // Then check cached code provided by embedder or found on disk.
       HistogramTimerScope timer(isolate->counters()->compile_deserialize());
       RuntimeCallTimerScope runtimeTimer(isolate,
                                          &RuntimeCallStats::CompileDeserialize);
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.CompileDeserialize");
+      MaybeHandle<SharedFunctionInfo> maybe_result =
+          consume_code_cache
+              ? CodeSerializer::Deserialize(isolate, *cached_data, source)
+              : CodeCacheDirectory::Lookup(isolate, source);
       Handle<SharedFunctionInfo> inner_result;
-      if (CodeSerializer::Deserialize(isolate, *cached_data, source)
-              .ToHandle(&inner_result)) {
+      if (maybe_result.ToHandle(&inner_result)) {
         // Promote to per-isolate compilation cache.
         DCHECK(inner_result->is_compiled());
         Handle<FeedbackVector> feedback_vector =
@@ -1627,8 +1892,9 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     if (!context->IsNativeContext()) {
       parse_info.set_outer_scope_info(handle(context->scope_info()));
     }
-    if (FLAG_serialize_toplevel &&
-        compile_options == ScriptCompiler::kProduceCodeCache) {
+    if ((FLAG_serialize_toplevel &&
+         compile_options == ScriptCompiler::kProduceCodeCache) ||
+        use_code_cache_dir) {
       info.PrepareForSerializing();
     }
 
@@ -1657,6 +1923,14 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
           PrintF("[Compiling and serializing took %0.3f ms]\n",
                  timer.Elapsed().InMillisecondsF());
         }
+      } else if (use_code_cache_dir && !ContainsAsmModule(script)) {
+        HistogramTimerScope histogram_timer(
+            isolate->counters()->compile_serialize());
+        RuntimeCallTimerScope runtimeTimer(isolate,
+                                           &RuntimeCallStats::CompileSerialize);
+        TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                     "V8.CompileSerialize");
+        CodeCacheDirectory::Store(isolate, result, source);
       }
     }
 
@@ -1673,8 +1947,111 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   return result;
 }
 
+BackgroundCompileJobs::InnerFunction::InnerFunction() : literal(nullptr) {}
+
+BackgroundCompileJobs::InnerFunction::~InnerFunction() {}
+
+BackgroundCompileJobs::BackgroundCompileJobs() : failed(false) {}
+
+BackgroundCompileJobs::~BackgroundCompileJobs() {}
+
+bool Compiler::CanCompileOnBackgroundThread(ParseInfo* info,
+                                            Isolate* isolate) {
+  if (!FLAG_script_streaming_compile || !FLAG_ignition) return false;
+  // Asm.js code and its inner functions use other compilers.
+  if (FLAG_validate_asm) return false;
+  // The following need handles to the script or the shared function info,
+  // which only exist once the main thread takes over.
+  if (FLAG_type_profile || FLAG_print_bytecode || FLAG_print_ast ||
+      FLAG_trace_codegen) {
+    return false;
+  }
+  if (FLAG_block_coverage && isolate->is_block_code_coverage()) {
+    return false;
+  }
+  return info->is_toplevel() && !info->is_eval() && !info->is_module();
+}
+
+BackgroundCompileJobs* Compiler::CompileOnBackgroundThread(
+    ParseInfo* info, Isolate* isolate, uintptr_t stack_limit) {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileOnBackgroundThread");
+  DCHECK_NOT_NULL(info->literal());
+
+  std::unique_ptr<BackgroundCompileJobs> jobs(new BackgroundCompileJobs());
+  uintptr_t main_thread_stack_limit = info->stack_limit();
+  info->set_stack_limit(stack_limit);
+
+  // From here on the AST is modified, so a failure can't fall back to compiling
+  // on the main thread.
+  EagerInnerFunctionLiterals inner_literals;
+  if (!Rewriter::RewriteOnBackgroundThread(info)) {
+    jobs->failed = true;
+  } else {
+    DeclarationScope::AnalyzeOnBackgroundThread(info);
+    jobs->failed = !Renumber(info, &inner_literals);
+  }
+
+  if (!jobs->failed) {
+    for (auto it : inner_literals) {
+      std::unique_ptr<BackgroundCompileJobs::InnerFunction> inner(
+          new BackgroundCompileJobs::InnerFunction());
+      FunctionLiteral* literal = it->value();
+      inner->literal = literal;
+      // Functions inside asm.js modules are compiled by full-codegen on the
+      // main thread.
+      if (!literal->scope()->asm_function()) {
+        ParseInfo* inner_info = new ParseInfo(isolate->allocator());
+        inner->parse_info.reset(inner_info);
+        inner_info->set_hash_seed(info->hash_seed());
+        inner_info->set_stack_limit(stack_limit);
+        inner_info->set_unicode_cache(info->unicode_cache());
+        inner_info->set_runtime_call_stats(info->runtime_call_stats());
+        inner_info->set_ast_string_constants(info->ast_string_constants());
+        inner_info->set_literal(literal);
+        inner_info->set_function_literal_id(literal->function_literal_id());
+        inner_info->set_language_mode(literal->scope()->language_mode());
+        inner_info->set_ast_value_factory(info->ast_value_factory());
+        inner_info->set_ast_value_factory_owned(false);
+        inner->compile_info.reset(new CompilationInfo(
+            inner_info->zone(), inner_info, isolate,
+            Handle<JSFunction>::null()));
+        inner->job.reset(interpreter::Interpreter::NewCompilationJob(
+            inner->compile_info.get()));
+        inner->job->set_stack_limit(stack_limit);
+        if (inner->job->PrepareJobOnBackgroundThread() !=
+                CompilationJob::SUCCEEDED ||
+            inner->job->ExecuteJob() != CompilationJob::SUCCEEDED) {
+          jobs->failed = true;
+          break;
+        }
+      }
+      jobs->inner_functions.push_back(std::move(inner));
+    }
+  }
+
+  if (!jobs->failed) {
+    jobs->compile_zone.reset(new Zone(isolate->allocator(), ZONE_NAME));
+    jobs->compile_info.reset(new CompilationInfo(
+        jobs->compile_zone.get(), info, isolate, Handle<JSFunction>::null()));
+    jobs->job.reset(
+        interpreter::Interpreter::NewCompilationJob(jobs->compile_info.get()));
+    jobs->job->set_stack_limit(stack_limit);
+    jobs->failed = jobs->job->PrepareJobOnBackgroundThread() !=
+                       CompilationJob::SUCCEEDED ||
+                   jobs->job->ExecuteJob() != CompilationJob::SUCCEEDED;
+  }
+
+  info->set_stack_limit(main_thread_stack_limit);
+  return jobs.release();
+}
+
 Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForStreamedScript(
-    Handle<Script> script, ParseInfo* parse_info, int source_length) {
+    Handle<Script> script, ParseInfo* parse_info, int source_length,
+    BackgroundCompileJobs* background_jobs) {
   Isolate* isolate = script->GetIsolate();
   // TODO(titzer): increment the counters in caller.
   isolate->counters()->total_load_size()->Increment(source_length);
@@ -1684,14 +2061,21 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForStreamedScript(
   parse_info->set_language_mode(
       static_cast<LanguageMode>(parse_info->language_mode() | language_mode));
 
-  Zone compile_zone(isolate->allocator(), ZONE_NAME);
-  CompilationInfo compile_info(&compile_zone, parse_info, isolate,
-                               Handle<JSFunction>::null());
+  Handle<SharedFunctionInfo> result;
+  if (background_jobs != nullptr) {
+    result =
+        FinalizeBackgroundCompileJobs(parse_info, isolate, background_jobs);
+  } else {
+    Zone compile_zone(isolate->allocator(), ZONE_NAME);
+    CompilationInfo compile_info(&compile_zone, parse_info, isolate,
+                                 Handle<JSFunction>::null());
 
-  // The source was parsed lazily, so compiling for debugging is not possible.
-  DCHECK(!compile_info.is_debug());
+    // The source was parsed lazily, so compiling for debugging is not
+    // possible.
+    DCHECK(!compile_info.is_debug());
 
-  Handle<SharedFunctionInfo> result = CompileToplevel(&compile_info);
+    result = CompileToplevel(&compile_info);
+  }
   if (!result.is_null()) isolate->debug()->OnAfterCompile(script);
   return result;
 }
@@ -1758,11 +2142,13 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForNative(
 
 MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
                                                    BailoutId osr_ast_id,
-                                                   JavaScriptFrame* osr_frame) {
+                                                   JavaScriptFrame* osr_frame,
+                                                   ConcurrencyMode mode) {
   DCHECK(!osr_ast_id.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(function, ConcurrencyMode::kNotConcurrent, osr_ast_id,
-                          osr_frame);
+  DCHECK_IMPLIES(mode == ConcurrencyMode::kConcurrent,
+                 osr_frame->is_interpreted());
+  return GetOptimizedCode(function, mode, osr_ast_id, osr_frame);
 }
 
 CompilationJob* Compiler::PrepareUnoptimizedCompilationJob(
@@ -1808,8 +2194,12 @@ void Compiler::PostInstantiation(Handle<JSFunction> function,
   }
 
   if (shared->is_compiled()) {
-    // TODO(mvstanton): pass pretenure flag to EnsureLiterals.
-    JSFunction::EnsureLiterals(function);
+    if (!ShouldAllocateFeedbackLazily(function)) {
+      // TODO(mvstanton): pass pretenure flag to EnsureLiterals.
+      JSFunction::EnsureLiterals(function);
+    }
+    // The vector of a lazily allocating closure may not exist yet.
+    if (!function->has_feedback_vector()) return;
 
     Code* code = function->feedback_vector()->optimized_code();
     if (code != nullptr) {
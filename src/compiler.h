@@ -6,6 +6,7 @@
 #define V8_COMPILER_H_
 
 #include <memory>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/bailout-reason.h"
@@ -17,6 +18,7 @@ namespace v8 {
 namespace internal {
 
 // Forward declarations.
+struct BackgroundCompileJobs;
 class CompilationInfo;
 class CompilationJob;
 class JavaScriptFrame;
@@ -52,6 +54,11 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static bool CompileDebugCode(Handle<SharedFunctionInfo> shared);
   static MaybeHandle<JSArray> CompileForLiveEdit(Handle<Script> script);
 
+  // Regenerates the bytecode of {shared} to recover the source position table
+  // that was left out by --enable-lazy-source-positions, and installs it on
+  // the existing bytecode. Returns {false} if the table could not be collected.
+  static bool CollectSourcePositions(Handle<SharedFunctionInfo> shared);
+
   // Prepare a compilation job for unoptimized code. Requires ParseAndAnalyse.
   static CompilationJob* PrepareUnoptimizedCompilationJob(
       CompilationInfo* info);
@@ -121,10 +128,23 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       ScriptCompiler::CompileOptions compile_options,
       NativesFlag is_natives_code);
 
+  // Returns true if a streamed script can be compiled to bytecode on the
+  // background thread that parses it. Must be called on the main thread.
+  static bool CanCompileOnBackgroundThread(ParseInfo* info, Isolate* isolate);
+
+  // Analyzes a streamed script that was just parsed on a background thread and
+  // generates bytecode for its top-level code and its eager inner functions,
+  // without touching the heap. Requires CanCompileOnBackgroundThread.
+  static BackgroundCompileJobs* CompileOnBackgroundThread(
+      ParseInfo* info, Isolate* isolate, uintptr_t stack_limit);
+
   // Create a shared function info object for a Script that has already been
-  // parsed while the script was being loaded from a streamed source.
+  // parsed while the script was being loaded from a streamed source. If
+  // {background_jobs} is non-null, the bytecode generated on the background
+  // thread is finalized instead of compiling the script again.
   static Handle<SharedFunctionInfo> GetSharedFunctionInfoForStreamedScript(
-      Handle<Script> script, ParseInfo* info, int source_length);
+      Handle<Script> script, ParseInfo* info, int source_length,
+      BackgroundCompileJobs* background_jobs = nullptr);
 
   // Create a shared function info object (the code may be lazily compiled).
   static Handle<SharedFunctionInfo> GetSharedFunctionInfo(
@@ -144,9 +164,12 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // In concurrent mode an empty handle is also returned once the compilation
+  // has been queued, the code is then found in the OSR code cache later.
   MUST_USE_RESULT static MaybeHandle<Code> GetOptimizedCodeForOSR(
       Handle<JSFunction> function, BailoutId osr_ast_id,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame,
+      ConcurrencyMode mode = ConcurrencyMode::kNotConcurrent);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
@@ -177,6 +200,10 @@ class V8_EXPORT_PRIVATE CompilationJob {
   // Prepare the compile job. Must be called on the main thread.
   MUST_USE_RESULT Status PrepareJob();
 
+  // Prepare the compile job on a background thread. Only valid for jobs
+  // that neither allocate nor dereference handles while preparing.
+  MUST_USE_RESULT Status PrepareJobOnBackgroundThread();
+
   // Executes the compile job. Can be called on a background thread if
   // can_execute_on_background_thread() returns true.
   MUST_USE_RESULT Status ExecuteJob();
@@ -237,6 +264,37 @@ class V8_EXPORT_PRIVATE CompilationJob {
   }
 };
 
+// The result of Compiler::CompileOnBackgroundThread. Owns the compilation
+// jobs for the top-level code and the eager inner functions of a streamed
+// script until they are finalized on the main thread.
+struct BackgroundCompileJobs {
+  struct InnerFunction {
+    InnerFunction();
+    ~InnerFunction();
+
+    FunctionLiteral* literal;
+    // The following are null if the function has to be compiled on the main
+    // thread, e.g. because it is part of an asm.js module.
+    std::unique_ptr<ParseInfo> parse_info;
+    std::unique_ptr<CompilationInfo> compile_info;
+    std::unique_ptr<CompilationJob> job;
+  };
+
+  BackgroundCompileJobs();
+  ~BackgroundCompileJobs();
+
+  // Set if compilation ran out of stack. The AST has been modified, so the
+  // script cannot be compiled again and the main thread throws instead.
+  bool failed;
+  std::unique_ptr<Zone> compile_zone;
+  std::unique_ptr<CompilationInfo> compile_info;
+  std::unique_ptr<CompilationJob> job;
+  std::vector<std::unique_ptr<InnerFunction>> inner_functions;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(BackgroundCompileJobs);
+};
+
 }  // namespace internal
 }  // namespace v8
 
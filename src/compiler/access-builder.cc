@@ -10,6 +10,7 @@
 #include "src/handles-inl.h"
 #include "src/heap/heap.h"
 #include "src/objects-inl.h"
+#include "src/objects/debug-objects.h"
 
 namespace v8 {
 namespace internal {
@@ -834,6 +835,18 @@ FieldAccess AccessBuilder::ForContextSlot(size_t index) {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForCoverageInfoBlockCount(int slot_index) {
+  FieldAccess access = {kTaggedBase,
+                        CoverageInfo::OffsetOfBlockCount(slot_index),
+                        Handle<Name>(),
+                        MaybeHandle<Map>(),
+                        Type::UnsignedSmall(),
+                        MachineType::TaggedSigned(),
+                        kNoWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForContextExtensionScopeInfo() {
   FieldAccess access = {
@@ -263,6 +263,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to Context slots.
   static FieldAccess ForContextSlot(size_t index);
 
+  // Provides access to the block counters of CoverageInfo.
+  static FieldAccess ForCoverageInfoBlockCount(int slot_index);
+
   // Provides access to ContextExtension fields.
   static FieldAccess ForContextExtensionScopeInfo();
   static FieldAccess ForContextExtensionExtension();
@@ -4,12 +4,100 @@
 
 #include "src/compiler/instruction-scheduler.h"
 
+#include "src/base/cpu.h"
+#include "src/base/once.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// The core the latency model is selected for. Out-of-order cores such as the
+// Cortex-A57 and Cortex-A72 use the default table below; in-order cores such
+// as the Cortex-A53 and Cortex-A55 depend on the schedule to hide latencies
+// and get their own table.
+enum class CpuModel { kOutOfOrder, kInOrder };
+
+CpuModel cpu_model = CpuModel::kOutOfOrder;
+base::OnceType detect_cpu_model_once = V8_ONCE_INIT;
+
+void DetectCpuModel() {
+  base::CPU cpu;
+  if (cpu.implementer() == base::CPU::ARM &&
+      (cpu.part() == base::CPU::ARM_CORTEX_A53 ||
+       cpu.part() == base::CPU::ARM_CORTEX_A55)) {
+    cpu_model = CpuModel::kInOrder;
+  }
+}
+
+CpuModel GetCpuModel() {
+  base::CallOnce(&detect_cpu_model_once, &DetectCpuModel);
+  return cpu_model;
+}
+
+// Latencies on in-order cores, following the Cortex-A53 and Cortex-A55
+// software optimization guides. Returns 0 for instructions that use the
+// default latency.
+int GetInOrderInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kArm64Ldr:
+    case kArm64LdrW:
+    case kArm64Ldrb:
+    case kArm64Ldrh:
+    case kArm64Ldrsb:
+    case kArm64Ldrsh:
+    case kArm64Ldrsw:
+      return 3;
+    case kArm64LdrD:
+    case kArm64LdrS:
+      return 4;
+    case kArm64Madd32:
+    case kArm64Mneg32:
+    case kArm64Msub32:
+    case kArm64Mul32:
+      return 3;
+    case kArm64Madd:
+    case kArm64Mneg:
+    case kArm64Msub:
+    case kArm64Mul:
+      return 4;
+    case kArm64Idiv32:
+    case kArm64Udiv32:
+      return 8;
+    case kArm64Idiv:
+    case kArm64Udiv:
+      return 16;
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
+      return 4;
+    case kArm64Float32Div:
+      return 10;
+    case kArm64Float32Sqrt:
+      return 12;
+    case kArm64Float64Div:
+      return 19;
+    case kArm64Float64Sqrt:
+      return 22;
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+int InstructionScheduler::GetIssueWidth() {
+  // The in-order cores are dual-issue, the out-of-order ones decode three
+  // instructions per cycle.
+  return GetCpuModel() == CpuModel::kInOrder ? 2 : 3;
+}
+
 
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
@@ -320,6 +408,10 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  if (GetCpuModel() == CpuModel::kInOrder) {
+    int latency = GetInOrderInstructionLatency(instr);
+    if (latency != 0) return latency;
+  }
   // Basic latency modeling for arm64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
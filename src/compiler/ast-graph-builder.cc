@@ -1774,10 +1774,10 @@ void AstGraphBuilder::VisitCompareOperation(CompareOperation* expr) {
       op = javascript()->GreaterThanOrEqual(hint);
       break;
     case Token::INSTANCEOF:
-      op = javascript()->InstanceOf();
+      op = javascript()->InstanceOf(VectorSlotPair());
       break;
     case Token::IN:
-      op = javascript()->HasProperty();
+      op = javascript()->HasProperty(VectorSlotPair());
       break;
     default:
       op = nullptr;
@@ -13,6 +13,7 @@
 #include "src/compiler/simplified-operator.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/objects-inl.h"
+#include "src/objects/debug-objects.h"
 #include "src/objects/literal-objects.h"
 
 namespace v8 {
@@ -2036,11 +2037,13 @@ void BytecodeGraphBuilder::BuildTestingOp(const Operator* op) {
 }
 
 void BytecodeGraphBuilder::VisitTestIn() {
-  BuildTestingOp(javascript()->HasProperty());
+  int const slot_index = bytecode_iterator().GetIndexOperand(1);
+  BuildTestingOp(javascript()->HasProperty(CreateVectorSlotPair(slot_index)));
 }
 
 void BytecodeGraphBuilder::VisitTestInstanceOf() {
-  BuildTestingOp(javascript()->InstanceOf());
+  int const slot_index = bytecode_iterator().GetIndexOperand(1);
+  BuildTestingOp(javascript()->InstanceOf(CreateVectorSlotPair(slot_index)));
 }
 
 void BytecodeGraphBuilder::VisitTestUndetectable() {
@@ -2269,6 +2272,21 @@ void BytecodeGraphBuilder::VisitSwitchOnSmiNoFeedback() {
   BuildSwitchOnSmi(acc_smi);
 }
 
+void BytecodeGraphBuilder::VisitSwitchOnSmi() {
+  Node* acc = environment()->LookupAccumulator();
+  NewBranch(NewNode(simplified()->ObjectIsSmi(), acc));
+  {
+    SubEnvironment sub_environment(this);
+    NewIfTrue();
+    Node* acc_smi = NewNode(common()->TypeGuard(Type::SignedSmall()), acc);
+    BuildSwitchOnSmi(acc_smi);
+    // Smis that have no entry in the table fall through as well.
+    MergeIntoSuccessorEnvironment(bytecode_iterator().current_offset() +
+                                  bytecode_iterator().current_bytecode_size());
+  }
+  NewIfFalse();
+}
+
 void BytecodeGraphBuilder::VisitStackCheck() {
   PrepareEagerCheckpoint();
   Node* node = NewNode(javascript()->StackCheck());
@@ -2304,9 +2322,26 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK);
 void BytecodeGraphBuilder::VisitIncBlockCounter() {
   DCHECK(FLAG_block_coverage);
 
+  int slot_index = bytecode_iterator().GetIndexOperand(0);
+  Handle<SharedFunctionInfo> shared = frame_state_function_info_->shared_info();
+  if (shared->HasCoverageInfo()) {
+    // Increment the counter in place, saturating at the maximum Smi value, so
+    // that optimized code can keep collecting coverage cheaply.
+    Handle<CoverageInfo> coverage_info(
+        CoverageInfo::cast(shared->GetDebugInfo()->coverage_info()));
+    FieldAccess const access =
+        AccessBuilder::ForCoverageInfoBlockCount(slot_index);
+    Node* object = jsgraph()->HeapConstant(coverage_info);
+    Node* count = NewNode(simplified()->LoadField(access), object);
+    count = NewNode(simplified()->NumberAdd(), count, jsgraph()->OneConstant());
+    count = NewNode(simplified()->NumberMin(), count,
+                    jsgraph()->Constant(Smi::kMaxValue));
+    NewNode(simplified()->StoreField(access), object, count);
+    return;
+  }
+
   Node* closure = GetFunctionClosure();
-  Node* coverage_array_slot =
-      jsgraph()->Constant(bytecode_iterator().GetIndexOperand(0));
+  Node* coverage_array_slot = jsgraph()->Constant(slot_index);
 
   const Operator* op = javascript()->CallRuntime(Runtime::kIncBlockCounter);
 
@@ -2380,6 +2415,11 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
       jsgraph()->Constant(bytecode_iterator().current_offset() +
                           (BytecodeArray::kHeaderSize - kHeapObjectTag));
 
+  // Registers that are dead at the matching resume point need not be saved,
+  // which the store lowering recognizes by the optimized-out marker.
+  const BytecodeLivenessState* liveness = GetResumeLivenessFor(
+      bytecode_iterator().current_offset());
+
   int value_input_count = 3 + register_count;
 
   Node** value_inputs = local_zone()->NewArray<Node*>(value_input_count);
@@ -2388,7 +2428,9 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
   value_inputs[2] = offset;
   for (int i = 0; i < register_count; ++i) {
     value_inputs[3 + i] =
-        environment()->LookupRegister(interpreter::Register(i));
+        liveness == nullptr || liveness->RegisterIsLive(i)
+            ? environment()->LookupRegister(interpreter::Register(i))
+            : jsgraph()->OptimizedOutConstant();
   }
 
   MakeNode(javascript()->GeneratorStore(register_count, flags),
@@ -2414,14 +2456,45 @@ void BytecodeGraphBuilder::VisitRestoreGeneratorRegisters() {
   int register_count =
       static_cast<int>(bytecode_iterator().GetRegisterCountOperand(2));
 
+  const BytecodeLivenessState* liveness =
+      bytecode_analysis()->GetOutLivenessFor(
+          bytecode_iterator().current_offset());
+
   // Bijection between registers and array indices must match that used in
-  // InterpreterAssembler::ExportRegisterFile.
+  // InterpreterAssembler::ExportRegisterFile. Registers that are dead after
+  // the resume were not saved by optimized code and are not loaded either.
   for (int i = 0; i < register_count; ++i) {
-    Node* value = NewNode(javascript()->GeneratorRestoreRegister(i), generator);
+    Node* value;
+    if (liveness == nullptr || liveness->RegisterIsLive(i)) {
+      value = NewNode(javascript()->GeneratorRestoreRegister(i), generator);
+    } else {
+      value = jsgraph()->OptimizedOutConstant();
+    }
     environment()->BindRegister(interpreter::Register(i), value);
   }
 }
 
+const BytecodeLivenessState* BytecodeGraphBuilder::GetResumeLivenessFor(
+    int suspend_offset) {
+  if (!FLAG_analyze_environment_liveness) return nullptr;
+  // The resume point of a suspend is bound right behind the bytecodes that
+  // return from the generator, so the scan only visits a few bytecodes.
+  interpreter::BytecodeArrayIterator iterator(bytecode_array());
+  for (iterator.SetOffset(suspend_offset); !iterator.done();
+       iterator.Advance()) {
+    if (iterator.current_bytecode() ==
+        interpreter::Bytecode::kSuspendGenerator &&
+        iterator.current_offset() != suspend_offset) {
+      break;
+    }
+    if (iterator.current_bytecode() ==
+        interpreter::Bytecode::kRestoreGeneratorRegisters) {
+      return bytecode_analysis()->GetOutLivenessFor(iterator.current_offset());
+    }
+  }
+  return nullptr;
+}
+
 void BytecodeGraphBuilder::VisitWide() {
   // Consumed by the BytecodeArrayIterator.
   UNREACHABLE();
@@ -146,6 +146,10 @@ class BytecodeGraphBuilder {
   // Conceptually this frame state is "after" a given operation.
   void PrepareFrameState(Node* node, OutputFrameStateCombine combine);
 
+  // Returns the liveness after the RestoreGeneratorRegisters that resumes the
+  // suspend at {suspend_offset}, or nullptr if it is unknown.
+  const BytecodeLivenessState* GetResumeLivenessFor(int suspend_offset);
+
   void BuildCreateArguments(CreateArgumentsType type);
   Node* BuildLoadGlobal(Handle<Name> name, uint32_t feedback_slot_index,
                         TypeofMode typeof_mode);
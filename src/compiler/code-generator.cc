@@ -555,7 +555,14 @@ Handle<PodArray<InliningPosition>> CreateInliningPositions(
 void CodeGenerator::PopulateDeoptimizationData(Handle<Code> code_object) {
   CompilationInfo* info = this->info();
   int deopt_count = static_cast<int>(deoptimization_states_.size());
-  if (deopt_count == 0 && !info->is_osr()) return;
+  // The inlining positions are needed to symbolize source positions of
+  // inlined functions, even if the code cannot deoptimize. Native context
+  // independent code is looked up by the shared function info recorded here.
+  if (deopt_count == 0 && !info->is_osr() &&
+      info->inlined_functions().empty() &&
+      !info->is_native_context_independent()) {
+    return;
+  }
   Handle<DeoptimizationInputData> data =
       DeoptimizationInputData::New(isolate(), deopt_count, TENURED);
 
@@ -573,6 +580,21 @@ void CodeGenerator::PopulateDeoptimizationData(Handle<Code> code_object) {
     data->SetSharedFunctionInfo(Smi::kZero);
   }
 
+  // Keep the bytecode of the function and all inlined functions alive for as
+  // long as the optimized code, so that bytecode flushing never removes the
+  // frames a deoptimization resumes in.
+  if (info->has_shared_info() && info->shared_info()->HasBytecodeArray()) {
+    DefineDeoptimizationLiteral(DeoptimizationLiteral(
+        handle(info->shared_info()->bytecode_array(), isolate())));
+  }
+  for (CompilationInfo::InlinedFunctionHolder& inlined :
+       info->inlined_functions()) {
+    if (inlined.shared_info->HasBytecodeArray()) {
+      DefineDeoptimizationLiteral(DeoptimizationLiteral(
+          handle(inlined.shared_info->bytecode_array(), isolate())));
+    }
+  }
+
   Handle<FixedArray> literals = isolate()->factory()->NewFixedArray(
       static_cast<int>(deoptimization_literals_.size()), TENURED);
   for (unsigned i = 0; i < deoptimization_literals_.size(); i++) {
@@ -853,11 +875,14 @@ int CodeGenerator::BuildTranslation(Instruction* instr, int pc_offset,
   InstructionOperandIterator iter(instr, frame_state_offset);
   BuildTranslationForFrameStateDescriptor(descriptor, &iter, &translation,
                                           state_combine);
+  // Deopt points with the same frame state, e.g. the checks of one bytecode,
+  // share a single copy of the translation.
+  int translation_index = translations_.ShareTranslation(translation.index());
 
   int deoptimization_id = static_cast<int>(deoptimization_states_.size());
 
   deoptimization_states_.push_back(new (zone()) DeoptimizationState(
-      descriptor->bailout_id(), translation.index(), pc_offset, entry.kind(),
+      descriptor->bailout_id(), translation_index, pc_offset, entry.kind(),
       entry.reason()));
 
   return deoptimization_id;
@@ -998,6 +1023,19 @@ DeoptimizationExit* CodeGenerator::AddDeoptimizationExit(
     Instruction* instr, size_t frame_state_offset) {
   int const deoptimization_id = BuildTranslation(
       instr, -1, frame_state_offset, OutputFrameStateCombine::Ignore());
+  // Consecutive checks that deoptimize to the same state for the same reason,
+  // e.g. the checks for a single bytecode, share one exit and bailout id.
+  if (!deoptimization_exits_.empty()) {
+    DeoptimizationExit* const last = deoptimization_exits_.back();
+    if (last->pos() == current_source_position_ &&
+        deoptimization_states_[last->deoptimization_id()]->Equals(
+            deoptimization_states_[deoptimization_id])) {
+      DCHECK_EQ(deoptimization_id,
+                static_cast<int>(deoptimization_states_.size()) - 1);
+      deoptimization_states_.pop_back();
+      return last;
+    }
+  }
   DeoptimizationExit* const exit = new (zone())
       DeoptimizationExit(deoptimization_id, current_source_position_);
   deoptimization_exits_.push_back(exit);
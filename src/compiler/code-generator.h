@@ -285,6 +285,13 @@ class CodeGenerator final : public GapResolver::Assembler {
     DeoptimizeKind kind() const { return kind_; }
     DeoptimizeReason reason() const { return reason_; }
 
+    bool Equals(const DeoptimizationState* other) const {
+      return bailout_id_ == other->bailout_id_ &&
+             translation_id_ == other->translation_id_ &&
+             pc_offset_ == other->pc_offset_ && kind_ == other->kind_ &&
+             reason_ == other->reason_;
+    }
+
    private:
     BailoutId bailout_id_;
     int translation_id_;
@@ -2168,15 +2168,140 @@ Node* EffectControlLinearizer::LowerStringCharCodeAt(Node* node) {
   Node* receiver = node->InputAt(0);
   Node* position = node->InputAt(1);
 
-  Callable const callable =
-      Builtins::CallableFor(isolate(), Builtins::kStringCharCodeAt);
-  Operator::Properties properties = Operator::kNoThrow | Operator::kNoWrite;
-  CallDescriptor::Flags flags = CallDescriptor::kNoFlags;
-  CallDescriptor* desc = Linkage::GetStubCallDescriptor(
-      isolate(), graph()->zone(), callable.descriptor(), 0, flags, properties,
-      MachineType::TaggedSigned());
-  return __ Call(desc, __ HeapConstant(callable.code()), receiver, position,
-                 __ NoContextConstant());
+  auto if_thin = __ MakeLabel<1>();
+  auto if_sliced = __ MakeLabel<1>();
+  auto if_unwrapped = __ MakeLabel<3>(MachineRepresentation::kTagged,
+                                      MachineRepresentation::kWord32);
+  auto if_direct = __ MakeLabel<2>(MachineRepresentation::kTagged,
+                                   MachineRepresentation::kWord32,
+                                   MachineRepresentation::kWord32);
+  auto if_external = __ MakeLabel<1>();
+  auto if_seq_one_byte = __ MakeLabel<1>();
+  auto if_external_one_byte = __ MakeLabel<1>();
+  auto if_runtime = __ MakeDeferredLabel<3>();
+  auto done = __ MakeLabel<5>(MachineRepresentation::kWord32);
+
+  // Sequential and external strings are loaded from directly.
+  Node* receiver_map = __ LoadField(AccessBuilder::ForMap(), receiver);
+  Node* receiver_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), receiver_map);
+  Node* receiver_representation = __ Word32And(
+      receiver_instance_type, __ Int32Constant(kStringRepresentationMask));
+  Node* receiver_is_direct = __ Word32Equal(
+      __ Word32And(receiver_representation,
+                   __ Int32Constant(kIsIndirectStringMask)),
+      __ Int32Constant(0));
+  __ GotoIf(receiver_is_direct, &if_direct, receiver, position,
+            receiver_instance_type);
+
+  // Look through one level of thin, sliced or flat cons strings, which
+  // covers all indirect strings that the runtime hands out after flattening.
+  __ GotoIf(__ Word32Equal(receiver_representation,
+                           __ Int32Constant(kThinStringTag)),
+            &if_thin);
+  __ GotoIf(__ Word32Equal(receiver_representation,
+                           __ Int32Constant(kSlicedStringTag)),
+            &if_sliced);
+  {
+    Node* second = __ LoadField(AccessBuilder::ForConsStringSecond(), receiver);
+    __ GotoUnless(__ WordEqual(second, __ EmptyStringConstant()), &if_runtime);
+    Node* first = __ LoadField(AccessBuilder::ForConsStringFirst(), receiver);
+    __ Goto(&if_unwrapped, first, position);
+  }
+
+  __ Bind(&if_thin);
+  {
+    Node* actual = __ LoadField(AccessBuilder::ForThinStringActual(), receiver);
+    __ Goto(&if_unwrapped, actual, position);
+  }
+
+  __ Bind(&if_sliced);
+  {
+    Node* offset = ChangeSmiToInt32(
+        __ LoadField(AccessBuilder::ForSlicedStringOffset(), receiver));
+    Node* parent =
+        __ LoadField(AccessBuilder::ForSlicedStringParent(), receiver);
+    __ Goto(&if_unwrapped, parent, __ Int32Add(position, offset));
+  }
+
+  __ Bind(&if_unwrapped);
+  {
+    Node* string = if_unwrapped.PhiAt(0);
+    Node* index = if_unwrapped.PhiAt(1);
+    Node* string_map = __ LoadField(AccessBuilder::ForMap(), string);
+    Node* string_instance_type =
+        __ LoadField(AccessBuilder::ForMapInstanceType(), string_map);
+    __ GotoIf(
+        __ Word32Equal(__ Word32And(string_instance_type,
+                                    __ Int32Constant(kIsIndirectStringMask)),
+                       __ Int32Constant(0)),
+        &if_direct, string, index, string_instance_type);
+    __ Goto(&if_runtime);
+  }
+
+  __ Bind(&if_direct);
+  {
+    Node* string = if_direct.PhiAt(0);
+    Node* index = if_direct.PhiAt(1);
+    Node* instance_type = if_direct.PhiAt(2);
+    Node* is_one_byte = __ Word32Equal(
+        __ Word32And(instance_type, __ Int32Constant(kStringEncodingMask)),
+        __ Int32Constant(kOneByteStringTag));
+    __ GotoIf(__ Word32Equal(__ Word32And(instance_type,
+                                          __ Int32Constant(
+                                              kStringRepresentationMask)),
+                             __ Int32Constant(kExternalStringTag)),
+              &if_external);
+
+    __ GotoIf(is_one_byte, &if_seq_one_byte);
+    Node* seq_two_byte_result = __ LoadElement(
+        AccessBuilder::ForSeqTwoByteStringCharacter(), string, index);
+    __ Goto(&done, seq_two_byte_result);
+
+    __ Bind(&if_seq_one_byte);
+    Node* seq_one_byte_result = __ LoadElement(
+        AccessBuilder::ForSeqOneByteStringCharacter(), string, index);
+    __ Goto(&done, seq_one_byte_result);
+
+    // Short external strings don't cache their resource data.
+    __ Bind(&if_external);
+    __ GotoIf(__ Word32Equal(__ Word32And(instance_type,
+                                          __ Int32Constant(
+                                              kShortExternalStringMask)),
+                             __ Int32Constant(kShortExternalStringTag)),
+              &if_runtime);
+    Node* data =
+        __ LoadField(AccessBuilder::ForExternalStringResourceData(), string);
+    Node* offset = machine()->Is64() ? __ ChangeUint32ToUint64(index) : index;
+    __ GotoIf(is_one_byte, &if_external_one_byte);
+    Node* external_two_byte_result =
+        __ Load(MachineType::Uint16(), data,
+                __ WordShl(offset, __ IntPtrConstant(1)));
+    __ Goto(&done, external_two_byte_result);
+
+    __ Bind(&if_external_one_byte);
+    Node* external_one_byte_result =
+        __ Load(MachineType::Uint8(), data, offset);
+    __ Goto(&done, external_one_byte_result);
+  }
+
+  // Let the builtin flatten the {receiver} and deal with everything else.
+  __ Bind(&if_runtime);
+  {
+    Callable const callable =
+        Builtins::CallableFor(isolate(), Builtins::kStringCharCodeAt);
+    Operator::Properties properties = Operator::kNoThrow | Operator::kNoWrite;
+    CallDescriptor::Flags flags = CallDescriptor::kNoFlags;
+    CallDescriptor* desc = Linkage::GetStubCallDescriptor(
+        isolate(), graph()->zone(), callable.descriptor(), 0, flags,
+        properties, MachineType::TaggedSigned());
+    Node* result = __ Call(desc, __ HeapConstant(callable.code()), receiver,
+                           position, __ NoContextConstant());
+    __ Goto(&done, ChangeSmiToInt32(result));
+  }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
 }
 
 Node* EffectControlLinearizer::LowerSeqStringCharCodeAt(Node* node) {
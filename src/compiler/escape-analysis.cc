@@ -1476,6 +1476,19 @@ int OffsetForElementAccess(Node* node, int index) {
   return access.header_size / kPointerSize + index;
 }
 
+// Returns the node that determines the index of the element access {node}.
+// Bounds checks are looked through, as they stay in the effect chain and
+// still guard the access. This way accesses with a constant index into an
+// array resolve against the virtual object even if the check stays around
+// until simplified lowering.
+Node* ElementAccessIndex(Node* node) {
+  Node* index = node->InputAt(1);
+  if (index->opcode() == IrOpcode::kCheckBounds) {
+    index = NodeProperties::GetValueInput(index, 0);
+  }
+  return index;
+}
+
 }  // namespace
 
 void EscapeAnalysis::ProcessLoadField(Node* node) {
@@ -1556,13 +1569,13 @@ void EscapeAnalysis::ProcessLoadElement(Node* node) {
   ForwardVirtualState(node);
   Node* from = ResolveReplacement(NodeProperties::GetValueInput(node, 0));
   VirtualState* state = virtual_states_[node->id()];
-  Node* index_node = node->InputAt(1);
+  Node* index_node = ElementAccessIndex(node);
   NumberMatcher index(index_node);
   DCHECK(index_node->opcode() != IrOpcode::kInt32Constant &&
          index_node->opcode() != IrOpcode::kInt64Constant &&
          index_node->opcode() != IrOpcode::kFloat32Constant &&
          index_node->opcode() != IrOpcode::kFloat64Constant);
-  if (index.HasValue()) {
+  if (index.HasValue() && index.Value() >= 0) {
     if (VirtualObject* object = GetVirtualObject(state, from)) {
       if (!object->IsTracked()) return;
       int offset = OffsetForElementAccess(node, index.Value());
@@ -1631,14 +1644,14 @@ void EscapeAnalysis::ProcessStoreElement(Node* node) {
   DCHECK_EQ(node->opcode(), IrOpcode::kStoreElement);
   ForwardVirtualState(node);
   Node* to = ResolveReplacement(NodeProperties::GetValueInput(node, 0));
-  Node* index_node = node->InputAt(1);
+  Node* index_node = ElementAccessIndex(node);
   NumberMatcher index(index_node);
   DCHECK(index_node->opcode() != IrOpcode::kInt32Constant &&
          index_node->opcode() != IrOpcode::kInt64Constant &&
          index_node->opcode() != IrOpcode::kFloat32Constant &&
          index_node->opcode() != IrOpcode::kFloat64Constant);
   VirtualState* state = virtual_states_[node->id()];
-  if (index.HasValue()) {
+  if (index.HasValue() && index.Value() >= 0) {
     if (VirtualObject* object = GetVirtualObject(state, to)) {
       if (!object->IsTracked()) return;
       int offset = OffsetForElementAccess(node, index.Value());
@@ -210,12 +210,16 @@ void InstructionScheduler::ScheduleBlock() {
     }
   }
 
-  // Go through the ready list and schedule the instructions.
+  // Go through the ready list and schedule the instructions. Up to
+  // GetIssueWidth() instructions are issued in the same cycle.
+  const int issue_width = GetIssueWidth();
   int cycle = 0;
+  int issued_in_cycle = 0;
   while (!ready_list.IsEmpty()) {
     ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
 
     if (candidate != nullptr) {
+      issued_in_cycle++;
       sequence()->AddInstruction(candidate->instruction());
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
@@ -230,7 +234,10 @@ void InstructionScheduler::ScheduleBlock() {
       }
     }
 
-    cycle++;
+    if (candidate == nullptr || issued_in_cycle == issue_width) {
+      cycle++;
+      issued_in_cycle = 0;
+    }
   }
 }
 
@@ -200,6 +200,9 @@ class InstructionScheduler final : public ZoneObject {
 
   static int GetInstructionLatency(const Instruction* instr);
 
+  // Returns the number of instructions the modelled core can issue per cycle.
+  static int GetIssueWidth();
+
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   Isolate* isolate() { return sequence()->isolate(); }
@@ -14,6 +14,7 @@
 #include "src/compiler/simplified-operator.h"
 #include "src/feedback-vector-inl.h"
 #include "src/ic/call-optimization.h"
+#include "src/isolate-inl.h"
 #include "src/objects-inl.h"
 
 namespace v8 {
@@ -543,34 +544,8 @@ Reduction JSCallReducer::ReduceArrayForEach(Handle<JSFunction> function,
   effect =
       graph()->NewNode(common()->Checkpoint(), frame_state, effect, control);
 
-  // Make sure the map hasn't changed during the iteration
-  Node* orig_map = jsgraph()->HeapConstant(receiver_map);
-  Node* array_map = effect =
-      graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
-                       receiver, effect, control);
-  Node* check_map =
-      graph()->NewNode(simplified()->ReferenceEqual(), array_map, orig_map);
-  effect =
-      graph()->NewNode(simplified()->CheckIf(), check_map, effect, control);
-
-  // Make sure that the access is still in bounds, since the callback could have
-  // changed the array's size.
-  Node* length = graph()->NewNode(
-      simplified()->LoadField(AccessBuilder::ForJSArrayLength(FAST_ELEMENTS)),
-      receiver, effect, control);
-  k = effect =
-      graph()->NewNode(simplified()->CheckBounds(), k, length, effect, control);
-
-  // Reload the elements pointer before calling the callback, since the previous
-  // callback might have resized the array causing the elements buffer to be
-  // re-allocated.
-  Node* elements = graph()->NewNode(
-      simplified()->LoadField(AccessBuilder::ForJSObjectElements()), receiver,
-      effect, control);
-
-  Node* element = graph()->NewNode(
-      simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()),
-      elements, k, effect, control);
+  Node* element =
+      SafeLoadElement(receiver_map, receiver, control, &effect, &k);
 
   Node* next_k =
       graph()->NewNode(simplified()->NumberAdd(), k, jsgraph()->Constant(1));
@@ -597,6 +572,610 @@ Reduction JSCallReducer::ReduceArrayForEach(Handle<JSFunction> function,
   return Replace(jsgraph()->UndefinedConstant());
 }
 
+// ES6 section 22.1.3.16 Array.prototype.map ( callbackfn [ , thisArg ] )
+Reduction JSCallReducer::ReduceArrayMap(Handle<JSFunction> function,
+                                        Node* node) {
+  if (!FLAG_turbo_inline_array_builtins) return NoChange();
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  Node* outer_frame_state = NodeProperties::GetFrameStateInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* context = NodeProperties::GetContextInput(node);
+  CallParameters const& p = CallParametersOf(node->op());
+
+  // Try to determine the {receiver} map.
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* fncallback = node->op()->ValueInputCount() > 2
+                         ? NodeProperties::GetValueInput(node, 2)
+                         : jsgraph()->UndefinedConstant();
+  Node* this_arg = node->op()->ValueInputCount() > 3
+                       ? NodeProperties::GetValueInput(node, 3)
+                       : jsgraph()->UndefinedConstant();
+  ZoneHandleSet<Map> receiver_maps;
+  NodeProperties::InferReceiverMapsResult result =
+      NodeProperties::InferReceiverMaps(receiver, effect, &receiver_maps);
+  if (result != NodeProperties::kReliableReceiverMaps) {
+    return NoChange();
+  }
+  if (receiver_maps.size() != 1) return NoChange();
+  Handle<Map> receiver_map(receiver_maps[0]);
+  ElementsKind kind = receiver_map->elements_kind();
+  if (receiver_map->instance_type() != JS_ARRAY_TYPE) return NoChange();
+  if (!IsFastPackedElementsKind(kind) || IsFastDoubleElementsKind(kind)) {
+    return NoChange();
+  }
+
+  // ArraySpeciesCreate yields the Array function only if the {receiver} has
+  // the initial Array prototype and nobody messed with the species lookup.
+  if (receiver_map->prototype() !=
+      native_context()->initial_array_prototype()) {
+    return NoChange();
+  }
+  if (!isolate()->IsArraySpeciesLookupChainIntact()) return NoChange();
+
+  // TODO(turbofan): map can throw. Hook up exceptional edges.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  effect = CheckCallable(fncallback, effect, control);
+  effect = CheckArraySpeciesProtector(effect, control);
+
+  Node* original_length = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayLength(FAST_ELEMENTS)),
+      receiver, effect, control);
+
+  // The Array constructor creates dictionary elements for big lengths, which
+  // the stores below cannot deal with.
+  original_length = effect = graph()->NewNode(
+      simplified()->CheckBounds(), original_length,
+      jsgraph()->Constant(JSArray::kInitialMaxFastElementArray), effect,
+      control);
+
+  Handle<JSFunction> array_function(native_context()->array_function(),
+                                    isolate());
+  Node* array_constructor = jsgraph()->HeapConstant(array_function);
+  Node* a = control = effect = graph()->NewNode(
+      javascript()->CreateArray(1, Handle<AllocationSite>::null()),
+      array_constructor, array_constructor, original_length, context,
+      outer_frame_state, effect, control);
+
+  // The {a} has holey Smi elements unless it is empty. The callback can return
+  // arbitrary values, so turn it into a holey object array before the loop.
+  Handle<Map> holey_smi_map(
+      Map::cast(native_context()->get(
+          Context::ArrayMapIndex(FAST_HOLEY_SMI_ELEMENTS))),
+      isolate());
+  Handle<Map> holey_map(Map::cast(native_context()->get(
+                            Context::ArrayMapIndex(FAST_HOLEY_ELEMENTS))),
+                        isolate());
+  effect = graph()->NewNode(
+      simplified()->TransitionElementsKind(ElementsTransition(
+          ElementsTransition::kFastTransition, holey_smi_map, holey_map)),
+      a, effect, control);
+
+  Node* k = jsgraph()->ZeroConstant();
+
+  Node* loop = control = graph()->NewNode(common()->Loop(2), control, control);
+  Node* eloop = effect =
+      graph()->NewNode(common()->EffectPhi(2), effect, effect, loop);
+  Node* vloop = k = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), k, k, loop);
+
+  control = loop;
+  effect = eloop;
+
+  Node* continue_test =
+      graph()->NewNode(simplified()->NumberLessThan(), k, original_length);
+  Node* continue_branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                           continue_test, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), continue_branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), continue_branch);
+  control = if_true;
+
+  std::vector<Node*> checkpoint_params(
+      {receiver, fncallback, this_arg, a, k, original_length});
+  const int stack_parameters = static_cast<int>(checkpoint_params.size());
+
+  Node* frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArrayMapLoopEagerDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::EAGER);
+
+  effect =
+      graph()->NewNode(common()->Checkpoint(), frame_state, effect, control);
+
+  Node* element =
+      SafeLoadElement(receiver_map, receiver, control, &effect, &k);
+
+  // The lazy continuation stores the callback result for {k} into {a}.
+  checkpoint_params[4] = k;
+  frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArrayMapLoopLazyDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::LAZY);
+
+  Node* callback_value = control = effect = graph()->NewNode(
+      javascript()->Call(5, p.frequency()), fncallback, this_arg, element, k,
+      receiver, context, frame_state, effect, control);
+
+  // The callback cannot get hold of {a}, so its elements are still the ones
+  // allocated above, with enough capacity for {original_length} values.
+  Node* elements = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSObjectElements()), a, effect,
+      control);
+  effect = graph()->NewNode(simplified()->StoreElement(
+                                AccessBuilder::ForFixedArrayElement(
+                                    FAST_HOLEY_ELEMENTS)),
+                            elements, k, callback_value, effect, control);
+
+  k = graph()->NewNode(simplified()->NumberAdd(), k, jsgraph()->Constant(1));
+
+  loop->ReplaceInput(1, control);
+  vloop->ReplaceInput(1, k);
+  eloop->ReplaceInput(1, effect);
+
+  control = if_false;
+  effect = eloop;
+
+  ReplaceWithValue(node, a, effect, control);
+  return Replace(a);
+}
+
+// ES6 section 22.1.3.7 Array.prototype.filter ( callbackfn [ , thisArg ] )
+Reduction JSCallReducer::ReduceArrayFilter(Handle<JSFunction> function,
+                                           Node* node) {
+  if (!FLAG_turbo_inline_array_builtins) return NoChange();
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  Node* outer_frame_state = NodeProperties::GetFrameStateInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* context = NodeProperties::GetContextInput(node);
+  CallParameters const& p = CallParametersOf(node->op());
+
+  // Try to determine the {receiver} map.
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* fncallback = node->op()->ValueInputCount() > 2
+                         ? NodeProperties::GetValueInput(node, 2)
+                         : jsgraph()->UndefinedConstant();
+  Node* this_arg = node->op()->ValueInputCount() > 3
+                       ? NodeProperties::GetValueInput(node, 3)
+                       : jsgraph()->UndefinedConstant();
+  ZoneHandleSet<Map> receiver_maps;
+  NodeProperties::InferReceiverMapsResult result =
+      NodeProperties::InferReceiverMaps(receiver, effect, &receiver_maps);
+  if (result != NodeProperties::kReliableReceiverMaps) {
+    return NoChange();
+  }
+  if (receiver_maps.size() != 1) return NoChange();
+  Handle<Map> receiver_map(receiver_maps[0]);
+  ElementsKind kind = receiver_map->elements_kind();
+  if (receiver_map->instance_type() != JS_ARRAY_TYPE) return NoChange();
+  if (!IsFastPackedElementsKind(kind) || IsFastDoubleElementsKind(kind)) {
+    return NoChange();
+  }
+
+  // ArraySpeciesCreate yields the Array function only if the {receiver} has
+  // the initial Array prototype and nobody messed with the species lookup.
+  if (receiver_map->prototype() !=
+      native_context()->initial_array_prototype()) {
+    return NoChange();
+  }
+  if (!isolate()->IsArraySpeciesLookupChainIntact()) return NoChange();
+
+  // TODO(turbofan): filter can throw. Hook up exceptional edges.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  effect = CheckCallable(fncallback, effect, control);
+  effect = CheckArraySpeciesProtector(effect, control);
+
+  Node* original_length = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayLength(FAST_ELEMENTS)),
+      receiver, effect, control);
+
+  Handle<JSFunction> array_function(native_context()->array_function(),
+                                    isolate());
+  Node* array_constructor = jsgraph()->HeapConstant(array_function);
+  Node* a = control = effect = graph()->NewNode(
+      javascript()->CreateArray(0, Handle<AllocationSite>::null()),
+      array_constructor, array_constructor, context, outer_frame_state, effect,
+      control);
+
+  // The empty {a} has packed Smi elements. The selected elements can be
+  // arbitrary values, so turn it into an object array before the loop.
+  Handle<Map> smi_map(Map::cast(native_context()->get(
+                          Context::ArrayMapIndex(FAST_SMI_ELEMENTS))),
+                      isolate());
+  Handle<Map> object_map(Map::cast(native_context()->get(
+                             Context::ArrayMapIndex(FAST_ELEMENTS))),
+                         isolate());
+  effect = graph()->NewNode(
+      simplified()->TransitionElementsKind(ElementsTransition(
+          ElementsTransition::kFastTransition, smi_map, object_map)),
+      a, effect, control);
+
+  Node* k = jsgraph()->ZeroConstant();
+  Node* to = jsgraph()->ZeroConstant();
+
+  Node* loop = control = graph()->NewNode(common()->Loop(2), control, control);
+  Node* eloop = effect =
+      graph()->NewNode(common()->EffectPhi(2), effect, effect, loop);
+  Node* vloop = k = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), k, k, loop);
+  Node* tloop = to = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), to, to, loop);
+
+  control = loop;
+  effect = eloop;
+
+  Node* continue_test =
+      graph()->NewNode(simplified()->NumberLessThan(), k, original_length);
+  Node* continue_branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                           continue_test, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), continue_branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), continue_branch);
+  control = if_true;
+
+  std::vector<Node*> checkpoint_params(
+      {receiver, fncallback, this_arg, a, k, original_length, to});
+  int stack_parameters = static_cast<int>(checkpoint_params.size());
+
+  Node* frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArrayFilterLoopEagerDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::EAGER);
+
+  effect =
+      graph()->NewNode(common()->Checkpoint(), frame_state, effect, control);
+
+  Node* element =
+      SafeLoadElement(receiver_map, receiver, control, &effect, &k);
+
+  // The lazy continuation adds the {element} to {a} if the callback result
+  // for {k} says so.
+  checkpoint_params =
+      std::vector<Node*>({receiver, fncallback, this_arg, a, k,
+                          original_length, element, to});
+  stack_parameters = static_cast<int>(checkpoint_params.size());
+  frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArrayFilterLoopLazyDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::LAZY);
+
+  Node* callback_value = control = effect = graph()->NewNode(
+      javascript()->Call(5, p.frequency()), fncallback, this_arg, element, k,
+      receiver, context, frame_state, effect, control);
+
+  // Growing {a} below can deoptimize, which needs an eager frame state for
+  // the point right after the callback returned. The lazy continuation can
+  // serve as that, since it only coerces the callback result to boolean.
+  checkpoint_params.push_back(callback_value);
+  stack_parameters = static_cast<int>(checkpoint_params.size());
+  frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArrayFilterLoopLazyDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::EAGER);
+  effect =
+      graph()->NewNode(common()->Checkpoint(), frame_state, effect, control);
+
+  Node* selected = graph()->NewNode(
+      javascript()->ToBoolean(ToBooleanHint::kAny), callback_value);
+  Node* select_branch =
+      graph()->NewNode(common()->Branch(), selected, control);
+
+  Node* if_selected = graph()->NewNode(common()->IfTrue(), select_branch);
+  Node* eselected = effect;
+  Node* to_selected;
+  {
+    // Append the {element} to {a}, whose length is {to}.
+    Node* elements = eselected = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSObjectElements()), a,
+        eselected, if_selected);
+    elements = eselected = graph()->NewNode(
+        simplified()->MaybeGrowFastElements(GrowFastElementsFlag::kArrayObject),
+        a, elements, to, to, eselected, if_selected);
+    eselected = graph()->NewNode(
+        simplified()->StoreElement(
+            AccessBuilder::ForFixedArrayElement(FAST_ELEMENTS)),
+        elements, to, element, eselected, if_selected);
+    to_selected =
+        graph()->NewNode(simplified()->NumberAdd(), to, jsgraph()->Constant(1));
+  }
+
+  Node* if_not_selected = graph()->NewNode(common()->IfFalse(), select_branch);
+  Node* enot_selected = effect;
+
+  control = graph()->NewNode(common()->Merge(2), if_selected, if_not_selected);
+  effect = graph()->NewNode(common()->EffectPhi(2), eselected, enot_selected,
+                            control);
+  to = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                        to_selected, to, control);
+
+  k = graph()->NewNode(simplified()->NumberAdd(), k, jsgraph()->Constant(1));
+
+  loop->ReplaceInput(1, control);
+  vloop->ReplaceInput(1, k);
+  tloop->ReplaceInput(1, to);
+  eloop->ReplaceInput(1, effect);
+
+  control = if_false;
+  effect = eloop;
+
+  ReplaceWithValue(node, a, effect, control);
+  return Replace(a);
+}
+
+// ES6 section 22.1.3.23 Array.prototype.some ( callbackfn [ , thisArg ] )
+Reduction JSCallReducer::ReduceArraySome(Handle<JSFunction> function,
+                                         Node* node) {
+  if (!FLAG_turbo_inline_array_builtins) return NoChange();
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  Node* outer_frame_state = NodeProperties::GetFrameStateInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* context = NodeProperties::GetContextInput(node);
+  CallParameters const& p = CallParametersOf(node->op());
+
+  // Try to determine the {receiver} map.
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* fncallback = node->op()->ValueInputCount() > 2
+                         ? NodeProperties::GetValueInput(node, 2)
+                         : jsgraph()->UndefinedConstant();
+  Node* this_arg = node->op()->ValueInputCount() > 3
+                       ? NodeProperties::GetValueInput(node, 3)
+                       : jsgraph()->UndefinedConstant();
+  ZoneHandleSet<Map> receiver_maps;
+  NodeProperties::InferReceiverMapsResult result =
+      NodeProperties::InferReceiverMaps(receiver, effect, &receiver_maps);
+  if (result != NodeProperties::kReliableReceiverMaps) {
+    return NoChange();
+  }
+  if (receiver_maps.size() != 1) return NoChange();
+  Handle<Map> receiver_map(receiver_maps[0]);
+  ElementsKind kind = receiver_map->elements_kind();
+  if (receiver_map->instance_type() != JS_ARRAY_TYPE) return NoChange();
+  if (!IsFastPackedElementsKind(kind) || IsFastDoubleElementsKind(kind)) {
+    return NoChange();
+  }
+
+  // TODO(turbofan): some can throw. Hook up exceptional edges.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  effect = CheckCallable(fncallback, effect, control);
+
+  Node* k = jsgraph()->ZeroConstant();
+
+  Node* original_length = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayLength(FAST_ELEMENTS)),
+      receiver, effect, control);
+
+  Node* loop = control = graph()->NewNode(common()->Loop(2), control, control);
+  Node* eloop = effect =
+      graph()->NewNode(common()->EffectPhi(2), effect, effect, loop);
+  Node* vloop = k = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), k, k, loop);
+
+  control = loop;
+  effect = eloop;
+
+  Node* continue_test =
+      graph()->NewNode(simplified()->NumberLessThan(), k, original_length);
+  Node* continue_branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                           continue_test, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), continue_branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), continue_branch);
+  control = if_true;
+
+  std::vector<Node*> checkpoint_params(
+      {receiver, fncallback, this_arg, k, original_length});
+  const int stack_parameters = static_cast<int>(checkpoint_params.size());
+
+  Node* frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArraySomeLoopEagerDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::EAGER);
+
+  effect =
+      graph()->NewNode(common()->Checkpoint(), frame_state, effect, control);
+
+  Node* element =
+      SafeLoadElement(receiver_map, receiver, control, &effect, &k);
+
+  // The lazy continuation decides based on the callback result for {k}.
+  checkpoint_params[3] = k;
+  frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArraySomeLoopLazyDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::LAZY);
+
+  Node* callback_value = control = effect = graph()->NewNode(
+      javascript()->Call(5, p.frequency()), fncallback, this_arg, element, k,
+      receiver, context, frame_state, effect, control);
+
+  Node* found = graph()->NewNode(javascript()->ToBoolean(ToBooleanHint::kAny),
+                                 callback_value);
+  Node* found_branch = graph()->NewNode(common()->Branch(BranchHint::kFalse),
+                                        found, control);
+  Node* if_found = graph()->NewNode(common()->IfTrue(), found_branch);
+  control = graph()->NewNode(common()->IfFalse(), found_branch);
+
+  k = graph()->NewNode(simplified()->NumberAdd(), k, jsgraph()->Constant(1));
+
+  loop->ReplaceInput(1, control);
+  vloop->ReplaceInput(1, k);
+  eloop->ReplaceInput(1, effect);
+
+  control = graph()->NewNode(common()->Merge(2), if_false, if_found);
+  effect = graph()->NewNode(common()->EffectPhi(2), eloop, effect, control);
+  Node* value = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2),
+      jsgraph()->FalseConstant(), jsgraph()->TrueConstant(), control);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
+// ES6 section 22.1.3.19 Array.prototype.reduce (callbackfn [, initialValue])
+Reduction JSCallReducer::ReduceArrayReduce(Handle<JSFunction> function,
+                                           Node* node) {
+  if (!FLAG_turbo_inline_array_builtins) return NoChange();
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  Node* outer_frame_state = NodeProperties::GetFrameStateInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* context = NodeProperties::GetContextInput(node);
+  CallParameters const& p = CallParametersOf(node->op());
+
+  // TODO(turbofan): Handle the case without an {initialValue}, which starts
+  // with the first element and throws when the {receiver} is empty.
+  if (node->op()->ValueInputCount() < 4) return NoChange();
+
+  // Try to determine the {receiver} map.
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* fncallback = NodeProperties::GetValueInput(node, 2);
+  Node* accumulator = NodeProperties::GetValueInput(node, 3);
+  ZoneHandleSet<Map> receiver_maps;
+  NodeProperties::InferReceiverMapsResult result =
+      NodeProperties::InferReceiverMaps(receiver, effect, &receiver_maps);
+  if (result != NodeProperties::kReliableReceiverMaps) {
+    return NoChange();
+  }
+  if (receiver_maps.size() != 1) return NoChange();
+  Handle<Map> receiver_map(receiver_maps[0]);
+  ElementsKind kind = receiver_map->elements_kind();
+  if (receiver_map->instance_type() != JS_ARRAY_TYPE) return NoChange();
+  if (!IsFastPackedElementsKind(kind) || IsFastDoubleElementsKind(kind)) {
+    return NoChange();
+  }
+
+  // TODO(turbofan): reduce can throw. Hook up exceptional edges.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  effect = CheckCallable(fncallback, effect, control);
+
+  Node* k = jsgraph()->ZeroConstant();
+
+  Node* original_length = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayLength(FAST_ELEMENTS)),
+      receiver, effect, control);
+
+  Node* loop = control = graph()->NewNode(common()->Loop(2), control, control);
+  Node* eloop = effect =
+      graph()->NewNode(common()->EffectPhi(2), effect, effect, loop);
+  Node* vloop = k = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), k, k, loop);
+  Node* aloop = accumulator =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                       accumulator, accumulator, loop);
+
+  control = loop;
+  effect = eloop;
+
+  Node* continue_test =
+      graph()->NewNode(simplified()->NumberLessThan(), k, original_length);
+  Node* continue_branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                           continue_test, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), continue_branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), continue_branch);
+  control = if_true;
+
+  std::vector<Node*> checkpoint_params(
+      {receiver, fncallback, k, original_length, accumulator});
+  int stack_parameters = static_cast<int>(checkpoint_params.size());
+
+  Node* frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArrayReduceLoopEagerDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::EAGER);
+
+  effect =
+      graph()->NewNode(common()->Checkpoint(), frame_state, effect, control);
+
+  Node* element =
+      SafeLoadElement(receiver_map, receiver, control, &effect, &k);
+
+  // The lazy continuation takes the callback result for {k} as the new
+  // accumulator.
+  checkpoint_params[2] = k;
+  checkpoint_params.pop_back();
+  stack_parameters = static_cast<int>(checkpoint_params.size());
+  frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), function, Builtins::kArrayReduceLoopLazyDeoptContinuation,
+      node->InputAt(0), context, &checkpoint_params[0], stack_parameters,
+      outer_frame_state, ContinuationFrameStateMode::LAZY);
+
+  accumulator = control = effect = graph()->NewNode(
+      javascript()->Call(6, p.frequency()), fncallback,
+      jsgraph()->UndefinedConstant(), accumulator, element, k, receiver,
+      context, frame_state, effect, control);
+
+  k = graph()->NewNode(simplified()->NumberAdd(), k, jsgraph()->Constant(1));
+
+  loop->ReplaceInput(1, control);
+  vloop->ReplaceInput(1, k);
+  aloop->ReplaceInput(1, accumulator);
+  eloop->ReplaceInput(1, effect);
+
+  control = if_false;
+  effect = eloop;
+
+  ReplaceWithValue(node, aloop, effect, control);
+  return Replace(aloop);
+}
+
+Node* JSCallReducer::SafeLoadElement(Handle<Map> receiver_map, Node* receiver,
+                                     Node* control, Node** effect, Node** k) {
+  // Make sure the map hasn't changed during the iteration
+  Node* orig_map = jsgraph()->HeapConstant(receiver_map);
+  Node* array_map = *effect =
+      graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
+                       receiver, *effect, control);
+  Node* check_map =
+      graph()->NewNode(simplified()->ReferenceEqual(), array_map, orig_map);
+  *effect =
+      graph()->NewNode(simplified()->CheckIf(), check_map, *effect, control);
+
+  // Make sure that the access is still in bounds, since the callback could have
+  // changed the array's size.
+  Node* length = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayLength(FAST_ELEMENTS)),
+      receiver, *effect, control);
+  *k = *effect = graph()->NewNode(simplified()->CheckBounds(), *k, length,
+                                  *effect, control);
+
+  // Reload the elements pointer before calling the callback, since the previous
+  // callback might have resized the array causing the elements buffer to be
+  // re-allocated.
+  Node* elements = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSObjectElements()), receiver,
+      *effect, control);
+
+  return graph()->NewNode(
+      simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()),
+      elements, *k, *effect, control);
+}
+
+Node* JSCallReducer::CheckCallable(Node* fncallback, Node* effect,
+                                   Node* control) {
+  Node* check =
+      graph()->NewNode(simplified()->ObjectIsDetectableCallable(), fncallback);
+  return graph()->NewNode(simplified()->CheckIf(), check, effect, control);
+}
+
+Node* JSCallReducer::CheckArraySpeciesProtector(Node* effect, Node* control) {
+  // The species protector is a plain Cell, which cannot carry code
+  // dependencies, so it is checked whenever the inlined builtin runs.
+  Node* protector = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForCellValue()),
+      jsgraph()->HeapConstant(factory()->species_protector()), effect, control);
+  Node* check = graph()->NewNode(
+      simplified()->ReferenceEqual(), protector,
+      jsgraph()->SmiConstant(Isolate::kProtectorValid));
+  return graph()->NewNode(simplified()->CheckIf(), check, effect, control);
+}
+
 Reduction JSCallReducer::ReduceCallApiFunction(
     Node* node, Handle<FunctionTemplateInfo> function_template_info) {
   DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
@@ -654,6 +1233,13 @@ Reduction JSCallReducer::ReduceCallApiFunction(
     }
   }
 
+  // Call the fast C++ handler directly if it takes the arguments of this call.
+  if (function_template_info->fast_call_info()->IsTuple2()) {
+    Reduction const reduction =
+        ReduceFastApiCall(node, function_template_info, argc);
+    if (reduction.Changed()) return reduction;
+  }
+
   // CallApiCallbackStub's register arguments: code, target, call data, holder,
   // function address.
   // TODO(turbofan): Consider introducing a JSCallApiCallback operator for
@@ -686,6 +1272,58 @@ Reduction JSCallReducer::ReduceCallApiFunction(
   return Changed(node);
 }
 
+Reduction JSCallReducer::ReduceFastApiCall(
+    Node* node, Handle<FunctionTemplateInfo> function_template_info,
+    int argc) {
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  // The fast handler neither throws nor calls back into JavaScript, so there
+  // is no exceptional continuation and no lazy deoptimization point for it.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+  Tuple2* fast_call_info =
+      Tuple2::cast(function_template_info->fast_call_info());
+  int const signature = Smi::cast(fast_call_info->value2())->value();
+  if (FunctionTemplateInfo::FastCallArgumentCountBits::decode(signature) !=
+      argc) {
+    return NoChange();
+  }
+  bool const returns_value =
+      FunctionTemplateInfo::FastCallReturnsValueBit::decode(signature);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // The handler takes all arguments as int32 values, so we check that they
+  // are numbers here and let SimplifiedLowering truncate them.
+  MachineSignature::Builder builder(graph()->zone(), returns_value ? 1 : 0,
+                                    argc);
+  if (returns_value) builder.AddReturn(MachineType::Int32());
+  int const input_count = 1 + argc + 2;
+  Node** const inputs = graph()->zone()->NewArray<Node*>(input_count);
+  ApiFunction api_function(v8::ToCData<Address>(fast_call_info->value1()));
+  ExternalReference function_reference(
+      &api_function, ExternalReference::BUILTIN_CALL, isolate());
+  inputs[0] = jsgraph()->ExternalConstant(function_reference);
+  for (int i = 0; i < argc; ++i) {
+    builder.AddParam(MachineType::Int32());
+    Node* value = NodeProperties::GetValueInput(node, 2 + i);
+    inputs[1 + i] = effect = graph()->NewNode(simplified()->CheckNumber(),
+                                              value, effect, control);
+  }
+  inputs[1 + argc] = effect;
+  inputs[2 + argc] = control;
+  CallDescriptor* call_descriptor =
+      Linkage::GetSimplifiedCDescriptor(graph()->zone(), builder.Build());
+  Node* value = effect = control = graph()->NewNode(
+      common()->Call(call_descriptor), input_count, inputs);
+  if (returns_value) {
+    value = graph()->NewNode(common()->TypeGuard(Type::Signed32()), value,
+                             control);
+  } else {
+    value = jsgraph()->UndefinedConstant();
+  }
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSCallReducer::ReduceCallOrConstructWithArrayLikeOrSpread(
     Node* node, int arity, CallFrequency const& frequency) {
   DCHECK(node->opcode() == IrOpcode::kJSCallWithArrayLike ||
@@ -888,8 +1526,41 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
           return ReduceReflectGetPrototypeOf(node);
         case Builtins::kArrayForEach:
           return ReduceArrayForEach(function, node);
+        case Builtins::kArrayMap:
+          return ReduceArrayMap(function, node);
+        case Builtins::kArrayFilter:
+          return ReduceArrayFilter(function, node);
+        case Builtins::kArraySome:
+          return ReduceArraySome(function, node);
+        case Builtins::kArrayReduce:
+          return ReduceArrayReduce(function, node);
         case Builtins::kReturnReceiver:
           return ReduceReturnReceiver(node);
+        case Builtins::kConsoleDebug:
+        case Builtins::kConsoleError:
+        case Builtins::kConsoleInfo:
+        case Builtins::kConsoleLog:
+        case Builtins::kConsoleWarn:
+        case Builtins::kConsoleDir:
+        case Builtins::kConsoleDirXml:
+        case Builtins::kConsoleTable:
+        case Builtins::kConsoleTrace:
+        case Builtins::kConsoleGroup:
+        case Builtins::kConsoleGroupCollapsed:
+        case Builtins::kConsoleGroupEnd:
+        case Builtins::kConsoleClear:
+        case Builtins::kConsoleCount:
+        case Builtins::kConsoleAssert:
+        case Builtins::kFastConsoleAssert:
+        case Builtins::kConsoleMarkTimeline:
+        case Builtins::kConsoleProfile:
+        case Builtins::kConsoleProfileEnd:
+        case Builtins::kConsoleTimeline:
+        case Builtins::kConsoleTimelineEnd:
+        case Builtins::kConsoleTime:
+        case Builtins::kConsoleTimeEnd:
+        case Builtins::kConsoleTimeStamp:
+          return ReduceConsoleCall(node);
         default:
           break;
       }
@@ -992,7 +1663,7 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
     if (!ShouldUseCallICFeedback(target)) return NoChange();
 
     Handle<WeakCell> cell = Handle<WeakCell>::cast(feedback);
-    if (cell->value()->IsJSFunction()) {
+    if (cell->value()->IsJSFunction() || cell->value()->IsJSBoundFunction()) {
       Node* target_function =
           jsgraph()->Constant(handle(cell->value(), isolate()));
 
@@ -1002,7 +1673,8 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
       effect =
           graph()->NewNode(simplified()->CheckIf(), check, effect, control);
 
-      // Specialize the JSCall node to the {target_function}.
+      // Specialize the JSCall node to the {target_function}. For bound
+      // functions this exposes [[BoundTargetFunction]] to inlining.
       NodeProperties::ReplaceValueInput(node, target_function, 0);
       NodeProperties::ReplaceEffectInput(node, effect);
 
@@ -1172,6 +1844,18 @@ Reduction JSCallReducer::ReduceReturnReceiver(Node* node) {
   return Replace(receiver);
 }
 
+// ES #console-namespace
+Reduction JSCallReducer::ReduceConsoleCall(Node* node) {
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  // Without a console delegate the console builtins return undefined right
+  // away, so the call and the arguments that only feed it can go away.
+  if (!isolate()->IsConsoleDelegateProtectorIntact()) return NoChange();
+  dependencies()->AssumePropertyCell(factory()->console_delegate_protector());
+  Node* value = jsgraph()->UndefinedConstant();
+  ReplaceWithValue(node, value);
+  return Replace(value);
+}
+
 Graph* JSCallReducer::graph() const { return jsgraph()->graph(); }
 
 Isolate* JSCallReducer::isolate() const { return jsgraph()->isolate(); }
@@ -43,6 +43,9 @@ class JSCallReducer final : public AdvancedReducer {
   Reduction ReduceBooleanConstructor(Node* node);
   Reduction ReduceCallApiFunction(
       Node* node, Handle<FunctionTemplateInfo> function_template_info);
+  Reduction ReduceFastApiCall(
+      Node* node, Handle<FunctionTemplateInfo> function_template_info,
+      int argc);
   Reduction ReduceNumberConstructor(Node* node);
   Reduction ReduceFunctionPrototypeApply(Node* node);
   Reduction ReduceFunctionPrototypeCall(Node* node);
@@ -55,6 +58,10 @@ class JSCallReducer final : public AdvancedReducer {
   Reduction ReduceReflectConstruct(Node* node);
   Reduction ReduceReflectGetPrototypeOf(Node* node);
   Reduction ReduceArrayForEach(Handle<JSFunction> function, Node* node);
+  Reduction ReduceArrayMap(Handle<JSFunction> function, Node* node);
+  Reduction ReduceArrayFilter(Handle<JSFunction> function, Node* node);
+  Reduction ReduceArraySome(Handle<JSFunction> function, Node* node);
+  Reduction ReduceArrayReduce(Handle<JSFunction> function, Node* node);
   Reduction ReduceCallOrConstructWithArrayLikeOrSpread(
       Node* node, int arity, CallFrequency const& frequency);
   Reduction ReduceJSConstruct(Node* node);
@@ -64,6 +71,19 @@ class JSCallReducer final : public AdvancedReducer {
   Reduction ReduceJSCallWithArrayLike(Node* node);
   Reduction ReduceJSCallWithSpread(Node* node);
   Reduction ReduceReturnReceiver(Node* node);
+  Reduction ReduceConsoleCall(Node* node);
+
+  // Checks that the {receiver} still has the {receiver_map} and that {k} is
+  // still in bounds, since the callback of an inlined Array builtin may have
+  // changed either, and loads the element at {k}.
+  Node* SafeLoadElement(Handle<Map> receiver_map, Node* receiver, Node* control,
+                        Node** effect, Node** k);
+  // Checks that {fncallback} is callable, so that an inlined Array builtin
+  // throws the TypeError before looking at the {receiver}.
+  Node* CheckCallable(Node* fncallback, Node* effect, Node* control);
+  // Checks that the Array species protector is still intact, so that the
+  // result of an inlined Array builtin can be created with the Array function.
+  Node* CheckArraySpeciesProtector(Node* effect, Node* control);
 
   Graph* graph() const;
   JSGraph* jsgraph() const { return jsgraph_; }
@@ -30,7 +30,8 @@ CallDescriptor::Flags FrameStateFlagForCall(Node* node) {
 
 }  // namespace
 
-JSGenericLowering::JSGenericLowering(JSGraph* jsgraph) : jsgraph_(jsgraph) {}
+JSGenericLowering::JSGenericLowering(JSGraph* jsgraph, Flags flags)
+    : jsgraph_(jsgraph), flags_(flags) {}
 
 JSGenericLowering::~JSGenericLowering() {}
 
@@ -118,6 +119,41 @@ void JSGenericLowering::ReplaceWithRuntimeCall(Node* node,
   NodeProperties::ChangeOp(node, common()->Call(desc));
 }
 
+Node* JSGenericLowering::LoadFeedbackVector(VectorSlotPair const& feedback) {
+  if (!(flags() & kNativeContextIndependent)) {
+    return jsgraph()->HeapConstant(feedback.vector());
+  }
+  if (feedback_vector_ == nullptr) {
+    // Without inlining all feedback belongs to the function being compiled.
+    Node* start = graph()->start();
+    Node* closure = nullptr;
+    for (Node* use : start->uses()) {
+      if (use->opcode() == IrOpcode::kParameter &&
+          ParameterIndexOf(use->op()) == Linkage::kJSCallClosureParamIndex) {
+        closure = use;
+        break;
+      }
+    }
+    if (closure == nullptr) {
+      closure = graph()->NewNode(
+          common()->Parameter(Linkage::kJSCallClosureParamIndex, "%closure"),
+          start);
+    }
+    // The feedback vector cell of a closure running optimized code always
+    // holds the feedback vector, so the loads don't need to be ordered.
+    Node* cell = graph()->NewNode(
+        machine()->Load(MachineType::AnyTagged()), closure,
+        jsgraph()->IntPtrConstant(JSFunction::kFeedbackVectorOffset -
+                                  kHeapObjectTag),
+        start, start);
+    feedback_vector_ = graph()->NewNode(
+        machine()->Load(MachineType::AnyTagged()), cell,
+        jsgraph()->IntPtrConstant(Cell::kValueOffset - kHeapObjectTag), start,
+        start);
+  }
+  return feedback_vector_;
+}
+
 void JSGenericLowering::LowerJSStrictEqual(Node* node) {
   // The === operator doesn't need the current context.
   NodeProperties::ReplaceContextInput(node, jsgraph()->NoContextConstant());
@@ -181,7 +217,7 @@ void JSGenericLowering::LowerJSLoadProperty(Node* node) {
   } else {
     Callable callable =
         Builtins::CallableFor(isolate(), Builtins::kKeyedLoadIC);
-    Node* vector = jsgraph()->HeapConstant(p.feedback().vector());
+    Node* vector = LoadFeedbackVector(p.feedback());
     node->InsertInput(zone(), 3, vector);
     ReplaceWithStubCall(node, callable, flags);
   }
@@ -200,7 +236,7 @@ void JSGenericLowering::LowerJSLoadNamed(Node* node) {
     ReplaceWithStubCall(node, callable, flags);
   } else {
     Callable callable = Builtins::CallableFor(isolate(), Builtins::kLoadIC);
-    Node* vector = jsgraph()->HeapConstant(p.feedback().vector());
+    Node* vector = LoadFeedbackVector(p.feedback());
     node->InsertInput(zone(), 3, vector);
     ReplaceWithStubCall(node, callable, flags);
   }
@@ -220,7 +256,7 @@ void JSGenericLowering::LowerJSLoadGlobal(Node* node) {
   } else {
     Callable callable =
         CodeFactory::LoadGlobalICInOptimizedCode(isolate(), p.typeof_mode());
-    Node* vector = jsgraph()->HeapConstant(p.feedback().vector());
+    Node* vector = LoadFeedbackVector(p.feedback());
     node->InsertInput(zone(), 2, vector);
     ReplaceWithStubCall(node, callable, flags);
   }
@@ -238,7 +274,7 @@ void JSGenericLowering::LowerJSStoreProperty(Node* node) {
   } else {
     Callable callable =
         CodeFactory::KeyedStoreICInOptimizedCode(isolate(), p.language_mode());
-    Node* vector = jsgraph()->HeapConstant(p.feedback().vector());
+    Node* vector = LoadFeedbackVector(p.feedback());
     node->InsertInput(zone(), 4, vector);
     ReplaceWithStubCall(node, callable, flags);
   }
@@ -257,7 +293,7 @@ void JSGenericLowering::LowerJSStoreNamed(Node* node) {
   } else {
     Callable callable =
         CodeFactory::StoreICInOptimizedCode(isolate(), p.language_mode());
-    Node* vector = jsgraph()->HeapConstant(p.feedback().vector());
+    Node* vector = LoadFeedbackVector(p.feedback());
     node->InsertInput(zone(), 4, vector);
     ReplaceWithStubCall(node, callable, flags);
   }
@@ -275,7 +311,7 @@ void JSGenericLowering::LowerJSStoreNamedOwn(Node* node) {
     ReplaceWithStubCall(node, callable, flags);
   } else {
     Callable callable = CodeFactory::StoreOwnICInOptimizedCode(isolate());
-    Node* vector = jsgraph()->HeapConstant(p.feedback().vector());
+    Node* vector = LoadFeedbackVector(p.feedback());
     node->InsertInput(zone(), 4, vector);
     ReplaceWithStubCall(node, callable, flags);
   }
@@ -310,7 +346,7 @@ void JSGenericLowering::LowerJSStoreGlobal(Node* node) {
   } else {
     Callable callable =
         CodeFactory::StoreGlobalICInOptimizedCode(isolate(), p.language_mode());
-    Node* vector = jsgraph()->HeapConstant(p.feedback().vector());
+    Node* vector = LoadFeedbackVector(p.feedback());
     node->InsertInput(zone(), 4, vector);
     ReplaceWithStubCall(node, callable, flags);
   }
@@ -319,7 +355,7 @@ void JSGenericLowering::LowerJSStoreGlobal(Node* node) {
 void JSGenericLowering::LowerJSStoreDataPropertyInLiteral(Node* node) {
   FeedbackParameter const& p = FeedbackParameterOf(node->op());
   node->InsertInputs(zone(), 4, 2);
-  node->ReplaceInput(4, jsgraph()->HeapConstant(p.feedback().vector()));
+  node->ReplaceInput(4, LoadFeedbackVector(p.feedback()));
   node->ReplaceInput(5, jsgraph()->SmiConstant(p.feedback().index()));
   ReplaceWithRuntimeCall(node, Runtime::kDefineDataPropertyInLiteral);
 }
@@ -414,13 +450,11 @@ void JSGenericLowering::LowerJSCreateClosure(Node* node) {
   if (p.pretenure() == NOT_TENURED) {
     Callable callable =
         Builtins::CallableFor(isolate(), Builtins::kFastNewClosure);
-    node->InsertInput(zone(), 1,
-                      jsgraph()->HeapConstant(p.feedback().vector()));
+    node->InsertInput(zone(), 1, LoadFeedbackVector(p.feedback()));
     node->InsertInput(zone(), 2, jsgraph()->SmiConstant(p.feedback().index()));
     ReplaceWithStubCall(node, callable, flags);
   } else {
-    node->InsertInput(zone(), 1,
-                      jsgraph()->HeapConstant(p.feedback().vector()));
+    node->InsertInput(zone(), 1, LoadFeedbackVector(p.feedback()));
     node->InsertInput(zone(), 2, jsgraph()->SmiConstant(p.feedback().index()));
     ReplaceWithRuntimeCall(node, (p.pretenure() == TENURED)
                                      ? Runtime::kNewClosure_Tenured
@@ -476,6 +510,14 @@ void JSGenericLowering::LowerJSCreateLiteralArray(Node* node) {
     Callable callable = CodeFactory::FastCloneShallowArray(
         isolate(), DONT_TRACK_ALLOCATION_SITE);
     ReplaceWithStubCall(node, callable, flags);
+  } else if (p.flags() == ArrayLiteral::kNoFlags &&
+             p.length() <=
+                 ConstructorBuiltins::kMaximumClonedShallowArrayElements) {
+    // Nested boilerplates are deep-copied by the FastCloneDeepArray builtin,
+    // which calls the runtime for the cases it doesn't handle.
+    Callable callable =
+        Builtins::CallableFor(isolate(), Builtins::kFastCloneDeepArray);
+    ReplaceWithStubCall(node, callable, flags);
   } else {
     node->InsertInput(zone(), 3, jsgraph()->SmiConstant(p.flags()));
     ReplaceWithRuntimeCall(node, Runtime::kCreateArrayLiteral);
@@ -498,6 +540,15 @@ void JSGenericLowering::LowerJSCreateLiteralObject(Node* node) {
     Callable callable =
         Builtins::CallableFor(isolate(), Builtins::kFastCloneShallowObject);
     ReplaceWithStubCall(node, callable, flags);
+  } else if ((p.flags() & ObjectLiteral::kFastElements) != 0 &&
+             (p.flags() & ObjectLiteral::kDisableMementos) == 0 &&
+             p.length() <=
+                 ConstructorBuiltins::kMaximumClonedShallowObjectProperties) {
+    // Nested boilerplates are deep-copied by the FastCloneDeepObject builtin,
+    // which calls the runtime for the cases it doesn't handle.
+    Callable callable =
+        Builtins::CallableFor(isolate(), Builtins::kFastCloneDeepObject);
+    ReplaceWithStubCall(node, callable, flags);
   } else {
     ReplaceWithRuntimeCall(node, Runtime::kCreateObjectLiteral);
   }
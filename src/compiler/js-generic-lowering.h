@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_JS_GENERIC_LOWERING_H_
 #define V8_COMPILER_JS_GENERIC_LOWERING_H_
 
+#include "src/base/flags.h"
 #include "src/code-factory.h"
 #include "src/compiler/graph-reducer.h"
 #include "src/compiler/linkage.h"
@@ -19,12 +20,22 @@ class CommonOperatorBuilder;
 class JSGraph;
 class MachineOperatorBuilder;
 class Linkage;
+class VectorSlotPair;
 
 
 // Lowers JS-level operators to runtime and IC calls in the "generic" case.
 class JSGenericLowering final : public Reducer {
  public:
-  explicit JSGenericLowering(JSGraph* jsgraph);
+  // Flags that control the mode of operation.
+  enum Flag {
+    kNoFlags = 0u,
+    // Load the feedback vector from the closure instead of embedding it, so
+    // that the code can be shared by closures of different native contexts.
+    kNativeContextIndependent = 1u << 0,
+  };
+  typedef base::Flags<Flag> Flags;
+
+  JSGenericLowering(JSGraph* jsgraph, Flags flags);
   ~JSGenericLowering() final;
 
   Reduction Reduce(Node* node) final;
@@ -42,17 +53,26 @@ class JSGenericLowering final : public Reducer {
                            int result_size = 1);
   void ReplaceWithRuntimeCall(Node* node, Runtime::FunctionId f, int args = -1);
 
+  // Returns the feedback vector of {feedback}, which is the one of the
+  // function being compiled if the code is native context independent.
+  Node* LoadFeedbackVector(VectorSlotPair const& feedback);
+
   Zone* zone() const;
   Isolate* isolate() const;
   JSGraph* jsgraph() const { return jsgraph_; }
   Graph* graph() const;
   CommonOperatorBuilder* common() const;
   MachineOperatorBuilder* machine() const;
+  Flags flags() const { return flags_; }
 
  private:
   JSGraph* const jsgraph_;
+  Flags const flags_;
+  Node* feedback_vector_ = nullptr;
 };
 
+DEFINE_OPERATORS_FOR_FLAGS(JSGenericLowering::Flags)
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -65,6 +65,16 @@ bool CanInlineFunction(Handle<SharedFunctionInfo> shared) {
   return true;
 }
 
+// Returns the share of the {budget} that a call site with the given
+// {frequency} may use up. Call sites that are hit on every invocation of the
+// caller get the whole {budget}, colder ones only a share proportional to
+// their frequency, so that cold helpers don't eat the budget of hot calls.
+int InliningBudgetFor(CallFrequency const& frequency, int budget) {
+  if (!FLAG_turbo_inlining_budget_by_frequency) return budget;
+  if (frequency.IsUnknown() || frequency.value() >= 1.0f) return budget;
+  return static_cast<int>(budget * frequency.value());
+}
+
 bool IsSmallInlineFunction(Handle<SharedFunctionInfo> shared) {
   // Don't forcibly inline functions that weren't compiled yet.
   if (shared->ast_node_count() == 0) return false;
@@ -112,6 +122,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     candidate.can_inline_function[i] = CanInlineFunction(shared);
     if (candidate.can_inline_function[i]) {
       can_inline = true;
+      candidate.total_size += shared->ast_node_count();
     }
     if (!IsSmallInlineFunction(shared)) {
       small_inline = false;
@@ -169,7 +180,9 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
 
   // Forcibly inline small functions here. In the case of polymorphic inlining
   // small_inline is set only when all functions are small.
-  if (small_inline && cumulative_count_ <= FLAG_max_inlined_nodes_absolute) {
+  if (small_inline &&
+      cumulative_count_ <= InliningBudgetFor(candidate.frequency,
+                                             FLAG_max_inlined_nodes_absolute)) {
     TRACE("Inlining small function(s) at call site #%d:%s\n", node->id(),
           node->op()->mnemonic());
     return InlineCandidate(candidate, true);
@@ -193,6 +206,19 @@ void JSInliningHeuristic::Finalize() {
     auto i = candidates_.begin();
     Candidate candidate = *i;
     candidates_.erase(i);
+    // Call sites that are not hit on every invocation must fit into their
+    // share of the budget; the candidates after them might still fit.
+    int const budget = InliningBudgetFor(candidate.frequency,
+                                         FLAG_max_inlined_nodes_cumulative);
+    if (budget < FLAG_max_inlined_nodes_cumulative &&
+        cumulative_count_ + candidate.total_size > budget) {
+      TRACE(
+          "Not inlining call site #%d:%s, because its size %d exceeds the "
+          "budget %d left for its frequency\n",
+          candidate.node->id(), candidate.node->op()->mnemonic(),
+          candidate.total_size, budget - cumulative_count_);
+      continue;
+    }
     // Make sure we don't try to inline dead candidate nodes.
     if (!candidate.node->IsDead()) {
       Reduction const reduction = InlineCandidate(candidate, false);
@@ -337,7 +363,8 @@ void JSInliningHeuristic::PrintCandidates() {
   for (const Candidate& candidate : candidates_) {
     os << "  #" << candidate.node->id() << ":"
        << candidate.node->op()->mnemonic()
-       << ", frequency: " << candidate.frequency << std::endl;
+       << ", frequency: " << candidate.frequency
+       << ", size: " << candidate.total_size << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       Handle<SharedFunctionInfo> shared =
           candidate.functions[i].is_null()
@@ -76,6 +76,8 @@ Reduction JSNativeContextSpecialization::Reduce(Node* node) {
       return ReduceJSGetSuperConstructor(node);
     case IrOpcode::kJSInstanceOf:
       return ReduceJSInstanceOf(node);
+    case IrOpcode::kJSHasProperty:
+      return ReduceJSHasProperty(node);
     case IrOpcode::kJSHasInPrototypeChain:
       return ReduceJSHasInPrototypeChain(node);
     case IrOpcode::kJSOrdinaryHasInstance:
@@ -157,6 +159,7 @@ Reduction JSNativeContextSpecialization::ReduceJSGetSuperConstructor(
 
 Reduction JSNativeContextSpecialization::ReduceJSInstanceOf(Node* node) {
   DCHECK_EQ(IrOpcode::kJSInstanceOf, node->opcode());
+  FeedbackParameter const& p = FeedbackParameterOf(node->op());
   Node* object = NodeProperties::GetValueInput(node, 0);
   Node* constructor = NodeProperties::GetValueInput(node, 1);
   Node* context = NodeProperties::GetContextInput(node);
@@ -166,7 +169,25 @@ Reduction JSNativeContextSpecialization::ReduceJSInstanceOf(Node* node) {
 
   // Check if the right hand side is a known {receiver}.
   HeapObjectMatcher m(constructor);
-  if (!m.HasValue() || !m.Value()->IsJSObject()) return NoChange();
+  if (!m.HasValue()) {
+    // Otherwise specialize to the constructor recorded by the interpreter,
+    // guarded by an identity check on the right hand side.
+    if (!p.feedback().IsValid()) return NoChange();
+    InstanceOfICNexus nexus(p.feedback().vector(), p.feedback().slot());
+    Handle<JSObject> feedback_constructor;
+    if (!nexus.GetConstructorFeedback().ToHandle(&feedback_constructor)) {
+      return NoChange();
+    }
+    Node* target = jsgraph()->HeapConstant(feedback_constructor);
+    Node* check =
+        graph()->NewNode(simplified()->ReferenceEqual(), constructor, target);
+    effect = graph()->NewNode(simplified()->CheckIf(), check, effect, control);
+    NodeProperties::ReplaceValueInput(node, target, 1);
+    NodeProperties::ReplaceEffectInput(node, effect);
+    Reduction const reduction = ReduceJSInstanceOf(node);
+    return reduction.Changed() ? reduction : Changed(node);
+  }
+  if (!m.Value()->IsJSObject()) return NoChange();
   Handle<JSObject> receiver = Handle<JSObject>::cast(m.Value());
   Handle<Map> receiver_map(receiver->map(), isolate());
 
@@ -271,6 +292,55 @@ Reduction JSNativeContextSpecialization::ReduceJSInstanceOf(Node* node) {
   return NoChange();
 }
 
+Reduction JSNativeContextSpecialization::ReduceJSHasProperty(Node* node) {
+  DCHECK_EQ(IrOpcode::kJSHasProperty, node->opcode());
+  FeedbackParameter const& p = FeedbackParameterOf(node->op());
+  Node* key = NodeProperties::GetValueInput(node, 0);
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Only named properties are looked up in the descriptors; array indices
+  // would have to consult the elements instead.
+  HeapObjectMatcher mkey(key);
+  if (!mkey.HasValue() || !mkey.Value()->IsName()) return NoChange();
+  Handle<Name> name = Handle<Name>::cast(mkey.Value());
+  uint32_t index;
+  if (name->AsArrayIndex(&index)) return NoChange();
+
+  // Check if the interpreter saw a single {receiver} map.
+  if (!p.feedback().IsValid()) return NoChange();
+  HasPropertyICNexus nexus(p.feedback().vector(), p.feedback().slot());
+  MapHandles receiver_maps;
+  if (nexus.ExtractMaps(&receiver_maps) != 1) return NoChange();
+  Handle<Map> receiver_map = receiver_maps[0];
+  if (!receiver_map->IsJSReceiverMap()) return NoChange();
+
+  // Compute property access info for {name} on the {receiver_map}.
+  PropertyAccessInfo access_info;
+  AccessInfoFactory access_info_factory(dependencies(), native_context(),
+                                        graph()->zone());
+  if (!access_info_factory.ComputePropertyAccessInfo(
+          receiver_map, name, AccessMode::kLoad, &access_info)) {
+    return NoChange();
+  }
+
+  // The result only depends on the {receiver} map and the maps on its
+  // prototype chain, so a map check turns it into a constant.
+  PropertyAccessBuilder access_builder(jsgraph(), dependencies());
+  Handle<JSObject> holder;
+  if (access_info.holder().ToHandle(&holder)) {
+    access_builder.AssumePrototypesStable(native_context(),
+                                          access_info.receiver_maps(), holder);
+  }
+  receiver = access_builder.BuildCheckHeapObject(receiver, &effect, control);
+  access_builder.BuildCheckMaps(receiver, &effect, control,
+                                access_info.receiver_maps());
+  Node* value = jsgraph()->BooleanConstant(!access_info.IsNotFound());
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 JSNativeContextSpecialization::InferHasInPrototypeChainResult
 JSNativeContextSpecialization::InferHasInPrototypeChain(
     Node* receiver, Node* effect, Handle<HeapObject> prototype) {
@@ -365,7 +435,7 @@ Reduction JSNativeContextSpecialization::ReduceJSOrdinaryHasInstance(
     NodeProperties::ReplaceValueInput(node, object, 0);
     NodeProperties::ReplaceValueInput(
         node, jsgraph()->HeapConstant(bound_target_function), 1);
-    NodeProperties::ChangeOp(node, javascript()->InstanceOf());
+    NodeProperties::ChangeOp(node, javascript()->InstanceOf(VectorSlotPair()));
     Reduction const reduction = ReduceJSInstanceOf(node);
     return reduction.Changed() ? reduction : Changed(node);
   }
@@ -688,6 +758,18 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     }
   }
 
+  // Check if we have a named access o.x or o.x=v where o is a proxy, and
+  // call the trap through the proxy builtins instead of the IC.
+  if (receiver_maps.size() == 1 && index == nullptr) {
+    Handle<Map> receiver_map = receiver_maps.front();
+    if (receiver_map->IsJSProxyMap() && !name->IsPrivate() &&
+        (node->opcode() == IrOpcode::kJSLoadNamed ||
+         node->opcode() == IrOpcode::kJSStoreNamed)) {
+      return ReduceProxyAccess(node, receiver_map, name, access_mode,
+                               language_mode);
+    }
+  }
+
   // Compute property access infos for the receiver maps.
   AccessInfoFactory access_info_factory(dependencies(), native_context(),
                                         graph()->zone());
@@ -895,6 +977,45 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   return Replace(value);
 }
 
+Reduction JSNativeContextSpecialization::ReduceProxyAccess(
+    Node* node, Handle<Map> proxy_map, Handle<Name> name,
+    AccessMode access_mode, LanguageMode language_mode) {
+  DCHECK(node->opcode() == IrOpcode::kJSLoadNamed ||
+         node->opcode() == IrOpcode::kJSStoreNamed);
+  DCHECK(access_mode == AccessMode::kLoad || access_mode == AccessMode::kStore);
+  Node* receiver = NodeProperties::GetValueInput(node, 0);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Check that the {receiver} still has the {proxy_map}.
+  receiver = effect = graph()->NewNode(simplified()->CheckHeapObject(),
+                                       receiver, effect, control);
+  effect = graph()->NewNode(
+      simplified()->CheckMaps(CheckMapsFlag::kNone,
+                              ZoneHandleSet<Map>(proxy_map)),
+      receiver, effect, control);
+
+  // Morph the {node} into a call to the proxy builtin.
+  Callable callable = Builtins::CallableFor(
+      isolate(), access_mode == AccessMode::kLoad
+                     ? Builtins::kProxyGetProperty
+                     : Builtins::kProxySetProperty);
+  CallDescriptor const* const desc = Linkage::GetStubCallDescriptor(
+      isolate(), graph()->zone(), callable.descriptor(), 0,
+      CallDescriptor::kNeedsFrameState);
+  NodeProperties::ReplaceValueInput(node, receiver, 0);
+  node->InsertInput(graph()->zone(), 0,
+                    jsgraph()->HeapConstant(callable.code()));
+  node->InsertInput(graph()->zone(), 2, jsgraph()->HeapConstant(name));
+  if (access_mode == AccessMode::kStore) {
+    node->InsertInput(graph()->zone(), 4,
+                      jsgraph()->SmiConstant(language_mode));
+  }
+  NodeProperties::ReplaceEffectInput(node, effect);
+  NodeProperties::ChangeOp(node, common()->Call(desc));
+  return Changed(node);
+}
+
 Reduction JSNativeContextSpecialization::ReduceNamedAccessFromNexus(
     Node* node, Node* value, FeedbackNexus const& nexus, Handle<Name> name,
     AccessMode access_mode, LanguageMode language_mode) {
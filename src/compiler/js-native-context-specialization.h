@@ -56,6 +56,7 @@ class JSNativeContextSpecialization final : public AdvancedReducer {
   Reduction ReduceJSAdd(Node* node);
   Reduction ReduceJSGetSuperConstructor(Node* node);
   Reduction ReduceJSInstanceOf(Node* node);
+  Reduction ReduceJSHasProperty(Node* node);
   Reduction ReduceJSHasInPrototypeChain(Node* node);
   Reduction ReduceJSOrdinaryHasInstance(Node* node);
   Reduction ReduceJSLoadContext(Node* node);
@@ -91,6 +92,9 @@ class JSNativeContextSpecialization final : public AdvancedReducer {
   Reduction ReduceGlobalAccess(Node* node, Node* receiver, Node* value,
                                Handle<Name> name, AccessMode access_mode,
                                Node* index = nullptr);
+  Reduction ReduceProxyAccess(Node* node, Handle<Map> proxy_map,
+                              Handle<Name> name, AccessMode access_mode,
+                              LanguageMode language_mode);
 
   Reduction ReduceSoftDeoptimize(Node* node, DeoptimizeReason reason);
 
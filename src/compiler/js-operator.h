@@ -401,8 +401,9 @@ std::ostream& operator<<(std::ostream&, StoreNamedOwnParameters const&);
 const StoreNamedOwnParameters& StoreNamedOwnParametersOf(const Operator* op);
 
 // Defines the feedback, i.e., vector and index, for storing a data property in
-// an object literal. This is
-// used as a parameter by the JSStoreDataPropertyInLiteral operator.
+// an object literal, for the in operator and for instanceof. This is used as a
+// parameter by the JSStoreDataPropertyInLiteral, JSHasProperty and
+// JSInstanceOf operators.
 class FeedbackParameter final {
  public:
   explicit FeedbackParameter(VectorSlotPair const& feedback)
@@ -762,7 +763,7 @@ class V8_EXPORT_PRIVATE JSOperatorBuilder final
 
   const Operator* DeleteProperty();
 
-  const Operator* HasProperty();
+  const Operator* HasProperty(VectorSlotPair const& feedback);
 
   const Operator* GetSuperConstructor();
 
@@ -784,7 +785,7 @@ class V8_EXPORT_PRIVATE JSOperatorBuilder final
   const Operator* ClassOf();
   const Operator* TypeOf();
   const Operator* HasInPrototypeChain();
-  const Operator* InstanceOf();
+  const Operator* InstanceOf(VectorSlotPair const& feedback);
   const Operator* OrdinaryHasInstance();
 
   const Operator* ForInNext();
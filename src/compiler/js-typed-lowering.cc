@@ -27,7 +27,12 @@ namespace {
 bool WillCreateConsString(HeapObjectMatcher left, HeapObjectMatcher right) {
   if (right.HasValue() && right.Value()->IsString()) {
     Handle<String> right_string = Handle<String>::cast(right.Value());
-    if (right_string->length() >= ConsString::kMinLength) return true;
+    // Short right hand sides are left to the StringAdd stub, which merges
+    // them into the flat second part of a cons string {left}, see
+    // Factory::NewConsString.
+    if (right_string->length() > ConsString::kMaxAppendChunkLength) {
+      return true;
+    }
   }
   if (left.HasValue() && left.Value()->IsString()) {
     Handle<String> left_string = Handle<String>::cast(left.Value());
@@ -2430,6 +2435,8 @@ Reduction JSTypedLowering::ReduceJSGeneratorStore(Node* node) {
 
   for (int i = 0; i < p.register_count(); ++i) {
     Node* value = NodeProperties::GetValueInput(node, 3 + i);
+    // Registers that are dead at the resume point are not saved.
+    if (value == jsgraph()->OptimizedOutConstant()) continue;
     effect = graph()->NewNode(
         simplified()->StoreField(AccessBuilder::ForFixedArraySlot(i)), array,
         value, effect, control);
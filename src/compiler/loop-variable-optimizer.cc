@@ -4,11 +4,16 @@
 
 #include "src/compiler/loop-variable-optimizer.h"
 
+#include <cmath>
+#include <limits>
+
+#include "src/compiler/all-nodes.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/node-marker.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
+#include "src/compiler/types.h"
 #include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
@@ -290,6 +295,21 @@ void LoopVariableOptimizer::TakeConditionsFromFirstControl(Node* node) {
   limits_[node->id()] = limits;
 }
 
+bool LoopVariableOptimizer::IsKnownLessThan(Node* left, Node* right,
+                                            Node* control) {
+  if (control->id() >= limits_.size()) return false;
+  const VariableLimits* limits = limits_[control->id()];
+  if (limits == nullptr) return false;
+  for (const Constraint* constraint = limits->head(); constraint != nullptr;
+       constraint = constraint->next()) {
+    if (constraint->kind() == InductionVariable::kStrict &&
+        constraint->left() == left && constraint->right() == right) {
+      return true;
+    }
+  }
+  return false;
+}
+
 const InductionVariable* LoopVariableOptimizer::FindInductionVariable(
     Node* node) {
   auto var = induction_vars_.find(node->id());
@@ -405,6 +425,87 @@ void LoopVariableOptimizer::ChangeToPhisAndInsertGuards() {
   }
 }
 
+void LoopVariableOptimizer::EliminateRedundantBoundsChecks() {
+  AllNodes all(zone(), graph());
+  for (Node* node : all.reachable) {
+    if (node->opcode() != IrOpcode::kCheckBounds) continue;
+    Node* index = NodeProperties::GetValueInput(node, 0);
+    Node* length = NodeProperties::GetValueInput(node, 1);
+    if (FindInductionVariable(index) == nullptr) continue;
+    // The comparison only tells us that {index} is below {length}, so the
+    // type has to rule out negative and non-integral indices.
+    Type* index_type = NodeProperties::GetType(index);
+    if (!index_type->Is(Type::Integral32()) || index_type->Min() < 0.0) {
+      continue;
+    }
+    Node* control = NodeProperties::GetControlInput(node);
+    if (!IsKnownLessThan(index, length, control)) continue;
+    TRACE("Removing bounds check %i on induction variable %i\n", node->id(),
+          index->id());
+    NodeProperties::ReplaceUses(node, index,
+                                NodeProperties::GetEffectInput(node));
+    node->Kill();
+  }
+}
+
+Node* LoopVariableOptimizer::FindEnclosingLoop(Node* node) {
+  // Follow the control chain from the loop body's entry back to the loop
+  // header; control flow that merges means {node} isn't at the top of the
+  // body.
+  Node* control = NodeProperties::GetControlInput(node);
+  while (control->opcode() != IrOpcode::kLoop) {
+    if (control->op()->ControlInputCount() != 1 ||
+        control->opcode() == IrOpcode::kLoopExit) {
+      return nullptr;
+    }
+    control = NodeProperties::GetControlInput(control);
+  }
+  return control;
+}
+
+double LoopVariableOptimizer::MaxIterations(Node* loop) {
+  double result = std::numeric_limits<double>::infinity();
+  for (auto entry : induction_vars_) {
+    InductionVariable* induction_var = entry.second;
+    Node* phi = induction_var->phi();
+    if (NodeProperties::GetControlInput(phi) != loop) continue;
+    Type* phi_type = NodeProperties::GetType(phi);
+    Type* increment_type = NodeProperties::GetType(induction_var->increment());
+    if (!phi_type->Is(Type::Integral32()) ||
+        !increment_type->Is(Type::Integral32())) {
+      continue;
+    }
+    // The variable changes by at least {step} in every iteration, and the
+    // loop header only sees values within the type of the phi.
+    double step = increment_type->Min() > 0.0 ? increment_type->Min()
+                                              : -increment_type->Max();
+    if (step < 1.0) continue;
+    double iterations =
+        std::floor((phi_type->Max() - phi_type->Min()) / step) + 1.0;
+    result = std::min(result, iterations);
+  }
+  return result;
+}
+
+void LoopVariableOptimizer::EliminateStackChecksInShortLoops(
+    double max_iterations) {
+  AllNodes all(zone(), graph());
+  for (Node* node : all.reachable) {
+    if (node->opcode() != IrOpcode::kJSStackCheck) continue;
+    if (NodeProperties::IsExceptionalCall(node)) continue;
+    Node* loop = FindEnclosingLoop(node);
+    if (loop == nullptr) continue;
+    double iterations = MaxIterations(loop);
+    if (iterations > max_iterations) continue;
+    TRACE("Removing stack check %i in loop %i with at most %.0f iterations\n",
+          node->id(), loop->id(), iterations);
+    NodeProperties::ReplaceUses(node, nullptr,
+                                NodeProperties::GetEffectInput(node),
+                                NodeProperties::GetControlInput(node));
+    node->Kill();
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
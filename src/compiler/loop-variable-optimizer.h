@@ -75,6 +75,18 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Removes the CheckBounds nodes whose index is a non-negative induction
+  // variable that is known to be less than the checked length, because the
+  // check is dominated by the true branch of a comparison of the two within
+  // the same loop iteration. Requires a typed graph and a preceding Run().
+  void EliminateRedundantBoundsChecks();
+
+  // Removes the stack checks at the top of loop bodies of loops that have an
+  // induction variable whose type limits the loop to at most
+  // {max_iterations} iterations, so that interrupts are delayed by a bounded
+  // amount of work only. Requires a typed graph and a preceding Run().
+  void EliminateStackChecksInShortLoops(double max_iterations);
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
@@ -95,6 +107,9 @@ class LoopVariableOptimizer {
                       InductionVariable::ConstraintKind kind, bool polarity);
 
   void TakeConditionsFromFirstControl(Node* node);
+  bool IsKnownLessThan(Node* left, Node* right, Node* control);
+  Node* FindEnclosingLoop(Node* node);
+  double MaxIterations(Node* loop);
   const InductionVariable* FindInductionVariable(Node* node);
   InductionVariable* TryGetInductionVariable(Node* phi);
   void DetectInductionVariables(Node* loop);
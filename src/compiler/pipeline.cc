@@ -311,12 +311,13 @@ class PipelineData {
     frame_ = new (instruction_zone()) Frame(fixed_frame_size);
   }
 
-  void InitializeRegisterAllocationData(const RegisterConfiguration* config,
-                                        CallDescriptor* descriptor) {
+  void InitializeRegisterAllocationData(
+      const RegisterConfiguration* config, CallDescriptor* descriptor,
+      RegisterAllocationData::Mode mode) {
     DCHECK(register_allocation_data_ == nullptr);
     register_allocation_data_ = new (register_allocation_zone())
         RegisterAllocationData(config, register_allocation_zone(), frame(),
-                               sequence(), debug_name());
+                               sequence(), debug_name(), mode);
   }
 
   void InitializeOsrHelper() {
@@ -618,14 +619,20 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl() {
     if (FLAG_inline_accessors) {
       info()->MarkAsAccessorInliningEnabled();
     }
-    if (info()->closure()->feedback_vector_cell()->map() ==
-        isolate()->heap()->one_closure_cell_map()) {
+    if (FLAG_turbo_native_context_independent && !info()->is_osr() &&
+        !info()->is_function_context_specializing() &&
+        !info()->shared_info()->feedback_metadata()->HasTypeProfileSlot()) {
+      // The code is shared by the closures of all native contexts, so it
+      // must not depend on the feedback or the contexts of this closure.
+      info()->MarkAsNativeContextIndependent();
+    } else if (info()->closure()->feedback_vector_cell()->map() ==
+               isolate()->heap()->one_closure_cell_map()) {
       info()->MarkAsFunctionContextSpecializing();
     }
   }
   if (!info()->is_optimizing_from_bytecode()) {
     if (!Compiler::EnsureBaselineCode(info())) return FAILED;
-  } else if (FLAG_turbo_inlining) {
+  } else if (FLAG_turbo_inlining && !info()->is_native_context_independent()) {
     info()->MarkAsInliningEnabled();
   }
 
@@ -664,7 +671,11 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl() {
   info()->dependencies()->Commit(code);
   info()->SetCode(code);
   if (info()->is_deoptimization_enabled()) {
-    info()->context()->native_context()->AddOptimizedCode(*code);
+    if (info()->is_native_context_independent()) {
+      isolate()->heap()->AddContextIndependentCode(code);
+    } else {
+      info()->context()->native_context()->AddOptimizedCode(*code);
+    }
     RegisterWeakObjectsInOptimizedCode(code);
   }
   return SUCCEEDED;
@@ -775,7 +786,7 @@ PipelineWasmCompilationJob::ExecuteJobImpl() {
   }
 
   pipeline_.RunPrintAndVerify("Machine", true);
-  if (FLAG_wasm_opt) {
+  if (FLAG_wasm_opt && !FLAG_wasm_baseline) {
     PipelineData* data = &data_;
     PipelineRunScope scope(data, "Wasm optimization");
     JSGraphReducer graph_reducer(data->jsgraph(), scope.zone());
@@ -940,21 +951,32 @@ struct InliningPhase {
         data->info()->is_deoptimization_enabled()
             ? JSIntrinsicLowering::kDeoptimizationEnabled
             : JSIntrinsicLowering::kDeoptimizationDisabled);
+    // Native context independent code must not embed the maps, prototypes
+    // and functions of the native context it is compiled in, nor inline the
+    // functions (and feedback vectors) of that context.
+    bool const native_context_independent =
+        data->info()->is_native_context_independent();
     AddReducer(data, &graph_reducer, &dead_code_elimination);
     AddReducer(data, &graph_reducer, &checkpoint_elimination);
     AddReducer(data, &graph_reducer, &common_reducer);
     if (data->info()->is_frame_specializing()) {
       AddReducer(data, &graph_reducer, &frame_specialization);
     }
-    if (data->info()->is_deoptimization_enabled()) {
+    if (data->info()->is_deoptimization_enabled() &&
+        !native_context_independent) {
       AddReducer(data, &graph_reducer, &native_context_specialization);
     }
-    AddReducer(data, &graph_reducer, &context_specialization);
+    if (!native_context_independent) {
+      AddReducer(data, &graph_reducer, &context_specialization);
+    }
     AddReducer(data, &graph_reducer, &intrinsic_lowering);
-    if (data->info()->is_deoptimization_enabled()) {
+    if (data->info()->is_deoptimization_enabled() &&
+        !native_context_independent) {
       AddReducer(data, &graph_reducer, &call_reducer);
     }
-    AddReducer(data, &graph_reducer, &inlining);
+    if (!native_context_independent) {
+      AddReducer(data, &graph_reducer, &inlining);
+    }
     graph_reducer.ReduceGraph();
   }
 };
@@ -1053,9 +1075,13 @@ struct TypedLoweringPhase {
     CommonOperatorReducer common_reducer(&graph_reducer, data->graph(),
                                          data->common(), data->machine());
     AddReducer(data, &graph_reducer, &dead_code_elimination);
-    AddReducer(data, &graph_reducer, &builtin_reducer);
-    if (data->info()->is_deoptimization_enabled()) {
-      AddReducer(data, &graph_reducer, &create_lowering);
+    // The builtin reducer and the create lowering bake in the initial maps
+    // and prototypes of the native context.
+    if (!data->info()->is_native_context_independent()) {
+      AddReducer(data, &graph_reducer, &builtin_reducer);
+      if (data->info()->is_deoptimization_enabled()) {
+        AddReducer(data, &graph_reducer, &create_lowering);
+      }
     }
     AddReducer(data, &graph_reducer, &typed_optimization);
     AddReducer(data, &graph_reducer, &typed_lowering);
@@ -1141,7 +1167,10 @@ struct GenericLoweringPhase {
 
   void Run(PipelineData* data, Zone* temp_zone) {
     JSGraphReducer graph_reducer(data->jsgraph(), temp_zone);
-    JSGenericLowering generic_lowering(data->jsgraph());
+    JSGenericLowering generic_lowering(
+        data->jsgraph(), data->info()->is_native_context_independent()
+                             ? JSGenericLowering::kNativeContextIndependent
+                             : JSGenericLowering::kNoFlags);
     AddReducer(data, &graph_reducer, &generic_lowering);
     graph_reducer.ReduceGraph();
   }
@@ -1271,6 +1300,23 @@ struct LoadEliminationPhase {
   }
 };
 
+struct LoopCheckEliminationPhase {
+  static const char* phase_name() { return "loop check elimination"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopVariableOptimizer induction_vars(data->jsgraph()->graph(),
+                                         data->common(), temp_zone);
+    induction_vars.Run();
+    if (FLAG_turbo_loop_bounds_check_elimination) {
+      induction_vars.EliminateRedundantBoundsChecks();
+    }
+    if (FLAG_turbo_loop_stack_check_max_iterations > 0) {
+      induction_vars.EliminateStackChecksInShortLoops(
+          FLAG_turbo_loop_stack_check_max_iterations);
+    }
+  }
+};
+
 struct MemoryOptimizationPhase {
   static const char* phase_name() { return "memory optimization"; }
 
@@ -1363,7 +1409,9 @@ struct InstructionSelectionPhase {
             ? InstructionSelector::kAllSourcePositions
             : InstructionSelector::kCallSourcePositions,
         InstructionSelector::SupportedFeatures(),
-        FLAG_turbo_instruction_scheduling
+        FLAG_turbo_instruction_scheduling ||
+                (FLAG_wasm_instruction_scheduling && !FLAG_wasm_baseline &&
+                 data->info()->IsWasm())
             ? InstructionSelector::kEnableScheduling
             : InstructionSelector::kDisableScheduling,
         data->info()->will_serialize()
@@ -1698,6 +1746,17 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
       RunPrintAndVerify("Load eliminated");
     }
 
+    // Bounds checks on induction variables are only recognized once load
+    // elimination has unified the lengths that the loop condition and the
+    // element accesses in the loop body load. Stack checks in loops with a
+    // small trip count are removed in the same pass.
+    if (FLAG_turbo_loop_variable &&
+        (FLAG_turbo_loop_bounds_check_elimination ||
+         FLAG_turbo_loop_stack_check_max_iterations > 0)) {
+      Run<LoopCheckEliminationPhase>();
+      RunPrintAndVerify("Loop checks eliminated");
+    }
+
     if (FLAG_turbo_escape) {
       Run<EscapeAnalysisPhase>();
       if (data->compilation_failed()) {
@@ -2079,7 +2138,25 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   data_->sequence()->ValidateDeferredBlockExitPaths();
 #endif
 
-  data->InitializeRegisterAllocationData(config, descriptor);
+  // Huge functions, typically produced by asm.js and WebAssembly, are
+  // allocated in fast mode, which skips splintering, spill slot merging for
+  // phis, loop-aware split and spill positions, and move optimization. So is
+  // all wasm code with --wasm-baseline.
+  bool fast_mode =
+      (FLAG_turbo_fast_regalloc_threshold > 0 &&
+       data->sequence()->instructions().size() >
+           static_cast<size_t>(FLAG_turbo_fast_regalloc_threshold)) ||
+      (FLAG_wasm_baseline && info()->IsWasm());
+  if (fast_mode && FLAG_trace_turbo_graph) {
+    CodeTracer::Scope tracing_scope(isolate()->GetCodeTracer());
+    OFStream os(tracing_scope.file());
+    os << "----- Using fast register allocation for "
+       << data->sequence()->instructions().size() << " instructions -----\n";
+  }
+  data->InitializeRegisterAllocationData(
+      config, descriptor,
+      fast_mode ? RegisterAllocationData::kFastMode
+                : RegisterAllocationData::kNormalMode);
   if (info()->is_osr()) data->osr_helper()->SetupFrame(data->frame());
 
   Run<MeetRegisterConstraintsPhase>();
@@ -2098,14 +2175,15 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
               ->RangesDefinedInDeferredStayInDeferred());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  bool preprocess_ranges = FLAG_turbo_preprocess_ranges && !fast_mode;
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
   }
 
   Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
   Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -2123,7 +2201,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<PopulateReferenceMapsPhase>();
   Run<ConnectRangesPhase>();
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (FLAG_turbo_move_optimization && !fast_mode) {
     Run<OptimizeMovesPhase>();
   }
 
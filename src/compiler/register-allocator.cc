@@ -1351,12 +1351,13 @@ void RegisterAllocationData::PhiMapValue::CommitAssignment(
 
 RegisterAllocationData::RegisterAllocationData(
     const RegisterConfiguration* config, Zone* zone, Frame* frame,
-    InstructionSequence* code, const char* debug_name)
+    InstructionSequence* code, const char* debug_name, Mode mode)
     : allocation_zone_(zone),
       frame_(frame),
       code_(code),
       debug_name_(debug_name),
       config_(config),
+      mode_(mode),
       phi_map_(allocation_zone()),
       live_in_sets_(code->InstructionBlockCount(), nullptr, allocation_zone()),
       live_out_sets_(code->InstructionBlockCount(), nullptr, allocation_zone()),
@@ -2642,6 +2643,9 @@ LifetimePosition RegisterAllocator::FindOptimalSplitPos(LifetimePosition start,
   // We have no choice
   if (start_instr == end_instr) return end;
 
+  // Do not search for a split position outside of loops in fast mode.
+  if (data()->is_fast_mode()) return end;
+
   const InstructionBlock* start_block = GetInstructionBlock(code(), start);
   const InstructionBlock* end_block = GetInstructionBlock(code(), end);
 
@@ -2674,6 +2678,9 @@ LifetimePosition RegisterAllocator::FindOptimalSplitPos(LifetimePosition start,
 
 LifetimePosition RegisterAllocator::FindOptimalSpillingPos(
     LiveRange* range, LifetimePosition pos) {
+  // Do not hoist spills out of loops in fast mode.
+  if (data()->is_fast_mode()) return pos;
+
   const InstructionBlock* block = GetInstructionBlock(code(), pos.Start());
   const InstructionBlock* loop_header =
       block->IsLoopHeader() ? block : GetContainingLoop(code(), block);
@@ -2791,8 +2798,12 @@ void LinearScanAllocator::AllocateRegisters() {
     TRACE("Processing interval %d:%d start=%d\n", current->TopLevel()->vreg(),
           current->relative_id(), position.value());
 
-    if (current->IsTopLevel() && TryReuseSpillForPhi(current->TopLevel()))
+    // Merging the spill slots of phis and their inputs is skipped in fast
+    // mode.
+    if (current->IsTopLevel() && !data()->is_fast_mode() &&
+        TryReuseSpillForPhi(current->TopLevel())) {
       continue;
+    }
 
     for (size_t i = 0; i < active_live_ranges().size(); ++i) {
       LiveRange* cur_active = active_live_ranges()[i];
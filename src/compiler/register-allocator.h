@@ -763,10 +763,15 @@ class RegisterAllocationData final : public ZoneObject {
   typedef ZoneVector<std::pair<TopLevelLiveRange*, int>>
       RangesWithPreassignedSlots;
 
+  // In fast mode the allocator trades code quality for compile time, see
+  // PipelineImpl::AllocateRegisters.
+  enum Mode { kNormalMode, kFastMode };
+
   RegisterAllocationData(const RegisterConfiguration* config,
                          Zone* allocation_zone, Frame* frame,
                          InstructionSequence* code,
-                         const char* debug_name = nullptr);
+                         const char* debug_name = nullptr,
+                         Mode mode = kNormalMode);
 
   const ZoneVector<TopLevelLiveRange*>& live_ranges() const {
     return live_ranges_;
@@ -810,6 +815,7 @@ class RegisterAllocationData final : public ZoneObject {
   Frame* frame() const { return frame_; }
   const char* debug_name() const { return debug_name_; }
   const RegisterConfiguration* config() const { return config_; }
+  bool is_fast_mode() const { return mode_ == kFastMode; }
 
   MachineRepresentation RepresentationFor(int virtual_register);
 
@@ -852,6 +858,7 @@ class RegisterAllocationData final : public ZoneObject {
   InstructionSequence* const code_;
   const char* const debug_name_;
   const RegisterConfiguration* const config_;
+  const Mode mode_;
   PhiMap phi_map_;
   ZoneVector<BitVector*> live_in_sets_;
   ZoneVector<BitVector*> live_out_sets_;
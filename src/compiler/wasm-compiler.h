@@ -55,6 +55,9 @@ class WasmCompilationUnit final {
   int func_index() const { return func_index_; }
 
   void ReopenCentryStub() { centry_stub_ = handle(*centry_stub_, isolate_); }
+  // Replaces the handle to the CEntry stub by one which outlives the current
+  // handle scope.
+  void set_centry_stub(Handle<Code> centry_stub) { centry_stub_ = centry_stub; }
   void ExecuteCompilation();
   Handle<Code> FinishCompilation(wasm::ErrorThrower* thrower);
 
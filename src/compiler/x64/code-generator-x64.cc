@@ -2165,6 +2165,137 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       }
       break;
     }
+    case kX64F32x4Splat: {
+      XMMRegister dst = i.OutputSimd128Register();
+      if (instr->InputAt(0)->IsFPRegister()) {
+        __ movss(dst, i.InputDoubleRegister(0));
+      } else {
+        __ movss(dst, i.InputOperand(0));
+      }
+      __ shufps(dst, dst, 0x0);
+      break;
+    }
+    case kX64F32x4ExtractLane: {
+      CpuFeatureScope sse_scope(masm(), SSE4_1);
+      __ extractps(kScratchRegister, i.InputSimd128Register(0), i.InputInt8(1));
+      __ movd(i.OutputDoubleRegister(), kScratchRegister);
+      break;
+    }
+    case kX64F32x4ReplaceLane: {
+      CpuFeatureScope sse_scope(masm(), SSE4_1);
+      // The insertps instruction uses imm8[5:4] to select the destination lane.
+      byte select = (i.InputInt8(1) << 4) & 0x30;
+      __ insertps(i.OutputSimd128Register(), i.InputDoubleRegister(2), select);
+      break;
+    }
+    case kX64F32x4SConvertI32x4: {
+      __ cvtdq2ps(i.OutputSimd128Register(), i.InputSimd128Register(0));
+      break;
+    }
+    case kX64F32x4UConvertI32x4: {
+      DCHECK(i.OutputSimd128Register().is(i.InputSimd128Register(0)));
+      XMMRegister dst = i.OutputSimd128Register();
+      // Split each lane into its low and high 16 bits, which both convert
+      // exactly, so that only the final addition rounds.
+      __ pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+      __ psrld(kScratchDoubleReg, 16);
+      __ pand(kScratchDoubleReg, dst);
+      __ psubd(dst, kScratchDoubleReg);
+      __ cvtdq2ps(kScratchDoubleReg, kScratchDoubleReg);
+      __ psrld(dst, 1);
+      __ cvtdq2ps(dst, dst);
+      __ addps(dst, dst);
+      __ addps(dst, kScratchDoubleReg);
+      break;
+    }
+    case kX64F32x4Abs: {
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(0);
+      if (dst.is(src)) {
+        __ pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+        __ psrld(kScratchDoubleReg, 1);
+        __ andps(dst, kScratchDoubleReg);
+      } else {
+        __ pcmpeqd(dst, dst);
+        __ psrld(dst, 1);
+        __ andps(dst, src);
+      }
+      break;
+    }
+    case kX64F32x4Neg: {
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(0);
+      if (dst.is(src)) {
+        __ pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+        __ pslld(kScratchDoubleReg, 31);
+        __ xorps(dst, kScratchDoubleReg);
+      } else {
+        __ pcmpeqd(dst, dst);
+        __ pslld(dst, 31);
+        __ xorps(dst, src);
+      }
+      break;
+    }
+    case kX64F32x4RecipApprox: {
+      __ rcpps(i.OutputSimd128Register(), i.InputSimd128Register(0));
+      break;
+    }
+    case kX64F32x4RecipSqrtApprox: {
+      __ rsqrtps(i.OutputSimd128Register(), i.InputSimd128Register(0));
+      break;
+    }
+    case kX64F32x4Add: {
+      __ addps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Sub: {
+      __ subps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Mul: {
+      __ mulps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Min: {
+      XMMRegister dst = i.OutputSimd128Register();
+      // minps returns its second operand if either operand is NaN and does
+      // not order -0 before +0. Computing it in both orders and merging the
+      // results propagates both NaNs and -0.
+      __ movaps(kScratchDoubleReg, i.InputSimd128Register(1));
+      __ minps(kScratchDoubleReg, dst);
+      __ minps(dst, i.InputSimd128Register(1));
+      __ orps(dst, kScratchDoubleReg);
+      break;
+    }
+    case kX64F32x4Max: {
+      XMMRegister dst = i.OutputSimd128Register();
+      // As for min, except that the two results only differ for NaNs and for
+      // +0 against -0, where subtracting the difference yields NaN or +0.
+      __ movaps(kScratchDoubleReg, i.InputSimd128Register(1));
+      __ maxps(kScratchDoubleReg, dst);
+      __ maxps(dst, i.InputSimd128Register(1));
+      __ xorps(dst, kScratchDoubleReg);
+      __ orps(kScratchDoubleReg, dst);
+      __ subps(kScratchDoubleReg, dst);
+      __ movaps(dst, kScratchDoubleReg);
+      break;
+    }
+    case kX64F32x4Eq: {
+      __ cmpeqps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Ne: {
+      __ cmpneqps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Lt: {
+      __ cmpltps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Le: {
+      __ cmpleps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
     case kX64I32x4Splat: {
       XMMRegister dst = i.OutputSimd128Register();
       __ movd(dst, i.InputRegister(0));
@@ -4,12 +4,80 @@
 
 #include "src/compiler/instruction-scheduler.h"
 
+#include "src/base/cpu.h"
+#include "src/base/once.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// The core the latency model is selected for. Big cores use the default
+// table below; low-power Atom cores (Bonnell, Silvermont, Airmont) issue
+// fewer instructions per cycle and have longer multiply, divide and
+// floating-point latencies.
+enum class CpuModel { kBigCore, kAtom };
+
+CpuModel cpu_model = CpuModel::kBigCore;
+base::OnceType detect_cpu_model_once = V8_ONCE_INIT;
+
+void DetectCpuModel() {
+  base::CPU cpu;
+  if (cpu.is_atom()) cpu_model = CpuModel::kAtom;
+}
+
+CpuModel GetCpuModel() {
+  base::CallOnce(&detect_cpu_model_once, &DetectCpuModel);
+  return cpu_model;
+}
+
+// Latencies on Atom cores, following the Intel optimization reference manual.
+// Returns 0 for instructions that use the default latency.
+int GetAtomInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+      return 4;
+    case kX64Imul:
+      return 5;
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+      return 5;
+    case kSSEFloat32Mul:
+      return 4;
+    case kSSEFloat64Mul:
+      return 5;
+    case kSSEFloat32Div:
+    case kSSEFloat32Sqrt:
+      return 20;
+    case kSSEFloat64Div:
+    case kSSEFloat64Sqrt:
+      return 34;
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return 40;
+    case kX64Idiv:
+    case kX64Udiv:
+      return 80;
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+int InstructionScheduler::GetIssueWidth() {
+  return GetCpuModel() == CpuModel::kAtom ? 2 : 4;
+}
+
 
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
@@ -123,6 +191,24 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Lea:
     case kX64Dec32:
     case kX64Inc32:
+    case kX64F32x4Splat:
+    case kX64F32x4ExtractLane:
+    case kX64F32x4ReplaceLane:
+    case kX64F32x4SConvertI32x4:
+    case kX64F32x4UConvertI32x4:
+    case kX64F32x4Abs:
+    case kX64F32x4Neg:
+    case kX64F32x4RecipApprox:
+    case kX64F32x4RecipSqrtApprox:
+    case kX64F32x4Add:
+    case kX64F32x4Sub:
+    case kX64F32x4Mul:
+    case kX64F32x4Min:
+    case kX64F32x4Max:
+    case kX64F32x4Eq:
+    case kX64F32x4Ne:
+    case kX64F32x4Lt:
+    case kX64F32x4Le:
     case kX64I32x4Splat:
     case kX64I32x4ExtractLane:
     case kX64I32x4ReplaceLane:
@@ -243,6 +329,10 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  if (GetCpuModel() == CpuModel::kAtom) {
+    int latency = GetAtomInstructionLatency(instr);
+    if (latency != 0) return latency;
+  }
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
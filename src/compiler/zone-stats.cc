@@ -61,7 +61,10 @@ void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
 }
 
 ZoneStats::ZoneStats(AccountingAllocator* allocator)
-    : max_allocated_bytes_(0), total_deleted_bytes_(0), allocator_(allocator) {}
+    : max_allocated_bytes_(0),
+      total_deleted_bytes_(0),
+      allocator_(allocator),
+      reused_segments_at_start_(allocator->GetSegmentReuseCount()) {}
 
 ZoneStats::~ZoneStats() {
   DCHECK(zones_.empty());
@@ -84,6 +87,14 @@ size_t ZoneStats::GetTotalAllocatedBytes() const {
   return total_deleted_bytes_ + GetCurrentAllocatedBytes();
 }
 
+size_t ZoneStats::GetReusedSegmentCount() const {
+  return allocator_->GetSegmentReuseCount() - reused_segments_at_start_;
+}
+
+size_t ZoneStats::GetSegmentPoolSize() const {
+  return allocator_->GetCurrentPoolSize();
+}
+
 Zone* ZoneStats::NewEmptyZone(const char* zone_name) {
   Zone* zone = new Zone(allocator_, zone_name);
   zones_.push_back(zone);
@@ -70,6 +70,13 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   size_t GetTotalAllocatedBytes() const;
   size_t GetCurrentAllocatedBytes() const;
 
+  // Number of zone segments the allocator served from its segment pool since
+  // this ZoneStats was created. The pool is shared by all users of the
+  // allocator, so this includes reuse by concurrent compilations.
+  size_t GetReusedSegmentCount() const;
+  // Bytes currently held in the allocator's segment pool.
+  size_t GetSegmentPoolSize() const;
+
  private:
   Zone* NewEmptyZone(const char* zone_name);
   void ReturnZone(Zone* zone);
@@ -83,6 +90,7 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   size_t max_allocated_bytes_;
   size_t total_deleted_bytes_;
   AccountingAllocator* allocator_;
+  size_t reused_segments_at_start_;
 
   DISALLOW_COPY_AND_ASSIGN(ZoneStats);
 };
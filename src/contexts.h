@@ -82,6 +82,7 @@ enum ContextLookupFlags {
   V(PROMISE_THEN_INDEX, JSFunction, promise_then)                           \
   V(PROMISE_HANDLE_INDEX, JSFunction, promise_handle)                       \
   V(PROMISE_HANDLE_REJECT_INDEX, JSFunction, promise_handle_reject)         \
+  V(PROMISE_RUN_REACTION_JOBS_INDEX, JSFunction, promise_run_reaction_jobs) \
   V(ASYNC_GENERATOR_AWAIT_CAUGHT, JSFunction, async_generator_await_caught) \
   V(ASYNC_GENERATOR_AWAIT_UNCAUGHT, JSFunction, async_generator_await_uncaught)
 
@@ -19,6 +19,8 @@ void RuntimeCallTimer::Start(RuntimeCallCounter* counter,
   parent_.SetValue(parent);
   if (FLAG_runtime_stats ==
       v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING) {
+    // Counting is cheap, the time is attributed by RuntimeCallStatsSampler.
+    counter->Increment();
     return;
   }
   base::TimeTicks now = Now();
@@ -406,18 +406,20 @@ class RuntimeCallStatEntries {
 void RuntimeCallCounter::Reset() {
   count_ = 0;
   time_ = 0;
+  base::Relaxed_Store(&samples_, 0);
 }
 
 void RuntimeCallCounter::Dump(v8::tracing::TracedValue* value) {
   value->BeginArray(name_);
   value->AppendDouble(count_);
-  value->AppendDouble(time_);
+  value->AppendDouble(time().InMicroseconds());
   value->EndArray();
 }
 
 void RuntimeCallCounter::Add(RuntimeCallCounter* other) {
   count_ += other->count();
-  time_ += other->time().InMicroseconds();
+  time_ += other->time_;
+  base::Relaxed_Store(&samples_, samples() + other->samples());
 }
 
 void RuntimeCallTimer::Snapshot() {
@@ -536,7 +538,9 @@ void RuntimeCallStats::CorrectCurrentCounterId(RuntimeCallStats* stats,
 
 void RuntimeCallStats::Print(std::ostream& os) {
   RuntimeCallStatEntries entries;
-  if (current_timer_.Value() != nullptr) {
+  // Timers are not started in sampling mode.
+  if (current_timer_.Value() != nullptr &&
+      current_timer_.Value()->IsStarted()) {
     current_timer_.Value()->Snapshot();
   }
   for (const RuntimeCallStats::CounterId counter_id :
@@ -567,6 +571,25 @@ void RuntimeCallStats::Reset() {
   in_use_ = true;
 }
 
+RuntimeCallStatsSampler::RuntimeCallStatsSampler(RuntimeCallStats* stats)
+    : Thread(Thread::Options("v8:RCSSampler")),
+      stats_(stats),
+      interval_(base::TimeDelta::FromMicroseconds(
+          FLAG_runtime_call_stats_sampling_interval)),
+      stop_semaphore_(0) {}
+
+void RuntimeCallStatsSampler::Run() {
+  while (!stop_semaphore_.WaitFor(interval_)) {
+    RuntimeCallCounter* counter = stats_->current_counter();
+    if (counter != nullptr) counter->AddSample();
+  }
+}
+
+void RuntimeCallStatsSampler::Stop() {
+  stop_semaphore_.Signal();
+  Join();
+}
+
 void RuntimeCallStats::Dump(v8::tracing::TracedValue* value) {
   for (const RuntimeCallStats::CounterId counter_id :
        RuntimeCallStats::counters) {
@@ -549,18 +549,23 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
 class RuntimeCallCounter final {
  public:
   explicit RuntimeCallCounter(const char* name)
-      : name_(name), count_(0), time_(0) {}
+      : name_(name), count_(0), time_(0), samples_(0) {}
   V8_NOINLINE void Reset();
   V8_NOINLINE void Dump(v8::tracing::TracedValue* value);
   void Add(RuntimeCallCounter* other);
 
   const char* name() const { return name_; }
   int64_t count() const { return count_; }
+  // The measured time plus the time estimated from samples.
   base::TimeDelta time() const {
-    return base::TimeDelta::FromMicroseconds(time_);
+    return base::TimeDelta::FromMicroseconds(
+        time_ + samples() * FLAG_runtime_call_stats_sampling_interval);
   }
+  int64_t samples() const { return base::Relaxed_Load(&samples_); }
   void Increment() { count_++; }
   void Add(base::TimeDelta delta) { time_ += delta.InMicroseconds(); }
+  // Only called by the RuntimeCallStatsSampler thread.
+  void AddSample() { base::Relaxed_Store(&samples_, samples() + 1); }
 
  private:
   friend class RuntimeCallStats;
@@ -571,6 +576,8 @@ class RuntimeCallCounter final {
   int64_t count_;
   // Stored as int64_t so that its initialization can be deferred.
   int64_t time_;
+  // Number of samples taken while this was the current counter.
+  base::AtomicWord samples_;
 };
 
 // RuntimeCallTimer is used to keep track of the stack of currently active
@@ -663,6 +670,7 @@ class RuntimeCallTimer final {
   V(Object_GetOwnPropertyNames)                            \
   V(Object_GetPropertyAttributes)                          \
   V(Object_GetPropertyNames)                               \
+  V(Object_GetProperties)                                  \
   V(Object_GetRealNamedProperty)                           \
   V(Object_GetRealNamedPropertyAttributes)                 \
   V(Object_GetRealNamedPropertyAttributesInPrototypeChain) \
@@ -862,6 +870,7 @@ class RuntimeCallTimer final {
   V(LoadIC_LoadNonexistentDH)                    \
   V(LoadIC_LoadNormalDH)                         \
   V(LoadIC_LoadNormalFromPrototypeDH)            \
+  V(LoadIC_LoadProxy)                            \
   V(LoadIC_LoadScriptContextFieldStub)           \
   V(LoadIC_LoadViaGetter)                        \
   V(LoadIC_NonReceiver)                          \
@@ -878,6 +887,7 @@ class RuntimeCallTimer final {
   V(StoreIC_StoreGlobalTransitionDH)             \
   V(StoreIC_StoreInterceptorStub)                \
   V(StoreIC_StoreNormalDH)                       \
+  V(StoreIC_StoreProxy)                          \
   V(StoreIC_StoreScriptContextFieldStub)         \
   V(StoreIC_StoreTransitionDH)                   \
   V(StoreIC_StoreViaSetter)
@@ -943,6 +953,25 @@ class RuntimeCallStats final : public ZoneObject {
   bool in_use_;
 };
 
+// With --runtime-call-stats-sampling, RuntimeCallTimers only keep track of
+// the current counter and never read the time. Instead this thread
+// periodically attributes the sampling interval to the current counter.
+class RuntimeCallStatsSampler final : public base::Thread {
+ public:
+  explicit RuntimeCallStatsSampler(RuntimeCallStats* stats);
+
+  void Run() override;
+  // Stops sampling and joins the thread.
+  void Stop();
+
+ private:
+  RuntimeCallStats* const stats_;
+  const base::TimeDelta interval_;
+  base::Semaphore stop_semaphore_;
+
+  DISALLOW_COPY_AND_ASSIGN(RuntimeCallStatsSampler);
+};
+
 #define CHANGE_CURRENT_RUNTIME_COUNTER(runtime_call_stats, counter_name) \
   do {                                                                   \
     if (V8_UNLIKELY(FLAG_runtime_stats)) {                               \
@@ -1134,6 +1163,12 @@ class RuntimeCallTimerScope {
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                      \
   SC(compilation_cache_hits, V8.CompilationCacheHits)               \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)           \
+  /* Lookups in the on-disk code cache (--code-cache-dir). */       \
+  SC(code_cache_dir_hits, V8.CodeCacheDirHits)                      \
+  SC(code_cache_dir_misses, V8.CodeCacheDirMisses)                  \
+  SC(code_cache_dir_rejects, V8.CodeCacheDirRejects)                \
+  SC(code_cache_dir_corruptions, V8.CodeCacheDirCorruptions)        \
+  SC(code_cache_dir_writes, V8.CodeCacheDirWrites)                  \
   /* Amount of evaled source code. */                               \
   SC(total_eval_size, V8.TotalEvalSize)                             \
   /* Amount of loaded source code. */                               \
@@ -1189,6 +1224,7 @@ class RuntimeCallTimerScope {
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_collisions, V8.MegamorphicStubCacheCollisions)     \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
@@ -1201,6 +1237,9 @@ class RuntimeCallTimerScope {
   SC(string_compare_runtime, V8.StringCompareRuntime)                          \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(regexp_entry_native, V8.RegExpEntryNative)                                \
+  SC(regexp_entry_interpreted, V8.RegExpEntryInterpreted)                      \
+  SC(regexp_tier_up, V8.RegExpTierUp)                                          \
+  SC(regexp_linear_fallback, V8.RegExpLinearFallback)                          \
   SC(number_to_string_native, V8.NumberToStringNative)                         \
   SC(number_to_string_runtime, V8.NumberToStringRuntime)                       \
   SC(math_exp_runtime, V8.MathExpRuntime)                                      \
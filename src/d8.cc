@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "src/base/platform/time.h"
 #include "src/base/sys-info.h"
 #include "src/basic-block-profiler.h"
+#include "src/counters.h"
 #include "src/debug/debug-interface.h"
 #include "src/interpreter/interpreter.h"
 #include "src/list-inl.h"
@@ -408,6 +410,16 @@ class PerIsolateData {
     PerIsolateData* data_;
   };
 
+  // Time spent in garbage collections, tracked for --bench.
+  static void GCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags) {
+    Get(isolate)->gc_start_ = base::TimeTicks::HighResolutionNow();
+  }
+  static void GCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags) {
+    PerIsolateData* data = Get(isolate);
+    data->gc_time_ += base::TimeTicks::HighResolutionNow() - data->gc_start_;
+  }
+  base::TimeDelta gc_time() const { return gc_time_; }
+
  private:
   friend class Shell;
   friend class RealmScope;
@@ -417,6 +429,8 @@ class PerIsolateData {
   int realm_switch_;
   Global<Context>* realms_;
   Global<Value> realm_shared_;
+  base::TimeTicks gc_start_;
+  base::TimeDelta gc_time_;
 
   int RealmIndexOrThrow(const v8::FunctionCallbackInfo<v8::Value>& args,
                         int arg_offset);
@@ -2414,6 +2428,166 @@ void SourceGroup::JoinThread() {
   thread_->Join();
 }
 
+namespace {
+
+struct BenchmarkResult {
+  BenchmarkResult() : ok(true), compile_time_ms(-1) {}
+  bool ok;
+  // Latencies of the individual calls in microseconds.
+  std::vector<double> latencies;
+  base::TimeDelta gc_time;
+  // Only measured with --runtime-call-stats.
+  double compile_time_ms;
+};
+
+// Runs the main source group in a new isolate, then calls the function to
+// benchmark until the deadline passes.
+class BenchmarkThread : public base::Thread {
+ public:
+  BenchmarkThread(base::Semaphore* ready, base::Semaphore* start,
+                  const base::TimeTicks* deadline)
+      : base::Thread(Options("BenchmarkThread", 2 * MB)),
+        ready_(ready),
+        start_(start),
+        deadline_(deadline) {}
+
+  void Run() override {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    isolate->SetHostImportModuleDynamicallyCallback(
+        Shell::HostImportModuleDynamically);
+    Shell::EnsureEventLoopInitialized(isolate);
+    D8Console console(isolate);
+    debug::SetConsoleDelegate(isolate, &console);
+    {
+      Isolate::Scope iscope(isolate);
+      HandleScope scope(isolate);
+      PerIsolateData data(isolate);
+      Local<Context> context = Shell::CreateEvaluationContext(isolate);
+      Context::Scope cscope(context);
+      PerIsolateData::RealmScope realm_scope(&data);
+      Shell::options.isolate_sources[0].Execute(isolate);
+
+      Local<Value> value;
+      Local<String> name =
+          String::NewFromUtf8(isolate, Shell::options.bench_function,
+                              NewStringType::kNormal)
+              .ToLocalChecked();
+      if (!context->Global()->Get(context, name).ToLocal(&value) ||
+          !value->IsFunction()) {
+        printf("--bench: '%s' is not a global function\n",
+               Shell::options.bench_function);
+        result_.ok = false;
+      }
+      ready_->Signal();
+      start_->Wait();
+      if (result_.ok) RunCalls(isolate, context, value.As<Function>());
+      result_.gc_time = data.gc_time();
+      if (i::FLAG_runtime_stats) {
+        i::RuntimeCallStats* stats = reinterpret_cast<i::Isolate*>(isolate)
+                                         ->counters()
+                                         ->runtime_call_stats();
+        result_.compile_time_ms = 0;
+        for (int i = 0; i < i::RuntimeCallStats::counters_count; i++) {
+          i::RuntimeCallCounter* counter =
+              &(stats->*(i::RuntimeCallStats::counters[i]));
+          if (strstr(counter->name(), "Compile") != nullptr) {
+            result_.compile_time_ms += counter->time().InMillisecondsF();
+          }
+        }
+      }
+    }
+    isolate->Dispose();
+  }
+
+  BenchmarkResult* result() { return &result_; }
+
+ private:
+  void RunCalls(Isolate* isolate, Local<Context> context,
+                Local<Function> function) {
+    isolate->AddGCPrologueCallback(PerIsolateData::GCPrologue);
+    isolate->AddGCEpilogueCallback(PerIsolateData::GCEpilogue);
+    TryCatch try_catch(isolate);
+    while (true) {
+      HandleScope scope(isolate);
+      base::TimeTicks before = base::TimeTicks::HighResolutionNow();
+      if (before >= *deadline_) break;
+      if (function->Call(context, context->Global(), 0, nullptr).IsEmpty()) {
+        Shell::ReportException(isolate, &try_catch);
+        result_.ok = false;
+        break;
+      }
+      result_.latencies.push_back(
+          (base::TimeTicks::HighResolutionNow() - before).InMillisecondsF() *
+          1000);
+    }
+    isolate->RemoveGCPrologueCallback(PerIsolateData::GCPrologue);
+    isolate->RemoveGCEpilogueCallback(PerIsolateData::GCEpilogue);
+  }
+
+  base::Semaphore* ready_;
+  base::Semaphore* start_;
+  const base::TimeTicks* deadline_;
+  BenchmarkResult result_;
+};
+
+void PrintBenchmarkLine(const char* label, std::vector<double>* latencies,
+                        double seconds) {
+  std::sort(latencies->begin(), latencies->end());
+  size_t count = latencies->size();
+  auto percentile = [latencies, count](double p) {
+    if (count == 0) return 0.0;
+    return (*latencies)[std::min(count - 1, static_cast<size_t>(p * count))];
+  };
+  printf("%s: %zu ops, %.1f ops/s, latency us: p50 %.1f p90 %.1f p99 %.1f "
+         "max %.1f",
+         label, count, count / seconds, percentile(0.5), percentile(0.9),
+         percentile(0.99), count ? latencies->back() : 0.0);
+}
+
+}  // namespace
+
+int Shell::RunBenchmark() {
+  int isolates = options.bench_isolates;
+  base::Semaphore ready(0);
+  base::Semaphore start(0);
+  base::TimeTicks deadline;
+  std::vector<std::unique_ptr<BenchmarkThread>> threads;
+  for (int i = 0; i < isolates; i++) {
+    threads.emplace_back(new BenchmarkThread(&ready, &start, &deadline));
+    threads.back()->Start();
+  }
+  // Wait until every isolate has loaded the scripts, so that all of them run
+  // the function at the same time.
+  for (int i = 0; i < isolates; i++) ready.Wait();
+  deadline = base::TimeTicks::HighResolutionNow() +
+             base::TimeDelta::FromMicroseconds(
+                 static_cast<int64_t>(options.bench_duration * 1e6));
+  for (int i = 0; i < isolates; i++) start.Signal();
+  for (auto& thread : threads) thread->Join();
+
+  bool ok = true;
+  std::vector<double> all_latencies;
+  for (int i = 0; i < isolates; i++) {
+    BenchmarkResult* result = threads[i]->result();
+    ok &= result->ok;
+    all_latencies.insert(all_latencies.end(), result->latencies.begin(),
+                         result->latencies.end());
+    std::string label = "isolate " + std::to_string(i);
+    PrintBenchmarkLine(label.c_str(), &result->latencies,
+                       options.bench_duration);
+    printf(", gc %.1f ms", result->gc_time.InMillisecondsF());
+    if (result->compile_time_ms >= 0) {
+      printf(", compile %.1f ms", result->compile_time_ms);
+    }
+    printf("\n");
+  }
+  PrintBenchmarkLine("total", &all_latencies, options.bench_duration);
+  printf("\n");
+  return ok ? 0 : 1;
+}
+
 ExternalizedContents::~ExternalizedContents() {
   Shell::array_buffer_allocator->Free(data_, size_);
 }
@@ -2428,8 +2602,8 @@ bool SerializationDataQueue::Dequeue(
   out_data->reset();
   base::LockGuard<base::Mutex> lock_guard(&mutex_);
   if (data_.empty()) return false;
-  *out_data = std::move(data_[0]);
-  data_.erase(data_.begin());
+  *out_data = std::move(data_.front());
+  data_.pop_front();
   return true;
 }
 
@@ -2627,6 +2801,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--mock-arraybuffer-allocator") == 0) {
       options.mock_arraybuffer_allocator = true;
       argv[i] = NULL;
+    } else if (strcmp(argv[i], "--pooling-arraybuffer-allocator") == 0) {
+      options.pooling_arraybuffer_allocator = true;
+      argv[i] = NULL;
     } else if (strcmp(argv[i], "--noalways-opt") == 0 ||
                strcmp(argv[i], "--no-always-opt") == 0) {
       // No support for stressing if we can't use --always-opt.
@@ -2696,6 +2873,22 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--trace-config=", 15) == 0) {
       options.trace_config = argv[i] + 15;
       argv[i] = NULL;
+    } else if (strcmp(argv[i], "--trace-binary") == 0) {
+      options.trace_binary = true;
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--bench=", 8) == 0) {
+      options.bench_function = argv[i] + 8;
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--bench-isolates=", 17) == 0) {
+      options.bench_isolates = atoi(argv[i] + 17);
+      if (options.bench_isolates < 1) {
+        printf("--bench-isolates needs a positive number\n");
+        return false;
+      }
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--bench-duration=", 17) == 0) {
+      options.bench_duration = atof(argv[i] + 17);
+      argv[i] = NULL;
     } else if (strcmp(argv[i], "--enable-inspector") == 0) {
       options.enable_inspector = true;
       argv[i] = NULL;
@@ -3112,12 +3305,20 @@ int Shell::Main(int argc, char* argv[]) {
 
   platform::tracing::TracingController* tracing_controller;
   if (options.trace_enabled && !i::FLAG_verify_predictable) {
-    trace_file.open("v8_trace.json");
+    platform::tracing::TraceWriter* trace_writer;
+    if (options.trace_binary) {
+      trace_file.open("v8_trace.bin", std::ios::binary);
+      trace_writer =
+          platform::tracing::TraceWriter::CreateBinaryTraceWriter(trace_file);
+    } else {
+      trace_file.open("v8_trace.json");
+      trace_writer =
+          platform::tracing::TraceWriter::CreateJSONTraceWriter(trace_file);
+    }
     tracing_controller = new platform::tracing::TracingController();
     platform::tracing::TraceBuffer* trace_buffer =
         platform::tracing::TraceBuffer::CreateTraceBufferRingBuffer(
-            platform::tracing::TraceBuffer::kRingBufferChunks,
-            platform::tracing::TraceWriter::CreateJSONTraceWriter(trace_file));
+            platform::tracing::TraceBuffer::kRingBufferChunks, trace_writer);
     tracing_controller->Initialize(trace_buffer);
     platform::SetTracingController(g_platform, tracing_controller);
   }
@@ -3137,8 +3338,13 @@ int Shell::Main(int argc, char* argv[]) {
   Isolate::CreateParams create_params;
   ShellArrayBufferAllocator shell_array_buffer_allocator;
   MockArrayBufferAllocator mock_arraybuffer_allocator;
+  std::unique_ptr<ArrayBuffer::Allocator> pooling_arraybuffer_allocator;
   if (options.mock_arraybuffer_allocator) {
     Shell::array_buffer_allocator = &mock_arraybuffer_allocator;
+  } else if (options.pooling_arraybuffer_allocator) {
+    pooling_arraybuffer_allocator.reset(
+        ArrayBuffer::Allocator::NewPoolingAllocator());
+    Shell::array_buffer_allocator = pooling_arraybuffer_allocator.get();
   } else {
     Shell::array_buffer_allocator = &shell_array_buffer_allocator;
   }
@@ -3157,8 +3363,8 @@ int Shell::Main(int argc, char* argv[]) {
     create_params.add_histogram_sample_callback = AddHistogramSample;
   }
 
-  if (i::trap_handler::UseTrapHandler()) {
-    if (!v8::V8::RegisterDefaultSignalHandler()) {
+  if (i::FLAG_wasm_trap_handler && V8_TRAP_HANDLER_SUPPORTED) {
+    if (!v8::V8::EnableWebAssemblyTrapHandler(true)) {
       fprintf(stderr, "Could not register signal handler");
       exit(1);
     }
@@ -3190,7 +3396,9 @@ int Shell::Main(int argc, char* argv[]) {
       tracing_controller->StartTracing(trace_config);
     }
 
-    if (options.stress_opt || options.stress_deopt) {
+    if (options.bench_function != NULL) {
+      result = RunBenchmark();
+    } else if (options.stress_opt || options.stress_deopt) {
       Testing::SetStressRunType(options.stress_opt
                                 ? Testing::kStressTypeOpt
                                 : Testing::kStressTypeDeopt);
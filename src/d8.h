@@ -5,6 +5,7 @@
 #ifndef V8_D8_H_
 #define V8_D8_H_
 
+#include <deque>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -226,7 +227,7 @@ class SerializationDataQueue {
 
  private:
   base::Mutex mutex_;
-  std::vector<std::unique_ptr<SerializationData>> data_;
+  std::deque<std::unique_ptr<SerializationData>> data_;
 };
 
 
@@ -295,6 +296,7 @@ class ShellOptions {
         test_shell(false),
         expected_to_throw(false),
         mock_arraybuffer_allocator(false),
+        pooling_arraybuffer_allocator(false),
         enable_inspector(false),
         num_isolates(1),
         compile_options(v8::ScriptCompiler::kNoCompileOptions),
@@ -304,6 +306,10 @@ class ShellOptions {
         snapshot_blob(NULL),
         trace_enabled(false),
         trace_config(NULL),
+        trace_binary(false),
+        bench_function(NULL),
+        bench_isolates(1),
+        bench_duration(5.0),
         lcov_file(NULL),
         disable_in_process_stack_traces(false) {}
 
@@ -326,6 +332,7 @@ class ShellOptions {
   bool test_shell;
   bool expected_to_throw;
   bool mock_arraybuffer_allocator;
+  bool pooling_arraybuffer_allocator;
   bool enable_inspector;
   int num_isolates;
   v8::ScriptCompiler::CompileOptions compile_options;
@@ -335,6 +342,10 @@ class ShellOptions {
   const char* snapshot_blob;
   bool trace_enabled;
   const char* trace_config;
+  bool trace_binary;
+  const char* bench_function;
+  int bench_isolates;
+  double bench_duration;
   const char* lcov_file;
   bool disable_in_process_stack_traces;
 };
@@ -352,6 +363,7 @@ class Shell : public i::AllStatic {
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, int argc, char* argv[], bool last_run);
+  static int RunBenchmark();
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
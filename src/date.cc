@@ -4,6 +4,11 @@
 
 #include "src/date.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/objects.h"
 #include "src/objects-inl.h"
 
@@ -25,19 +30,121 @@ static const int kYearsOffset = 400000;
 static const char kDaysInMonths[] =
     {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
-DateCache::DateCache()
-    : stamp_(0),
-      tz_cache_(
+static base::TimezoneCache* CreateTimezoneCache() {
 #ifdef V8_INTL_SUPPORT
-          FLAG_icu_timezone_data ? new ICUTimezoneCache()
-                                 : base::OS::CreateTimezoneCache()
+  return FLAG_icu_timezone_data ? new ICUTimezoneCache()
+                                : base::OS::CreateTimezoneCache();
 #else
-          base::OS::CreateTimezoneCache()
+  return base::OS::CreateTimezoneCache();
 #endif
-              ) {
+}
+
+namespace {
+
+// Process-wide table of daylight savings transitions, shared by the date
+// caches of all isolates. The range [0, kMaxEpochTimeInSec] of times that are
+// passed to the OS is split into blocks of about a year. The transitions of a
+// block are computed from the OS on first use, after which any offset within
+// the block is a binary search away.
+class DaylightSavingsTable {
+ public:
+  DaylightSavingsTable() : tz_cache_(nullptr) {}
+
+  int OffsetInMs(int time_sec) {
+    DCHECK_LE(0, time_sec);
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    if (tz_cache_ == nullptr) tz_cache_ = CreateTimezoneCache();
+    std::vector<Transition>& block = blocks_[time_sec / kBlockSizeInSec];
+    if (block.empty()) ComputeBlock(time_sec / kBlockSizeInSec, &block);
+    auto it = std::upper_bound(
+        block.begin(), block.end(), time_sec,
+        [](int sec, const Transition& t) { return sec < t.start_sec; });
+    DCHECK(it != block.begin());
+    return (it - 1)->offset_ms;
+  }
+
+  void Clear() {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    for (std::vector<Transition>& block : blocks_) block.clear();
+    if (tz_cache_ != nullptr) tz_cache_->Clear();
+  }
+
+ private:
+  struct Transition {
+    int start_sec;
+    int offset_ms;
+  };
+
+  static const int kBlockSizeInSec = 365 * DateCache::kSecPerDay;
+  static const int kBlockCount =
+      DateCache::kMaxEpochTimeInSec / kBlockSizeInSec + 1;
+  // Like the DST segments of DateCache, this relies on there being at most
+  // one offset change per 19 days.
+  static const int kProbeDeltaInSec = 19 * DateCache::kSecPerDay;
+
+  int OffsetFromOS(int time_sec) {
+    return static_cast<int>(
+        tz_cache_->DaylightSavingsOffset(static_cast<double>(time_sec) * 1000));
+  }
+
+  void ComputeBlock(int index, std::vector<Transition>* block) {
+    int start = index * kBlockSizeInSec;
+    int end = DateCache::kMaxEpochTimeInSec - start < kBlockSizeInSec
+                  ? DateCache::kMaxEpochTimeInSec
+                  : start + kBlockSizeInSec - 1;
+    int offset = OffsetFromOS(start);
+    block->push_back({start, offset});
+    int time = start;
+    while (time < end) {
+      int next = end - time < kProbeDeltaInSec ? end : time + kProbeDeltaInSec;
+      int next_offset = OffsetFromOS(next);
+      if (next_offset != offset) {
+        // Find the first second in (time, next] with the new offset.
+        int low = time;
+        int high = next;
+        while (high - low > 1) {
+          int middle = low + (high - low) / 2;
+          if (OffsetFromOS(middle) == offset) {
+            low = middle;
+          } else {
+            high = middle;
+          }
+        }
+        block->push_back({high, next_offset});
+        offset = next_offset;
+      }
+      time = next;
+    }
+  }
+
+  base::Mutex mutex_;
+  base::TimezoneCache* tz_cache_;
+  std::vector<Transition> blocks_[kBlockCount];
+
+  DISALLOW_COPY_AND_ASSIGN(DaylightSavingsTable);
+};
+
+base::LazyInstance<DaylightSavingsTable>::type shared_dst_table =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+DateCache::DateCache() : stamp_(0), tz_cache_(CreateTimezoneCache()) {
   ResetDateCache();
 }
 
+int DateCache::GetDaylightSavingsOffsetFromOS(int64_t time_sec) {
+  if (time_sec < 0 || time_sec > kMaxEpochTimeInSec) {
+    double time_ms = static_cast<double>(time_sec * 1000);
+    return static_cast<int>(tz_cache_->DaylightSavingsOffset(time_ms));
+  }
+  return shared_dst_table.Pointer()->OffsetInMs(static_cast<int>(time_sec));
+}
+
+void DateCache::ResetSharedTimezoneData() {
+  shared_dst_table.Pointer()->Clear();
+}
+
 void DateCache::ResetDateCache() {
   static const int kMaxStamp = Smi::kMaxValue;
   if (stamp_->value() >= kMaxStamp) {
@@ -204,11 +204,13 @@ class DateCache {
   Smi* stamp() { return stamp_; }
   void* stamp_address() { return &stamp_; }
 
+  // Clears the daylight savings transitions that are shared by the date
+  // caches of all isolates. Called when the timezone configuration changes.
+  static void ResetSharedTimezoneData();
+
   // These functions are virtual so that we can override them when testing.
-  virtual int GetDaylightSavingsOffsetFromOS(int64_t time_sec) {
-    double time_ms = static_cast<double>(time_sec * 1000);
-    return static_cast<int>(tz_cache_->DaylightSavingsOffset(time_ms));
-  }
+  // The daylight savings offset is looked up in the shared transition table.
+  virtual int GetDaylightSavingsOffsetFromOS(int64_t time_sec);
 
   virtual int GetLocalOffsetFromOS() {
     double offset = tz_cache_->LocalTimeOffset();
@@ -230,9 +230,11 @@ Coverage* Coverage::Collect(Isolate* isolate,
       }
       break;
     }
+    case v8::debug::Coverage::kBlockCountBestEffort:
     case v8::debug::Coverage::kBestEffort: {
       DCHECK(!isolate->factory()->code_coverage_list()->IsArrayList());
-      DCHECK_EQ(v8::debug::Coverage::kBestEffort, collectionMode);
+      DCHECK(collectionMode == v8::debug::Coverage::kBestEffort ||
+             collectionMode == v8::debug::Coverage::kBlockCountBestEffort);
       HeapIterator heap_iterator(isolate->heap());
       while (HeapObject* current_obj = heap_iterator.next()) {
         if (!current_obj->IsFeedbackVector()) continue;
@@ -240,6 +242,7 @@ Coverage* Coverage::Collect(Isolate* isolate,
         SharedFunctionInfo* shared = vector->shared_function_info();
         if (!shared->IsSubjectToDebugging()) continue;
         uint32_t count = static_cast<uint32_t>(vector->invocation_count());
+        if (reset_count) vector->clear_invocation_count();
         counter_map.Add(shared, count);
       }
       break;
@@ -284,6 +287,7 @@ Coverage* Coverage::Collect(Isolate* isolate,
       if (count != 0) {
         switch (collectionMode) {
           case v8::debug::Coverage::kBlockCount:
+          case v8::debug::Coverage::kBlockCountBestEffort:
           case v8::debug::Coverage::kPreciseCount:
             break;
           case v8::debug::Coverage::kPreciseBinary:
@@ -327,6 +331,12 @@ void Coverage::SelectMode(Isolate* isolate, debug::Coverage::Mode mode) {
       if (FLAG_block_coverage) isolate->debug()->RemoveAllCoverageInfos();
       isolate->SetCodeCoverageList(isolate->heap()->undefined_value());
       break;
+    case debug::Coverage::kBlockCountBestEffort:
+      // Optimized code increments block counters too, so there is no need to
+      // deoptimize or to keep feedback vectors alive. Only functions compiled
+      // from now on are instrumented.
+      isolate->SetCodeCoverageList(isolate->heap()->undefined_value());
+      break;
     case debug::Coverage::kBlockCount:
     case debug::Coverage::kPreciseBinary:
     case debug::Coverage::kPreciseCount: {
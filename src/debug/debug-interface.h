@@ -250,6 +250,11 @@ class V8_EXPORT_PRIVATE Coverage {
     // Similar to the precise coverage modes but provides coverage at a
     // lower granularity. Design doc: goo.gl/lA2swZ.
     kBlockCount,
+    // Like kBlockCount, but optimization is not disabled and feedback vectors
+    // may be garbage collected. Optimized code keeps incrementing the block
+    // counters, while function counts are best effort. This is cheap enough
+    // to be enabled for a sample of production runs.
+    kBlockCountBestEffort,
   };
 
   // Forward declarations.
@@ -1270,52 +1270,54 @@ bool Debug::PrepareFunctionForBreakPoints(Handle<SharedFunctionInfo> shared) {
         OptimizingCompileDispatcher::BlockingBehavior::kBlock);
   }
 
-  // The native context has a list of OSR'd optimized code. Clear it.
-  isolate_->ClearOSROptimizedCode();
-
-  // Make sure we abort incremental marking.
-  isolate_->heap()->CollectAllGarbage(Heap::kMakeHeapIterableMask,
-                                      GarbageCollectionReason::kDebugger);
-
   DCHECK(shared->is_compiled());
   bool baseline_exists = shared->HasBaselineCode();
 
-  List<Handle<JSFunction>> functions;
-  {
-    // TODO(yangguo): with bytecode, we still walk the heap to find all
-    // optimized code for the function to deoptimize. We can probably be
-    // smarter here and avoid the heap walk.
-    HeapIterator iterator(isolate_->heap());
-    HeapObject* obj;
-
-    while ((obj = iterator.next()) != nullptr) {
-      if (obj->IsJSFunction()) {
-        JSFunction* function = JSFunction::cast(obj);
-        if (!function->Inlines(*shared)) continue;
-        if (function->has_feedback_vector()) {
-          function->ClearOptimizedCodeSlot("Prepare for breakpoints");
-        }
-        if (function->code()->kind() == Code::OPTIMIZED_FUNCTION) {
-          Deoptimizer::DeoptimizeFunction(function);
-        }
-        if (baseline_exists && function->shared() == *shared) {
-          functions.Add(handle(function));
+  if (baseline_exists) {
+    // The native context has a list of OSR'd optimized code. Clear it.
+    isolate_->ClearOSROptimizedCode();
+
+    // Make sure we abort incremental marking.
+    isolate_->heap()->CollectAllGarbage(Heap::kMakeHeapIterableMask,
+                                        GarbageCollectionReason::kDebugger);
+
+    // Closures running full-codegen code have to be switched to the code
+    // with debug break slots, so walk the heap to find them.
+    List<Handle<JSFunction>> functions;
+    {
+      HeapIterator iterator(isolate_->heap());
+      HeapObject* obj;
+
+      while ((obj = iterator.next()) != nullptr) {
+        if (obj->IsJSFunction()) {
+          JSFunction* function = JSFunction::cast(obj);
+          if (!function->Inlines(*shared)) continue;
+          if (function->has_feedback_vector()) {
+            function->ClearOptimizedCodeSlot("Prepare for breakpoints");
+          }
+          if (function->code()->kind() == Code::OPTIMIZED_FUNCTION) {
+            Deoptimizer::DeoptimizeFunction(function);
+          }
+          if (function->shared() == *shared) {
+            functions.Add(handle(function));
+          }
         }
       }
     }
-  }
 
-  // We do not need to replace code to debug bytecode.
-  DCHECK(baseline_exists || functions.is_empty());
-
-  // We do not need to recompile to debug bytecode.
-  if (baseline_exists && !shared->code()->has_debug_break_slots()) {
-    if (!Compiler::CompileDebugCode(shared)) return false;
-  }
+    if (!shared->code()->has_debug_break_slots()) {
+      if (!Compiler::CompileDebugCode(shared)) return false;
+    }
 
-  for (Handle<JSFunction> const function : functions) {
-    function->ReplaceCode(shared->code());
-    JSFunction::EnsureLiterals(function);
+    for (Handle<JSFunction> const function : functions) {
+      function->ReplaceCode(shared->code());
+      JSFunction::EnsureLiterals(function);
+    }
+  } else {
+    // Interpreted frames pick up the debug copy of the bytecode from the
+    // DebugInfo, so only optimized code containing |shared| has to go. All
+    // other optimized code keeps running.
+    Deoptimizer::DeoptimizeCodeContaining(isolate_, *shared);
   }
 
   // Update PCs on the stack to point to recompiled code.
@@ -1531,6 +1533,11 @@ bool Debug::EnsureBreakInfo(Handle<SharedFunctionInfo> shared) {
   if (!shared->is_compiled() && !Compiler::CompileDebugCode(shared)) {
     return false;
   }
+  // Break locations are found through the source positions, which the debug
+  // copy of the bytecode shares with the original.
+  if (!SharedFunctionInfo::EnsureSourcePositionsAvailable(shared)) {
+    return false;
+  }
 
   // To prepare bytecode for debugging, we already need to have the debug
   // info (containing the debug copy) upfront, but since we do not recompile,
@@ -1026,6 +1026,11 @@ static int TranslatePosition(int original_position,
 
 void TranslateSourcePositionTable(Handle<AbstractCode> code,
                                   Handle<JSArray> position_change_array) {
+  // Positions that are collected lazily are recomputed from the new source.
+  if (code->IsBytecodeArray() &&
+      !code->GetBytecodeArray()->HasSourcePositionTable()) {
+    return;
+  }
   Isolate* isolate = code->GetIsolate();
   Zone zone(isolate->allocator(), ZONE_NAME);
   SourcePositionTableBuilder builder(&zone);
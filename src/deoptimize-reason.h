@@ -83,6 +83,11 @@ enum class DeoptimizeReason : uint8_t {
 #undef DEOPTIMIZE_REASON
 };
 
+#define DEOPTIMIZE_REASON(Name, message) +1
+static const int kDeoptimizeReasonCount =
+    0 DEOPTIMIZE_REASON_LIST(DEOPTIMIZE_REASON);
+#undef DEOPTIMIZE_REASON
+
 std::ostream& operator<<(std::ostream&, DeoptimizeReason);
 
 size_t hash_value(DeoptimizeReason reason);
@@ -48,6 +48,48 @@ DeoptimizerData::~DeoptimizerData() {
   }
 }
 
+int DeoptimizerData::RecordDeoptimizationSite(SharedFunctionInfo* shared,
+                                              int bytecode_offset,
+                                              DeoptimizeReason reason) {
+  DeoptimizationSite site;
+  site.script_id = shared->script()->IsScript()
+                       ? Script::cast(shared->script())->id()
+                       : -1;
+  site.function_literal_id = shared->function_literal_id();
+  site.bytecode_offset = bytecode_offset;
+  site.reason = reason;
+  if (deoptimization_sites_.size() >= kMaxDeoptimizationSites) {
+    deoptimization_sites_.clear();
+  }
+  return ++deoptimization_sites_[site];
+}
+
+void DeoptimizerData::RecordDeoptimizationCost(
+    DeoptimizeReason reason, int frame_count,
+    base::TimeDelta compute_output_frames_time,
+    base::TimeDelta materialization_time) {
+  DeoptimizationCost& cost = deoptimization_costs_[static_cast<int>(reason)];
+  cost.count++;
+  cost.frame_count += frame_count;
+  cost.compute_output_frames_time += compute_output_frames_time;
+  cost.materialization_time += materialization_time;
+}
+
+void DeoptimizerData::PrintDeoptimizationCosts() {
+  PrintF(stdout, "=== Deoptimization cost by reason\n");
+  PrintF(stdout, "%-44s %8s %8s %12s %16s\n", "reason", "count", "frames",
+         "compute(ms)", "materialize(ms)");
+  for (int i = 0; i < kDeoptimizeReasonCount; i++) {
+    const DeoptimizationCost& cost = deoptimization_costs_[i];
+    if (cost.count == 0) continue;
+    PrintF(stdout, "%-44s %8d %8d %12.3f %16.3f\n",
+           DeoptimizeReasonToString(static_cast<DeoptimizeReason>(i)),
+           cost.count, cost.frame_count,
+           cost.compute_output_frames_time.InMillisecondsF(),
+           cost.materialization_time.InMillisecondsF());
+  }
+}
+
 
 Code* Deoptimizer::FindDeoptimizingCode(Address addr) {
   if (function_->IsHeapObject()) {
@@ -365,6 +407,46 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(Context* context) {
 }
 
 
+void Deoptimizer::MarkAllContextIndependentCode(Isolate* isolate) {
+  WeakFixedArray::Iterator it(
+      isolate->heap()->context_independent_code_list());
+  while (Code* code = it.Next<Code>()) {
+    code->set_marked_for_deoptimization(true);
+  }
+}
+
+void Deoptimizer::DeoptimizeMarkedContextIndependentCode(Isolate* isolate) {
+  DisallowHeapAllocation no_allocation;
+  Object* list = isolate->heap()->context_independent_code_list();
+  if (!list->IsWeakFixedArray()) return;
+  WeakFixedArray* codes = WeakFixedArray::cast(list);
+
+  // We need a handle scope only because of the macro assembler,
+  // which is used in code patching in EnsureCodeForDeoptimizationEntry.
+  HandleScope scope(isolate);
+
+  for (int i = 0; i < codes->Length(); i++) {
+    Object* element = codes->Get(i);
+    if (element == WeakFixedArray::Empty()) continue;
+    Code* code = Code::cast(element);
+    if (!code->marked_for_deoptimization()) continue;
+    // Drop the code from the list, so that it is neither patched again nor
+    // reused by other closures.
+    codes->Clear(i);
+    PatchCodeForDeoptimization(isolate, code);
+    isolate->heap()->mark_compact_collector()->InvalidateCode(code);
+  }
+}
+
+bool Deoptimizer::IsContextIndependentCode(Isolate* isolate, Code* code) {
+  WeakFixedArray::Iterator it(
+      isolate->heap()->context_independent_code_list());
+  while (Code* element = it.Next<Code>()) {
+    if (element == code) return true;
+  }
+  return false;
+}
+
 void Deoptimizer::DeoptimizeAll(Isolate* isolate) {
   RuntimeCallTimerScope runtimeTimer(isolate,
                                      &RuntimeCallStats::DeoptimizeCode);
@@ -375,6 +457,9 @@ void Deoptimizer::DeoptimizeAll(Isolate* isolate) {
     PrintF(scope.file(), "[deoptimize all code in all contexts]\n");
   }
   DisallowHeapAllocation no_allocation;
+  // The shared code is marked first, so that the functions of all contexts
+  // referring to it get unlinked.
+  MarkAllContextIndependentCode(isolate);
   // For all contexts, mark all code, then deoptimize.
   Object* context = isolate->heap()->native_contexts_list();
   while (!context->IsUndefined(isolate)) {
@@ -383,6 +468,7 @@ void Deoptimizer::DeoptimizeAll(Isolate* isolate) {
     DeoptimizeMarkedCodeForContext(native_context);
     context = native_context->next_context_link();
   }
+  DeoptimizeMarkedContextIndependentCode(isolate);
 }
 
 
@@ -403,8 +489,56 @@ void Deoptimizer::DeoptimizeMarkedCode(Isolate* isolate) {
     DeoptimizeMarkedCodeForContext(native_context);
     context = native_context->next_context_link();
   }
+  DeoptimizeMarkedContextIndependentCode(isolate);
+}
+
+
+namespace {
+
+bool CodeContains(Code* code, SharedFunctionInfo* shared) {
+  DeoptimizationInputData* data =
+      DeoptimizationInputData::cast(code->deoptimization_data());
+  if (data->length() == 0) return false;
+  bool contains = data->SharedFunctionInfo() == shared;
+  FixedArray* literals = data->LiteralArray();
+  int inlined_count = data->InlinedFunctionCount()->value();
+  for (int i = 0; !contains && i < inlined_count; ++i) {
+    contains = literals->get(i) == shared;
+  }
+  return contains;
 }
 
+}  // namespace
+
+void Deoptimizer::DeoptimizeCodeContaining(Isolate* isolate,
+                                           SharedFunctionInfo* shared) {
+  DisallowHeapAllocation no_allocation;
+  bool found = false;
+  Object* context = isolate->heap()->native_contexts_list();
+  while (!context->IsUndefined(isolate)) {
+    Context* native_context = Context::cast(context);
+    Object* element = native_context->OptimizedCodeListHead();
+    while (!element->IsUndefined(isolate)) {
+      Code* code = Code::cast(element);
+      if (CodeContains(code, shared)) {
+        code->set_marked_for_deoptimization(true);
+        found = true;
+      }
+      element = code->next_code_link();
+    }
+    context = native_context->next_context_link();
+  }
+  WeakFixedArray::Iterator it(
+      isolate->heap()->context_independent_code_list());
+  while (Code* code = it.Next<Code>()) {
+    if (CodeContains(code, shared)) {
+      code->set_marked_for_deoptimization(true);
+      found = true;
+    }
+  }
+  // Only go through with the deoptimization if something was found.
+  if (found) DeoptimizeMarkedCode(isolate);
+}
 
 void Deoptimizer::MarkAllCodeForContext(Context* context) {
   Object* element = context->OptimizedCodeListHead();
@@ -426,10 +560,20 @@ void Deoptimizer::DeoptimizeFunction(JSFunction* function, Code* code) {
   if (code == nullptr) code = function->code();
   if (code->kind() == Code::OPTIMIZED_FUNCTION) {
     // Mark the code for deoptimization and unlink any functions that also
-    // refer to that code. The code cannot be shared across native contexts,
-    // so we only need to search one.
+    // refer to that code. Only native context independent code is shared
+    // across native contexts, otherwise we only need to search one.
     code->set_marked_for_deoptimization(true);
-    DeoptimizeMarkedCodeForContext(function->context()->native_context());
+    if (IsContextIndependentCode(isolate, code)) {
+      Object* context = isolate->heap()->native_contexts_list();
+      while (!context->IsUndefined(isolate)) {
+        Context* native_context = Context::cast(context);
+        DeoptimizeMarkedCodeForContext(native_context);
+        context = native_context->next_context_link();
+      }
+      DeoptimizeMarkedContextIndependentCode(isolate);
+    } else {
+      DeoptimizeMarkedCodeForContext(function->context()->native_context());
+    }
   }
 }
 
@@ -698,8 +842,8 @@ void Deoptimizer::DoComputeOutputFrames() {
     }
   }
 
+  if (trace_scope_ != NULL || FLAG_print_deopt_stats) timer.Start();
   if (trace_scope_ != NULL) {
-    timer.Start();
     PrintF(trace_scope_->file(), "[deoptimizing (DEOPT %s): begin ",
            MessageFor(bailout_type_));
     PrintFunctionName();
@@ -797,9 +941,11 @@ void Deoptimizer::DoComputeOutputFrames() {
     }
   }
 
+  if (timer.IsStarted()) compute_output_frames_time_ = timer.Elapsed();
+
   // Print some helpful diagnostic information.
   if (trace_scope_ != NULL) {
-    double ms = timer.Elapsed().InMillisecondsF();
+    double ms = compute_output_frames_time_.InMillisecondsF();
     int index = output_count_ - 1;  // Index of the topmost frame.
     PrintF(trace_scope_->file(), "[deoptimizing (%s): end ",
            MessageFor(bailout_type_));
@@ -2410,6 +2556,36 @@ int32_t TranslationIterator::Next() {
 }
 
 
+int TranslationBuffer::ShareTranslation(int start) {
+  int length = CurrentIndex() - start;
+  uint32_t hash = static_cast<uint32_t>(length);
+  auto it = contents_.Find(start);
+  for (int i = 0; i < length; i++, ++it) {
+    hash = 31 * hash + *it;
+  }
+  auto range = shared_translations_.equal_range(hash);
+  for (auto entry = range.first; entry != range.second; ++entry) {
+    int other_start = entry->second.first;
+    int other_length = entry->second.second;
+    if (other_length == length && ContentsEqual(start, other_start, length)) {
+      contents_.Rewind(start);
+      return other_start;
+    }
+  }
+  shared_translations_.insert(
+      std::make_pair(hash, std::make_pair(start, length)));
+  return start;
+}
+
+bool TranslationBuffer::ContentsEqual(int start1, int start2, int length) {
+  auto it1 = contents_.Find(start1);
+  auto it2 = contents_.Find(start2);
+  for (int i = 0; i < length; i++, ++it1, ++it2) {
+    if (*it1 != *it2) return false;
+  }
+  return true;
+}
+
 Handle<ByteArray> TranslationBuffer::CreateByteArray(Factory* factory) {
   Handle<ByteArray> result = factory->NewByteArray(CurrentIndex(), TENURED);
   contents_.CopyTo(result->GetDataStartAddress());
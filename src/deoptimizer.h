@@ -5,10 +5,15 @@
 #ifndef V8_DEOPTIMIZER_H_
 #define V8_DEOPTIMIZER_H_
 
+#include <unordered_map>
+
 #include "src/allocation.h"
+#include "src/base/functional.h"
+#include "src/base/platform/time.h"
 #include "src/deoptimize-reason.h"
 #include "src/macro-assembler.h"
 #include "src/source-position.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone-chunk-list.h"
 
 namespace v8 {
@@ -424,10 +429,17 @@ class Deoptimizer : public Malloced {
   Handle<JSFunction> function() const { return Handle<JSFunction>(function_); }
   Handle<Code> compiled_code() const { return Handle<Code>(compiled_code_); }
   BailoutType bailout_type() const { return bailout_type_; }
+  Address from() const { return from_; }
 
   // Number of created JS frames. Not all created frames are necessarily JS.
   int jsframe_count() const { return jsframe_count_; }
 
+  // Time spent in DoComputeOutputFrames, only measured with --trace-deopt or
+  // --print-deopt-stats.
+  base::TimeDelta compute_output_frames_time() const {
+    return compute_output_frames_time_;
+  }
+
   static Deoptimizer* New(JSFunction* function,
                           BailoutType type,
                           unsigned bailout_id,
@@ -463,6 +475,11 @@ class Deoptimizer : public Malloced {
   // refer to that code.
   static void DeoptimizeMarkedCode(Isolate* isolate);
 
+  // Deoptimizes all optimized code that contains |shared|, either as the
+  // function being optimized or as an inlined function.
+  static void DeoptimizeCodeContaining(Isolate* isolate,
+                                       SharedFunctionInfo* shared);
+
   // Visit all the known optimized functions in a given isolate.
   static void VisitAllOptimizedFunctions(
       Isolate* isolate, OptimizedFunctionVisitor* visitor);
@@ -599,6 +616,16 @@ class Deoptimizer : public Malloced {
   // Deoptimizes all code marked in the given context.
   static void DeoptimizeMarkedCodeForContext(Context* native_context);
 
+  // Marks all the native context independent code for deoptimization.
+  static void MarkAllContextIndependentCode(Isolate* isolate);
+
+  // Deoptimizes the marked native context independent code. The functions
+  // referring to it must have been unlinked for all native contexts before.
+  static void DeoptimizeMarkedContextIndependentCode(Isolate* isolate);
+
+  // Returns whether {code} is shared across native contexts.
+  static bool IsContextIndependentCode(Isolate* isolate, Code* code);
+
   // Patch the given code so that it will deoptimize itself.
   static void PatchCodeForDeoptimization(Isolate* isolate, Code* code);
 
@@ -646,6 +673,8 @@ class Deoptimizer : public Malloced {
   // Key for lookup of previously materialized objects
   intptr_t stack_fp_;
 
+  base::TimeDelta compute_output_frames_time_;
+
   TranslatedState translated_state_;
   struct ValueToMaterialize {
     Address output_slot_address_;
@@ -872,13 +901,67 @@ class DeoptimizerData {
   explicit DeoptimizerData(MemoryAllocator* allocator);
   ~DeoptimizerData();
 
+  // Records an eager deoptimization for {reason} at {bytecode_offset} of
+  // {shared} and returns how often that site has deoptimized for {reason}.
+  int RecordDeoptimizationSite(SharedFunctionInfo* shared, int bytecode_offset,
+                               DeoptimizeReason reason);
+
+  // Accumulated cost of the deoptimizations for one reason, collected with
+  // --print-deopt-stats.
+  struct DeoptimizationCost {
+    DeoptimizationCost() : count(0), frame_count(0) {}
+    int count;
+    int frame_count;
+    base::TimeDelta compute_output_frames_time;
+    base::TimeDelta materialization_time;
+  };
+
+  void RecordDeoptimizationCost(DeoptimizeReason reason, int frame_count,
+                                base::TimeDelta compute_output_frames_time,
+                                base::TimeDelta materialization_time);
+  const DeoptimizationCost& deoptimization_cost(DeoptimizeReason reason) const {
+    return deoptimization_costs_[static_cast<int>(reason)];
+  }
+  void PrintDeoptimizationCosts();
+
  private:
+  // A deoptimization site is identified by the function literal in its script
+  // rather than by the SharedFunctionInfo, which may move.
+  struct DeoptimizationSite {
+    int script_id;
+    int function_literal_id;
+    int bytecode_offset;
+    DeoptimizeReason reason;
+
+    bool operator==(const DeoptimizationSite& other) const {
+      return script_id == other.script_id &&
+             function_literal_id == other.function_literal_id &&
+             bytecode_offset == other.bytecode_offset && reason == other.reason;
+    }
+  };
+
+  struct DeoptimizationSiteHash {
+    size_t operator()(const DeoptimizationSite& site) const {
+      return base::hash_combine(site.script_id, site.function_literal_id,
+                                site.bytecode_offset,
+                                static_cast<uint8_t>(site.reason));
+    }
+  };
+
+  // The table is forgotten once it grows beyond this many sites.
+  static const size_t kMaxDeoptimizationSites = 4096;
+
   MemoryAllocator* allocator_;
   int deopt_entry_code_entries_[Deoptimizer::kLastBailoutType + 1];
   MemoryChunk* deopt_entry_code_[Deoptimizer::kLastBailoutType + 1];
 
   Deoptimizer* current_;
 
+  std::unordered_map<DeoptimizationSite, int, DeoptimizationSiteHash>
+      deoptimization_sites_;
+
+  DeoptimizationCost deoptimization_costs_[kDeoptimizeReasonCount];
+
   friend class Deoptimizer;
 
   DISALLOW_COPY_AND_ASSIGN(DeoptimizerData);
@@ -887,15 +970,27 @@ class DeoptimizerData {
 
 class TranslationBuffer BASE_EMBEDDED {
  public:
-  explicit TranslationBuffer(Zone* zone) : contents_(zone) {}
+  explicit TranslationBuffer(Zone* zone)
+      : contents_(zone), shared_translations_(zone) {}
 
   int CurrentIndex() const { return static_cast<int>(contents_.size()); }
   void Add(int32_t value);
 
+  // Called after the translation that starts at {start} has been completed.
+  // If an earlier translation passed to this function has the same contents,
+  // the new one is dropped again and the index of the earlier one is
+  // returned. Otherwise {start} is returned.
+  int ShareTranslation(int start);
+
   Handle<ByteArray> CreateByteArray(Factory* factory);
 
  private:
+  bool ContentsEqual(int start1, int start2, int length);
+
   ZoneChunkList<uint8_t> contents_;
+  // Start and length of the translations that can be shared, keyed by a hash
+  // of their contents.
+  ZoneMultimap<uint32_t, std::pair<int, int>> shared_translations_;
 };
 
 
@@ -1018,6 +1018,21 @@ class ElementsAccessorBase : public ElementsAccessor {
     UNREACHABLE();
   }
 
+  void CopyTypedArrayElements(JSTypedArray* source, JSTypedArray* destination,
+                              size_t source_start, size_t destination_start,
+                              size_t length) final {
+    Subclass::CopyTypedArrayElementsImpl(source, destination, source_start,
+                                         destination_start, length);
+  }
+
+  static void CopyTypedArrayElementsImpl(JSTypedArray* source,
+                                         JSTypedArray* destination,
+                                         size_t source_start,
+                                         size_t destination_start,
+                                         size_t length) {
+    UNREACHABLE();
+  }
+
   Handle<SeededNumberDictionary> Normalize(Handle<JSObject> object) final {
     return Subclass::NormalizeImpl(object, handle(object->elements()));
   }
@@ -3107,6 +3122,13 @@ class TypedElementsAccessor
       return result_array;
     }
 
+    // Arrays on different buffers can be converted in one go.
+    if (array->buffer() != result_array->buffer()) {
+      result_array->GetElementsAccessor()->CopyTypedArrayElements(
+          *array, *result_array, start, 0, end - start);
+      return result_array;
+    }
+
     // If the types of the two typed arrays are different, properly convert
     // elements
     Handle<BackingStore> from(BackingStore::cast(array->elements()), isolate);
@@ -3124,76 +3146,90 @@ class TypedElementsAccessor
              type == FIXED_UINT8_CLAMPED_ARRAY_TYPE);
   }
 
+  // A plain loop over the raw data, which the C++ compiler can vectorize
+  // for most pairs of element types.
   template <typename SourceTraits>
-  static void CopyBetweenBackingStores(FixedTypedArrayBase* source,
-                                       BackingStore* dest, size_t length) {
-    FixedTypedArray<SourceTraits>* source_fta =
-        FixedTypedArray<SourceTraits>::cast(source);
-    for (uint32_t i = 0; i < length; i++) {
-      typename SourceTraits::ElementType elem = source_fta->get_scalar(i);
-      dest->set(i, dest->from(elem));
+  static void CopyBetweenBackingStores(void* source_data, ctype* dest_data,
+                                       size_t length) {
+    typedef typename SourceTraits::ElementType SourceType;
+    SourceType* source = static_cast<SourceType*>(source_data);
+    for (size_t i = 0; i < length; i++) {
+      dest_data[i] = BackingStore::from(source[i]);
     }
   }
 
-  static void CopyElementsHandleFromTypedArray(Handle<JSTypedArray> source,
-                                               Handle<JSTypedArray> destination,
-                                               size_t length) {
-    // The source is a typed array, so we know we don't need to do ToNumber
-    // side-effects, as the source elements will always be a number or
-    // undefined.
+  static void CopyTypedArrayElementsImpl(JSTypedArray* source,
+                                         JSTypedArray* destination,
+                                         size_t source_start,
+                                         size_t destination_start,
+                                         size_t length) {
     DisallowHeapAllocation no_gc;
-
-    Handle<FixedTypedArrayBase> source_elements(
-        FixedTypedArrayBase::cast(source->elements()));
-    Handle<BackingStore> destination_elements(
-        BackingStore::cast(destination->elements()));
-
-    DCHECK_GE(destination->length(), source->length());
-    DCHECK(source->length()->IsSmi());
-    DCHECK_EQ(Smi::FromInt(static_cast<int>(length)), source->length());
+    FixedTypedArrayBase* source_elements =
+        FixedTypedArrayBase::cast(source->elements());
+    BackingStore* destination_elements =
+        BackingStore::cast(destination->elements());
+    DCHECK_LE(source_start + length, source->length_value());
+    DCHECK_LE(destination_start + length, destination->length_value());
+
+    size_t source_element_size = source->element_size();
+    uint8_t* source_data = static_cast<uint8_t*>(source_elements->DataPtr()) +
+                           source_start * source_element_size;
+    ctype* dest_data =
+        static_cast<ctype*>(destination_elements->DataPtr()) +
+        destination_start;
 
     InstanceType source_type = source_elements->map()->instance_type();
     InstanceType destination_type =
         destination_elements->map()->instance_type();
 
-    bool same_type = source_type == destination_type;
-    bool same_size = source->element_size() == destination->element_size();
-    bool both_are_simple = HasSimpleRepresentation(source_type) &&
-                           HasSimpleRepresentation(destination_type);
-
-    // We assume the source and destination don't overlap, even though they
-    // can share the same buffer. This is always true for newly allocated
-    // TypedArrays.
-    uint8_t* source_data = static_cast<uint8_t*>(source_elements->DataPtr());
-    uint8_t* dest_data = static_cast<uint8_t*>(destination_elements->DataPtr());
-    size_t source_byte_length = NumberToSize(source->byte_length());
-    size_t dest_byte_length = NumberToSize(destination->byte_length());
-    CHECK(dest_data + dest_byte_length <= source_data ||
-          source_data + source_byte_length <= dest_data);
-
     // We can simply copy the backing store if the types are the same, or if
     // we are converting e.g. Uint8 <-> Int8, as the binary representation
     // will be the same. This is not the case for floats or clamped Uint8,
     // which have special conversion operations.
-    if (same_type || (same_size && both_are_simple)) {
-      size_t element_size = source->element_size();
-      std::memcpy(dest_data, source_data, length * element_size);
-    } else {
-      // We use scalar accessors below to avoid boxing/unboxing, so there are
-      // no allocations.
-      switch (source->GetElementsKind()) {
-#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)   \
-  case TYPE##_ELEMENTS:                                   \
-    CopyBetweenBackingStores<Type##ArrayTraits>(          \
-        *source_elements, *destination_elements, length); \
+    if (source_type == destination_type ||
+        (source_element_size == sizeof(ctype) &&
+         HasSimpleRepresentation(source_type) &&
+         HasSimpleRepresentation(destination_type))) {
+      std::memmove(dest_data, source_data, length * sizeof(ctype));
+      return;
+    }
+
+    // Converting in place would overwrite source elements before they are
+    // read, so overlapping ranges are converted from a copy of the source.
+    size_t source_byte_length = length * source_element_size;
+    uint8_t* dest_bytes = reinterpret_cast<uint8_t*>(dest_data);
+    std::unique_ptr<uint8_t[]> source_copy;
+    if (source_data < dest_bytes + length * sizeof(ctype) &&
+        dest_bytes < source_data + source_byte_length) {
+      source_copy.reset(new uint8_t[source_byte_length]);
+      std::memcpy(source_copy.get(), source_data, source_byte_length);
+      source_data = source_copy.get();
+    }
+
+    switch (source->GetElementsKind()) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)                     \
+  case TYPE##_ELEMENTS:                                                     \
+    CopyBetweenBackingStores<Type##ArrayTraits>(source_data, dest_data,     \
+                                                length);                    \
     break;
-        TYPED_ARRAYS(TYPED_ARRAY_CASE)
-        default:
-          UNREACHABLE();
-          break;
-      }
-#undef TYPED_ARRAY_CASE
+      TYPED_ARRAYS(TYPED_ARRAY_CASE)
+      default:
+        UNREACHABLE();
+        break;
     }
+#undef TYPED_ARRAY_CASE
+  }
+
+  static void CopyElementsHandleFromTypedArray(Handle<JSTypedArray> source,
+                                               Handle<JSTypedArray> destination,
+                                               size_t length) {
+    // The source is a typed array, so we know we don't need to do ToNumber
+    // side-effects, as the source elements will always be a number or
+    // undefined.
+    DCHECK_GE(destination->length(), source->length());
+    DCHECK(source->length()->IsSmi());
+    DCHECK_EQ(Smi::FromInt(static_cast<int>(length)), source->length());
+    CopyTypedArrayElementsImpl(*source, *destination, 0, 0, length);
   }
 
   static bool HoleyPrototypeLookupRequired(Isolate* isolate,
@@ -190,6 +190,16 @@ class ElementsAccessor {
   virtual Object* CopyElements(Handle<JSReceiver> source,
                                Handle<JSObject> destination, size_t length) = 0;
 
+  // Copy |length| elements of the typed array |source| starting at
+  // |source_start| to the typed array |destination| of this kind starting at
+  // |destination_start|, converting them to the destination type. The two
+  // ranges may overlap.
+  virtual void CopyTypedArrayElements(JSTypedArray* source,
+                                      JSTypedArray* destination,
+                                      size_t source_start,
+                                      size_t destination_start,
+                                      size_t length) = 0;
+
   virtual Handle<FixedArray> CreateListFromArray(Isolate* isolate,
                                                  Handle<JSArray> array) = 0;
 
@@ -438,6 +438,15 @@ void StackGuard::ClearThread(const ExecutionAccess& lock) {
 }
 
 
+void StackGuard::ResetThread(const ExecutionAccess& lock) {
+  thread_local_.set_jslimit(thread_local_.real_jslimit_);
+  thread_local_.set_climit(thread_local_.real_climit_);
+  thread_local_.postpone_interrupts_ = NULL;
+  thread_local_.interrupt_flags_ = 0;
+  isolate_->heap()->SetStackLimits();
+}
+
+
 void StackGuard::InitThread(const ExecutionAccess& lock) {
   if (thread_local_.Initialize(isolate_)) isolate_->heap()->SetStackLimits();
   Isolate::PerIsolateThreadData* per_thread =
@@ -87,6 +87,10 @@ class V8_EXPORT_PRIVATE StackGuard final {
   // Clears the stack guard for this thread so it does not look as if
   // it has been set up.
   void ClearThread(const ExecutionAccess& lock);
+  // Resets the interrupt state of the stack guard, keeping the stack limits.
+  // Equivalent to ClearThread followed by InitThread when the limits were
+  // set up by the current thread and no other thread has used them since.
+  void ResetThread(const ExecutionAccess& lock);
 
 #define INTERRUPT_LIST(V)                       \
   V(DEBUGBREAK, DebugBreak, 0)                  \
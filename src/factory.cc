@@ -732,6 +732,36 @@ MaybeHandle<String> Factory::NewConsString(Handle<String> left,
             NewRawTwoByteString(length).ToHandleChecked(), left, right);
   }
 
+  // Repeated appends produce a list of cons strings. Merge short right parts
+  // into flat chunks so that the list is shorter by a constant factor.
+  if (left->IsConsString() &&
+      right_length <= ConsString::kMaxAppendChunkLength) {
+    Handle<ConsString> left_cons = Handle<ConsString>::cast(left);
+    Handle<String> second(left_cons->second(), isolate());
+    int chunk_length = second->length() + right_length;
+    if (!second->IsConsString() &&
+        chunk_length <= ConsString::kMaxAppendChunkLength) {
+      Handle<String> first(left_cons->first(), isolate());
+      if (first->IsThinString()) {
+        first = handle(Handle<ThinString>::cast(first)->actual(), isolate());
+      }
+      bool chunk_is_one_byte =
+          second->IsOneByteRepresentation() && right_is_one_byte;
+      Handle<String> chunk =
+          chunk_is_one_byte
+              ? ConcatStringContent<uint8_t>(
+                    NewRawOneByteString(chunk_length).ToHandleChecked(),
+                    second, right)
+              : ConcatStringContent<uc16>(
+                    NewRawTwoByteString(chunk_length).ToHandleChecked(),
+                    second, right);
+      if (first->length() == 0) return chunk;
+      return NewConsString(
+          first, chunk, length,
+          first->IsOneByteRepresentation() && chunk_is_one_byte);
+    }
+  }
+
   bool one_byte = (is_one_byte || is_one_byte_data_in_two_byte_string);
   return NewConsString(left, right, length, one_byte);
 }
@@ -2779,6 +2809,11 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureCountIndex,
              Smi::FromInt(capture_count));
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+             Smi::FromInt(FLAG_regexp_tier_up_ticks));
+  store->set(JSRegExp::kIrregexpBacktrackLimitIndex, Smi::kZero);
+  store->set(JSRegExp::kIrregexpPrefilterIndex, Smi::kZero);
+  store->set(JSRegExp::kIrregexpPrefilterIsPrefixIndex, Smi::kZero);
   regexp->set_data(*store);
 }
 
@@ -61,6 +61,8 @@ int FeedbackMetadata::GetSlotSize(FeedbackSlotKind kind) {
     case FeedbackSlotKind::kGeneral:
     case FeedbackSlotKind::kCompareOp:
     case FeedbackSlotKind::kBinaryOp:
+    case FeedbackSlotKind::kInstanceOf:
+    case FeedbackSlotKind::kHasProperty:
     case FeedbackSlotKind::kLiteral:
     case FeedbackSlotKind::kCreateClosure:
     case FeedbackSlotKind::kTypeProfile:
@@ -276,6 +278,19 @@ void FeedbackVector::ComputeCounts(int* with_type_info, int* generic,
         }
         break;
       }
+      case FeedbackSlotKind::kInstanceOf:
+      case FeedbackSlotKind::kHasProperty:
+        // Only the interpreter records feedback in these slots.
+        if (code_is_interpreted) {
+          if (obj->IsWeakCell()) {
+            with++;
+          } else if (obj == megamorphic_sentinel) {
+            gen++;
+            with++;
+          }
+          total++;
+        }
+        break;
       case FeedbackSlotKind::kCreateClosure:
       case FeedbackSlotKind::kGeneral:
       case FeedbackSlotKind::kLiteral:
@@ -154,6 +154,10 @@ const char* FeedbackMetadata::Kind2String(FeedbackSlotKind kind) {
       return "BinaryOp";
     case FeedbackSlotKind::kCompareOp:
       return "CompareOp";
+    case FeedbackSlotKind::kInstanceOf:
+      return "InstanceOf";
+    case FeedbackSlotKind::kHasProperty:
+      return "HasProperty";
     case FeedbackSlotKind::kStoreDataPropertyInLiteral:
       return "StoreDataPropertyInLiteral";
     case FeedbackSlotKind::kCreateClosure:
@@ -245,6 +249,8 @@ Handle<FeedbackVector> FeedbackVector::New(Isolate* isolate,
       case FeedbackSlotKind::kStoreGlobalStrict:
       case FeedbackSlotKind::kStoreKeyedSloppy:
       case FeedbackSlotKind::kStoreKeyedStrict:
+      case FeedbackSlotKind::kInstanceOf:
+      case FeedbackSlotKind::kHasProperty:
       case FeedbackSlotKind::kStoreDataPropertyInLiteral:
       case FeedbackSlotKind::kGeneral:
       case FeedbackSlotKind::kTypeProfile:
@@ -413,6 +419,22 @@ void FeedbackVector::ClearSlots(JSFunction* host_function) {
           // Set(slot, Smi::kZero);
           break;
         }
+        case FeedbackSlotKind::kInstanceOf: {
+          InstanceOfICNexus nexus(this, slot);
+          if (!nexus.IsCleared()) {
+            nexus.Clear();
+            feedback_updated = true;
+          }
+          break;
+        }
+        case FeedbackSlotKind::kHasProperty: {
+          HasPropertyICNexus nexus(this, slot);
+          if (!nexus.IsCleared()) {
+            nexus.Clear();
+            feedback_updated = true;
+          }
+          break;
+        }
         case FeedbackSlotKind::kCreateClosure: {
           case FeedbackSlotKind::kTypeProfile:
             break;
@@ -908,6 +930,52 @@ InlineCacheState CompareICNexus::StateFromFeedback() const {
   return MONOMORPHIC;
 }
 
+void InstanceOfICNexus::ConfigureUninitialized() {
+  SetFeedback(*FeedbackVector::UninitializedSentinel(GetIsolate()),
+              SKIP_WRITE_BARRIER);
+}
+
+InlineCacheState InstanceOfICNexus::StateFromFeedback() const {
+  Isolate* isolate = GetIsolate();
+  Object* feedback = GetFeedback();
+
+  if (feedback == *FeedbackVector::UninitializedSentinel(isolate)) {
+    return UNINITIALIZED;
+  } else if (feedback == *FeedbackVector::MegamorphicSentinel(isolate)) {
+    return MEGAMORPHIC;
+  }
+  return MONOMORPHIC;
+}
+
+MaybeHandle<JSObject> InstanceOfICNexus::GetConstructorFeedback() const {
+  Isolate* isolate = GetIsolate();
+  Object* feedback = GetFeedback();
+  if (feedback->IsWeakCell()) {
+    Object* constructor = WeakCell::cast(feedback)->value();
+    if (constructor->IsJSObject()) {
+      return handle(JSObject::cast(constructor), isolate);
+    }
+  }
+  return MaybeHandle<JSObject>();
+}
+
+void HasPropertyICNexus::ConfigureUninitialized() {
+  SetFeedback(*FeedbackVector::UninitializedSentinel(GetIsolate()),
+              SKIP_WRITE_BARRIER);
+}
+
+InlineCacheState HasPropertyICNexus::StateFromFeedback() const {
+  Isolate* isolate = GetIsolate();
+  Object* feedback = GetFeedback();
+
+  if (feedback == *FeedbackVector::UninitializedSentinel(isolate)) {
+    return UNINITIALIZED;
+  } else if (feedback == *FeedbackVector::MegamorphicSentinel(isolate)) {
+    return MEGAMORPHIC;
+  }
+  return MONOMORPHIC;
+}
+
 BinaryOperationHint BinaryOpICNexus::GetBinaryOperationFeedback() const {
   int feedback = Smi::cast(GetFeedback())->value();
   return BinaryOperationHintFromFeedback(feedback);
@@ -37,6 +37,8 @@ enum class FeedbackSlotKind {
   kStoreKeyedStrict,
   kBinaryOp,
   kCompareOp,
+  kInstanceOf,
+  kHasProperty,
   kStoreDataPropertyInLiteral,
   kTypeProfile,
   kCreateClosure,
@@ -162,6 +164,14 @@ class FeedbackVectorSpecBase {
     return AddSlot(FeedbackSlotKind::kCompareOp);
   }
 
+  FeedbackSlot AddInstanceOfSlot() {
+    return AddSlot(FeedbackSlotKind::kInstanceOf);
+  }
+
+  FeedbackSlot AddHasPropertySlot() {
+    return AddSlot(FeedbackSlotKind::kHasProperty);
+  }
+
   FeedbackSlot AddGeneralSlot() { return AddSlot(FeedbackSlotKind::kGeneral); }
 
   FeedbackSlot AddLiteralSlot() { return AddSlot(FeedbackSlotKind::kLiteral); }
@@ -737,6 +747,65 @@ class CompareICNexus final : public FeedbackNexus {
   }
 };
 
+// The feedback for instanceof is the constructor (right hand side) seen by
+// the interpreter, held in a WeakCell, or the megamorphic sentinel once more
+// than one constructor was seen.
+class InstanceOfICNexus final : public FeedbackNexus {
+ public:
+  InstanceOfICNexus(Handle<FeedbackVector> vector, FeedbackSlot slot)
+      : FeedbackNexus(vector, slot) {
+    DCHECK_EQ(FeedbackSlotKind::kInstanceOf, vector->GetKind(slot));
+  }
+  InstanceOfICNexus(FeedbackVector* vector, FeedbackSlot slot)
+      : FeedbackNexus(vector, slot) {
+    DCHECK_EQ(FeedbackSlotKind::kInstanceOf, vector->GetKind(slot));
+  }
+
+  void ConfigureUninitialized() final;
+
+  InlineCacheState StateFromFeedback() const final;
+  MaybeHandle<JSObject> GetConstructorFeedback() const;
+
+  int ExtractMaps(MapHandles* maps) const final {
+    // InstanceOfICs don't record map feedback.
+    return 0;
+  }
+  MaybeHandle<Object> FindHandlerForMap(Handle<Map> map) const final {
+    return MaybeHandle<Code>();
+  }
+  bool FindHandlers(List<Handle<Object>>* code_list,
+                    int length = -1) const final {
+    return length == 0;
+  }
+};
+
+// The feedback for the in operator is the map of the receiver (right hand
+// side) seen by the interpreter, held in a WeakCell, or the megamorphic
+// sentinel once more than one receiver map was seen.
+class HasPropertyICNexus final : public FeedbackNexus {
+ public:
+  HasPropertyICNexus(Handle<FeedbackVector> vector, FeedbackSlot slot)
+      : FeedbackNexus(vector, slot) {
+    DCHECK_EQ(FeedbackSlotKind::kHasProperty, vector->GetKind(slot));
+  }
+  HasPropertyICNexus(FeedbackVector* vector, FeedbackSlot slot)
+      : FeedbackNexus(vector, slot) {
+    DCHECK_EQ(FeedbackSlotKind::kHasProperty, vector->GetKind(slot));
+  }
+
+  void ConfigureUninitialized() final;
+
+  InlineCacheState StateFromFeedback() const final;
+
+  MaybeHandle<Object> FindHandlerForMap(Handle<Map> map) const final {
+    return MaybeHandle<Code>();
+  }
+  bool FindHandlers(List<Handle<Object>>* code_list,
+                    int length = -1) const final {
+    return length == 0;
+  }
+};
+
 class StoreDataPropertyInLiteralICNexus : public FeedbackNexus {
  public:
   StoreDataPropertyInLiteralICNexus(Handle<FeedbackVector> vector,
@@ -194,11 +194,13 @@ DEFINE_IMPLICATION(es_staging, harmony)
   V(harmony_function_sent, "harmony function.sent")                   \
   V(harmony_tailcalls, "harmony tail calls")                          \
   V(harmony_sharedarraybuffer, "harmony sharedarraybuffer")           \
+  V(harmony_atomics_waitasync, "harmony Atomics.waitAsync")           \
   V(harmony_do_expressions, "harmony do-expressions")                 \
   V(harmony_class_fields, "harmony public fields in class literals")  \
   V(harmony_async_iteration, "harmony async iteration")               \
   V(harmony_dynamic_import, "harmony dynamic import")                 \
-  V(harmony_promise_finally, "harmony Promise.prototype.finally")
+  V(harmony_promise_finally, "harmony Promise.prototype.finally")     \
+  V(harmony_await_optimization, "harmony await taking 1 tick")
 
 // Features that are complete (but still behind --harmony/es-staging flag).
 #define HARMONY_STAGED(V)                                               \
@@ -314,12 +316,20 @@ DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
+DEFINE_BOOL(ignition_deduplicate_heap_numbers, true,
+            "share constant pool entries between equal heap numbers")
 DEFINE_BOOL(ignition_string_concat, false,
             "translate string add chains into string concatenations")
+DEFINE_BOOL(enable_lazy_source_positions, false,
+            "skip generating source positions during initial compile but "
+            "regenerate when actually required")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_STRING(print_bytecode_filter, "*",
               "filter for selecting which functions to print bytecode")
+DEFINE_BOOL(trace_bytecode_size, false,
+            "trace the bytecode and constant pool size of each function "
+            "compiled by ignition interpreter")
 #ifdef V8_TRACE_IGNITION
 DEFINE_BOOL(trace_ignition, false,
             "trace the bytecodes executed by the ignition interpreter")
@@ -392,6 +402,8 @@ DEFINE_INT(deopt_every_n_times, 0,
 DEFINE_INT(deopt_every_n_garbage_collections, 0,
            "deoptimize every n garbage collections")
 DEFINE_BOOL(print_deopt_stress, false, "print number of possible deopt points")
+DEFINE_BOOL(print_deopt_stats, false,
+            "print the number and cost of deoptimizations by reason")
 DEFINE_BOOL(trap_on_deopt, false, "put a break point before deoptimizing")
 DEFINE_BOOL(trap_on_stub_deopt, false,
             "put a break point before deoptimizing a stub")
@@ -435,6 +447,8 @@ DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
             "block queued jobs until released")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile for on-stack replacement on a separate thread")
 
 DEFINE_BOOL(omit_map_checks_for_leaf_maps, true,
             "do not emit check maps for constant values that have a leaf map, "
@@ -445,6 +459,9 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_INT(turbo_fast_regalloc_threshold, 50000,
+           "use the fast register allocation mode for functions with more "
+           "instructions than this (0 = never)")
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
 DEFINE_BOOL(trace_turbo_graph, false, "trace generated TurboFan graphs")
@@ -481,8 +498,14 @@ DEFINE_BOOL(turbo_stats_nvp, false,
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(function_context_specialization, false,
             "enable function context specialization in TurboFan")
+DEFINE_BOOL(turbo_native_context_independent, false,
+            "generate TurboFan code that doesn't embed native context "
+            "constants and share it across native contexts")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_BOOL(turbo_inlining_budget_by_frequency, false,
+            "give cold call sites only a share of the TurboFan inlining "
+            "budget proportional to their call frequency")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(turbo_load_elimination, true, "enable load elimination in TurboFan")
@@ -496,11 +519,17 @@ DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
+DEFINE_BOOL(turbo_loop_bounds_check_elimination, true,
+            "Turbofan elimination of bounds checks on loop induction variables")
+DEFINE_INT(turbo_loop_stack_check_max_iterations, 1000,
+           "max iterations of loops whose stack check Turbofan removes")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_BOOL(wasm_instruction_scheduling, true,
+            "enable instruction scheduling in TurboFan for WebAssembly")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_BOOL(turbo_store_elimination, true,
@@ -544,6 +573,8 @@ DEFINE_BOOL(wasm_break_on_decoder_error, false,
             "debug break when wasm decoder encounters an error")
 
 DEFINE_BOOL(validate_asm, false, "validate asm.js modules before compiling")
+DEFINE_BOOL(concurrent_asm_translation, true,
+            "translate eagerly compiled asm.js modules on background threads")
 DEFINE_BOOL(suppress_asm_messages, false,
             "don't emit asm.js related messages (for golden file testing)")
 DEFINE_BOOL(trace_asm_time, false, "log asm.js timing info to the console")
@@ -573,16 +604,18 @@ DEFINE_BOOL(wasm_no_bounds_checks, false,
 DEFINE_BOOL(wasm_no_stack_checks, false,
             "disable stack checks (performance testing only)")
 
-DEFINE_BOOL(wasm_trap_handler, false,
+DEFINE_BOOL(wasm_trap_handler, true,
             "use signal handlers to catch out of bounds memory access in wasm"
-            " (experimental, currently Linux x86_64 only)")
+            " (currently Linux x86_64 only, needs the embedder to enable it)")
 DEFINE_BOOL(wasm_guard_pages, false,
             "add guard pages to the end of WebWassembly memory"
-            " (experimental, no effect on 32-bit)")
-DEFINE_IMPLICATION(wasm_trap_handler, wasm_guard_pages)
+            " (implied by an enabled trap handler, no effect on 32-bit)")
 DEFINE_BOOL(wasm_code_fuzzer_gen_test, false,
             "Generate a test case when running the wasm-code fuzzer")
 DEFINE_BOOL(print_wasm_code, false, "Print WebAssembly code")
+DEFINE_BOOL(wasm_share_code, false,
+            "share the code of wasm functions that do not depend on the "
+            "instance between instances of the same module")
 DEFINE_BOOL(wasm_interpret_all, false,
             "Execute all wasm code in the wasm interpreter")
 DEFINE_BOOL(asm_wasm_lazy_compilation, false,
@@ -590,20 +623,43 @@ DEFINE_BOOL(asm_wasm_lazy_compilation, false,
 DEFINE_IMPLICATION(validate_asm, asm_wasm_lazy_compilation)
 DEFINE_BOOL(wasm_lazy_compilation, false,
             "enable lazy compilation for all wasm modules")
+DEFINE_INT(wasm_lazy_prefetch_count, 8,
+           "maximum number of likely callees compiled in the background when "
+           "a wasm function gets compiled lazily")
+DEFINE_BOOL(wasm_baseline, false,
+            "compile wasm functions on their first call with a fast TurboFan "
+            "configuration that skips optimizations, for faster startup")
+DEFINE_IMPLICATION(wasm_baseline, wasm_lazy_compilation)
 // wasm-interpret-all resets {asm-,}wasm-lazy-compilation.
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, asm_wasm_lazy_compilation)
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_compilation)
+DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_share_code)
 
 // Profiler flags.
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
 // 0x1800 fits in the immediate field of an ARM instruction.
 DEFINE_INT(interrupt_budget, 0x1800,
            "execution budget before interrupt is triggered")
+DEFINE_BOOL(lazy_feedback_allocation, false,
+            "allocate the feedback vectors of interpreted functions only "
+            "after they used up their first interrupt budget")
+DEFINE_INT(budget_for_feedback_vector_allocation, 0x200,
+           "execution budget before the feedback vector of an interpreted "
+           "function is allocated")
 DEFINE_INT(type_info_threshold, 25,
            "percentage of ICs that must have type info to allow optimization")
 DEFINE_INT(generic_ic_threshold, 30,
            "max percentage of megamorphic/generic ICs to allow optimization")
 DEFINE_INT(self_opt_count, 130, "call count before self-optimization")
+DEFINE_BOOL(tierup_cost_model, false,
+            "optimize interpreted functions once the sampled time spent in "
+            "them outweighs their expected compile cost")
+DEFINE_INT(tierup_expected_speedup, 4,
+           "expected speedup of optimized over interpreted code, used by "
+           "--tierup-cost-model")
+DEFINE_INT(tierup_compile_cost_per_byte, 32,
+           "expected compile cost per byte of bytecode in units of the "
+           "interrupt budget, used by --tierup-cost-model")
 
 DEFINE_BOOL(trace_opt_verbose, false, "extra verbose compilation tracing")
 DEFINE_IMPLICATION(trace_opt_verbose, trace_opt)
@@ -619,10 +675,31 @@ DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
 DEFINE_BOOL(experimental_new_space_growth_heuristic, false,
             "Grow the new space based on the percentage of survivors instead "
             "of their absolute value.")
+DEFINE_INT(scavenge_target_interval_ms, 0,
+           "size the new space so that scavenges happen about every this many "
+           "milliseconds at the current allocation rate (0 disables)")
+DEFINE_FLOAT(scavenge_target_pause_ms, 1.0,
+             "upper bound for the estimated scavenge pause when sizing the "
+             "new space with --scavenge-target-interval-ms")
 DEFINE_INT(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_INT(initial_old_space_size, 0, "initial old space size (in Mbytes)")
+DEFINE_BOOL(pool_paged_space_pages, true,
+            "keep released old and map space pages uncommitted for reuse "
+            "instead of unmapping them")
+DEFINE_INT(max_pooled_pages, 128,
+           "max number of uncommitted pages kept for reuse by all spaces")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back non-executable heap pages with "
+            "transparent huge pages (Linux only)")
+DEFINE_BOOL(numa_aware_heap, false,
+            "place heap pages on the NUMA node the isolate was set up on "
+            "(Linux only)")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
 DEFINE_INT(gc_interval, -1, "garbage collect after <n> allocations")
+DEFINE_INT(number_string_cache_size, 0,
+           "number of entries the number-string cache grows to once it is "
+           "full, rounded up to a power of two (0 means based on the max "
+           "semi-space size)")
 DEFINE_INT(retain_maps_for_n_gc, 2,
            "keeps maps alive for <n> old space garbage collections")
 DEFINE_BOOL(trace_gc, false,
@@ -632,6 +709,17 @@ DEFINE_BOOL(trace_gc_nvp, false,
             "after each garbage collection")
 DEFINE_BOOL(trace_gc_ignore_scavenger, false,
             "do not print trace line after scavenger collection")
+DEFINE_BOOL(trace_gc_parallel_jobs, false,
+            "print load balancing statistics of parallel jobs after each "
+            "garbage collection")
+DEFINE_BOOL(string_deduplication, false,
+            "turn equal non-internalized strings in old space into "
+            "ThinStrings of one canonical copy during full GCs")
+DEFINE_BOOL(trace_string_deduplication, false,
+            "print statistics of string deduplication after each full GC")
+DEFINE_BOOL(trace_gc_statistics_json, false,
+            "print pause time percentiles and accumulated phase times of "
+            "all garbage collections as JSON when the heap is torn down")
 DEFINE_BOOL(trace_idle_notification, false,
             "print one trace line following each idle notification")
 DEFINE_BOOL(trace_idle_notification_verbose, false,
@@ -649,6 +737,9 @@ DEFINE_BOOL(trace_mutator_utilization, false,
 DEFINE_BOOL(flush_regexp_code, true,
             "flush regexp code that we expect not to use again")
 DEFINE_BOOL(age_code, true, "track un-executed functions to age code")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush the bytecode of functions that were not executed during "
+            "several full garbage collections")
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
@@ -660,6 +751,9 @@ DEFINE_BOOL(incremental_marking_wrappers, true,
 DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
             "use concurrent marking")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
+DEFINE_BOOL(parallel_marking_finalization, true,
+            "use the concurrent marking tasks to finish incremental marking "
+            "in the atomic pause")
 DEFINE_BOOL(minor_mc_parallel_marking, true,
             "use parallel marking for the young generation")
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
@@ -670,13 +764,30 @@ DEFINE_INT(min_progress_during_incremental_marking_finalization, 32,
 DEFINE_INT(max_incremental_marking_finalization_rounds, 3,
            "at most try this many times to finalize incremental marking")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_INT(minor_mc_survival_rate_threshold, 0,
+           "with --minor-mc, scavenge instead while the average survival rate "
+           "of the young generation is below this percentage (0 means always "
+           "use minor mark compact)")
 DEFINE_BOOL(black_allocation, true, "use black allocation")
 DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_array_buffer_freeing, true,
+            "free backing stores of dead array buffers on a background thread")
+DEFINE_BOOL(concurrent_phantom_callbacks, true,
+            "invoke thread-safe second pass weak callbacks on a background "
+            "thread")
+DEFINE_INT(phantom_callbacks_time_budget, 0,
+           "time in ms a task may spend on second pass weak callbacks before "
+           "deferring the rest to another task (0 means unlimited)")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(parallel_weak_clearing, true,
+            "clear the string table and weak collections in parallel during "
+            "mark-compact")
+DEFINE_BOOL(parallel_scavenge, false, "use parallel scavenging")
+DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
 DEFINE_BOOL(trace_incremental_marking, false,
             "trace progress of the incremental marking")
 DEFINE_BOOL(track_gc_object_stats, false,
@@ -710,6 +821,10 @@ DEFINE_BOOL(never_compact, false,
 // records slots to evacuation candidates.
 DEFINE_IMPLICATION(concurrent_marking, never_compact)
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_FLOAT(compaction_pause_target_ms, 0,
+             "select evacuation candidates by their estimated evacuation time "
+             "so that compaction of old and code space fits into this many "
+             "milliseconds (0 means fixed limits)")
 DEFINE_BOOL(cleanup_code_caches_at_gc, true,
             "Flush code caches in maps during mark compact cycle.")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -769,6 +884,9 @@ DEFINE_BOOL(enable_regexp_unaligned_accesses, true,
 
 // api.cc
 DEFINE_BOOL(script_streaming, true, "enable parsing on background")
+DEFINE_BOOL(script_streaming_compile, false,
+            "also generate bytecode for streamed scripts on background")
+DEFINE_IMPLICATION(script_streaming_compile, script_streaming)
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -816,6 +934,9 @@ DEFINE_BOOL(trace_stub_failures, false,
             "trace deoptimization of generated code stubs")
 
 DEFINE_BOOL(serialize_toplevel, true, "enable caching of toplevel scripts")
+DEFINE_STRING(code_cache_dir, nullptr,
+              "directory for a code cache of toplevel scripts that is shared "
+              "between processes")
 DEFINE_BOOL(serialize_eager, false, "compile eagerly when caching scripts")
 DEFINE_BOOL(serialize_age_code, false, "pre age code in the code cache")
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
@@ -828,9 +949,18 @@ DEFINE_BOOL(external_reference_stats, false,
 DEFINE_INT(max_deopt_count, 10,
            "maximum number of deoptimizations before giving up optimization of "
            "a function.")
+DEFINE_INT(deopt_site_generalization_threshold, 2,
+           "number of eager deoptimizations for the same reason at a bytecode "
+           "after which its feedback is generalized (0 to disable)")
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(eval_cache_generations, 1,
+           "number of garbage collections an unused entry survives in the "
+           "cache for eval and new Function (1 ages entries with their code)")
+DEFINE_INT(eval_cache_max_entries, 4096,
+           "maximum number of entries in the youngest eval cache generation "
+           "before it is aged early (0 for no limit)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -838,6 +968,9 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_BOOL(compiler_dispatcher_eager_inner, false,
             "enable background compilation of eager inner functions")
+DEFINE_BOOL(compiler_dispatcher_batch_publish, false,
+            "finish jobs after background work in batches from a foreground "
+            "task instead of waiting for idle time")
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
@@ -914,10 +1047,26 @@ DEFINE_BOOL(trace_ic, false,
 DEFINE_IMPLICATION(trace_ic, log_code)
 DEFINE_INT(ic_stats, 0, "inline cache state transitions statistics")
 DEFINE_VALUE_IMPLICATION(trace_ic, ic_stats, 1)
+DEFINE_BOOL(ic_transition_stats, false,
+            "count polymorphic and megamorphic inline cache transitions per "
+            "feedback slot and script")
 DEFINE_BOOL_READONLY(track_constant_fields, false,
                      "enable constant field tracking")
 DEFINE_BOOL_READONLY(modify_map_inplace, false, "enable in-place map updates")
 
+// stub-cache.cc
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the initial number of primary stub cache entries")
+DEFINE_INT(stub_cache_secondary_table_bits, 9,
+           "log2 of the initial number of secondary stub cache entries")
+DEFINE_BOOL(adaptive_stub_cache, false,
+            "grow the stub caches at GC when they had many collisions")
+DEFINE_INT(stub_cache_max_table_bits, 14,
+           "log2 of the maximum number of entries per stub cache table")
+DEFINE_BOOL(stub_cache_mix_map_bits, false,
+            "fold the upper half of the map address into the stub cache hash")
+DEFINE_BOOL(trace_stub_cache, false, "trace stub cache resizing")
+
 // macro-assembler-ia32.cc
 DEFINE_BOOL(native_code_counters, false,
             "generate extra code for manipulating stats counters")
@@ -935,6 +1084,9 @@ DEFINE_BOOL(trace_maps, false, "trace map creation")
 
 // preparser.cc
 DEFINE_BOOL(use_parse_tasks, false, "use parse tasks")
+DEFINE_IMPLICATION(use_parse_tasks, compiler_dispatcher)
+DEFINE_INT(parse_task_min_function_size, 1024,
+           "minimum size of eager functions parsed in parse tasks")
 DEFINE_BOOL(trace_parse_tasks, false, "trace parse task creation")
 
 // parser.cc
@@ -1004,15 +1156,43 @@ DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
 DEFINE_INT(runtime_stats, 0,
            "internal usage only for controlling runtime statistics")
 DEFINE_VALUE_IMPLICATION(runtime_call_stats, runtime_stats, 1)
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "estimate runtime call times by periodically sampling the current "
+            "counter instead of timing every call")
+DEFINE_INT(runtime_call_stats_sampling_interval, 1000,
+           "runtime call stats sampling interval in microseconds")
+// Same value as TracingCategoryObserver::ENABLED_BY_SAMPLING.
+DEFINE_VALUE_IMPLICATION(runtime_call_stats_sampling, runtime_stats, 4)
 
 // snapshot-common.cc
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(lazy_deserialization, false,
+            "Deserialize builtins that are only reachable through JS functions "
+            "on their first call.")
+DEFINE_BOOL(snapshot_compression, false,
+            "Compress the snapshot blobs this process creates.")
 
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_BOOL(regexp_tier_up, false,
+            "run new regexps in the bytecode interpreter and compile them to "
+            "native code once they are used often")
+DEFINE_INT(regexp_tier_up_ticks, 10,
+           "number of interpreted executions before a regexp is compiled to "
+           "native code")
+DEFINE_INT(regexp_tier_up_subject_length, 1024,
+           "subject length from which a regexp is compiled to native code "
+           "right away")
+DEFINE_BOOL(regexp_prefilter, true,
+            "search for literals that every match of a regexp contains before "
+            "running the matcher")
+DEFINE_INT(regexp_backtrack_limit, 0,
+           "number of backtracks after which a regexp is matched by the "
+           "linear-time engine instead, if it supports the pattern (0 means "
+           "no limit)")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -1175,6 +1355,9 @@ DEFINE_BOOL(prof_browser_mode, true,
             "Used with --prof, turns on browser-compatible mode for profiling.")
 DEFINE_STRING(logfile, "v8.log", "Specify the name of the log file.")
 DEFINE_BOOL(logfile_per_isolate, true, "Separate log files for each isolate.")
+DEFINE_BOOL(log_async, false,
+            "Write the log file from a background thread. Log events are "
+            "queued in a ring buffer instead of being flushed one by one.")
 DEFINE_BOOL(ll_prof, false, "Enable low-level linux profiler.")
 DEFINE_BOOL(perf_basic_prof, false,
             "Enable perf linux profiler (basic support).")
@@ -1188,6 +1371,10 @@ DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 DEFINE_BOOL(perf_prof_unwinding_info, false,
             "Enable unwinding info for perf linux profiler (experimental).")
 DEFINE_IMPLICATION(perf_prof, perf_prof_unwinding_info)
+DEFINE_BOOL(interpreted_frames_native_stack, false,
+            "Give every interpreted function a copy of the interpreter entry "
+            "trampoline, so that external profilers can attribute ticks in "
+            "interpreted frames to JavaScript functions.")
 DEFINE_STRING(gc_fake_mmap, "/tmp/__v8_gc__",
               "Specify the name of the file for fake gc mmap used in ll_prof")
 DEFINE_BOOL(log_internal_timer_events, false, "Time internal events.")
@@ -1252,6 +1439,8 @@ DEFINE_BOOL(print_unopt_code, false,
 DEFINE_BOOL(print_code_verbose, false, "print more information for code")
 DEFINE_BOOL(print_builtin_code, false, "print generated code for builtins")
 DEFINE_BOOL(print_builtin_size, false, "print code size for builtins")
+DEFINE_BOOL(print_embedded_builtin_candidates, false,
+            "print the builtins that could be shared by all isolates")
 
 #ifdef ENABLE_DISASSEMBLER
 DEFINE_BOOL(sodium, false,
@@ -1300,6 +1489,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, concurrent_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded, minor_mc_parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_pointer_update)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_store_buffer)
 DEFINE_NEG_IMPLICATION(single_threaded, compiler_dispatcher)
 
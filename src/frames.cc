@@ -193,12 +193,23 @@ bool IsInterpreterFramePc(Isolate* isolate, Address pc) {
   Code* interpreter_bytecode_dispatch =
       isolate->builtins()->builtin(Builtins::kInterpreterEnterBytecodeDispatch);
 
-  return (pc >= interpreter_entry_trampoline->instruction_start() &&
-          pc < interpreter_entry_trampoline->instruction_end()) ||
-         (pc >= interpreter_bytecode_advance->instruction_start() &&
-          pc < interpreter_bytecode_advance->instruction_end()) ||
-         (pc >= interpreter_bytecode_dispatch->instruction_start() &&
-          pc < interpreter_bytecode_dispatch->instruction_end());
+  if ((pc >= interpreter_entry_trampoline->instruction_start() &&
+       pc < interpreter_entry_trampoline->instruction_end()) ||
+      (pc >= interpreter_bytecode_advance->instruction_start() &&
+       pc < interpreter_bytecode_advance->instruction_end()) ||
+      (pc >= interpreter_bytecode_dispatch->instruction_start() &&
+       pc < interpreter_bytecode_dispatch->instruction_end())) {
+    return true;
+  }
+  // Interpreted functions may run in a copy of the trampoline of their own.
+  if (FLAG_interpreted_frames_native_stack &&
+      isolate->heap()->code_space()->ContainsSlow(pc)) {
+    Code* code =
+        isolate->inner_pointer_to_code_cache()->GcSafeFindCodeForInnerPointer(
+            pc);
+    return code->is_interpreter_trampoline_builtin();
+  }
+  return false;
 }
 
 DISABLE_ASAN Address ReadMemoryAt(Address address) {
@@ -1181,6 +1192,13 @@ bool FrameSummary::JavaScriptFrameSummary::is_subject_to_debugging() const {
   return function()->shared()->IsSubjectToDebugging();
 }
 
+void FrameSummary::JavaScriptFrameSummary::EnsureSourcePositionsAvailable() {
+  if (abstract_code()->IsBytecodeArray()) {
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(
+        handle(function()->shared(), isolate()));
+  }
+}
+
 int FrameSummary::JavaScriptFrameSummary::SourcePosition() const {
   return abstract_code()->SourcePosition(code_offset());
 }
@@ -1321,6 +1339,10 @@ FrameSummary FrameSummary::Get(const StandardFrame* frame, int index) {
   return frames[index];
 }
 
+void FrameSummary::EnsureSourcePositionsAvailable() {
+  if (IsJavaScript()) java_script_summary_.EnsureSourcePositionsAvailable();
+}
+
 #define FRAME_SUMMARY_DISPATCH(ret, name)        \
   ret FrameSummary::name() const {               \
     switch (base_.kind()) {                      \
@@ -852,6 +852,7 @@ class FrameSummary BASE_EMBEDDED {
     int code_offset() const { return code_offset_; }
     bool is_constructor() const { return is_constructor_; }
     bool is_subject_to_debugging() const;
+    void EnsureSourcePositionsAvailable();
     int SourcePosition() const;
     int SourceStatementPosition() const;
     Handle<Object> script() const;
@@ -930,6 +931,10 @@ class FrameSummary BASE_EMBEDDED {
   static FrameSummary GetSingle(const StandardFrame* frame);
   static FrameSummary Get(const StandardFrame* frame, int index);
 
+  // Collects source positions that were left out at compile time. This may
+  // allocate, so it has to be called before the position is queried.
+  void EnsureSourcePositionsAvailable();
+
   // Dispatched accessors.
   Handle<Object> receiver() const;
   int code_offset() const;
@@ -6,24 +6,29 @@
 
 #include <limits>
 
+#include "include/v8-platform.h"
+#include "src/api.h"
 #include "src/base/macros.h"
 #include "src/base/platform/time.h"
+#include "src/cancelable-task.h"
 #include "src/conversions.h"
+#include "src/execution.h"
+#include "src/global-handles.h"
 #include "src/handles-inl.h"
 #include "src/isolate.h"
 #include "src/list-inl.h"
 #include "src/objects-inl.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
 
-base::LazyMutex FutexEmulation::mutex_ = LAZY_MUTEX_INITIALIZER;
-base::LazyInstance<FutexWaitList>::type FutexEmulation::wait_list_ =
+base::LazyInstance<FutexWaitTable>::type FutexEmulation::wait_table_ =
     LAZY_INSTANCE_INITIALIZER;
 
 
 void FutexWaitListNode::NotifyWake() {
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
+  // Lock the mutex of the wait list before notifying. We know that the mutex
   // will have been unlocked if we are currently waiting on the condition
   // variable.
   //
@@ -31,10 +36,17 @@ void FutexWaitListNode::NotifyWake() {
   // interrupts, or if FutexEmulation::Wait was just called and the mutex
   // hasn't been locked yet. In either of those cases, we set the interrupted
   // flag to true, which will be tested after the mutex is re-locked.
-  base::LockGuard<base::Mutex> lock_guard(FutexEmulation::mutex_.Pointer());
-  if (waiting_) {
-    cond_.NotifyOne();
-    interrupted_ = true;
+  while (true) {
+    FutexWaitList* wait_list = wait_list_.Value();
+    if (wait_list == nullptr) return;
+    base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+    // The node may have moved on to wait in another list in the meantime.
+    if (wait_list_.Value() != wait_list) continue;
+    if (waiting_) {
+      cond_.NotifyOne();
+      interrupted_ = true;
+    }
+    return;
   }
 }
 
@@ -73,6 +85,61 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 }
 
 
+FutexWaitList* FutexWaitTable::GetWaitList(void* backing_store, size_t addr) {
+  void* wait_addr = static_cast<int8_t*>(backing_store) + addr;
+  return &wait_lists_[ComputePointerHash(wait_addr) % kNumberOfWaitLists];
+}
+
+
+// Resolves the promise of an asynchronous waiter that has been woken. Owns
+// the node, which is no longer in any wait list.
+class AsyncWaiterResolveTask : public CancelableTask {
+ public:
+  explicit AsyncWaiterResolveTask(FutexWaitListNode* node)
+      : CancelableTask(node->async_isolate_), node_(node) {}
+  ~AsyncWaiterResolveTask() override { delete node_; }
+
+  void RunInternal() override {
+    FutexEmulation::ResolveAsyncWaiter(node_, false);
+  }
+
+ private:
+  FutexWaitListNode* node_;
+
+  DISALLOW_COPY_AND_ASSIGN(AsyncWaiterResolveTask);
+};
+
+
+// Resolves the promise of an asynchronous waiter with "timed-out" if it is
+// still waiting. The node is owned by somebody else until it is taken off
+// its wait list here.
+class AsyncWaiterTimeoutTask : public CancelableTask {
+ public:
+  explicit AsyncWaiterTimeoutTask(FutexWaitListNode* node)
+      : CancelableTask(node->async_isolate_), node_(node) {}
+
+  void RunInternal() override {
+    FutexWaitList* wait_list = node_->wait_list_.Value();
+    if (wait_list == nullptr) return;
+    {
+      base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+      // The node has been woken, the resolve task takes care of it.
+      if (!node_->waiting_) return;
+      wait_list->RemoveNode(node_);
+      node_->waiting_ = false;
+      node_->wait_list_.SetValue(nullptr);
+    }
+    FutexEmulation::ResolveAsyncWaiter(node_, true);
+    delete node_;
+  }
+
+ private:
+  FutexWaitListNode* node_;
+
+  DISALLOW_COPY_AND_ASSIGN(AsyncWaiterTimeoutTask);
+};
+
+
 Object* FutexEmulation::Wait(Isolate* isolate,
                              Handle<JSArrayBuffer> array_buffer, size_t addr,
                              int32_t value, double rel_timeout_ms) {
@@ -82,7 +149,10 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   int32_t* p =
       reinterpret_cast<int32_t*>(static_cast<int8_t*>(backing_store) + addr);
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  FutexWaitList* wait_list =
+      wait_table_.Pointer()->GetWaitList(backing_store, addr);
+  base::Mutex* mutex = &wait_list->mutex_;
+  base::LockGuard<base::Mutex> lock_guard(mutex);
 
   if (*p != value) {
     return isolate->heap()->not_equal();
@@ -117,7 +187,8 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   base::TimeTicks timeout_time = start_time + rel_timeout;
   base::TimeTicks current_time = start_time;
 
-  wait_list_.Pointer()->AddNode(node);
+  wait_list->AddNode(node);
+  node->wait_list_.SetValue(wait_list);
 
   Object* result;
 
@@ -126,17 +197,17 @@ Object* FutexEmulation::Wait(Isolate* isolate,
     node->interrupted_ = false;
 
     // Unlock the mutex here to prevent deadlock from lock ordering between
-    // mutex_ and mutexes locked by HandleInterrupts.
-    mutex_.Pointer()->Unlock();
+    // the wait list mutex and mutexes locked by HandleInterrupts.
+    mutex->Unlock();
 
     // Because the mutex is unlocked, we have to be careful about not dropping
     // an interrupt. The notification can happen in three different places:
     // 1) Before Wait is called: the notification will be dropped, but
     //    interrupted_ will be set to 1. This will be checked below.
-    // 2) After interrupted has been checked here, but before mutex_ is
-    //    acquired: interrupted is checked again below, with mutex_ locked.
-    //    Because the wakeup signal also acquires mutex_, we know it will not
-    //    be able to notify until mutex_ is released below, when waiting on the
+    // 2) After interrupted has been checked here, but before mutex is
+    //    acquired: interrupted is checked again below, with mutex locked.
+    //    Because the wakeup signal also acquires the mutex, we know it will not
+    //    be able to notify until mutex is released below, when waiting on the
     //    condition variable.
     // 3) After the mutex is released in the call to WaitFor(): this
     // notification will wake up the condition variable. node->waiting() will
@@ -145,15 +216,15 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       Object* interrupt_object = isolate->stack_guard()->HandleInterrupts();
       if (interrupt_object->IsException(isolate)) {
         result = interrupt_object;
-        mutex_.Pointer()->Lock();
+        mutex->Lock();
         break;
       }
     }
 
-    mutex_.Pointer()->Lock();
+    mutex->Lock();
 
     if (node->interrupted_) {
-      // An interrupt occured while the mutex_ was unlocked. Don't wait yet.
+      // An interrupt occured while the mutex was unlocked. Don't wait yet.
       continue;
     }
 
@@ -173,21 +244,123 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       base::TimeDelta time_until_timeout = timeout_time - current_time;
       DCHECK(time_until_timeout.InMicroseconds() >= 0);
       bool wait_for_result =
-          node->cond_.WaitFor(mutex_.Pointer(), time_until_timeout);
+          node->cond_.WaitFor(mutex, time_until_timeout);
       USE(wait_for_result);
     } else {
-      node->cond_.Wait(mutex_.Pointer());
+      node->cond_.Wait(mutex);
     }
 
     // Spurious wakeup, interrupt or timeout.
   }
 
-  wait_list_.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
   node->waiting_ = false;
+  node->wait_list_.SetValue(nullptr);
 
   return result;
 }
 
+Object* FutexEmulation::WaitAsync(Isolate* isolate,
+                                  Handle<JSArrayBuffer> array_buffer,
+                                  size_t addr, int32_t value,
+                                  double rel_timeout_ms) {
+  DCHECK(addr < NumberToSize(array_buffer->byte_length()));
+
+  void* backing_store = array_buffer->backing_store();
+  int32_t* p =
+      reinterpret_cast<int32_t*>(static_cast<int8_t*>(backing_store) + addr);
+  Factory* factory = isolate->factory();
+
+  // Allocate everything up front, the mutex must not be held during a gc.
+  Handle<JSPromise> promise = factory->NewJSPromise();
+  Handle<JSObject> result = factory->NewJSObject(isolate->object_function());
+  FutexWaitListNode* node = nullptr;
+  Handle<Object> value_object;
+  {
+    FutexWaitList* wait_list =
+        wait_table_.Pointer()->GetWaitList(backing_store, addr);
+    base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+    if (*p != value) {
+      value_object = factory->not_equal();
+    } else if (rel_timeout_ms == 0) {
+      value_object = factory->timed_out();
+    } else {
+      node = new FutexWaitListNode();
+      node->backing_store_ = backing_store;
+      node->wait_addr_ = addr;
+      node->waiting_ = true;
+      node->async_isolate_ = isolate;
+      Handle<Object> global_promise =
+          isolate->global_handles()->Create(*promise);
+      node->async_promise_ = global_promise.location();
+      wait_list->AddNode(node);
+      node->wait_list_.SetValue(wait_list);
+      value_object = promise;
+    }
+  }
+
+  // The node can only be freed by tasks on this thread, so it is safe to
+  // schedule the timeout without holding the mutex.
+  if (node != nullptr && rel_timeout_ms != V8_INFINITY) {
+    AsyncWaiterTimeoutTask* task = new AsyncWaiterTimeoutTask(node);
+    node->async_timeout_task_id_ = task->id();
+    V8::GetCurrentPlatform()->CallDelayedOnForegroundThread(
+        reinterpret_cast<v8::Isolate*>(isolate), task,
+        rel_timeout_ms / base::Time::kMillisecondsPerSecond);
+  }
+
+  JSObject::AddProperty(result, factory->async_string(),
+                        factory->ToBoolean(node != nullptr), NONE);
+  JSObject::AddProperty(result, factory->value_string(), value_object, NONE);
+  return *result;
+}
+
+
+// static
+void FutexEmulation::ResolveAsyncWaiter(FutexWaitListNode* node,
+                                        bool timed_out) {
+  Isolate* isolate = node->async_isolate_;
+  if (!timed_out && node->async_timeout_task_id_ != 0) {
+    isolate->cancelable_task_manager()->TryAbort(node->async_timeout_task_id_);
+  }
+
+  HandleScope scope(isolate);
+  Handle<JSPromise> promise(JSPromise::cast(*node->async_promise_), isolate);
+  GlobalHandles::Destroy(node->async_promise_);
+  node->async_promise_ = nullptr;
+
+  SaveContext save(isolate);
+  isolate->set_context(*promise->GetCreationContext());
+  Handle<Object> argv[] = {promise, timed_out ? isolate->factory()->timed_out()
+                                              : isolate->factory()->ok()};
+  USE(Execution::TryCall(isolate, isolate->promise_resolve(),
+                         isolate->factory()->undefined_value(),
+                         arraysize(argv), argv,
+                         Execution::MessageHandling::kReport, nullptr));
+  if (isolate->handle_scope_implementer()->microtasks_policy() ==
+      v8::MicrotasksPolicy::kAuto) {
+    isolate->RunMicrotasks();
+  }
+}
+
+
+// static
+void FutexEmulation::IsolateDeinit(Isolate* isolate) {
+  for (int i = 0; i < FutexWaitTable::kNumberOfWaitLists; i++) {
+    FutexWaitList* wait_list = &wait_table_.Pointer()->wait_lists_[i];
+    base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+    FutexWaitListNode* node = wait_list->head_;
+    while (node) {
+      FutexWaitListNode* next = node->next_;
+      if (node->async_isolate_ == isolate) {
+        wait_list->RemoveNode(node);
+        delete node;
+      }
+      node = next;
+    }
+  }
+}
+
 Object* FutexEmulation::Wake(Isolate* isolate,
                              Handle<JSArrayBuffer> array_buffer, size_t addr,
                              uint32_t num_waiters_to_wake) {
@@ -196,19 +369,32 @@ Object* FutexEmulation::Wake(Isolate* isolate,
   int waiters_woken = 0;
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitList* wait_list =
+      wait_table_.Pointer()->GetWaitList(backing_store, addr);
+  base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+  FutexWaitListNode* node = wait_list->head_;
   while (node && num_waiters_to_wake > 0) {
-    if (backing_store == node->backing_store_ && addr == node->wait_addr_) {
+    FutexWaitListNode* next = node->next_;
+    if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
+        node->waiting_) {
       node->waiting_ = false;
-      node->cond_.NotifyOne();
+      if (node->async_isolate_ != nullptr) {
+        // Hand the node over to a task on the thread of the waiting isolate.
+        wait_list->RemoveNode(node);
+        node->wait_list_.SetValue(nullptr);
+        V8::GetCurrentPlatform()->CallOnForegroundThread(
+            reinterpret_cast<v8::Isolate*>(node->async_isolate_),
+            new AsyncWaiterResolveTask(node));
+      } else {
+        node->cond_.NotifyOne();
+      }
       if (num_waiters_to_wake != kWakeAll) {
         --num_waiters_to_wake;
       }
       waiters_woken++;
     }
 
-    node = node->next_;
+    node = next;
   }
 
   return Smi::FromInt(waiters_woken);
@@ -221,10 +407,12 @@ Object* FutexEmulation::NumWaitersForTesting(Isolate* isolate,
   DCHECK(addr < NumberToSize(array_buffer->byte_length()));
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  FutexWaitList* wait_list =
+      wait_table_.Pointer()->GetWaitList(backing_store, addr);
+  base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
 
   int waiters = 0;
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitListNode* node = wait_list->head_;
   while (node) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
         node->waiting_) {
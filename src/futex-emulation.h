@@ -8,6 +8,7 @@
 #include <stdint.h>
 
 #include "src/allocation.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
@@ -17,7 +18,9 @@
 // Support for emulating futexes, a low-level synchronization primitive. They
 // are natively supported by Linux, but must be emulated for other platforms.
 // This library emulates them on all platforms using mutexes and condition
-// variables for consistency.
+// variables for consistency. Waiters are distributed over a fixed number of
+// wait lists by the address they wait on, so that waking only has to scan and
+// lock the list of that address.
 //
 // This is used by the Futex API defined in the SharedArrayBuffer draft spec,
 // found here: https://github.com/tc39/ecmascript_sharedmem
@@ -33,6 +36,7 @@ namespace internal {
 template <typename T>
 class Handle;
 class Isolate;
+class FutexWaitList;
 class JSArrayBuffer;
 
 class FutexWaitListNode {
@@ -42,12 +46,18 @@ class FutexWaitListNode {
         next_(nullptr),
         backing_store_(nullptr),
         wait_addr_(0),
+        wait_list_(nullptr),
         waiting_(false),
-        interrupted_(false) {}
+        interrupted_(false),
+        async_isolate_(nullptr),
+        async_promise_(nullptr),
+        async_timeout_task_id_(0) {}
 
   void NotifyWake();
 
  private:
+  friend class AsyncWaiterResolveTask;
+  friend class AsyncWaiterTimeoutTask;
   friend class FutexEmulation;
   friend class FutexWaitList;
 
@@ -56,9 +66,20 @@ class FutexWaitListNode {
   FutexWaitListNode* next_;
   void* backing_store_;
   size_t wait_addr_;
+  // The list the node is waiting in, nullptr if it is not waiting. Only
+  // changed with the mutex of that list held, the fields below are protected
+  // by the same mutex.
+  base::AtomicValue<FutexWaitList*> wait_list_;
   bool waiting_;
   bool interrupted_;
 
+  // Nodes of Atomics.waitAsync are allocated per wait and owned by their wait
+  // list, and by the task that resolves the promise once they are woken.
+  Isolate* async_isolate_;
+  // Global handle of the promise to resolve.
+  Object** async_promise_;
+  uint32_t async_timeout_task_id_;
+
   DISALLOW_COPY_AND_ASSIGN(FutexWaitListNode);
 };
 
@@ -71,8 +92,11 @@ class FutexWaitList {
   void RemoveNode(FutexWaitListNode* node);
 
  private:
+  friend class AsyncWaiterTimeoutTask;
   friend class FutexEmulation;
+  friend class FutexWaitListNode;
 
+  base::Mutex mutex_;
   FutexWaitListNode* head_;
   FutexWaitListNode* tail_;
 
@@ -80,6 +104,24 @@ class FutexWaitList {
 };
 
 
+class FutexWaitTable {
+ public:
+  static const int kNumberOfWaitLists = 64;
+
+  FutexWaitTable() {}
+
+  // Returns the list for waiters on the given |addr| of |backing_store|.
+  FutexWaitList* GetWaitList(void* backing_store, size_t addr);
+
+ private:
+  friend class FutexEmulation;
+
+  FutexWaitList wait_lists_[kNumberOfWaitLists];
+
+  DISALLOW_COPY_AND_ASSIGN(FutexWaitTable);
+};
+
+
 class FutexEmulation : public AllStatic {
  public:
   // Pass to Wake() to wake all waiters.
@@ -94,6 +136,14 @@ class FutexEmulation : public AllStatic {
   static Object* Wait(Isolate* isolate, Handle<JSArrayBuffer> array_buffer,
                       size_t addr, int32_t value, double rel_timeout_ms);
 
+  // Like |Wait|, but doesn't block. Returns an object whose "async" property
+  // tells whether its "value" is the result string or a promise that is
+  // resolved with it. Promises are resolved by foreground tasks posted to
+  // |isolate|'s thread when woken or when the timeout elapses.
+  static Object* WaitAsync(Isolate* isolate,
+                           Handle<JSArrayBuffer> array_buffer, size_t addr,
+                           int32_t value, double rel_timeout_ms);
+
   // Wake |num_waiters_to_wake| threads that are waiting on the given |addr|.
   // |num_waiters_to_wake| can be kWakeAll, in which case all waiters are
   // woken. The rest of the waiters will continue to wait. The return value is
@@ -107,11 +157,17 @@ class FutexEmulation : public AllStatic {
                                       Handle<JSArrayBuffer> array_buffer,
                                       size_t addr);
 
+  // Drops the asynchronous waiters of |isolate|, their promises are never
+  // resolved. Called when the isolate is torn down.
+  static void IsolateDeinit(Isolate* isolate);
+
  private:
-  friend class FutexWaitListNode;
+  friend class AsyncWaiterResolveTask;
+  friend class AsyncWaiterTimeoutTask;
+
+  static void ResolveAsyncWaiter(FutexWaitListNode* node, bool timed_out);
 
-  static base::LazyMutex mutex_;
-  static base::LazyInstance<FutexWaitList>::type wait_list_;
+  static base::LazyInstance<FutexWaitTable>::type wait_table_;
 };
 }  // namespace internal
 }  // namespace v8
@@ -66,7 +66,9 @@ class GlobalHandles::Node {
     object_ = reinterpret_cast<Object*>(kGlobalHandleZapValue);
     index_ = static_cast<uint8_t>(index);
     DCHECK(static_cast<int>(index_) == index);
-    set_state(FREE);
+    // The flags are not initialized yet, so bypass the accounting in
+    // set_state().
+    flags_ = NodeState::encode(FREE);
     set_in_new_space_list(false);
     parameter_or_next_free_.next_free = *first_free;
     *first_free = this;
@@ -120,9 +122,18 @@ class GlobalHandles::Node {
     return NodeState::decode(flags_);
   }
   void set_state(State state) {
+    if (IsWeakState(this->state()) != IsWeakState(state)) {
+      UpdateBlockWeakUses(IsWeakState(state));
+    }
     flags_ = NodeState::update(flags_, state);
   }
 
+  // Whether a node in {state} does not keep its object alive by itself, so
+  // that strong root iteration can skip it.
+  static bool IsWeakState(State state) {
+    return state == WEAK || state == PENDING || state == NEAR_DEATH;
+  }
+
   bool is_independent() {
     return IsIndependent::decode(flags_);
   }
@@ -332,6 +343,7 @@ class GlobalHandles::Node {
   inline NodeBlock* FindBlock();
   inline void IncreaseBlockUses();
   inline void DecreaseBlockUses();
+  inline void UpdateBlockWeakUses(bool is_weak);
 
   // Storage for object pointer.
   // Placed first to avoid offset computation.
@@ -378,6 +390,7 @@ class GlobalHandles::NodeBlock {
   explicit NodeBlock(GlobalHandles* global_handles, NodeBlock* next)
       : next_(next),
         used_nodes_(0),
+        weak_nodes_(0),
         next_used_(NULL),
         prev_used_(NULL),
         global_handles_(global_handles) {}
@@ -416,6 +429,21 @@ class GlobalHandles::NodeBlock {
     }
   }
 
+  void IncreaseWeakUses() {
+    DCHECK(weak_nodes_ < kSize);
+    weak_nodes_++;
+  }
+
+  void DecreaseWeakUses() {
+    DCHECK(weak_nodes_ > 0);
+    weak_nodes_--;
+  }
+
+  // Whether the block has used nodes in NORMAL state.
+  bool has_strong_nodes() const { return used_nodes_ > weak_nodes_; }
+  // Whether the block has used nodes in WEAK, PENDING or NEAR_DEATH state.
+  bool has_weak_nodes() const { return weak_nodes_ > 0; }
+
   GlobalHandles* global_handles() { return global_handles_; }
 
   // Next block in the list of all blocks.
@@ -429,6 +457,7 @@ class GlobalHandles::NodeBlock {
   Node nodes_[kSize];
   NodeBlock* const next_;
   int used_nodes_;
+  int weak_nodes_;
   NodeBlock* next_used_;
   NodeBlock* prev_used_;
   GlobalHandles* global_handles_;
@@ -469,11 +498,27 @@ void GlobalHandles::Node::DecreaseBlockUses() {
 }
 
 
+void GlobalHandles::Node::UpdateBlockWeakUses(bool is_weak) {
+  if (is_weak) {
+    FindBlock()->IncreaseWeakUses();
+  } else {
+    FindBlock()->DecreaseWeakUses();
+  }
+}
+
+
 class GlobalHandles::NodeIterator {
  public:
-  explicit NodeIterator(GlobalHandles* global_handles)
+  // Blocks without nodes of the requested kind are skipped as a whole.
+  enum Filter { kAllNodes, kStrongNodes, kWeakNodes };
+
+  explicit NodeIterator(GlobalHandles* global_handles,
+                        Filter filter = kAllNodes)
       : block_(global_handles->first_used_block_),
-        index_(0) {}
+        index_(0),
+        filter_(filter) {
+    SkipBlocks();
+  }
 
   bool done() const { return block_ == NULL; }
 
@@ -487,11 +532,25 @@ class GlobalHandles::NodeIterator {
     if (++index_ < NodeBlock::kSize) return;
     index_ = 0;
     block_ = block_->next_used();
+    SkipBlocks();
   }
 
  private:
+  void SkipBlocks() {
+    while (block_ != NULL) {
+      if (filter_ == kStrongNodes && !block_->has_strong_nodes()) {
+        block_ = block_->next_used();
+      } else if (filter_ == kWeakNodes && !block_->has_weak_nodes()) {
+        block_ = block_->next_used();
+      } else {
+        return;
+      }
+    }
+  }
+
   NodeBlock* block_;
   int index_;
+  const Filter filter_;
 
   DISALLOW_COPY_AND_ASSIGN(NodeIterator);
 };
@@ -511,9 +570,17 @@ class GlobalHandles::PendingPhantomCallbacksSecondPassTask
     TRACE_EVENT0("v8", "V8.GCPhantomHandleProcessingCallback");
     isolate()->heap()->CallGCPrologueCallbacks(
         GCType::kGCTypeProcessWeakCallbacks, kNoGCCallbackFlags);
-    InvokeSecondPassPhantomCallbacks(&pending_phantom_callbacks_, isolate());
+    InvokeSecondPassPhantomCallbacksWithinBudget(&pending_phantom_callbacks_,
+                                                 isolate());
     isolate()->heap()->CallGCEpilogueCallbacks(
         GCType::kGCTypeProcessWeakCallbacks, kNoGCCallbackFlags);
+    if (pending_phantom_callbacks_.length() > 0) {
+      // Out of budget; yield to the embedder and continue in a new task.
+      auto task = new PendingPhantomCallbacksSecondPassTask(
+          &pending_phantom_callbacks_, isolate());
+      V8::GetCurrentPlatform()->CallOnForegroundThread(
+          reinterpret_cast<v8::Isolate*>(isolate()), task);
+    }
   }
 
   Isolate* isolate() { return isolate_; }
@@ -525,6 +592,32 @@ class GlobalHandles::PendingPhantomCallbacksSecondPassTask
   DISALLOW_COPY_AND_ASSIGN(PendingPhantomCallbacksSecondPassTask);
 };
 
+// Invokes second pass callbacks that were declared thread-safe on a background
+// thread. As these callbacks do not call into V8, no GC prologue and epilogue
+// callbacks are issued around them.
+class GlobalHandles::ThreadSafePhantomCallbacksTask
+    : public v8::internal::CancelableTask {
+ public:
+  // Takes ownership of the contents of pending_phantom_callbacks, leaving it in
+  // the same state it would be after a call to Clear().
+  ThreadSafePhantomCallbacksTask(
+      List<PendingPhantomCallback>* pending_phantom_callbacks, Isolate* isolate)
+      : CancelableTask(isolate), isolate_(isolate) {
+    pending_phantom_callbacks_.Swap(pending_phantom_callbacks);
+  }
+
+  void RunInternal() override {
+    TRACE_EVENT0("v8", "V8.GCPhantomHandleProcessingCallback");
+    InvokeSecondPassPhantomCallbacks(&pending_phantom_callbacks_, isolate_);
+  }
+
+ private:
+  Isolate* isolate_;
+  List<PendingPhantomCallback> pending_phantom_callbacks_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadSafePhantomCallbacksTask);
+};
+
 GlobalHandles::GlobalHandles(Isolate* isolate)
     : isolate_(isolate),
       number_of_global_handles_(0),
@@ -613,7 +706,8 @@ bool GlobalHandles::IsWeak(Object** location) {
 
 DISABLE_CFI_PERF
 void GlobalHandles::IterateWeakRoots(RootVisitor* v) {
-  for (NodeIterator it(this); !it.done(); it.Advance()) {
+  for (NodeIterator it(this, NodeIterator::kWeakNodes); !it.done();
+       it.Advance()) {
     Node* node = it.node();
     if (node->IsWeakRetainer()) {
       // Pending weak phantom handles die immediately. Everything else survives.
@@ -632,7 +726,8 @@ void GlobalHandles::IterateWeakRoots(RootVisitor* v) {
 
 
 void GlobalHandles::IdentifyWeakHandles(WeakSlotCallback f) {
-  for (NodeIterator it(this); !it.done(); it.Advance()) {
+  for (NodeIterator it(this, NodeIterator::kWeakNodes); !it.done();
+       it.Advance()) {
     if (it.node()->IsWeak() && f(it.node()->location())) {
       it.node()->MarkPending();
     }
@@ -718,6 +813,29 @@ void GlobalHandles::InvokeSecondPassPhantomCallbacks(
   }
 }
 
+void GlobalHandles::InvokeSecondPassPhantomCallbacksWithinBudget(
+    List<PendingPhantomCallback>* callbacks, Isolate* isolate) {
+  if (FLAG_phantom_callbacks_time_budget <= 0) {
+    InvokeSecondPassPhantomCallbacks(callbacks, isolate);
+    return;
+  }
+  // Reading the clock is not free, so it is only checked every few callbacks.
+  const int kCallbacksBetweenDeadlineChecks = 16;
+  Heap* heap = isolate->heap();
+  const double deadline_in_ms = heap->MonotonicallyIncreasingTimeInMs() +
+                                FLAG_phantom_callbacks_time_budget;
+  int invoked = 0;
+  while (callbacks->length() != 0) {
+    auto callback = callbacks->RemoveLast();
+    DCHECK(callback.node() == nullptr);
+    callback.Invoke(isolate);
+    if (++invoked % kCallbacksBetweenDeadlineChecks == 0 &&
+        heap->MonotonicallyIncreasingTimeInMs() >= deadline_in_ms) {
+      return;
+    }
+  }
+}
+
 
 int GlobalHandles::PostScavengeProcessing(
     const int initial_post_gc_processing_count) {
@@ -829,10 +947,31 @@ int GlobalHandles::DispatchPendingPhantomCallbacks(
       isolate()->heap()->CallGCEpilogueCallbacks(
           GCType::kGCTypeProcessWeakCallbacks, kNoGCCallbackFlags);
     } else {
-      auto task = new PendingPhantomCallbacksSecondPassTask(
-          &second_pass_callbacks, isolate());
-      V8::GetCurrentPlatform()->CallOnForegroundThread(
-          reinterpret_cast<v8::Isolate*>(isolate()), task);
+      if (FLAG_concurrent_phantom_callbacks) {
+        List<PendingPhantomCallback> thread_safe_callbacks;
+        int last = 0;
+        for (int i = 0; i < second_pass_callbacks.length(); i++) {
+          PendingPhantomCallback& callback = second_pass_callbacks[i];
+          if (callback.thread_safe()) {
+            thread_safe_callbacks.Add(callback);
+          } else {
+            second_pass_callbacks[last++] = callback;
+          }
+        }
+        second_pass_callbacks.Rewind(last);
+        if (thread_safe_callbacks.length() > 0) {
+          V8::GetCurrentPlatform()->CallOnBackgroundThread(
+              new ThreadSafePhantomCallbacksTask(&thread_safe_callbacks,
+                                                 isolate()),
+              v8::Platform::kShortRunningTask);
+        }
+      }
+      if (second_pass_callbacks.length() > 0) {
+        auto task = new PendingPhantomCallbacksSecondPassTask(
+            &second_pass_callbacks, isolate());
+        V8::GetCurrentPlatform()->CallOnForegroundThread(
+            reinterpret_cast<v8::Isolate*>(isolate()), task);
+      }
     }
   }
   return freed_nodes;
@@ -846,8 +985,10 @@ void GlobalHandles::PendingPhantomCallback::Invoke(Isolate* isolate) {
     DCHECK(node_->state() == Node::NEAR_DEATH);
     callback_addr = &callback_;
   }
+  bool* thread_safe_addr = nullptr;
+  if (node_ != nullptr) thread_safe_addr = &thread_safe_;
   Data data(reinterpret_cast<v8::Isolate*>(isolate), parameter_,
-            embedder_fields_, callback_addr);
+            embedder_fields_, callback_addr, thread_safe_addr);
   Data::Callback callback = callback_;
   callback_ = nullptr;
   callback(data);
@@ -894,7 +1035,8 @@ int GlobalHandles::PostGarbageCollectionProcessing(
 }
 
 void GlobalHandles::IterateStrongRoots(RootVisitor* v) {
-  for (NodeIterator it(this); !it.done(); it.Advance()) {
+  for (NodeIterator it(this, NodeIterator::kStrongNodes); !it.done();
+       it.Advance()) {
     if (it.node()->IsStrongRetainer()) {
       v->VisitRootPointer(Root::kGlobalHandles, it.node()->location());
     }
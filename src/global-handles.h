@@ -183,12 +183,18 @@ class GlobalHandles {
   class NodeIterator;
   class PendingPhantomCallback;
   class PendingPhantomCallbacksSecondPassTask;
+  class ThreadSafePhantomCallbacksTask;
 
   explicit GlobalHandles(Isolate* isolate);
 
   // Helpers for PostGarbageCollectionProcessing.
   static void InvokeSecondPassPhantomCallbacks(
       List<PendingPhantomCallback>* callbacks, Isolate* isolate);
+  // Invokes callbacks until either all are done or the time taken exceeds
+  // --phantom-callbacks-time-budget. Leaves the remaining callbacks in
+  // {callbacks}.
+  static void InvokeSecondPassPhantomCallbacksWithinBudget(
+      List<PendingPhantomCallback>* callbacks, Isolate* isolate);
   int PostScavengeProcessing(int initial_post_gc_processing_count);
   int PostMarkSweepProcessing(int initial_post_gc_processing_count);
   int DispatchPendingPhantomCallbacks(bool synchronous_second_pass);
@@ -232,7 +238,10 @@ class GlobalHandles::PendingPhantomCallback {
   PendingPhantomCallback(
       Node* node, Data::Callback callback, void* parameter,
       void* embedder_fields[v8::kEmbedderFieldsInWeakCallback])
-      : node_(node), callback_(callback), parameter_(parameter) {
+      : node_(node),
+        callback_(callback),
+        parameter_(parameter),
+        thread_safe_(false) {
     for (int i = 0; i < v8::kEmbedderFieldsInWeakCallback; ++i) {
       embedder_fields_[i] = embedder_fields[i];
     }
@@ -242,11 +251,15 @@ class GlobalHandles::PendingPhantomCallback {
 
   Node* node() { return node_; }
   Data::Callback callback() { return callback_; }
+  // Whether the first pass callback declared its second pass callback as
+  // thread-safe, see WeakCallbackInfo::SetThreadSafeSecondPassCallback.
+  bool thread_safe() const { return thread_safe_; }
 
  private:
   Node* node_;
   Data::Callback callback_;
   void* parameter_;
+  bool thread_safe_;
   void* embedder_fields_[v8::kEmbedderFieldsInWeakCallback];
 };
 
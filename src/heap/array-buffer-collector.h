@@ -0,0 +1,55 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
+#define V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
+
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/objects.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// To support background freeing of backing stores of dead array buffers, the
+// ArrayBufferTracker hands the allocations of buffers it found dead to the
+// collector instead of freeing them right away. The collector returns them to
+// the embedder's ArrayBuffer::Allocator on a background task, which keeps the
+// allocator's Free out of the GC pause. External memory accounting is updated
+// when a buffer is found dead, not when its backing store is freed.
+class ArrayBufferCollector {
+ public:
+  explicit ArrayBufferCollector(Heap* heap) : heap_(heap) {}
+
+  ~ArrayBufferCollector() { DCHECK(allocations_.empty()); }
+
+  // Adds the allocations in {allocations} to the set of allocations to be
+  // freed. Can be called concurrently.
+  void AddGarbageAllocations(
+      std::vector<JSArrayBuffer::Allocation>* allocations);
+
+  // Frees all pending allocations on a background task, or on the calling
+  // thread with --no-concurrent-array-buffer-freeing.
+  void FreeAllocationsOnBackgroundThread();
+
+  // Frees all pending allocations on the calling thread.
+  void FreeAllocations();
+
+ private:
+  class FreeingTask;
+
+  Heap* heap_;
+  base::Mutex allocations_mutex_;
+  std::vector<std::vector<JSArrayBuffer::Allocation>> allocations_;
+
+  DISALLOW_COPY_AND_ASSIGN(ArrayBufferCollector);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/heap/array-buffer-tracker.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/spaces.h"
@@ -14,17 +15,32 @@ LocalArrayBufferTracker::~LocalArrayBufferTracker() {
   CHECK(array_buffers_.empty());
 }
 
+namespace {
+
+// Records the backing store of the dead {buffer} in {allocations}, to be freed
+// by the heap's ArrayBufferCollector.
+void AddGarbageAllocation(JSArrayBuffer* buffer,
+                          std::vector<JSArrayBuffer::Allocation>* allocations) {
+  if (buffer->allocation_base() == nullptr) return;
+  allocations->emplace_back(buffer->allocation_base(),
+                            buffer->allocation_length(),
+                            buffer->allocation_mode());
+}
+
+}  // namespace
+
 template <typename Callback>
 void LocalArrayBufferTracker::Free(Callback should_free) {
   size_t freed_memory = 0;
   size_t retained_size = 0;
+  std::vector<JSArrayBuffer::Allocation> garbage_allocations;
   for (TrackingData::iterator it = array_buffers_.begin();
        it != array_buffers_.end();) {
     JSArrayBuffer* buffer = reinterpret_cast<JSArrayBuffer*>(*it);
     const size_t length = buffer->allocation_length();
     if (should_free(buffer)) {
       freed_memory += length;
-      buffer->FreeBackingStore();
+      AddGarbageAllocation(buffer, &garbage_allocations);
       it = array_buffers_.erase(it);
     } else {
       retained_size += length;
@@ -32,6 +48,7 @@ void LocalArrayBufferTracker::Free(Callback should_free) {
     }
   }
   retained_size_ = retained_size;
+  heap_->array_buffer_collector()->AddGarbageAllocations(&garbage_allocations);
   if (freed_memory > 0) {
     heap_->update_external_memory_concurrently_freed(
         static_cast<intptr_t>(freed_memory));
@@ -44,6 +61,7 @@ void LocalArrayBufferTracker::Process(Callback callback) {
   JSArrayBuffer* old_buffer = nullptr;
   size_t freed_memory = 0;
   size_t retained_size = 0;
+  std::vector<JSArrayBuffer::Allocation> garbage_allocations;
   for (TrackingData::iterator it = array_buffers_.begin();
        it != array_buffers_.end();) {
     old_buffer = reinterpret_cast<JSArrayBuffer*>(*it);
@@ -70,13 +88,14 @@ void LocalArrayBufferTracker::Process(Callback callback) {
       it = array_buffers_.erase(it);
     } else if (result == kRemoveEntry) {
       freed_memory += length;
-      old_buffer->FreeBackingStore();
+      AddGarbageAllocation(old_buffer, &garbage_allocations);
       it = array_buffers_.erase(it);
     } else {
       UNREACHABLE();
     }
   }
   retained_size_ = retained_size;
+  heap_->array_buffer_collector()->AddGarbageAllocations(&garbage_allocations);
   if (freed_memory > 0) {
     heap_->update_external_memory_concurrently_freed(
         static_cast<intptr_t>(freed_memory));
@@ -8,6 +8,7 @@
 #include <deque>
 
 #include "src/base/platform/mutex.h"
+#include "src/heap/worklist.h"
 
 namespace v8 {
 namespace internal {
@@ -16,40 +17,44 @@ class Heap;
 class Isolate;
 class HeapObject;
 
-enum class MarkingThread { kMain, kConcurrent };
-
 enum class TargetDeque { kShared, kBailout };
 
-// The concurrent marking deque supports deque operations for two threads:
-// main and concurrent. It is implemented using two deques: shared and bailout.
+// The concurrent marking deque supports deque operations for the main thread
+// and several concurrent marking tasks. It is implemented using a shared
+// worklist and a bailout deque.
 //
-// The concurrent thread can use the push and pop operations with the
-// MarkingThread::kConcurrent argument. All other operations are intended
-// to be used by the main thread only.
+// Each thread is identified by a task id. The main thread always uses
+// kMainThread, concurrent marking tasks use ids in the range
+// [1, kMaxConcurrentTasks]. All operations that do not take a task id are
+// intended to be used by the main thread only.
 //
 // The interface of the concurrent marking deque for the main thread matches
 // that of the sequential marking deque, so they can be easily switched
 // at compile time without updating the main thread call-sites.
 //
-// The shared deque is shared between the main thread and the concurrent
-// thread, so both threads can push to and pop from the shared deque.
+// The shared worklist is shared between the main thread and the concurrent
+// tasks. Each thread pushes to and pops from its private segments and steals
+// segments published by other threads, see Worklist for details.
 // The bailout deque stores objects that cannot be processed by the concurrent
-// thread. Only the concurrent thread can push to it and only the main thread
+// tasks. Only the concurrent tasks can push to it and only the main thread
 // can pop from it.
 class ConcurrentMarkingDeque {
  public:
+  static const int kMainThread = 0;
+  static const int kMaxConcurrentTasks = Worklist::kMaxNumTasks - 1;
+
   // The heap parameter is needed to match the interface
   // of the sequential marking deque.
   explicit ConcurrentMarkingDeque(Heap* heap) {}
 
   // Pushes the object into the specified deque assuming that the function is
-  // called on the specified thread. The main thread can push only to the shared
-  // deque. The concurrent thread can push to both deques.
-  bool Push(HeapObject* object, MarkingThread thread = MarkingThread::kMain,
+  // called on the thread with the given task id. The main thread can push only
+  // to the shared worklist. The concurrent tasks can push to both.
+  bool Push(HeapObject* object, int task_id = kMainThread,
             TargetDeque target = TargetDeque::kShared) {
     switch (target) {
       case TargetDeque::kShared:
-        shared_deque_.Push(object);
+        shared_worklist_.Push(task_id, object);
         break;
       case TargetDeque::kBailout:
         bailout_deque_.Push(object);
@@ -58,30 +63,54 @@ class ConcurrentMarkingDeque {
     return true;
   }
 
-  // Pops an object from the bailout or shared deque assuming that the function
-  // is called on the specified thread. The main thread first tries to pop the
-  // bailout deque. If the deque is empty then it tries the shared deque.
-  // If the shared deque is also empty, then the function returns nullptr.
-  // The concurrent thread pops only from the shared deque.
-  HeapObject* Pop(MarkingThread thread = MarkingThread::kMain) {
-    if (thread == MarkingThread::kMain) {
+  // Pops an object from the bailout deque or the shared worklist assuming that
+  // the function is called on the thread with the given task id. The main
+  // thread first tries to pop the bailout deque. If the deque is empty then it
+  // tries the shared worklist. If the shared worklist is also empty, then the
+  // function returns nullptr. The concurrent tasks pop only from the shared
+  // worklist.
+  HeapObject* Pop(int task_id = kMainThread) {
+    if (task_id == kMainThread) {
       HeapObject* result = bailout_deque_.Pop();
       if (result != nullptr) return result;
     }
-    return shared_deque_.Pop();
+    HeapObject* result;
+    if (!shared_worklist_.Pop(task_id, &result)) return nullptr;
+    return result;
+  }
+
+  // Publishes the private segments of the given task so that they can be
+  // stolen by other tasks.
+  void FlushToGlobal(int task_id) { shared_worklist_.FlushToGlobal(task_id); }
+
+  // Returns true if there is work that can be stolen by a concurrent task.
+  bool HasWorkForConcurrentTasks() {
+    return !shared_worklist_.IsGlobalPoolEmpty();
   }
 
   // All the following operations can used only by the main thread.
+  // Clear and Update must not race with concurrent tasks, i.e. the tasks must
+  // be either finished or paused.
   void Clear() {
     bailout_deque_.Clear();
-    shared_deque_.Clear();
+    shared_worklist_.Clear();
   }
 
   bool IsFull() { return false; }
 
-  bool IsEmpty() { return bailout_deque_.IsEmpty() && shared_deque_.IsEmpty(); }
+  // Segments that are private to concurrent tasks are not taken into account.
+  bool IsEmpty() {
+    return bailout_deque_.IsEmpty() &&
+           shared_worklist_.IsLocalEmpty(kMainThread) &&
+           shared_worklist_.IsGlobalPoolEmpty();
+  }
 
-  int Size() { return bailout_deque_.Size() + shared_deque_.Size(); }
+  // Segments that are private to concurrent tasks are not taken into account.
+  int Size() {
+    return bailout_deque_.Size() +
+           static_cast<int>(shared_worklist_.LocalSize(kMainThread) +
+                            shared_worklist_.GlobalPoolSize());
+  }
 
   // Calls the specified callback on each element of the deques and replaces
   // the element with the result of the callback. If the callback returns
@@ -90,13 +119,13 @@ class ConcurrentMarkingDeque {
   template <typename Callback>
   void Update(Callback callback) {
     bailout_deque_.Update(callback);
-    shared_deque_.Update(callback);
+    shared_worklist_.Update(callback);
   }
 
   // These empty functions are needed to match the interface
   // of the sequential marking deque.
   void SetUp() {}
-  void TearDown() {}
+  void TearDown() { Clear(); }
   void StartUsing() {}
   void StopUsing() {}
   void ClearOverflowed() {}
@@ -148,12 +177,12 @@ class ConcurrentMarkingDeque {
    private:
     base::Mutex mutex_;
     std::deque<HeapObject*> deque_;
-    // Ensure that two deques do not share the same cache line.
+    // Ensure that the deque and the worklist do not share the same cache line.
     static int const kCachePadding = 64;
     char cache_padding_[kCachePadding];
   };
   Deque bailout_deque_;
-  Deque shared_deque_;
+  Worklist shared_worklist_;
   DISALLOW_COPY_AND_ASSIGN(ConcurrentMarkingDeque);
 };
 
@@ -6,8 +6,10 @@
 
 #include <stack>
 #include <unordered_map>
+#include <vector>
 
 #include "src/heap/concurrent-marking-deque.h"
+#include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/marking.h"
@@ -48,8 +50,8 @@ class ConcurrentMarkingVisitor final
  public:
   using BaseClass = HeapVisitor<int, ConcurrentMarkingVisitor>;
 
-  explicit ConcurrentMarkingVisitor(ConcurrentMarkingDeque* deque)
-      : deque_(deque) {}
+  ConcurrentMarkingVisitor(ConcurrentMarkingDeque* deque, int task_id)
+      : deque_(deque), task_id_(task_id) {}
 
   bool ShouldVisit(HeapObject* object) override {
     return ObjectMarking::GreyToBlack<AccessMode::ATOMIC>(
@@ -97,7 +99,23 @@ class ConcurrentMarkingVisitor final
   }
 
   int VisitJSApiObject(Map* map, JSObject* object) override {
-    return VisitJSObject(map, object);
+    int size = VisitJSObject(map, object);
+    if (size == 0) return 0;
+    Heap* heap = object->GetHeap();
+    LocalEmbedderHeapTracer::WrapperInfo wrapper;
+    if (heap->local_embedder_heap_tracer()->InUse() &&
+        heap->ExtractWrapperInfo(object, &wrapper)) {
+      wrappers_.push_back(wrapper);
+    }
+    return size;
+  }
+
+  // Publishes the wrappers found so far to the embedder heap tracer.
+  void FlushWrappers(Heap* heap) {
+    if (wrappers_.empty()) return;
+    heap->local_embedder_heap_tracer()->AddWrappersToTraceConcurrently(
+        wrappers_);
+    wrappers_.clear();
   }
 
   // ===========================================================================
@@ -118,7 +136,7 @@ class ConcurrentMarkingVisitor final
   // ===========================================================================
 
   int VisitCode(Map* map, Code* object) override {
-    deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+    deque_->Push(object, task_id_, TargetDeque::kBailout);
     return 0;
   }
 
@@ -133,7 +151,7 @@ class ConcurrentMarkingVisitor final
       VisitMapPointer(object, object->map_slot());
       BytecodeArray::BodyDescriptorWeak::IterateBody(object, size, this);
       // Aging of bytecode arrays is done on the main thread.
-      deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+      deque_->Push(object, task_id_, TargetDeque::kBailout);
     }
     return 0;
   }
@@ -148,7 +166,7 @@ class ConcurrentMarkingVisitor final
 
   int VisitMap(Map* map, Map* object) override {
     // TODO(ulan): implement iteration of strong fields.
-    deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+    deque_->Push(object, task_id_, TargetDeque::kBailout);
     return 0;
   }
 
@@ -160,7 +178,7 @@ class ConcurrentMarkingVisitor final
       Context::BodyDescriptorWeak::IterateBody(object, size, this);
       // TODO(ulan): implement proper weakness for normalized map cache
       // and remove this bailout.
-      deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+      deque_->Push(object, task_id_, TargetDeque::kBailout);
     }
     return 0;
   }
@@ -172,26 +190,26 @@ class ConcurrentMarkingVisitor final
       VisitMapPointer(object, object->map_slot());
       SharedFunctionInfo::BodyDescriptorWeak::IterateBody(object, size, this);
       // Resetting of IC age counter is done on the main thread.
-      deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+      deque_->Push(object, task_id_, TargetDeque::kBailout);
     }
     return 0;
   }
 
   int VisitTransitionArray(Map* map, TransitionArray* object) override {
     // TODO(ulan): implement iteration of strong fields.
-    deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+    deque_->Push(object, task_id_, TargetDeque::kBailout);
     return 0;
   }
 
   int VisitWeakCell(Map* map, WeakCell* object) override {
     // TODO(ulan): implement iteration of strong fields.
-    deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+    deque_->Push(object, task_id_, TargetDeque::kBailout);
     return 0;
   }
 
   int VisitJSWeakCollection(Map* map, JSWeakCollection* object) override {
     // TODO(ulan): implement iteration of strong fields.
-    deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
+    deque_->Push(object, task_id_, TargetDeque::kBailout);
     return 0;
   }
 
@@ -205,7 +223,7 @@ class ConcurrentMarkingVisitor final
 #endif
     if (ObjectMarking::WhiteToGrey<AccessMode::ATOMIC>(object,
                                                        marking_state(object))) {
-      deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kShared);
+      deque_->Push(object, task_id_, TargetDeque::kShared);
     }
   }
 
@@ -246,90 +264,185 @@ class ConcurrentMarkingVisitor final
   }
 
   ConcurrentMarkingDeque* deque_;
+  int task_id_;
   SlotSnapshot slot_snapshot_;
+  std::vector<LocalEmbedderHeapTracer::WrapperInfo> wrappers_;
 };
 
 class ConcurrentMarking::Task : public CancelableTask {
  public:
   Task(Isolate* isolate, ConcurrentMarking* concurrent_marking,
-       base::Semaphore* on_finish)
+       TaskState* task_state, int task_id)
       : CancelableTask(isolate),
         concurrent_marking_(concurrent_marking),
-        on_finish_(on_finish) {}
+        task_state_(task_state),
+        task_id_(task_id) {}
 
   virtual ~Task() {}
 
  private:
   // v8::internal::CancelableTask overrides.
   void RunInternal() override {
-    concurrent_marking_->Run();
-    on_finish_->Signal();
+    concurrent_marking_->Run(task_id_, task_state_);
   }
 
   ConcurrentMarking* concurrent_marking_;
-  base::Semaphore* on_finish_;
+  TaskState* task_state_;
+  int task_id_;
   DISALLOW_COPY_AND_ASSIGN(Task);
 };
 
 ConcurrentMarking::ConcurrentMarking(Heap* heap, ConcurrentMarkingDeque* deque)
-    : heap_(heap),
-      pending_task_semaphore_(0),
-      deque_(deque),
-      visitor_(new ConcurrentMarkingVisitor(deque_)),
-      is_task_pending_(false) {
+    : heap_(heap), deque_(deque), pending_task_count_(0) {
+  STATIC_ASSERT(kTasks <= ConcurrentMarkingDeque::kMaxConcurrentTasks);
   // The runtime flag should be set only if the compile time flag was set.
 #ifndef V8_CONCURRENT_MARKING
   CHECK(!FLAG_concurrent_marking);
 #endif
+  for (int i = 0; i <= kTasks; i++) {
+    is_pending_[i] = false;
+    cancelable_id_[i] = 0;
+  }
 }
 
-ConcurrentMarking::~ConcurrentMarking() { delete visitor_; }
-
-void ConcurrentMarking::Run() {
-  double time_ms = heap_->MonotonicallyIncreasingTimeInMs();
-  size_t bytes_marked = 0;
-  base::Mutex* relocation_mutex = heap_->relocation_mutex();
+void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
+  const size_t kBytesUntilInterruptCheck = 64 * KB;
+  const int kObjectsUntilInterrupCheck = 1000;
+  ConcurrentMarkingVisitor visitor(deque_, task_id);
+  double time_ms;
+  size_t total_bytes_marked = 0;
+  if (FLAG_trace_concurrent_marking) {
+    heap_->isolate()->PrintWithTimestamp(
+        "Starting concurrent marking task %d\n", task_id);
+  }
   {
     TimedScope scope(&time_ms);
-    while (true) {
-      base::LockGuard<base::Mutex> guard(relocation_mutex);
-      HeapObject* object = deque_->Pop(MarkingThread::kConcurrent);
-      if (object == nullptr) break;
-      Address new_space_top = heap_->new_space()->original_top();
-      Address new_space_limit = heap_->new_space()->original_limit();
-      Address addr = object->address();
-      if (new_space_top <= addr && addr < new_space_limit) {
-        deque_->Push(object, MarkingThread::kConcurrent, TargetDeque::kBailout);
-      } else {
-        Map* map = object->synchronized_map();
-        bytes_marked += visitor_->Visit(map, object);
+    bool done = false;
+    while (!done) {
+      base::LockGuard<base::Mutex> guard(&task_state->lock);
+      size_t bytes_marked = 0;
+      int objects_processed = 0;
+      while (bytes_marked < kBytesUntilInterruptCheck &&
+             objects_processed < kObjectsUntilInterrupCheck) {
+        HeapObject* object = deque_->Pop(task_id);
+        if (object == nullptr) {
+          done = true;
+          break;
+        }
+        objects_processed++;
+        Address new_space_top = heap_->new_space()->original_top();
+        Address new_space_limit = heap_->new_space()->original_limit();
+        Address addr = object->address();
+        if (new_space_top <= addr && addr < new_space_limit) {
+          deque_->Push(object, task_id, TargetDeque::kBailout);
+        } else {
+          Map* map = object->synchronized_map();
+          bytes_marked += visitor.Visit(map, object);
+        }
+      }
+      visitor.FlushWrappers(heap_);
+      total_bytes_marked += bytes_marked;
+      total_marked_bytes_.Increment(bytes_marked);
+      if (task_state->interrupt_request.Value()) {
+        task_state->interrupt_condition.Wait(&task_state->lock);
       }
     }
+    // The task has run out of work, so its private segments are empty.
+    task_state->marked_bytes = total_bytes_marked;
   }
   if (FLAG_trace_concurrent_marking) {
-    heap_->isolate()->PrintWithTimestamp("concurrently marked %dKB in %.2fms\n",
-                                         static_cast<int>(bytes_marked / KB),
-                                         time_ms);
+    heap_->isolate()->PrintWithTimestamp(
+        "Task %d concurrently marked %dKB in %.2fms\n", task_id,
+        static_cast<int>(total_bytes_marked / KB), time_ms);
   }
+  base::LockGuard<base::Mutex> guard(&pending_lock_);
+  is_pending_[task_id] = false;
+  --pending_task_count_;
+  pending_condition_.NotifyAll();
 }
 
-void ConcurrentMarking::StartTask() {
-  if (!FLAG_concurrent_marking) return;
-  is_task_pending_ = true;
+void ConcurrentMarking::ScheduleTask(int task_id) {
+  // Must be called with pending_lock_ held.
+  DCHECK(!is_pending_[task_id]);
+  is_pending_[task_id] = true;
+  ++pending_task_count_;
+  Task* task = new Task(heap_->isolate(), this, &task_state_[task_id], task_id);
+  cancelable_id_[task_id] = task->id();
   V8::GetCurrentPlatform()->CallOnBackgroundThread(
-      new Task(heap_->isolate(), this, &pending_task_semaphore_),
-      v8::Platform::kShortRunningTask);
+      task, v8::Platform::kShortRunningTask);
+}
+
+void ConcurrentMarking::ScheduleTasks() {
+  if (!FLAG_concurrent_marking) return;
+  deque_->FlushToGlobal(ConcurrentMarkingDeque::kMainThread);
+  base::LockGuard<base::Mutex> guard(&pending_lock_);
+  if (pending_task_count_ < kTasks) {
+    int num_tasks = Max(
+        1, Min(kTasks,
+               static_cast<int>(V8::GetCurrentPlatform()
+                                    ->NumberOfAvailableBackgroundThreads())));
+    for (int i = 1; i <= kTasks && pending_task_count_ < num_tasks; i++) {
+      if (!is_pending_[i]) ScheduleTask(i);
+    }
+  }
+}
+
+void ConcurrentMarking::RescheduleTasksIfNeeded() {
+  if (!FLAG_concurrent_marking) return;
+  {
+    base::LockGuard<base::Mutex> guard(&pending_lock_);
+    if (pending_task_count_ == kTasks) return;
+  }
+  deque_->FlushToGlobal(ConcurrentMarkingDeque::kMainThread);
+  if (deque_->HasWorkForConcurrentTasks()) {
+    ScheduleTasks();
+  }
 }
 
-void ConcurrentMarking::WaitForTaskToComplete() {
+void ConcurrentMarking::EnsureCompleted() {
   if (!FLAG_concurrent_marking) return;
-  pending_task_semaphore_.Wait();
-  is_task_pending_ = false;
+  base::LockGuard<base::Mutex> guard(&pending_lock_);
+  CancelableTaskManager* cancelable_task_manager =
+      heap_->isolate()->cancelable_task_manager();
+  for (int i = 1; i <= kTasks; i++) {
+    if (is_pending_[i]) {
+      if (cancelable_task_manager->TryAbort(cancelable_id_[i]) ==
+          CancelableTaskManager::kTaskAborted) {
+        is_pending_[i] = false;
+        --pending_task_count_;
+      }
+    }
+  }
+  while (pending_task_count_ > 0) {
+    pending_condition_.Wait(&pending_lock_);
+  }
 }
 
-void ConcurrentMarking::EnsureTaskCompleted() {
-  if (IsTaskPending()) {
-    WaitForTaskToComplete();
+bool ConcurrentMarking::IsTaskPending() {
+  if (!FLAG_concurrent_marking) return false;
+  base::LockGuard<base::Mutex> guard(&pending_lock_);
+  return pending_task_count_ > 0;
+}
+
+ConcurrentMarking::PauseScope::PauseScope(ConcurrentMarking* concurrent_marking)
+    : concurrent_marking_(concurrent_marking) {
+  if (!FLAG_concurrent_marking) return;
+  // Request interrupt for all tasks.
+  for (int i = 1; i <= kTasks; i++) {
+    concurrent_marking_->task_state_[i].interrupt_request.SetValue(true);
+  }
+  // Now take a lock to ensure that the tasks are waiting.
+  for (int i = 1; i <= kTasks; i++) {
+    concurrent_marking_->task_state_[i].lock.Lock();
+  }
+}
+
+ConcurrentMarking::PauseScope::~PauseScope() {
+  if (!FLAG_concurrent_marking) return;
+  for (int i = kTasks; i >= 1; i--) {
+    concurrent_marking_->task_state_[i].interrupt_request.SetValue(false);
+    concurrent_marking_->task_state_[i].interrupt_condition.NotifyAll();
+    concurrent_marking_->task_state_[i].lock.Unlock();
   }
 }
 
@@ -6,6 +6,9 @@
 #define V8_HEAP_CONCURRENT_MARKING_
 
 #include "src/allocation.h"
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/cancelable-task.h"
 #include "src/utils.h"
 #include "src/v8.h"
@@ -20,22 +23,66 @@ class Isolate;
 
 class ConcurrentMarking {
  public:
+  // When the scope is entered, the concurrent marking tasks
+  // are paused and are not looking at the heap objects.
+  class PauseScope {
+   public:
+    explicit PauseScope(ConcurrentMarking* concurrent_marking);
+    ~PauseScope();
+
+   private:
+    ConcurrentMarking* concurrent_marking_;
+  };
+
+  static const int kTasks = 4;
+
   ConcurrentMarking(Heap* heap, ConcurrentMarkingDeque* deque_);
-  ~ConcurrentMarking();
 
-  void StartTask();
-  void WaitForTaskToComplete();
-  bool IsTaskPending() { return is_task_pending_; }
-  void EnsureTaskCompleted();
+  // Starts concurrent marking tasks. The marking work that the main thread
+  // accumulated so far is published, so that the tasks can steal it.
+  void ScheduleTasks();
+  // Schedules new tasks for task slots whose tasks have run out of work and
+  // finished, provided that there is work that they can steal.
+  void RescheduleTasksIfNeeded();
+  // Cancels the tasks that have not started yet and waits for the running
+  // tasks to finish.
+  void EnsureCompleted();
+  bool IsTaskPending();
+
+  // Returns the number of bytes marked by all concurrent marking tasks since
+  // the creation of the concurrent marker. The result is updated
+  // periodically while the tasks are running.
+  size_t TotalMarkedBytes() { return total_marked_bytes_.Value(); }
 
  private:
+  struct TaskState {
+    // When the concurrent marking task has this lock, then objects in the
+    // heap are guaranteed to not move.
+    base::Mutex lock;
+    // The main thread sets this flag to true, when it wants the concurrent
+    // maker to give up the lock.
+    base::AtomicValue<bool> interrupt_request;
+    // The concurrent marker waits on this condition until the request
+    // flag is cleared by the main thread.
+    base::ConditionVariable interrupt_condition;
+    size_t marked_bytes;
+    char cache_line_padding[64];
+  };
   class Task;
-  void Run();
+  void Run(int task_id, TaskState* task_state);
+  void ScheduleTask(int task_id);
   Heap* heap_;
-  base::Semaphore pending_task_semaphore_;
   ConcurrentMarkingDeque* deque_;
-  ConcurrentMarkingVisitor* visitor_;
-  bool is_task_pending_;
+  // The first element is not used, so that task ids match the ids of the
+  // marking deque, where id 0 belongs to the main thread.
+  TaskState task_state_[kTasks + 1];
+  base::AtomicNumber<size_t> total_marked_bytes_;
+  base::Mutex pending_lock_;
+  base::ConditionVariable pending_condition_;
+  int pending_task_count_;
+  bool is_pending_[kTasks + 1];
+  uint32_t cancelable_id_[kTasks + 1];
+  DISALLOW_COPY_AND_ASSIGN(ConcurrentMarking);
 };
 
 }  // namespace internal
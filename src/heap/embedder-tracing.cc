@@ -13,6 +13,7 @@ void LocalEmbedderHeapTracer::TracePrologue() {
   if (!InUse()) return;
 
   CHECK(cached_wrappers_to_trace_.empty());
+  ClearConcurrentQueues();
   num_v8_marking_worklist_was_empty_ = 0;
   remote_tracer_->TracePrologue();
 }
@@ -28,6 +29,7 @@ void LocalEmbedderHeapTracer::AbortTracing() {
   if (!InUse()) return;
 
   cached_wrappers_to_trace_.clear();
+  ClearConcurrentQueues();
   remote_tracer_->AbortTracing();
 }
 
@@ -48,6 +50,7 @@ bool LocalEmbedderHeapTracer::Trace(
 size_t LocalEmbedderHeapTracer::NumberOfWrappersToTrace() {
   return (InUse())
              ? cached_wrappers_to_trace_.size() +
+                   NumberOfConcurrentlyFoundWrappersToTrace() +
                    remote_tracer_->NumberOfWrappersToTrace()
              : 0;
 }
@@ -55,6 +58,14 @@ size_t LocalEmbedderHeapTracer::NumberOfWrappersToTrace() {
 void LocalEmbedderHeapTracer::RegisterWrappersWithRemoteTracer() {
   if (!InUse()) return;
 
+  {
+    base::LockGuard<base::Mutex> guard(&concurrent_mutex_);
+    cached_wrappers_to_trace_.insert(cached_wrappers_to_trace_.end(),
+                                     concurrent_wrappers_to_trace_.begin(),
+                                     concurrent_wrappers_to_trace_.end());
+    concurrent_wrappers_to_trace_.clear();
+  }
+
   if (cached_wrappers_to_trace_.empty()) {
     return;
   }
@@ -63,6 +74,38 @@ void LocalEmbedderHeapTracer::RegisterWrappersWithRemoteTracer() {
   cached_wrappers_to_trace_.clear();
 }
 
+void LocalEmbedderHeapTracer::AddWrappersToTraceConcurrently(
+    const std::vector<WrapperInfo>& entries) {
+  base::LockGuard<base::Mutex> guard(&concurrent_mutex_);
+  concurrent_wrappers_to_trace_.insert(concurrent_wrappers_to_trace_.end(),
+                                       entries.begin(), entries.end());
+}
+
+size_t LocalEmbedderHeapTracer::NumberOfConcurrentlyFoundWrappersToTrace() {
+  base::LockGuard<base::Mutex> guard(&concurrent_mutex_);
+  return concurrent_wrappers_to_trace_.size();
+}
+
+void LocalEmbedderHeapTracer::AddExternalReferenceConcurrently(
+    Object** object) {
+  base::LockGuard<base::Mutex> guard(&concurrent_mutex_);
+  external_references_.push_back(object);
+}
+
+void LocalEmbedderHeapTracer::FlushExternalReferences(
+    std::vector<Object**>* references) {
+  base::LockGuard<base::Mutex> guard(&concurrent_mutex_);
+  references->insert(references->end(), external_references_.begin(),
+                     external_references_.end());
+  external_references_.clear();
+}
+
+void LocalEmbedderHeapTracer::ClearConcurrentQueues() {
+  base::LockGuard<base::Mutex> guard(&concurrent_mutex_);
+  concurrent_wrappers_to_trace_.clear();
+  external_references_.clear();
+}
+
 bool LocalEmbedderHeapTracer::RequiresImmediateWrapperProcessing() {
   const size_t kTooManyWrappers = 16000;
   return cached_wrappers_to_trace_.size() > kTooManyWrappers;
@@ -6,6 +6,7 @@
 #define V8_HEAP_EMBEDDER_TRACING_H_
 
 #include "include/v8.h"
+#include "src/base/platform/mutex.h"
 #include "src/flags.h"
 #include "src/globals.h"
 
@@ -13,6 +14,7 @@ namespace v8 {
 namespace internal {
 
 class Heap;
+class Object;
 
 class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
  public:
@@ -41,6 +43,19 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
   void ClearCachedWrappersToTrace() { cached_wrappers_to_trace_.clear(); }
   void RegisterWrappersWithRemoteTracer();
 
+  // Thread-safe queue of wrappers found by the concurrent marking tasks. The
+  // wrappers are handed to the remote tracer along with the cached ones in
+  // RegisterWrappersWithRemoteTracer.
+  void AddWrappersToTraceConcurrently(const std::vector<WrapperInfo>& entries);
+  size_t NumberOfConcurrentlyFoundWrappersToTrace();
+
+  // Thread-safe queue of V8 objects that the remote tracer found reachable
+  // while tracing on one of its own threads. The main thread marks them in
+  // Heap::MarkConcurrentExternalReferences.
+  void AddExternalReferenceConcurrently(Object** object);
+  // Moves the queued external references to {references}.
+  void FlushExternalReferences(std::vector<Object**>* references);
+
   // In order to avoid running out of memory we force tracing wrappers if there
   // are too many of them.
   bool RequiresImmediateWrapperProcessing();
@@ -58,9 +73,16 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
  private:
   typedef std::vector<WrapperInfo> WrapperCache;
 
+  void ClearConcurrentQueues();
+
   EmbedderHeapTracer* remote_tracer_;
   WrapperCache cached_wrappers_to_trace_;
   size_t num_v8_marking_worklist_was_empty_;
+
+  // Protects the two queues below, which are filled from background threads.
+  base::Mutex concurrent_mutex_;
+  WrapperCache concurrent_wrappers_to_trace_;
+  std::vector<Object**> external_references_;
 };
 
 }  // namespace internal
@@ -4,9 +4,13 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdarg>
+#include <limits>
 
 #include "src/counters.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/heap-inl.h"
 #include "src/isolate.h"
 
@@ -116,6 +120,10 @@ GCTracer::GCTracer(Heap* heap)
       combined_mark_compact_speed_cache_(0.0),
       start_counter_(0) {
   current_.end_time = heap_->MonotonicallyIncreasingTimeInMs();
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    cumulative_scopes_[i] = 0;
+  }
+  cumulative_incremental_marking_bytes_ = 0;
 }
 
 void GCTracer::ResetForTesting() {
@@ -139,9 +147,42 @@ void GCTracer::ResetForTesting() {
   recorded_old_generation_allocations_.Reset();
   recorded_context_disposal_times_.Reset();
   recorded_survival_ratios_.Reset();
+  for (int i = 0; i < v8::GCStatistics::kPhaseCount; i++) {
+    pause_histograms_[i].Reset();
+    recorded_pauses_[i].clear();
+  }
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    cumulative_scopes_[i] = 0;
+  }
+  cumulative_incremental_marking_bytes_ = 0;
   start_counter_ = 0;
 }
 
+// static
+double GCTracer::PauseHistogram::BucketUpperBound(int bucket) {
+  DCHECK_LE(0, bucket);
+  DCHECK_LT(bucket, kBuckets);
+  if (bucket == kBuckets - 1) return std::numeric_limits<double>::infinity();
+  // The buckets start at 1/8 ms and double in size.
+  return 0.125 * (1 << bucket);
+}
+
+void GCTracer::PauseHistogram::AddSample(double duration) {
+  int bucket = 0;
+  while (duration >= BucketUpperBound(bucket)) bucket++;
+  buckets[bucket]++;
+  count++;
+  total += duration;
+  if (duration > max) max = duration;
+}
+
+void GCTracer::PauseHistogram::Reset() {
+  for (int i = 0; i < kBuckets; i++) buckets[i] = 0;
+  count = 0;
+  total = 0;
+  max = 0;
+}
+
 void GCTracer::NotifyYoungGenerationHandling(
     YoungGenerationHandling young_generation_handling) {
   DCHECK(current_.type == Event::SCAVENGER || start_counter_ > 1);
@@ -289,6 +330,13 @@ void GCTracer::Stop(GarbageCollector collector) {
   }
 
   heap_->UpdateTotalGCTime(duration);
+  RecordPauseHistograms(duration);
+  if (FLAG_trace_gc_statistics_json) {
+    for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+      cumulative_scopes_[i] += current_.scopes[i];
+    }
+    cumulative_incremental_marking_bytes_ += current_.incremental_marking_bytes;
+  }
 
   if ((current_.type == Event::SCAVENGER ||
        current_.type == Event::MINOR_MARK_COMPACTOR) &&
@@ -301,6 +349,10 @@ void GCTracer::Stop(GarbageCollector collector) {
     Print();
   }
 
+  if (FLAG_trace_gc_parallel_jobs) {
+    PrintParallelJobs();
+  }
+
   if (FLAG_trace_gc) {
     heap_->PrintShortHeapStatistics();
   }
@@ -371,6 +423,43 @@ void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
 
+void GCTracer::RecordPauseHistograms(double duration) {
+  switch (current_.type) {
+    case Event::SCAVENGER:
+    case Event::MINOR_MARK_COMPACTOR:
+      AddPause(v8::GCStatistics::kScavenge, duration);
+      break;
+    case Event::MARK_COMPACTOR:
+    case Event::INCREMENTAL_MARK_COMPACTOR: {
+      AddPause(v8::GCStatistics::kMarkCompact, duration);
+      AddPause(v8::GCStatistics::kMarking, current_.scopes[Scope::MC_MARK]);
+      AddPause(v8::GCStatistics::kSweeping, current_.scopes[Scope::MC_SWEEP]);
+      AddPause(v8::GCStatistics::kEvacuation,
+               current_.scopes[Scope::MC_EVACUATE]);
+      AddPause(v8::GCStatistics::kPointerUpdate,
+               current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS]);
+      const double embedder_tracing =
+          current_.scopes[Scope::MC_MARK_WRAPPER_PROLOGUE] +
+          current_.scopes[Scope::MC_MARK_WRAPPER_TRACING] +
+          current_.scopes[Scope::MC_MARK_WRAPPER_EPILOGUE];
+      // Only collections that traced wrappers count here.
+      if (embedder_tracing > 0) {
+        AddPause(v8::GCStatistics::kEmbedderTracing, embedder_tracing);
+      }
+      break;
+    }
+    case Event::START:
+      UNREACHABLE();
+  }
+}
+
+void GCTracer::AddPause(v8::GCStatistics::Phase phase, double duration) {
+  pause_histograms_[phase].AddSample(duration);
+  if (FLAG_trace_gc_statistics_json) {
+    recorded_pauses_[phase].push_back(duration);
+  }
+}
+
 void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
   if (bytes > 0) {
     incremental_marking_bytes_ += bytes;
@@ -378,6 +467,25 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
   }
 }
 
+void GCTracer::AddParallelJob(Scope::ScopeId scope,
+                              const ItemParallelJob::Stats& stats) {
+  DCHECK(scope < Scope::NUMBER_OF_SCOPES);
+  current_.parallel_jobs[scope].Update(stats);
+}
+
+void GCTracer::PrintParallelJobs() const {
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    const ParallelJobInfos& infos = current_.parallel_jobs[i];
+    if (infos.jobs == 0) continue;
+    heap_->isolate()->PrintWithTimestamp(
+        "Parallel jobs in %s: jobs=%d tasks=%d items=%zu stolen=%zu "
+        "longest_task=%.2f total_task_time=%.2f imbalance=%.2f\n",
+        Scope::Name(static_cast<Scope::ScopeId>(i)), infos.jobs, infos.tasks,
+        infos.items, infos.stolen_items, infos.longest_task,
+        infos.total_task_time, infos.Imbalance());
+  }
+}
+
 void GCTracer::Output(const char* format, ...) const {
   if (FLAG_trace_gc) {
     va_list arguments;
@@ -433,6 +541,83 @@ void GCTracer::Print() const {
 }
 
 
+namespace {
+
+const char* PhaseName(v8::GCStatistics::Phase phase) {
+  switch (phase) {
+    case v8::GCStatistics::kScavenge:
+      return "scavenge";
+    case v8::GCStatistics::kMarkCompact:
+      return "mark_compact";
+    case v8::GCStatistics::kMarking:
+      return "marking";
+    case v8::GCStatistics::kSweeping:
+      return "sweeping";
+    case v8::GCStatistics::kEvacuation:
+      return "evacuation";
+    case v8::GCStatistics::kPointerUpdate:
+      return "pointer_update";
+    case v8::GCStatistics::kEmbedderTracing:
+      return "embedder_tracing";
+    case v8::GCStatistics::kIncrementalMarking:
+      return "incremental_marking";
+    case v8::GCStatistics::kPhaseCount:
+      break;
+  }
+  UNREACHABLE();
+}
+
+// Returns the nearest-rank percentile of the sorted samples.
+double Percentile(const std::vector<double>& sorted, double percentile) {
+  if (sorted.empty()) return 0;
+  size_t rank = static_cast<size_t>(std::ceil(percentile * sorted.size()));
+  return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+}  // namespace
+
+void GCTracer::PrintStatisticsJSON() const {
+  PrintF("{\n  \"phases\": {\n");
+  for (int i = 0; i < v8::GCStatistics::kPhaseCount; i++) {
+    std::vector<double> sorted(recorded_pauses_[i]);
+    std::sort(sorted.begin(), sorted.end());
+    const PauseHistogram& histogram = pause_histograms_[i];
+    PrintF(
+        "    \"%s\": {\"count\": %zu, \"total_ms\": %.3f, \"p50_ms\": %.3f, "
+        "\"p90_ms\": %.3f, \"p99_ms\": %.3f, \"max_ms\": %.3f}%s\n",
+        PhaseName(static_cast<v8::GCStatistics::Phase>(i)), histogram.count,
+        histogram.total, Percentile(sorted, 0.5), Percentile(sorted, 0.9),
+        Percentile(sorted, 0.99), histogram.max,
+        i + 1 < v8::GCStatistics::kPhaseCount ? "," : "");
+  }
+  PrintF("  },\n  \"scopes_ms\": {");
+  const char* separator = "\n";
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    if (cumulative_scopes_[i] == 0) continue;
+    // Strip the "V8.GC_" prefix of the trace event names.
+    PrintF("%s    \"%s\": %.3f", separator,
+           Scope::Name(static_cast<Scope::ScopeId>(i)) + 6,
+           cumulative_scopes_[i]);
+    separator = ",\n";
+  }
+  size_t concurrent_bytes = heap_->concurrent_marking()->TotalMarkedBytes();
+  size_t total_bytes = concurrent_bytes + cumulative_incremental_marking_bytes_;
+  PrintF(
+      "\n  },\n  \"marking\": {\"main_thread_bytes\": %zu, "
+      "\"concurrent_bytes\": %zu, \"concurrent_ratio\": %.3f},\n",
+      cumulative_incremental_marking_bytes_, concurrent_bytes,
+      total_bytes == 0 ? 0.0
+                        : static_cast<double>(concurrent_bytes) / total_bytes);
+  PrintF(
+      "  \"speeds_bytes_per_ms\": {\"scavenge\": %.0f, \"mark_compact\": "
+      "%.0f, \"incremental_marking\": %.0f},\n",
+      ScavengeSpeedInBytesPerMillisecond(),
+      MarkCompactSpeedInBytesPerMillisecond(),
+      IncrementalMarkingSpeedInBytesPerMillisecond());
+  PrintF("  \"max_committed_bytes\": %zu\n}\n",
+         heap_->MaximumCommittedMemory());
+}
+
 void GCTracer::PrintNVP() const {
   double duration = current_.end_time - current_.start_time;
   double spent_in_mutator = current_.start_time - previous_.end_time;
@@ -462,6 +647,7 @@ void GCTracer::PrintNVP() const {
           "scavenge=%.2f "
           "evacuate=%.2f "
           "old_new=%.2f "
+          "parallel=%.2f "
           "weak=%.2f "
           "roots=%.2f "
           "semispace=%.2f "
@@ -501,6 +687,7 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::SCAVENGER_SCAVENGE],
           current_.scopes[Scope::SCAVENGER_EVACUATE],
           current_.scopes[Scope::SCAVENGER_OLD_TO_NEW_POINTERS],
+          current_.scopes[Scope::SCAVENGER_PARALLEL],
           current_.scopes[Scope::SCAVENGER_WEAK],
           current_.scopes[Scope::SCAVENGER_ROOTS],
           current_.scopes[Scope::SCAVENGER_SEMISPACE],
@@ -584,6 +771,7 @@ void GCTracer::PrintNVP() const {
           "clear.weak_cells=%.1f "
           "clear.weak_collections=%.1f "
           "clear.weak_lists=%.1f "
+          "clear.weak_tables=%.1f "
           "epilogue=%.1f "
           "evacuate=%.1f "
           "evacuate.candidates=%.1f "
@@ -668,6 +856,7 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::MC_CLEAR_WEAK_CELLS],
           current_.scopes[Scope::MC_CLEAR_WEAK_COLLECTIONS],
           current_.scopes[Scope::MC_CLEAR_WEAK_LISTS],
+          current_.scopes[Scope::MC_CLEAR_WEAK_TABLES],
           current_.scopes[Scope::MC_EPILOGUE],
           current_.scopes[Scope::MC_EVACUATE],
           current_.scopes[Scope::MC_EVACUATE_CANDIDATES],
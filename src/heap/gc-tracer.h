@@ -5,12 +5,15 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <vector>
+
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/platform.h"
 #include "src/base/ring-buffer.h"
 #include "src/counters.h"
 #include "src/globals.h"
 #include "src/heap/heap.h"
+#include "src/heap/item-parallel-job.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
@@ -52,6 +55,8 @@ enum ScavengeSpeedMode { kForAllObjects, kForSurvivedObjects };
   F(MC_CLEAR_WEAK_CELLS)                            \
   F(MC_CLEAR_WEAK_COLLECTIONS)                      \
   F(MC_CLEAR_WEAK_LISTS)                            \
+  F(MC_CLEAR_WEAK_TABLES)                           \
+  F(MC_DEDUPLICATE_STRINGS)                         \
   F(MC_EPILOGUE)                                    \
   F(MC_EVACUATE)                                    \
   F(MC_EVACUATE_CANDIDATES)                         \
@@ -105,6 +110,7 @@ enum ScavengeSpeedMode { kForAllObjects, kForSurvivedObjects };
   F(MINOR_MC_SWEEPING)                              \
   F(SCAVENGER_EVACUATE)                             \
   F(SCAVENGER_OLD_TO_NEW_POINTERS)                  \
+  F(SCAVENGER_PARALLEL)                             \
   F(SCAVENGER_ROOTS)                                \
   F(SCAVENGER_SCAVENGE)                             \
   F(SCAVENGER_SEMISPACE)                            \
@@ -142,6 +148,58 @@ class V8_EXPORT_PRIVATE GCTracer {
     int steps;
   };
 
+  // Pause times of one phase over the lifetime of the heap, see
+  // v8::GCPauseHistogram for the bucket layout.
+  struct PauseHistogram {
+    static const int kBuckets = v8::GCPauseHistogram::kBucketCount;
+
+    PauseHistogram() { Reset(); }
+
+    static double BucketUpperBound(int bucket);
+    void AddSample(double duration);
+    void Reset();
+
+    size_t buckets[kBuckets];
+    size_t count;
+    double total;
+    double max;
+  };
+
+  // Accumulated load balancing statistics of the parallel jobs that ran in a
+  // scope during one GC.
+  struct ParallelJobInfos {
+    ParallelJobInfos()
+        : jobs(0),
+          tasks(0),
+          items(0),
+          stolen_items(0),
+          longest_task(0),
+          total_task_time(0) {}
+
+    void Update(const ItemParallelJob::Stats& stats) {
+      jobs++;
+      tasks += stats.tasks;
+      items += stats.items;
+      stolen_items += stats.stolen_items;
+      longest_task = Max(longest_task, stats.longest_task_ms);
+      total_task_time += stats.total_task_ms;
+    }
+
+    // Returns the ratio of the longest task to the average task. The result
+    // is 1 for perfectly balanced jobs and grows with the imbalance.
+    double Imbalance() const {
+      if (tasks == 0 || total_task_time == 0) return 1;
+      return longest_task / (total_task_time / tasks);
+    }
+
+    int jobs;
+    int tasks;
+    size_t items;
+    size_t stolen_items;
+    double longest_task;
+    double total_task_time;
+  };
+
   class Scope {
    public:
     enum ScopeId {
@@ -239,6 +297,9 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Holds details for incremental marking scopes.
     IncrementalMarkingInfos
         incremental_marking_scopes[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
+
+    // Holds load balancing details of parallel jobs per scope.
+    ParallelJobInfos parallel_jobs[Scope::NUMBER_OF_SCOPES];
   };
 
   static const int kThroughputTimeFrameMs = 5000;
@@ -271,6 +332,17 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
 
+  // Log the load balancing statistics of a parallel job that ran in the
+  // given scope.
+  void AddParallelJob(Scope::ScopeId scope,
+                      const ItemParallelJob::Stats& stats);
+
+  // Returns the accumulated statistics of parallel jobs for the given scope
+  // in the current GC.
+  const ParallelJobInfos& parallel_jobs(Scope::ScopeId scope) const {
+    return current_.parallel_jobs[scope];
+  }
+
   // Compute the average incremental marking speed in bytes/millisecond.
   // Returns 0 if no events have been recorded.
   double IncrementalMarkingSpeedInBytesPerMillisecond() const;
@@ -342,12 +414,22 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void NotifyIncrementalMarkingStart();
 
+  const PauseHistogram& pause_histogram(v8::GCStatistics::Phase phase) const {
+    return pause_histograms_[phase];
+  }
+
+  // Prints the statistics recorded for --trace-gc-statistics-json.
+  void PrintStatisticsJSON() const;
+
   V8_INLINE void AddScopeSample(Scope::ScopeId scope, double duration) {
     DCHECK(scope < Scope::NUMBER_OF_SCOPES);
     if (scope >= Scope::FIRST_INCREMENTAL_SCOPE &&
         scope <= Scope::LAST_INCREMENTAL_SCOPE) {
       incremental_marking_scopes_[scope - Scope::FIRST_INCREMENTAL_SCOPE]
           .Update(duration);
+      if (scope == Scope::MC_INCREMENTAL) {
+        AddPause(v8::GCStatistics::kIncrementalMarking, duration);
+      }
     } else {
       current_.scopes[scope] += duration;
     }
@@ -363,6 +445,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, IncrementalMarkingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
+  FRIEND_TEST(GCTracerTest, ParallelJobs);
+  FRIEND_TEST(GCTracerTest, PauseHistograms);
+  FRIEND_TEST(GCTracerTest, StatisticsJSON);
 
   // Returns the average speed of the events in the buffer.
   // If the buffer is empty, the result is 0.
@@ -374,10 +459,15 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ResetForTesting();
   void ResetIncrementalMarkingCounters();
   void RecordIncrementalMarkingSpeed(size_t bytes, double duration);
+  // Adds the pause of the event that just stopped to the pause histograms.
+  void RecordPauseHistograms(double duration);
+  void AddPause(v8::GCStatistics::Phase phase, double duration);
 
   // Print one detailed trace line in name=value format.
   // TODO(ernstm): Move to Heap.
   void PrintNVP() const;
+  // Prints the load balancing statistics of parallel jobs.
+  void PrintParallelJobs() const;
 
   // Print one trace line.
   // TODO(ernstm): Move to Heap.
@@ -422,6 +512,14 @@ class V8_EXPORT_PRIVATE GCTracer {
   IncrementalMarkingInfos
       incremental_marking_scopes_[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
 
+  PauseHistogram pause_histograms_[v8::GCStatistics::kPhaseCount];
+
+  // Only recorded with --trace-gc-statistics-json: every single pause, so
+  // that exact percentiles can be computed, and the time spent in each scope
+  // and the bytes marked on the main thread over all GCs.
+  std::vector<double> recorded_pauses_[v8::GCStatistics::kPhaseCount];
+  double cumulative_scopes_[Scope::NUMBER_OF_SCOPES];
+  size_t cumulative_incremental_marking_bytes_;
 
   // Timestamp and allocation counter at the last sampled allocation event.
   double allocation_time_ms_;
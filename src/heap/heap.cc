@@ -12,6 +12,7 @@
 #include "src/assembler-inl.h"
 #include "src/ast/context-slot-cache.h"
 #include "src/base/bits.h"
+#include "src/base/functional.h"
 #include "src/base/once.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/bootstrapper.h"
@@ -23,6 +24,7 @@
 #include "src/deoptimizer.h"
 #include "src/feedback-vector.h"
 #include "src/global-handles.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/code-stats.h"
 #include "src/heap/concurrent-marking.h"
@@ -30,12 +32,14 @@
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/item-parallel-job.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
+#include "src/heap/pretenuring-decisions.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/scavenge-job.h"
 #include "src/heap/scavenger-inl.h"
@@ -49,6 +53,7 @@
 #include "src/snapshot/serializer-common.h"
 #include "src/snapshot/snapshot.h"
 #include "src/tracing/trace-event.h"
+#include "src/utils-inl.h"
 #include "src/utils.h"
 #include "src/v8.h"
 #include "src/v8threads.h"
@@ -72,6 +77,8 @@ class IdleScavengeObserver : public AllocationObserver {
     heap_.ScheduleIdleScavengeIfNeeded(bytes_allocated);
   }
 
+  bool AllowsDelayedSteps() const override { return true; }
+
  private:
   Heap& heap_;
 };
@@ -135,6 +142,7 @@ Heap::Heap()
       last_idle_notification_time_(0.0),
       last_gc_time_(0.0),
       scavenge_collector_(nullptr),
+      parallel_scavenge_semaphore_(0),
       mark_compact_collector_(nullptr),
       minor_mark_compact_collector_(nullptr),
       memory_allocator_(nullptr),
@@ -146,6 +154,8 @@ Heap::Heap()
       live_object_stats_(nullptr),
       dead_object_stats_(nullptr),
       scavenge_job_(nullptr),
+      pretenuring_decisions_(nullptr),
+      array_buffer_collector_(nullptr),
       idle_scavenge_observer_(nullptr),
       new_space_allocation_counter_(0),
       old_generation_allocation_counter_at_last_gc_(0),
@@ -292,7 +302,22 @@ GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
 
   // Default
   *reason = NULL;
-  return YoungGenerationCollector();
+  return SelectYoungGenerationCollector();
+}
+
+GarbageCollector Heap::SelectYoungGenerationCollector() {
+  if (!FLAG_minor_mc || FLAG_minor_mc_survival_rate_threshold == 0) {
+    return YoungGenerationCollector();
+  }
+  // The scavenger copies every surviving object, whereas the minor mark
+  // compactor only marks them and can move whole pages. Prefer the latter
+  // once most of the young generation is expected to survive.
+  if (tracer()->SurvivalEventsRecorded() &&
+      tracer()->AverageSurvivalRatio() >=
+          FLAG_minor_mc_survival_rate_threshold) {
+    return MINOR_MARK_COMPACTOR;
+  }
+  return SCAVENGER;
 }
 
 void Heap::SetGCState(HeapState state) {
@@ -1043,6 +1068,14 @@ bool Heap::CollectGarbage(AllocationSpace space,
       event.committed_memory = committed_memory_after;
       if (deserialization_complete_) {
         memory_reducer_->NotifyMarkCompact(event);
+        if (gc_reason != GarbageCollectionReason::kMemoryReducer &&
+            memory_reducer_->IsNearMemoryTarget()) {
+          // Let the memory reducer follow up with memory reducing GCs.
+          MemoryReducer::Event possible_garbage;
+          possible_garbage.type = MemoryReducer::kPossibleGarbage;
+          possible_garbage.time_ms = event.time_ms;
+          memory_reducer_->NotifyPossibleGarbage(possible_garbage);
+        }
       }
       memory_pressure_level_.SetValue(MemoryPressureLevel::kNone);
     }
@@ -1417,6 +1450,16 @@ bool Heap::PerformGarbageCollection(
     // Register the amount of external allocated memory.
     external_memory_at_last_mark_compact_ = external_memory_;
     external_memory_limit_ = external_memory_ + kExternalAllocationSoftLimit;
+    memory_reducer_->SampleResidentSetSize();
+    size_t external_memory_budget = memory_reducer_->ExternalMemoryBudget();
+    if (external_memory_budget > 0) {
+      // Leave some slack above the current external memory so that a budget
+      // that is already exhausted does not trigger back-to-back GCs.
+      external_memory_limit_ = Min<int64_t>(
+          external_memory_limit_,
+          Max<int64_t>(static_cast<int64_t>(external_memory_budget),
+                       external_memory_ + kExternalAllocationSoftLimit / 16));
+    }
     SetOldGenerationAllocationLimit(old_gen_size, gc_speed, mutator_speed);
   } else if (HasLowYoungGenerationAllocationRate() &&
              old_generation_size_configured_) {
@@ -1544,6 +1587,7 @@ void Heap::MarkCompactPrologue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_PROLOGUE);
   isolate_->context_slot_cache()->Clear();
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->transition_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
 
@@ -1555,7 +1599,14 @@ void Heap::MarkCompactPrologue() {
 
 
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (FLAG_experimental_new_space_growth_heuristic) {
+  if (FLAG_scavenge_target_interval_ms > 0) {
+    // Shrinking happens after the scavenge in ReduceNewSpaceSize.
+    size_t target_capacity = ComputeNewSpaceTargetCapacity();
+    if (target_capacity > new_space_->TotalCapacity()) {
+      new_space_->ResizeTowards(target_capacity);
+      survived_since_last_expansion_ = 0;
+    }
+  } else if (FLAG_experimental_new_space_growth_heuristic) {
     if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
         survived_last_scavenge_ * 100 / new_space_->TotalCapacity() >= 10) {
       // Grow the size of new space if there is room to grow, and more than 10%
@@ -1644,6 +1695,7 @@ class ScavengeWeakObjectRetainer : public WeakObjectRetainer {
 void Heap::EvacuateYoungGeneration() {
   TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_EVACUATE);
   base::LockGuard<base::Mutex> guard(relocation_mutex());
+  ConcurrentMarking::PauseScope pause_scope(concurrent_marking());
   if (!FLAG_concurrent_marking) {
     DCHECK(fast_promotion_mode_);
     DCHECK(CanExpandOldGeneration(new_space()->Size()));
@@ -1686,6 +1738,7 @@ void Heap::EvacuateYoungGeneration() {
 void Heap::Scavenge() {
   TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE);
   base::LockGuard<base::Mutex> guard(relocation_mutex());
+  ConcurrentMarking::PauseScope pause_scope(concurrent_marking());
   // There are soft limits in the allocation code, designed to trigger a mark
   // sweep collection by failing allocations. There is no sense in trying to
   // trigger one during scavenge: scavenges allocation should always succeed.
@@ -1699,6 +1752,11 @@ void Heap::Scavenge() {
       incremental_marking());
 
   mark_compact_collector()->sweeper().EnsureNewSpaceCompleted();
+  if (FLAG_minor_mc) {
+    // Pages kept in new space by an earlier minor mark compact are iterable
+    // now; drop their young generation mark bits like a full GC does.
+    minor_mark_compact_collector()->CleanupSweepToIteratePages();
+  }
 
   SetGCState(SCAVENGE);
 
@@ -1740,32 +1798,41 @@ void Heap::Scavenge() {
   isolate()->global_handles()->IdentifyWeakUnmodifiedObjects(
       &JSObject::IsUnmodifiedApiObject);
 
-  {
-    // Copy roots.
-    TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_ROOTS);
-    IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
-  }
-
-  {
-    // Copy objects reachable from the old generation.
-    TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
-    RememberedSet<OLD_TO_NEW>::Iterate(
-        this, SYNCHRONIZED, [this](Address addr) {
-          return Scavenger::CheckAndScavengeObject(this, addr);
-        });
+  if (FLAG_parallel_scavenge && scavenge_collector_->CanScavengeInParallel()) {
+    ScavengeInParallel();
+    // All objects copied so far have been processed by the parallel tasks.
+    // Continue with Cheney's algorithm from the current top.
+    new_space_front = new_space_->top();
+    promotion_queue_.SetNewLimit(new_space_front);
+  } else {
+    {
+      // Copy roots.
+      TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_ROOTS);
+      IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
+    }
 
-    RememberedSet<OLD_TO_NEW>::IterateTyped(
-        this, SYNCHRONIZED,
-        [this](SlotType type, Address host_addr, Address addr) {
-          return UpdateTypedSlotHelper::UpdateTypedSlot(
-              isolate(), type, addr, [this](Object** addr) {
-                // We expect that objects referenced by code are long living.
-                // If we do not force promotion, then we need to clear
-                // old_to_new slots in dead code objects after mark-compact.
-                return Scavenger::CheckAndScavengeObject(
-                    this, reinterpret_cast<Address>(addr));
-              });
-        });
+    {
+      // Copy objects reachable from the old generation.
+      TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
+      RememberedSet<OLD_TO_NEW>::Iterate(
+          this, SYNCHRONIZED, [this](Address addr) {
+            return Scavenger::CheckAndScavengeObject(this, addr);
+          });
+
+      RememberedSet<OLD_TO_NEW>::IterateTyped(
+          this, SYNCHRONIZED,
+          [this](SlotType type, Address host_addr, Address addr) {
+            return UpdateTypedSlotHelper::UpdateTypedSlot(
+                isolate(), type, addr, [this](Object** addr) {
+                  // We expect that objects referenced by code are long
+                  // living. If we do not force promotion, then we need to
+                  // clear old_to_new slots in dead code objects after
+                  // mark-compact.
+                  return Scavenger::CheckAndScavengeObject(
+                      this, reinterpret_cast<Address>(addr));
+                });
+          });
+    }
   }
 
   {
@@ -1801,6 +1868,7 @@ void Heap::Scavenge() {
   new_space_->set_age_mark(new_space_->top());
 
   ArrayBufferTracker::FreeDeadInNewSpace(this);
+  array_buffer_collector()->FreeAllocationsOnBackgroundThread();
 
   // Update how much has survived scavenge.
   DCHECK_GE(PromotedSpaceSizeOfObjects(), survived_watermark);
@@ -1991,6 +2059,126 @@ void Heap::VisitExternalResources(v8::ExternalResourceVisitor* visitor) {
   external_string_table_.IterateAll(&external_string_table_visitor);
 }
 
+class PageScavengingItem final : public ItemParallelJob::Item {
+ public:
+  explicit PageScavengingItem(MemoryChunk* chunk) : chunk_(chunk) {}
+  virtual ~PageScavengingItem() {}
+
+  void Process(ParallelScavenger* scavenger) {
+    base::LockGuard<base::RecursiveMutex> guard(chunk_->mutex());
+    RememberedSet<OLD_TO_NEW>::Iterate(
+        chunk_, [scavenger](Address slot) {
+          return scavenger->CheckAndScavengeObject(slot);
+        });
+    RememberedSet<OLD_TO_NEW>::IterateTyped(
+        chunk_,
+        [this, scavenger](SlotType type, Address host_addr, Address slot) {
+          return UpdateTypedSlotHelper::UpdateTypedSlot(
+              chunk_->heap()->isolate(), type, slot,
+              [scavenger](Object** slot) {
+                return scavenger->CheckAndScavengeObject(
+                    reinterpret_cast<Address>(slot));
+              });
+        });
+  }
+
+ private:
+  MemoryChunk* const chunk_;
+};
+
+class ScavengingTask final : public ItemParallelJob::Task {
+ public:
+  ScavengingTask(Heap* heap, ParallelScavenger* scavenger)
+      : ItemParallelJob::Task(heap->isolate()),
+        heap_(heap),
+        scavenger_(scavenger) {}
+
+  void RunInParallel() final {
+    double scavenging_time = 0.0;
+    {
+      TimedScope scope(&scavenging_time);
+      PageScavengingItem* item = nullptr;
+      while ((item = GetItem<PageScavengingItem>()) != nullptr) {
+        item->Process(scavenger_);
+        item->MarkFinished();
+        // Page locks are not held while processing objects, so copied
+        // objects are never visited while another page is locked.
+        scavenger_->Process();
+      }
+      scavenger_->Process();
+    }
+    if (FLAG_trace_parallel_scavenge) {
+      PrintIsolate(heap_->isolate(),
+                   "scavenge[%p]: time=%.2f copied=%" V8PRIdPTR
+                   " promoted=%" V8PRIdPTR "\n",
+                   static_cast<void*>(this), scavenging_time,
+                   scavenger_->semispace_copied_size(),
+                   scavenger_->promoted_size());
+    }
+  }
+
+ private:
+  Heap* const heap_;
+  ParallelScavenger* const scavenger_;
+};
+
+int Heap::NumberOfScavengeTasks() {
+  if (!FLAG_parallel_scavenge) return 1;
+  const int num_scavenge_tasks =
+      static_cast<int>(new_space()->TotalCapacity()) / MB;
+  return Max(
+      1,
+      Min(Min(num_scavenge_tasks, Worklist::kMaxNumTasks),
+          static_cast<int>(
+              V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads())));
+}
+
+void Heap::ScavengeInParallel() {
+  Worklist copied_list;
+  Worklist promotion_list;
+  const int num_tasks = NumberOfScavengeTasks();
+  ParallelScavenger* scavengers[Worklist::kMaxNumTasks];
+  for (int i = 0; i < num_tasks; i++) {
+    scavengers[i] =
+        new ParallelScavenger(this, &copied_list, &promotion_list, i);
+  }
+
+  {
+    ItemParallelJob job(isolate()->cancelable_task_manager(),
+                        &parallel_scavenge_semaphore_);
+    RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+        this, [&job](MemoryChunk* chunk) {
+          job.AddItem(new PageScavengingItem(chunk));
+        });
+
+    {
+      // Copy roots on the main thread as root slots may reside on the native
+      // stack. The copied objects are then published for all tasks.
+      TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_ROOTS);
+      RootParallelScavengeVisitor root_scavenge_visitor(scavengers[0]);
+      IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
+      scavengers[0]->FlushWorklists();
+    }
+
+    {
+      TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_PARALLEL);
+      for (int i = 0; i < num_tasks; i++) {
+        job.AddTask(new ScavengingTask(this, scavengers[i]));
+      }
+      job.Run();
+      DCHECK(copied_list.IsGlobalEmpty());
+      DCHECK(promotion_list.IsGlobalEmpty());
+      tracer()->AddParallelJob(GCTracer::Scope::SCAVENGER_PARALLEL,
+                               job.stats());
+    }
+  }
+
+  for (int i = 0; i < num_tasks; i++) {
+    scavengers[i]->Finalize();
+    delete scavengers[i];
+  }
+}
+
 Address Heap::DoScavenge(Address new_space_front) {
   ScavengeVisitor scavenge_visitor(this);
   do {
@@ -2873,6 +3061,10 @@ void Heap::CreateInitialObjects() {
   cell->set_value(Smi::FromInt(Isolate::kProtectorValid));
   set_array_buffer_neutering_protector(*cell);
 
+  cell = factory->NewPropertyCell();
+  cell->set_value(Smi::FromInt(Isolate::kProtectorValid));
+  set_console_delegate_protector(*cell);
+
   set_serialized_templates(empty_fixed_array());
   set_serialized_global_proxy_sizes(empty_fixed_array());
 
@@ -2880,12 +3072,17 @@ void Heap::CreateInitialObjects() {
 
   set_noscript_shared_function_infos(Smi::kZero);
 
+  set_context_independent_code_list(Smi::kZero);
+
   // Initialize context slot cache.
   isolate_->context_slot_cache()->Clear();
 
   // Initialize descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
 
+  // Initialize transition cache.
+  isolate_->transition_lookup_cache()->Clear();
+
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
 
@@ -2939,6 +3136,7 @@ bool Heap::RootCanBeWrittenAfterInitialization(Heap::RootListIndex root_index) {
     case kRetainedMapsRootIndex:
     case kCodeCoverageListRootIndex:
     case kNoScriptSharedFunctionInfosRootIndex:
+    case kContextIndependentCodeListRootIndex:
     case kWeakStackTraceListRootIndex:
     case kSerializedTemplatesRootIndex:
     case kSerializedGlobalProxySizesRootIndex:
@@ -2964,13 +3162,21 @@ bool Heap::RootCanBeTreatedAsConstant(RootListIndex root_index) {
 }
 
 int Heap::FullSizeNumberStringCacheLength() {
-  // Compute the size of the number string cache based on the max newspace size.
-  // The number string cache has a minimum size based on twice the initial cache
-  // size to ensure that it is bigger after being made 'full size'.
-  size_t number_string_cache_size = max_semi_space_size_ / 512;
+  // Compute the size of the number string cache based on the max newspace size,
+  // unless it is given by --number-string-cache-size. The number string cache
+  // has a minimum size based on twice the initial cache size to ensure that it
+  // is bigger after being made 'full size'.
+  size_t number_string_cache_size;
+  if (FLAG_number_string_cache_size > 0) {
+    number_string_cache_size = base::bits::RoundUpToPowerOfTwo32(
+        Min(FLAG_number_string_cache_size, FixedArray::kMaxLength / 4));
+  } else {
+    number_string_cache_size = Min<size_t>(kMaxNumberStringCacheSize,
+                                           max_semi_space_size_ / 512);
+  }
   number_string_cache_size =
       Max(static_cast<size_t>(kInitialNumberStringCacheSize * 2),
-          Min<size_t>(0x4000u, number_string_cache_size));
+          number_string_cache_size);
   // There is a string and a number per entry so the length is twice the number
   // of entries.
   return static_cast<int>(number_string_cache_size * 2);
@@ -3121,7 +3327,8 @@ AllocationResult Heap::AllocateBytecodeArray(int length,
   instance->set_length(length);
   instance->set_frame_size(frame_size);
   instance->set_parameter_count(parameter_count);
-  instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
+  instance->set_interrupt_budget(
+      interpreter::Interpreter::InitialInterruptBudget());
   instance->set_osr_loop_nesting_level(0);
   instance->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
   instance->set_constant_pool(constant_pool);
@@ -4241,7 +4448,32 @@ void Heap::ReduceNewSpaceSize() {
        (allocation_throughput < kLowAllocationThroughput))) {
     new_space_->Shrink();
     UncommitFromSpace();
+    return;
   }
+
+  if (FLAG_scavenge_target_interval_ms > 0) {
+    // The unused semispace is kept committed and released when idle.
+    size_t target_capacity = ComputeNewSpaceTargetCapacity();
+    if (target_capacity != 0 &&
+        target_capacity < new_space_->TotalCapacity()) {
+      new_space_->ResizeTowards(target_capacity);
+    }
+  }
+}
+
+size_t Heap::ComputeNewSpaceTargetCapacity() {
+  const double allocation_throughput =
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond();
+  const double scavenge_speed = tracer()->ScavengeSpeedInBytesPerMillisecond(
+      kForAllObjects);
+  if (allocation_throughput == 0 || scavenge_speed == 0) return 0;
+  // A scavenge processes the whole new space, so its pause grows with the
+  // capacity at the measured scavenge speed.
+  double capacity =
+      Min(allocation_throughput * FLAG_scavenge_target_interval_ms,
+          scavenge_speed * FLAG_scavenge_target_pause_ms);
+  return static_cast<size_t>(
+      Min(capacity, static_cast<double>(new_space_->MaximumCapacity())));
 }
 
 void Heap::FinalizeIncrementalMarkingIfComplete(
@@ -4375,6 +4607,9 @@ bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
   bool result = false;
   switch (action.type) {
     case DONE:
+      // The from-space is only needed during a scavenge. Release it while
+      // there is nothing to do; the next scavenge commits it again.
+      if (FLAG_scavenge_target_interval_ms > 0) UncommitFromSpace();
       result = true;
       break;
     case DO_INCREMENTAL_STEP: {
@@ -4542,6 +4777,16 @@ void Heap::CheckMemoryPressure() {
   }
 }
 
+void Heap::SetMemoryTarget(v8::MemoryTarget* target) {
+  memory_reducer_->SetMemoryTarget(target);
+  if (memory_reducer_->IsNearMemoryTarget()) {
+    MemoryReducer::Event event;
+    event.type = MemoryReducer::kPossibleGarbage;
+    event.time_ms = MonotonicallyIncreasingTimeInMs();
+    memory_reducer_->NotifyPossibleGarbage(event);
+  }
+}
+
 void Heap::CollectGarbageOnMemoryPressure() {
   const int kGarbageThresholdInBytes = 8 * MB;
   const double kGarbageThresholdAsFractionOfTotalMemory = 0.1;
@@ -4815,7 +5060,45 @@ bool Heap::RootIsImmortalImmovable(int root_index) {
   }
 }
 
+bool Heap::RootIsReadOnly(int root_index) {
+  switch (root_index) {
+#define READ_ONLY_ROOT(name) case Heap::k##name##RootIndex:
+    READ_ONLY_ROOT_LIST(READ_ONLY_ROOT)
+#undef READ_ONLY_ROOT
+#define INTERNALIZED_STRING(name, value) case Heap::k##name##RootIndex:
+    INTERNALIZED_STRING_LIST(INTERNALIZED_STRING)
+#undef INTERNALIZED_STRING
+    return true;
+    default:
+      return false;
+  }
+}
+
 #ifdef VERIFY_HEAP
+namespace {
+
+size_t ReadOnlyRootsChecksum(Heap* heap) {
+  size_t checksum = 0;
+  for (int i = 0; i < Heap::kStrongRootListLength; i++) {
+    if (!Heap::RootIsReadOnly(i)) continue;
+    HeapObject* object =
+        HeapObject::cast(heap->root(static_cast<Heap::RootListIndex>(i)));
+    const uintptr_t* start = reinterpret_cast<uintptr_t*>(object->address());
+    const uintptr_t* end = start + object->Size() / kPointerSize;
+    for (const uintptr_t* word = start; word < end; word++) {
+      checksum = base::hash_combine(checksum, *word);
+    }
+  }
+  return checksum;
+}
+
+}  // namespace
+
+void Heap::VerifyReadOnlyRoots() {
+  if (!deserialization_complete_) return;
+  CHECK_EQ(read_only_roots_checksum_, ReadOnlyRootsChecksum(this));
+}
+
 void Heap::Verify() {
   CHECK(HasBeenSetUp());
   HandleScope scope(isolate());
@@ -4843,6 +5126,8 @@ void Heap::Verify() {
   if (FLAG_omit_map_checks_for_leaf_maps) {
     mark_compact_collector()->VerifyOmittedMapChecks();
   }
+
+  VerifyReadOnlyRoots();
 }
 
 class SlotVerifyingVisitor : public ObjectVisitor {
@@ -5534,8 +5819,9 @@ void Heap::SetOldGenerationAllocationLimit(size_t old_gen_size, double gc_speed,
         mutator_speed);
   }
 
+  bool near_memory_target = memory_reducer_->IsNearMemoryTarget();
   if (memory_reducer_->ShouldGrowHeapSlowly() ||
-      ShouldOptimizeForMemoryUsage()) {
+      ShouldOptimizeForMemoryUsage() || near_memory_target) {
     factor = Min(factor, kConservativeHeapGrowingFactor);
   }
 
@@ -5550,6 +5836,18 @@ void Heap::SetOldGenerationAllocationLimit(size_t old_gen_size, double gc_speed,
   old_generation_allocation_limit_ =
       CalculateOldGenerationAllocationLimit(factor, old_gen_size);
 
+  if (near_memory_target) {
+    // Do not grow the old generation past the memory target, but always
+    // leave room for the minimal growing step.
+    size_t headroom = memory_reducer_->MemoryTargetHeadroom();
+    size_t min_limit =
+        CalculateOldGenerationAllocationLimit(kMinHeapGrowingFactor,
+                                              old_gen_size);
+    size_t target_limit = old_gen_size + Min(headroom, SIZE_MAX - old_gen_size);
+    old_generation_allocation_limit_ =
+        Max(min_limit, Min(old_generation_allocation_limit_, target_limit));
+  }
+
   if (FLAG_trace_gc_verbose) {
     isolate_->PrintWithTimestamp(
         "Grow: old size: %" PRIuS " KB, new limit: %" PRIuS " KB (%.1f)\n",
@@ -5641,6 +5939,9 @@ Heap::IncrementalMarkingLimit Heap::IncrementalMarkingLimitReached() {
   if (ShouldOptimizeForMemoryUsage()) {
     return IncrementalMarkingLimit::kHardLimit;
   }
+  if (memory_reducer_->IsNearMemoryTarget()) {
+    return IncrementalMarkingLimit::kSoftLimit;
+  }
   if (ShouldOptimizeForLoadTime()) {
     return IncrementalMarkingLimit::kNoLimit;
   }
@@ -5771,6 +6072,8 @@ bool Heap::SetUp() {
     dead_object_stats_ = new ObjectStats(this);
   }
   scavenge_job_ = new ScavengeJob();
+  pretenuring_decisions_ = new PretenuringDecisions(this);
+  array_buffer_collector_ = new ArrayBufferCollector(this);
   local_embedder_heap_tracer_ = new LocalEmbedderHeapTracer();
 
   LOG(isolate_, IntPtrTEvent("heap-capacity", Capacity()));
@@ -5849,6 +6152,9 @@ void Heap::NotifyDeserializationComplete() {
   }
 
   deserialization_complete_ = true;
+#ifdef VERIFY_HEAP
+  read_only_roots_checksum_ = ReadOnlyRootsChecksum(this);
+#endif
 }
 
 void Heap::SetEmbedderHeapTracer(EmbedderHeapTracer* tracer) {
@@ -5858,17 +6164,26 @@ void Heap::SetEmbedderHeapTracer(EmbedderHeapTracer* tracer) {
 
 void Heap::TracePossibleWrapper(JSObject* js_object) {
   DCHECK(js_object->WasConstructedFromApiFunction());
-  if (js_object->GetEmbedderFieldCount() >= 2 &&
-      js_object->GetEmbedderField(0) &&
-      js_object->GetEmbedderField(0) != undefined_value() &&
-      js_object->GetEmbedderField(1) != undefined_value()) {
-    DCHECK(reinterpret_cast<intptr_t>(js_object->GetEmbedderField(0)) % 2 == 0);
-    local_embedder_heap_tracer()->AddWrapperToTrace(std::pair<void*, void*>(
-        reinterpret_cast<void*>(js_object->GetEmbedderField(0)),
-        reinterpret_cast<void*>(js_object->GetEmbedderField(1))));
+  LocalEmbedderHeapTracer::WrapperInfo wrapper;
+  if (ExtractWrapperInfo(js_object, &wrapper)) {
+    local_embedder_heap_tracer()->AddWrapperToTrace(wrapper);
   }
 }
 
+bool Heap::ExtractWrapperInfo(JSObject* js_object,
+                              std::pair<void*, void*>* wrapper) {
+  if (js_object->GetEmbedderFieldCount() < 2) return false;
+  Object* field0 = js_object->GetEmbedderField(0);
+  Object* field1 = js_object->GetEmbedderField(1);
+  if (!field0 || field0 == undefined_value() || field1 == undefined_value()) {
+    return false;
+  }
+  DCHECK(reinterpret_cast<intptr_t>(field0) % 2 == 0);
+  *wrapper = std::pair<void*, void*>(reinterpret_cast<void*>(field0),
+                                     reinterpret_cast<void*>(field1));
+  return true;
+}
+
 void Heap::RegisterExternallyReferencedObject(Object** object) {
   // The embedder is not aware of whether numbers are materialized as heap
   // objects are just passed around as Smis.
@@ -5883,6 +6198,15 @@ void Heap::RegisterExternallyReferencedObject(Object** object) {
   }
 }
 
+void Heap::MarkConcurrentExternalReferences() {
+  if (!local_embedder_heap_tracer()->InUse()) return;
+  std::vector<Object**> references;
+  local_embedder_heap_tracer()->FlushExternalReferences(&references);
+  for (Object** reference : references) {
+    RegisterExternallyReferencedObject(reference);
+  }
+}
+
 void Heap::TearDown() {
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap) {
@@ -5896,6 +6220,10 @@ void Heap::TearDown() {
     PrintAllocationsHash();
   }
 
+  if (FLAG_trace_gc_statistics_json) {
+    tracer()->PrintStatisticsJSON();
+  }
+
   new_space()->RemoveAllocationObserver(idle_scavenge_observer_);
   delete idle_scavenge_observer_;
   idle_scavenge_observer_ = nullptr;
@@ -5946,6 +6274,9 @@ void Heap::TearDown() {
   delete scavenge_job_;
   scavenge_job_ = nullptr;
 
+  delete pretenuring_decisions_;
+  pretenuring_decisions_ = nullptr;
+
   isolate_->global_handles()->TearDown();
 
   external_string_table_.TearDown();
@@ -5978,6 +6309,12 @@ void Heap::TearDown() {
     lo_space_ = NULL;
   }
 
+  // Backing stores of buffers that were still alive have been handed to the
+  // collector by the spaces above.
+  array_buffer_collector_->FreeAllocations();
+  delete array_buffer_collector_;
+  array_buffer_collector_ = nullptr;
+
   store_buffer()->TearDown();
 
   memory_allocator()->TearDown();
@@ -6093,6 +6430,7 @@ void Heap::CompactWeakFixedArrays() {
   CompactWeakFixedArray(noscript_shared_function_infos());
   CompactWeakFixedArray(script_list());
   CompactWeakFixedArray(weak_stack_trace_list());
+  CompactWeakFixedArray(context_independent_code_list());
 }
 
 void Heap::AddRetainedMap(Handle<Map> map) {
@@ -6110,6 +6448,28 @@ void Heap::AddRetainedMap(Handle<Map> map) {
 }
 
 
+void Heap::AddContextIndependentCode(Handle<Code> code) {
+  DCHECK_EQ(Code::OPTIMIZED_FUNCTION, code->kind());
+  Handle<WeakFixedArray> list = WeakFixedArray::Add(
+      handle(context_independent_code_list(), isolate()), code);
+  if (*list != context_independent_code_list()) {
+    set_context_independent_code_list(*list);
+  }
+}
+
+Code* Heap::FindContextIndependentCode(SharedFunctionInfo* shared) {
+  WeakFixedArray::Iterator it(context_independent_code_list());
+  while (Code* code = it.Next<Code>()) {
+    if (code->marked_for_deoptimization()) continue;
+    DeoptimizationInputData* data =
+        DeoptimizationInputData::cast(code->deoptimization_data());
+    if (data->length() > 0 && data->SharedFunctionInfo() == shared) {
+      return code;
+    }
+  }
+  return nullptr;
+}
+
 void Heap::CompactRetainedMaps(ArrayList* retained_maps) {
   DCHECK_EQ(retained_maps, this->retained_maps());
   int length = retained_maps->Length();
@@ -179,6 +179,7 @@ using v8::MemoryPressureLevel;
   V(PropertyCell, array_iterator_protector, ArrayIteratorProtector)            \
   V(PropertyCell, array_buffer_neutering_protector,                            \
     ArrayBufferNeuteringProtector)                                             \
+  V(PropertyCell, console_delegate_protector, ConsoleDelegateProtector)       \
   /* Special numbers */                                                        \
   V(HeapNumber, nan_value, NanValue)                                           \
   V(HeapNumber, hole_nan_value, HoleNanValue)                                  \
@@ -211,6 +212,8 @@ using v8::MemoryPressureLevel;
   V(Object, code_coverage_list, CodeCoverageList)                              \
   V(Object, weak_stack_trace_list, WeakStackTraceList)                         \
   V(Object, noscript_shared_function_infos, NoScriptSharedFunctionInfos)       \
+  /* Weak list of the optimized code shared across native contexts. */         \
+  V(Object, context_independent_code_list, ContextIndependentCodeList)         \
   V(FixedArray, serialized_templates, SerializedTemplates)                     \
   V(FixedArray, serialized_global_proxy_sizes, SerializedGlobalProxySizes)     \
   V(TemplateList, message_listeners, MessageListeners)                         \
@@ -258,6 +261,7 @@ using v8::MemoryPressureLevel;
   V(ByteArrayMap)                       \
   V(BytecodeArrayMap)                   \
   V(CatchContextMap)                    \
+  V(ConsoleDelegateProtector)           \
   V(CellMap)                            \
   V(CodeMap)                            \
   V(EmptyByteArray)                     \
@@ -339,6 +343,39 @@ using v8::MemoryPressureLevel;
   V(WithContextMap)                     \
   PRIVATE_SYMBOL_LIST(V)
 
+// Immortal immovable roots whose contents never change once the heap has been
+// set up, in addition to the internalized strings of INTERNALIZED_STRING_LIST.
+// They neither depend on nor are written to by the isolate that owns them,
+// which makes them candidates for sharing between isolates.
+#define READ_ONLY_ROOT_LIST(V)     \
+  V(ArgumentsMarker)               \
+  V(EmptyByteArray)                \
+  V(EmptyFixedArray)               \
+  V(EmptyFixedFloat32Array)        \
+  V(EmptyFixedFloat64Array)        \
+  V(EmptyFixedInt16Array)          \
+  V(EmptyFixedInt32Array)          \
+  V(EmptyFixedInt8Array)           \
+  V(EmptyFixedUint16Array)         \
+  V(EmptyFixedUint32Array)         \
+  V(EmptyFixedUint8Array)          \
+  V(EmptyFixedUint8ClampedArray)   \
+  V(Exception)                     \
+  V(FalseValue)                    \
+  V(HoleNanValue)                  \
+  V(InfinityValue)                 \
+  V(MinusInfinityValue)            \
+  V(MinusZeroValue)                \
+  V(NanValue)                      \
+  V(NullValue)                     \
+  V(OptimizedOut)                  \
+  V(StaleRegister)                 \
+  V(TerminationException)          \
+  V(TheHoleValue)                  \
+  V(TrueValue)                     \
+  V(UndefinedValue)                \
+  V(UninitializedValue)
+
 #define FIXED_ARRAY_ELEMENTS_WRITE_BARRIER(heap, array, start, length) \
   do {                                                                 \
     heap->RecordFixedArrayElements(array, start, length);              \
@@ -347,6 +384,7 @@ using v8::MemoryPressureLevel;
 
 // Forward declarations.
 class AllocationObserver;
+class ArrayBufferCollector;
 class ArrayBufferTracker;
 class ConcurrentMarking;
 class GCIdleTimeAction;
@@ -365,6 +403,7 @@ class ObjectIterator;
 class ObjectStats;
 class Page;
 class PagedSpace;
+class PretenuringDecisions;
 class RootVisitor;
 class Scavenger;
 class ScavengeJob;
@@ -680,6 +719,9 @@ class Heap {
 
   V8_EXPORT_PRIVATE static bool RootIsImmortalImmovable(int root_index);
 
+  // Returns true for roots in READ_ONLY_ROOT_LIST and INTERNALIZED_STRING_LIST.
+  V8_EXPORT_PRIVATE static bool RootIsReadOnly(int root_index);
+
   // Checks whether the space is valid.
   static bool IsValidAllocationSpace(AllocationSpace space);
 
@@ -852,6 +894,8 @@ class Heap {
                                   bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  void SetMemoryTarget(v8::MemoryTarget* target);
+
   void SetOutOfMemoryCallback(v8::debug::OutOfMemoryCallback callback,
                               void* data);
 
@@ -862,6 +906,10 @@ class Heap {
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
 
+  // Picks the scavenger or the minor mark compactor for a young generation
+  // GC, based on the predicted survival rate.
+  GarbageCollector SelectYoungGenerationCollector();
+
   void VisitExternalResources(v8::ExternalResourceVisitor* visitor);
 
   // An object should be promoted if the object has survived a
@@ -926,6 +974,15 @@ class Heap {
 
   void AddRetainedMap(Handle<Map> map);
 
+  // Native context independent optimized code can run in closures of any
+  // native context, so it is kept in a list of the heap instead of the
+  // optimized code list of a native context.
+  void AddContextIndependentCode(Handle<Code> code);
+
+  // Returns native context independent code for {shared} that is not marked
+  // for deoptimization, or nullptr if there is none.
+  Code* FindContextIndependentCode(SharedFunctionInfo* shared);
+
   // This event is triggered after successful allocation of a new object made
   // by runtime. Allocations of target space for object evacuation do not
   // trigger the event. In order to track ALL allocations one must turn off
@@ -1031,6 +1088,14 @@ class Heap {
 
   MemoryAllocator* memory_allocator() { return memory_allocator_; }
 
+  PretenuringDecisions* pretenuring_decisions() {
+    return pretenuring_decisions_;
+  }
+
+  ArrayBufferCollector* array_buffer_collector() {
+    return array_buffer_collector_;
+  }
+
   PromotionQueue* promotion_queue() { return &promotion_queue_; }
 
   inline Isolate* isolate();
@@ -1267,7 +1332,15 @@ class Heap {
   }
   void SetEmbedderHeapTracer(EmbedderHeapTracer* tracer);
   void TracePossibleWrapper(JSObject* js_object);
+  // Reads the embedder fields that identify {js_object}'s wrapper into
+  // {wrapper}. Returns false if {js_object} is not a wrapper. May be called
+  // from concurrent marking tasks.
+  bool ExtractWrapperInfo(JSObject* js_object,
+                          std::pair<void*, void*>* wrapper);
   void RegisterExternallyReferencedObject(Object** object);
+  // Marks the objects that the embedder reported from its own tracing threads
+  // through LocalEmbedderHeapTracer::AddExternalReferenceConcurrently.
+  void MarkConcurrentExternalReferences();
 
   // ===========================================================================
   // External string table API. ================================================
@@ -1539,6 +1612,10 @@ class Heap {
   // Verify the heap is in its normal state before or after a GC.
   void Verify();
   void VerifyRememberedSetFor(HeapObject* object);
+
+  // Checks that no read-only root has been written to since the heap has been
+  // set up.
+  void VerifyReadOnlyRoots();
 #endif
 
 #ifdef DEBUG
@@ -1640,6 +1717,7 @@ class Heap {
   static const int kInitialStringTableSize = 2048;
   static const int kInitialEvalCacheSize = 64;
   static const int kInitialNumberStringCacheSize = 256;
+  static const int kMaxNumberStringCacheSize = 0x8000;
 
   static const int kRememberedUnmappedPages = 128;
 
@@ -1777,6 +1855,11 @@ class Heap {
 
   void ReduceNewSpaceSize();
 
+  // Returns the new space capacity that matches --scavenge-target-interval-ms
+  // at the current allocation throughput, bounded by the estimated scavenge
+  // pause. Returns 0 if the tracer does not have enough samples yet.
+  size_t ComputeNewSpaceTargetCapacity();
+
   GCIdleTimeHeapState ComputeHeapState();
 
   bool PerformIdleTimeAction(GCIdleTimeAction action,
@@ -1847,6 +1930,11 @@ class Heap {
   void Scavenge();
   void EvacuateYoungGeneration();
 
+  // Copies objects reachable from roots and the old-to-new remembered set
+  // using several {ParallelScavenger} tasks.
+  void ScavengeInParallel();
+  int NumberOfScavengeTasks();
+
   Address DoScavenge(Address new_space_front);
 
   void UpdateNewSpaceReferencesInExternalStringTable(
@@ -2315,6 +2403,9 @@ class Heap {
 
   Scavenger* scavenge_collector_;
 
+  // Used by {ItemParallelJob} to wait for parallel scavenging tasks.
+  base::Semaphore parallel_scavenge_semaphore_;
+
   MarkCompactCollector* mark_compact_collector_;
   MinorMarkCompactCollector* minor_mark_compact_collector_;
 
@@ -2334,6 +2425,12 @@ class Heap {
 
   ScavengeJob* scavenge_job_;
 
+  // Pretenuring decisions loaded from a previous run.
+  PretenuringDecisions* pretenuring_decisions_;
+
+  // Frees backing stores of dead array buffers off the main thread.
+  ArrayBufferCollector* array_buffer_collector_;
+
   AllocationObserver* idle_scavenge_observer_;
 
   // This counter is increased before each GC and never reset.
@@ -2390,6 +2487,12 @@ class Heap {
 
   bool deserialization_complete_;
 
+#ifdef VERIFY_HEAP
+  // Checksum over the contents of the read-only roots, taken when the heap
+  // has been set up.
+  size_t read_only_roots_checksum_;
+#endif
+
   StrongRootsList* strong_roots_list_;
 
   // The depth of HeapIterator nestings.
@@ -2650,6 +2753,12 @@ class AllocationObserver {
   // Subclasses can override this method to make step size dynamic.
   virtual intptr_t GetNextStepSize() { return step_size_; }
 
+  // Observers that do not need to see the exact allocation that crosses the
+  // step boundary can return true here. The new space then never shrinks its
+  // linear allocation area below NewSpace::kMinimumInlineAllocationStep for
+  // them, and the delayed step receives all bytes allocated in the meantime.
+  virtual bool AllowsDelayedSteps() const { return false; }
+
   intptr_t step_size_;
   intptr_t bytes_to_next_step_;
 
@@ -35,7 +35,9 @@ IncrementalMarking::IncrementalMarking(Heap* heap)
     : heap_(heap),
       marking_worklist_(nullptr),
       initial_old_generation_size_(0),
+      black_allocated_bytes_(0),
       bytes_marked_ahead_of_schedule_(0),
+      bytes_marked_concurrently_(0),
       unscanned_bytes_of_large_object_(0),
       state_(STOPPED),
       idle_marking_delay_counter_(0),
@@ -143,7 +145,8 @@ void IncrementalMarking::MarkBlackAndPush(HeapObject* obj) {
   ObjectMarking::WhiteToGrey<kAtomicity>(obj, marking_state(obj));
   if (ObjectMarking::GreyToBlack<kAtomicity>(obj, marking_state(obj))) {
 #ifdef V8_CONCURRENT_MARKING
-    marking_worklist()->Push(obj, MarkingThread::kMain, TargetDeque::kBailout);
+    marking_worklist()->Push(obj, ConcurrentMarkingDeque::kMainThread,
+                             TargetDeque::kBailout);
 #else
     if (!marking_worklist()->Push(obj)) {
       ObjectMarking::BlackToGrey<kAtomicity>(obj, marking_state(obj));
@@ -514,6 +517,7 @@ void IncrementalMarking::Start(GarbageCollectionReason gc_reason) {
   initial_old_generation_size_ = heap_->PromotedSpaceSizeOfObjects();
   old_generation_allocation_counter_ = heap_->OldGenerationAllocationCounter();
   bytes_allocated_ = 0;
+  black_allocated_bytes_ = 0;
   bytes_marked_ahead_of_schedule_ = 0;
   should_hurry_ = false;
   was_activated_ = true;
@@ -598,7 +602,8 @@ void IncrementalMarking::StartMarking() {
 
   if (FLAG_concurrent_marking) {
     ConcurrentMarking* concurrent_marking = heap_->concurrent_marking();
-    concurrent_marking->StartTask();
+    bytes_marked_concurrently_ = concurrent_marking->TotalMarkedBytes();
+    concurrent_marking->ScheduleTasks();
   }
 
   // Ready to start incremental marking.
@@ -956,7 +961,11 @@ void IncrementalMarking::Hurry() {
     }
     // TODO(gc) hurry can mark objects it encounters black as mutator
     // was stopped.
-    ProcessMarkingWorklist(0, FORCE_COMPLETION);
+    if (FLAG_concurrent_marking && FLAG_parallel_marking_finalization) {
+      HurryInParallel();
+    } else {
+      ProcessMarkingWorklist(0, FORCE_COMPLETION);
+    }
     state_ = COMPLETE;
     if (FLAG_trace_incremental_marking) {
       double end = heap_->MonotonicallyIncreasingTimeInMs();
@@ -986,6 +995,22 @@ void IncrementalMarking::Hurry() {
 }
 
 
+void IncrementalMarking::HurryInParallel() {
+  // The mutator is stopped, so the concurrent marking tasks and the main
+  // thread have the marking worklist to themselves. The main thread handles
+  // the objects that the tasks bail out on. Work that the main thread
+  // discovers becomes stealable once a worklist segment fills up.
+  ConcurrentMarking* concurrent_marking = heap_->concurrent_marking();
+  while (true) {
+    concurrent_marking->ScheduleTasks();
+    ProcessMarkingWorklist(0, FORCE_COMPLETION);
+    concurrent_marking->EnsureCompleted();
+    // All tasks have finished, so there is no work hidden in their private
+    // segments anymore.
+    if (marking_worklist()->IsEmpty()) break;
+  }
+}
+
 void IncrementalMarking::Stop() {
   if (IsStopped()) return;
   if (FLAG_trace_incremental_marking) {
@@ -1024,6 +1049,14 @@ void IncrementalMarking::Stop() {
 
 
 void IncrementalMarking::Finalize() {
+  if (FLAG_concurrent_marking && FLAG_parallel_marking_finalization &&
+      IsMarking()) {
+    // Rescan the strong roots, so that the objects that became reachable
+    // after the last finalization round are marked in parallel by Hurry
+    // instead of by the main-thread root marking of the mark-compactor.
+    IncrementalMarkingRootMarkingVisitor visitor(this);
+    heap_->IterateStrongRoots(&visitor, VISIT_ONLY_STRONG);
+  }
   Hurry();
   Stop();
 }
@@ -1100,6 +1133,7 @@ double IncrementalMarking::AdvanceIncrementalMarking(
                                   EmbedderHeapTracer::ForceCompletionAction::
                                       DO_NOT_FORCE_COMPLETION));
       }
+      heap_->MarkConcurrentExternalReferences();
     } else {
       Step(step_size_in_bytes, completion_action, force_completion,
            step_origin);
@@ -1128,8 +1162,15 @@ void IncrementalMarking::FinalizeSweeping() {
 size_t IncrementalMarking::StepSizeToKeepUpWithAllocations() {
   // Update bytes_allocated_ based on the allocation counter.
   size_t current_counter = heap_->OldGenerationAllocationCounter();
-  bytes_allocated_ += current_counter - old_generation_allocation_counter_;
+  size_t allocated = current_counter - old_generation_allocation_counter_;
   old_generation_allocation_counter_ = current_counter;
+  // Objects in black areas are already marked and need no marking work.
+  if (black_allocated_bytes_ > 0) {
+    size_t black = Min(allocated, static_cast<size_t>(black_allocated_bytes_));
+    black_allocated_bytes_ -= static_cast<intptr_t>(black);
+    allocated -= black;
+  }
+  bytes_allocated_ += allocated;
   return bytes_allocated_;
 }
 
@@ -1164,6 +1205,7 @@ void IncrementalMarking::AdvanceIncrementalMarkingOnAllocation() {
 
   size_t bytes_to_process =
       StepSizeToKeepUpWithAllocations() + StepSizeToMakeProgress();
+  FetchBytesMarkedConcurrently();
 
   if (bytes_to_process >= IncrementalMarking::kAllocatedThreshold) {
     // The first step after Scavenge will see many allocated bytes.
@@ -1192,6 +1234,16 @@ void IncrementalMarking::AdvanceIncrementalMarkingOnAllocation() {
   }
 }
 
+void IncrementalMarking::FetchBytesMarkedConcurrently() {
+  if (FLAG_concurrent_marking && state_ == MARKING) {
+    // The counter of the concurrent marker is monotonic, so the delta is
+    // the amount of work done by the tasks since the last fetch.
+    size_t current = heap_->concurrent_marking()->TotalMarkedBytes();
+    bytes_marked_ahead_of_schedule_ += current - bytes_marked_concurrently_;
+    bytes_marked_concurrently_ = current;
+  }
+}
+
 size_t IncrementalMarking::Step(size_t bytes_to_process,
                                 CompletionAction action,
                                 ForceCompletionAction completion,
@@ -1205,6 +1257,13 @@ size_t IncrementalMarking::Step(size_t bytes_to_process,
 
   size_t bytes_processed = 0;
   if (state_ == MARKING) {
+    if (FLAG_concurrent_marking) {
+      heap_->concurrent_marking()->RescheduleTasksIfNeeded();
+    }
+    if (FLAG_incremental_marking_wrappers) {
+      // Objects that the embedder found while tracing on its own threads.
+      heap_->MarkConcurrentExternalReferences();
+    }
     bytes_processed = ProcessMarkingWorklist(bytes_to_process);
     if (step_origin == StepOrigin::kTask) {
       bytes_marked_ahead_of_schedule_ += bytes_processed;
@@ -250,6 +250,13 @@ class V8_EXPORT_PRIVATE IncrementalMarking {
 
   void ProcessBlackAllocatedObject(HeapObject* obj);
 
+  // Black allocated memory does not have to be marked, so it is not counted
+  // towards the allocation-driven marking step size. {bytes} is negative when
+  // an unused part of a black area is released again.
+  void NotifyBlackAllocation(intptr_t bytes) {
+    black_allocated_bytes_ += bytes;
+  }
+
   Heap* heap() const { return heap_; }
 
   IncrementalMarkingJob* incremental_marking_job() {
@@ -260,6 +267,10 @@ class V8_EXPORT_PRIVATE IncrementalMarking {
 
   void StartBlackAllocationForTesting() { StartBlackAllocation(); }
 
+  size_t StepSizeToKeepUpWithAllocationsForTesting() {
+    return StepSizeToKeepUpWithAllocations();
+  }
+
   void AbortBlackAllocation();
 
   MarkCompactCollector::MarkingWorklist* marking_worklist() {
@@ -321,12 +332,19 @@ class V8_EXPORT_PRIVATE IncrementalMarking {
 
   void RevisitObject(HeapObject* obj);
 
+  // Empties the marking worklist using the concurrent marking tasks and the
+  // main thread. Can only be used in the atomic pause.
+  void HurryInParallel();
+
   void IncrementIdleMarkingDelayCounter();
 
   void AdvanceIncrementalMarkingOnAllocation();
 
   size_t StepSizeToKeepUpWithAllocations();
   size_t StepSizeToMakeProgress();
+  // Credits the bytes marked by the concurrent marking tasks since the last
+  // call to the marking schedule.
+  void FetchBytesMarkedConcurrently();
 
   Heap* heap_;
   MarkCompactCollector::MarkingWorklist* marking_worklist_;
@@ -335,7 +353,13 @@ class V8_EXPORT_PRIVATE IncrementalMarking {
   size_t initial_old_generation_size_;
   size_t old_generation_allocation_counter_;
   size_t bytes_allocated_;
+  // Black allocated bytes that have not been discounted from
+  // bytes_allocated_ yet.
+  intptr_t black_allocated_bytes_;
   size_t bytes_marked_ahead_of_schedule_;
+  // The value of ConcurrentMarking::TotalMarkedBytes() at the last call of
+  // FetchBytesMarkedConcurrently.
+  size_t bytes_marked_concurrently_;
   size_t unscanned_bytes_of_large_object_;
 
   State state_;
@@ -5,10 +5,15 @@
 #ifndef V8_HEAP_ITEM_PARALLEL_JOB_
 #define V8_HEAP_ITEM_PARALLEL_JOB_
 
+#include <deque>
+#include <memory>
 #include <vector>
 
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
 #include "src/cancelable-task.h"
+#include "src/utils.h"
 #include "src/v8.h"
 
 namespace v8 {
@@ -25,10 +30,33 @@ class Isolate;
 //
 // Items need to be marked as finished after processing them. Task and Item
 // ownership is transferred to the job.
+//
+// Items are distributed in contiguous blocks over per-task deques. A task
+// takes items from the front of its own deque and, once that is empty, steals
+// items from the back of the deques of other tasks. A task can split off parts
+// of a large item into new items using |PushItem()|, which makes them available
+// for stealing.
 class ItemParallelJob {
  public:
   class Task;
 
+  // Load balancing statistics of a job. Only tasks that actually ran, i.e.,
+  // were not cancelled, are taken into account.
+  struct Stats {
+    Stats()
+        : tasks(0),
+          items(0),
+          stolen_items(0),
+          longest_task_ms(0),
+          total_task_ms(0) {}
+
+    int tasks;
+    size_t items;
+    size_t stolen_items;
+    double longest_task_ms;
+    double total_task_ms;
+  };
+
   class Item {
    public:
     Item() : state_(kAvailable) {}
@@ -53,54 +81,109 @@ class ItemParallelJob {
     DISALLOW_COPY_AND_ASSIGN(Item);
   };
 
+ private:
+  // Per-task state owned by the job, so that it outlives the task.
+  struct TaskState {
+    TaskState()
+        : ran(false), items_processed(0), items_stolen(0), time_ms(0) {}
+
+    // Protects |items|, which is accessed by the owning task and by thieves.
+    base::Mutex mutex;
+    std::deque<Item*> items;
+    // Items pushed by the owning task. Only accessed by the owning task and
+    // by the job after all tasks finished.
+    std::vector<Item*> pushed_items;
+    bool ran;
+    size_t items_processed;
+    size_t items_stolen;
+    double time_ms;
+  };
+
+ public:
   class Task : public CancelableTask {
    public:
     explicit Task(Isolate* isolate)
         : CancelableTask(isolate),
-          items_(nullptr),
-          cur_index_(0),
-          items_considered_(0),
+          task_states_(nullptr),
+          num_tasks_(0),
+          task_index_(0),
           on_finish_(nullptr) {}
     virtual ~Task() {}
 
     virtual void RunInParallel() = 0;
 
+    // Adds a new item to the deque of this task, e.g., a part of a large item
+    // that was split off. The item can be stolen by other tasks. Transfers
+    // ownership to the job. Must be called from within |RunInParallel()|.
+    void PushItem(Item* item) {
+      TaskState* state = &task_states_[task_index_];
+      state->pushed_items.push_back(item);
+      base::LockGuard<base::Mutex> guard(&state->mutex);
+      state->items.push_front(item);
+    }
+
    protected:
     // Retrieves a new item that needs to be processed. Returns |nullptr| if
     // all items are processed. Upon returning an item, the task is required
     // to process the item and mark the item as finished after doing so.
     template <class ItemType>
     ItemType* GetItem() {
-      while (items_considered_++ != items_->size()) {
-        // Wrap around.
-        if (cur_index_ == items_->size()) {
-          cur_index_ = 0;
-        }
-        Item* item = (*items_)[cur_index_++];
-        if (item->TryMarkingAsProcessing()) {
-          return static_cast<ItemType*>(item);
+      TaskState* state = &task_states_[task_index_];
+      Item* item = PopFront(state);
+      if (item == nullptr) {
+        for (size_t i = 1; i < num_tasks_ && item == nullptr; i++) {
+          item = PopBack(&task_states_[(task_index_ + i) % num_tasks_]);
         }
+        if (item == nullptr) return nullptr;
+        state->items_stolen++;
       }
-      return nullptr;
+      state->items_processed++;
+      bool success = item->TryMarkingAsProcessing();
+      USE(success);
+      DCHECK(success);
+      return static_cast<ItemType*>(item);
     }
 
    private:
-    void SetupInternal(base::Semaphore* on_finish, std::vector<Item*>* items,
-                       size_t start_index) {
+    static Item* PopFront(TaskState* state) {
+      base::LockGuard<base::Mutex> guard(&state->mutex);
+      if (state->items.empty()) return nullptr;
+      Item* item = state->items.front();
+      state->items.pop_front();
+      return item;
+    }
+
+    static Item* PopBack(TaskState* state) {
+      base::LockGuard<base::Mutex> guard(&state->mutex);
+      if (state->items.empty()) return nullptr;
+      Item* item = state->items.back();
+      state->items.pop_back();
+      return item;
+    }
+
+    void SetupInternal(base::Semaphore* on_finish, TaskState* task_states,
+                       size_t num_tasks, size_t task_index) {
       on_finish_ = on_finish;
-      items_ = items;
-      cur_index_ = start_index;
+      task_states_ = task_states;
+      num_tasks_ = num_tasks;
+      task_index_ = task_index;
     }
 
     // We don't allow overriding this method any further.
     void RunInternal() final {
+      TaskState* state = &task_states_[task_index_];
+      double start = V8::GetCurrentPlatform()->MonotonicallyIncreasingTime();
       RunInParallel();
+      double end = V8::GetCurrentPlatform()->MonotonicallyIncreasingTime();
+      state->ran = true;
+      state->time_ms = (end - start) *
+                       static_cast<double>(base::Time::kMillisecondsPerSecond);
       on_finish_->Signal();
     }
 
-    std::vector<Item*>* items_;
-    size_t cur_index_;
-    size_t items_considered_;
+    TaskState* task_states_;
+    size_t num_tasks_;
+    size_t task_index_;
     base::Semaphore* on_finish_;
 
     friend class ItemParallelJob;
@@ -112,7 +195,8 @@ class ItemParallelJob {
   ItemParallelJob(CancelableTaskManager* cancelable_task_manager,
                   base::Semaphore* pending_tasks)
       : cancelable_task_manager_(cancelable_task_manager),
-        pending_tasks_(pending_tasks) {}
+        pending_tasks_(pending_tasks),
+        num_task_states_(0) {}
 
   ~ItemParallelJob() {
     for (size_t i = 0; i < items_.size(); i++) {
@@ -120,6 +204,13 @@ class ItemParallelJob {
       CHECK(item->IsFinished());
       delete item;
     }
+    for (size_t i = 0; i < num_task_states_; i++) {
+      DCHECK(task_states_[i].items.empty());
+      for (Item* item : task_states_[i].pushed_items) {
+        CHECK(item->IsFinished());
+        delete item;
+      }
+    }
   }
 
   // Adds a task to the job. Transfers ownership to the job.
@@ -131,21 +222,26 @@ class ItemParallelJob {
   int NumberOfItems() const { return static_cast<int>(items_.size()); }
   int NumberOfTasks() const { return static_cast<int>(tasks_.size()); }
 
+  // Returns the load balancing statistics of the job. Only valid after
+  // |Run()|.
+  const Stats& stats() const { return stats_; }
+
   void Run() {
     DCHECK_GE(tasks_.size(), 0);
     const size_t num_tasks = tasks_.size();
     const size_t num_items = items_.size();
     const size_t items_per_task = (num_items + num_tasks - 1) / num_tasks;
+    task_states_.reset(new TaskState[num_tasks]);
+    num_task_states_ = num_tasks;
+    for (size_t i = 0; i < num_items; i++) {
+      task_states_[i / items_per_task].items.push_back(items_[i]);
+    }
     uint32_t* task_ids = new uint32_t[num_tasks];
-    size_t start_index = 0;
     Task* main_task = nullptr;
     Task* task = nullptr;
-    for (size_t i = 0; i < num_tasks; i++, start_index += items_per_task) {
+    for (size_t i = 0; i < num_tasks; i++) {
       task = tasks_[i];
-      if (start_index >= num_items) {
-        start_index -= num_items;
-      }
-      task->SetupInternal(pending_tasks_, &items_, start_index);
+      task->SetupInternal(pending_tasks_, task_states_.get(), num_tasks, i);
       task_ids[i] = task->id();
       if (i > 0) {
         V8::GetCurrentPlatform()->CallOnBackgroundThread(
@@ -165,13 +261,29 @@ class ItemParallelJob {
       }
     }
     delete[] task_ids;
+    ComputeStats();
   }
 
  private:
+  void ComputeStats() {
+    for (size_t i = 0; i < num_task_states_; i++) {
+      const TaskState& state = task_states_[i];
+      if (!state.ran) continue;
+      stats_.tasks++;
+      stats_.items += state.items_processed;
+      stats_.stolen_items += state.items_stolen;
+      stats_.longest_task_ms = Max(stats_.longest_task_ms, state.time_ms);
+      stats_.total_task_ms += state.time_ms;
+    }
+  }
+
   std::vector<Item*> items_;
   std::vector<Task*> tasks_;
   CancelableTaskManager* cancelable_task_manager_;
   base::Semaphore* pending_tasks_;
+  std::unique_ptr<TaskState[]> task_states_;
+  size_t num_task_states_;
+  Stats stats_;
   DISALLOW_COPY_AND_ASSIGN(ItemParallelJob);
 };
 
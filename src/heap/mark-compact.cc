@@ -5,6 +5,7 @@
 #include "src/heap/mark-compact.h"
 
 #include <unordered_map>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/bits.h"
@@ -16,6 +17,7 @@
 #include "src/frames-inl.h"
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker.h"
 #include "src/heap/concurrent-marking.h"
 #include "src/heap/gc-tracer.h"
@@ -404,7 +406,9 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       compacting_(false),
       black_allocation_(false),
       have_code_to_deoptimize_(false),
+      flushing_bytecode_(false),
       marking_worklist_(heap),
+      processed_weak_collections_(Smi::kZero),
       sweeper_(heap) {
   old_to_new_slots_ = -1;
 }
@@ -477,6 +481,8 @@ void MarkCompactCollector::CollectGarbage() {
 
   ClearNonLiveReferences();
 
+  if (FLAG_string_deduplication) DeduplicateStrings();
+
   RecordObjectStats();
 
 #ifdef VERIFY_HEAP
@@ -572,28 +578,20 @@ void MarkCompactCollector::ClearMarkbits() {
 class MarkCompactCollector::Sweeper::SweeperTask : public v8::Task {
  public:
   SweeperTask(Sweeper* sweeper, base::Semaphore* pending_sweeper_tasks,
-              base::AtomicNumber<intptr_t>* num_sweeping_tasks,
-              AllocationSpace space_to_start)
+              base::AtomicNumber<intptr_t>* num_sweeping_tasks)
       : sweeper_(sweeper),
         pending_sweeper_tasks_(pending_sweeper_tasks),
-        num_sweeping_tasks_(num_sweeping_tasks),
-        space_to_start_(space_to_start) {}
+        num_sweeping_tasks_(num_sweeping_tasks) {}
 
   virtual ~SweeperTask() {}
 
  private:
   // v8::Task overrides.
   void Run() override {
-    DCHECK_GE(space_to_start_, FIRST_SPACE);
-    DCHECK_LE(space_to_start_, LAST_PAGED_SPACE);
-    const int offset = space_to_start_ - FIRST_SPACE;
-    const int num_spaces = LAST_PAGED_SPACE - FIRST_SPACE + 1;
-    for (int i = 0; i < num_spaces; i++) {
-      const int space_id = FIRST_SPACE + ((i + offset) % num_spaces);
-      DCHECK_GE(space_id, FIRST_SPACE);
-      DCHECK_LE(space_id, LAST_PAGED_SPACE);
-      sweeper_->ParallelSweepSpace(static_cast<AllocationSpace>(space_id), 0);
-    }
+    sweeper_->SweepSpacesInTaskOrder(0);
+    // Already on a background thread, so dead backing stores can be freed
+    // right away.
+    sweeper_->heap_->array_buffer_collector()->FreeAllocations();
     num_sweeping_tasks_->Decrement(1);
     pending_sweeper_tasks_->Signal();
   }
@@ -601,11 +599,29 @@ class MarkCompactCollector::Sweeper::SweeperTask : public v8::Task {
   Sweeper* sweeper_;
   base::Semaphore* pending_sweeper_tasks_;
   base::AtomicNumber<intptr_t>* num_sweeping_tasks_;
-  AllocationSpace space_to_start_;
 
   DISALLOW_COPY_AND_ASSIGN(SweeperTask);
 };
 
+// Code space is swept first because stack walks and code lookups sweep any
+// unswept code page they touch on the main thread. Map space follows as maps
+// are used when iterating the heap.
+const AllocationSpace
+    MarkCompactCollector::Sweeper::kSweepingOrder[kPagedSpaces] = {
+        CODE_SPACE, MAP_SPACE, OLD_SPACE};
+
+void MarkCompactCollector::Sweeper::SweepSpacesInTaskOrder(int max_pages) {
+  int pages_swept = 0;
+  for (AllocationSpace space : kSweepingOrder) {
+    Page* page = nullptr;
+    while ((page = GetSweepingPageSafe(space)) != nullptr) {
+      ParallelSweepPage(page, space);
+      pages_swept++;
+      if ((max_pages > 0) && (pages_swept >= max_pages)) return;
+    }
+  }
+}
+
 void MarkCompactCollector::Sweeper::StartSweeping() {
   sweeping_in_progress_ = true;
   ForAllSweepingSpaces([this](AllocationSpace space) {
@@ -619,15 +635,16 @@ void MarkCompactCollector::Sweeper::StartSweeping() {
 
 void MarkCompactCollector::Sweeper::StartSweeperTasks() {
   if (FLAG_concurrent_sweeping && sweeping_in_progress_) {
-    ForAllSweepingSpaces([this](AllocationSpace space) {
-      if (space == NEW_SPACE) return;
+    // All tasks sweep the spaces in the same order and take pages from the
+    // shared sweeping lists, so that they load balance within a space.
+    for (int i = 0; i < kNumberOfSweeperTasks; i++) {
       num_sweeping_tasks_.Increment(1);
       semaphore_counter_++;
       V8::GetCurrentPlatform()->CallOnBackgroundThread(
           new SweeperTask(this, &pending_sweeper_tasks_semaphore_,
-                          &num_sweeping_tasks_, space),
+                          &num_sweeping_tasks_),
           v8::Platform::kShortRunningTask);
-    });
+    }
   }
 }
 
@@ -684,6 +701,7 @@ void MarkCompactCollector::Sweeper::EnsureCompleted() {
     DCHECK(sweeping_list_[space].empty());
   });
   sweeping_in_progress_ = false;
+  heap_->array_buffer_collector()->FreeAllocationsOnBackgroundThread();
 }
 
 void MarkCompactCollector::Sweeper::EnsureNewSpaceCompleted() {
@@ -747,6 +765,24 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   } else {
     const double estimated_compaction_speed =
         heap()->tracer()->CompactionSpeedInBytesPerMillisecond();
+    if (FLAG_compaction_pause_target_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // Pages are visited from the most to the least fragmented one, which is
+      // also the order of decreasing freed bytes per millisecond of
+      // evacuation. Take every page that is worth compacting at all until the
+      // estimated evacuation time of all spaces reaches the pause target.
+      size_t selected_live_bytes = 0;
+      for (Page* p : evacuation_candidates_) {
+        selected_live_bytes += p->LiveBytesFromFreeList();
+      }
+      const size_t budget = static_cast<size_t>(
+          FLAG_compaction_pause_target_ms * estimated_compaction_speed);
+      *target_fragmentation_percent =
+          kTargetFragmentationPercentForReduceMemory;
+      *max_evacuated_bytes =
+          budget > selected_live_bytes ? budget - selected_live_bytes : 0;
+      return;
+    }
     if (estimated_compaction_speed != 0) {
       // Estimate the target fragmentation based on traced compaction speed
       // and a goal for a single page.
@@ -931,7 +967,7 @@ void MarkCompactCollector::Prepare() {
   // them here.
   heap()->memory_allocator()->unmapper()->WaitUntilCompleted();
 
-  heap()->concurrent_marking()->EnsureTaskCompleted();
+  heap()->concurrent_marking()->EnsureCompleted();
 
   // Clear marking bits if incremental marking is aborted.
   if (was_marked_incrementally_ && heap_->ShouldAbortIncrementalMarking()) {
@@ -958,6 +994,8 @@ void MarkCompactCollector::Prepare() {
     StartCompaction();
   }
 
+  flushing_bytecode_ = ShouldFlushBytecode();
+
   PagedSpaces spaces(heap());
   for (PagedSpace* space = spaces.next(); space != NULL;
        space = spaces.next()) {
@@ -1094,6 +1132,7 @@ class MarkCompactMarkingVisitor
       // Mark the map pointer and the body.
       heap->mark_compact_collector()->MarkObject(map);
       IterateBody(map, obj);
+      heap->mark_compact_collector()->VisitEphemeronKey(obj);
     }
   }
 
@@ -1250,6 +1289,7 @@ class MarkCompactCollector::RootMarkingVisitor : public ObjectVisitor,
       // Mark the map pointer and body, and push them on the marking stack.
       collector_->MarkObject(map);
       MarkCompactMarkingVisitor::IterateBody(map, object);
+      collector_->VisitEphemeronKey(object);
       // Mark all the objects reachable from the map and body.  May leave
       // overflowed objects in the heap.
       collector_->EmptyMarkingWorklist();
@@ -1296,6 +1336,22 @@ class InternalizedStringTableCleaner : public ObjectVisitor {
   HeapObject* table_;
 };
 
+// Looks up a string that is equal to the deduplication candidate.
+class DeduplicationKey : public StringTableKey {
+ public:
+  explicit DeduplicationKey(String* string)
+      : StringTableKey(string->hash_field()), string_(string) {}
+
+  bool IsMatch(Object* other) override {
+    return string_->Equals(String::cast(other));
+  }
+
+  Handle<String> AsHandle(Isolate* isolate) override { UNREACHABLE(); }
+
+ private:
+  String* string_;
+};
+
 class ExternalStringTableCleaner : public RootVisitor {
  public:
   explicit ExternalStringTableCleaner(Heap* heap) : heap_(heap) {}
@@ -2048,6 +2104,7 @@ void MarkCompactCollector::EmptyMarkingWorklist() {
     Map* map = object->map();
     MarkObject(map);
     MarkCompactMarkingVisitor::IterateBody(map, object);
+    VisitEphemeronKey(object);
   }
   DCHECK(marking_worklist()->IsEmpty());
 }
@@ -2106,6 +2163,7 @@ void MarkCompactCollector::ProcessEphemeralMarking(
             0,
             EmbedderHeapTracer::AdvanceTracingActions(
                 EmbedderHeapTracer::ForceCompletionAction::FORCE_COMPLETION));
+        heap_->MarkConcurrentExternalReferences();
       }
     } else {
       // TODO(mlippautz): We currently do not trace through blink when
@@ -2115,6 +2173,7 @@ void MarkCompactCollector::ProcessEphemeralMarking(
       heap_->local_embedder_heap_tracer()->ClearCachedWrappersToTrace();
     }
     ProcessWeakCollections();
+    if (marking_worklist()->IsEmpty()) ProcessMarkedEphemeronKeys();
     work_to_do = !marking_worklist()->IsEmpty();
     ProcessMarkingWorklist();
   }
@@ -2603,6 +2662,8 @@ void MinorMarkCompactCollector::MarkRootSetInParallel() {
       }
       job.Run();
       DCHECK(worklist()->IsGlobalEmpty());
+      heap()->tracer()->AddParallelJob(GCTracer::Scope::MINOR_MC_MARK_ROOTS,
+                                       job.stats());
     }
   }
   old_to_new_slots_ = static_cast<int>(slots.Value());
@@ -2782,6 +2843,7 @@ void MinorMarkCompactCollector::EvacuateEpilogue() {
 void MinorMarkCompactCollector::Evacuate() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_EVACUATE);
   base::LockGuard<base::Mutex> guard(heap()->relocation_mutex());
+  ConcurrentMarking::PauseScope pause_scope(heap()->concurrent_marking());
 
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_EVACUATE_PROLOGUE);
@@ -2792,6 +2854,7 @@ void MinorMarkCompactCollector::Evacuate() {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_EVACUATE_COPY);
     EvacuatePagesInParallel();
   }
+  heap()->array_buffer_collector()->FreeAllocationsOnBackgroundThread();
 
   UpdatePointersAfterEvacuation();
 
@@ -2914,22 +2977,17 @@ void MarkCompactCollector::MarkLiveObjects() {
 void MarkCompactCollector::ClearNonLiveReferences() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR);
 
+  ClearStringTableAndWeakCollections();
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_STRING_TABLE);
-
-    // Prune the string table removing all strings only pointed to by the
-    // string table.  Cannot use string_table() here because the string
-    // table is marked.
-    StringTable* string_table = heap()->string_table();
-    InternalizedStringTableCleaner internalized_visitor(heap(), string_table);
-    string_table->IterateElements(&internalized_visitor);
-    string_table->ElementsRemoved(internalized_visitor.PointersRemoved());
-
     ExternalStringTableCleaner external_visitor(heap());
     heap()->external_string_table_.IterateAll(&external_visitor);
     heap()->external_string_table_.CleanUpAll();
   }
 
+  FlushBytecode();
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_LISTS);
     // Process the weak references.
@@ -2948,10 +3006,159 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   }
 
   MarkDependentCodeForDeoptimization(dependent_code_list);
+}
 
-  ClearWeakCollections();
+bool MarkCompactCollector::ShouldFlushBytecode() {
+  if (!FLAG_flush_bytecode || !FLAG_age_code) return false;
+  // Only atomic full GCs flush bytecode, as the flushing candidates of
+  // incremental marking could be invalidated by the mutator.
+  if (was_marked_incrementally_) return false;
+  Isolate* isolate = this->isolate();
+  return !isolate->serializer_enabled() && !isolate->debug()->is_active() &&
+         isolate->is_best_effort_code_coverage();
 }
 
+void MarkCompactCollector::FlushBytecode() {
+  if (flushing_bytecode_) {
+    Code* lazy_compile = isolate()->builtins()->builtin(Builtins::kCompileLazy);
+    int flushed = 0;
+    for (SharedFunctionInfo* shared : bytecode_flushing_candidates_) {
+      BytecodeArray* bytecode = shared->bytecode_array();
+      if (ObjectMarking::IsBlackOrGrey(bytecode,
+                                       MarkingState::Internal(bytecode))) {
+        continue;
+      }
+      shared->set_code(lazy_compile);
+      Object** code_slot =
+          HeapObject::RawField(shared, SharedFunctionInfo::kCodeOffset);
+      RecordSlot(shared, code_slot, lazy_compile);
+      shared->ClearBytecodeArray();
+      flushed++;
+    }
+    // Closures still entering the flushed bytecode are reset to lazy
+    // compilation, which regenerates the bytecode on their next call.
+    for (JSFunction* function : bytecode_flushing_function_candidates_) {
+      if (function->shared()->is_compiled() || !function->is_compiled()) {
+        continue;
+      }
+      function->set_code_no_write_barrier(lazy_compile);
+      RecordCodeEntrySlot(function,
+                          function->address() + JSFunction::kCodeEntryOffset,
+                          lazy_compile);
+    }
+    if (FLAG_trace_gc_verbose && flushed > 0) {
+      PrintIsolate(isolate(), "Flushed bytecode of %d functions\n", flushed);
+    }
+  }
+  bytecode_flushing_candidates_.clear();
+  bytecode_flushing_function_candidates_.clear();
+  flushing_bytecode_ = false;
+}
+
+void MarkCompactCollector::DeduplicateStrings() {
+  TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_DEDUPLICATE_STRINGS);
+  DisallowHeapAllocation no_allocation;
+  // Strings that survived to old space and would shrink as ThinStrings.
+  // They are collected first, because the live object iteration must not
+  // see the layout changes.
+  std::vector<String*> candidates;
+  for (Page* p : *heap()->old_space()) {
+    const MarkingState state = MarkingState::Internal(p);
+    for (auto object_and_size : LiveObjectRange<kBlackObjects>(p, state)) {
+      HeapObject* object = object_and_size.first;
+      if (object_and_size.second <= ThinString::kSize) continue;
+      if (!object->IsSeqString() || object->IsInternalizedString()) continue;
+      candidates.push_back(String::cast(object));
+    }
+  }
+
+  // After clearing, the string table only holds live strings, which are
+  // canonical copies. Candidates without one are grouped by hash.
+  StringTable* table = heap()->string_table();
+  std::unordered_map<uint32_t, std::vector<String*>> pending;
+  int deduplicated = 0;
+  int canonicalized = 0;
+  size_t freed_bytes = 0;
+  for (String* string : candidates) {
+    string->Hash();
+    DeduplicationKey key(string);
+    int entry = table->FindEntry(isolate(), &key);
+    if (entry != StringTable::kNotFound) {
+      freed_bytes +=
+          MakeThinForDeduplication(string, String::cast(table->KeyAt(entry)));
+      deduplicated++;
+    } else {
+      pending[string->hash_field()].push_back(string);
+    }
+  }
+
+  for (auto& group : pending) {
+    std::vector<String*>& strings = group.second;
+    if (strings.size() < 2) continue;
+    for (size_t i = 0; i < strings.size(); i++) {
+      String* canonical = strings[i];
+      if (canonical == nullptr) continue;
+      bool internalized = false;
+      for (size_t j = i + 1; j < strings.size(); j++) {
+        String* string = strings[j];
+        if (string == nullptr || !canonical->Equals(string)) continue;
+        if (!internalized) {
+          // Without room in the string table, the canonical copy cannot be
+          // internalized and nothing can point to it.
+          if (!InternalizeForDeduplication(canonical)) break;
+          internalized = true;
+          canonicalized++;
+        }
+        freed_bytes += MakeThinForDeduplication(string, canonical);
+        deduplicated++;
+        strings[j] = nullptr;
+      }
+    }
+  }
+
+  if (FLAG_trace_string_deduplication) {
+    isolate()->PrintWithTimestamp(
+        "String deduplication: %zu candidates, %d deduplicated, %d "
+        "canonicalized, %zu KB freed\n",
+        candidates.size(), deduplicated, canonicalized, freed_bytes / KB);
+  }
+}
+
+int MarkCompactCollector::MakeThinForDeduplication(String* string,
+                                                   String* canonical) {
+  DisallowHeapAllocation no_allocation;
+  DCHECK(canonical->IsInternalizedString());
+  heap()->NotifyObjectLayoutChange(string, no_allocation);
+  int old_size = string->Size();
+  Map* map = canonical->IsOneByteRepresentation()
+                 ? heap()->thin_one_byte_string_map()
+                 : heap()->thin_string_map();
+  string->synchronized_set_map(map);
+  ThinString* thin = ThinString::cast(string);
+  thin->set_actual(canonical, SKIP_WRITE_BARRIER);
+  RecordSlot(thin, HeapObject::RawField(thin, ThinString::kActualOffset),
+             canonical);
+  int size_delta = old_size - ThinString::kSize;
+  heap()->CreateFillerObjectAt(thin->address() + ThinString::kSize, size_delta,
+                               ClearRecordedSlots::kNo);
+  heap()->AdjustLiveBytes(thin, -size_delta);
+  return size_delta;
+}
+
+bool MarkCompactCollector::InternalizeForDeduplication(String* string) {
+  StringTable* table = heap()->string_table();
+  if (!table->HasSufficientCapacityToAdd(1)) return false;
+  // Sequential strings in old space can be internalized in place.
+  string->synchronized_set_map(string->IsOneByteRepresentation()
+                                   ? heap()->one_byte_internalized_string_map()
+                                   : heap()->internalized_string_map());
+  int entry = table->AddWithoutGrowing(string);
+  DCHECK_NE(StringTable::kNotFound, entry);
+  RecordSlot(table,
+             table->RawFieldOfElementAt(StringTable::EntryToIndex(entry)),
+             string);
+  return true;
+}
 
 void MarkCompactCollector::MarkDependentCodeForDeoptimization(
     DependentCode* list_head) {
@@ -3178,8 +3385,10 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 
 
 void MarkCompactCollector::ProcessWeakCollections() {
+  // New weak collections are prepended to the list, so the ones that have not
+  // been scanned yet are in front of the previous head.
   Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::kZero) {
+  while (weak_collection_obj != processed_weak_collections_) {
     JSWeakCollection* weak_collection =
         reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
     DCHECK(ObjectMarking::IsBlackOrGrey(
@@ -3190,42 +3399,196 @@ void MarkCompactCollector::ProcessWeakCollections() {
         HeapObject* heap_object = HeapObject::cast(table->KeyAt(i));
         if (ObjectMarking::IsBlackOrGrey(heap_object,
                                          MarkingState::Internal(heap_object))) {
-          Object** key_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i));
-          RecordSlot(table, key_slot, *key_slot);
-          Object** value_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i));
-          MarkCompactMarkingVisitor::MarkObjectByPointer(this, table,
-                                                         value_slot);
+          MarkEphemeronValue(table, i);
+        } else {
+          ephemerons_.insert(std::make_pair(heap_object, Ephemeron{table, i}));
         }
       }
     }
     weak_collection_obj = weak_collection->next();
   }
+  processed_weak_collections_ = heap()->encountered_weak_collections();
 }
 
+void MarkCompactCollector::MarkEphemeronValue(ObjectHashTable* table,
+                                              int entry) {
+  Object** key_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(entry));
+  RecordSlot(table, key_slot, *key_slot);
+  Object** value_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(entry));
+  MarkCompactMarkingVisitor::MarkObjectByPointer(this, table, value_slot);
+}
 
-void MarkCompactCollector::ClearWeakCollections() {
-  TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
-  Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::kZero) {
-    JSWeakCollection* weak_collection =
-        reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
-    DCHECK(ObjectMarking::IsBlackOrGrey(
-        weak_collection, MarkingState::Internal(weak_collection)));
-    if (weak_collection->table()->IsHashTable()) {
-      ObjectHashTable* table = ObjectHashTable::cast(weak_collection->table());
-      for (int i = 0; i < table->Capacity(); i++) {
-        HeapObject* key = HeapObject::cast(table->KeyAt(i));
-        if (!ObjectMarking::IsBlackOrGrey(key, MarkingState::Internal(key))) {
-          table->RemoveEntry(i);
-        }
+void MarkCompactCollector::ProcessEphemeronsForKey(HeapObject* key) {
+  auto range = ephemerons_.equal_range(key);
+  if (range.first == range.second) return;
+  // Marking the values only pushes them on the marking stack, so the map is
+  // not modified while iterating.
+  for (auto it = range.first; it != range.second; ++it) {
+    MarkEphemeronValue(it->second.table, it->second.entry);
+  }
+  ephemerons_.erase(range.first, range.second);
+}
+
+bool MarkCompactCollector::ProcessMarkedEphemeronKeys() {
+  bool marked = false;
+  for (auto it = ephemerons_.begin(); it != ephemerons_.end();) {
+    HeapObject* key = it->first;
+    if (ObjectMarking::IsBlackOrGrey(key, MarkingState::Internal(key))) {
+      MarkEphemeronValue(it->second.table, it->second.entry);
+      it = ephemerons_.erase(it);
+      marked = true;
+    } else {
+      ++it;
+    }
+  }
+  return marked;
+}
+
+
+class ClearingItem : public ItemParallelJob::Item {
+ public:
+  virtual ~ClearingItem() {}
+  virtual void Process() = 0;
+};
+
+class ClearingTask : public ItemParallelJob::Task {
+ public:
+  explicit ClearingTask(Isolate* isolate) : ItemParallelJob::Task(isolate) {}
+
+  void RunInParallel() override {
+    ClearingItem* item = nullptr;
+    while ((item = GetItem<ClearingItem>()) != nullptr) {
+      item->Process();
+      item->MarkFinished();
+    }
+  }
+};
+
+// Removes the unmarked strings in a range of string table entries.
+class StringTableClearingItem : public ClearingItem {
+ public:
+  StringTableClearingItem(Heap* heap, StringTable* table, int start, int end,
+                          base::AtomicNumber<int>* removed)
+      : heap_(heap),
+        table_(table),
+        start_(start),
+        end_(end),
+        removed_(removed) {}
+
+  void Process() override {
+    // Cannot use string_table() here because the string table is marked.
+    InternalizedStringTableCleaner cleaner(heap_, table_);
+    cleaner.VisitPointers(
+        table_, table_->RawFieldOfElementAt(StringTable::EntryToIndex(start_)),
+        table_->RawFieldOfElementAt(StringTable::EntryToIndex(end_)));
+    removed_->Increment(cleaner.PointersRemoved());
+  }
+
+ private:
+  Heap* heap_;
+  StringTable* table_;
+  int start_;
+  int end_;
+  base::AtomicNumber<int>* removed_;
+};
+
+// Removes the entries with an unmarked key in a range of entries of a weak
+// collection's table. The element counts of the table are updated on the
+// main thread once all items are done.
+class WeakCollectionClearingItem : public ClearingItem {
+ public:
+  WeakCollectionClearingItem(ObjectHashTable* table, int start, int end,
+                             base::AtomicNumber<int>* removed)
+      : table_(table), start_(start), end_(end), removed_(removed) {}
+
+  void Process() override {
+    int removed = 0;
+    for (int i = start_; i < end_; i++) {
+      HeapObject* key = HeapObject::cast(table_->KeyAt(i));
+      if (!ObjectMarking::IsBlackOrGrey(key, MarkingState::Internal(key))) {
+        table_->set_the_hole(ObjectHashTable::EntryToIndex(i));
+        table_->set_the_hole(ObjectHashTable::EntryToIndex(i) + 1);
+        removed++;
       }
     }
-    weak_collection_obj = weak_collection->next();
-    weak_collection->set_next(heap()->undefined_value());
+    removed_->Increment(removed);
+  }
+
+ private:
+  ObjectHashTable* table_;
+  int start_;
+  int end_;
+  base::AtomicNumber<int>* removed_;
+};
+
+void MarkCompactCollector::ClearStringTableAndWeakCollections() {
+  TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_TABLES);
+  // Large tables are split so that idle tasks can help with them.
+  const int kEntriesPerItem = 8 * KB;
+  ItemParallelJob job(isolate()->cancelable_task_manager(),
+                      &page_parallel_job_semaphore_);
+  int items = 0;
+
+  StringTable* string_table = heap()->string_table();
+  base::AtomicNumber<int> strings_removed(0);
+  for (int start = 0; start < string_table->Capacity();
+       start += kEntriesPerItem) {
+    int end = Min(start + kEntriesPerItem, string_table->Capacity());
+    job.AddItem(new StringTableClearingItem(heap(), string_table, start, end,
+                                            &strings_removed));
+    items++;
+  }
+
+  std::vector<ObjectHashTable*> weak_tables;
+  {
+    TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+    Object* weak_collection_obj = heap()->encountered_weak_collections();
+    while (weak_collection_obj != Smi::kZero) {
+      JSWeakCollection* weak_collection =
+          reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
+      DCHECK(ObjectMarking::IsBlackOrGrey(
+          weak_collection, MarkingState::Internal(weak_collection)));
+      if (weak_collection->table()->IsHashTable()) {
+        weak_tables.push_back(ObjectHashTable::cast(weak_collection->table()));
+      }
+      weak_collection_obj = weak_collection->next();
+      weak_collection->set_next(heap()->undefined_value());
+    }
+    heap()->set_encountered_weak_collections(Smi::kZero);
+    // The remaining ephemerons have dead keys and are cleared below.
+    ephemerons_.clear();
+    processed_weak_collections_ = Smi::kZero;
+  }
+  std::unique_ptr<base::AtomicNumber<int>[]> entries_removed(
+      new base::AtomicNumber<int>[weak_tables.size()]);
+  for (size_t i = 0; i < weak_tables.size(); i++) {
+    ObjectHashTable* table = weak_tables[i];
+    for (int start = 0; start < table->Capacity(); start += kEntriesPerItem) {
+      int end = Min(start + kEntriesPerItem, table->Capacity());
+      job.AddItem(new WeakCollectionClearingItem(table, start, end,
+                                                 &entries_removed[i]));
+      items++;
+    }
+  }
+
+  const int kMaxClearingTasks = 8;
+  const int num_tasks =
+      FLAG_parallel_weak_clearing
+          ? Min(kMaxClearingTasks, Min(NumberOfAvailableCores(), items))
+          : 1;
+  for (int i = 0; i < num_tasks; i++) {
+    job.AddTask(new ClearingTask(isolate()));
+  }
+  job.Run();
+  heap()->tracer()->AddParallelJob(GCTracer::Scope::MC_CLEAR_WEAK_TABLES,
+                                   job.stats());
+
+  string_table->ElementsRemoved(strings_removed.Value());
+  for (size_t i = 0; i < weak_tables.size(); i++) {
+    weak_tables[i]->ElementsRemoved(entries_removed[i].Value());
   }
-  heap()->set_encountered_weak_collections(Smi::kZero);
 }
 
 
@@ -3238,6 +3601,8 @@ void MarkCompactCollector::AbortWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::kZero);
+  ephemerons_.clear();
+  processed_weak_collections_ = Smi::kZero;
 }
 
 
@@ -3865,6 +4230,8 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
   RecordMigratedSlotVisitor record_visitor(this);
   CreateAndExecuteEvacuationTasks<FullEvacuator>(
       this, &evacuation_job, &record_visitor, nullptr, live_bytes);
+  heap()->tracer()->AddParallelJob(GCTracer::Scope::MC_EVACUATE_COPY,
+                                   evacuation_job.stats());
   PostProcessEvacuationCandidates();
 }
 
@@ -3894,6 +4261,8 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
       heap()->mark_compact_collector());
   CreateAndExecuteEvacuationTasks<YoungGenerationEvacuator>(
       this, &evacuation_job, &record_visitor, &observer, live_bytes);
+  heap()->tracer()->AddParallelJob(GCTracer::Scope::MINOR_MC_EVACUATE_COPY,
+                                   evacuation_job.stats());
 }
 
 class EvacuationWeakObjectRetainer : public WeakObjectRetainer {
@@ -4154,6 +4523,7 @@ void MarkCompactCollector::Evacuate() {
     EvacuationScope evacuation_scope(this);
     EvacuatePagesInParallel();
   }
+  heap()->array_buffer_collector()->FreeAllocationsOnBackgroundThread();
 
   UpdatePointersAfterEvacuation();
 
@@ -4216,6 +4586,9 @@ class UpdatingItem : public ItemParallelJob::Item {
  public:
   virtual ~UpdatingItem() {}
   virtual void Process() = 0;
+  // Splits off parts of the item that can be processed independently and
+  // pushes them as new items to the task, so that idle tasks can steal them.
+  virtual void Split(ItemParallelJob::Task* task) {}
 };
 
 class PointersUpatingTask : public ItemParallelJob::Task {
@@ -4226,6 +4599,7 @@ class PointersUpatingTask : public ItemParallelJob::Task {
   void RunInParallel() override {
     UpdatingItem* item = nullptr;
     while ((item = GetItem<UpdatingItem>()) != nullptr) {
+      item->Split(this);
       item->Process();
       item->MarkFinished();
     }
@@ -4252,7 +4626,35 @@ class ToSpaceUpdatingItem : public UpdatingItem {
     }
   }
 
+  void Split(ItemParallelJob::Task* task) override {
+    // Live object iteration cannot be split at arbitrary object boundaries.
+    if (chunk_->IsFlagSet(Page::PAGE_NEW_NEW_PROMOTION)) return;
+    if (end_ - start_ <= 2 * kChunkSize) return;
+    // Cut the range at object boundaries into chunks of roughly kChunkSize
+    // bytes. This item keeps the first chunk.
+    Address first_chunk_end = nullptr;
+    Address chunk_start = start_;
+    for (Address cur = start_; cur < end_;) {
+      cur += HeapObject::FromAddress(cur)->Size();
+      if (cur - chunk_start >= kChunkSize && cur < end_) {
+        if (first_chunk_end == nullptr) {
+          first_chunk_end = cur;
+        } else {
+          task->PushItem(new ToSpaceUpdatingItem(chunk_, chunk_start, cur,
+                                                 marking_state_));
+        }
+        chunk_start = cur;
+      }
+    }
+    if (first_chunk_end == nullptr) return;
+    task->PushItem(
+        new ToSpaceUpdatingItem(chunk_, chunk_start, end_, marking_state_));
+    end_ = first_chunk_end;
+  }
+
  private:
+  static const int kChunkSize = 64 * KB;
+
   void ProcessVisitAll() {
     PointersUpdatingVisitor visitor;
     for (Address cur = start_; cur < end_;) {
@@ -4500,6 +4902,9 @@ void MarkCompactCollector::UpdatePointersAfterEvacuation() {
     TRACE_GC(heap()->tracer(),
              GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_SLOTS);
     updating_job.Run();
+    heap()->tracer()->AddParallelJob(
+        GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_SLOTS,
+        updating_job.stats());
   }
 
   {
@@ -4542,6 +4947,9 @@ void MinorMarkCompactCollector::UpdatePointersAfterEvacuation() {
     TRACE_GC(heap()->tracer(),
              GCTracer::Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_SLOTS);
     updating_job.Run();
+    heap()->tracer()->AddParallelJob(
+        GCTracer::Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_SLOTS,
+        updating_job.stats());
   }
 
   {
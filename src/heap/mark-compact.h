@@ -6,6 +6,8 @@
 #define V8_HEAP_MARK_COMPACT_H_
 
 #include <deque>
+#include <unordered_map>
+#include <vector>
 
 #include "src/base/bits.h"
 #include "src/base/platform/condition-variable.h"
@@ -420,6 +422,9 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
     int ParallelSweepSpace(AllocationSpace identity, int required_freed_bytes,
                            int max_pages = 0);
     int ParallelSweepPage(Page* page, AllocationSpace identity);
+    // Sweeps the paged spaces in the order used by the sweeper tasks. Stops
+    // after |max_pages| pages if |max_pages| is positive.
+    void SweepSpacesInTaskOrder(int max_pages);
 
     // After calling this function sweeping is considered to be in progress
     // and the main thread can sweep lazily, but the background sweeper tasks
@@ -436,6 +441,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
    private:
     static const int kAllocationSpaces = LAST_PAGED_SPACE + 1;
+    static const int kNumberOfSweeperTasks = 3;
+    static const int kPagedSpaces = LAST_PAGED_SPACE - FIRST_PAGED_SPACE + 1;
+    // Order in which the sweeper tasks sweep the paged spaces.
+    static const AllocationSpace kSweepingOrder[kPagedSpaces];
 
     static ClearOldToNewSlotsMode GetClearOldToNewSlotsMode(Page* p);
 
@@ -522,6 +531,16 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
   bool is_compacting() const { return compacting_; }
 
+  // True if the current full GC treats old bytecode weakly and flushes it.
+  bool is_flushing_bytecode() const { return flushing_bytecode_; }
+
+  void AddBytecodeFlushingCandidate(SharedFunctionInfo* shared) {
+    bytecode_flushing_candidates_.push_back(shared);
+  }
+  void AddBytecodeFlushingCandidate(JSFunction* function) {
+    bytecode_flushing_function_candidates_.push_back(function);
+  }
+
   // Ensures that sweeping is finished.
   //
   // Note: Can only be called safely from main thread.
@@ -635,6 +654,12 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // and deoptimize dependent code of non-live maps.
   void ClearNonLiveReferences() override;
   void MarkDependentCodeForDeoptimization(DependentCode* list);
+  // Turns live non-internalized sequential strings in old space that are
+  // equal to another string into ThinStrings, see --string-deduplication.
+  void DeduplicateStrings();
+  // Returns the number of bytes freed.
+  int MakeThinForDeduplication(String* string, String* canonical);
+  bool InternalizeForDeduplication(String* string);
   // Find non-live targets of simple transitions in the given list. Clear
   // transitions to non-live targets and if needed trim descriptors arrays.
   void ClearSimpleMapTransitions(Object* non_live_map_list);
@@ -648,14 +673,32 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void TrimEnumCache(Map* map, DescriptorArray* descriptors);
 
   // Mark all values associated with reachable keys in weak collections
-  // encountered so far.  This might push new object or even new weak maps onto
-  // the marking stack.
+  // encountered since the last call.  Entries with a key that is not marked
+  // yet are remembered in |ephemerons_|, so every table is scanned only once
+  // per GC.  This might push new object or even new weak maps onto the
+  // marking stack.
   void ProcessWeakCollections();
 
-  // After all reachable objects have been marked those weak map entries
-  // with an unreachable key are removed from all encountered weak maps.
-  // The linked list of all encountered weak maps is destroyed.
-  void ClearWeakCollections();
+  // Marks the value of the ephemeron at |entry| whose key is live.
+  void MarkEphemeronValue(ObjectHashTable* table, int entry);
+
+  // Called for every object whose body is visited during the atomic pause.
+  // Marks the values of all remembered ephemerons keyed by |key|.
+  V8_INLINE void VisitEphemeronKey(HeapObject* key) {
+    if (!ephemerons_.empty()) ProcessEphemeronsForKey(key);
+  }
+  void ProcessEphemeronsForKey(HeapObject* key);
+
+  // Marks the values of remembered ephemerons whose key got marked without
+  // its body being visited by the collector.  Returns true if any value was
+  // marked.
+  bool ProcessMarkedEphemeronKeys();
+
+  // After all reachable objects have been marked, strings that are only
+  // referenced by the string table and weak map entries with an unreachable
+  // key are removed. The tables are split into chunks that are cleared in
+  // parallel. The linked list of all encountered weak maps is destroyed.
+  void ClearStringTableAndWeakCollections();
 
   // We have to remove all encountered weak maps from the list of weak
   // collections when incremental marking is aborted.
@@ -667,6 +710,13 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
   void AbortTransitionArrays();
 
+  // Returns true if bytecode may be flushed during the upcoming full GC.
+  bool ShouldFlushBytecode();
+
+  // Replaces the unmarked bytecode of flushing candidates by lazy compilation
+  // and resets the closures of flushed functions.
+  void FlushBytecode();
+
   // Starts sweeping of spaces by contributing on the main thread and setting
   // up other pages for sweeping. Does not start sweeper tasks.
   void StartSweepSpaces();
@@ -710,8 +760,25 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
   bool have_code_to_deoptimize_;
 
+  bool flushing_bytecode_;
+
+  // Functions and closures whose bytecode may be flushed in this GC.
+  std::vector<SharedFunctionInfo*> bytecode_flushing_candidates_;
+  std::vector<JSFunction*> bytecode_flushing_function_candidates_;
+
   MarkingWorklist marking_worklist_;
 
+  // Weak map entries whose key was unmarked when the backing table was
+  // scanned, indexed by key.
+  struct Ephemeron {
+    ObjectHashTable* table;
+    int entry;
+  };
+  std::unordered_multimap<HeapObject*, Ephemeron> ephemerons_;
+  // Head of the list of encountered weak collections at the time of the last
+  // ProcessWeakCollections call.  Collections after it have been scanned.
+  Object* processed_weak_collections_;
+
   // Candidates for pages that should be evacuated.
   List<Page*> evacuation_candidates_;
   // Pages that are actually processed during evacuation.
@@ -19,6 +19,7 @@ const int MemoryReducer::kWatchdogDelayMs = 100000;
 const int MemoryReducer::kMaxNumberOfGCs = 3;
 const double MemoryReducer::kCommittedMemoryFactor = 1.1;
 const size_t MemoryReducer::kCommittedMemoryDelta = 10 * MB;
+const double MemoryReducer::kMemoryTargetRatio = 0.9;
 
 MemoryReducer::TimerTask::TimerTask(MemoryReducer* memory_reducer)
     : CancelableTask(memory_reducer->heap()->isolate()),
@@ -33,22 +34,27 @@ void MemoryReducer::TimerTask::RunInternal() {
                                    heap->OldGenerationAllocationCounter());
   bool low_allocation_rate = heap->HasLowAllocationRate();
   bool optimize_for_memory = heap->ShouldOptimizeForMemoryUsage();
+  memory_reducer_->SampleResidentSetSize();
+  bool near_memory_target = memory_reducer_->IsNearMemoryTarget();
   if (FLAG_trace_gc_verbose) {
     heap->isolate()->PrintWithTimestamp(
-        "Memory reducer: %s, %s\n",
+        "Memory reducer: %s, %s%s\n",
         low_allocation_rate ? "low alloc" : "high alloc",
-        optimize_for_memory ? "background" : "foreground");
+        optimize_for_memory ? "background" : "foreground",
+        near_memory_target ? ", near memory target" : "");
   }
   event.type = kTimer;
   event.time_ms = time_ms;
   // The memory reducer will start incremental markig if
   // 1) mutator is likely idle: js call rate is low and allocation rate is low.
   // 2) mutator is in background: optimize for memory flag is set.
+  // 3) the process is close to the memory target set by the embedder.
   event.should_start_incremental_gc =
-      low_allocation_rate || optimize_for_memory;
+      low_allocation_rate || optimize_for_memory || near_memory_target;
   event.can_start_incremental_gc =
       heap->incremental_marking()->IsStopped() &&
-      (heap->incremental_marking()->CanBeActivated() || optimize_for_memory);
+      (heap->incremental_marking()->CanBeActivated() || optimize_for_memory ||
+       near_memory_target);
   event.committed_memory = heap->CommittedOldGenerationMemory();
   memory_reducer_->NotifyTimer(event);
 }
@@ -210,6 +216,51 @@ void MemoryReducer::ScheduleTimer(double time_ms, double delay_ms) {
       isolate, timer_task, (delay_ms + kSlackMs) / 1000.0);
 }
 
+void MemoryReducer::SetMemoryTarget(v8::MemoryTarget* target) {
+  memory_target_ = target;
+  resident_set_size_at_sample_ = 0;
+  committed_memory_at_sample_ = 0;
+  if (memory_target_ != nullptr) SampleResidentSetSize();
+}
+
+void MemoryReducer::SampleResidentSetSize() {
+  if (memory_target_ == nullptr) return;
+  committed_memory_at_sample_ = heap()->CommittedMemory();
+  size_t rss = memory_target_->CurrentResidentSetSize();
+  if (rss == 0) {
+    rss = committed_memory_at_sample_ +
+          static_cast<size_t>(Max<int64_t>(heap()->external_memory(), 0));
+  }
+  resident_set_size_at_sample_ = rss;
+}
+
+size_t MemoryReducer::EstimatedResidentSetSize() {
+  size_t committed_memory = heap()->CommittedMemory();
+  if (committed_memory <= committed_memory_at_sample_) {
+    return resident_set_size_at_sample_;
+  }
+  return resident_set_size_at_sample_ +
+         (committed_memory - committed_memory_at_sample_);
+}
+
+bool MemoryReducer::IsNearMemoryTarget() {
+  if (memory_target_ == nullptr) return false;
+  size_t target = memory_target_->TargetResidentSetSize();
+  return EstimatedResidentSetSize() > target * kMemoryTargetRatio;
+}
+
+size_t MemoryReducer::MemoryTargetHeadroom() {
+  if (memory_target_ == nullptr) return SIZE_MAX;
+  size_t target = memory_target_->TargetResidentSetSize();
+  size_t rss = EstimatedResidentSetSize();
+  return rss < target ? target - rss : 0;
+}
+
+size_t MemoryReducer::ExternalMemoryBudget() {
+  if (memory_target_ == nullptr) return 0;
+  return memory_target_->ExternalMemoryBudget();
+}
+
 void MemoryReducer::TearDown() { state_ = State(kDone, 0, 0, 0.0, 0); }
 
 }  // namespace internal
@@ -11,6 +11,9 @@
 #include "src/globals.h"
 
 namespace v8 {
+
+class MemoryTarget;
+
 namespace internal {
 
 class Heap;
@@ -114,7 +117,10 @@ class V8_EXPORT_PRIVATE MemoryReducer {
       : heap_(heap),
         state_(kDone, 0, 0.0, 0.0, 0),
         js_calls_counter_(0),
-        js_calls_sample_time_ms_(0.0) {}
+        js_calls_sample_time_ms_(0.0),
+        memory_target_(nullptr),
+        resident_set_size_at_sample_(0),
+        committed_memory_at_sample_(0) {}
   // Callbacks.
   void NotifyMarkCompact(const Event& event);
   void NotifyPossibleGarbage(const Event& event);
@@ -135,6 +141,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   // The committed memory has to increase by at least this amount since the
   // last run in order to trigger a new run after mark-compact.
   static const size_t kCommittedMemoryDelta;
+  // The memory reducer treats the process as being near its memory target
+  // once the estimated resident set size exceeds this fraction of it.
+  static const double kMemoryTargetRatio;
 
   Heap* heap() { return heap_; }
 
@@ -142,6 +151,26 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     return state_.action == kDone && state_.started_gcs > 0;
   }
 
+  void SetMemoryTarget(v8::MemoryTarget* target);
+  bool HasMemoryTarget() const { return memory_target_ != nullptr; }
+
+  // Samples the resident set size from the embedder. Between samples the
+  // resident set size is estimated from the change in committed heap memory.
+  void SampleResidentSetSize();
+  size_t EstimatedResidentSetSize();
+
+  // Returns true if a memory target is set and the estimated resident set
+  // size is above kMemoryTargetRatio of it.
+  bool IsNearMemoryTarget();
+
+  // Returns the number of bytes the resident set size may grow before it
+  // reaches the memory target, or SIZE_MAX if no target is set.
+  size_t MemoryTargetHeadroom();
+
+  // Returns the external memory budget of the memory target, or 0 if there
+  // is none.
+  size_t ExternalMemoryBudget();
+
  private:
   class TimerTask : public v8::internal::CancelableTask {
    public:
@@ -162,6 +191,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   State state_;
   unsigned int js_calls_counter_;
   double js_calls_sample_time_ms_;
+  v8::MemoryTarget* memory_target_;
+  size_t resident_set_size_at_sample_;
+  size_t committed_memory_at_sample_;
 
   // Used in cctest.
   friend class HeapTester;
@@ -539,6 +539,27 @@ void StaticMarkingVisitor<StaticVisitor>::VisitCode(Map* map,
 }
 
 
+inline static bool HasSourceCode(Heap* heap, SharedFunctionInfo* info) {
+  Object* undefined = heap->undefined_value();
+  return (info->script() != undefined) &&
+         (reinterpret_cast<Script*>(info->script())->source() != undefined);
+}
+
+// Returns true if the bytecode of {shared} is old and can be regenerated from
+// source by lazy compilation.
+inline static bool IsFlushableBytecode(Heap* heap, SharedFunctionInfo* shared) {
+  if (!shared->HasBytecodeArray() || !shared->IsInterpreted()) return false;
+  if (!shared->bytecode_array()->IsOld()) return false;
+  if (!shared->allows_lazy_compilation()) return false;
+  if (!HasSourceCode(heap, shared)) return false;
+  // Top-level code and resumable functions may have live activations that
+  // are not visible on the stack.
+  if (shared->is_toplevel() || IsResumableFunction(shared->kind())) {
+    return false;
+  }
+  return !shared->HasDebugInfo();
+}
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
     Map* map, HeapObject* object) {
@@ -547,6 +568,24 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
   if (shared->ic_age() != heap->global_ic_age()) {
     shared->ResetForNewContext(heap->global_ic_age());
   }
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  if (collector->is_flushing_bytecode() && IsFlushableBytecode(heap, shared)) {
+    // Treat the bytecode as a weak reference. The collector flushes it after
+    // marking unless something else kept it alive.
+    Object** data_slot =
+        HeapObject::RawField(object, SharedFunctionInfo::kFunctionDataOffset);
+    StaticVisitor::VisitPointers(
+        heap, object,
+        HeapObject::RawField(object, SharedFunctionInfo::kCodeOffset),
+        data_slot);
+    StaticVisitor::VisitPointers(
+        heap, object, data_slot + 1,
+        HeapObject::RawField(object,
+                             SharedFunctionInfo::kEndOfPointerFieldsOffset));
+    collector->RecordSlot(object, data_slot, *data_slot);
+    collector->AddBytecodeFlushingCandidate(shared);
+    return;
+  }
   FixedBodyVisitor<StaticVisitor, SharedFunctionInfo::BodyDescriptor,
                    void>::Visit(map, object);
 }
@@ -555,6 +594,15 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitJSFunction(Map* map,
                                                           HeapObject* object) {
+  Heap* heap = map->GetHeap();
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  if (collector->is_flushing_bytecode()) {
+    JSFunction* function = JSFunction::cast(object);
+    SharedFunctionInfo* shared = function->shared();
+    if (shared->HasBytecodeArray() && shared->bytecode_array()->IsOld()) {
+      collector->AddBytecodeFlushingCandidate(function);
+    }
+  }
   FlexibleBodyVisitor<StaticVisitor, JSFunction::BodyDescriptorWeak,
                       void>::Visit(map, object);
 }
@@ -594,12 +642,6 @@ void StaticMarkingVisitor<StaticVisitor>::MarkMapContents(Heap* heap,
 }
 
 
-inline static bool HasSourceCode(Heap* heap, SharedFunctionInfo* info) {
-  Object* undefined = heap->undefined_value();
-  return (info->script() != undefined) &&
-         (reinterpret_cast<Script*>(info->script())->source() != undefined);
-}
-
 template <typename ResultType, typename ConcreteVisitor>
 ResultType HeapVisitor<ResultType, ConcreteVisitor>::Visit(HeapObject* object) {
   return Visit(object->map(), object);
@@ -0,0 +1,141 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/pretenuring-decisions.h"
+
+#include <cstring>
+
+#include "src/feedback-vector-inl.h"
+#include "src/flags.h"
+#include "src/heap/heap.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/snapshot/code-cache-directory.h"
+#include "src/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+template <typename T>
+void Append(std::vector<byte>* data, T value) {
+  const byte* bytes = reinterpret_cast<const byte*>(&value);
+  data->insert(data->end(), bytes, bytes + sizeof(value));
+}
+
+template <typename T>
+T Read(const byte** data) {
+  T value;
+  memcpy(&value, *data, sizeof(value));
+  *data += sizeof(value);
+  return value;
+}
+
+}  // namespace
+
+std::vector<byte> PretenuringDecisions::Serialize() {
+  Isolate* isolate = heap_->isolate();
+  HandleScope scope(isolate);
+
+  // Source hashes are computed after iterating the heap, as flattening the
+  // source may allocate.
+  struct Entry {
+    Handle<Script> script;
+    int function_position;
+    int slot;
+  };
+  std::vector<Entry> entries;
+  {
+    HeapIterator iterator(heap_);
+    while (HeapObject* obj = iterator.next()) {
+      if (!obj->IsFeedbackVector()) continue;
+      FeedbackVector* vector = FeedbackVector::cast(obj);
+      SharedFunctionInfo* shared = vector->shared_function_info();
+      if (!shared->script()->IsScript()) continue;
+      FeedbackMetadataIterator it(vector->metadata());
+      while (it.HasNext()) {
+        FeedbackSlot slot = it.Next();
+        if (it.kind() != FeedbackSlotKind::kLiteral) continue;
+        Object* literal_site = vector->Get(slot);
+        if (!literal_site->IsAllocationSite()) continue;
+        AllocationSite* site = AllocationSite::cast(literal_site);
+        if (site->pretenure_decision() != AllocationSite::kTenure) continue;
+        entries.push_back({handle(Script::cast(shared->script()), isolate),
+                           shared->start_position(), slot.ToInt()});
+      }
+    }
+  }
+
+  std::vector<byte> data;
+  data.reserve(kHeaderSize + entries.size() * kEntrySize);
+  Append<uint32_t>(&data, kMagicNumber);
+  Append<uint32_t>(&data, Version::Hash());
+  Append<uint32_t>(&data, FlagList::Hash());
+  Append<uint32_t>(&data, static_cast<uint32_t>(entries.size()));
+  for (const Entry& entry : entries) {
+    Append<uint64_t>(&data, SourceHash(entry.script));
+    Append<int32_t>(&data, entry.function_position);
+    Append<int32_t>(&data, entry.slot);
+  }
+  return data;
+}
+
+bool PretenuringDecisions::Load(const byte* data, size_t length) {
+  decisions_.clear();
+  if (length < kHeaderSize) return false;
+  const byte* cursor = data;
+  if (Read<uint32_t>(&cursor) != kMagicNumber) return false;
+  if (Read<uint32_t>(&cursor) != Version::Hash()) return false;
+  if (Read<uint32_t>(&cursor) != FlagList::Hash()) return false;
+  size_t count = Read<uint32_t>(&cursor);
+  if ((length - kHeaderSize) / kEntrySize < count) return false;
+  for (size_t i = 0; i < count; i++) {
+    Key key;
+    key.source_hash = Read<uint64_t>(&cursor);
+    key.function_position = Read<int32_t>(&cursor);
+    key.slot = Read<int32_t>(&cursor);
+    decisions_.insert(key);
+  }
+  if (FLAG_trace_pretenuring) {
+    PrintIsolate(heap_->isolate(), "pretenuring: loaded %zu decisions\n",
+                 decisions_.size());
+  }
+  return true;
+}
+
+void PretenuringDecisions::Apply(Handle<SharedFunctionInfo> shared,
+                                 FeedbackSlot slot,
+                                 Handle<AllocationSite> site) {
+  if (is_empty() || !FLAG_allocation_site_pretenuring) return;
+  if (!shared->script()->IsScript()) return;
+  DCHECK_EQ(AllocationSite::kUndecided, site->pretenure_decision());
+  Key key;
+  key.source_hash =
+      SourceHash(handle(Script::cast(shared->script()), heap_->isolate()));
+  key.function_position = shared->start_position();
+  key.slot = slot.ToInt();
+  if (decisions_.find(key) == decisions_.end()) return;
+  site->set_pretenure_decision(AllocationSite::kTenure);
+  if (FLAG_trace_pretenuring) {
+    PrintIsolate(heap_->isolate(),
+                 "pretenuring: AllocationSite(%p) tenured by loaded decision\n",
+                 static_cast<void*>(*site));
+  }
+}
+
+uint64_t PretenuringDecisions::SourceHash(Handle<Script> script) {
+  auto it = source_hashes_.find(script->id());
+  if (it != source_hashes_.end()) return it->second;
+  uint64_t hash = 0;
+  if (script->source()->IsString()) {
+    hash = CodeCacheDirectory::SourceHash(
+        handle(String::cast(script->source()), heap_->isolate()));
+  }
+  source_hashes_.emplace(script->id(), hash);
+  return hash;
+}
+
+}  // namespace internal
+}  // namespace v8
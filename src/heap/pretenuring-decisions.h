@@ -0,0 +1,92 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PRETENURING_DECISIONS_H_
+#define V8_HEAP_PRETENURING_DECISIONS_H_
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/feedback-vector.h"
+#include "src/globals.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class AllocationSite;
+class Heap;
+class Script;
+class SharedFunctionInfo;
+
+// Pretenuring decisions for object and array literals that outlive the
+// isolate they were made in. A decision is keyed by a hash of the script
+// source, the start position of the enclosing function and the literal's
+// feedback slot, so that the same script loaded into a new isolate, possibly
+// in a different process, finds it again. Decisions that are loaded into an
+// isolate are applied to the AllocationSite of a literal when the literal's
+// boilerplate is created, which saves relearning them from allocation
+// mementos.
+class PretenuringDecisions {
+ public:
+  explicit PretenuringDecisions(Heap* heap) : heap_(heap) {}
+
+  // Returns the decisions for all literal sites in the heap that are
+  // currently pretenured, in the format accepted by Load().
+  std::vector<byte> Serialize();
+
+  // Replaces the loaded decisions with those in {data}. Returns false and
+  // leaves no decisions loaded if {data} is malformed or was produced by a
+  // different V8 version or flag configuration.
+  bool Load(const byte* data, size_t length);
+
+  // Marks {site}, the AllocationSite that was just created for the literal in
+  // {slot} of {shared}, as tenured if a loaded decision says so.
+  void Apply(Handle<SharedFunctionInfo> shared, FeedbackSlot slot,
+             Handle<AllocationSite> site);
+
+  bool is_empty() const { return decisions_.empty(); }
+
+ private:
+  struct Key {
+    uint64_t source_hash;
+    int32_t function_position;
+    int32_t slot;
+
+    bool operator==(const Key& other) const {
+      return source_hash == other.source_hash &&
+             function_position == other.function_position &&
+             slot == other.slot;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return base::hash_combine(key.source_hash, key.function_position,
+                                key.slot);
+    }
+  };
+
+  static const uint32_t kMagicNumber = 0xC0DE0FA5;
+  static const int kHeaderSize = 4 * sizeof(uint32_t);
+  static const int kEntrySize =
+      sizeof(uint64_t) + sizeof(int32_t) + sizeof(int32_t);
+
+  // Returns the hash of {script}'s source, which is computed once per script.
+  uint64_t SourceHash(Handle<Script> script);
+
+  Heap* heap_;
+  std::unordered_set<Key, KeyHash> decisions_;
+  // Source hashes by Script::id.
+  std::unordered_map<int, uint64_t> source_hashes_;
+
+  DISALLOW_COPY_AND_ASSIGN(PretenuringDecisions);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PRETENURING_DECISIONS_H_
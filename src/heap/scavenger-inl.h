@@ -80,6 +80,184 @@ void ScavengeVisitor::VisitPointers(HeapObject* host, Object** start,
   }
 }
 
+void ParallelScavenger::ScavengeObject(HeapObject** p, HeapObject* object) {
+  DCHECK(heap()->InFromSpace(object));
+
+  // Other tasks may concurrently install a forwarding pointer, so the map word
+  // has to be read only once.
+  MapWord first_word = object->synchronized_map_word();
+  if (first_word.IsForwardingAddress()) {
+    HeapObject* dest = first_word.ToForwardingAddress();
+    *p = dest;
+    return;
+  }
+
+  // Pretenuring feedback is collected before installing the forwarding
+  // pointer, i.e., racing tasks may both account for the same object. This
+  // is acceptable as the feedback is only a heuristic.
+  Map* map = first_word.ToMap();
+  heap()->UpdateAllocationSite<Heap::kCached>(object,
+                                              &local_pretenuring_feedback_);
+
+  // AllocationMementos are unrooted and shouldn't survive a scavenge
+  DCHECK(map != heap()->allocation_memento_map());
+  ScavengeObjectSlow(map, p, object);
+}
+
+void ParallelScavenger::ScavengeObjectSlow(Map* map, HeapObject** slot,
+                                           HeapObject* object) {
+  const int object_size = object->SizeFromMap(map);
+  SLOW_DCHECK(object_size <= Page::kAllocatableMemory);
+
+  if (!heap()->ShouldBePromoted(object->address())) {
+    // A semi-space copy may fail due to fragmentation. In that case, we
+    // try to promote the object.
+    if (SemiSpaceCopyObject(map, slot, object, object_size)) return;
+  }
+
+  if (PromoteObject(map, slot, object, object_size)) return;
+
+  // If promotion failed, we try to copy the object to the other semi-space
+  if (SemiSpaceCopyObject(map, slot, object, object_size)) return;
+
+  FatalProcessOutOfMemory("ParallelScavenger: semi-space copy\n");
+}
+
+AllocationAlignment ParallelScavenger::RequiredAlignment(Map* map,
+                                                         HeapObject* object) {
+  // Mirrors HeapObject::RequiredAlignment but uses the already loaded map, as
+  // the map word of |object| may be replaced by a forwarding pointer at any
+  // time.
+#ifdef V8_HOST_ARCH_32_BIT
+  InstanceType type = map->instance_type();
+  if ((type == FIXED_FLOAT64_ARRAY_TYPE || type == FIXED_DOUBLE_ARRAY_TYPE) &&
+      reinterpret_cast<FixedArrayBase*>(object)->length() != 0) {
+    return kDoubleAligned;
+  }
+  if (type == HEAP_NUMBER_TYPE) return kDoubleUnaligned;
+#endif  // V8_HOST_ARCH_32_BIT
+  return kWordAligned;
+}
+
+bool ParallelScavenger::MigrateObject(Map* map, HeapObject** slot,
+                                      HeapObject* source, HeapObject* target,
+                                      int size) {
+  heap()->CopyBlock(target->address(), source->address(), size);
+  MapWord forwarding = MapWord::FromForwardingAddress(target);
+  base::AtomicWord old_value = base::Release_CompareAndSwap(
+      reinterpret_cast<base::AtomicWord*>(source->address()),
+      static_cast<base::AtomicWord>(MapWord::FromMap(map).ToRawValue()),
+      static_cast<base::AtomicWord>(forwarding.ToRawValue()));
+  if (old_value !=
+      static_cast<base::AtomicWord>(MapWord::FromMap(map).ToRawValue())) {
+    // Another task won the race. The space of the copy is wasted.
+    heap()->CreateFillerObjectAt(target->address(), size,
+                                 ClearRecordedSlots::kNo);
+    MapWord winner = MapWord::FromRawValue(static_cast<uintptr_t>(old_value));
+    DCHECK(winner.IsForwardingAddress());
+    *slot = winner.ToForwardingAddress();
+    return false;
+  }
+  return true;
+}
+
+bool ParallelScavenger::SemiSpaceCopyObject(Map* map, HeapObject** slot,
+                                            HeapObject* object,
+                                            int object_size) {
+  DCHECK(heap()->AllowedToBeMigrated(object, NEW_SPACE));
+  AllocationAlignment alignment = RequiredAlignment(map, object);
+  AllocationResult allocation =
+      (object_size > kMaxLabObjectSize)
+          ? AllocateInNewSpace(object_size, alignment)
+          : AllocateInLab(object_size, alignment);
+
+  HeapObject* target = nullptr;
+  if (allocation.To(&target)) {
+    if (!MigrateObject(map, slot, object, target, object_size)) return true;
+    *slot = target;
+    copied_list_.Push(target);
+    semispace_copied_size_ += object_size;
+    return true;
+  }
+  return false;
+}
+
+bool ParallelScavenger::PromoteObject(Map* map, HeapObject** slot,
+                                      HeapObject* object, int object_size) {
+  AllocationAlignment alignment = RequiredAlignment(map, object);
+  AllocationResult allocation =
+      compaction_spaces_.Get(OLD_SPACE)->AllocateRaw(object_size, alignment);
+
+  HeapObject* target = nullptr;
+  if (allocation.To(&target)) {
+    if (!MigrateObject(map, slot, object, target, object_size)) return true;
+    // Update slot to new target using CAS. A concurrent sweeper thread my
+    // filter the slot concurrently.
+    HeapObject* old = *slot;
+    base::Release_CompareAndSwap(reinterpret_cast<base::AtomicWord*>(slot),
+                                 reinterpret_cast<base::AtomicWord>(old),
+                                 reinterpret_cast<base::AtomicWord>(target));
+    promotion_list_.Push(target);
+    promoted_size_ += object_size;
+    return true;
+  }
+  return false;
+}
+
+AllocationResult ParallelScavenger::AllocateInNewSpace(
+    int size_in_bytes, AllocationAlignment alignment) {
+  AllocationResult allocation =
+      heap()->new_space()->AllocateRawSynchronized(size_in_bytes, alignment);
+  if (allocation.IsRetry() && heap()->new_space()->AddFreshPageSynchronized()) {
+    allocation =
+        heap()->new_space()->AllocateRawSynchronized(size_in_bytes, alignment);
+  }
+  return allocation;
+}
+
+AllocationResult ParallelScavenger::AllocateInLab(
+    int size_in_bytes, AllocationAlignment alignment) {
+  AllocationResult allocation;
+  if (buffer_.IsValid()) {
+    allocation = buffer_.AllocateRawAligned(size_in_bytes, alignment);
+    if (!allocation.IsRetry()) return allocation;
+  }
+  if (!NewLocalAllocationBuffer()) return AllocationResult::Retry(NEW_SPACE);
+  return buffer_.AllocateRawAligned(size_in_bytes, alignment);
+}
+
+SlotCallbackResult ParallelScavenger::CheckAndScavengeObject(
+    Address slot_address) {
+  Object** slot = reinterpret_cast<Object**>(slot_address);
+  Object* object = *slot;
+  if (heap()->InFromSpace(object)) {
+    HeapObject* heap_object = reinterpret_cast<HeapObject*>(object);
+    DCHECK(heap_object->IsHeapObject());
+
+    ScavengeObject(reinterpret_cast<HeapObject**>(slot), heap_object);
+
+    object = *slot;
+    // If the object was in from space before and is after executing the
+    // callback in to space, the object is still live.
+    if (heap()->InToSpace(object)) {
+      return KEEP_SLOT;
+    }
+  }
+  // Slots can point to "to" space if the slot has been recorded multiple
+  // times in the remembered set. We remove the redundant slot now.
+  return REMOVE_SLOT;
+}
+
+void ParallelScavengeVisitor::VisitPointers(HeapObject* host, Object** start,
+                                            Object** end) {
+  for (Object** p = start; p < end; p++) {
+    Object* object = *p;
+    if (!heap_->InNewSpace(object)) continue;
+    scavenger_->ScavengeObject(reinterpret_cast<HeapObject**>(p),
+                               reinterpret_cast<HeapObject*>(object));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
 
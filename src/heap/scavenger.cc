@@ -8,6 +8,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/objects-visiting-inl.h"
+#include "src/heap/remembered-set.h"
 #include "src/heap/scavenger-inl.h"
 #include "src/isolate.h"
 #include "src/log.h"
@@ -404,12 +405,25 @@ void Scavenger::Initialize() {
 }
 
 
+bool Scavenger::IsLoggingAndProfiling() {
+  return FLAG_verify_predictable || isolate()->logger()->is_logging() ||
+         isolate()->is_profiling() ||
+         (isolate()->heap_profiler() != NULL &&
+          isolate()->heap_profiler()->is_tracking_object_moves());
+}
+
+bool Scavenger::CanScavengeInParallel() {
+  bool should_record = false;
+#ifdef DEBUG
+  should_record = FLAG_heap_stats;
+#endif
+  should_record = should_record || FLAG_log_gc;
+  return !should_record && !IsLoggingAndProfiling() &&
+         !heap()->incremental_marking()->IsMarking();
+}
+
 void Scavenger::SelectScavengingVisitorsTable() {
-  bool logging_and_profiling =
-      FLAG_verify_predictable || isolate()->logger()->is_logging() ||
-      isolate()->is_profiling() ||
-      (isolate()->heap_profiler() != NULL &&
-       isolate()->heap_profiler()->is_tracking_object_moves());
+  bool logging_and_profiling = IsLoggingAndProfiling();
 
   if (!heap()->incremental_marking()->IsMarking()) {
     if (!logging_and_profiling) {
@@ -469,5 +483,128 @@ void RootScavengeVisitor::ScavengePointer(Object** p) {
                             reinterpret_cast<HeapObject*>(object));
 }
 
+void RootParallelScavengeVisitor::VisitRootPointer(Root root, Object** p) {
+  ScavengePointer(p);
+}
+
+void RootParallelScavengeVisitor::VisitRootPointers(Root root, Object** start,
+                                                    Object** end) {
+  // Copy all HeapObject pointers in [start, end)
+  for (Object** p = start; p < end; p++) ScavengePointer(p);
+}
+
+void RootParallelScavengeVisitor::ScavengePointer(Object** p) {
+  Object* object = *p;
+  if (!scavenger_->heap()->InNewSpace(object)) return;
+
+  scavenger_->ScavengeObject(reinterpret_cast<HeapObject**>(p),
+                             reinterpret_cast<HeapObject*>(object));
+}
+
+class IterateAndParallelScavengePromotedObjectsVisitor final
+    : public ObjectVisitor {
+ public:
+  explicit IterateAndParallelScavengePromotedObjectsVisitor(
+      ParallelScavenger* scavenger)
+      : scavenger_(scavenger), heap_(scavenger->heap()) {}
+
+  inline void VisitPointers(HeapObject* host, Object** start,
+                            Object** end) override {
+    for (Object** slot = start; slot < end; slot++) {
+      Object* target = *slot;
+      if (!heap_->InFromSpace(target)) continue;
+      scavenger_->ScavengeObject(reinterpret_cast<HeapObject**>(slot),
+                                 HeapObject::cast(target));
+      target = *slot;
+      if (heap_->InNewSpace(target)) {
+        SLOW_DCHECK(heap_->InToSpace(target));
+        // The page of the promoted object may be shared with other tasks
+        // that concurrently filter its remembered set.
+        MemoryChunk* chunk = MemoryChunk::FromAddress(host->address());
+        base::LockGuard<base::RecursiveMutex> guard(chunk->mutex());
+        RememberedSet<OLD_TO_NEW>::Insert(chunk,
+                                          reinterpret_cast<Address>(slot));
+      }
+    }
+  }
+
+  inline void VisitCodeEntry(JSFunction* host,
+                             Address code_entry_slot) override {
+    // Code is not in new space and black allocation is not active during
+    // parallel scavenges.
+  }
+
+ private:
+  ParallelScavenger* const scavenger_;
+  Heap* const heap_;
+};
+
+ParallelScavenger::ParallelScavenger(Heap* heap, Worklist* copied_list,
+                                     Worklist* promotion_list, int task_id)
+    : heap_(heap),
+      copied_list_(copied_list, task_id),
+      promotion_list_(promotion_list, task_id),
+      compaction_spaces_(heap),
+      buffer_(LocalAllocationBuffer::InvalidBuffer()),
+      local_pretenuring_feedback_(kInitialLocalPretenuringFeedbackCapacity),
+      semispace_copied_size_(0),
+      promoted_size_(0) {}
+
+bool ParallelScavenger::NewLocalAllocationBuffer() {
+  AllocationResult result = AllocateInNewSpace(kLabSize, kWordAligned);
+  LocalAllocationBuffer saved_old_buffer = buffer_;
+  buffer_ = LocalAllocationBuffer::FromResult(heap_, result, kLabSize);
+  if (buffer_.IsValid()) {
+    buffer_.TryMerge(&saved_old_buffer);
+    return true;
+  }
+  return false;
+}
+
+void ParallelScavenger::IterateAndScavengePromotedObject(HeapObject* target,
+                                                         int size) {
+  IterateAndParallelScavengePromotedObjectsVisitor visitor(this);
+  if (target->IsJSFunction()) {
+    // JSFunctions reachable through kNextFunctionLinkOffset are weak. Slots for
+    // this links are recorded during processing of weak lists.
+    JSFunction::BodyDescriptorWeak::IterateBody(target, size, &visitor);
+  } else {
+    target->IterateBody(target->map()->instance_type(), size, &visitor);
+  }
+}
+
+void ParallelScavenger::Process() {
+  ParallelScavengeVisitor scavenge_visitor(this);
+  bool done;
+  do {
+    done = true;
+    HeapObject* object = nullptr;
+    while (copied_list_.Pop(&object)) {
+      scavenge_visitor.Visit(object);
+      done = false;
+    }
+    while (promotion_list_.Pop(&object)) {
+      DCHECK(!object->IsMap());
+      IterateAndScavengePromotedObject(object, object->Size());
+      done = false;
+    }
+  } while (!done);
+}
+
+void ParallelScavenger::FlushWorklists() {
+  copied_list_.FlushToGlobal();
+  promotion_list_.FlushToGlobal();
+}
+
+void ParallelScavenger::Finalize() {
+  DCHECK(copied_list_.IsLocalEmpty());
+  DCHECK(promotion_list_.IsLocalEmpty());
+  buffer_.Close();
+  heap()->old_space()->MergeCompactionSpace(compaction_spaces_.Get(OLD_SPACE));
+  heap()->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
+  heap()->IncrementSemiSpaceCopiedObjectSize(semispace_copied_size_);
+  heap()->IncrementPromotedObjectsSize(promoted_size_);
+}
+
 }  // namespace internal
 }  // namespace v8
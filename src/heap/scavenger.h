@@ -5,8 +5,11 @@
 #ifndef V8_HEAP_SCAVENGER_H_
 #define V8_HEAP_SCAVENGER_H_
 
+#include "src/base/hashmap.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/slot-set.h"
+#include "src/heap/spaces.h"
+#include "src/heap/worklist.h"
 
 namespace v8 {
 namespace internal {
@@ -36,14 +39,95 @@ class Scavenger {
   // of the heap (i.e. incremental marking, logging and profiling).
   void SelectScavengingVisitorsTable();
 
+  // Returns true if the upcoming scavenge can be performed by several
+  // {ParallelScavenger} tasks. Parallel scavenging does not support transfer
+  // of marks, logging, and profiling.
+  bool CanScavengeInParallel();
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
  private:
+  bool IsLoggingAndProfiling();
+
   Heap* heap_;
   VisitorDispatchTable<ScavengingCallback> scavenging_visitors_table_;
 };
 
+// Task-local part of a parallel scavenge. Every task owns a scavenger that
+// copies survivors into its own new space LAB and promotes objects into its
+// own compaction space. Tasks race for installing forwarding pointers using a
+// CAS on the map word; the loser abandons its copy. Copied and promoted objects
+// that still need to be visited are kept on worklists that are shared between
+// all scavengers to allow for work stealing.
+class ParallelScavenger {
+ public:
+  ParallelScavenger(Heap* heap, Worklist* copied_list,
+                    Worklist* promotion_list, int task_id);
+
+  // Copies |object| referenced from |p| if necessary and updates the slot.
+  // The object might be promoted to the old generation. The caller must ensure
+  // that the object is (a) a heap object and (b) in the heap's from space.
+  inline void ScavengeObject(HeapObject** p, HeapObject* object);
+  inline SlotCallbackResult CheckAndScavengeObject(Address slot_address);
+
+  // Visits copied and promoted objects until no more work can be found on
+  // the local and global worklists.
+  void Process();
+
+  // Publishes locally available work so that other tasks can steal it.
+  void FlushWorklists();
+
+  // Merges back locally cached info. Needs to be called on the main thread
+  // after all tasks finished.
+  void Finalize();
+
+  Heap* heap() { return heap_; }
+  intptr_t semispace_copied_size() const { return semispace_copied_size_; }
+  intptr_t promoted_size() const { return promoted_size_; }
+
+ private:
+  static const intptr_t kLabSize = 4 * KB;
+  static const intptr_t kMaxLabObjectSize = 256;
+  static const int kInitialLocalPretenuringFeedbackCapacity = 256;
+
+  static inline AllocationAlignment RequiredAlignment(Map* map,
+                                                     HeapObject* object);
+
+  inline void ScavengeObjectSlow(Map* map, HeapObject** slot,
+                                 HeapObject* object);
+  inline bool SemiSpaceCopyObject(Map* map, HeapObject** slot,
+                                  HeapObject* object, int object_size);
+  inline bool PromoteObject(Map* map, HeapObject** slot, HeapObject* object,
+                            int object_size);
+
+  // Copies |source| to |target| and tries to install the forwarding pointer.
+  // Returns false if another task already forwarded |source|. In this case
+  // the copy is turned into a filler and the slot is updated to the already
+  // existing copy.
+  inline bool MigrateObject(Map* map, HeapObject** slot, HeapObject* source,
+                            HeapObject* target, int size);
+
+  inline AllocationResult AllocateInNewSpace(int size_in_bytes,
+                                             AllocationAlignment alignment);
+  inline AllocationResult AllocateInLab(int size_in_bytes,
+                                        AllocationAlignment alignment);
+  bool NewLocalAllocationBuffer();
+
+  void IterateAndScavengePromotedObject(HeapObject* target, int size);
+
+  Heap* const heap_;
+  WorklistView copied_list_;
+  WorklistView promotion_list_;
+  CompactionSpaceCollection compaction_spaces_;
+  LocalAllocationBuffer buffer_;
+  base::HashMap local_pretenuring_feedback_;
+  intptr_t semispace_copied_size_;
+  intptr_t promoted_size_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelScavenger);
+};
+
 // Helper class for turning the scavenger into an object visitor that is also
 // filtering out non-HeapObjects and objects which do not reside in new space.
 class RootScavengeVisitor : public RootVisitor {
@@ -69,6 +153,35 @@ class ScavengeVisitor : public NewSpaceVisitor {
   Heap* heap_;
 };
 
+// Root visitor forwarding all new space roots to a {ParallelScavenger}.
+class RootParallelScavengeVisitor : public RootVisitor {
+ public:
+  explicit RootParallelScavengeVisitor(ParallelScavenger* scavenger)
+      : scavenger_(scavenger) {}
+
+  void VisitRootPointer(Root root, Object** p) override;
+  void VisitRootPointers(Root root, Object** start, Object** end) override;
+
+ private:
+  inline void ScavengePointer(Object** p);
+
+  ParallelScavenger* const scavenger_;
+};
+
+// Visits the body of objects copied within the young generation on behalf of
+// a {ParallelScavenger}.
+class ParallelScavengeVisitor : public NewSpaceVisitor {
+ public:
+  explicit ParallelScavengeVisitor(ParallelScavenger* scavenger)
+      : scavenger_(scavenger), heap_(scavenger->heap()) {}
+  inline void VisitPointers(HeapObject* host, Object** start,
+                            Object** end) final;
+
+ private:
+  ParallelScavenger* const scavenger_;
+  Heap* const heap_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -50,8 +50,10 @@ class SlotSet : public Malloced {
   void SetPageStart(Address page_start) { page_start_ = page_start; }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
-  // This method should only be called on the main thread because concurrent
-  // allocation of the bucket is not thread-safe.
+  // With AccessMode::ATOMIC, insertions may run concurrently with each other:
+  // a missing bucket is installed with a compare-and-swap and the bucket of
+  // the losing thread is discarded. Removal is not safe to run concurrently
+  // with insertion.
   //
   // AccessMode defines whether there can be concurrent access on the buckets
   // or not.
@@ -62,7 +64,16 @@ class SlotSet : public Malloced {
     Bucket bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
     if (bucket == nullptr) {
       bucket = AllocateBucket();
-      StoreBucket<access_mode>(&buckets_[bucket_index], bucket);
+      if (access_mode == AccessMode::ATOMIC) {
+        Bucket old_bucket = base::AsAtomicWord::Release_CompareAndSwap(
+            &buckets_[bucket_index], nullptr, bucket);
+        if (old_bucket != nullptr) {
+          DeleteArray<uint32_t>(bucket);
+          bucket = old_bucket;
+        }
+      } else {
+        StoreBucket<access_mode>(&buckets_[bucket_index], bucket);
+      }
     }
     uint32_t mask = 1u << bit_index;
     if ((LoadCell<access_mode>(&bucket[cell_index]) & mask) == 0) {
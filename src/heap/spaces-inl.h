@@ -155,6 +155,7 @@ bool PagedSpace::Contains(Object* o) {
 
 void PagedSpace::UnlinkFreeListCategories(Page* page) {
   DCHECK_EQ(this, page->owner());
+  base::LockGuard<base::Mutex> guard(free_list()->mutex());
   page->ForAllFreeListCategories([this](FreeListCategory* category) {
     DCHECK_EQ(free_list(), category->owner());
     free_list()->RemoveCategory(category);
@@ -164,6 +165,7 @@ void PagedSpace::UnlinkFreeListCategories(Page* page) {
 intptr_t PagedSpace::RelinkFreeListCategories(Page* page) {
   DCHECK_EQ(this, page->owner());
   intptr_t added = 0;
+  base::LockGuard<base::Mutex> guard(free_list()->mutex());
   page->ForAllFreeListCategories([&added](FreeListCategory* category) {
     added += category->available();
     category->Relink();
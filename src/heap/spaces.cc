@@ -300,7 +300,8 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate)
       size_executable_(0),
       lowest_ever_allocated_(reinterpret_cast<void*>(-1)),
       highest_ever_allocated_(reinterpret_cast<void*>(0)),
-      unmapper_(this) {}
+      unmapper_(this),
+      numa_node_(-1) {}
 
 bool MemoryAllocator::SetUp(size_t capacity, size_t code_range_size) {
   capacity_ = RoundUp(capacity, Page::kPageSize);
@@ -308,6 +309,9 @@ bool MemoryAllocator::SetUp(size_t capacity, size_t code_range_size) {
   size_ = 0;
   size_executable_ = 0;
 
+  // The heap is set up on the isolate's main thread.
+  if (FLAG_numa_aware_heap) numa_node_ = base::OS::GetCurrentNumaNode();
+
   code_range_ = new CodeRange(isolate_);
   if (!code_range_->SetUp(code_range_size)) return false;
 
@@ -358,6 +362,21 @@ void MemoryAllocator::Unmapper::FreeQueuedChunks() {
   }
 }
 
+void MemoryAllocator::Unmapper::AddMemoryChunksSafe(
+    const std::vector<MemoryChunk*>& chunks) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  for (MemoryChunk* chunk : chunks) {
+    if ((chunk->size() != Page::kPageSize) ||
+        (chunk->executable() == EXECUTABLE)) {
+      chunks_[kNonRegular].push_back(chunk);
+    } else if (allocator_->CanFreeMemoryChunk(chunk)) {
+      chunks_[kRegular].push_back(chunk);
+    } else {
+      delayed_regular_chunks_.push_back(chunk);
+    }
+  }
+}
+
 bool MemoryAllocator::Unmapper::WaitUntilCompleted() {
   bool waited = false;
   while (concurrent_unmapping_tasks_active_ > 0) {
@@ -375,7 +394,14 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   while ((chunk = GetMemoryChunkSafe<kRegular>()) != nullptr) {
     bool pooled = chunk->IsFlagSet(MemoryChunk::POOLED);
     allocator_->PerformFreeMemory(chunk);
-    if (pooled) AddMemoryChunkSafe<kPooled>(chunk);
+    if (!pooled) continue;
+    if (NumberOfPooledChunks() < static_cast<size_t>(FLAG_max_pooled_pages)) {
+      AddMemoryChunkSafe<kPooled>(chunk);
+    } else {
+      // The pool is full, so give the already uncommitted chunk back to the
+      // OS right away.
+      allocator_->Free<MemoryAllocator::kAlreadyPooled>(chunk);
+    }
   }
   if (mode == MemoryAllocator::Unmapper::FreeMode::kReleasePooled) {
     // The previous loop uncommitted any pages marked as pooled and added them
@@ -426,10 +452,23 @@ bool MemoryAllocator::CommitMemory(Address base, size_t size,
                                          executable == EXECUTABLE)) {
     return false;
   }
+  AdviseCommittedMemory(base, size, executable);
   UpdateAllocatedSpaceLimits(base, base + size);
   return true;
 }
 
+void MemoryAllocator::AdviseCommittedMemory(Address base, size_t size,
+                                            Executability executable) {
+  if (FLAG_transparent_huge_pages && executable != EXECUTABLE) {
+    base::VirtualMemory::AdviseHugePages(base, size);
+  }
+  // Committing maps fresh pages, which are placed on first touch, so the
+  // policy has to be set again for every commit.
+  if (numa_node_ >= 0) {
+    base::VirtualMemory::SetPreferredNumaNode(base, size, numa_node_);
+  }
+}
+
 
 void MemoryAllocator::FreeMemory(base::VirtualMemory* reservation,
                                  Executability executable) {
@@ -490,6 +529,7 @@ Address MemoryAllocator::AllocateAlignedMemory(
     }
   } else {
     if (reservation.Commit(base, commit_size, false)) {
+      AdviseCommittedMemory(base, commit_size, executable);
       UpdateAllocatedSpaceLimits(base, base + commit_size);
     } else {
       base = NULL;
@@ -934,6 +974,7 @@ void Page::CreateBlackArea(Address start, Address end) {
   MarkingState::Internal(this)
       .IncrementLiveBytes<IncrementalMarking::kAtomicity>(
           static_cast<int>(end - start));
+  heap()->incremental_marking()->NotifyBlackAllocation(end - start);
 }
 
 void Page::DestroyBlackArea(Address start, Address end) {
@@ -946,6 +987,7 @@ void Page::DestroyBlackArea(Address start, Address end) {
   MarkingState::Internal(this)
       .IncrementLiveBytes<IncrementalMarking::kAtomicity>(
           -static_cast<int>(end - start));
+  heap()->incremental_marking()->NotifyBlackAllocation(-(end - start));
 }
 
 void MemoryAllocator::PartialFreeMemory(MemoryChunk* chunk, Address start_free,
@@ -1035,6 +1077,14 @@ void MemoryAllocator::Free(MemoryChunk* chunk) {
   }
 }
 
+void MemoryAllocator::PreFreeAndQueue(const std::vector<MemoryChunk*>& chunks) {
+  for (MemoryChunk* chunk : chunks) {
+    PreFreeMemory(chunk);
+  }
+  // The chunks added to this queue will be freed by a concurrent thread.
+  unmapper()->AddMemoryChunksSafe(chunks);
+}
+
 template void MemoryAllocator::Free<MemoryAllocator::kFull>(MemoryChunk* chunk);
 
 template void MemoryAllocator::Free<MemoryAllocator::kAlreadyPooled>(
@@ -1069,6 +1119,9 @@ template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kRegular, SemiSpace>(
     size_t size, SemiSpace* owner, Executability executable);
 template Page*
+MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, PagedSpace>(
+    size_t size, PagedSpace* owner, Executability executable);
+template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, SemiSpace>(
     size_t size, SemiSpace* owner, Executability executable);
 
@@ -1508,7 +1561,11 @@ bool PagedSpace::Expand() {
 
   if (!heap()->CanExpandOldGeneration(size)) return false;
 
-  Page* p = heap()->memory_allocator()->AllocatePage(size, this, executable());
+  Page* p =
+      CanPoolPages()
+          ? heap()->memory_allocator()->AllocatePage<MemoryAllocator::kPooled>(
+                size, this, executable())
+          : heap()->memory_allocator()->AllocatePage(size, this, executable());
   if (p == nullptr) return false;
 
   AccountCommitted(p->size());
@@ -1589,6 +1646,8 @@ void PagedSpace::EmptyAllocationInfo() {
       MarkingState::Internal(page)
           .IncrementLiveBytes<IncrementalMarking::kAtomicity>(
               -static_cast<int>(current_limit - current_top));
+      heap()->incremental_marking()->NotifyBlackAllocation(
+          -(current_limit - current_top));
     }
   }
 
@@ -1597,6 +1656,45 @@ void PagedSpace::EmptyAllocationInfo() {
   Free(current_top, current_limit - current_top);
 }
 
+LocalAllocationBuffer PagedSpace::AllocateLocalAllocationBuffer(
+    int min_size_in_bytes, int max_size_in_bytes) {
+  DCHECK(!is_local());
+  DCHECK_LE(min_size_in_bytes, max_size_in_bytes);
+  size_t node_size = 0;
+  FreeSpace* node = free_list_.AllocateNodeSynchronized(
+      static_cast<size_t>(min_size_in_bytes), &node_size);
+  if (node == nullptr) return LocalAllocationBuffer::InvalidBuffer();
+  DCHECK(!MarkCompactCollector::IsOnEvacuationCandidate(node));
+
+  Address start = node->address();
+  size_t size = Min(node_size, static_cast<size_t>(max_size_in_bytes));
+  AccountAllocatedBytes(node_size);
+  if (size < node_size) Free(start + size, node_size - size);
+
+  if (heap()->incremental_marking()->black_allocation()) {
+    Page::FromAddress(start)->CreateBlackArea(start, start + size);
+  }
+  return LocalAllocationBuffer::FromResult(
+      heap(), AllocationResult(HeapObject::FromAddress(start)),
+      static_cast<intptr_t>(size));
+}
+
+void PagedSpace::FreeLocalAllocationBuffer(LocalAllocationBuffer* buffer) {
+  AllocationInfo info = buffer->Close();
+  Address top = info.top();
+  Address limit = info.limit();
+  if (top == nullptr || top == limit) return;
+  Page* page = Page::FromAllocationAreaAddress(top);
+  DCHECK_EQ(this, page->owner());
+  if (heap()->incremental_marking()->black_allocation() &&
+      MarkingState::Internal(page).bitmap()->AllBitsSetInRange(
+          page->AddressToMarkbitIndex(top),
+          page->AddressToMarkbitIndex(limit))) {
+    page->DestroyBlackArea(top, limit);
+  }
+  Free(top, limit - top);
+}
+
 void PagedSpace::IncreaseCapacity(size_t bytes) {
   accounting_stats_.ExpandSpace(bytes);
 }
@@ -1620,7 +1718,11 @@ void PagedSpace::ReleasePage(Page* page) {
 
   AccountUncommitted(page->size());
   accounting_stats_.ShrinkSpace(page->area_size());
-  heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  if (CanPoolPages()) {
+    heap()->memory_allocator()->Free<MemoryAllocator::kPooledAndQueue>(page);
+  } else {
+    heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  }
 }
 
 std::unique_ptr<ObjectIterator> PagedSpace::GetObjectIterator() {
@@ -1737,6 +1839,11 @@ void NewSpace::Grow() {
   size_t new_capacity =
       Min(MaximumCapacity(),
           static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity());
+  GrowTo(new_capacity);
+}
+
+void NewSpace::GrowTo(size_t new_capacity) {
+  DCHECK_LE(new_capacity, MaximumCapacity());
   if (to_space_.GrowTo(new_capacity)) {
     // Only grow from space if we managed to grow to-space.
     if (!from_space_.GrowTo(new_capacity)) {
@@ -1754,7 +1861,10 @@ void NewSpace::Grow() {
 
 
 void NewSpace::Shrink() {
-  size_t new_capacity = Max(InitialTotalCapacity(), 2 * Size());
+  ShrinkTo(Max(InitialTotalCapacity(), 2 * Size()));
+}
+
+void NewSpace::ShrinkTo(size_t new_capacity) {
   size_t rounded_new_capacity = RoundUp(new_capacity, Page::kPageSize);
   if (rounded_new_capacity < TotalCapacity() &&
       to_space_.ShrinkTo(rounded_new_capacity)) {
@@ -1773,6 +1883,22 @@ void NewSpace::Shrink() {
   DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
 }
 
+void NewSpace::ResizeTowards(size_t target_capacity) {
+  size_t current_capacity = TotalCapacity();
+  size_t max_step = static_cast<size_t>(FLAG_semi_space_growth_factor) *
+                    current_capacity;
+  if (target_capacity > current_capacity) {
+    size_t new_capacity = RoundUp(Min(target_capacity, max_step),
+                                  Page::kPageSize);
+    new_capacity = Min(new_capacity, MaximumCapacity());
+    if (new_capacity > current_capacity) GrowTo(new_capacity);
+  } else if (target_capacity < current_capacity) {
+    // Never shrink below the live objects, which have to stay in to-space.
+    ShrinkTo(Max(Max(target_capacity, current_capacity / 2),
+                 Max(InitialTotalCapacity(), 2 * Size())));
+  }
+}
+
 bool NewSpace::Rebalance() {
   CHECK(heap()->promotion_queue()->is_empty());
   // Order here is important to make use of the page pool.
@@ -1986,8 +2112,11 @@ intptr_t NewSpace::GetNextInlineAllocationStepSize() {
   intptr_t next_step = 0;
   for (int i = 0; i < allocation_observers_->length(); ++i) {
     AllocationObserver* o = (*allocation_observers_)[i];
-    next_step = next_step ? Min(next_step, o->bytes_to_next_step())
-                          : o->bytes_to_next_step();
+    intptr_t step = o->bytes_to_next_step();
+    if (o->AllowsDelayedSteps()) {
+      step = Max(step, kMinimumInlineAllocationStep);
+    }
+    next_step = next_step ? Min(next_step, step) : step;
   }
   DCHECK(allocation_observers_->length() == 0 || next_step != 0);
   return next_step;
@@ -2679,9 +2808,18 @@ size_t FreeList::Free(Address start, size_t size_in_bytes, FreeMode mode) {
 
   FreeSpace* free_space = FreeSpace::cast(HeapObject::FromAddress(start));
   // Insert other blocks at the head of a free list of the appropriate
-  // magnitude.
+  // magnitude. Only linking a category changes the shared lists; unlinked
+  // categories are owned by the sweeper.
   FreeListCategoryType type = SelectFreeListCategoryType(size_in_bytes);
-  if (page->free_list_category(type)->Free(free_space, size_in_bytes, mode)) {
+  FreeListCategory* category = page->free_list_category(type);
+  bool added = false;
+  if (mode == kLinkCategory) {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    added = category->Free(free_space, size_in_bytes, mode);
+  } else {
+    added = category->Free(free_space, size_in_bytes, mode);
+  }
+  if (added) {
     page->add_available_in_free_list(size_in_bytes);
   }
   DCHECK_EQ(page->AvailableInFreeList(), page->available_in_free_list());
@@ -2799,7 +2937,7 @@ HeapObject* FreeList::Allocate(size_t size_in_bytes) {
       Heap::kNoGCFlags, kGCCallbackScheduleIdleGarbageCollection);
 
   size_t new_node_size = 0;
-  FreeSpace* new_node = FindNodeFor(size_in_bytes, &new_node_size);
+  FreeSpace* new_node = AllocateNodeSynchronized(size_in_bytes, &new_node_size);
   if (new_node == nullptr) return nullptr;
 
   DCHECK_GE(new_node_size, size_in_bytes);
@@ -2852,7 +2990,16 @@ HeapObject* FreeList::Allocate(size_t size_in_bytes) {
   return new_node;
 }
 
+FreeSpace* FreeList::AllocateNodeSynchronized(size_t size_in_bytes,
+                                              size_t* node_size) {
+  DCHECK_LE(size_in_bytes, kMaxBlockSize);
+  DCHECK(IsAligned(size_in_bytes, kPointerSize));
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  return FindNodeFor(size_in_bytes, node_size);
+}
+
 size_t FreeList::EvictFreeListItems(Page* page) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
   size_t sum = 0;
   page->ForAllFreeListCategories(
       [this, &sum](FreeListCategory* category) {
@@ -3244,6 +3391,7 @@ AllocationResult LargeObjectSpace::AllocateRaw(int object_size,
   if (heap()->incremental_marking()->black_allocation()) {
     ObjectMarking::WhiteToBlack<IncrementalMarking::kAtomicity>(
         object, MarkingState::Internal(object));
+    heap()->incremental_marking()->NotifyBlackAllocation(object_size);
   }
   return object;
 }
@@ -3335,8 +3483,14 @@ void LargeObjectSpace::RemoveChunkMapEntries(LargePage* page,
 }
 
 void LargeObjectSpace::FreeUnmarkedObjects() {
+  // Dead pages are unlinked and removed from the chunk map within the pause,
+  // while their memory is released by the unmapper on a background thread.
+  std::vector<MemoryChunk*> dead_pages;
   LargePage* previous = nullptr;
   LargePage* current = first_page_;
+  // The chunk map lock is taken once for the whole space rather than for
+  // every page.
+  base::LockGuard<base::Mutex> guard(&chunk_map_mutex_);
   while (current != nullptr) {
     HeapObject* object = current->GetObject();
     DCHECK(!ObjectMarking::IsGrey(object, MarkingState::Internal(object)));
@@ -3373,9 +3527,12 @@ void LargeObjectSpace::FreeUnmarkedObjects() {
       page_count_--;
 
       RemoveChunkMapEntries(page);
-      heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+      dead_pages.push_back(page);
     }
   }
+  if (!dead_pages.empty()) {
+    heap()->memory_allocator()->PreFreeAndQueue(dead_pages);
+  }
 }
 
 
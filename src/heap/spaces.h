@@ -8,6 +8,7 @@
 #include <list>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/atomic-utils.h"
@@ -1195,6 +1196,9 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
       }
     }
 
+    // Queues all of {chunks} while taking the lock only once.
+    void AddMemoryChunksSafe(const std::vector<MemoryChunk*>& chunks);
+
     MemoryChunk* TryGetPooledMemoryChunkSafe() {
       // Procedure:
       // (1) Try to get a chunk that was declared as pooled and already has
@@ -1216,6 +1220,13 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
     bool WaitUntilCompleted();
     void TearDown();
 
+    // Returns the number of uncommitted chunks that are ready for reuse. At
+    // most --max-pooled-pages chunks are kept, the rest are unmapped.
+    size_t NumberOfPooledChunks() {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      return chunks_[kPooled].size();
+    }
+
     bool has_delayed_chunks() { return delayed_regular_chunks_.size() > 0; }
 
    private:
@@ -1324,6 +1335,10 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   template <MemoryAllocator::FreeMode mode = kFull>
   void Free(MemoryChunk* chunk);
 
+  // Pre-frees all of {chunks} and queues them to be freed by the unmapper,
+  // like Free<kPreFreeAndQueue> but in a single batch.
+  void PreFreeAndQueue(const std::vector<MemoryChunk*>& chunks);
+
   bool CanFreeMemoryChunk(MemoryChunk* chunk);
 
   // Returns allocated spaces in bytes.
@@ -1422,6 +1437,11 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   Page* InitializePagesInChunk(int chunk_id, int pages_in_chunk,
                                PagedSpace* owner);
 
+  // Passes placement hints for the freshly committed [base, base + size) to
+  // the OS.
+  void AdviseCommittedMemory(Address base, size_t size,
+                             Executability executable);
+
   void UpdateAllocatedSpaceLimits(void* low, void* high) {
     // The use of atomic primitives does not guarantee correctness (wrt.
     // desired semantics) by default. The loop here ensures that we update the
@@ -1457,6 +1477,9 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   base::VirtualMemory last_chunk_;
   Unmapper unmapper_;
 
+  // The NUMA node that newly committed pages are placed on, or -1.
+  int numa_node_;
+
   friend class TestCodeRangeScope;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(MemoryAllocator);
@@ -1469,6 +1492,9 @@ extern template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kRegular, SemiSpace>(
     size_t size, SemiSpace* owner, Executability executable);
 extern template Page*
+MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, PagedSpace>(
+    size_t size, PagedSpace* owner, Executability executable);
+extern template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, SemiSpace>(
     size_t size, SemiSpace* owner, Executability executable);
 
@@ -1630,24 +1656,24 @@ class AllocationStats BASE_EMBEDDED {
   void Clear() {
     capacity_ = 0;
     max_capacity_ = 0;
-    size_ = 0;
+    size_.SetValue(0);
   }
 
-  void ClearSize() { size_ = capacity_; }
+  void ClearSize() { size_.SetValue(capacity_); }
 
   // Accessors for the allocation statistics.
   size_t Capacity() { return capacity_; }
   size_t MaxCapacity() { return max_capacity_; }
-  size_t Size() { return size_; }
+  size_t Size() { return size_.Value(); }
 
   // Grow the space by adding available bytes.  They are initially marked as
   // being in use (part of the size), but will normally be immediately freed,
   // putting them on the free list and removing them from size_.
   void ExpandSpace(size_t bytes) {
-    DCHECK_GE(size_ + bytes, size_);
+    DCHECK_GE(size_.Value() + bytes, size_.Value());
     DCHECK_GE(capacity_ + bytes, capacity_);
     capacity_ += bytes;
-    size_ += bytes;
+    size_.Increment(bytes);
     if (capacity_ > max_capacity_) {
       max_capacity_ = capacity_;
     }
@@ -1658,24 +1684,26 @@ class AllocationStats BASE_EMBEDDED {
   // and are hereby freed.
   void ShrinkSpace(size_t bytes) {
     DCHECK_GE(capacity_, bytes);
-    DCHECK_GE(size_, bytes);
+    DCHECK_GE(size_.Value(), bytes);
     capacity_ -= bytes;
-    size_ -= bytes;
+    size_.Decrement(bytes);
   }
 
+  // Allocated bytes may be accounted concurrently by threads that refill
+  // local allocation buffers, see PagedSpace::AllocateLocalAllocationBuffer.
   void AllocateBytes(size_t bytes) {
-    DCHECK_GE(size_ + bytes, size_);
-    size_ += bytes;
+    DCHECK_GE(size_.Value() + bytes, size_.Value());
+    size_.Increment(bytes);
   }
 
   void DeallocateBytes(size_t bytes) {
-    DCHECK_GE(size_, bytes);
-    size_ -= bytes;
+    DCHECK_GE(size_.Value(), bytes);
+    size_.Decrement(bytes);
   }
 
   void DecreaseCapacity(size_t bytes) {
     DCHECK_GE(capacity_, bytes);
-    DCHECK_GE(capacity_ - bytes, size_);
+    DCHECK_GE(capacity_ - bytes, size_.Value());
     capacity_ -= bytes;
   }
 
@@ -1687,9 +1715,9 @@ class AllocationStats BASE_EMBEDDED {
   // Merge |other| into |this|.
   void Merge(const AllocationStats& other) {
     DCHECK_GE(capacity_ + other.capacity_, capacity_);
-    DCHECK_GE(size_ + other.size_, size_);
+    DCHECK_GE(size_.Value() + other.size_.Value(), size_.Value());
     capacity_ += other.capacity_;
-    size_ += other.size_;
+    size_.Increment(other.size_.Value());
     if (other.max_capacity_ > max_capacity_) {
       max_capacity_ = other.max_capacity_;
     }
@@ -1704,7 +1732,7 @@ class AllocationStats BASE_EMBEDDED {
   size_t max_capacity_;
 
   // |size_|: The number of allocated bytes.
-  size_t size_;
+  base::AtomicNumber<size_t> size_;
 };
 
 // A free list maintaining free blocks of memory. The free list is organized in
@@ -1779,6 +1807,14 @@ class V8_EXPORT_PRIVATE FreeList {
   // should be a non-zero multiple of the word size.
   MUST_USE_RESULT HeapObject* Allocate(size_t size_in_bytes);
 
+  // Takes a node of at least {size_in_bytes} off the free list without
+  // touching the linear allocation area of the owner. The size of the node is
+  // returned in {node_size}. Returns nullptr if no such node is available.
+  // Can be called concurrently with the other synchronized operations, i.e.,
+  // Free and Allocate.
+  MUST_USE_RESULT FreeSpace* AllocateNodeSynchronized(size_t size_in_bytes,
+                                                      size_t* node_size);
+
   // Clear the free list.
   void Reset();
 
@@ -1814,6 +1850,10 @@ class V8_EXPORT_PRIVATE FreeList {
   PagedSpace* owner() { return owner_; }
   size_t wasted_bytes() { return wasted_bytes_.Value(); }
 
+  // Guards the category lists. Only taken for operations that may run
+  // concurrently with local allocation buffer refills.
+  base::Mutex* mutex() { return &mutex_; }
+
   template <typename Callback>
   void ForAllFreeListCategories(FreeListCategoryType type, Callback callback) {
     FreeListCategory* current = categories_[type];
@@ -1911,6 +1951,7 @@ class V8_EXPORT_PRIVATE FreeList {
   PagedSpace* owner_;
   base::AtomicNumber<size_t> wasted_bytes_;
   FreeListCategory* categories_[kNumberOfCategories];
+  base::Mutex mutex_;
 
   friend class FreeListCategory;
 
@@ -2066,6 +2107,20 @@ class V8_EXPORT_PRIVATE PagedSpace : NON_EXPORTED_BASE(public Space) {
   MUST_USE_RESULT inline AllocationResult AllocateRawUnalignedSynchronized(
       int size_in_bytes);
 
+  // Carves a local allocation buffer of at least {min_size_in_bytes} and at
+  // most {max_size_in_bytes} out of the free list. Only the free-list lookup
+  // is synchronized, so other threads can refill their buffers while the main
+  // thread keeps allocating from the linear allocation area. Returns an
+  // invalid buffer if no suitable node is available; callers then have to
+  // fall back to allocating on the main thread. Buffers are black when
+  // created during black allocation and have to be returned through
+  // FreeLocalAllocationBuffer before a GC or black allocation starts.
+  LocalAllocationBuffer AllocateLocalAllocationBuffer(int min_size_in_bytes,
+                                                      int max_size_in_bytes);
+
+  // Closes {buffer} and puts its unused area back on the free list.
+  void FreeLocalAllocationBuffer(LocalAllocationBuffer* buffer);
+
   // Allocate the requested number of bytes in the space double aligned if
   // possible, return a failure object if not.
   MUST_USE_RESULT inline AllocationResult AllocateRawAligned(
@@ -2203,6 +2258,13 @@ class V8_EXPORT_PRIVATE PagedSpace : NON_EXPORTED_BASE(public Space) {
   // size limit has been hit.
   bool Expand();
 
+  // Pages of non-executable spaces are returned to the memory allocator's
+  // pool when released and taken from it when the space expands, which saves
+  // mapping and unmapping them over and over.
+  bool CanPoolPages() {
+    return FLAG_pool_paged_space_pages && executable() == NOT_EXECUTABLE;
+  }
+
   // Generic fast case allocation function that tries linear allocation at the
   // address denoted by top in allocation_info_.
   inline HeapObject* AllocateLinearly(int size_in_bytes);
@@ -2488,6 +2550,11 @@ class NewSpace : public Space {
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Move the capacity of the semispaces towards {target_capacity}. A single
+  // resize grows by at most --semi-space-growth-factor and shrinks to no less
+  // than half the current capacity, so that the size changes gradually.
+  void ResizeTowards(size_t target_capacity);
+
   // Return the allocated bytes in the active semispace.
   size_t Size() override {
     DCHECK_GE(top(), to_space_.page_low());
@@ -2635,6 +2702,11 @@ class NewSpace : public Space {
   // it in steps to guarantee that the observers are notified periodically.
   void UpdateInlineAllocationLimit(int size_in_bytes);
 
+  // Observers that allow delayed steps never lower the limit to less than
+  // this many bytes above the top, which keeps the inline allocation fast path
+  // at least as effective as a local allocation buffer.
+  static const intptr_t kMinimumInlineAllocationStep = 4 * KB;
+
   void DisableInlineAllocationSteps() {
     top_on_previous_step_ = 0;
     UpdateInlineAllocationLimit(0);
@@ -2725,6 +2797,9 @@ class NewSpace : public Space {
   // Update allocation info to match the current to-space page.
   void UpdateAllocationInfo();
 
+  void GrowTo(size_t new_capacity);
+  void ShrinkTo(size_t new_capacity);
+
   base::Mutex mutex_;
 
   // Allocation pointer and limit for normal allocation and allocation during
@@ -2920,6 +2995,7 @@ class LargeObjectSpace : public Space {
   void FreeUnmarkedObjects();
 
   void InsertChunkMapEntries(LargePage* page);
+  // The chunk_map_mutex_ has to be held when removing entries.
   void RemoveChunkMapEntries(LargePage* page);
   void RemoveChunkMapEntries(LargePage* page, Address free_start);
 
@@ -89,6 +89,76 @@ class Worklist {
     return global_pool_.empty();
   }
 
+  // Returns true if the global pool of segments is empty. Private segments of
+  // tasks are not taken into account, so this can be used by one task while
+  // other tasks are running.
+  bool IsGlobalPoolEmpty() {
+    base::LockGuard<base::Mutex> guard(&lock_);
+    return global_pool_.empty();
+  }
+
+  // Returns the number of objects in the private segments of the given task.
+  size_t LocalSize(int task_id) {
+    return private_pop_segment_[task_id]->Size() +
+           private_push_segment_[task_id]->Size();
+  }
+
+  // Returns the number of objects in the global pool of segments.
+  size_t GlobalPoolSize() {
+    base::LockGuard<base::Mutex> guard(&lock_);
+    size_t result = 0;
+    for (Segment* segment : global_pool_) result += segment->Size();
+    return result;
+  }
+
+  // Calls the specified callback on each element of all segments and replaces
+  // the element with the result of the callback. If the callback returns
+  // nullptr then the element is removed from the worklist. The callback must
+  // accept HeapObject* and return HeapObject*. Can only be used without
+  // concurrent access.
+  template <typename Callback>
+  void Update(Callback callback) {
+    for (int i = 0; i < kMaxNumTasks; i++) {
+      private_pop_segment_[i]->Update(callback);
+      private_push_segment_[i]->Update(callback);
+    }
+    base::LockGuard<base::Mutex> guard(&lock_);
+    std::vector<Segment*> new_pool;
+    for (Segment* segment : global_pool_) {
+      segment->Update(callback);
+      if (segment->IsEmpty()) {
+        delete segment;
+      } else {
+        new_pool.push_back(segment);
+      }
+    }
+    global_pool_.swap(new_pool);
+  }
+
+  // Removes all elements from the worklist. Can only be used without
+  // concurrent access.
+  void Clear() {
+    for (int i = 0; i < kMaxNumTasks; i++) {
+      private_pop_segment_[i]->Clear();
+      private_push_segment_[i]->Clear();
+    }
+    base::LockGuard<base::Mutex> guard(&lock_);
+    for (Segment* segment : global_pool_) delete segment;
+    global_pool_.clear();
+  }
+
+  // Publishes all non-empty private segments of the given task to the global
+  // pool, making them available for stealing by other tasks.
+  void FlushToGlobal(int task_id) {
+    DCHECK_LT(task_id, kMaxNumTasks);
+    if (!private_push_segment_[task_id]->IsEmpty()) {
+      PublishPushSegmentToGlobal(task_id);
+    }
+    if (!private_pop_segment_[task_id]->IsEmpty()) {
+      PublishPopSegmentToGlobal(task_id);
+    }
+  }
+
  private:
   FRIEND_TEST(Worklist, SegmentCreate);
   FRIEND_TEST(Worklist, SegmentPush);
@@ -124,6 +194,16 @@ class Worklist {
     bool IsFull() { return index_ == kCapacity; }
     void Clear() { index_ = 0; }
 
+    template <typename Callback>
+    void Update(Callback callback) {
+      size_t new_index = 0;
+      for (size_t i = 0; i < index_; i++) {
+        HeapObject* object = callback(objects_[i]);
+        if (object != nullptr) objects_[new_index++] = object;
+      }
+      index_ = new_index;
+    }
+
    private:
     size_t index_;
     HeapObject* objects_[kCapacity];
@@ -139,6 +219,12 @@ class Worklist {
     private_push_segment_[task_id] = new Segment();
   }
 
+  V8_NOINLINE void PublishPopSegmentToGlobal(int task_id) {
+    base::LockGuard<base::Mutex> guard(&lock_);
+    global_pool_.push_back(private_pop_segment_[task_id]);
+    private_pop_segment_[task_id] = new Segment();
+  }
+
   V8_NOINLINE bool StealPopSegmentFromGlobal(int task_id) {
     base::LockGuard<base::Mutex> guard(&lock_);
     if (global_pool_.empty()) return false;
@@ -172,6 +258,10 @@ class WorklistView {
   // thread without concurrent access.
   bool IsGlobalEmpty() { return worklist_->IsGlobalEmpty(); }
 
+  // Publishes the local portion of the worklist so that other tasks can steal
+  // it.
+  void FlushToGlobal() { worklist_->FlushToGlobal(task_id_); }
+
  private:
   Worklist* worklist_;
   int task_id_;
@@ -1617,7 +1617,8 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-Node* AccessorAssembler::StubCachePrimaryOffset(Node* name, Node* map) {
+Node* AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                Node* name, Node* map) {
   // See v8::internal::StubCache::PrimaryOffset().
   STATIC_ASSERT(StubCache::kCacheIndexShift == Name::kHashShift);
   // Compute the hash of the name (use entire hash field).
@@ -1631,24 +1632,36 @@ Node* AccessorAssembler::StubCachePrimaryOffset(Node* name, Node* map) {
   // risk of collision even if the heap is spread over an area larger than
   // 4Gb (and not at all if it isn't).
   Node* map32 = TruncateWordToWord32(BitcastTaggedToWord(map));
+  Node* map_mix_shift =
+      Load(MachineType::Uint32(),
+           ExternalConstant(ExternalReference(
+               stub_cache->map_mix_shift_reference())));
+  Node* map_mix_mask = Load(MachineType::Uint32(),
+                            ExternalConstant(ExternalReference(
+                                stub_cache->map_mix_mask_reference())));
+  map32 = Word32Xor(
+      map32, Word32And(Word32Shr(map32, map_mix_shift), map_mix_mask));
   Node* hash = Int32Add(hash_field, map32);
   // Base the offset on a simple combination of name and map.
   hash = Word32Xor(hash, Int32Constant(StubCache::kPrimaryMagic));
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = Load(MachineType::Uint32(),
+                    ExternalConstant(ExternalReference(
+                        stub_cache->mask_reference(StubCache::kPrimary))));
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
-Node* AccessorAssembler::StubCacheSecondaryOffset(Node* name, Node* seed) {
+Node* AccessorAssembler::StubCacheSecondaryOffset(StubCache* stub_cache,
+                                                  Node* name, Node* seed) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
   Node* name32 = TruncateWordToWord32(BitcastTaggedToWord(name));
   Node* hash = Int32Sub(TruncateWordToWord32(seed), name32);
   hash = Int32Add(hash, Int32Constant(StubCache::kSecondaryMagic));
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = Load(MachineType::Uint32(),
+                    ExternalConstant(ExternalReference(
+                        stub_cache->mask_reference(StubCache::kSecondary))));
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
 void AccessorAssembler::TryProbeStubCacheTable(StubCache* stub_cache,
@@ -1674,20 +1687,21 @@ void AccessorAssembler::TryProbeStubCacheTable(StubCache* stub_cache,
 
   // Check that the key in the entry matches the name.
   Node* key_base =
-      ExternalConstant(ExternalReference(stub_cache->key_reference(table)));
+      Load(MachineType::Pointer(),
+           ExternalConstant(
+               ExternalReference(stub_cache->table_reference(table))));
+  STATIC_ASSERT(offsetof(StubCache::Entry, key) == 0);
   Node* entry_key = Load(MachineType::Pointer(), key_base, entry_offset);
   GotoIf(WordNotEqual(name, entry_key), if_miss);
 
   // Get the map entry from the cache.
-  DCHECK_EQ(kPointerSize * 2, stub_cache->map_reference(table).address() -
-                                  stub_cache->key_reference(table).address());
+  STATIC_ASSERT(offsetof(StubCache::Entry, map) == kPointerSize * 2);
   Node* entry_map =
       Load(MachineType::Pointer(), key_base,
            IntPtrAdd(entry_offset, IntPtrConstant(kPointerSize * 2)));
   GotoIf(WordNotEqual(map, entry_map), if_miss);
 
-  DCHECK_EQ(kPointerSize, stub_cache->value_reference(table).address() -
-                              stub_cache->key_reference(table).address());
+  STATIC_ASSERT(offsetof(StubCache::Entry, value) == kPointerSize);
   Node* handler = Load(MachineType::TaggedPointer(), key_base,
                        IntPtrAdd(entry_offset, IntPtrConstant(kPointerSize)));
 
@@ -1711,14 +1725,15 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache, Node* receiver,
   Node* receiver_map = LoadMap(receiver);
 
   // Probe the primary table.
-  Node* primary_offset = StubCachePrimaryOffset(name, receiver_map);
+  Node* primary_offset = StubCachePrimaryOffset(stub_cache, name, receiver_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          receiver_map, if_handler, var_handler, &try_secondary);
 
   BIND(&try_secondary);
   {
     // Probe the secondary table.
-    Node* secondary_offset = StubCacheSecondaryOffset(name, primary_offset);
+    Node* secondary_offset =
+        StubCacheSecondaryOffset(stub_cache, name, primary_offset);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            receiver_map, if_handler, var_handler, &miss);
   }
@@ -1743,12 +1758,15 @@ void AccessorAssembler::LoadIC_BytecodeHandler(const LoadICParameters* p,
   // changes in control flow and logic. We currently have no way of ensuring
   // that no frame is constructed, so it's easy to break this optimization by
   // accident.
-  Label stub_call(this, Label::kDeferred), miss(this, Label::kDeferred);
+  Label stub_call(this, Label::kDeferred), miss(this, Label::kDeferred),
+      no_feedback(this, Label::kDeferred);
 
   // Inlined fast path.
   {
     Comment("LoadIC_BytecodeHandler_fast");
 
+    GotoIf(IsUndefined(p->vector), &no_feedback);
+
     Node* recv_map = LoadReceiverMap(p->receiver);
     GotoIf(IsDeprecatedMap(recv_map), &miss);
 
@@ -1790,6 +1808,18 @@ void AccessorAssembler::LoadIC_BytecodeHandler(const LoadICParameters* p,
     exit_point->ReturnCallRuntime(Runtime::kLoadIC_Miss, p->context,
                                   p->receiver, p->name, p->slot, p->vector);
   }
+
+  BIND(&no_feedback);
+  {
+    Comment("LoadIC_BytecodeHandler_nofeedback");
+
+    // Functions that run without a feedback vector use the generic load.
+    Callable ic =
+        Builtins::CallableFor(isolate(), Builtins::kKeyedLoadIC_Megamorphic);
+    Node* code_target = HeapConstant(ic.code());
+    exit_point->ReturnCallStub(ic.descriptor(), code_target, p->context,
+                               p->receiver, p->name, p->slot, p->vector);
+  }
 }
 
 void AccessorAssembler::LoadIC(const LoadICParameters* p) {
@@ -1799,7 +1829,10 @@ void AccessorAssembler::LoadIC(const LoadICParameters* p) {
 
   VARIABLE(var_handler, MachineRepresentation::kTagged);
   Label if_handler(this, &var_handler), non_inlined(this, Label::kDeferred),
-      try_polymorphic(this), miss(this, Label::kDeferred);
+      try_polymorphic(this), miss(this, Label::kDeferred),
+      no_feedback(this, Label::kDeferred);
+
+  GotoIf(IsUndefined(p->vector), &no_feedback);
 
   Node* receiver_map = LoadReceiverMap(p->receiver);
   GotoIf(IsDeprecatedMap(receiver_map), &miss);
@@ -1828,6 +1861,11 @@ void AccessorAssembler::LoadIC(const LoadICParameters* p) {
   BIND(&miss);
   direct_exit.ReturnCallRuntime(Runtime::kLoadIC_Miss, p->context, p->receiver,
                                 p->name, p->slot, p->vector);
+
+  BIND(&no_feedback);
+  direct_exit.ReturnCallStub(
+      Builtins::CallableFor(isolate(), Builtins::kKeyedLoadIC_Megamorphic),
+      p->context, p->receiver, p->name, p->slot, p->vector);
 }
 
 void AccessorAssembler::LoadIC_Noninlined(const LoadICParameters* p,
@@ -2030,7 +2068,9 @@ void AccessorAssembler::KeyedLoadIC(const LoadICParameters* p) {
   Label if_handler(this, &var_handler), try_polymorphic(this, Label::kDeferred),
       try_megamorphic(this, Label::kDeferred),
       try_polymorphic_name(this, Label::kDeferred),
-      miss(this, Label::kDeferred);
+      miss(this, Label::kDeferred), no_feedback(this, Label::kDeferred);
+
+  GotoIf(IsUndefined(p->vector), &no_feedback);
 
   Node* receiver_map = LoadReceiverMap(p->receiver);
   GotoIf(IsDeprecatedMap(receiver_map), &miss);
@@ -2084,6 +2124,14 @@ void AccessorAssembler::KeyedLoadIC(const LoadICParameters* p) {
     TailCallRuntime(Runtime::kKeyedLoadIC_Miss, p->context, p->receiver,
                     p->name, p->slot, p->vector);
   }
+  BIND(&no_feedback);
+  {
+    // Functions that run without a feedback vector use the generic load.
+    Comment("KeyedLoadIC_no_feedback");
+    TailCallStub(
+        Builtins::CallableFor(isolate(), Builtins::kKeyedLoadIC_Megamorphic),
+        p->context, p->receiver, p->name, p->slot, p->vector);
+  }
 }
 
 void AccessorAssembler::KeyedLoadICGeneric(const LoadICParameters* p) {
@@ -2144,7 +2192,10 @@ void AccessorAssembler::StoreIC(const StoreICParameters* p,
   VARIABLE(var_handler, MachineRepresentation::kTagged);
   Label if_handler(this, &var_handler), try_polymorphic(this, Label::kDeferred),
       try_megamorphic(this, Label::kDeferred),
-      try_uninitialized(this, Label::kDeferred), miss(this, Label::kDeferred);
+      try_uninitialized(this, Label::kDeferred), miss(this, Label::kDeferred),
+      no_feedback(this, Label::kDeferred);
+
+  GotoIf(IsUndefined(p->vector), &no_feedback);
 
   Node* receiver_map = LoadReceiverMap(p->receiver);
   GotoIf(IsDeprecatedMap(receiver_map), &miss);
@@ -2194,11 +2245,18 @@ void AccessorAssembler::StoreIC(const StoreICParameters* p,
     TailCallRuntime(Runtime::kStoreIC_Miss, p->context, p->value, p->slot,
                     p->vector, p->receiver, p->name);
   }
+  BIND(&no_feedback);
+  {
+    // Functions that run without a feedback vector use the generic store.
+    TailCallStub(
+        CodeFactory::KeyedStoreIC_Megamorphic(isolate(), language_mode),
+        p->context, p->receiver, p->name, p->value, p->slot, p->vector);
+  }
 }
 
 void AccessorAssembler::KeyedStoreIC(const StoreICParameters* p,
                                      LanguageMode language_mode) {
-  Label miss(this, Label::kDeferred);
+  Label miss(this, Label::kDeferred), no_feedback(this, Label::kDeferred);
   {
     VARIABLE(var_handler, MachineRepresentation::kTagged);
 
@@ -2207,6 +2265,8 @@ void AccessorAssembler::KeyedStoreIC(const StoreICParameters* p,
         try_megamorphic(this, Label::kDeferred),
         try_polymorphic_name(this, Label::kDeferred);
 
+    GotoIf(IsUndefined(p->vector), &no_feedback);
+
     Node* receiver_map = LoadReceiverMap(p->receiver);
     GotoIf(IsDeprecatedMap(receiver_map), &miss);
 
@@ -2262,6 +2322,14 @@ void AccessorAssembler::KeyedStoreIC(const StoreICParameters* p,
     TailCallRuntime(Runtime::kKeyedStoreIC_Miss, p->context, p->value, p->slot,
                     p->vector, p->receiver, p->name);
   }
+  BIND(&no_feedback);
+  {
+    // Functions that run without a feedback vector use the generic store.
+    Comment("KeyedStoreIC_no_feedback");
+    TailCallStub(
+        CodeFactory::KeyedStoreIC_Megamorphic(isolate(), language_mode),
+        p->context, p->receiver, p->name, p->value, p->slot, p->vector);
+  }
 }
 
 //////////////////// Public methods.
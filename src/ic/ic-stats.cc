@@ -140,5 +140,66 @@ void ICInfo::AppendToTracedValue(v8::tracing::TracedValue* value) const {
   value->EndDictionary();
 }
 
+void ICTransitionStatistics::RecordPolymorphic(JSFunction* host, int slot) {
+  Record(host, slot, false);
+}
+
+void ICTransitionStatistics::RecordMegamorphic(JSFunction* host, int slot) {
+  Record(host, slot, true);
+}
+
+void ICTransitionStatistics::Record(JSFunction* host, int slot,
+                                    bool megamorphic) {
+  SharedFunctionInfo* shared = host->shared();
+  Object* script = shared->script();
+  SlotKey key;
+  key.script_id = script->IsScript() ? Script::cast(script)->id() : -1;
+  key.function_position = shared->start_position();
+  key.slot = slot;
+  Counts& slot_counts = slots_[key];
+  Counts& script_counts = scripts_[key.script_id];
+  if (megamorphic) {
+    slot_counts.megamorphic++;
+    script_counts.megamorphic++;
+  } else {
+    slot_counts.polymorphic++;
+    script_counts.polymorphic++;
+  }
+}
+
+ICTransitionStatistics::Counts ICTransitionStatistics::ForScript(
+    int script_id) const {
+  auto it = scripts_.find(script_id);
+  return it == scripts_.end() ? Counts() : it->second;
+}
+
+ICTransitionStatistics::Counts ICTransitionStatistics::ForSlot(
+    int script_id, int function_position, int slot) const {
+  SlotKey key = {script_id, function_position, slot};
+  auto it = slots_.find(key);
+  return it == slots_.end() ? Counts() : it->second;
+}
+
+void ICTransitionStatistics::Print(std::ostream& os) const {
+  os << "IC transitions (script, function position, slot: polymorphic, "
+        "megamorphic)"
+     << std::endl;
+  for (const auto& entry : slots_) {
+    os << "  " << entry.first.script_id << ", "
+       << entry.first.function_position << ", " << entry.first.slot << ": "
+       << entry.second.polymorphic << ", " << entry.second.megamorphic
+       << std::endl;
+  }
+  for (const auto& entry : scripts_) {
+    os << "  script " << entry.first << ": " << entry.second.polymorphic
+       << ", " << entry.second.megamorphic << std::endl;
+  }
+}
+
+void ICTransitionStatistics::Reset() {
+  slots_.clear();
+  scripts_.clear();
+}
+
 }  // namespace internal
 }  // namespace v8
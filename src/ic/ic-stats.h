@@ -5,7 +5,9 @@
 #ifndef V8_IC_IC_STATS_H_
 #define V8_IC_IC_STATS_H_
 
+#include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -71,6 +73,53 @@ class ICStats {
   int pos_;
 };
 
+// Aggregated per-isolate counters of IC transitions to the polymorphic and
+// megamorphic states. Unlike ICStats, which records every transition, this
+// only bumps a counter, so it is cheap enough to leave on in production.
+// Slots are identified by the script id, the start position of the function
+// owning the feedback vector, and the feedback slot index.
+class ICTransitionStatistics {
+ public:
+  struct Counts {
+    Counts() : polymorphic(0), megamorphic(0) {}
+    int polymorphic;
+    int megamorphic;
+  };
+
+  struct SlotKey {
+    int script_id;
+    int function_position;
+    int slot;
+    bool operator<(const SlotKey& other) const {
+      if (script_id != other.script_id) return script_id < other.script_id;
+      if (function_position != other.function_position) {
+        return function_position < other.function_position;
+      }
+      return slot < other.slot;
+    }
+  };
+
+  typedef std::map<SlotKey, Counts> SlotMap;
+  typedef std::map<int, Counts> ScriptMap;
+
+  void RecordPolymorphic(JSFunction* host, int slot);
+  void RecordMegamorphic(JSFunction* host, int slot);
+
+  Counts ForScript(int script_id) const;
+  Counts ForSlot(int script_id, int function_position, int slot) const;
+  const SlotMap& slots() const { return slots_; }
+  const ScriptMap& scripts() const { return scripts_; }
+
+  void Print(std::ostream& os) const;
+  void Reset();
+
+ private:
+  void Record(JSFunction* host, int slot, bool megamorphic);
+
+  SlotMap slots_;
+  ScriptMap scripts_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -506,6 +506,10 @@ void IC::ConfigureVectorState(IC::State new_state, Handle<Object> key) {
   } else if (new_state == MEGAMORPHIC) {
     DCHECK_IMPLIES(!is_keyed(), key->IsName());
     nexus()->ConfigureMegamorphic(key->IsName() ? PROPERTY : ELEMENT);
+    if (V8_UNLIKELY(FLAG_ic_transition_stats)) {
+      isolate()->GetICTransitionStatistics()->RecordMegamorphic(
+          GetHostFunction(), slot().ToInt());
+    }
   } else {
     UNREACHABLE();
   }
@@ -535,6 +539,10 @@ void IC::ConfigureVectorState(Handle<Name> name, MapHandles const& maps,
   // Non-keyed ICs don't track the name explicitly.
   if (!is_keyed()) name = Handle<Name>::null();
   nexus()->ConfigurePolymorphic(name, maps, handlers);
+  if (V8_UNLIKELY(FLAG_ic_transition_stats)) {
+    isolate()->GetICTransitionStatistics()->RecordPolymorphic(
+        GetHostFunction(), slot().ToInt());
+  }
 
   vector_set_ = true;
   OnFeedbackChanged(isolate(), GetHostFunction());
@@ -960,8 +968,13 @@ void LoadIC::UpdateCaches(LookupIterator* lookup) {
   }
 
   Handle<Object> code;
-  if (lookup->state() == LookupIterator::JSPROXY ||
-      lookup->state() == LookupIterator::ACCESS_CHECK) {
+  if (lookup->state() == LookupIterator::JSPROXY && IsLoadIC() &&
+      lookup->GetReceiver()->IsJSProxy() && !lookup->name()->IsPrivate()) {
+    // Named loads from a proxy call the get trap from the handler.
+    TRACE_HANDLER_STATS(isolate(), LoadIC_LoadProxy);
+    code = isolate()->builtins()->LoadIC_Proxy();
+  } else if (lookup->state() == LookupIterator::JSPROXY ||
+             lookup->state() == LookupIterator::ACCESS_CHECK) {
     code = slow_stub();
   } else if (!lookup->IsFound()) {
     TRACE_HANDLER_STATS(isolate(), LoadIC_LoadNonexistentDH);
@@ -1594,6 +1607,22 @@ MaybeHandle<Object> StoreIC::Store(Handle<Object> object, Handle<Name> name,
                                    JSReceiver::StoreFromKeyed store_mode) {
   // TODO(verwaest): Let SetProperty do the migration, since storing a property
   // might deprecate the current map again, if value does not fit.
+  if (object->IsJSProxy() && IsStoreIC() && FLAG_use_ic &&
+      !name->IsPrivate()) {
+    // Named stores to a proxy call the set trap from the handler.
+    if (state() == UNINITIALIZED) {
+      TRACE_HANDLER_STATS(isolate(), StoreIC_Premonomorphic);
+      ConfigureVectorState(PREMONOMORPHIC, Handle<Object>());
+    } else {
+      TRACE_HANDLER_STATS(isolate(), StoreIC_StoreProxy);
+      update_receiver_map(object);
+      PatchCache(name, is_strict(language_mode())
+                           ? isolate()->builtins()->StoreICStrict_Proxy()
+                           : isolate()->builtins()->StoreIC_Proxy());
+    }
+    TRACE_IC("StoreIC", name);
+  }
+
   if (MigrateDeprecated(object) || object->IsJSProxy()) {
     Handle<Object> result;
     ASSIGN_RETURN_ON_EXCEPTION(
@@ -2329,6 +2358,18 @@ MaybeHandle<Object> KeyedStoreIC::Store(Handle<Object> object,
 // Static IC stub generators.
 //
 
+namespace {
+
+// Interpreted functions that run without a feedback vector reach the misses
+// with undefined instead of a vector. They perform the generic operation and
+// take the language mode from the calling function.
+LanguageMode CallerLanguageMode(Isolate* isolate) {
+  JavaScriptFrameIterator it(isolate);
+  return it.frame()->function()->shared()->language_mode();
+}
+
+}  // namespace
+
 // Used from ic-<arch>.cc.
 RUNTIME_FUNCTION(Runtime_LoadIC_Miss) {
   HandleScope scope(isolate);
@@ -2336,6 +2377,10 @@ RUNTIME_FUNCTION(Runtime_LoadIC_Miss) {
   // Runtime functions don't follow the IC's calling convention.
   Handle<Object> receiver = args.at(0);
   Handle<Name> key = args.at<Name>(1);
+  if (!args[3]->IsFeedbackVector()) {
+    RETURN_RESULT_OR_FAILURE(
+        isolate, Runtime::GetObjectProperty(isolate, receiver, key));
+  }
   Handle<Smi> slot = args.at<Smi>(2);
   Handle<FeedbackVector> vector = args.at<FeedbackVector>(3);
   FeedbackSlot vector_slot = vector->ToSlot(slot->value());
@@ -2436,6 +2481,10 @@ RUNTIME_FUNCTION(Runtime_KeyedLoadIC_Miss) {
   // Runtime functions don't follow the IC's calling convention.
   Handle<Object> receiver = args.at(0);
   Handle<Object> key = args.at(1);
+  if (!args[3]->IsFeedbackVector()) {
+    RETURN_RESULT_OR_FAILURE(
+        isolate, Runtime::GetObjectProperty(isolate, receiver, key));
+  }
   Handle<Smi> slot = args.at<Smi>(2);
   Handle<FeedbackVector> vector = args.at<FeedbackVector>(3);
   FeedbackSlot vector_slot = vector->ToSlot(slot->value());
@@ -2451,10 +2500,15 @@ RUNTIME_FUNCTION(Runtime_StoreIC_Miss) {
   DCHECK_EQ(5, args.length());
   // Runtime functions don't follow the IC's calling convention.
   Handle<Object> value = args.at(0);
-  Handle<Smi> slot = args.at<Smi>(1);
-  Handle<FeedbackVector> vector = args.at<FeedbackVector>(2);
   Handle<Object> receiver = args.at(3);
   Handle<Name> key = args.at<Name>(4);
+  if (!args[2]->IsFeedbackVector()) {
+    RETURN_RESULT_OR_FAILURE(
+        isolate, Runtime::SetObjectProperty(isolate, receiver, key, value,
+                                            CallerLanguageMode(isolate)));
+  }
+  Handle<Smi> slot = args.at<Smi>(1);
+  Handle<FeedbackVector> vector = args.at<FeedbackVector>(2);
   FeedbackSlot vector_slot = vector->ToSlot(slot->value());
   FeedbackSlotKind kind = vector->GetKind(vector_slot);
   if (IsStoreICKind(kind) || IsStoreOwnICKind(kind)) {
@@ -2482,10 +2536,15 @@ RUNTIME_FUNCTION(Runtime_KeyedStoreIC_Miss) {
   DCHECK_EQ(5, args.length());
   // Runtime functions don't follow the IC's calling convention.
   Handle<Object> value = args.at(0);
-  Handle<Smi> slot = args.at<Smi>(1);
-  Handle<FeedbackVector> vector = args.at<FeedbackVector>(2);
   Handle<Object> receiver = args.at(3);
   Handle<Object> key = args.at(4);
+  if (!args[2]->IsFeedbackVector()) {
+    RETURN_RESULT_OR_FAILURE(
+        isolate, Runtime::SetObjectProperty(isolate, receiver, key, value,
+                                            CallerLanguageMode(isolate)));
+  }
+  Handle<Smi> slot = args.at<Smi>(1);
+  Handle<FeedbackVector> vector = args.at<FeedbackVector>(2);
   FeedbackSlot vector_slot = vector->ToSlot(slot->value());
   KeyedStoreICNexus nexus(vector, vector_slot);
   KeyedStoreIC ic(isolate, &nexus);
@@ -2500,11 +2559,16 @@ RUNTIME_FUNCTION(Runtime_KeyedStoreIC_Slow) {
   // Runtime functions don't follow the IC's calling convention.
   Handle<Object> value = args.at(0);
   Handle<Smi> slot = args.at<Smi>(1);
-  Handle<FeedbackVector> vector = args.at<FeedbackVector>(2);
   Handle<Object> object = args.at(3);
   Handle<Object> key = args.at(4);
-  FeedbackSlot vector_slot = vector->ToSlot(slot->value());
-  LanguageMode language_mode = vector->GetLanguageMode(vector_slot);
+  LanguageMode language_mode;
+  if (args[2]->IsFeedbackVector()) {
+    Handle<FeedbackVector> vector = args.at<FeedbackVector>(2);
+    FeedbackSlot vector_slot = vector->ToSlot(slot->value());
+    language_mode = vector->GetLanguageMode(vector_slot);
+  } else {
+    language_mode = CallerLanguageMode(isolate);
+  }
   RETURN_RESULT_OR_FAILURE(
       isolate,
       Runtime::SetObjectProperty(isolate, object, key, value, language_mode));
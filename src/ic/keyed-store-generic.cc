@@ -483,8 +483,50 @@ void KeyedStoreGenericAssembler::EmitGenericElementStore(
   BIND(&if_grow);
   {
     Comment("Grow backing store");
-    // TODO(jkummerow): Support inline backing store growth.
-    Goto(slow);
+    // Growing is supported for stores at or shortly after the end of a
+    // JSArray, which covers building arrays by appending to them. Copy-on-write
+    // backing stores and large gaps are left to the runtime.
+    GotoIfNot(Word32Equal(instance_type, Int32Constant(JS_ARRAY_TYPE)), slow);
+    GotoIf(WordEqual(LoadMap(elements),
+                     LoadRoot(Heap::kFixedCOWArrayMapRootIndex)),
+           slow);
+    Node* capacity = SmiUntag(LoadFixedArrayBaseLength(elements));
+    VARIABLE(var_new_elements, MachineRepresentation::kTagged);
+    Label grow_double(this), grown(this);
+    GotoIf(Int32GreaterThan(elements_kind, Int32Constant(FAST_HOLEY_ELEMENTS)),
+           &grow_double);
+    var_new_elements.Bind(
+        TryGrowElementsCapacity(receiver, elements, FAST_HOLEY_ELEMENTS,
+                                intptr_index, capacity, INTPTR_PARAMETERS,
+                                slow));
+    Goto(&grown);
+
+    BIND(&grow_double);
+    var_new_elements.Bind(
+        TryGrowElementsCapacity(receiver, elements, FAST_HOLEY_DOUBLE_ELEMENTS,
+                                intptr_index, capacity, INTPTR_PARAMETERS,
+                                slow));
+    Goto(&grown);
+
+    // The store itself, including any elements kind transition, is done the
+    // same way as for stores within capacity.
+    BIND(&grown);
+    Node* new_elements = var_new_elements.value();
+    Node* length = SmiUntag(LoadJSArrayLength(receiver));
+    Label grow_and_increment_length_by_one(this),
+        grow_and_bump_length_with_gap(this);
+    Branch(WordEqual(intptr_index, length), &grow_and_increment_length_by_one,
+           &grow_and_bump_length_with_gap);
+
+    BIND(&grow_and_increment_length_by_one);
+    StoreElementWithCapacity(receiver, receiver_map, new_elements,
+                             elements_kind, intptr_index, value, context, slow,
+                             kIncrementLengthByOne);
+
+    BIND(&grow_and_bump_length_with_gap);
+    StoreElementWithCapacity(receiver, receiver_map, new_elements,
+                             elements_kind, intptr_index, value, context, slow,
+                             kBumpLengthWithGap);
   }
 
   // Any ElementsKind > LAST_FAST_ELEMENTS_KIND jumps here for further dispatch.
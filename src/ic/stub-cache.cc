@@ -4,8 +4,9 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
-#include "src/base/bits.h"
 #include "src/counters.h"
 #include "src/heap/heap.h"
 #include "src/ic/ic-inl.h"
@@ -14,16 +15,64 @@ namespace v8 {
 namespace internal {
 
 StubCache::StubCache(Isolate* isolate, Code::Kind ic_kind)
-    : isolate_(isolate), ic_kind_(ic_kind) {
+    : primary_(nullptr),
+      secondary_(nullptr),
+      map_mix_shift_(FLAG_stub_cache_mix_map_bits ? kMapMixShift : 0),
+      map_mix_mask_(FLAG_stub_cache_mix_map_bits ? ~0u : 0u),
+      updates_(0),
+      collisions_(0),
+      collisions_at_last_clear_(0),
+      isolate_(isolate),
+      ic_kind_(ic_kind) {
   // Ensure the nullptr (aka Smi::kZero) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(nullptr));
+  int max_bits = std::max(kMinTableBits,
+                          std::min(FLAG_stub_cache_max_table_bits,
+                                   static_cast<int>(kMaxTableBits)));
+  int primary_bits = std::max(
+      kMinTableBits, std::min(FLAG_stub_cache_primary_table_bits, max_bits));
+  int secondary_bits = std::max(
+      kMinTableBits, std::min(FLAG_stub_cache_secondary_table_bits, max_bits));
+  AllocateTables(primary_bits, secondary_bits);
+}
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
 }
 
-void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo32(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo32(kSecondaryTableSize));
-  Clear();
+void StubCache::Initialize() { Clear(); }
+
+void StubCache::AllocateTables(int primary_bits, int secondary_bits) {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+  primary_bits_ = primary_bits;
+  secondary_bits_ = secondary_bits;
+  primary_ = NewArray<Entry>(table_size(kPrimary));
+  secondary_ = NewArray<Entry>(table_size(kSecondary));
+  primary_mask_ = (table_size(kPrimary) - 1) << kCacheIndexShift;
+  secondary_mask_ = (table_size(kSecondary) - 1) << kCacheIndexShift;
+}
+
+void StubCache::MaybeGrow() {
+  // A working set that keeps retiring live primary entries at a rate close
+  // to the table size thrashes the secondary table; double both tables.
+  size_t collisions = collisions_ - collisions_at_last_clear_;
+  collisions_at_last_clear_ = collisions_;
+  if (!FLAG_adaptive_stub_cache) return;
+  if (collisions < static_cast<size_t>(table_size(kPrimary))) return;
+  int max_bits = std::min(FLAG_stub_cache_max_table_bits,
+                          static_cast<int>(kMaxTableBits));
+  if (primary_bits_ >= max_bits) return;
+  int secondary_bits = std::min(secondary_bits_ + 1, max_bits);
+  if (FLAG_trace_stub_cache) {
+    PrintIsolate(isolate_,
+                 "stub cache (%s): %zu collisions, growing to %d/%d entries\n",
+                 Code::Kind2String(ic_kind_), collisions,
+                 1 << (primary_bits_ + 1), 1 << secondary_bits);
+  }
+  AllocateTables(primary_bits_ + 1, secondary_bits);
 }
 
 #ifdef DEBUG
@@ -63,6 +112,10 @@ Object* StubCache::Set(Name* name, Map* map, Object* handler) {
   // If the primary entry has useful data in it, we retire it to the
   // secondary cache before overwriting it.
   if (old_handler != isolate_->builtins()->builtin(Builtins::kIllegal)) {
+    if (primary->key != name || primary->map != map) {
+      collisions_++;
+      isolate()->counters()->megamorphic_stub_cache_collisions()->Increment();
+    }
     Map* old_map = primary->map;
     int seed = PrimaryOffset(primary->key, old_map);
     int secondary_offset = SecondaryOffset(primary->key, seed);
@@ -74,6 +127,7 @@ Object* StubCache::Set(Name* name, Map* map, Object* handler) {
   primary->key = name;
   primary->value = handler;
   primary->map = map;
+  updates_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
   return handler;
 }
@@ -95,13 +149,14 @@ Object* StubCache::Get(Name* name, Map* map) {
 
 
 void StubCache::Clear() {
+  MaybeGrow();
   Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < table_size(kPrimary); i++) {
     primary_[i].key = isolate()->heap()->empty_string();
     primary_[i].map = nullptr;
     primary_[i].value = empty;
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < table_size(kSecondary); j++) {
     secondary_[j].key = isolate()->heap()->empty_string();
     secondary_[j].map = nullptr;
     secondary_[j].value = empty;
@@ -43,36 +43,42 @@ class StubCache {
   // Access cache for entry hash(name, map).
   Object* Set(Name* name, Map* map, Object* handler);
   Object* Get(Name* name, Map* map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). With
+  // --adaptive-stub-cache this also grows the tables if they had many
+  // collisions since the last clear.
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
+  // The tables are sized per isolate, so generated code loads the table
+  // address and the index mask through these references.
+  SCTableReference table_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_ : &secondary_));
   }
 
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  SCTableReference map_mix_shift_reference() {
+    return SCTableReference(reinterpret_cast<Address>(&map_mix_shift_));
   }
 
-  StubCache::Entry* first_entry(StubCache::Table table) {
-    switch (table) {
-      case StubCache::kPrimary:
-        return StubCache::primary_;
-      case StubCache::kSecondary:
-        return StubCache::secondary_;
-    }
-    UNREACHABLE();
+  SCTableReference map_mix_mask_reference() {
+    return SCTableReference(reinterpret_cast<Address>(&map_mix_mask_));
   }
 
+  int table_size(StubCache::Table table) const {
+    return 1 << (table == kPrimary ? primary_bits_ : secondary_bits_);
+  }
+
+  // Number of updates, which follow misses in generated code, and of live
+  // primary entries that were retired to the secondary table by an update.
+  size_t updates() const { return updates_; }
+  size_t collisions() const { return collisions_; }
+
   Isolate* isolate() { return isolate_; }
   Code::Kind ic_kind() const { return ic_kind_; }
 
@@ -81,25 +87,29 @@ class StubCache {
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kMinTableBits = 4;
+  static const int kMaxTableBits = 20;
 
   // Some magic number used in primary and secondary hash computations.
   static const int kPrimaryMagic = 0x3d532433;
   static const int kSecondaryMagic = 0xb16ca6e5;
 
-  static int PrimaryOffsetForTesting(Name* name, Map* map) {
+  // With --stub-cache-mix-map-bits the upper half of the map address is
+  // folded onto the lower half, so that maps on different pages of a large
+  // heap spread over the primary table.
+  static const int kMapMixShift = 16;
+
+  int PrimaryOffsetForTesting(Name* name, Map* map) {
     return PrimaryOffset(name, map);
   }
 
-  static int SecondaryOffsetForTesting(Name* name, int seed) {
+  int SecondaryOffsetForTesting(Name* name, int seed) {
     return SecondaryOffset(name, seed);
   }
 
   // The constructor is made public only for the purposes of testing.
   StubCache(Isolate* isolate, Code::Kind ic_kind);
+  ~StubCache();
 
  private:
   // The stub cache has a primary and secondary level.  The two levels have
@@ -110,9 +120,9 @@ class StubCache {
   // entries are overwritten.
 
   // Hash algorithm for the primary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name* name, Map* map) {
+  // AccessorAssembler::StubCachePrimaryOffset.  Returns an index into the
+  // table that is scaled by 1 << kCacheIndexShift.
+  int PrimaryOffset(Name* name, Map* map) const {
     STATIC_ASSERT(kCacheIndexShift == Name::kHashShift);
     // Compute the hash of the name (use entire hash field).
     DCHECK(name->HasHashCode());
@@ -122,20 +132,21 @@ class StubCache {
     // 4Gb (and not at all if it isn't).
     uint32_t map_low32bits =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(map));
+    map_low32bits ^= (map_low32bits >> map_mix_shift_) & map_mix_mask_;
     // Base the offset on a simple combination of name and map.
     uint32_t key = (map_low32bits + field) ^ kPrimaryMagic;
-    return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+    return key & primary_mask_;
   }
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name* name, int seed) {
+  // AccessorAssembler::StubCacheSecondaryOffset.  Returns an index into the
+  // table that is scaled by 1 << kCacheIndexShift.
+  int SecondaryOffset(Name* name, int seed) const {
     // Use the seed from the primary cache in the secondary cache.
     uint32_t name_low32bits =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name));
     uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-    return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+    return key & secondary_mask_;
   }
 
   // Compute the entry for a given offset in exactly the same way as
@@ -149,9 +160,27 @@ class StubCache {
                                     offset * multiplier);
   }
 
+  // (Re)allocates the tables with the given sizes; they must be cleared
+  // before use.
+  void AllocateTables(int primary_bits, int secondary_bits);
+  // Grows the tables if the collisions since the last clear suggest that the
+  // working set does not fit.
+  void MaybeGrow();
+
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // Accessed from generated code through the references above.
+  Entry* primary_;
+  Entry* secondary_;
+  uint32_t primary_mask_;
+  uint32_t secondary_mask_;
+  uint32_t map_mix_shift_;
+  uint32_t map_mix_mask_;
+
+  int primary_bits_;
+  int secondary_bits_;
+  size_t updates_;
+  size_t collisions_;
+  size_t collisions_at_last_clear_;
   Isolate* isolate_;
   Code::Kind ic_kind_;
 
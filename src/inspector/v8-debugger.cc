@@ -1011,7 +1011,8 @@ void V8Debugger::asyncTaskScheduledForStack(const String16& taskName,
   v8::HandleScope scope(m_isolate);
   std::shared_ptr<AsyncStackTrace> asyncStack =
       AsyncStackTrace::capture(this, currentContextGroupId(), taskName,
-                               V8StackTraceImpl::maxCallStackSizeToCapture);
+                               V8StackTraceImpl::maxCallStackSizeToCapture,
+                               true);
   if (asyncStack) {
     m_asyncTaskStacks[task] = asyncStack;
     if (recurring) m_recurringTasks.insert(task);
@@ -1115,6 +1116,7 @@ void V8Debugger::allAsyncTasksCanceled() {
   m_asyncTaskCreationStacks.clear();
 
   m_framesCache.clear();
+  for (auto& recent : m_recentAsyncStacks) recent.reset();
   m_allAsyncStacks.clear();
   m_asyncStacksCount = 0;
 }
@@ -1202,6 +1204,15 @@ std::shared_ptr<StackFrame> V8Debugger::symbolize(
   return frame;
 }
 
+std::shared_ptr<AsyncStackTrace> V8Debugger::recentAsyncStack(size_t hash) {
+  return m_recentAsyncStacks[hash % kRecentAsyncStacks].lock();
+}
+
+void V8Debugger::setRecentAsyncStack(
+    size_t hash, std::shared_ptr<AsyncStackTrace> asyncStack) {
+  m_recentAsyncStacks[hash % kRecentAsyncStacks] = asyncStack;
+}
+
 void V8Debugger::setMaxAsyncTaskStacksForTest(int limit) {
   m_maxAsyncCallStacks = 0;
   collectOldAsyncStacksIfNeeded();
@@ -93,6 +93,9 @@ class V8Debugger : public v8::debug::DebugDelegate {
 
   std::shared_ptr<StackFrame> symbolize(v8::Local<v8::StackFrame> v8Frame);
 
+  std::shared_ptr<AsyncStackTrace> recentAsyncStack(size_t hash);
+  void setRecentAsyncStack(size_t hash, std::shared_ptr<AsyncStackTrace>);
+
   std::unique_ptr<V8StackTraceImpl> createStackTrace(v8::Local<v8::StackTrace>);
   std::unique_ptr<V8StackTraceImpl> captureStackTrace(bool fullStack);
 
@@ -216,6 +219,10 @@ class V8Debugger : public v8::debug::DebugDelegate {
   // are weak, which allows to collect some stacks when there are too many.
   std::list<std::shared_ptr<AsyncStackTrace>> m_allAsyncStacks;
   std::map<int, std::weak_ptr<StackFrame>> m_framesCache;
+  // Recently scheduled async stacks, indexed by their hash, which tasks
+  // scheduled from the same place can share.
+  static const size_t kRecentAsyncStacks = 64;
+  std::weak_ptr<AsyncStackTrace> m_recentAsyncStacks[kRecentAsyncStacks];
 
   protocol::HashMap<V8DebuggerAgentImpl*, int> m_maxAsyncCallStackDepthMap;
   void* m_taskWithScheduledBreak = nullptr;
@@ -220,12 +220,14 @@ Response V8HeapProfilerAgentImpl::takeHeapSnapshot(Maybe<bool> reportProgress) {
     progress.reset(new HeapSnapshotProgress(&m_frontend));
 
   GlobalObjectNameResolver resolver(m_session);
-  const v8::HeapSnapshot* snapshot =
-      profiler->TakeHeapSnapshot(progress.get(), &resolver);
-  if (!snapshot) return Response::Error("Failed to take heap snapshot");
   HeapSnapshotOutputStream stream(&m_frontend);
-  snapshot->Serialize(&stream);
-  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+  // The snapshot is only needed for the chunks sent to the frontend, so let
+  // the profiler write it out without building the graph of HeapGraphNodes
+  // and release it right afterwards.
+  if (!profiler->TakeHeapSnapshotToStream(&stream, progress.get(),
+                                          &resolver)) {
+    return Response::Error("Failed to take heap snapshot");
+  }
   return Response::OK();
 }
 
@@ -30,6 +30,29 @@ std::vector<std::shared_ptr<StackFrame>> toFramesVector(
   return frames;
 }
 
+std::vector<int> toFrameIdsVector(v8::Local<v8::StackTrace> v8StackTrace,
+                                  int maxStackSize) {
+  int frameCount = std::min(v8StackTrace->GetFrameCount(), maxStackSize);
+  std::vector<int> frameIds;
+  frameIds.reserve(frameCount);
+  for (int i = 0; i < frameCount; ++i) {
+    frameIds.push_back(v8::debug::GetStackFrameId(v8StackTrace->GetFrame(i)));
+  }
+  return frameIds;
+}
+
+size_t asyncStackHash(int contextGroupId, const String16& description,
+                      const std::vector<int>& frameIds,
+                      const std::shared_ptr<AsyncStackTrace>& asyncParent,
+                      const std::shared_ptr<AsyncStackTrace>& asyncCreation) {
+  size_t hash = description.hash();
+  hash = 31 * hash + static_cast<size_t>(contextGroupId);
+  for (int frameId : frameIds) hash = 31 * hash + static_cast<size_t>(frameId);
+  hash = 31 * hash + reinterpret_cast<size_t>(asyncParent.get());
+  hash = 31 * hash + reinterpret_cast<size_t>(asyncCreation.get());
+  return hash;
+}
+
 void calculateAsyncChain(V8Debugger* debugger, int contextGroupId,
                          std::shared_ptr<AsyncStackTrace>* asyncParent,
                          std::shared_ptr<AsyncStackTrace>* asyncCreation,
@@ -293,17 +316,18 @@ StackFrame* V8StackTraceImpl::StackFrameIterator::frame() {
 // static
 std::shared_ptr<AsyncStackTrace> AsyncStackTrace::capture(
     V8Debugger* debugger, int contextGroupId, const String16& description,
-    int maxStackSize) {
+    int maxStackSize, bool reuseRecent) {
   DCHECK(debugger);
 
   v8::Isolate* isolate = debugger->isolate();
   v8::HandleScope handleScope(isolate);
 
-  std::vector<std::shared_ptr<StackFrame>> frames;
+  v8::Local<v8::StackTrace> v8StackTrace;
+  std::vector<int> frameIds;
   if (isolate->InContext()) {
-    v8::Local<v8::StackTrace> v8StackTrace = v8::StackTrace::CurrentStackTrace(
-        isolate, maxStackSize, stackTraceOptions);
-    frames = toFramesVector(debugger, v8StackTrace, maxStackSize);
+    v8StackTrace = v8::StackTrace::CurrentStackTrace(isolate, maxStackSize,
+                                                     stackTraceOptions);
+    frameIds = toFrameIdsVector(v8StackTrace, maxStackSize);
   }
 
   std::shared_ptr<AsyncStackTrace> asyncParent;
@@ -311,13 +335,13 @@ std::shared_ptr<AsyncStackTrace> AsyncStackTrace::capture(
   calculateAsyncChain(debugger, contextGroupId, &asyncParent, &asyncCreation,
                       nullptr);
 
-  if (frames.empty() && !asyncCreation && !asyncParent) return nullptr;
+  if (frameIds.empty() && !asyncCreation && !asyncParent) return nullptr;
 
   // When async call chain is empty but doesn't contain useful schedule stack
   // and parent async call chain contains creationg stack but doesn't
   // synchronous we can merge them together.
   // e.g. Promise ThenableJob.
-  if (asyncParent && frames.empty() &&
+  if (asyncParent && frameIds.empty() &&
       asyncParent->m_description == description && !asyncCreation) {
     return asyncParent;
   }
@@ -326,24 +350,57 @@ std::shared_ptr<AsyncStackTrace> AsyncStackTrace::capture(
   if (!contextGroupId && asyncParent) {
     contextGroupId = asyncParent->m_contextGroupId;
   }
-  return std::shared_ptr<AsyncStackTrace>(
-      new AsyncStackTrace(contextGroupId, description, std::move(frames),
-                          asyncParent, asyncCreation));
+
+  // Tasks are usually scheduled from a few places with the same parent
+  // chain, so the very same stack has often been captured recently.
+  size_t hash = 0;
+  if (reuseRecent) {
+    hash = asyncStackHash(contextGroupId, description, frameIds, asyncParent,
+                          asyncCreation);
+    std::shared_ptr<AsyncStackTrace> recent =
+        debugger->recentAsyncStack(hash);
+    if (recent && recent->isSimilar(contextGroupId, description, frameIds,
+                                    asyncParent, asyncCreation)) {
+      return recent;
+    }
+  }
+
+  std::vector<std::shared_ptr<StackFrame>> frames;
+  if (!frameIds.empty()) {
+    frames = toFramesVector(debugger, v8StackTrace, maxStackSize);
+  }
+  std::shared_ptr<AsyncStackTrace> asyncStack(new AsyncStackTrace(
+      contextGroupId, description, std::move(frameIds), std::move(frames),
+      asyncParent, asyncCreation));
+  if (reuseRecent) debugger->setRecentAsyncStack(hash, asyncStack);
+  return asyncStack;
 }
 
 AsyncStackTrace::AsyncStackTrace(
-    int contextGroupId, const String16& description,
+    int contextGroupId, const String16& description, std::vector<int> frameIds,
     std::vector<std::shared_ptr<StackFrame>> frames,
     std::shared_ptr<AsyncStackTrace> asyncParent,
     std::shared_ptr<AsyncStackTrace> asyncCreation)
     : m_contextGroupId(contextGroupId),
       m_description(description),
+      m_frameIds(std::move(frameIds)),
       m_frames(std::move(frames)),
       m_asyncParent(asyncParent),
       m_asyncCreation(asyncCreation) {
   DCHECK(m_contextGroupId);
 }
 
+bool AsyncStackTrace::isSimilar(
+    int contextGroupId, const String16& description,
+    const std::vector<int>& frameIds,
+    const std::shared_ptr<AsyncStackTrace>& asyncParent,
+    const std::shared_ptr<AsyncStackTrace>& asyncCreation) const {
+  return m_contextGroupId == contextGroupId &&
+         m_description == description && m_frameIds == frameIds &&
+         m_asyncParent.lock() == asyncParent &&
+         m_asyncCreation.lock() == asyncCreation;
+}
+
 std::unique_ptr<protocol::Runtime::StackTrace>
 AsyncStackTrace::buildInspectorObject(AsyncStackTrace* asyncCreation,
                                       int maxAsyncDepth) const {
@@ -105,10 +105,14 @@ class V8StackTraceImpl : public V8StackTrace {
 
 class AsyncStackTrace {
  public:
+  // When |reuseRecent| is set and a recently captured stack has the same
+  // frames, description and async chain, that stack is returned instead of
+  // symbolizing the frames again.
   static std::shared_ptr<AsyncStackTrace> capture(V8Debugger*,
                                                   int contextGroupId,
                                                   const String16& description,
-                                                  int maxStackSize);
+                                                  int maxStackSize,
+                                                  bool reuseRecent = false);
 
   std::unique_ptr<protocol::Runtime::StackTrace> buildInspectorObject(
       AsyncStackTrace* asyncCreation, int maxAsyncDepth) const;
@@ -129,13 +133,21 @@ class AsyncStackTrace {
 
  private:
   AsyncStackTrace(int contextGroupId, const String16& description,
+                  std::vector<int> frameIds,
                   std::vector<std::shared_ptr<StackFrame>> frames,
                   std::shared_ptr<AsyncStackTrace> asyncParent,
                   std::shared_ptr<AsyncStackTrace> asyncCreation);
 
+  bool isSimilar(int contextGroupId, const String16& description,
+                 const std::vector<int>& frameIds,
+                 const std::shared_ptr<AsyncStackTrace>& asyncParent,
+                 const std::shared_ptr<AsyncStackTrace>& asyncCreation) const;
+
   int m_contextGroupId;
   String16 m_description;
 
+  // Ids of the v8::StackFrames the frames were symbolized from.
+  std::vector<int> m_frameIds;
   std::vector<std::shared_ptr<StackFrame>> m_frames;
   std::weak_ptr<AsyncStackTrace> m_asyncParent;
   std::weak_ptr<AsyncStackTrace> m_asyncCreation;
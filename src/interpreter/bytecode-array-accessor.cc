@@ -197,7 +197,7 @@ int BytecodeArrayAccessor::GetJumpTargetOffset() const {
 
 JumpTableTargetOffsets BytecodeArrayAccessor::GetJumpTableTargetOffsets()
     const {
-  DCHECK_EQ(current_bytecode(), Bytecode::kSwitchOnSmiNoFeedback);
+  DCHECK(Bytecodes::IsSwitch(current_bytecode()));
 
   uint32_t table_start = GetIndexOperand(0);
   uint32_t table_size = GetUnsignedImmediateOperand(1);
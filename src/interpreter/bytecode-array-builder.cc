@@ -116,10 +116,16 @@ Handle<BytecodeArray> BytecodeArrayBuilder::ToBytecodeArray(Isolate* isolate) {
       handler_table_builder()->ToHandlerTable(isolate);
   bytecode_array->set_handler_table(*handler_table);
 
-  Handle<ByteArray> source_position_table =
-      source_position_table_builder()->ToSourcePositionTable(
-          isolate, Handle<AbstractCode>::cast(bytecode_array));
-  bytecode_array->set_source_position_table(*source_position_table);
+  if (source_position_table_builder()->Lazy()) {
+    // The table is collected by Compiler::CollectSourcePositions on demand.
+    bytecode_array->set_source_position_table(
+        isolate->heap()->undefined_value());
+  } else {
+    Handle<ByteArray> source_position_table =
+        source_position_table_builder()->ToSourcePositionTable(
+            isolate, Handle<AbstractCode>::cast(bytecode_array));
+    bytecode_array->set_source_position_table(*source_position_table);
+  }
 
   return bytecode_array;
 }
@@ -802,6 +808,11 @@ void BytecodeArrayBuilder::OutputSwitchOnSmiNoFeedback(
                               jump_table->case_value_base());
 }
 
+void BytecodeArrayBuilder::OutputSwitchOnSmi(BytecodeJumpTable* jump_table) {
+  OutputSwitchOnSmi(jump_table, jump_table->constant_pool_index(),
+                    jump_table->size(), jump_table->case_value_base());
+}
+
 BytecodeArrayBuilder& BytecodeArrayBuilder::BinaryOperation(Token::Value op,
                                                             Register reg,
                                                             int feedback_slot) {
@@ -940,6 +951,12 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::CompareOperation(
     case Token::Value::GTE:
       OutputTestGreaterThanOrEqual(reg, feedback_slot);
       break;
+    case Token::Value::INSTANCEOF:
+      OutputTestInstanceOf(reg, feedback_slot);
+      break;
+    case Token::Value::IN:
+      OutputTestIn(reg, feedback_slot);
+      break;
     default:
       UNREACHABLE();
   }
@@ -952,12 +969,6 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::CompareOperation(Token::Value op,
     case Token::Value::EQ_STRICT:
       OutputTestEqualStrictNoFeedback(reg);
       break;
-    case Token::Value::INSTANCEOF:
-      OutputTestInstanceOf(reg);
-      break;
-    case Token::Value::IN:
-      OutputTestIn(reg);
-      break;
     default:
       UNREACHABLE();
   }
@@ -1638,6 +1649,12 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::SwitchOnSmiNoFeedback(
   return *this;
 }
 
+BytecodeArrayBuilder& BytecodeArrayBuilder::SwitchOnSmi(
+    BytecodeJumpTable* jump_table) {
+  OutputSwitchOnSmi(jump_table);
+  return *this;
+}
+
 BytecodeArrayBuilder& BytecodeArrayBuilder::StackCheck(int position) {
   if (position != kNoSourcePosition) {
     // We need to attach a non-breakable source position to a stack
@@ -378,6 +378,9 @@ class V8_EXPORT_PRIVATE BytecodeArrayBuilder final
                                      NilValue nil);
 
   BytecodeArrayBuilder& SwitchOnSmiNoFeedback(BytecodeJumpTable* jump_table);
+  // Like SwitchOnSmiNoFeedback, but falls through if the accumulator does not
+  // hold a Smi.
+  BytecodeArrayBuilder& SwitchOnSmi(BytecodeJumpTable* jump_table);
 
   BytecodeArrayBuilder& StackCheck(int position);
 
@@ -464,6 +467,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayBuilder final
   }
 
   bool RequiresImplicitReturn() const { return !exit_seen_in_block_; }
+  bool RemainderOfBlockIsDead() const { return exit_seen_in_block_; }
 
   // Returns the raw operand value for the given register or register list.
   uint32_t GetInputRegisterOperand(Register reg);
@@ -548,6 +552,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayBuilder final
 #undef DECLARE_OPERAND_TYPE_INFO
 
   INLINE(void OutputSwitchOnSmiNoFeedback(BytecodeJumpTable* jump_table));
+  INLINE(void OutputSwitchOnSmi(BytecodeJumpTable* jump_table));
 
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
   void InvalidateLastBytecode();
@@ -16,17 +16,21 @@ namespace interpreter {
 
 // static
 uint8_t CreateArrayLiteralFlags::Encode(bool use_fast_shallow_clone,
+                                        bool use_fast_deep_clone,
                                         int runtime_flags) {
   uint8_t result = FlagsBits::encode(runtime_flags);
   result |= FastShallowCloneBit::encode(use_fast_shallow_clone);
+  result |= FastDeepCloneBit::encode(use_fast_deep_clone);
   return result;
 }
 
 // static
 uint8_t CreateObjectLiteralFlags::Encode(int runtime_flags,
-                                         bool fast_clone_supported) {
+                                         bool fast_clone_supported,
+                                         bool fast_deep_clone_supported) {
   uint8_t result = FlagsBits::encode(runtime_flags);
   result |= FastCloneSupportedBit::encode(fast_clone_supported);
+  result |= FastDeepCloneSupportedBit::encode(fast_deep_clone_supported);
   return result;
 }
 
@@ -20,8 +20,11 @@ class CreateArrayLiteralFlags {
  public:
   class FlagsBits : public BitField8<int, 0, 4> {};
   class FastShallowCloneBit : public BitField8<bool, FlagsBits::kNext, 1> {};
+  class FastDeepCloneBit
+      : public BitField8<bool, FastShallowCloneBit::kNext, 1> {};
 
-  static uint8_t Encode(bool use_fast_shallow_clone, int runtime_flags);
+  static uint8_t Encode(bool use_fast_shallow_clone, bool use_fast_deep_clone,
+                        int runtime_flags);
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CreateArrayLiteralFlags);
@@ -31,8 +34,11 @@ class CreateObjectLiteralFlags {
  public:
   class FlagsBits : public BitField8<int, 0, 4> {};
   class FastCloneSupportedBit : public BitField8<bool, FlagsBits::kNext, 1> {};
+  class FastDeepCloneSupportedBit
+      : public BitField8<bool, FastCloneSupportedBit::kNext, 1> {};
 
-  static uint8_t Encode(int runtime_flags, bool fast_clone_supported);
+  static uint8_t Encode(int runtime_flags, bool fast_clone_supported,
+                        bool fast_deep_clone_supported);
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CreateObjectLiteralFlags);
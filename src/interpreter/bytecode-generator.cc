@@ -780,7 +780,9 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
       builder_(new (zone()) BytecodeArrayBuilder(
           info->isolate(), info->zone(), info->num_parameters_including_this(),
           info->scope()->num_stack_slots(), info->literal(),
-          info->SourcePositionRecordingMode())),
+          info->HasLazySourcePositions()
+              ? SourcePositionTableBuilder::LAZY_SOURCE_POSITIONS
+              : info->SourcePositionRecordingMode())),
       info_(info),
       ast_string_constants_(info->isolate()->ast_string_constants()),
       closure_scope_(info->scope()),
@@ -792,6 +794,7 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
       native_function_literals_(0, info->zone()),
       object_literals_(0, info->zone()),
       array_literals_(0, info->zone()),
+      class_literals_(0, info->zone()),
       execution_control_(nullptr),
       execution_context_(nullptr),
       execution_result_(nullptr),
@@ -872,6 +875,13 @@ void BytecodeGenerator::AllocateDeferredConstants(Isolate* isolate) {
         array_literal->GetOrBuildConstantElements(isolate);
     builder()->SetDeferredConstantPoolEntry(literal.second, constant_elements);
   }
+
+  // Build class literal boilerplates
+  for (std::pair<ClassLiteral*, size_t> literal : class_literals_) {
+    Handle<ClassBoilerplate> boilerplate =
+        literal.first->BuildClassBoilerplate(isolate);
+    builder()->SetDeferredConstantPoolEntry(literal.second, boilerplate);
+  }
 }
 
 void BytecodeGenerator::GenerateBytecode(uintptr_t stack_limit) {
@@ -1309,6 +1319,49 @@ void BytecodeGenerator::VisitWithStatement(WithStatement* stmt) {
   VisitInScope(stmt->statement(), stmt->scope());
 }
 
+namespace {
+
+// Switch statements need at least this many cases to use a jump table.
+const int kMinCasesForJumpTable = 6;
+// The jump table may have at most this many entries per case.
+const int kMaxJumpTableEntriesPerCase = 3;
+
+// Returns true if the non-default {clauses} are distinct Smi literals that are
+// dense enough to dispatch through a jump table. If so, {min_case} is set to
+// the smallest and {max_case} to the largest case value.
+bool IsSwitchWithJumpTable(ZoneList<CaseClause*>* clauses, Zone* zone,
+                           int* min_case, int* max_case) {
+  int num_cases = 0;
+  *min_case = Smi::kMaxValue;
+  *max_case = Smi::kMinValue;
+  for (int i = 0; i < clauses->length(); i++) {
+    CaseClause* clause = clauses->at(i);
+    if (clause->is_default()) continue;
+    if (!clause->label()->IsSmiLiteral()) return false;
+    int value = clause->label()->AsLiteral()->AsSmiLiteral()->value();
+    *min_case = std::min(*min_case, value);
+    *max_case = std::max(*max_case, value);
+    num_cases++;
+  }
+  if (num_cases < kMinCasesForJumpTable) return false;
+  int64_t table_size = static_cast<int64_t>(*max_case) - *min_case + 1;
+  if (table_size > num_cases * kMaxJumpTableEntriesPerCase) return false;
+
+  // Only the first of several equal cases can be reached, which the table
+  // cannot express, so leave those switches to the comparisons.
+  ZoneVector<bool> seen(static_cast<size_t>(table_size), false, zone);
+  for (int i = 0; i < clauses->length(); i++) {
+    CaseClause* clause = clauses->at(i);
+    if (clause->is_default()) continue;
+    int value = clause->label()->AsLiteral()->AsSmiLiteral()->value();
+    if (seen[value - *min_case]) return false;
+    seen[value - *min_case] = true;
+  }
+  return true;
+}
+
+}  // namespace
+
 void BytecodeGenerator::VisitSwitchStatement(SwitchStatement* stmt) {
   // We need this scope because we visit for register values. We have to
   // maintain a execution result scope where registers can be allocated.
@@ -1322,6 +1375,26 @@ void BytecodeGenerator::VisitSwitchStatement(SwitchStatement* stmt) {
   // Keep the switch value in a register until a case matches.
   Register tag = VisitForRegisterValue(stmt->tag());
 
+  // Dense switches on Smi literals dispatch Smi values through a jump table.
+  // Any other value falls through to the comparisons below, since e.g. a heap
+  // number can still be equal to one of the cases.
+  BytecodeJumpTable* jump_table = nullptr;
+  int min_case = 0, max_case = 0;
+  ZoneVector<bool> table_entry_is_case(zone());
+  if (!builder()->RemainderOfBlockIsDead() &&
+      IsSwitchWithJumpTable(clauses, zone(), &min_case, &max_case)) {
+    jump_table =
+        builder()->AllocateJumpTable(max_case - min_case + 1, min_case);
+    table_entry_is_case.resize(max_case - min_case + 1, false);
+    for (int i = 0; i < clauses->length(); i++) {
+      CaseClause* clause = clauses->at(i);
+      if (clause->is_default()) continue;
+      int value = clause->label()->AsLiteral()->AsSmiLiteral()->value();
+      table_entry_is_case[value - min_case] = true;
+    }
+    builder()->LoadAccumulatorWithRegister(tag).SwitchOnSmi(jump_table);
+  }
+
   // Iterate over all cases and create nodes for label comparison.
   for (int i = 0; i < clauses->length(); i++) {
     CaseClause* clause = clauses->at(i);
@@ -1349,13 +1422,33 @@ void BytecodeGenerator::VisitSwitchStatement(SwitchStatement* stmt) {
     switch_builder.Break();
   }
 
-  // Iterate over all cases and create the case bodies.
+  // Iterate over all cases and create the case bodies. Table entries without
+  // a case lead to the default case, or out of the switch if there is none.
   for (int i = 0; i < clauses->length(); i++) {
     CaseClause* clause = clauses->at(i);
     switch_builder.SetCaseTarget(i);
+    if (jump_table != nullptr) {
+      if (clause->is_default()) {
+        BindJumpTableHoles(jump_table, table_entry_is_case);
+      } else {
+        builder()->Bind(jump_table,
+                        clause->label()->AsLiteral()->AsSmiLiteral()->value());
+      }
+    }
     VisitStatements(clause->statements());
   }
   switch_builder.BindBreakTarget();
+  if (jump_table != nullptr && default_index < 0) {
+    BindJumpTableHoles(jump_table, table_entry_is_case);
+  }
+}
+
+void BytecodeGenerator::BindJumpTableHoles(
+    BytecodeJumpTable* jump_table, const ZoneVector<bool>& entry_is_case) {
+  for (int i = 0; i < jump_table->size(); i++) {
+    if (entry_is_case[i]) continue;
+    builder()->Bind(jump_table, jump_table->case_value_base() + i);
+  }
 }
 
 void BytecodeGenerator::VisitCaseClause(CaseClause* clause) {
@@ -1686,32 +1779,70 @@ void BytecodeGenerator::VisitFunctionLiteral(FunctionLiteral* expr) {
   function_literals_.push_back(std::make_pair(expr, entry));
 }
 
+void BytecodeGenerator::BuildClassLiteralFromBoilerplate(ClassLiteral* expr,
+                                                         Register constructor) {
+  // The prototype and the static properties are installed by the runtime in
+  // one go, using the boilerplate for the layout and the closures passed
+  // after it for the values.
+  RegisterAllocationScope register_scope(this);
+  int property_count = expr->properties()->length();
+  RegisterList args = register_allocator()->NewRegisterList(5 + property_count);
+  VisitForAccumulatorValueOrTheHole(expr->extends());
+  size_t entry = builder()->AllocateDeferredConstantPoolEntry();
+  builder()
+      ->StoreAccumulatorInRegister(args[0])
+      .MoveRegister(constructor, args[1])
+      .LoadLiteral(Smi::FromInt(expr->start_position()))
+      .StoreAccumulatorInRegister(args[2])
+      .LoadLiteral(Smi::FromInt(expr->end_position()))
+      .StoreAccumulatorInRegister(args[3])
+      .LoadConstantPoolEntry(entry)
+      .StoreAccumulatorInRegister(args[4]);
+  class_literals_.push_back(std::make_pair(expr, entry));
+
+  for (int i = 0; i < property_count; i++) {
+    VisitForRegisterValue(expr->properties()->at(i)->value(), args[5 + i]);
+  }
+  builder()->CallRuntime(Runtime::kDefineClassWithBoilerplate, args);
+}
+
 void BytecodeGenerator::BuildClassLiteral(ClassLiteral* expr) {
   VisitDeclarations(expr->scope()->declarations());
   Register constructor = VisitForRegisterValue(expr->constructor());
-  {
-    RegisterAllocationScope register_scope(this);
-    RegisterList args = register_allocator()->NewRegisterList(4);
-    VisitForAccumulatorValueOrTheHole(expr->extends());
-    builder()
-        ->StoreAccumulatorInRegister(args[0])
-        .MoveRegister(constructor, args[1])
-        .LoadLiteral(Smi::FromInt(expr->start_position()))
-        .StoreAccumulatorInRegister(args[2])
-        .LoadLiteral(Smi::FromInt(expr->end_position()))
-        .StoreAccumulatorInRegister(args[3])
-        .CallRuntime(Runtime::kDefineClass, args);
-  }
-  Register prototype = register_allocator()->NewRegister();
-  builder()->StoreAccumulatorInRegister(prototype);
+  if (expr->IsBoilerplateSupported()) {
+    BuildClassLiteralFromBoilerplate(expr, constructor);
+    if (FunctionLiteral::NeedsHomeObject(expr->constructor())) {
+      // Prototype is already in the accumulator.
+      builder()->StoreHomeObjectProperty(
+          constructor, feedback_index(expr->HomeObjectSlot()),
+          language_mode());
+    }
+  } else {
+    {
+      RegisterAllocationScope register_scope(this);
+      RegisterList args = register_allocator()->NewRegisterList(4);
+      VisitForAccumulatorValueOrTheHole(expr->extends());
+      builder()
+          ->StoreAccumulatorInRegister(args[0])
+          .MoveRegister(constructor, args[1])
+          .LoadLiteral(Smi::FromInt(expr->start_position()))
+          .StoreAccumulatorInRegister(args[2])
+          .LoadLiteral(Smi::FromInt(expr->end_position()))
+          .StoreAccumulatorInRegister(args[3])
+          .CallRuntime(Runtime::kDefineClass, args);
+    }
+    Register prototype = register_allocator()->NewRegister();
+    builder()->StoreAccumulatorInRegister(prototype);
+
+    if (FunctionLiteral::NeedsHomeObject(expr->constructor())) {
+      // Prototype is already in the accumulator.
+      builder()->StoreHomeObjectProperty(
+          constructor, feedback_index(expr->HomeObjectSlot()),
+          language_mode());
+    }
 
-  if (FunctionLiteral::NeedsHomeObject(expr->constructor())) {
-    // Prototype is already in the accumulator.
-    builder()->StoreHomeObjectProperty(
-        constructor, feedback_index(expr->HomeObjectSlot()), language_mode());
+    VisitClassLiteralProperties(expr, constructor, prototype);
   }
-
-  VisitClassLiteralProperties(expr, constructor, prototype);
   BuildClassLiteralNameProperty(expr, constructor);
   builder()->CallRuntime(Runtime::kToFastProperties, constructor);
   // Assign to class variable.
@@ -1884,7 +2015,8 @@ void BytecodeGenerator::VisitRegExpLiteral(RegExpLiteral* expr) {
 void BytecodeGenerator::VisitObjectLiteral(ObjectLiteral* expr) {
   // Deep-copy the literal boilerplate.
   uint8_t flags = CreateObjectLiteralFlags::Encode(
-      expr->ComputeFlags(), expr->IsFastCloningSupported());
+      expr->ComputeFlags(), expr->IsFastCloningSupported(),
+      expr->IsFastDeepCloningSupported());
 
   Register literal = register_allocator()->NewRegister();
   size_t entry;
@@ -2082,7 +2214,8 @@ void BytecodeGenerator::VisitObjectLiteral(ObjectLiteral* expr) {
 void BytecodeGenerator::VisitArrayLiteral(ArrayLiteral* expr) {
   // Deep-copy the literal boilerplate.
   uint8_t flags = CreateArrayLiteralFlags::Encode(
-      expr->IsFastCloningSupported(), expr->ComputeFlags());
+      expr->IsFastCloningSupported(), expr->IsFastDeepCloningSupported(),
+      expr->ComputeFlags());
 
   size_t entry = builder()->AllocateDeferredConstantPoolEntry();
   builder()->CreateArrayLiteral(entry, feedback_index(expr->literal_slot()),
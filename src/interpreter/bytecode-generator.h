@@ -129,6 +129,10 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
   // start_index <= value < start_index + size.
   void BuildIndexedJump(Register value, size_t start_index, size_t size,
                         ZoneVector<BytecodeLabel>& targets);
+  // Binds the entries of the switch {jump_table} that don't belong to a case
+  // to the current position.
+  void BindJumpTableHoles(BytecodeJumpTable* jump_table,
+                          const ZoneVector<bool>& entry_is_case);
 
   void BuildNewLocalActivationContext();
   void BuildLocalActivationContextInitialization();
@@ -152,6 +156,8 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
   void VisitClassLiteralProperties(ClassLiteral* expr, Register constructor,
                                    Register prototype);
   void BuildClassLiteralNameProperty(ClassLiteral* expr, Register constructor);
+  void BuildClassLiteralFromBoilerplate(ClassLiteral* expr,
+                                        Register constructor);
   void BuildClassLiteral(ClassLiteral* expr);
   void VisitThisFunctionVariable(Variable* variable);
   void VisitNewTargetVariable(Variable* variable);
@@ -273,6 +279,7 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
       native_function_literals_;
   ZoneVector<std::pair<ObjectLiteral*, size_t>> object_literals_;
   ZoneVector<std::pair<ArrayLiteral*, size_t>> array_literals_;
+  ZoneVector<std::pair<ClassLiteral*, size_t>> class_literals_;
 
   ControlScope* execution_control_;
   ContextScope* execution_context_;
@@ -212,8 +212,9 @@ namespace interpreter {
   V(TestGreaterThanOrEqual, AccumulatorUse::kReadWrite, OperandType::kReg,     \
     OperandType::kIdx)                                                         \
   V(TestEqualStrictNoFeedback, AccumulatorUse::kReadWrite, OperandType::kReg)  \
-  V(TestInstanceOf, AccumulatorUse::kReadWrite, OperandType::kReg)             \
-  V(TestIn, AccumulatorUse::kReadWrite, OperandType::kReg)                     \
+  V(TestInstanceOf, AccumulatorUse::kReadWrite, OperandType::kReg,             \
+    OperandType::kIdx)                                                         \
+  V(TestIn, AccumulatorUse::kReadWrite, OperandType::kReg, OperandType::kIdx)  \
   V(TestUndetectable, AccumulatorUse::kReadWrite)                              \
   V(TestNull, AccumulatorUse::kReadWrite)                                      \
   V(TestUndefined, AccumulatorUse::kReadWrite)                                 \
@@ -291,6 +292,8 @@ namespace interpreter {
   /* Smi-table lookup for switch statements */                                 \
   V(SwitchOnSmiNoFeedback, AccumulatorUse::kRead, OperandType::kIdx,           \
     OperandType::kUImm, OperandType::kImm)                                     \
+  V(SwitchOnSmi, AccumulatorUse::kRead, OperandType::kIdx, OperandType::kUImm, \
+    OperandType::kImm)                                                         \
                                                                                \
   /* Complex flow control For..in */                                           \
   V(ForInPrepare, AccumulatorUse::kNone, OperandType::kReg,                    \
@@ -657,7 +660,8 @@ class V8_EXPORT_PRIVATE Bytecodes final {
 
   // Returns true if the bytecode is a switch.
   static constexpr bool IsSwitch(Bytecode bytecode) {
-    return bytecode == Bytecode::kSwitchOnSmiNoFeedback;
+    return bytecode == Bytecode::kSwitchOnSmiNoFeedback ||
+           bytecode == Bytecode::kSwitchOnSmi;
   }
 
   // Returns true if |bytecode| has no effects. These bytecodes only manipulate
@@ -849,6 +853,11 @@ class V8_EXPORT_PRIVATE Bytecodes final {
   // dispatch to a Star bytecode.
   static bool IsStarLookahead(Bytecode bytecode, OperandScale operand_scale);
 
+  // Returns true if the handler for |bytecode| should look ahead and inline a
+  // dispatch to a JumpIfTrue or JumpIfFalse bytecode.
+  static bool IsConditionalJumpLookahead(Bytecode bytecode,
+                                         OperandScale operand_scale);
+
   // Returns the number of registers represented by a register operand. For
   // instance, a RegPair represents two registers. Should not be called for
   // kRegList which has a variable number of registers based on the following
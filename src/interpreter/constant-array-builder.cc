@@ -99,6 +99,7 @@ ConstantArrayBuilder::ConstantArrayBuilder(Zone* zone)
                      ZoneAllocationPolicy(zone)),
       smi_map_(zone),
       smi_pairs_(zone),
+      heap_number_map_(zone),
 #define INIT_SINGLETON_ENTRY_FIELD(NAME, LOWER_NAME) LOWER_NAME##_(-1),
       SINGLETON_CONSTANT_ENTRY_TYPES(INIT_SINGLETON_ENTRY_FIELD)
 #undef INIT_SINGLETON_ENTRY_FIELD
@@ -197,6 +198,14 @@ size_t ConstantArrayBuilder::Insert(const AstValue* heap_number) {
   // pool entirely and use bytecodes with immediate values (Smis, booleans,
   // undefined, etc.).
   DCHECK(heap_number->IsHeapNumber());
+  if (FLAG_ignition_deduplicate_heap_numbers) {
+    uint64_t bits = bit_cast<uint64_t>(heap_number->AsNumber());
+    auto entry = heap_number_map_.find(bits);
+    if (entry != heap_number_map_.end()) return entry->second;
+    index_t index = AllocateIndex(Entry(heap_number));
+    heap_number_map_.emplace(bits, index);
+    return index;
+  }
   return constants_map_
       .LookupOrInsert(reinterpret_cast<intptr_t>(heap_number),
                       static_cast<uint32_t>(base::hash_value(heap_number)),
@@ -585,7 +585,10 @@ Node* InterpreterAssembler::CallJSWithFeedback(
 
   Variable return_value(this, MachineRepresentation::kTagged);
   Label call_function(this), extra_checks(this, Label::kDeferred), call(this),
-      end(this);
+      call_without_feedback(this), check_bound_function(this), end(this);
+
+  // Functions that run without a feedback vector call without feedback.
+  GotoIf(IsUndefined(feedback_vector), &call_without_feedback);
 
   // The checks. First, does function match the recorded monomorphic target?
   Node* feedback_element = LoadFixedArrayElement(feedback_vector, slot_id);
@@ -596,7 +599,15 @@ Node* InterpreterAssembler::CallJSWithFeedback(
   // The compare above could have been a SMI/SMI comparison. Guard against
   // this convincing us that we have a monomorphic JSFunction.
   Node* is_smi = TaggedIsSmi(function);
-  Branch(is_smi, &extra_checks, &call_function);
+  Branch(is_smi, &extra_checks, &check_bound_function);
+
+  BIND(&check_bound_function);
+  {
+    // The monomorphic target may also be a JSBoundFunction, which has to go
+    // through the generic Call builtin.
+    Node* is_js_function = IsJSFunction(function);
+    Branch(is_js_function, &call_function, &call);
+  }
 
   BIND(&call_function);
   {
@@ -617,7 +628,7 @@ Node* InterpreterAssembler::CallJSWithFeedback(
   BIND(&extra_checks);
   {
     Label check_initialized(this), mark_megamorphic(this),
-        create_allocation_site(this);
+        create_allocation_site(this), create_bound_function_weak_cell(this);
 
     Comment("check if megamorphic");
     // Check if it is a megamorphic target.
@@ -671,8 +682,13 @@ Node* InterpreterAssembler::CallJSWithFeedback(
       Node* is_smi = TaggedIsSmi(function);
       GotoIf(is_smi, &mark_megamorphic);
 
-      // Check if function is an object of JSFunction type.
+      // Remember JSBoundFunction targets as well, so that TurboFan can
+      // inline calls through them.
       Node* instance_type = LoadInstanceType(function);
+      GotoIf(Word32Equal(instance_type, Int32Constant(JS_BOUND_FUNCTION_TYPE)),
+             &create_bound_function_weak_cell);
+
+      // Check if function is an object of JSFunction type.
       Node* is_js_function =
           Word32Equal(instance_type, Int32Constant(JS_FUNCTION_TYPE));
       GotoIfNot(is_js_function, &mark_megamorphic);
@@ -697,6 +713,15 @@ Node* InterpreterAssembler::CallJSWithFeedback(
       Goto(&call_function);
     }
 
+    BIND(&create_bound_function_weak_cell);
+    {
+      CreateWeakCellInFeedbackVector(feedback_vector, SmiTag(slot_id),
+                                     function);
+
+      // Call using call builtin.
+      Goto(&call);
+    }
+
     BIND(&create_allocation_site);
     {
       CreateAllocationSiteInFeedbackVector(feedback_vector, SmiTag(slot_id));
@@ -738,6 +763,13 @@ Node* InterpreterAssembler::CallJSWithFeedback(
     Goto(&end);
   }
 
+  BIND(&call_without_feedback);
+  {
+    return_value.Bind(CallJS(function, context, first_arg, arg_count,
+                             receiver_mode, tail_call_mode));
+    Goto(&end);
+  }
+
   BIND(&end);
   return return_value.value();
 }
@@ -786,6 +818,7 @@ Node* InterpreterAssembler::Construct(Node* constructor, Node* context,
   STATIC_ASSERT(FeedbackVector::kReservedIndexCount > 0);
   Node* is_feedback_unavailable = WordEqual(slot_id, IntPtrConstant(0));
   GotoIf(is_feedback_unavailable, &call_construct);
+  GotoIf(IsUndefined(feedback_vector), &call_construct);
 
   // Check that the constructor is not a smi.
   Node* is_smi = TaggedIsSmi(constructor);
@@ -924,6 +957,63 @@ Node* InterpreterAssembler::Construct(Node* constructor, Node* context,
   return return_value.value();
 }
 
+void InterpreterAssembler::CollectWeakCellFeedback(Node* value,
+                                                   Node* feedback_vector,
+                                                   Node* slot_id) {
+  Label done(this), extra_checks(this, Label::kDeferred), initialize(this),
+      mark_megamorphic(this);
+  GotoIf(IsUndefined(feedback_vector), &done);
+
+  // Check if the slot is monomorphic for {value}.
+  Node* feedback_element = LoadFixedArrayElement(feedback_vector, slot_id);
+  Node* feedback_value = LoadWeakCellValueUnchecked(feedback_element);
+  Branch(WordEqual(value, feedback_value), &done, &extra_checks);
+
+  BIND(&extra_checks);
+  {
+    Comment("check if megamorphic");
+    GotoIf(WordEqual(feedback_element,
+                     HeapConstant(FeedbackVector::MegamorphicSentinel(
+                         isolate()))),
+           &done);
+    GotoIf(TaggedIsSmi(value), &mark_megamorphic);
+
+    Comment("check if uninitialized");
+    GotoIf(WordEqual(feedback_element,
+                     LoadRoot(Heap::kuninitialized_symbolRootIndex)),
+           &initialize);
+
+    // If the weak cell is cleared, we have a new chance to become
+    // monomorphic.
+    Comment("check if weak cell is cleared");
+    GotoIfNot(WordEqual(LoadMap(feedback_element),
+                        LoadRoot(Heap::kWeakCellMapRootIndex)),
+              &mark_megamorphic);
+    Branch(TaggedIsSmi(feedback_value), &initialize, &mark_megamorphic);
+  }
+
+  BIND(&initialize);
+  {
+    CreateWeakCellInFeedbackVector(feedback_vector, SmiTag(slot_id), value);
+    Goto(&done);
+  }
+
+  BIND(&mark_megamorphic);
+  {
+    // MegamorphicSentinel is an immortal immovable object so
+    // write-barrier is not needed.
+    Comment("transition to megamorphic");
+    DCHECK(Heap::RootIsImmortalImmovable(Heap::kmegamorphic_symbolRootIndex));
+    StoreFixedArrayElement(
+        feedback_vector, slot_id,
+        HeapConstant(FeedbackVector::MegamorphicSentinel(isolate())),
+        SKIP_WRITE_BARRIER);
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
 Node* InterpreterAssembler::ConstructWithSpread(Node* constructor,
                                                 Node* context, Node* new_target,
                                                 Node* first_arg,
@@ -1101,6 +1191,77 @@ void InterpreterAssembler::InlineStar() {
   accumulator_use_ = previous_acc_use;
 }
 
+Node* InterpreterAssembler::ConditionalJumpDispatchLookahead(
+    Node* target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  Variable var_bytecode(this, MachineType::PointerRepresentation());
+  var_bytecode.Bind(target_bytecode);
+
+  Node* jump_if_true_bytecode =
+      IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue));
+  Node* jump_if_false_bytecode =
+      IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse));
+  GotoIf(WordEqual(target_bytecode, jump_if_true_bytecode),
+         &do_inline_jump_if_true);
+  Branch(WordEqual(target_bytecode, jump_if_false_bytecode),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  {
+    var_bytecode.Bind(InlineConditionalJump(Bytecode::kJumpIfTrue));
+    Goto(&done);
+  }
+  BIND(&do_inline_jump_if_false);
+  {
+    var_bytecode.Bind(InlineConditionalJump(Bytecode::kJumpIfFalse));
+    Goto(&done);
+  }
+  BIND(&done);
+  return var_bytecode.value();
+}
+
+Node* InterpreterAssembler::InlineConditionalJump(Bytecode jump_bytecode) {
+  DCHECK(jump_bytecode == Bytecode::kJumpIfTrue ||
+         jump_bytecode == Bytecode::kJumpIfFalse);
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  bytecode_ = jump_bytecode;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+#ifdef V8_TRACE_IGNITION
+  TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+#endif
+  Node* accumulator = GetAccumulator();
+  Node* relative_jump = BytecodeOperandUImmWord(0);
+  Node* expected_value =
+      BooleanConstant(jump_bytecode == Bytecode::kJumpIfTrue);
+  CSA_ASSERT(this, TaggedIsNotSmi(accumulator));
+  CSA_ASSERT(this, IsBoolean(accumulator));
+
+  Label jump(this), no_jump(this), done(this);
+  Branch(WordEqual(accumulator, expected_value), &jump, &no_jump);
+  BIND(&jump);
+  {
+    UpdateInterruptBudget(TruncateWordToWord32(relative_jump), false);
+    Advance(relative_jump, false);
+    Goto(&done);
+  }
+  BIND(&no_jump);
+  {
+    Advance();
+    Goto(&done);
+  }
+  BIND(&done);
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+  return LoadBytecode(BytecodeOffset());
+}
+
 Node* InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1109,6 +1270,9 @@ Node* InterpreterAssembler::Dispatch() {
 
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     target_bytecode = StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsConditionalJumpLookahead(bytecode_,
+                                                   operand_scale_)) {
+    target_bytecode = ConditionalJumpDispatchLookahead(target_bytecode);
   }
   return DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
@@ -117,6 +117,13 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   compiler::Node* IncrementCallCount(compiler::Node* feedback_vector,
                                      compiler::Node* slot_id);
 
+  // Collect feedback about the heap object |value| in the slot at index
+  // |slot_id|. The slot holds a WeakCell of the first |value| seen, and goes
+  // megamorphic once a different value (or a Smi) is seen.
+  void CollectWeakCellFeedback(compiler::Node* value,
+                               compiler::Node* feedback_vector,
+                               compiler::Node* slot_id);
+
   // Call JSFunction or Callable |function| with |arg_count| arguments (not
   // including receiver) and the first argument located at |first_arg|. Type
   // feedback is collected in the slot at index |slot_id|.
@@ -328,6 +335,16 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // next dispatch offset.
   void InlineStar();
 
+  // Look ahead for JumpIfTrue or JumpIfFalse and inline it in a branch.
+  // Returns a new target bytecode node for dispatch.
+  compiler::Node* ConditionalJumpDispatchLookahead(
+      compiler::Node* target_bytecode);
+
+  // Build code for the conditional |jump_bytecode| at the current
+  // BytecodeOffset(), which either jumps or Advance()s to the next dispatch
+  // offset. Returns the bytecode at the new offset.
+  compiler::Node* InlineConditionalJump(Bytecode jump_bytecode);
+
   // Dispatch to |target_bytecode| at |new_bytecode_offset|.
   // |target_bytecode| should be equivalent to loading from the offset.
   compiler::Node* DispatchToBytecode(compiler::Node* target_bytecode,
@@ -169,7 +169,12 @@ class InterpreterLoadGlobalAssembler : public InterpreterAssembler {
 
     AccessorAssembler accessor_asm(state());
 
-    Label try_handler(this, Label::kDeferred), miss(this, Label::kDeferred);
+    Label try_handler(this, Label::kDeferred), miss(this, Label::kDeferred),
+        no_feedback(this, Label::kDeferred);
+
+    // Functions that run without a feedback vector look the global up in the
+    // runtime.
+    GotoIf(IsUndefined(feedback_vector), &no_feedback);
 
     // Fast path without frame construction for the data case.
     {
@@ -223,6 +228,18 @@ class InterpreterLoadGlobalAssembler : public InterpreterAssembler {
         Dispatch();
       }
     }
+
+    BIND(&no_feedback);
+    {
+      Node* context = GetContext();
+      Node* name_index = BytecodeOperandIdx(name_operand_index);
+      Node* name = LoadConstantPoolEntry(name_index);
+      Runtime::FunctionId function_id =
+          typeof_mode == INSIDE_TYPEOF ? Runtime::kLoadLookupSlotInsideTypeof
+                                       : Runtime::kLoadLookupSlot;
+      SetAccumulator(CallRuntime(function_id, context, name));
+      Dispatch();
+    }
   }
 };
 
@@ -254,7 +271,7 @@ class InterpreterStoreGlobalAssembler : public InterpreterAssembler {
                                   OperandScale operand_scale)
       : InterpreterAssembler(state, bytecode, operand_scale) {}
 
-  void StaGlobal(Callable ic) {
+  void StaGlobal(Callable ic, LanguageMode language_mode) {
     // Get the global object.
     Node* context = GetContext();
     Node* native_context = LoadNativeContext(context);
@@ -268,9 +285,24 @@ class InterpreterStoreGlobalAssembler : public InterpreterAssembler {
     Node* raw_slot = BytecodeOperandIdx(1);
     Node* smi_slot = SmiTag(raw_slot);
     Node* feedback_vector = LoadFeedbackVector();
+
+    // Functions that run without a feedback vector store the global through
+    // the runtime.
+    Label no_feedback(this, Label::kDeferred);
+    GotoIf(IsUndefined(feedback_vector), &no_feedback);
+
     CallStub(ic.descriptor(), code_target, context, global, name, value,
              smi_slot, feedback_vector);
     Dispatch();
+
+    BIND(&no_feedback);
+    {
+      Runtime::FunctionId function_id =
+          is_strict(language_mode) ? Runtime::kStoreLookupSlot_Strict
+                                   : Runtime::kStoreLookupSlot_Sloppy;
+      CallRuntime(function_id, context, name, value);
+      Dispatch();
+    }
   }
 };
 
@@ -280,7 +312,7 @@ class InterpreterStoreGlobalAssembler : public InterpreterAssembler {
 // entry <name_index> using FeedBackVector slot <slot> in sloppy mode.
 IGNITION_HANDLER(StaGlobalSloppy, InterpreterStoreGlobalAssembler) {
   Callable ic = CodeFactory::StoreGlobalICInOptimizedCode(isolate(), SLOPPY);
-  StaGlobal(ic);
+  StaGlobal(ic, SLOPPY);
 }
 
 // StaGlobalStrict <name_index> <slot>
@@ -289,7 +321,7 @@ IGNITION_HANDLER(StaGlobalSloppy, InterpreterStoreGlobalAssembler) {
 // entry <name_index> using FeedBackVector slot <slot> in strict mode.
 IGNITION_HANDLER(StaGlobalStrict, InterpreterStoreGlobalAssembler) {
   Callable ic = CodeFactory::StoreGlobalICInOptimizedCode(isolate(), STRICT);
-  StaGlobal(ic);
+  StaGlobal(ic, STRICT);
 }
 
 // LdaContextSlot <context> <slot_index> <depth>
@@ -666,8 +698,28 @@ IGNITION_HANDLER(StaNamedPropertyStrict,
 // the name in constant pool entry <name_index> with the value in the
 // accumulator.
 IGNITION_HANDLER(StaNamedOwnProperty, InterpreterStoreNamedPropertyAssembler) {
+  // Functions that run without a feedback vector define the property in the
+  // runtime.
+  Label no_feedback(this, Label::kDeferred);
+  Node* feedback_vector = LoadFeedbackVector();
+  GotoIf(IsUndefined(feedback_vector), &no_feedback);
+
   Callable ic = CodeFactory::StoreOwnICInOptimizedCode(isolate());
   StaNamedProperty(ic);
+
+  BIND(&no_feedback);
+  {
+    Node* object = LoadRegister(BytecodeOperandReg(0));
+    Node* name = LoadConstantPoolEntry(BytecodeOperandIdx(1));
+    Node* value = GetAccumulator();
+    Node* smi_slot = SmiTag(BytecodeOperandIdx(2));
+    Node* flags =
+        SmiConstant(static_cast<int>(DataPropertyInLiteralFlag::kNoFlags));
+    Node* context = GetContext();
+    CallRuntime(Runtime::kDefineDataPropertyInLiteral, context, object, name,
+                value, flags, feedback_vector, smi_slot);
+    Dispatch();
+  }
 }
 
 class InterpreterStoreKeyedPropertyAssembler : public InterpreterAssembler {
@@ -2133,28 +2185,42 @@ IGNITION_HANDLER(TestEqualStrictNoFeedback, InterpreterAssembler) {
   Dispatch();
 }
 
-// TestIn <src>
+// TestIn <src> <feedback_slot>
 //
 // Test if the object referenced by the register operand is a property of the
-// object referenced by the accumulator.
+// object referenced by the accumulator. The map of the object is recorded in
+// the <feedback_slot>.
 IGNITION_HANDLER(TestIn, InterpreterAssembler) {
   Node* reg_index = BytecodeOperandReg(0);
   Node* property = LoadRegister(reg_index);
   Node* object = GetAccumulator();
+  Node* slot_index = BytecodeOperandIdx(1);
+  Node* feedback_vector = LoadFeedbackVector();
   Node* context = GetContext();
+
+  // HasProperty throws on Smis, so they don't need any feedback.
+  Label do_test(this);
+  GotoIf(TaggedIsSmi(object), &do_test);
+  CollectWeakCellFeedback(LoadMap(object), feedback_vector, slot_index);
+  Goto(&do_test);
+
+  BIND(&do_test);
   SetAccumulator(HasProperty(object, property, context));
   Dispatch();
 }
 
-// TestInstanceOf <src>
+// TestInstanceOf <src> <feedback_slot>
 //
 // Test if the object referenced by the <src> register is an an instance of type
-// referenced by the accumulator.
+// referenced by the accumulator. The type is recorded in the <feedback_slot>.
 IGNITION_HANDLER(TestInstanceOf, InterpreterAssembler) {
   Node* reg_index = BytecodeOperandReg(0);
   Node* name = LoadRegister(reg_index);
   Node* object = GetAccumulator();
+  Node* slot_index = BytecodeOperandIdx(1);
+  Node* feedback_vector = LoadFeedbackVector();
   Node* context = GetContext();
+  CollectWeakCellFeedback(object, feedback_vector, slot_index);
   SetAccumulator(InstanceOf(name, object, context));
   Dispatch();
 }
@@ -2651,6 +2717,30 @@ IGNITION_HANDLER(SwitchOnSmiNoFeedback, InterpreterAssembler) {
   Dispatch();
 }
 
+// SwitchOnSmi <table_start> <table_length> <case_value_base>
+//
+// Like SwitchOnSmiNoFeedback, except that the accumulator may hold any value.
+// If it is not a Smi, fall-through to the next bytecode.
+IGNITION_HANDLER(SwitchOnSmi, InterpreterAssembler) {
+  Node* acc = GetAccumulator();
+  Node* table_start = BytecodeOperandIdx(0);
+  Node* table_length = BytecodeOperandUImmWord(1);
+  Node* case_value_base = BytecodeOperandImmIntPtr(2);
+
+  Label fall_through(this);
+
+  GotoIfNot(TaggedIsSmi(acc), &fall_through);
+  Node* case_value = IntPtrSub(SmiUntag(acc), case_value_base);
+  GotoIf(IntPtrLessThan(case_value, IntPtrConstant(0)), &fall_through);
+  GotoIf(IntPtrGreaterThanOrEqual(case_value, table_length), &fall_through);
+  Node* entry = IntPtrAdd(table_start, case_value);
+  Node* relative_jump = LoadAndUntagConstantPoolEntry(entry);
+  Jump(relative_jump);
+
+  BIND(&fall_through);
+  Dispatch();
+}
+
 // CreateRegExpLiteral <pattern_idx> <literal_idx> <flags>
 //
 // Creates a regular expression literal for literal index <literal_idx> with
@@ -2679,10 +2769,13 @@ IGNITION_HANDLER(CreateArrayLiteral, InterpreterAssembler) {
   Node* context = GetContext();
   Node* bytecode_flags = BytecodeOperandFlag(2);
 
-  Label fast_shallow_clone(this), call_runtime(this, Label::kDeferred);
-  Branch(
+  Label fast_shallow_clone(this), fast_deep_clone(this),
+      call_runtime(this, Label::kDeferred);
+  GotoIf(
       IsSetWord32<CreateArrayLiteralFlags::FastShallowCloneBit>(bytecode_flags),
-      &fast_shallow_clone, &call_runtime);
+      &fast_shallow_clone);
+  Branch(IsSetWord32<CreateArrayLiteralFlags::FastDeepCloneBit>(bytecode_flags),
+         &fast_deep_clone, &call_runtime);
 
   BIND(&fast_shallow_clone);
   {
@@ -2693,6 +2786,19 @@ IGNITION_HANDLER(CreateArrayLiteral, InterpreterAssembler) {
     Dispatch();
   }
 
+  BIND(&fast_deep_clone);
+  {
+    // The builtin falls back to the runtime itself.
+    Node* index = BytecodeOperandIdx(0);
+    Node* constant_elements = LoadConstantPoolEntry(index);
+    Callable callable =
+        Builtins::CallableFor(isolate(), Builtins::kFastCloneDeepArray);
+    Node* result = CallStub(callable, context, closure, literal_index,
+                            constant_elements);
+    SetAccumulator(result);
+    Dispatch();
+  }
+
   BIND(&call_runtime);
   {
     Node* flags_raw = DecodeWordFromWord32<CreateArrayLiteralFlags::FlagsBits>(
@@ -2717,10 +2823,14 @@ IGNITION_HANDLER(CreateObjectLiteral, InterpreterAssembler) {
   Node* closure = LoadRegister(Register::function_closure());
 
   // Check if we can do a fast clone or have to call the runtime.
-  Label if_fast_clone(this), if_not_fast_clone(this, Label::kDeferred);
-  Branch(IsSetWord32<CreateObjectLiteralFlags::FastCloneSupportedBit>(
+  Label if_fast_clone(this), if_fast_deep_clone(this),
+      if_not_fast_clone(this, Label::kDeferred);
+  GotoIf(IsSetWord32<CreateObjectLiteralFlags::FastCloneSupportedBit>(
              bytecode_flags),
-         &if_fast_clone, &if_not_fast_clone);
+         &if_fast_clone);
+  Branch(IsSetWord32<CreateObjectLiteralFlags::FastDeepCloneSupportedBit>(
+             bytecode_flags),
+         &if_fast_deep_clone, &if_not_fast_clone);
 
   BIND(&if_fast_clone);
   {
@@ -2732,6 +2842,22 @@ IGNITION_HANDLER(CreateObjectLiteral, InterpreterAssembler) {
     Dispatch();
   }
 
+  BIND(&if_fast_deep_clone);
+  {
+    // The builtin falls back to the runtime itself.
+    Node* index = BytecodeOperandIdx(0);
+    Node* boilerplate_description = LoadConstantPoolEntry(index);
+    Node* flags_raw = DecodeWordFromWord32<CreateObjectLiteralFlags::FlagsBits>(
+        bytecode_flags);
+    Node* flags = SmiTag(flags_raw);
+    Callable callable =
+        Builtins::CallableFor(isolate(), Builtins::kFastCloneDeepObject);
+    Node* result = CallStub(callable, GetContext(), closure, literal_index,
+                            boilerplate_description, flags);
+    StoreRegister(result, BytecodeOperandReg(3));
+    Dispatch();
+  }
+
   BIND(&if_not_fast_clone);
   {
     // If we can't do a fast clone, call into the runtime.
@@ -2768,6 +2894,7 @@ IGNITION_HANDLER(CreateClosure, InterpreterAssembler) {
   Node* vector_index = BytecodeOperandIdx(1);
   vector_index = SmiTag(vector_index);
   Node* feedback_vector = LoadFeedbackVector();
+  GotoIf(IsUndefined(feedback_vector), &call_runtime);
   SetAccumulator(constructor_assembler.EmitFastNewClosure(
       shared, feedback_vector, vector_index, context));
   Dispatch();
@@ -3188,12 +3315,17 @@ IGNITION_HANDLER(ForInNext, InterpreterAssembler) {
   BIND(&if_slow);
   {
     // Record the fact that we hit the for-in slow path.
+    Label filter(this);
     Node* vector_index = BytecodeOperandIdx(3);
     Node* feedback_vector = LoadFeedbackVector();
+    GotoIf(IsUndefined(feedback_vector), &filter);
     Node* megamorphic_sentinel =
         HeapConstant(FeedbackVector::MegamorphicSentinel(isolate()));
     StoreFixedArrayElement(feedback_vector, vector_index, megamorphic_sentinel,
                            SKIP_WRITE_BARRIER);
+    Goto(&filter);
+
+    BIND(&filter);
 
     // Need to filter the {key} for the {receiver}.
     Node* context = GetContext();
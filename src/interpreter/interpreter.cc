@@ -4,6 +4,7 @@
 
 #include "src/interpreter/interpreter.h"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
@@ -11,6 +12,7 @@
 #include "src/compilation-info.h"
 #include "src/compiler.h"
 #include "src/counters.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-generator.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/log.h"
@@ -128,6 +130,14 @@ int Interpreter::InterruptBudget() {
   return FLAG_interrupt_budget * kCodeSizeMultiplier;
 }
 
+// static
+int Interpreter::InitialInterruptBudget() {
+  if (!FLAG_lazy_feedback_allocation) return InterruptBudget();
+  return std::min(FLAG_budget_for_feedback_vector_allocation,
+                  FLAG_interrupt_budget) *
+         kCodeSizeMultiplier;
+}
+
 namespace {
 
 bool ShouldPrintBytecode(Handle<SharedFunctionInfo> shared) {
@@ -201,8 +211,26 @@ InterpreterCompilationJob::Status InterpreterCompilationJob::FinalizeJobImpl() {
     os << std::flush;
   }
 
+  if (V8_UNLIKELY(FLAG_trace_bytecode_size)) {
+    int scaled_operands = 0;
+    for (BytecodeArrayIterator it(bytecodes); !it.done(); it.Advance()) {
+      if (it.current_operand_scale() != OperandScale::kSingle) {
+        scaled_operands++;
+      }
+    }
+    std::unique_ptr<char[]> name = info()->GetDebugName();
+    PrintF("[bytecode size: %s, %d bytes, %d constants, %d wide prefixes]\n",
+           name.get(), bytecodes->length(),
+           bytecodes->constant_pool()->length(), scaled_operands);
+  }
+
   info()->SetBytecodeArray(bytecodes);
-  info()->SetCode(info()->isolate()->builtins()->InterpreterEntryTrampoline());
+  Handle<Code> trampoline =
+      info()->isolate()->builtins()->InterpreterEntryTrampoline();
+  if (FLAG_interpreted_frames_native_stack) {
+    trampoline = info()->isolate()->factory()->CopyCode(trampoline);
+  }
+  info()->SetCode(trampoline);
   return SUCCEEDED;
 }
 
@@ -38,6 +38,10 @@ class Interpreter {
   // Returns the interrupt budget which should be used for the profiler counter.
   static int InterruptBudget();
 
+  // Returns the interrupt budget of freshly allocated bytecode, which is
+  // smaller than InterruptBudget() when feedback vectors are allocated lazily.
+  static int InitialInterruptBudget();
+
   // Creates a compilation job which will generate bytecode for |info|.
   static CompilationJob* NewCompilationJob(CompilationInfo* info);
 
@@ -148,6 +148,11 @@ bool Isolate::IsArrayBufferNeuteringIntact() {
   return buffer_neutering->value() == Smi::FromInt(kProtectorValid);
 }
 
+bool Isolate::IsConsoleDelegateProtectorIntact() {
+  PropertyCell* console_delegate = heap()->console_delegate_protector();
+  return console_delegate->value() == Smi::FromInt(kProtectorValid);
+}
+
 bool Isolate::IsArrayIteratorLookupChainIntact() {
   PropertyCell* array_iterator_cell = heap()->array_iterator_protector();
   return array_iterator_cell->value() == Smi::FromInt(kProtectorValid);
@@ -32,6 +32,7 @@
 #include "src/external-reference-table.h"
 #include "src/frames-inl.h"
 #include "src/ic/access-compiler-data.h"
+#include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
 #include "src/interface-descriptors.h"
 #include "src/interpreter/interpreter.h"
@@ -55,6 +56,7 @@
 #include "src/wasm/compilation-manager.h"
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wrapper-cache.h"
 #include "src/zone/accounting-allocator.h"
 
 namespace v8 {
@@ -490,6 +492,11 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
 
   StackTraceHelper helper(this, mode, caller);
 
+  // Shared by all frames so that the summaries are not reallocated for every
+  // frame. Set the initial size to the maximum inlining level + 1 for the
+  // outermost function.
+  List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
+
   for (StackFrameIterator iter(this);
        !iter.done() && elements->FrameCount() < limit; iter.Advance()) {
     StackFrame* frame = iter.frame();
@@ -501,9 +508,7 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
       case StackFrame::INTERPRETED:
       case StackFrame::BUILTIN: {
         JavaScriptFrame* js_frame = JavaScriptFrame::cast(frame);
-        // Set initial size to the maximum inlining level + 1 for the outermost
-        // function.
-        List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
+        frames.Rewind(0);
         js_frame->Summarize(&frames);
         for (int i = frames.length() - 1;
              i >= 0 && elements->FrameCount() < limit; i--) {
@@ -608,8 +613,9 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
 
   elements->ShrinkToFit();
 
-  // TODO(yangguo): Queue this structured stack trace for preprocessing on GC.
-  return factory()->NewJSArrayWithElements(elements);
+  // The frame array is stored as is. It is only turned into call sites or a
+  // string when the stack property is read.
+  return elements;
 }
 
 MaybeHandle<JSReceiver> Isolate::CaptureAndSetDetailedStackTrace(
@@ -655,6 +661,7 @@ class CaptureStackTraceHelper {
   explicit CaptureStackTraceHelper(Isolate* isolate) : isolate_(isolate) {}
 
   Handle<StackFrameInfo> NewStackFrameObject(FrameSummary& summ) {
+    summ.EnsureSourcePositionsAvailable();
     if (summ.IsJavaScript()) return NewStackFrameObject(summ.AsJavaScript());
     if (summ.IsWasm()) return NewStackFrameObject(summ.AsWasm());
     UNREACHABLE();
@@ -1555,6 +1562,7 @@ bool Isolate::ComputeLocation(MessageLocation* target) {
   List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
   frame->Summarize(&frames);
   FrameSummary& summary = frames.last();
+  summary.EnsureSourcePositionsAvailable();
   int pos = summary.SourcePosition();
   Handle<SharedFunctionInfo> shared;
   Handle<Object> script = summary.script();
@@ -1603,10 +1611,8 @@ bool Isolate::ComputeLocationFromStackTrace(MessageLocation* target,
   Handle<Name> key = factory()->stack_trace_symbol();
   Handle<Object> property =
       JSReceiver::GetDataProperty(Handle<JSObject>::cast(exception), key);
-  if (!property->IsJSArray()) return false;
-  Handle<JSArray> simple_stack_trace = Handle<JSArray>::cast(property);
-
-  Handle<FrameArray> elements(FrameArray::cast(simple_stack_trace->elements()));
+  if (!property->IsFrameArray()) return false;
+  Handle<FrameArray> elements = Handle<FrameArray>::cast(property);
 
   const int frame_count = elements->FrameCount();
   for (int i = 0; i < frame_count; i++) {
@@ -2295,6 +2301,7 @@ Isolate::Isolate(bool enable_serializer)
       stack_trace_for_uncaught_exceptions_options_(StackTrace::kOverview),
       context_slot_cache_(NULL),
       descriptor_lookup_cache_(NULL),
+      transition_lookup_cache_(NULL),
       handle_scope_implementer_(NULL),
       unicode_cache_(NULL),
       allocator_(FLAG_trace_gc_object_stats ? new VerboseAccountingAllocator(
@@ -2336,6 +2343,7 @@ Isolate::Isolate(bool enable_serializer)
       basic_block_profiler_(NULL),
       cancelable_task_manager_(new CancelableTaskManager()),
       wasm_compilation_manager_(new wasm::CompilationManager()),
+      wasm_wrapper_cache_(new wasm::WrapperCache()),
       abort_on_uncaught_exception_callback_(NULL),
       total_regexp_code_generated_(0) {
   {
@@ -2407,6 +2415,42 @@ void Isolate::TearDown() {
 }
 
 
+void Isolate::ResetForReuse() {
+  TRACE_ISOLATE(reset_for_reuse);
+  DCHECK(!IsInUse());
+  Enter();
+  {
+    HandleScope scope(this);
+    compiler_dispatcher()->AbortAll(
+        CompilerDispatcher::BlockingBehavior::kBlock);
+    if (concurrent_recompilation_enabled()) {
+      optimizing_compile_dispatcher()->Flush(
+          OptimizingCompileDispatcher::BlockingBehavior::kBlock);
+    }
+
+    clear_pending_exception();
+    clear_pending_message();
+    clear_scheduled_exception();
+    heap()->set_microtask_queue(heap()->empty_fixed_array());
+    set_pending_microtask_count(0);
+    // Symbols from Symbol.for are shared by all contexts of the isolate.
+    heap()->set_public_symbol_table(heap()->empty_properties_dictionary());
+
+    compilation_cache()->Clear();
+    context_slot_cache()->Clear();
+    descriptor_lookup_cache()->Clear();
+    transition_lookup_cache()->Clear();
+
+    // Everything that is no longer referenced by the embedder, including all
+    // contexts it let go of, is collected now.
+    heap()->NotifyContextDisposed(true);
+    heap()->CollectAllAvailableGarbage(
+        GarbageCollectionReason::kContextDisposal);
+  }
+  Exit();
+}
+
+
 void Isolate::GlobalTearDown() {
   delete thread_data_table_;
   thread_data_table_ = NULL;
@@ -2424,6 +2468,11 @@ void Isolate::ClearSerializerData() {
 void Isolate::Deinit() {
   TRACE_ISOLATE(deinit);
 
+  if (runtime_call_stats_sampler_) {
+    runtime_call_stats_sampler_->Stop();
+    runtime_call_stats_sampler_.reset();
+  }
+
   debug()->Unload();
 
   if (concurrent_recompilation_enabled()) {
@@ -2433,6 +2482,7 @@ void Isolate::Deinit() {
   }
 
   wasm_compilation_manager_->TearDown();
+  wasm_wrapper_cache_->TearDown();
 
   heap_.mark_compact_collector()->EnsureSweepingCompleted();
 
@@ -2442,6 +2492,10 @@ void Isolate::Deinit() {
     PrintF(stdout, "=== Stress deopt counter: %u\n", stress_deopt_count_);
   }
 
+  if (FLAG_print_deopt_stats) {
+    deoptimizer_data_->PrintDeoptimizationCosts();
+  }
+
   if (cpu_profiler_) {
     cpu_profiler_->DeleteAllProfiles();
   }
@@ -2475,6 +2529,8 @@ void Isolate::Deinit() {
   delete compiler_dispatcher_;
   compiler_dispatcher_ = nullptr;
 
+  // Asynchronous waiters register their tasks with the task manager.
+  FutexEmulation::IsolateDeinit(this);
   cancelable_task_manager()->CancelAndWait();
 
   heap_.TearDown();
@@ -2531,6 +2587,8 @@ Isolate::~Isolate() {
 
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = NULL;
+  delete transition_lookup_cache_;
+  transition_lookup_cache_ = NULL;
   delete context_slot_cache_;
   context_slot_cache_ = NULL;
 
@@ -2553,6 +2611,9 @@ Isolate::~Isolate() {
   delete code_tracer();
   set_code_tracer(NULL);
 
+  delete ic_transition_statistics();
+  set_ic_transition_statistics(nullptr);
+
   delete compilation_cache_;
   compilation_cache_ = NULL;
   delete bootstrapper_;
@@ -2652,6 +2713,22 @@ void PrintBuiltinSizes(Isolate* isolate) {
     PrintF(stdout, "%s: %d\n", name, code->instruction_size());
   }
 }
+
+void PrintEmbeddedBuiltinCandidates(Isolate* isolate) {
+  Builtins* builtins = isolate->builtins();
+  int count = 0;
+  int instruction_size = 0;
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    if (builtins->is_lazy_placeholder(i)) continue;
+    Code* code = builtins->builtin(static_cast<Builtins::Name>(i));
+    if (!code->IsIsolateIndependent()) continue;
+    PrintF(stdout, "%s: %d\n", builtins->name(i), code->instruction_size());
+    count++;
+    instruction_size += code->instruction_size();
+  }
+  PrintF(stdout, "%d of %d builtins are isolate-independent (%d bytes)\n",
+         count, Builtins::builtin_count, instruction_size);
+}
 }  // namespace
 
 bool Isolate::Init(Deserializer* des) {
@@ -2684,6 +2761,7 @@ bool Isolate::Init(Deserializer* des) {
   compilation_cache_ = new CompilationCache(this);
   context_slot_cache_ = new ContextSlotCache();
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  transition_lookup_cache_ = new TransitionLookupCache();
   unicode_cache_ = new UnicodeCache();
   inner_pointer_to_code_cache_ = new InnerPointerToCodeCache(this);
   global_handles_ = new GlobalHandles(this);
@@ -2793,6 +2871,9 @@ bool Isolate::Init(Deserializer* des) {
   setup_delegate_ = nullptr;
 
   if (FLAG_print_builtin_size) PrintBuiltinSizes(this);
+  if (FLAG_print_embedded_builtin_candidates) {
+    PrintEmbeddedBuiltinCandidates(this);
+  }
 
   // Finish initialization of ThreadLocal after deserialization is done.
   clear_pending_exception();
@@ -2811,6 +2892,12 @@ bool Isolate::Init(Deserializer* des) {
     std::ofstream(GetTurboCfgFileName().c_str(), std::ios_base::trunc);
   }
 
+  if (FLAG_runtime_call_stats_sampling) {
+    runtime_call_stats_sampler_.reset(
+        new RuntimeCallStatsSampler(counters()->runtime_call_stats()));
+    runtime_call_stats_sampler_->Start();
+  }
+
   CHECK_EQ(static_cast<int>(OFFSET_OF(Isolate, embedder_data_)),
            Internals::kIsolateEmbedderDataOffset);
   CHECK_EQ(static_cast<int>(OFFSET_OF(Isolate, heap_.roots_)),
@@ -2950,6 +3037,11 @@ void Isolate::DumpAndResetStats() {
     }
   }
   if (hstatistics() != nullptr) hstatistics()->Print();
+  if (ic_transition_statistics() != nullptr) {
+    OFStream os(stdout);
+    ic_transition_statistics()->Print(os);
+    ic_transition_statistics()->Reset();
+  }
   delete turbo_statistics_;
   turbo_statistics_ = nullptr;
   delete hstatistics_;
@@ -2975,6 +3067,13 @@ CompilationStatistics* Isolate::GetTurboStatistics() {
   return turbo_statistics();
 }
 
+ICTransitionStatistics* Isolate::GetICTransitionStatistics() {
+  if (ic_transition_statistics() == nullptr) {
+    set_ic_transition_statistics(new ICTransitionStatistics());
+  }
+  return ic_transition_statistics();
+}
+
 
 HTracer* Isolate::GetHTracer() {
   if (htracer() == NULL) set_htracer(new HTracer(id()));
@@ -3011,6 +3110,25 @@ bool Isolate::NeedsSourcePositionsForProfiling() const {
          debug_->is_active() || logger_->is_logging();
 }
 
+void Isolate::CollectSourcePositionsForAllBytecodeArrays() {
+  if (!FLAG_enable_lazy_source_positions) return;
+  HandleScope scope(this);
+  std::vector<Handle<SharedFunctionInfo>> candidates;
+  {
+    HeapIterator iterator(heap());
+    while (HeapObject* obj = iterator.next()) {
+      if (!obj->IsSharedFunctionInfo()) continue;
+      SharedFunctionInfo* shared = SharedFunctionInfo::cast(obj);
+      if (!shared->HasBytecodeArray()) continue;
+      if (shared->bytecode_array()->HasSourcePositionTable()) continue;
+      candidates.push_back(handle(shared, this));
+    }
+  }
+  for (Handle<SharedFunctionInfo> shared : candidates) {
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(shared);
+  }
+}
+
 void Isolate::SetCodeCoverageList(Object* value) {
   DCHECK(value->IsUndefined(this) || value->IsArrayList());
   heap()->set_code_coverage_list(value);
@@ -3205,6 +3323,15 @@ void Isolate::InvalidateArrayBufferNeuteringProtector() {
   DCHECK(!IsArrayBufferNeuteringIntact());
 }
 
+void Isolate::InvalidateConsoleDelegateProtector() {
+  DCHECK(factory()->console_delegate_protector()->value()->IsSmi());
+  DCHECK(IsConsoleDelegateProtectorIntact());
+  PropertyCell::SetValueWithInvalidation(
+      factory()->console_delegate_protector(),
+      handle(Smi::FromInt(kProtectorInvalid), this));
+  DCHECK(!IsConsoleDelegateProtectorIntact());
+}
+
 bool Isolate::IsAnyInitialArrayPrototype(Handle<JSArray> array) {
   DisallowHeapAllocation no_gc;
   return IsInAnyContext(*array, Context::INITIAL_ARRAY_PROTOTYPE_INDEX);
@@ -3440,6 +3567,31 @@ void Isolate::PromiseReactionJob(Handle<PromiseReactionJobInfo> info,
   }
 }
 
+int Isolate::PromiseReactionJobs(Handle<FixedArray> queue, int start,
+                                 int end, MaybeHandle<Object>* result,
+                                 MaybeHandle<Object>* maybe_exception) {
+  DCHECK(queue->get(start)->IsPromiseReactionJobInfo());
+  DCHECK(!PromiseReactionJobInfo::cast(queue->get(start))
+              ->deferred_promise()
+              ->IsFixedArray());
+  Handle<Object> argv[] = {queue, handle(Smi::FromInt(start), this),
+                           handle(Smi::FromInt(end), this)};
+  *result = Execution::TryCall(
+      this, promise_run_reaction_jobs(), factory()->undefined_value(),
+      arraysize(argv), argv, Execution::MessageHandling::kReport,
+      maybe_exception);
+  Handle<Object> next;
+  if (result->ToHandle(&next)) return Smi::cast(*next)->value();
+
+  // The builtin clears the slot of each job before running it, so the jobs
+  // that did not run start at the first slot that is still set.
+  int next_index = start;
+  while (next_index < end && queue->get(next_index)->IsUndefined(this)) {
+    next_index++;
+  }
+  return next_index;
+}
+
 void Isolate::PromiseResolveThenableJob(
     Handle<PromiseResolveThenableJobInfo> info, MaybeHandle<Object>* result,
     MaybeHandle<Object>* maybe_exception) {
@@ -3547,8 +3699,17 @@ void Isolate::RunMicrotasksInternal() {
               Handle<PromiseResolveThenableJobInfo>::cast(microtask), &result,
               &maybe_exception);
         } else {
-          PromiseReactionJob(Handle<PromiseReactionJobInfo>::cast(microtask),
-                             &result, &maybe_exception);
+          Handle<PromiseReactionJobInfo> info =
+              Handle<PromiseReactionJobInfo>::cast(microtask);
+          if (info->deferred_promise()->IsFixedArray()) {
+            PromiseReactionJob(info, &result, &maybe_exception);
+          } else {
+            // Run this job and the reaction jobs following it without
+            // returning to C++ in between.
+            i = PromiseReactionJobs(queue, i, num_tasks, &result,
+                                    &maybe_exception) -
+                1;
+          }
         }
 
         handle_scope_implementer_->LeaveMicrotaskContext();
@@ -62,6 +62,7 @@ class CpuFeatures;
 class CpuProfiler;
 class DeoptimizerData;
 class DescriptorLookupCache;
+class TransitionLookupCache;
 class Deserializer;
 class EmptyStatement;
 class ExternalCallbackScope;
@@ -72,6 +73,7 @@ class HeapObjectToIndexHashMap;
 class HeapProfiler;
 class HStatistics;
 class HTracer;
+class ICTransitionStatistics;
 class InlineRuntimeFunctionsTable;
 class InnerPointerToCodeCache;
 class Logger;
@@ -79,6 +81,7 @@ class MaterializedObjectStore;
 class OptimizingCompileDispatcher;
 class RegExpStack;
 class RootVisitor;
+class RuntimeCallStatsSampler;
 class RuntimeProfiler;
 class SaveContext;
 class SetupIsolateDelegate;
@@ -109,6 +112,7 @@ class Interpreter;
 
 namespace wasm {
 class CompilationManager;
+class WrapperCache;
 }
 
 #define RETURN_FAILURE_IF_SCHEDULED_EXCEPTION(isolate)    \
@@ -409,6 +413,7 @@ typedef std::vector<HeapObject*> DebugObjectCache;
   V(int, pending_microtask_count, 0)                                          \
   V(HStatistics*, hstatistics, nullptr)                                       \
   V(CompilationStatistics*, turbo_statistics, nullptr)                        \
+  V(ICTransitionStatistics*, ic_transition_statistics, nullptr)               \
   V(HTracer*, htracer, nullptr)                                               \
   V(CodeTracer*, code_tracer, nullptr)                                        \
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                           \
@@ -530,6 +535,10 @@ class Isolate {
   // for legacy API reasons.
   void TearDown();
 
+  // Drops all state left behind by scripts that ran in this isolate, so that
+  // it can be reused instead of being torn down. Must not be entered.
+  void ResetForReuse();
+
   void ReleaseManagedObjects();
 
   static void GlobalTearDown();
@@ -888,6 +897,10 @@ class Isolate {
     return descriptor_lookup_cache_;
   }
 
+  TransitionLookupCache* transition_lookup_cache() {
+    return transition_lookup_cache_;
+  }
+
   HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() {
@@ -987,6 +1000,10 @@ class Isolate {
 
   bool NeedsSourcePositionsForProfiling() const;
 
+  // Collects the source positions of all bytecode that was compiled without,
+  // e.g. when a profiler that needs line information is started.
+  void CollectSourcePositionsForAllBytecodeArrays();
+
   bool is_best_effort_code_coverage() const {
     return code_coverage_mode() == debug::Coverage::kBestEffort;
   }
@@ -1003,6 +1020,16 @@ class Isolate {
     return code_coverage_mode() == debug::Coverage::kBlockCount;
   }
 
+  bool is_block_count_best_effort_code_coverage() const {
+    return code_coverage_mode() == debug::Coverage::kBlockCountBestEffort;
+  }
+
+  // Whether newly compiled functions are instrumented with block counters.
+  bool is_block_code_coverage() const {
+    return is_block_count_code_coverage() ||
+           is_block_count_best_effort_code_coverage();
+  }
+
   void SetCodeCoverageList(Object* value);
 
   double time_millis_since_init() {
@@ -1038,6 +1065,9 @@ class Isolate {
   // Make sure we do check for neutered array buffers.
   inline bool IsArrayBufferNeuteringIntact();
 
+  // Console calls are no-ops as long as no console delegate was ever set.
+  inline bool IsConsoleDelegateProtectorIntact();
+
   // On intent to set an element in object, make sure that appropriate
   // notifications occur if the set is on the elements of the array or
   // object prototype. Also ensure that changes to prototype chain between
@@ -1057,6 +1087,7 @@ class Isolate {
   void InvalidateStringLengthOverflowProtector();
   void InvalidateArrayIteratorProtector();
   void InvalidateArrayBufferNeuteringProtector();
+  void InvalidateConsoleDelegateProtector();
 
   // Returns true if array is the initial array prototype in any native context.
   bool IsAnyInitialArrayPrototype(Handle<JSArray> array);
@@ -1089,6 +1120,7 @@ class Isolate {
 
   HStatistics* GetHStatistics();
   CompilationStatistics* GetTurboStatistics();
+  ICTransitionStatistics* GetICTransitionStatistics();
   HTracer* GetHTracer();
   CodeTracer* GetCodeTracer();
 
@@ -1140,6 +1172,13 @@ class Isolate {
   void PromiseResolveThenableJob(Handle<PromiseResolveThenableJobInfo> info,
                                  MaybeHandle<Object>* result,
                                  MaybeHandle<Object>* maybe_exception);
+  // Runs the PromiseReactionJobInfo with a single reaction at {start} of
+  // {queue}, and the ones following it in the same native context, in one
+  // call to the RunPromiseReactionJobs builtin. Returns the index of the first
+  // microtask in [start, end) that was not run.
+  int PromiseReactionJobs(Handle<FixedArray> queue, int start, int end,
+                          MaybeHandle<Object>* result,
+                          MaybeHandle<Object>* maybe_exception);
   void EnqueueMicrotask(Handle<Object> microtask);
   void RunMicrotasks();
   bool IsRunningMicrotasks() const { return is_running_microtasks_; }
@@ -1200,6 +1239,10 @@ class Isolate {
     return wasm_compilation_manager_.get();
   }
 
+  wasm::WrapperCache* wasm_wrapper_cache() {
+    return wasm_wrapper_cache_.get();
+  }
+
   const AstStringConstants* ast_string_constants() const {
     return ast_string_constants_;
   }
@@ -1438,6 +1481,7 @@ class Isolate {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_;
   ContextSlotCache* context_slot_cache_;
   DescriptorLookupCache* descriptor_lookup_cache_;
+  TransitionLookupCache* transition_lookup_cache_;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_;
   UnicodeCache* unicode_cache_;
@@ -1495,6 +1539,7 @@ class Isolate {
   CpuProfiler* cpu_profiler_;
   HeapProfiler* heap_profiler_;
   std::unique_ptr<CodeEventDispatcher> code_event_dispatcher_;
+  std::unique_ptr<RuntimeCallStatsSampler> runtime_call_stats_sampler_;
   FunctionEntryHook function_entry_hook_;
 
   const AstStringConstants* ast_string_constants_;
@@ -1561,6 +1606,7 @@ class Isolate {
   CancelableTaskManager* cancelable_task_manager_;
 
   std::unique_ptr<wasm::CompilationManager> wasm_compilation_manager_;
+  std::unique_ptr<wasm::WrapperCache> wasm_wrapper_cache_;
 
   debug::ConsoleDelegate* console_delegate_ = nullptr;
 
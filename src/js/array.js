@@ -706,10 +706,15 @@ function ArraySplice(start, delete_count) {
 
 
 function InnerArraySort(array, length, comparefn) {
-  // In-place QuickSort algorithm.
-  // For short (length <= 10) arrays, insertion sort is used for efficiency.
-
-  if (!IS_CALLABLE(comparefn)) {
+  // Stable, adaptive merge sort (TimSort). The input is split into runs
+  // that are already ascending or strictly descending; short runs are
+  // extended to a minimum length with binary insertion sort. The runs are
+  // kept on a stack whose lengths shrink at least as fast as the Fibonacci
+  // numbers and are merged pairwise. Partially sorted input therefore takes
+  // close to linear time.
+
+  var is_default_order = !IS_CALLABLE(comparefn);
+  if (is_default_order) {
     comparefn = function (x, y) {
       if (x === y) return 0;
       if (%_IsSmi(x) && %_IsSmi(y)) {
@@ -721,124 +726,234 @@ function InnerArraySort(array, length, comparefn) {
       else return x < y ? -1 : 1;
     };
   }
-  function InsertionSort(a, from, to) {
-    for (var i = from + 1; i < to; i++) {
+
+  // Runs shorter than this are merged directly with insertion sort.
+  var kMinMerge = 64;
+
+  // The pending runs, as parallel stacks of start indices and lengths.
+  var run_base;
+  var run_length;
+  var stack_size;
+
+  // Returns a run length such that {n} / min_run is a power of two or
+  // slightly less, which keeps the final merges balanced.
+  function ComputeMinRunLength(n) {
+    var r = 0;
+    while (n >= kMinMerge) {
+      r |= n & 1;
+      n >>= 1;
+    }
+    return n + r;
+  }
+
+  function ReverseRange(a, from, to) {
+    to--;
+    while (from < to) {
+      var tmp = a[from];
+      a[from++] = a[to];
+      a[to--] = tmp;
+    }
+  }
+
+  // Returns the length of the run starting at {from}. A strictly descending
+  // run is reversed in place; requiring it to be strict keeps the sort
+  // stable.
+  function CountAndMakeRun(a, from, to) {
+    var next = from + 1;
+    if (next == to) return 1;
+    var previous = a[next];
+    var is_descending = comparefn(previous, a[from]) < 0;
+    for (next++; next < to; next++) {
+      var current = a[next];
+      var order = comparefn(current, previous);
+      if (is_descending ? order >= 0 : order < 0) break;
+      previous = current;
+    }
+    if (is_descending) ReverseRange(a, from, next);
+    return next - from;
+  }
+
+  // Sorts the range from..to whose prefix from..start is already sorted.
+  function BinaryInsertionSort(a, from, start, to) {
+    for (var i = start; i < to; i++) {
       var element = a[i];
-      for (var j = i - 1; j >= from; j--) {
-        var tmp = a[j];
-        var order = comparefn(tmp, element);
-        if (order > 0) {
-          a[j + 1] = tmp;
+      // Find the position after all elements that are not greater.
+      var left = from;
+      var right = i;
+      while (left < right) {
+        var middle = left + ((right - left) >> 1);
+        if (comparefn(element, a[middle]) < 0) {
+          right = middle;
         } else {
-          break;
+          left = middle + 1;
         }
       }
-      a[j + 1] = element;
+      for (var j = i; j > left; j--) a[j] = a[j - 1];
+      a[left] = element;
     }
-  };
+  }
 
-  function GetThirdIndex(a, from, to) {
-    var t_array = new InternalArray();
-    // Use both 'from' and 'to' to determine the pivot candidates.
-    var increment = 200 + ((to - from) & 15);
-    var j = 0;
-    from += 1;
-    to -= 1;
-    for (var i = from; i < to; i += increment) {
-      t_array[j] = [i, a[i]];
-      j++;
+  // Returns the number of elements in the sorted range base..base+length
+  // that are not greater than {key}.
+  function CountNotGreater(key, a, base, length) {
+    var left = 0;
+    var right = length;
+    while (left < right) {
+      var middle = left + ((right - left) >> 1);
+      if (comparefn(key, a[base + middle]) < 0) {
+        right = middle;
+      } else {
+        left = middle + 1;
+      }
     }
-    t_array.sort(function(a, b) {
-      return comparefn(a[1], b[1]);
-    });
-    var third_index = t_array[t_array.length >> 1][0];
-    return third_index;
-  }
-
-  function QuickSort(a, from, to) {
-    var third_index = 0;
-    while (true) {
-      // Insertion sort is faster for short arrays.
-      if (to - from <= 10) {
-        InsertionSort(a, from, to);
-        return;
+    return left;
+  }
+
+  // Returns the number of elements in the sorted range base..base+length
+  // that are less than {key}.
+  function CountLess(key, a, base, length) {
+    var left = 0;
+    var right = length;
+    while (left < right) {
+      var middle = left + ((right - left) >> 1);
+      if (comparefn(a[base + middle], key) < 0) {
+        left = middle + 1;
+      } else {
+        right = middle;
       }
-      if (to - from > 1000) {
-        third_index = GetThirdIndex(a, from, to);
+    }
+    return left;
+  }
+
+  // Merges the adjacent runs at base1 and base2 when the first one is the
+  // shorter one, copying it aside and filling the range from the left.
+  function MergeLow(a, base1, length1, base2, length2) {
+    var tmp = new InternalArray();
+    for (var i = 0; i < length1; i++) tmp[i] = a[base1 + i];
+    var dest = base1;
+    var cursor1 = 0;
+    var cursor2 = base2;
+    var end2 = base2 + length2;
+    while (cursor1 < length1 && cursor2 < end2) {
+      var element = a[cursor2];
+      if (comparefn(element, tmp[cursor1]) < 0) {
+        a[dest++] = element;
+        cursor2++;
       } else {
-        third_index = from + ((to - from) >> 1);
+        a[dest++] = tmp[cursor1++];
       }
-      // Find a pivot as the median of first, last and middle element.
-      var v0 = a[from];
-      var v1 = a[to - 1];
-      var v2 = a[third_index];
-      var c01 = comparefn(v0, v1);
-      if (c01 > 0) {
-        // v1 < v0, so swap them.
-        var tmp = v0;
-        v0 = v1;
-        v1 = tmp;
-      } // v0 <= v1.
-      var c02 = comparefn(v0, v2);
-      if (c02 >= 0) {
-        // v2 <= v0 <= v1.
-        var tmp = v0;
-        v0 = v2;
-        v2 = v1;
-        v1 = tmp;
+    }
+    // The rest of the second run is already in place.
+    while (cursor1 < length1) a[dest++] = tmp[cursor1++];
+  }
+
+  // Merges the adjacent runs at base1 and base2 when the second one is the
+  // shorter one, copying it aside and filling the range from the right.
+  function MergeHigh(a, base1, length1, base2, length2) {
+    var tmp = new InternalArray();
+    for (var i = 0; i < length2; i++) tmp[i] = a[base2 + i];
+    var dest = base2 + length2 - 1;
+    var cursor1 = base2 - 1;
+    var cursor2 = length2 - 1;
+    while (cursor1 >= base1 && cursor2 >= 0) {
+      var element = a[cursor1];
+      if (comparefn(tmp[cursor2], element) < 0) {
+        a[dest--] = element;
+        cursor1--;
       } else {
-        // v0 <= v1 && v0 < v2
-        var c12 = comparefn(v1, v2);
-        if (c12 > 0) {
-          // v0 <= v2 < v1
-          var tmp = v1;
-          v1 = v2;
-          v2 = tmp;
-        }
+        a[dest--] = tmp[cursor2--];
       }
-      // v0 <= v1 <= v2
-      a[from] = v0;
-      a[to - 1] = v2;
-      var pivot = v1;
-      var low_end = from + 1;   // Upper bound of elements lower than pivot.
-      var high_start = to - 1;  // Lower bound of elements greater than pivot.
-      a[third_index] = a[low_end];
-      a[low_end] = pivot;
-
-      // From low_end to i are elements equal to pivot.
-      // From i to high_start are elements that haven't been compared yet.
-      partition: for (var i = low_end + 1; i < high_start; i++) {
-        var element = a[i];
-        var order = comparefn(element, pivot);
-        if (order < 0) {
-          a[i] = a[low_end];
-          a[low_end] = element;
-          low_end++;
-        } else if (order > 0) {
-          do {
-            high_start--;
-            if (high_start == i) break partition;
-            var top_elem = a[high_start];
-            order = comparefn(top_elem, pivot);
-          } while (order > 0);
-          a[i] = a[high_start];
-          a[high_start] = element;
-          if (order < 0) {
-            element = a[i];
-            a[i] = a[low_end];
-            a[low_end] = element;
-            low_end++;
-          }
-        }
+    }
+    // The rest of the first run is already in place.
+    while (cursor2 >= 0) a[dest--] = tmp[cursor2--];
+  }
+
+  // Merges the runs at positions i and i + 1 of the run stack.
+  function MergeAt(a, i) {
+    var base1 = run_base[i];
+    var length1 = run_length[i];
+    var base2 = run_base[i + 1];
+    var length2 = run_length[i + 1];
+    run_length[i] = length1 + length2;
+    if (i == stack_size - 3) {
+      run_base[i + 1] = run_base[i + 2];
+      run_length[i + 1] = run_length[i + 2];
+    }
+    stack_size--;
+
+    // Elements of the first run that are not greater than the first element
+    // of the second run, and elements of the second run that are not less
+    // than the last element of the first run, are already in place.
+    var k = CountNotGreater(a[base2], a, base1, length1);
+    base1 += k;
+    length1 -= k;
+    if (length1 == 0) return;
+    length2 = CountLess(a[base1 + length1 - 1], a, base2, length2);
+    if (length2 == 0) return;
+
+    if (length1 <= length2) {
+      MergeLow(a, base1, length1, base2, length2);
+    } else {
+      MergeHigh(a, base1, length1, base2, length2);
+    }
+  }
+
+  // Merges runs until the lengths on the stack satisfy
+  //   run_length[i - 2] > run_length[i - 1] + run_length[i] and
+  //   run_length[i - 1] > run_length[i].
+  function MergeCollapse(a) {
+    while (stack_size > 1) {
+      var n = stack_size - 2;
+      if ((n > 0 && run_length[n - 1] <= run_length[n] + run_length[n + 1]) ||
+          (n > 1 && run_length[n - 2] <= run_length[n - 1] + run_length[n])) {
+        if (run_length[n - 1] < run_length[n + 1]) n--;
+      } else if (run_length[n] > run_length[n + 1]) {
+        break;
       }
-      if (to - high_start < low_end - from) {
-        QuickSort(a, high_start, to);
-        to = low_end;
-      } else {
-        QuickSort(a, from, low_end);
-        from = high_start;
+      MergeAt(a, n);
+    }
+  }
+
+  function MergeForceCollapse(a) {
+    while (stack_size > 1) {
+      var n = stack_size - 2;
+      if (n > 0 && run_length[n - 1] < run_length[n + 1]) n--;
+      MergeAt(a, n);
+    }
+  }
+
+  function TimSort(a, from, to) {
+    var remaining = to - from;
+    if (remaining < 2) return;
+    if (remaining < kMinMerge) {
+      var initial_run_length = CountAndMakeRun(a, from, to);
+      BinaryInsertionSort(a, from, from + initial_run_length, to);
+      return;
+    }
+
+    run_base = new InternalArray();
+    run_length = new InternalArray();
+    stack_size = 0;
+    var min_run_length = ComputeMinRunLength(remaining);
+    var low = from;
+    while (remaining != 0) {
+      var current_run_length = CountAndMakeRun(a, low, to);
+      if (current_run_length < min_run_length) {
+        // Extend the run to the minimum run length.
+        var forced_run_length =
+            remaining < min_run_length ? remaining : min_run_length;
+        BinaryInsertionSort(a, low, low + current_run_length,
+                            low + forced_run_length);
+        current_run_length = forced_run_length;
       }
+      run_base[stack_size] = low;
+      run_length[stack_size] = current_run_length;
+      stack_size++;
+      MergeCollapse(a);
+      low += current_run_length;
+      remaining -= current_run_length;
     }
+    MergeForceCollapse(a);
   };
 
   // Copy elements in the range 0..length from obj's prototype chain
@@ -980,7 +1095,11 @@ function InnerArraySort(array, length, comparefn) {
     num_non_undefined = SafeRemoveArrayHoles(array);
   }
 
-  QuickSort(array, 0, num_non_undefined);
+  // Smis in the default order are sorted without calling back into
+  // JavaScript.
+  if (!is_default_order || !%SortSmiElementsFast(array, num_non_undefined)) {
+    TimSort(array, 0, num_non_undefined);
+  }
 
   if (!is_array && (num_non_undefined + 1 < max_prototype_element)) {
     // For compatibility with JSC, we shadow any elements in the prototype
@@ -1914,10 +1914,49 @@ var defaultObjects = {
   'dateformattime': UNDEFINED,
 };
 
+// Instances created with a single locale string and no options, most
+// recently used last. Keys are the service name and the locale joined by a
+// space, which cannot occur in a language tag.
+var kMaxLocaleObjects = 16;
+var localeObjectKeys = new InternalArray();
+var localeObjectValues = new InternalArray();
+
 function clearDefaultObjects() {
   defaultObjects['dateformatall'] = UNDEFINED;
   defaultObjects['dateformatdate'] = UNDEFINED;
   defaultObjects['dateformattime'] = UNDEFINED;
+  localeObjectKeys.length = 0;
+  localeObjectValues.length = 0;
+}
+
+function cachedLocaleService(service, locale, useOptions) {
+  var key = service + ' ' + locale;
+  var length = localeObjectKeys.length;
+  for (var i = length - 1; i >= 0; i--) {
+    if (localeObjectKeys[i] === key) {
+      var value = localeObjectValues[i];
+      // Move the entry to the end to keep the most recently used order.
+      for (var j = i + 1; j < length; j++) {
+        localeObjectKeys[j - 1] = localeObjectKeys[j];
+        localeObjectValues[j - 1] = localeObjectValues[j];
+      }
+      localeObjectKeys[length - 1] = key;
+      localeObjectValues[length - 1] = value;
+      return value;
+    }
+  }
+  var value = new savedObjects[service](locale, useOptions);
+  if (length === kMaxLocaleObjects) {
+    // Evict the least recently used entry.
+    for (var j = 1; j < length; j++) {
+      localeObjectKeys[j - 1] = localeObjectKeys[j];
+      localeObjectValues[j - 1] = localeObjectValues[j];
+    }
+    length--;
+  }
+  localeObjectKeys[length] = key;
+  localeObjectValues[length] = value;
+  return value;
 }
 
 var date_cache_version = 0;
@@ -1934,7 +1973,8 @@ function checkDateCacheCurrent() {
 
 /**
  * Returns cached or newly created instance of a given service.
- * We cache only default instances (where no locales or options are provided).
+ * We cache default instances (where no locales or options are provided) and
+ * a few instances for a single locale string without options.
  */
 function cachedOrNewService(service, locales, options, defaults) {
   var useOptions = (IS_UNDEFINED(defaults)) ? options : defaults;
@@ -1945,6 +1985,10 @@ function cachedOrNewService(service, locales, options, defaults) {
     }
     return defaultObjects[service];
   }
+  if (IS_STRING(locales) && IS_UNDEFINED(options)) {
+    checkDateCacheCurrent();
+    return cachedLocaleService(service, locales, useOptions);
+  }
   return new savedObjects[service](locales, useOptions);
 }
 
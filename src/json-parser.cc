@@ -20,6 +20,79 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+const uintptr_t kOneBytes = kUintptrAllBitsSet / 0xFF;
+const uintptr_t kHighBits = kOneBytes * 0x80;
+
+// Returns a non-zero value iff a byte in {word} is less than {c}, which must
+// be at most 0x80.
+inline uintptr_t BytesLessThan(uintptr_t word, uint8_t c) {
+  return (word - kOneBytes * c) & ~word & kHighBits;
+}
+
+// Returns a non-zero value iff a byte in {word} is {c}.
+inline uintptr_t BytesEqualTo(uintptr_t word, uint8_t c) {
+  return BytesLessThan(word ^ (kOneBytes * c), 1);
+}
+
+inline bool IsJsonStringTerminator(uint8_t c) {
+  return c == '"' || c == '\\' || c < 0x20;
+}
+
+// Returns the number of leading characters in {chars} that can be copied
+// verbatim into a JSON string, i.e. up to the first quote, backslash or
+// control character. Aligned words are checked a word at a time.
+int JsonStringPlainPrefixLength(const uint8_t* chars, int length) {
+  const uint8_t* start = chars;
+  const uint8_t* limit = chars + length;
+  while (chars < limit &&
+         !IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+    if (IsJsonStringTerminator(*chars)) return static_cast<int>(chars - start);
+    ++chars;
+  }
+  while (chars + sizeof(uintptr_t) <= limit) {
+    uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+    if (BytesEqualTo(word, '"') | BytesEqualTo(word, '\\') |
+        BytesLessThan(word, 0x20)) {
+      break;
+    }
+    chars += sizeof(uintptr_t);
+  }
+  while (chars < limit && !IsJsonStringTerminator(*chars)) ++chars;
+  return static_cast<int>(chars - start);
+}
+
+// Returns the number of leading spaces in {chars}. Long runs of spaces, as
+// used for indentation, are skipped a word at a time.
+int JsonLeadingSpacesLength(const uint8_t* chars, int length) {
+  const uint8_t* start = chars;
+  const uint8_t* limit = chars + length;
+  while (chars < limit &&
+         !IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+    if (*chars != ' ') return static_cast<int>(chars - start);
+    ++chars;
+  }
+  const uintptr_t spaces = kOneBytes * ' ';
+  while (chars + sizeof(uintptr_t) <= limit &&
+         *reinterpret_cast<const uintptr_t*>(chars) == spaces) {
+    chars += sizeof(uintptr_t);
+  }
+  while (chars < limit && *chars == ' ') ++chars;
+  return static_cast<int>(chars - start);
+}
+
+// Returns the ancestor of {map} in the transition tree that has {descriptors}
+// own descriptors.
+Map* TransitionAncestor(Map* map, int descriptors) {
+  while (map->NumberOfOwnDescriptors() > descriptors) {
+    map = Map::cast(map->GetBackPointer());
+  }
+  return map;
+}
+
+}  // namespace
+
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
                                                        Handle<Object> object,
                                                        Handle<Object> reviver) {
@@ -110,6 +183,8 @@ JsonParser<seq_one_byte>::JsonParser(Isolate* isolate, Handle<String> source)
       zone_(isolate_->allocator(), ZONE_NAME),
       object_constructor_(isolate_->native_context()->object_function(),
                           isolate_),
+      shape_cache_(isolate_->factory()->NewFixedArray(kShapeCacheSize)),
+      object_depth_(0),
       position_(-1) {
   source_ = String::Flatten(source_);
   pretenure_ = (source_length_ >= kPretenureTreshold) ? TENURED : NOT_TENURED;
@@ -190,14 +265,19 @@ void JsonParser<seq_one_byte>::Advance() {
 
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::AdvanceSkipWhitespace() {
-  do {
-    Advance();
-  } while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r');
+  Advance();
+  SkipWhitespace();
 }
 
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::SkipWhitespace() {
   while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r') {
+    if (seq_one_byte && c0_ == ' ') {
+      // Move to the last space of the run.
+      position_ += JsonLeadingSpacesLength(
+          seq_source_->GetChars() + position_ + 1,
+          source_length_ - position_ - 1);
+    }
     Advance();
   }
 }
@@ -337,6 +417,19 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
 
   bool transitioning = true;
 
+  // Records in an array usually repeat the keys of the previous object at the
+  // same depth. As long as they do, the keys are matched against the final
+  // map of that object and the intermediate maps are skipped; {map} is then
+  // ahead of the properties parsed so far.
+  int depth = object_depth_++;
+  Handle<Map> shape;
+  if (seq_one_byte && depth < kShapeCacheSize &&
+      shape_cache_->get(depth)->IsMap()) {
+    shape = handle(Map::cast(shape_cache_->get(depth)), isolate());
+    if (shape->is_deprecated()) shape = Handle<Map>::null();
+  }
+  bool following_shape = !shape.is_null();
+
   AdvanceSkipWhitespace();
   if (c0_ != '}') {
     do {
@@ -363,16 +456,33 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       // Try to follow existing transitions as long as possible. Once we stop
       // transitioning, no transition can be found anymore.
       DCHECK(transitioning);
-      // First check whether there is a single expected transition. If so, try
-      // to parse it first.
-      bool follow_expected = false;
       Handle<Map> target;
-      if (seq_one_byte) {
+      if (following_shape) {
+        if (descriptor < shape->NumberOfOwnDescriptors()) {
+          key = handle(
+              String::cast(shape->instance_descriptors()->GetKey(descriptor)),
+              isolate());
+          following_shape = ParseJsonString(key);
+        } else {
+          following_shape = false;
+        }
+        if (following_shape) {
+          target = shape;
+        } else {
+          map = handle(TransitionAncestor(*shape, descriptor), isolate());
+        }
+      }
+      // Otherwise check whether there is a single expected transition. If so,
+      // try to parse it first.
+      bool follow_expected = false;
+      if (seq_one_byte && !following_shape) {
         key = TransitionArray::ExpectedTransitionKey(map);
         follow_expected = !key.is_null() && ParseJsonString(key);
       }
-      // If the expected transition hits, follow it.
-      if (follow_expected) {
+      if (following_shape) {
+        // The key of the previous object matched.
+      } else if (follow_expected) {
+        // If the expected transition hits, follow it.
         target = TransitionArray::ExpectedTransitionTarget(map);
       } else {
         // If the expected transition failed, parse an internalized string and
@@ -414,6 +524,9 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
           continue;
         } else {
           transitioning = false;
+          if (following_shape) {
+            map = handle(TransitionAncestor(*shape, descriptor), isolate());
+          }
         }
       }
 
@@ -428,7 +541,13 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
 
     // If we transitioned until the very end, transition the map now.
     if (transitioning) {
+      if (following_shape) {
+        map = handle(TransitionAncestor(*shape, descriptor), isolate());
+      }
       CommitStateToJsonObject(json_object, map, &properties);
+      if (seq_one_byte && depth < kShapeCacheSize) {
+        shape_cache_->set(depth, *map);
+      }
     } else {
       while (MatchSkipWhiteSpace(',')) {
         HandleScope local_scope(isolate());
@@ -469,6 +588,9 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       return ReportUnexpectedCharacter();
     }
   }
+  // A failed parse is abandoned as a whole, so only the successful return
+  // restores the depth.
+  object_depth_--;
   AdvanceSkipWhitespace();
   return scope.CloseAndEscape(json_object);
 }
@@ -806,8 +928,10 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
         position_ = position;
         return Handle<String>::null();
       }
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
+      if (position - position_ < String::kMaxHashCalcLength) {
+        running_hash = StringHasher::AddCharacterCore(
+            running_hash, static_cast<uint16_t>(c0));
+      }
       position++;
       if (position >= source_length_) {
         c0_ = kEndOfString;
@@ -817,9 +941,10 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
       c0 = seq_source_->SeqOneByteStringGet(position);
     } while (c0 != '"');
     int length = position - position_;
-    uint32_t hash = (length <= String::kMaxHashCalcLength)
-                        ? StringHasher::GetHashCore(running_hash)
-                        : static_cast<uint32_t>(length);
+    uint32_t hash =
+        (length <= String::kMaxHashCalcLength)
+            ? StringHasher::GetHashCore(running_hash)
+            : StringHasher::GetLongStringHashCore(running_hash, length);
     Vector<const uint8_t> string_vector(seq_source_->GetChars() + position_,
                                         length);
     StringTable* string_table = isolate()->heap()->string_table();
@@ -836,6 +961,7 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
         break;
       }
       if (!element->IsTheHole(isolate()) &&
+          String::cast(element)->Hash() == hash &&
           String::cast(element)->IsOneByteEqualTo(string_vector)) {
         result = Handle<String>(String::cast(element), isolate());
 #ifdef DEBUG
@@ -855,22 +981,39 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   }
 
   int beg_pos = position_;
-  // Fast case for Latin1 only without escape characters.
-  do {
-    // Check for control character (0x00-0x1f) or unterminated string (<0).
-    if (c0_ < 0x20) return Handle<String>::null();
-    if (c0_ != '\\') {
-      if (seq_one_byte || c0_ <= String::kMaxOneByteCharCode) {
-        Advance();
-      } else {
-        return SlowScanJsonString<SeqTwoByteString, uc16>(source_, beg_pos,
-                                                          position_);
-      }
-    } else {
+  if (seq_one_byte) {
+    // Fast case without escape characters, which finds the end of the
+    // string a word at a time.
+    position_ += JsonStringPlainPrefixLength(
+        seq_source_->GetChars() + position_, source_length_ - position_);
+    if (position_ >= source_length_) {
+      c0_ = kEndOfString;
+      return Handle<String>::null();
+    }
+    c0_ = seq_source_->SeqOneByteStringGet(position_);
+    if (c0_ == '\\') {
       return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+    if (c0_ != '"') return Handle<String>::null();
+  } else {
+    // Fast case for Latin1 only without escape characters.
+    do {
+      // Check for control character (0x00-0x1f) or unterminated string (<0).
+      if (c0_ < 0x20) return Handle<String>::null();
+      if (c0_ != '\\') {
+        if (c0_ <= String::kMaxOneByteCharCode) {
+          Advance();
+        } else {
+          return SlowScanJsonString<SeqTwoByteString, uc16>(source_, beg_pos,
+                                                            position_);
+        }
+      } else {
+        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
+                                                             position_);
+      }
+    } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
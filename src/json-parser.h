@@ -139,6 +139,9 @@ class JsonParser BASE_EMBEDDED {
 
   static const int kInitialSpecialStringLength = 32;
   static const int kPretenureTreshold = 100 * 1024;
+  // Number of object nesting levels for which the shape of the last parsed
+  // object is cached.
+  static const int kShapeCacheSize = 8;
 
  private:
   Zone* zone() { return &zone_; }
@@ -155,6 +158,9 @@ class JsonParser BASE_EMBEDDED {
   Factory* factory_;
   Zone zone_;
   Handle<JSFunction> object_constructor_;
+  // The final map of the last object parsed at each nesting level.
+  Handle<FixedArray> shape_cache_;
+  int object_depth_;
   uc32 c0_;
   int position_;
 };
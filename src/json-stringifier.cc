@@ -13,6 +13,54 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+const uintptr_t kOneBytes = kUintptrAllBitsSet / 0xFF;
+const uintptr_t kHighBits = kOneBytes * 0x80;
+
+// Returns a non-zero value iff a byte in {word} is less than {c}, which must
+// be at most 0x80.
+inline uintptr_t BytesLessThan(uintptr_t word, uint8_t c) {
+  return (word - kOneBytes * c) & ~word & kHighBits;
+}
+
+// Returns a non-zero value iff a byte in {word} is {c}.
+inline uintptr_t BytesEqualTo(uintptr_t word, uint8_t c) {
+  return BytesLessThan(word ^ (kOneBytes * c), 1);
+}
+
+// Returns the number of leading characters in {chars} that are copied
+// unchanged by JsonStringifier::DoNotEscape. Aligned words are checked a
+// word at a time.
+int JsonUnescapedPrefixLength(const uint8_t* chars, int length) {
+  const uint8_t* start = chars;
+  const uint8_t* limit = chars + length;
+  while (chars < limit &&
+         !IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+    uint8_t c = *chars;
+    if (c < '#' || c > '~' || c == '\\') {
+      return static_cast<int>(chars - start);
+    }
+    ++chars;
+  }
+  while (chars + sizeof(uintptr_t) <= limit) {
+    uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+    if (BytesLessThan(word, '#') | (word & kHighBits) |
+        BytesEqualTo(word, '\\') | BytesEqualTo(word, 0x7f)) {
+      break;
+    }
+    chars += sizeof(uintptr_t);
+  }
+  while (chars < limit) {
+    uint8_t c = *chars;
+    if (c < '#' || c > '~' || c == '\\') break;
+    ++chars;
+  }
+  return static_cast<int>(chars - start);
+}
+
+}  // namespace
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -262,9 +310,9 @@ void JsonStringifier::StackPop() {
 }
 
 template <bool deferred_string_key>
-JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
-                                                    bool comma,
-                                                    Handle<Object> key) {
+JsonStringifier::Result JsonStringifier::Serialize_(
+    Handle<Object> object, bool comma, Handle<Object> key,
+    Handle<String> fragment) {
   StackLimitCheck interrupt_check(isolate_);
   Handle<Object> initial_value = object;
   if (interrupt_check.InterruptRequested() &&
@@ -282,50 +330,50 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
   }
 
   if (object->IsSmi()) {
-    if (deferred_string_key) SerializeDeferredKey(comma, key);
+    if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
     return SerializeSmi(Smi::cast(*object));
   }
 
   switch (HeapObject::cast(*object)->map()->instance_type()) {
     case HEAP_NUMBER_TYPE:
     case MUTABLE_HEAP_NUMBER_TYPE:
-      if (deferred_string_key) SerializeDeferredKey(comma, key);
+      if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
       return SerializeHeapNumber(Handle<HeapNumber>::cast(object));
     case ODDBALL_TYPE:
       switch (Oddball::cast(*object)->kind()) {
         case Oddball::kFalse:
-          if (deferred_string_key) SerializeDeferredKey(comma, key);
+          if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
           builder_.AppendCString("false");
           return SUCCESS;
         case Oddball::kTrue:
-          if (deferred_string_key) SerializeDeferredKey(comma, key);
+          if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
           builder_.AppendCString("true");
           return SUCCESS;
         case Oddball::kNull:
-          if (deferred_string_key) SerializeDeferredKey(comma, key);
+          if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
           builder_.AppendCString("null");
           return SUCCESS;
         default:
           return UNCHANGED;
       }
     case JS_ARRAY_TYPE:
-      if (deferred_string_key) SerializeDeferredKey(comma, key);
+      if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
       return SerializeJSArray(Handle<JSArray>::cast(object));
     case JS_VALUE_TYPE:
-      if (deferred_string_key) SerializeDeferredKey(comma, key);
+      if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
       return SerializeJSValue(Handle<JSValue>::cast(object));
     case SYMBOL_TYPE:
       return UNCHANGED;
     default:
       if (object->IsString()) {
-        if (deferred_string_key) SerializeDeferredKey(comma, key);
+        if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
         SerializeString(Handle<String>::cast(object));
         return SUCCESS;
       } else {
         DCHECK(object->IsJSReceiver());
         if (object->IsCallable()) return UNCHANGED;
         // Go to slow path for global proxy and objects requiring access checks.
-        if (deferred_string_key) SerializeDeferredKey(comma, key);
+        if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
         if (object->IsJSProxy()) {
           return SerializeJSProxy(Handle<JSProxy>::cast(object));
         }
@@ -512,6 +560,7 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     DCHECK(!js_obj->HasIndexedInterceptor());
     DCHECK(!js_obj->HasNamedInterceptor());
     Handle<Map> map(js_obj->map());
+    Handle<FixedArray> key_fragments = KeyFragmentsFor(map);
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
@@ -533,7 +582,11 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
             isolate_, property, Object::GetPropertyOrElement(js_obj, key),
             EXCEPTION);
       }
-      Result result = SerializeProperty(property, comma, key);
+      Handle<String> key_fragment;
+      if (!key_fragments.is_null() && key_fragments->get(i)->IsString()) {
+        key_fragment = handle(String::cast(key_fragments->get(i)), isolate_);
+      }
+      Result result = SerializeProperty(property, comma, key, key_fragment);
       if (!comma && result == SUCCESS) comma = true;
       if (result == EXCEPTION) return result;
     }
@@ -622,6 +675,14 @@ void JsonStringifier::SerializeStringUnchecked_(
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
   for (int i = 0; i < src.length(); i++) {
+    if (sizeof(SrcChar) == 1) {
+      // Copy runs of characters that need no escaping in one go.
+      int run = JsonUnescapedPrefixLength(
+          reinterpret_cast<const uint8_t*>(src.start() + i), src.length() - i);
+      dest->AppendChars(src.start() + i, run);
+      i += run;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
@@ -683,13 +744,114 @@ void JsonStringifier::Separator(bool first) {
 }
 
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
-                                           Handle<Object> deferred_key) {
+                                           Handle<Object> deferred_key,
+                                           Handle<String> key_fragment) {
   Separator(!deferred_comma);
+  if (!key_fragment.is_null()) {
+    AppendKeyFragment(key_fragment);
+    return;
+  }
   SerializeString(Handle<String>::cast(deferred_key));
   builder_.AppendCharacter(':');
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
 
+Handle<FixedArray> JsonStringifier::KeyFragmentsFor(Handle<Map> map) {
+  if (key_fragment_cache_.is_null()) {
+    key_fragment_cache_ = factory()->NewFixedArray(2 * kKeyFragmentCacheSize);
+  }
+  int index = 2 * (ComputePointerHash(*map) & (kKeyFragmentCacheSize - 1));
+  if (key_fragment_cache_->get(index) == *map) {
+    Object* fragments = key_fragment_cache_->get(index + 1);
+    if (fragments->IsFixedArray()) {
+      return handle(FixedArray::cast(fragments), isolate_);
+    }
+  } else {
+    // Remember the map, and build its key fragments when it is seen again.
+    key_fragment_cache_->set(index, *map);
+    key_fragment_cache_->set(index + 1, Smi::kZero);
+    return Handle<FixedArray>();
+  }
+
+  int length = map->NumberOfOwnDescriptors();
+  Handle<FixedArray> fragments = factory()->NewFixedArray(length);
+  for (int i = 0; i < length; i++) {
+    Object* name = map->instance_descriptors()->GetKey(i);
+    if (!name->IsString()) continue;
+    Handle<String> fragment;
+    if (MakeKeyFragment(handle(String::cast(name), isolate_))
+            .ToHandle(&fragment)) {
+      fragments->set(i, *fragment);
+    }
+  }
+  key_fragment_cache_->set(index + 1, *fragments);
+  return fragments;
+}
+
+MaybeHandle<String> JsonStringifier::MakeKeyFragment(Handle<String> key) {
+  key = String::Flatten(key);
+  if (key->length() > kMaxKeyFragmentLength) return MaybeHandle<String>();
+  // The quotes, the colon and the space after it, if any.
+  int length = gap_ != nullptr ? 4 : 3;
+  {
+    DisallowHeapAllocation no_gc;
+    String::FlatContent content = key->GetFlatContent();
+    if (!content.IsOneByte()) return MaybeHandle<String>();
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    for (int i = 0; i < chars.length(); i++) {
+      uint8_t c = chars[i];
+      length += DoNotEscape(c) ? 1
+                               : StrLength(&JsonEscapeTable
+                                               [c * kJsonEscapeTableEntrySize]);
+    }
+  }
+  Handle<SeqOneByteString> fragment =
+      factory()->NewRawOneByteString(length).ToHandleChecked();
+  DisallowHeapAllocation no_gc;
+  Vector<const uint8_t> chars = key->GetFlatContent().ToOneByteVector();
+  uint8_t* dest = fragment->GetChars();
+  *dest++ = '"';
+  for (int i = 0; i < chars.length(); i++) {
+    uint8_t c = chars[i];
+    if (DoNotEscape(c)) {
+      *dest++ = c;
+    } else {
+      for (const char* escape = &JsonEscapeTable[c * kJsonEscapeTableEntrySize];
+           *escape != '\0'; escape++) {
+        *dest++ = *escape;
+      }
+    }
+  }
+  *dest++ = '"';
+  *dest++ = ':';
+  if (gap_ != nullptr) *dest++ = ' ';
+  DCHECK_EQ(fragment->GetChars() + length, dest);
+  return fragment;
+}
+
+void JsonStringifier::AppendKeyFragment(Handle<String> fragment) {
+  DCHECK(fragment->IsSeqOneByteString());
+  int length = fragment->length();
+  if (builder_.CurrentPartCanFit(length)) {
+    DisallowHeapAllocation no_gc;
+    const uint8_t* chars = SeqOneByteString::cast(*fragment)->GetChars();
+    if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
+      IncrementalStringBuilder::NoExtendBuilder<uint8_t> no_extend(&builder_,
+                                                                   length);
+      no_extend.AppendChars(chars, length);
+    } else {
+      IncrementalStringBuilder::NoExtendBuilder<uc16> no_extend(&builder_,
+                                                                length);
+      no_extend.AppendChars(chars, length);
+    }
+  } else {
+    for (int i = 0; i < length; i++) {
+      builder_.AppendCharacter(
+          SeqOneByteString::cast(*fragment)->SeqOneByteStringGet(i));
+    }
+  }
+}
+
 void JsonStringifier::SerializeString(Handle<String> object) {
   object = String::Flatten(object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
@@ -51,18 +51,32 @@ class JsonStringifier BASE_EMBEDDED {
   // Serialize a object property.
   // The key may or may not be serialized depending on the property.
   // The key may also serve as argument for the toJSON function.
+  // If given, {key_fragment} is the serialized key, see KeyFragmentsFor.
   INLINE(Result SerializeProperty(Handle<Object> object,
                                   bool deferred_comma,
-                                  Handle<String> deferred_key)) {
+                                  Handle<String> deferred_key,
+                                  Handle<String> key_fragment =
+                                      Handle<String>())) {
     DCHECK(!deferred_key.is_null());
-    return Serialize_<true>(object, deferred_comma, deferred_key);
+    return Serialize_<true>(object, deferred_comma, deferred_key,
+                            key_fragment);
   }
 
   template <bool deferred_string_key>
-  Result Serialize_(Handle<Object> object, bool comma, Handle<Object> key);
+  Result Serialize_(Handle<Object> object, bool comma, Handle<Object> key,
+                    Handle<String> fragment = Handle<String>());
 
   INLINE(void SerializeDeferredKey(bool deferred_comma,
-                                   Handle<Object> deferred_key));
+                                   Handle<Object> deferred_key,
+                                   Handle<String> key_fragment));
+
+  // Returns the serialized keys of the own descriptors of {map}, i.e. the
+  // escaped and quoted key followed by the colon, as one-byte strings, or
+  // undefined for the keys that are not cached. Returns a null handle the
+  // first time a map is seen, so that maps of single objects are not cached.
+  Handle<FixedArray> KeyFragmentsFor(Handle<Map> map);
+  MaybeHandle<String> MakeKeyFragment(Handle<String> key);
+  void AppendKeyFragment(Handle<String> fragment);
 
   Result SerializeSmi(Smi* object);
 
@@ -112,10 +126,15 @@ class JsonStringifier BASE_EMBEDDED {
   Handle<String> tojson_string_;
   Handle<JSArray> stack_;
   Handle<FixedArray> property_list_;
+  // Direct-mapped cache of map and key fragments pairs.
+  Handle<FixedArray> key_fragment_cache_;
   Handle<JSReceiver> replacer_function_;
   uc16* gap_;
   int indent_;
 
+  static const int kKeyFragmentCacheSize = 64;
+  static const int kMaxKeyFragmentLength = 128;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
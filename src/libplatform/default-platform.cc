@@ -31,12 +31,14 @@ void PrintStackTrace() {
 
 v8::Platform* CreateDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
-    InProcessStackDumping in_process_stack_dumping) {
+    InProcessStackDumping in_process_stack_dumping,
+    const WorkerThreadOptions& worker_thread_options) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   DefaultPlatform* platform = new DefaultPlatform(idle_task_support);
   platform->SetThreadPoolSize(thread_pool_size);
+  platform->SetWorkerThreadOptions(worker_thread_options);
   platform->EnsureInitialized();
   return platform;
 }
@@ -67,10 +69,28 @@ void SetTracingController(
 
 const int DefaultPlatform::kMaxThreadPoolSize = 8;
 
+namespace {
+
+TaskQueue::Priority PriorityFromExpectedRuntime(
+    Platform::ExpectedRuntime expected_runtime) {
+  switch (expected_runtime) {
+    case Platform::kShortRunningTask:
+      return TaskQueue::Priority::kHigh;
+    case Platform::kLongRunningTask:
+      return TaskQueue::Priority::kNormal;
+    case Platform::kBestEffortTask:
+      return TaskQueue::Priority::kLow;
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
 DefaultPlatform::DefaultPlatform(IdleTaskSupport idle_task_support)
     : initialized_(false),
       thread_pool_size_(0),
-      idle_task_support_(idle_task_support) {}
+      idle_task_support_(idle_task_support),
+      delayed_queue_(&queue_) {}
 
 DefaultPlatform::~DefaultPlatform() {
   if (tracing_controller_) {
@@ -79,6 +99,9 @@ DefaultPlatform::~DefaultPlatform() {
   }
 
   base::LockGuard<base::Mutex> guard(&lock_);
+  // The delayed task queue appends to |queue_|, so stop it first.
+  delayed_queue_.Terminate();
+  if (initialized_) delayed_queue_.Join();
   queue_.Terminate();
   if (initialized_) {
     for (auto i = thread_pool_.begin(); i != thread_pool_.end(); ++i) {
@@ -119,13 +142,30 @@ void DefaultPlatform::SetThreadPoolSize(int thread_pool_size) {
 }
 
 
+void DefaultPlatform::SetWorkerThreadOptions(
+    const WorkerThreadOptions& options) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  DCHECK(!initialized_);
+  worker_thread_options_ = options;
+  // Keep a copy of the prefix, the workers are only started on first use.
+  worker_thread_name_prefix_ = options.name_prefix;
+  worker_thread_options_.name_prefix = nullptr;
+}
+
+
 void DefaultPlatform::EnsureInitialized() {
   base::LockGuard<base::Mutex> guard(&lock_);
   if (initialized_) return;
   initialized_ = true;
 
-  for (int i = 0; i < thread_pool_size_; ++i)
-    thread_pool_.push_back(new WorkerThread(&queue_));
+  for (int i = 0; i < thread_pool_size_; ++i) {
+    char name[base::Thread::kMaxThreadNameLength];
+    snprintf(name, sizeof(name), "%s %d", worker_thread_name_prefix_.c_str(),
+             i + 1);
+    thread_pool_.push_back(
+        new WorkerThread(&queue_, name, worker_thread_options_));
+  }
+  delayed_queue_.Start();
 }
 
 
@@ -232,7 +272,23 @@ void DefaultPlatform::RunIdleTasks(v8::Isolate* isolate,
 void DefaultPlatform::CallOnBackgroundThread(Task* task,
                                              ExpectedRuntime expected_runtime) {
   EnsureInitialized();
-  queue_.Append(task);
+  queue_.Append(task, PriorityFromExpectedRuntime(expected_runtime));
+}
+
+void DefaultPlatform::CallDelayedOnBackgroundThread(
+    Task* task, ExpectedRuntime expected_runtime, double delay_in_seconds) {
+  EnsureInitialized();
+  delayed_queue_.Append(
+      task, PriorityFromExpectedRuntime(expected_runtime),
+      base::TimeDelta::FromMicroseconds(static_cast<int64_t>(
+          delay_in_seconds * base::Time::kMicrosecondsPerSecond)));
+}
+
+bool DefaultPlatform::DelayedBackgroundTasksEnabled() { return true; }
+
+TaskQueue::WaitStatistics DefaultPlatform::GetBackgroundTaskWaitStatistics(
+    TaskQueue::Priority priority) {
+  return queue_.GetWaitStatistics(priority);
 }
 
 void DefaultPlatform::ScheduleOnForegroundThread(v8::Isolate* isolate,
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <queue>
+#include <string>
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
@@ -18,6 +19,7 @@
 #include "src/base/compiler-specific.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
+#include "src/libplatform/delayed-task-queue.h"
 #include "src/libplatform/task-queue.h"
 
 namespace v8 {
@@ -39,6 +41,9 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void SetThreadPoolSize(int thread_pool_size);
 
+  // Has to be called before the worker threads are started.
+  void SetWorkerThreadOptions(const WorkerThreadOptions& options);
+
   void EnsureInitialized();
 
   bool PumpMessageLoop(
@@ -48,10 +53,19 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void RunIdleTasks(v8::Isolate* isolate, double idle_time_in_seconds);
 
+  // Returns how long background tasks of the given priority waited before
+  // a worker thread picked them up.
+  TaskQueue::WaitStatistics GetBackgroundTaskWaitStatistics(
+      TaskQueue::Priority priority);
+
   // v8::Platform implementation.
   size_t NumberOfAvailableBackgroundThreads() override;
   void CallOnBackgroundThread(Task* task,
                               ExpectedRuntime expected_runtime) override;
+  void CallDelayedOnBackgroundThread(Task* task,
+                                     ExpectedRuntime expected_runtime,
+                                     double delay_in_seconds) override;
+  bool DelayedBackgroundTasksEnabled() override;
   void CallOnForegroundThread(v8::Isolate* isolate, Task* task) override;
   void CallDelayedOnForegroundThread(Isolate* isolate, Task* task,
                                      double delay_in_seconds) override;
@@ -93,7 +107,10 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   int thread_pool_size_;
   IdleTaskSupport idle_task_support_;
   std::vector<WorkerThread*> thread_pool_;
+  WorkerThreadOptions worker_thread_options_;
+  std::string worker_thread_name_prefix_;
   TaskQueue queue_;
+  DelayedTaskQueue delayed_queue_;
   std::map<v8::Isolate*, std::queue<Task*>> main_thread_queue_;
   std::map<v8::Isolate*, std::queue<IdleTask*>> main_thread_idle_queue_;
   std::map<v8::Isolate*, std::unique_ptr<base::Semaphore>> event_loop_control_;
@@ -0,0 +1,67 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/delayed-task-queue.h"
+
+#include "include/v8-platform.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace platform {
+
+DelayedTaskQueue::DelayedTaskQueue(TaskQueue* queue)
+    : Thread(Options("V8 DelayedTaskQueue")),
+      queue_(queue),
+      next_sequence_(0),
+      terminated_(false) {}
+
+DelayedTaskQueue::~DelayedTaskQueue() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  DCHECK(terminated_);
+  while (!tasks_.empty()) {
+    delete tasks_.top().task;
+    tasks_.pop();
+  }
+}
+
+void DelayedTaskQueue::Append(Task* task, TaskQueue::Priority priority,
+                              base::TimeDelta delay) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  DCHECK(!terminated_);
+  tasks_.push({base::TimeTicks::Now() + delay, next_sequence_++, task,
+               priority});
+  changed_.NotifyOne();
+}
+
+void DelayedTaskQueue::Terminate() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  terminated_ = true;
+  changed_.NotifyOne();
+}
+
+size_t DelayedTaskQueue::PendingTasksForTesting() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  return tasks_.size();
+}
+
+void DelayedTaskQueue::Run() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  while (!terminated_) {
+    base::TimeTicks now = base::TimeTicks::Now();
+    while (!tasks_.empty() && tasks_.top().deadline <= now) {
+      queue_->Append(tasks_.top().task, tasks_.top().priority);
+      tasks_.pop();
+    }
+    if (tasks_.empty()) {
+      changed_.Wait(&lock_);
+    } else {
+      // Spurious wakeups and timeouts are both handled by the loop.
+      bool notified = changed_.WaitFor(&lock_, tasks_.top().deadline - now);
+      USE(notified);
+    }
+  }
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,74 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
+#define V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
+
+#include <queue>
+#include <vector>
+
+#include "include/libplatform/libplatform-export.h"
+#include "src/base/compiler-specific.h"
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/libplatform/task-queue.h"
+
+namespace v8 {
+
+class Task;
+
+namespace platform {
+
+// Holds delayed background tasks and moves them to a TaskQueue once they are
+// due. The thread only wakes up when the earliest deadline is reached or a
+// new task is posted, so there are no periodic wakeups while idle.
+class V8_PLATFORM_EXPORT DelayedTaskQueue
+    : public NON_EXPORTED_BASE(base::Thread) {
+ public:
+  explicit DelayedTaskQueue(TaskQueue* queue);
+  virtual ~DelayedTaskQueue();
+
+  // Appends |task| to the task queue once |delay| has passed. The queue takes
+  // ownership of |task|.
+  void Append(Task* task, TaskQueue::Priority priority, base::TimeDelta delay);
+
+  // Stops the thread. Tasks that are not due yet are deleted without running.
+  void Terminate();
+
+  size_t PendingTasksForTesting();
+
+  // Thread implementation.
+  void Run() override;
+
+ private:
+  struct Entry {
+    base::TimeTicks deadline;
+    // Keeps tasks with the same deadline in posting order.
+    uint64_t sequence;
+    Task* task;
+    TaskQueue::Priority priority;
+
+    bool operator>(const Entry& other) const {
+      if (deadline != other.deadline) return deadline > other.deadline;
+      return sequence > other.sequence;
+    }
+  };
+
+  TaskQueue* queue_;
+  base::Mutex lock_;
+  base::ConditionVariable changed_;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> tasks_;
+  uint64_t next_sequence_;
+  bool terminated_;
+
+  DISALLOW_COPY_AND_ASSIGN(DelayedTaskQueue);
+};
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
@@ -5,62 +5,140 @@
 #include "src/libplatform/task-queue.h"
 
 #include "src/base/logging.h"
-#include "src/base/platform/platform.h"
-#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace platform {
 
-TaskQueue::TaskQueue() : process_queue_semaphore_(0), terminated_(false) {}
+const int TaskQueue::kNumberOfPriorities;
+const int TaskQueue::kMaxWorkers;
+
+TaskQueue::TaskQueue()
+    : process_queue_semaphore_(0),
+      current_deque_key_(base::Thread::CreateThreadLocalKey()),
+      terminated_(false) {}
 
 
 TaskQueue::~TaskQueue() {
-  base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+  DCHECK(terminated_.Value());
+  for (WorkerDeque& deque : deques_) {
+    base::LockGuard<base::Mutex> guard(&deque.lock);
+    for (const std::deque<Entry>& tasks : deque.tasks) {
+      DCHECK(tasks.empty());
+      USE(tasks);
+    }
+  }
+  base::Thread::DeleteThreadLocalKey(current_deque_key_);
 }
 
 
-void TaskQueue::Append(Task* task) {
-  base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(task);
+void TaskQueue::Append(Task* task, Priority priority) {
+  DCHECK(!terminated_.Value());
+  int deque = CurrentDeque();
+  int workers = worker_count_.Value();
+  if (deque == 0 && workers > 0) {
+    deque = 1 + static_cast<int>(next_deque_.Increment(1) % workers);
+  }
+  {
+    base::LockGuard<base::Mutex> guard(&deques_[deque].lock);
+    deques_[deque].tasks[static_cast<int>(priority)].push_back(
+        {task, base::TimeTicks::Now()});
+  }
   process_queue_semaphore_.Signal();
 }
 
 
 Task* TaskQueue::GetNext() {
+  const int own_deque = CurrentDeque();
+  process_queue_semaphore_.Wait();
   for (;;) {
-    {
-      base::LockGuard<base::Mutex> guard(&lock_);
-      if (!task_queue_.empty()) {
-        Task* result = task_queue_.front();
-        task_queue_.pop();
-        return result;
-      }
-      if (terminated_) {
-        process_queue_semaphore_.Signal();
-        return NULL;
-      }
+    // Every successful wait corresponds to a task, but another worker may
+    // have taken it from a deque that was already visited. Retry until one
+    // is found.
+    if (Task* task = TryGetNext(own_deque)) return task;
+    if (terminated_.Value()) {
+      process_queue_semaphore_.Signal();
+      return NULL;
     }
-    process_queue_semaphore_.Wait();
   }
 }
 
 
 void TaskQueue::Terminate() {
-  base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(!terminated_);
-  terminated_ = true;
+  DCHECK(!terminated_.Value());
+  terminated_.SetValue(true);
   process_queue_semaphore_.Signal();
 }
 
+int TaskQueue::RegisterWorker() {
+  int worker = worker_count_.Increment(1);
+  CHECK_LE(worker, kMaxWorkers);
+  return worker;
+}
+
+void TaskQueue::BindWorkerToCurrentThread(int worker) {
+  DCHECK_LT(0, worker);
+  DCHECK_LE(worker, worker_count_.Value());
+  base::Thread::SetThreadLocalInt(current_deque_key_, worker);
+}
+
+TaskQueue::WaitStatistics TaskQueue::GetWaitStatistics(Priority priority) {
+  WaitStatistics result;
+  for (WorkerDeque& deque : deques_) {
+    base::LockGuard<base::Mutex> guard(&deque.lock);
+    const WaitStatistics& statistics =
+        deque.statistics[static_cast<int>(priority)];
+    result.task_count += statistics.task_count;
+    result.total_wait_time += statistics.total_wait_time;
+    if (statistics.max_wait_time > result.max_wait_time) {
+      result.max_wait_time = statistics.max_wait_time;
+    }
+  }
+  return result;
+}
+
+int TaskQueue::CurrentDeque() {
+  return base::Thread::GetThreadLocalInt(current_deque_key_);
+}
+
+Task* TaskQueue::TryPop(int deque, int priority) {
+  WorkerDeque& worker_deque = deques_[deque];
+  base::LockGuard<base::Mutex> guard(&worker_deque.lock);
+  std::deque<Entry>& tasks = worker_deque.tasks[priority];
+  if (tasks.empty()) return NULL;
+  Entry entry = tasks.front();
+  tasks.pop_front();
+  base::TimeDelta wait_time = base::TimeTicks::Now() - entry.append_time;
+  WaitStatistics& statistics = worker_deque.statistics[priority];
+  statistics.task_count++;
+  statistics.total_wait_time += wait_time;
+  if (wait_time > statistics.max_wait_time) {
+    statistics.max_wait_time = wait_time;
+  }
+  return entry.task;
+}
+
+Task* TaskQueue::TryGetNext(int own_deque) {
+  const int deque_count = worker_count_.Value() + 1;
+  for (int priority = 0; priority < kNumberOfPriorities; priority++) {
+    // Start with the own deque, then steal from the others.
+    for (int i = 0; i < deque_count; i++) {
+      int deque = (own_deque + i) % deque_count;
+      if (Task* task = TryPop(deque, priority)) return task;
+    }
+  }
+  return NULL;
+}
+
 void TaskQueue::BlockUntilQueueEmptyForTesting() {
   for (;;) {
-    {
-      base::LockGuard<base::Mutex> guard(&lock_);
-      if (task_queue_.empty()) return;
+    bool empty = true;
+    for (WorkerDeque& deque : deques_) {
+      base::LockGuard<base::Mutex> guard(&deque.lock);
+      for (const std::deque<Entry>& tasks : deque.tasks) {
+        if (!tasks.empty()) empty = false;
+      }
     }
+    if (empty) return;
     base::OS::Sleep(base::TimeDelta::FromMilliseconds(5));
   }
 }
@@ -5,12 +5,15 @@
 #ifndef V8_LIBPLATFORM_TASK_QUEUE_H_
 #define V8_LIBPLATFORM_TASK_QUEUE_H_
 
-#include <queue>
+#include <deque>
 
 #include "include/libplatform/libplatform-export.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
@@ -19,13 +22,31 @@ class Task;
 
 namespace platform {
 
+// A queue of background tasks with a separate deque per worker thread. Tasks
+// posted from a worker go to its own deque, tasks posted from other threads
+// are spread over the workers. An idle worker steals from the other deques,
+// always taking the task with the highest priority that is available.
 class V8_PLATFORM_EXPORT TaskQueue {
  public:
+  enum class Priority { kHigh, kNormal, kLow };
+  static const int kNumberOfPriorities = 3;
+
+  // The maximum number of worker threads that can be registered.
+  static const int kMaxWorkers = 16;
+
+  // Time spent by tasks between being appended and being handed out.
+  struct WaitStatistics {
+    WaitStatistics() : task_count(0) {}
+    size_t task_count;
+    base::TimeDelta total_wait_time;
+    base::TimeDelta max_wait_time;
+  };
+
   TaskQueue();
   ~TaskQueue();
 
   // Appends a task to the queue. The queue takes ownership of |task|.
-  void Append(Task* task);
+  void Append(Task* task, Priority priority = Priority::kNormal);
 
   // Returns the next task to process. Blocks if no task is available. Returns
   // NULL if the queue is terminated.
@@ -34,15 +55,42 @@ class V8_PLATFORM_EXPORT TaskQueue {
   // Terminate the queue.
   void Terminate();
 
+  // Allocates a deque for a new worker thread and returns its index, which the
+  // worker passes to BindWorkerToCurrentThread when it starts running.
+  int RegisterWorker();
+  void BindWorkerToCurrentThread(int worker);
+
+  WaitStatistics GetWaitStatistics(Priority priority);
+
  private:
   FRIEND_TEST(WorkerThreadTest, PostSingleTask);
+  FRIEND_TEST(WorkerThreadTest, StealTasks);
+
+  struct Entry {
+    Task* task;
+    base::TimeTicks append_time;
+  };
+
+  // Deque 0 is used when there are no workers, deques 1 to kMaxWorkers belong
+  // to the registered workers.
+  struct WorkerDeque {
+    base::Mutex lock;
+    std::deque<Entry> tasks[kNumberOfPriorities];
+    WaitStatistics statistics[kNumberOfPriorities];
+  };
+
+  int CurrentDeque();
+  Task* TryPop(int deque, int priority);
+  Task* TryGetNext(int own_deque);
 
   void BlockUntilQueueEmptyForTesting();
 
   base::Semaphore process_queue_semaphore_;
-  base::Mutex lock_;
-  std::queue<Task*> task_queue_;
-  bool terminated_;
+  base::Thread::LocalStorageKey current_deque_key_;
+  base::AtomicNumber<int> worker_count_;
+  base::AtomicNumber<size_t> next_deque_;
+  base::AtomicValue<bool> terminated_;
+  WorkerDeque deques_[kMaxWorkers + 1];
 
   DISALLOW_COPY_AND_ASSIGN(TaskQueue);
 };
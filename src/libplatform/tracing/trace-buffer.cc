@@ -4,43 +4,101 @@
 
 #include "src/libplatform/tracing/trace-buffer.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace platform {
 namespace tracing {
 
 TraceBufferRingBuffer::TraceBufferRingBuffer(size_t max_chunks,
                                              TraceWriter* trace_writer)
-    : max_chunks_(max_chunks) {
+    : max_chunks_(max_chunks),
+      thread_chunk_key_(base::Thread::CreateThreadLocalKey()) {
   trace_writer_.reset(trace_writer);
-  chunks_.resize(max_chunks);
+  chunks_.resize(max_chunks + kOverflowChunks);
+  chunk_in_use_.resize(max_chunks + kOverflowChunks);
+}
+
+TraceBufferRingBuffer::~TraceBufferRingBuffer() {
+  base::Thread::DeleteThreadLocalKey(thread_chunk_key_);
+}
+
+TraceBufferRingBuffer::ThreadChunk* TraceBufferRingBuffer::GetThreadChunk() {
+  ThreadChunk* thread_chunk = reinterpret_cast<ThreadChunk*>(
+      base::Thread::GetThreadLocal(thread_chunk_key_));
+  if (thread_chunk == nullptr) {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    thread_chunk = new ThreadChunk();
+    thread_chunks_.emplace_back(thread_chunk);
+    base::Thread::SetThreadLocal(thread_chunk_key_, thread_chunk);
+  }
+  return thread_chunk;
 }
 
-TraceBufferRingBuffer::~TraceBufferRingBuffer() {}
+bool TraceBufferRingBuffer::IsValid(const ThreadChunk* thread_chunk) const {
+  return thread_chunk->chunk != nullptr &&
+         thread_chunk->generation == base::Acquire_Load(&generation_);
+}
+
+bool TraceBufferRingBuffer::AcquireChunk(ThreadChunk* thread_chunk) {
+  if (IsValid(thread_chunk)) chunk_in_use_[thread_chunk->chunk_index] = false;
+  thread_chunk->chunk = nullptr;
+  size_t index = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
+  for (size_t i = 0; i < max_chunks_ && chunk_in_use_[index]; ++i) {
+    index = NextChunkIndex(index);
+  }
+  if (chunk_in_use_[index]) {
+    index = max_chunks_;
+    while (index < chunks_.size() && chunk_in_use_[index]) ++index;
+    if (index == chunks_.size()) return false;
+  } else {
+    chunk_index_ = index;
+  }
+  is_empty_ = false;
+  auto& chunk = chunks_[index];
+  if (chunk) {
+    chunk->Reset(current_chunk_seq_++);
+  } else {
+    chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
+  }
+  chunk_in_use_[index] = true;
+  thread_chunk->chunk = chunk.get();
+  thread_chunk->chunk_index = index;
+  thread_chunk->generation = generation_;
+  return true;
+}
 
 TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
-  base::LockGuard<base::Mutex> guard(&mutex_);
-  if (is_empty_ || chunks_[chunk_index_]->IsFull()) {
-    chunk_index_ = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
-    is_empty_ = false;
-    auto& chunk = chunks_[chunk_index_];
-    if (chunk) {
-      chunk->Reset(current_chunk_seq_++);
-    } else {
-      chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
+  ThreadChunk* thread_chunk = GetThreadChunk();
+  if (!IsValid(thread_chunk) || thread_chunk->chunk->IsFull()) {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (!AcquireChunk(thread_chunk)) {
+      // Sequence numbers start at 1, so 0 is never a valid handle.
+      *handle = 0;
+      return NULL;
     }
   }
-  auto& chunk = chunks_[chunk_index_];
+  TraceBufferChunk* chunk = thread_chunk->chunk;
   size_t event_index;
   TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(chunk_index_, chunk->seq(), event_index);
+  *handle = MakeHandle(thread_chunk->chunk_index, chunk->seq(), event_index);
   return trace_object;
 }
 
 TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
-  base::LockGuard<base::Mutex> guard(&mutex_);
   size_t chunk_index, event_index;
   uint32_t chunk_seq;
   ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
+  // Events are usually updated by the thread that added them, while it is
+  // still appending to the same chunk.
+  ThreadChunk* thread_chunk = reinterpret_cast<ThreadChunk*>(
+      base::Thread::GetThreadLocal(thread_chunk_key_));
+  if (thread_chunk != nullptr && IsValid(thread_chunk) &&
+      thread_chunk->chunk_index == chunk_index &&
+      thread_chunk->chunk->seq() == chunk_seq) {
+    return thread_chunk->chunk->GetEventAt(event_index);
+  }
+  base::LockGuard<base::Mutex> guard(&mutex_);
   if (chunk_index >= chunks_.size()) return NULL;
   auto& chunk = chunks_[chunk_index];
   if (!chunk || chunk->seq() != chunk_seq) return NULL;
@@ -59,10 +117,23 @@ bool TraceBufferRingBuffer::Flush() {
       }
       if (i == chunk_index_) break;
     }
+    for (size_t i = max_chunks_; i < chunks_.size(); ++i) {
+      if (auto& chunk = chunks_[i]) {
+        for (size_t j = 0; j < chunk->size(); ++j) {
+          trace_writer_->AppendTraceEvent(chunk->GetEventAt(j));
+        }
+        // Overflow chunks are not part of the ring, empty them so that their
+        // events are not written again.
+        chunk->Reset(0);
+      }
+    }
   }
   trace_writer_->Flush();
-  // This resets the trace buffer.
+  // This resets the trace buffer. Threads notice the new generation and
+  // acquire a new chunk on their next event.
   is_empty_ = true;
+  std::fill(chunk_in_use_.begin(), chunk_in_use_.end(), false);
+  base::Release_Store(&generation_, generation_ + 1);
   return true;
 }
 
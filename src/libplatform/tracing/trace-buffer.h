@@ -9,12 +9,17 @@
 #include <vector>
 
 #include "include/libplatform/v8-tracing.h"
+#include "src/base/atomicops.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 
 namespace v8 {
 namespace platform {
 namespace tracing {
 
+// Each thread appends to a chunk of its own, so the mutex is only taken once
+// per TraceBufferChunk::kChunkSize events. Full chunks stay in the ring until
+// they are written out by Flush or reused for new events.
 class TraceBufferRingBuffer : public TraceBuffer {
  public:
   TraceBufferRingBuffer(size_t max_chunks, TraceWriter* trace_writer);
@@ -25,20 +30,46 @@ class TraceBufferRingBuffer : public TraceBuffer {
   bool Flush() override;
 
  private:
+  // The chunk a thread is currently appending to. It is only valid while
+  // |generation| matches the generation of the buffer, which changes on Flush.
+  struct ThreadChunk {
+    TraceBufferChunk* chunk = nullptr;
+    size_t chunk_index = 0;
+    base::Atomic32 generation = 0;
+  };
+
+  ThreadChunk* GetThreadChunk();
+  bool IsValid(const ThreadChunk* thread_chunk) const;
+  // Hands the next chunk that is not in use to |thread_chunk|. Returns false
+  // if all chunks are in use by other threads. Has to be called with |mutex_|
+  // held.
+  bool AcquireChunk(ThreadChunk* thread_chunk);
+
   uint64_t MakeHandle(size_t chunk_index, uint32_t chunk_seq,
                       size_t event_index) const;
   void ExtractHandle(uint64_t handle, size_t* chunk_index, uint32_t* chunk_seq,
                      size_t* event_index) const;
-  size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
+  size_t Capacity() const {
+    return (max_chunks_ + kOverflowChunks) * TraceBufferChunk::kChunkSize;
+  }
   size_t NextChunkIndex(size_t index) const;
 
+  // Chunks outside of the ring, used when every chunk of the ring is in use by
+  // another thread.
+  static const size_t kOverflowChunks = 16;
+
   mutable base::Mutex mutex_;
   size_t max_chunks_;
   std::unique_ptr<TraceWriter> trace_writer_;
   std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
+  // Whether a thread is currently appending to the chunk.
+  std::vector<bool> chunk_in_use_;
   size_t chunk_index_;
   bool is_empty_ = true;
   uint32_t current_chunk_seq_ = 1;
+  base::Atomic32 generation_ = 1;
+  base::Thread::LocalStorageKey thread_chunk_key_;
+  std::vector<std::unique_ptr<ThreadChunk>> thread_chunks_;
 };
 
 }  // namespace tracing
@@ -171,6 +171,189 @@ TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream& stream) {
   return new JSONTraceWriter(stream);
 }
 
+class BinaryTraceWriter::WriterThread : public base::Thread {
+ public:
+  explicit WriterThread(BinaryTraceWriter* writer)
+      : base::Thread(Options("V8 TraceWriter")), writer_(writer) {}
+
+  void Run() override { writer_->WriteBlocks(); }
+
+ private:
+  BinaryTraceWriter* writer_;
+};
+
+BinaryTraceWriter::BinaryTraceWriter(std::ostream& stream)
+    : stream_(stream), writer_thread_(new WriterThread(this)) {
+  buffer_.reserve(kBlockSize);
+  buffer_.append("V8TB");
+  WriteByte(kVersion);
+  writer_thread_->Start();
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() {
+  Flush();
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    terminated_ = true;
+    cv_.NotifyAll();
+  }
+  writer_thread_->Join();
+}
+
+void BinaryTraceWriter::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    WriteByte(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  WriteByte(static_cast<uint8_t>(value));
+}
+
+void BinaryTraceWriter::WriteSignedVarint(int64_t value) {
+  WriteVarint((static_cast<uint64_t>(value) << 1) ^
+              static_cast<uint64_t>(value >> 63));
+}
+
+uint64_t BinaryTraceWriter::InternString(const char* str) {
+  if (str == nullptr) return 0;
+  auto result = strings_.emplace(str, strings_.size() + 1);
+  if (result.second) {
+    size_t length = strlen(str);
+    WriteByte(kStringRecord);
+    WriteVarint(result.first->second);
+    WriteVarint(length);
+    buffer_.append(str, length);
+  }
+  return result.first->second;
+}
+
+void BinaryTraceWriter::AppendArgValue(uint8_t type,
+                                       TraceObject::ArgValue value) {
+  switch (type) {
+    case TRACE_VALUE_TYPE_BOOL:
+      WriteByte(value.as_bool ? 1 : 0);
+      break;
+    case TRACE_VALUE_TYPE_UINT:
+      WriteVarint(value.as_uint);
+      break;
+    case TRACE_VALUE_TYPE_INT:
+      WriteSignedVarint(value.as_int);
+      break;
+    case TRACE_VALUE_TYPE_DOUBLE: {
+      uint64_t bits;
+      memcpy(&bits, &value.as_double, sizeof(bits));
+      for (int i = 0; i < 8; ++i) {
+        WriteByte(static_cast<uint8_t>(bits >> (i * 8)));
+      }
+      break;
+    }
+    case TRACE_VALUE_TYPE_POINTER:
+      WriteVarint(reinterpret_cast<uintptr_t>(value.as_pointer));
+      break;
+    case TRACE_VALUE_TYPE_STRING:
+    case TRACE_VALUE_TYPE_COPY_STRING:
+      // The string records have been written before the event record.
+      WriteVarint(value.as_string == nullptr
+                      ? 0
+                      : strings_.find(value.as_string)->second);
+      break;
+    default:
+      UNREACHABLE();
+      break;
+  }
+}
+
+void BinaryTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  // String records have to precede the event record referring to them.
+  uint64_t category_id = InternString(TracingController::GetCategoryGroupName(
+      trace_event->category_enabled_flag()));
+  uint64_t name_id = InternString(trace_event->name());
+  bool has_id = trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID;
+  uint64_t scope_id = has_id ? InternString(trace_event->scope()) : 0;
+  const char** arg_names = trace_event->arg_names();
+  const uint8_t* arg_types = trace_event->arg_types();
+  TraceObject::ArgValue* arg_values = trace_event->arg_values();
+  uint64_t arg_name_ids[kTraceMaxNumArgs];
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    arg_name_ids[i] = InternString(arg_names[i]);
+    if (arg_types[i] == TRACE_VALUE_TYPE_STRING ||
+        arg_types[i] == TRACE_VALUE_TYPE_COPY_STRING) {
+      InternString(arg_values[i].as_string);
+    }
+  }
+
+  WriteByte(kEventRecord);
+  WriteByte(static_cast<uint8_t>(trace_event->phase()));
+  WriteVarint(category_id);
+  WriteVarint(name_id);
+  WriteVarint(static_cast<uint32_t>(trace_event->pid()));
+  WriteVarint(static_cast<uint32_t>(trace_event->tid()));
+  WriteSignedVarint(trace_event->ts() - last_ts_);
+  WriteSignedVarint(trace_event->tts() - last_tts_);
+  last_ts_ = trace_event->ts();
+  last_tts_ = trace_event->tts();
+  WriteVarint(trace_event->duration());
+  WriteVarint(trace_event->cpu_duration());
+  WriteVarint(trace_event->flags());
+  if (has_id) {
+    WriteVarint(scope_id);
+    WriteVarint(trace_event->id());
+  }
+  WriteByte(static_cast<uint8_t>(trace_event->num_args()));
+  std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables =
+      trace_event->arg_convertables();
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    WriteVarint(arg_name_ids[i]);
+    WriteByte(arg_types[i]);
+    if (arg_types[i] == TRACE_VALUE_TYPE_CONVERTABLE) {
+      std::string arg_stringified;
+      arg_convertables[i]->AppendAsTraceFormat(&arg_stringified);
+      WriteVarint(arg_stringified.size());
+      buffer_.append(arg_stringified);
+    } else {
+      AppendArgValue(arg_types[i], arg_values[i]);
+    }
+  }
+
+  if (buffer_.size() >= kBlockSize) SubmitBlock();
+}
+
+void BinaryTraceWriter::SubmitBlock() {
+  if (buffer_.empty()) return;
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  blocks_.emplace_back();
+  blocks_.back().swap(buffer_);
+  buffer_.reserve(kBlockSize);
+  cv_.NotifyAll();
+}
+
+void BinaryTraceWriter::WriteBlocks() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  while (true) {
+    while (blocks_.empty() && !terminated_) cv_.Wait(&mutex_);
+    if (blocks_.empty()) return;
+    std::string block;
+    block.swap(blocks_.front());
+    blocks_.pop_front();
+    writing_ = true;
+    mutex_.Unlock();
+    stream_.write(block.data(), block.size());
+    mutex_.Lock();
+    writing_ = false;
+    cv_.NotifyAll();
+  }
+}
+
+void BinaryTraceWriter::Flush() {
+  SubmitBlock();
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  while (!blocks_.empty() || writing_) cv_.Wait(&mutex_);
+  stream_.flush();
+}
+
+TraceWriter* TraceWriter::CreateBinaryTraceWriter(std::ostream& stream) {
+  return new BinaryTraceWriter(stream);
+}
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
@@ -5,7 +5,14 @@
 #ifndef SRC_LIBPLATFORM_TRACING_TRACE_WRITER_H_
 #define SRC_LIBPLATFORM_TRACING_TRACE_WRITER_H_
 
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 #include "include/libplatform/v8-tracing.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 
 namespace v8 {
 namespace platform {
@@ -26,6 +33,64 @@ class JSONTraceWriter : public TraceWriter {
   bool append_comma_ = false;
 };
 
+// Writes trace events in a compact binary format. The stream starts with the
+// four bytes "V8TB" and a version byte, followed by a sequence of records.
+// Every record starts with a RecordType byte:
+//
+//   kStringRecord: id, length, the bytes of the string. Every string is
+//     written once, later records refer to it by id. Id 0 stands for NULL.
+//   kEventRecord: phase (1 byte), category id, name id, pid, tid, ts, tts,
+//     duration, cpu duration, flags, [scope id, id if TRACE_EVENT_FLAG_HAS_ID],
+//     number of args (1 byte), and for every arg its name id, its type
+//     (1 byte) and its value.
+//
+// Integers are LEB128 varints; ts, tts and signed values are zigzag encoded,
+// and ts and tts are deltas to the previous event. Doubles are 8 bytes in
+// little endian order, string arguments are ids, and convertable arguments
+// are a length followed by their trace format.
+//
+// Encoding happens on the thread appending the events, writing the encoded
+// bytes to the stream happens on a background thread.
+class BinaryTraceWriter : public TraceWriter {
+ public:
+  enum RecordType : uint8_t { kStringRecord = 1, kEventRecord = 2 };
+  static const uint8_t kVersion = 1;
+
+  explicit BinaryTraceWriter(std::ostream& stream);
+  ~BinaryTraceWriter();
+  void AppendTraceEvent(TraceObject* trace_event) override;
+  void Flush() override;
+
+ private:
+  class WriterThread;
+
+  // Encoded bytes are handed to the writer thread in blocks of this size.
+  static const size_t kBlockSize = 64 * 1024;
+
+  void WriteByte(uint8_t value) { buffer_.push_back(value); }
+  void WriteVarint(uint64_t value);
+  void WriteSignedVarint(int64_t value);
+  uint64_t InternString(const char* str);
+  void AppendArgValue(uint8_t type, TraceObject::ArgValue value);
+
+  void SubmitBlock();
+  void WriteBlocks();
+
+  std::ostream& stream_;
+  std::string buffer_;
+  std::unordered_map<std::string, uint64_t> strings_;
+  int64_t last_ts_ = 0;
+  int64_t last_tts_ = 0;
+
+  // Guards the fields below, which are shared with the writer thread.
+  base::Mutex mutex_;
+  base::ConditionVariable cv_;
+  std::deque<std::string> blocks_;
+  bool writing_ = false;
+  bool terminated_ = false;
+  std::unique_ptr<WriterThread> writer_thread_;
+};
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
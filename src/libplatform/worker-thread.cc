@@ -10,8 +10,13 @@
 namespace v8 {
 namespace platform {
 
-WorkerThread::WorkerThread(TaskQueue* queue)
-    : Thread(Options("V8 WorkerThread")), queue_(queue) {
+WorkerThread::WorkerThread(TaskQueue* queue, const char* name,
+                           const WorkerThreadOptions& options)
+    : Thread(Options(name)),
+      queue_(queue),
+      worker_(queue->RegisterWorker()),
+      cpu_affinity_mask_(options.cpu_affinity_mask),
+      nice_level_(options.nice_level) {
   Start();
 }
 
@@ -22,6 +27,13 @@ WorkerThread::~WorkerThread() {
 
 
 void WorkerThread::Run() {
+  queue_->BindWorkerToCurrentThread(worker_);
+  // Scheduling options are best effort, e.g. raising the priority may need
+  // privileges the process does not have.
+  if (cpu_affinity_mask_ != 0) {
+    base::Thread::SetCurrentThreadAffinity(cpu_affinity_mask_);
+  }
+  if (nice_level_ != 0) base::Thread::SetCurrentThreadNiceLevel(nice_level_);
   while (Task* task = queue_->GetNext()) {
     task->Run();
     delete task;
@@ -8,6 +8,7 @@
 #include <queue>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/libplatform/libplatform.h"
 #include "src/base/compiler-specific.h"
 #include "src/base/macros.h"
 #include "src/base/platform/platform.h"
@@ -20,7 +21,9 @@ class TaskQueue;
 
 class V8_PLATFORM_EXPORT WorkerThread : public NON_EXPORTED_BASE(base::Thread) {
  public:
-  explicit WorkerThread(TaskQueue* queue);
+  explicit WorkerThread(
+      TaskQueue* queue, const char* name = "V8 WorkerThread",
+      const WorkerThreadOptions& options = WorkerThreadOptions());
   virtual ~WorkerThread();
 
   // Thread implementation.
@@ -30,6 +33,9 @@ class V8_PLATFORM_EXPORT WorkerThread : public NON_EXPORTED_BASE(base::Thread) {
   friend class QuitTask;
 
   TaskQueue* queue_;
+  const int worker_;
+  const uint64_t cpu_affinity_mask_;
+  const int nice_level_;
 
   DISALLOW_COPY_AND_ASSIGN(WorkerThread);
 };
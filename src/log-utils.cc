@@ -4,6 +4,8 @@
 
 #include "src/log-utils.h"
 
+#include <algorithm>
+
 #include "src/assert-scope.h"
 #include "src/base/platform/platform.h"
 #include "src/objects-inl.h"
@@ -22,6 +24,7 @@ const char* const Log::kLogToConsole = "-";
 Log::Log(Logger* logger)
   : is_stopped_(false),
     output_handle_(NULL),
+    async_writer_(NULL),
     message_buffer_(NULL),
     logger_(logger) {
 }
@@ -53,6 +56,11 @@ void Log::Initialize(const char* log_file_name) {
       OpenFile(log_file_name);
     }
 
+    if (output_handle_ != nullptr && FLAG_log_async) {
+      async_writer_ = new AsyncWriter(output_handle_);
+      async_writer_->Start();
+    }
+
     if (output_handle_ != nullptr) {
       Log::MessageBuilder msg(this);
       msg.Append("v8-version,%d,%d,%d,%d,%d", Version::GetMajor(),
@@ -83,6 +91,12 @@ void Log::OpenFile(const char* name) {
 
 
 FILE* Log::Close() {
+  if (async_writer_ != NULL) {
+    async_writer_->Stop();
+    delete async_writer_;
+    async_writer_ = NULL;
+  }
+
   FILE* result = NULL;
   if (output_handle_ != NULL) {
     if (strcmp(FLAG_logfile, kLogToTemporaryFile) != 0) {
@@ -101,6 +115,82 @@ FILE* Log::Close() {
 }
 
 
+const size_t Log::AsyncWriter::kBufferSize;
+const size_t Log::AsyncWriter::kWakeUpThreshold;
+
+Log::AsyncWriter::AsyncWriter(FILE* output_handle)
+    : Thread(Thread::Options("v8:LogWriter")),
+      output_handle_(output_handle),
+      buffer_(NewArray<char>(kBufferSize)),
+      head_(0),
+      tail_(0),
+      stopping_(0),
+      failed_(0),
+      wake_up_(0) {}
+
+Log::AsyncWriter::~AsyncWriter() { DeleteArray(buffer_); }
+
+bool Log::AsyncWriter::Write(const char* msg, int length) {
+  DCHECK_LE(static_cast<size_t>(length), kBufferSize);
+  if (base::Acquire_Load(&failed_)) return false;
+  // Wait for the writer thread if the buffer is full.
+  while (kBufferSize - QueuedSize() < static_cast<size_t>(length)) {
+    wake_up_.Signal();
+    base::OS::Sleep(base::TimeDelta::FromMicroseconds(100));
+    if (base::Acquire_Load(&failed_)) return false;
+  }
+  size_t head = static_cast<size_t>(base::Acquire_Load(&head_));
+  size_t offset = head % kBufferSize;
+  size_t first_part =
+      std::min(static_cast<size_t>(length), kBufferSize - offset);
+  MemCopy(buffer_ + offset, msg, first_part);
+  MemCopy(buffer_, msg + first_part, length - first_part);
+  size_t queued_before = QueuedSize();
+  base::Release_Store(&head_, static_cast<base::AtomicWord>(head + length));
+  if (queued_before < kWakeUpThreshold &&
+      queued_before + length >= kWakeUpThreshold) {
+    wake_up_.Signal();
+  }
+  return true;
+}
+
+bool Log::AsyncWriter::Drain() {
+  size_t tail = static_cast<size_t>(base::Acquire_Load(&tail_));
+  size_t head = static_cast<size_t>(base::Acquire_Load(&head_));
+  if (head == tail) return true;
+  while (tail != head) {
+    size_t offset = tail % kBufferSize;
+    size_t length = std::min(head - tail, kBufferSize - offset);
+    if (fwrite(buffer_ + offset, 1, length, output_handle_) != length) {
+      return false;
+    }
+    tail += length;
+  }
+  base::Release_Store(&tail_, static_cast<base::AtomicWord>(tail));
+  fflush(output_handle_);
+  return true;
+}
+
+void Log::AsyncWriter::Run() {
+  // Flush at least every few milliseconds, so that the log stays fresh.
+  const base::TimeDelta kFlushInterval = base::TimeDelta::FromMilliseconds(10);
+  while (true) {
+    bool stopping = base::Acquire_Load(&stopping_) != 0;
+    if (!Drain()) {
+      base::Release_Store(&failed_, 1);
+      return;
+    }
+    if (stopping) return;
+    USE(wake_up_.WaitFor(kFlushInterval));
+  }
+}
+
+void Log::AsyncWriter::Stop() {
+  base::Release_Store(&stopping_, 1);
+  wake_up_.Signal();
+  Join();
+}
+
 Log::MessageBuilder::MessageBuilder(Log* log)
   : log_(log),
     lock_guard_(&log_->mutex_),
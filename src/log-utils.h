@@ -10,8 +10,10 @@
 #include <cstdarg>
 
 #include "src/allocation.h"
+#include "src/base/atomicops.h"
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/flags.h"
 
 namespace v8 {
@@ -97,6 +99,47 @@ class Log {
   };
 
  private:
+  // Background thread writing the log with --log-async. Messages are copied
+  // into a ring buffer by WriteToFile, which only ever runs with mutex_ held,
+  // so there is a single producer and a single consumer and the ring buffer
+  // itself needs no lock.
+  class AsyncWriter : public base::Thread {
+   public:
+    explicit AsyncWriter(FILE* output_handle);
+    ~AsyncWriter() override;
+
+    // Returns false if an earlier write to the file failed.
+    bool Write(const char* msg, int length);
+    // Writes out all queued messages and joins the thread.
+    void Stop();
+
+    void Run() override;
+
+   private:
+    static const size_t kBufferSize = 1 * MB;
+    // The writer is woken up early once the buffer is this full.
+    static const size_t kWakeUpThreshold = kBufferSize / 2;
+
+    size_t QueuedSize() {
+      return static_cast<size_t>(base::Acquire_Load(&head_) -
+                                 base::Acquire_Load(&tail_));
+    }
+    // Writes out the queued messages, returns false on failure.
+    bool Drain();
+
+    FILE* const output_handle_;
+    char* const buffer_;
+    // Positions grow monotonically and are taken modulo kBufferSize. head_ is
+    // only written by the producer, tail_ only by the writer thread.
+    base::AtomicWord head_;
+    base::AtomicWord tail_;
+    base::Atomic32 stopping_;
+    base::Atomic32 failed_;
+    base::Semaphore wake_up_;
+
+    DISALLOW_COPY_AND_ASSIGN(AsyncWriter);
+  };
+
   explicit Log(Logger* logger);
 
   // Opens stdout for logging.
@@ -111,6 +154,9 @@ class Log {
   // Implementation of writing to a log file.
   int WriteToFile(const char* msg, int length) {
     DCHECK_NOT_NULL(output_handle_);
+    if (async_writer_ != nullptr) {
+      return async_writer_->Write(msg, length) ? length : 0;
+    }
     size_t rv = fwrite(msg, 1, length, output_handle_);
     DCHECK_EQ(length, rv);
     USE(rv);
@@ -125,6 +171,9 @@ class Log {
   // destination.  mutex_ should be acquired before using output_handle_.
   FILE* output_handle_;
 
+  // Writes to output_handle_ with --log-async.
+  AsyncWriter* async_writer_;
+
   // mutex_ is a Mutex used for enforcing exclusive
   // access to the formatting buffer and the log file or log memory buffer.
   base::Mutex mutex_;
@@ -259,12 +259,18 @@ PerfBasicLogger::~PerfBasicLogger() {
   perf_output_handle_ = NULL;
 }
 
-void PerfBasicLogger::LogRecordedBuffer(AbstractCode* code, SharedFunctionInfo*,
+void PerfBasicLogger::LogRecordedBuffer(AbstractCode* code,
+                                        SharedFunctionInfo* shared,
                                         const char* name, int length) {
+  // Per-function interpreter entry trampolines are reported as functions.
+  bool is_function_trampoline =
+      shared != nullptr && code->IsCode() &&
+      code->GetCode()->is_interpreter_trampoline_builtin();
   if (FLAG_perf_basic_prof_only_functions &&
       (code->kind() != AbstractCode::FUNCTION &&
        code->kind() != AbstractCode::INTERPRETED_FUNCTION &&
-       code->kind() != AbstractCode::OPTIMIZED_FUNCTION)) {
+       code->kind() != AbstractCode::OPTIMIZED_FUNCTION &&
+       !is_function_trampoline)) {
     return;
   }
 
@@ -1469,7 +1475,11 @@ static int EnumerateCompiledFunctions(Heap* heap,
         ++compiled_funcs_count;
       }
 
-      if (!sfi->IsInterpreted()) {
+      // Interpreted functions may run in their own copy of the interpreter
+      // entry trampoline (--interpreted-frames-native-stack).
+      if (!sfi->IsInterpreted() ||
+          sfi->code() != heap->isolate()->builtins()->builtin(
+                             Builtins::kInterpreterEntryTrampoline)) {
         AddFunctionAndCode(sfi, AbstractCode::cast(sfi->code()), sfis,
                            code_objects, compiled_funcs_count);
         ++compiled_funcs_count;
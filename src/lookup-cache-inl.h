@@ -36,5 +36,65 @@ void DescriptorLookupCache::Update(Map* source, Name* name, int result) {
   results_[index] = result;
 }
 
+// static
+int TransitionLookupCache::Hash(Map* source, Name* name) {
+  DCHECK(name->IsUniqueName());
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t source_hash =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(source)) >>
+      kPointerSizeLog2;
+  uint32_t name_hash = name->hash_field();
+  return (source_hash ^ name_hash) % kLength;
+}
+
+// static
+int TransitionLookupCache::MigrationHash(Map* source) {
+  uint32_t source_hash =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(source)) >>
+      kPointerSizeLog2;
+  return source_hash % kMigrationLength;
+}
+
+Map* TransitionLookupCache::Lookup(Map* source, Name* name, PropertyKind kind,
+                                   PropertyAttributes attributes) {
+  int index = Hash(source, name);
+  Key& key = keys_[index];
+  if ((key.source == source) && (key.name == name) &&
+      (key.details == (kind | (attributes << 1)))) {
+    return targets_[index];
+  }
+  return NULL;
+}
+
+void TransitionLookupCache::Update(Map* source, Name* name, PropertyKind kind,
+                                   PropertyAttributes attributes,
+                                   Map* target) {
+  DCHECK_NOT_NULL(target);
+  int index = Hash(source, name);
+  Key& key = keys_[index];
+  key.source = source;
+  key.name = name;
+  key.details = kind | (attributes << 1);
+  targets_[index] = target;
+}
+
+Map* TransitionLookupCache::LookupMigration(Map* source) {
+  DCHECK(source->is_deprecated());
+  int index = MigrationHash(source);
+  if (migration_sources_[index] != source) return NULL;
+  // The target stays valid until it is deprecated itself, everything else
+  // only generalizes its fields in place.
+  Map* target = migration_targets_[index];
+  if (target->is_deprecated()) return NULL;
+  return target;
+}
+
+void TransitionLookupCache::UpdateMigration(Map* source, Map* target) {
+  DCHECK(source->is_deprecated());
+  int index = MigrationHash(source);
+  migration_sources_[index] = source;
+  migration_targets_[index] = target;
+}
+
 }  // namespace internal
 }  // namespace v8
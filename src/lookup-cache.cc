@@ -13,5 +13,12 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = NULL;
 }
 
+void TransitionLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) keys_[index].source = NULL;
+  for (int index = 0; index < kMigrationLength; index++) {
+    migration_sources_[index] = NULL;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -52,6 +52,54 @@ class DescriptorLookupCache {
   DISALLOW_COPY_AND_ASSIGN(DescriptorLookupCache);
 };
 
+// Cache for mapping (map, property name, kind, attributes) into the target
+// map of the property transition, and deprecated maps into the map their
+// instances were last migrated to. Only positive results are cached.
+// Cleared at startup and prior to any gc.
+class TransitionLookupCache {
+ public:
+  // Lookup the transition target for (map, name, kind, attributes).
+  // If absent, NULL is returned.
+  inline Map* Lookup(Map* source, Name* name, PropertyKind kind,
+                     PropertyAttributes attributes);
+
+  // Update an element in the cache.
+  inline void Update(Map* source, Name* name, PropertyKind kind,
+                     PropertyAttributes attributes, Map* target);
+
+  // Lookup the map that instances of the deprecated map |source| migrate to.
+  // If absent or no longer valid, NULL is returned.
+  inline Map* LookupMigration(Map* source);
+
+  // Update an element in the migration cache.
+  inline void UpdateMigration(Map* source, Map* target);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  TransitionLookupCache() { Clear(); }
+
+  static inline int Hash(Map* source, Name* name);
+  static inline int MigrationHash(Map* source);
+
+  static const int kLength = 128;
+  static const int kMigrationLength = 16;
+  struct Key {
+    Map* source;
+    Name* name;
+    int details;
+  };
+
+  Key keys_[kLength];
+  Map* targets_[kLength];
+  Map* migration_sources_[kMigrationLength];
+  Map* migration_targets_[kMigrationLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(TransitionLookupCache);
+};
+
 }  // namespace internal
 }  // namespace v8
 
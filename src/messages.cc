@@ -614,7 +614,18 @@ MaybeHandle<String> JSStackFrame::ToString() {
   return builder.Finish();
 }
 
-int JSStackFrame::GetPosition() const { return code_->SourcePosition(offset_); }
+int JSStackFrame::GetPosition() const {
+  if (code_->IsBytecodeArray()) {
+    Handle<SharedFunctionInfo> shared(function_->shared(), isolate_);
+    // If the source positions cannot be collected, fall back to the position
+    // of the function itself rather than reporting a bogus one.
+    if (!SharedFunctionInfo::EnsureSourcePositionsAvailable(shared) ||
+        !code_->GetBytecodeArray()->HasSourcePositionTable()) {
+      return shared->start_position();
+    }
+  }
+  return code_->SourcePosition(offset_);
+}
 
 bool JSStackFrame::HasScript() const {
   return function_->shared()->script()->IsScript();
@@ -931,11 +942,8 @@ class PrepareStackTraceScope {
 MaybeHandle<Object> ErrorUtils::FormatStackTrace(Isolate* isolate,
                                                  Handle<JSObject> error,
                                                  Handle<Object> raw_stack) {
-  DCHECK(raw_stack->IsJSArray());
-  Handle<JSArray> raw_stack_array = Handle<JSArray>::cast(raw_stack);
-
-  DCHECK(raw_stack_array->elements()->IsFixedArray());
-  Handle<FrameArray> elems(FrameArray::cast(raw_stack_array->elements()));
+  DCHECK(raw_stack->IsFrameArray());
+  Handle<FrameArray> elems = Handle<FrameArray>::cast(raw_stack);
 
   // If there's a user-specified "prepareStackFrames" function, call it on the
   // frames and use its result.
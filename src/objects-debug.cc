@@ -1093,13 +1093,13 @@ void JSRegExp::JSRegExpVerify() {
       Object* one_byte_data = arr->get(JSRegExp::kIrregexpLatin1CodeIndex);
       // Smi : Not compiled yet (-1) or code prepared for flushing.
       // JSObject: Compilation error.
-      // Code/ByteArray: Compiled code.
-      CHECK(
-          one_byte_data->IsSmi() ||
-          (is_native ? one_byte_data->IsCode() : one_byte_data->IsByteArray()));
+      // Code/ByteArray: Compiled code. Native builds use bytecode as well
+      // with --regexp-tier-up.
+      CHECK(one_byte_data->IsSmi() || one_byte_data->IsByteArray() ||
+            (is_native && one_byte_data->IsCode()));
       Object* uc16_data = arr->get(JSRegExp::kIrregexpUC16CodeIndex);
-      CHECK(uc16_data->IsSmi() ||
-             (is_native ? uc16_data->IsCode() : uc16_data->IsByteArray()));
+      CHECK(uc16_data->IsSmi() || uc16_data->IsByteArray() ||
+            (is_native && uc16_data->IsCode()));
 
       Object* one_byte_saved =
           arr->get(JSRegExp::kIrregexpLatin1CodeSavedIndex);
@@ -1111,6 +1111,11 @@ void JSRegExp::JSRegExpVerify() {
 
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpBacktrackLimitIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpPrefilterIndex)->IsSmi() ||
+            arr->get(JSRegExp::kIrregexpPrefilterIndex)->IsString());
+      CHECK(arr->get(JSRegExp::kIrregexpPrefilterIsPrefixIndex)->IsSmi());
       break;
     }
     default:
@@ -1362,6 +1367,7 @@ void FunctionTemplateInfo::FunctionTemplateInfoVerify() {
   VerifyPointer(signature());
   VerifyPointer(access_check_info());
   VerifyPointer(cached_property_name());
+  VerifyPointer(fast_call_info());
 }
 
 
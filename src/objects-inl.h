@@ -147,6 +147,8 @@ bool HeapObject::IsJSGeneratorObject() const {
 
 bool HeapObject::IsBoilerplateDescription() const { return IsFixedArray(); }
 
+bool HeapObject::IsClassBoilerplate() const { return IsFixedArray(); }
+
 // External objects are not extensible, so the map check is enough.
 bool HeapObject::IsExternal() const {
   return map() == GetHeap()->external_map();
@@ -538,6 +540,7 @@ CAST_ACCESSOR(ByteArray)
 CAST_ACCESSOR(BytecodeArray)
 CAST_ACCESSOR(CallHandlerInfo)
 CAST_ACCESSOR(Cell)
+CAST_ACCESSOR(ClassBoilerplate)
 CAST_ACCESSOR(Code)
 CAST_ACCESSOR(ConstantElementsPair)
 CAST_ACCESSOR(ContextExtension)
@@ -2673,6 +2676,13 @@ void StringTableKey::set_hash_field(uint32_t hash_field) {
   set_hash(hash_field >> Name::kHashShift);
 }
 
+bool StringTableShape::IsMatch(Key key, Object* value) {
+  // All strings in the table have their hash computed, so probes that hit a
+  // different string are rejected without comparing characters.
+  if (key->Hash() != String::cast(value)->Hash()) return false;
+  return key->IsMatch(value);
+}
+
 Handle<Object> StringTableShape::AsHandle(Isolate* isolate,
                                           StringTableKey* key) {
   return key->AsHandle(isolate);
@@ -3019,9 +3029,16 @@ Address BytecodeArray::GetFirstBytecodeAddress() {
   return reinterpret_cast<Address>(this) - kHeapObjectTag + kHeaderSize;
 }
 
+bool BytecodeArray::HasSourcePositionTable() {
+  return !source_position_table()->IsUndefined(GetIsolate());
+}
+
 ByteArray* BytecodeArray::SourcePositionTable() {
   Object* maybe_table = source_position_table();
   if (maybe_table->IsByteArray()) return ByteArray::cast(maybe_table);
+  if (maybe_table->IsUndefined(GetIsolate())) {
+    return GetHeap()->empty_byte_array();
+  }
   DCHECK(maybe_table->IsSourcePositionTableWithFrameCache());
   return SourcePositionTableWithFrameCache::cast(maybe_table)
       ->source_position_table();
@@ -3869,18 +3886,21 @@ inline bool Code::is_hydrogen_stub() {
   return is_crankshafted() && kind() != OPTIMIZED_FUNCTION;
 }
 
+// Compare builtin indices rather than code objects, so that the copies
+// of the interpreter entry trampoline made for
+// --interpreted-frames-native-stack are recognized as well.
 inline bool Code::is_interpreter_trampoline_builtin() {
-  Builtins* builtins = GetIsolate()->builtins();
-  return this == *builtins->InterpreterEntryTrampoline() ||
-         this == *builtins->InterpreterEnterBytecodeAdvance() ||
-         this == *builtins->InterpreterEnterBytecodeDispatch();
+  int index = builtin_index();
+  return index == Builtins::kInterpreterEntryTrampoline ||
+         index == Builtins::kInterpreterEnterBytecodeAdvance ||
+         index == Builtins::kInterpreterEnterBytecodeDispatch;
 }
 
 inline bool Code::checks_optimization_marker() {
-  Builtins* builtins = GetIsolate()->builtins();
-  return this == *builtins->CompileLazy() ||
-         this == *builtins->InterpreterEntryTrampoline() ||
-         this == *builtins->CheckOptimizationMarker();
+  int index = builtin_index();
+  return index == Builtins::kCompileLazy ||
+         index == Builtins::kInterpreterEntryTrampoline ||
+         index == Builtins::kCheckOptimizationMarker;
 }
 
 inline bool Code::has_unwinding_info() const {
@@ -4626,6 +4646,15 @@ SMI_ACCESSORS(ConstantElementsPair, elements_kind, kElementsKindOffset)
 ACCESSORS(ConstantElementsPair, constant_values, FixedArrayBase,
           kConstantValuesOffset)
 
+ACCESSORS(ClassBoilerplate, prototype_properties, FixedArray,
+          kPrototypePropertiesOffset)
+ACCESSORS(ClassBoilerplate, static_properties, FixedArray,
+          kStaticPropertiesOffset)
+ACCESSORS(ClassBoilerplate, prototype_home_objects, FixedArray,
+          kPrototypeHomeObjectsOffset)
+ACCESSORS(ClassBoilerplate, static_home_objects, FixedArray,
+          kStaticHomeObjectsOffset)
+
 ACCESSORS(JSModuleNamespace, module, Module, kModuleOffset)
 
 ACCESSORS(Module, code, Object, kCodeOffset)
@@ -4712,6 +4741,7 @@ ACCESSORS(FunctionTemplateInfo, shared_function_info, Object,
           kSharedFunctionInfoOffset)
 ACCESSORS(FunctionTemplateInfo, cached_property_name, Object,
           kCachedPropertyNameOffset)
+ACCESSORS(FunctionTemplateInfo, fast_call_info, Object, kFastCallInfoOffset)
 
 SMI_ACCESSORS(FunctionTemplateInfo, flag, kFlagOffset)
 
@@ -1084,6 +1084,16 @@ MaybeHandle<Object> JSProxy::GetProperty(Isolate* isolate,
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, trap_result,
       Execution::Call(isolate, trap, handler, arraysize(args), args), Object);
+  // 9.-11.
+  return CheckGetSetTrapResult(isolate, name, target, trap_result, kGet);
+}
+
+// static
+MaybeHandle<Object> JSProxy::CheckGetSetTrapResult(Isolate* isolate,
+                                                   Handle<Name> name,
+                                                   Handle<JSReceiver> target,
+                                                   Handle<Object> trap_result,
+                                                   AccessKind access_kind) {
   // 9. Let targetDesc be ? target.[[GetOwnProperty]](P).
   PropertyDescriptor target_desc;
   Maybe<bool> target_found =
@@ -1100,24 +1110,43 @@ MaybeHandle<Object> JSProxy::GetProperty(Isolate* isolate,
                         !target_desc.writable() &&
                         !trap_result->SameValue(*target_desc.value());
     if (inconsistent) {
-      THROW_NEW_ERROR(
-          isolate, NewTypeError(MessageTemplate::kProxyGetNonConfigurableData,
-                                name, target_desc.value(), trap_result),
-          Object);
+      if (access_kind == kGet) {
+        THROW_NEW_ERROR(
+            isolate,
+            NewTypeError(MessageTemplate::kProxyGetNonConfigurableData, name,
+                         target_desc.value(), trap_result),
+            Object);
+      } else {
+        THROW_NEW_ERROR(
+            isolate, NewTypeError(MessageTemplate::kProxySetFrozenData, name),
+            Object);
+      }
     }
     // 10.b. If IsAccessorDescriptor(targetDesc) and targetDesc.[[Configurable]]
     //       is false and targetDesc.[[Get]] is undefined, then
     // 10.b.i. If trapResult is not undefined, throw a TypeError exception.
-    inconsistent = PropertyDescriptor::IsAccessorDescriptor(&target_desc) &&
-                   !target_desc.configurable() &&
-                   target_desc.get()->IsUndefined(isolate) &&
-                   !trap_result->IsUndefined(isolate);
-    if (inconsistent) {
-      THROW_NEW_ERROR(
-          isolate,
-          NewTypeError(MessageTemplate::kProxyGetNonConfigurableAccessor, name,
-                       trap_result),
-          Object);
+    if (access_kind == kGet) {
+      inconsistent = PropertyDescriptor::IsAccessorDescriptor(&target_desc) &&
+                     !target_desc.configurable() &&
+                     target_desc.get()->IsUndefined(isolate) &&
+                     !trap_result->IsUndefined(isolate);
+      if (inconsistent) {
+        THROW_NEW_ERROR(
+            isolate,
+            NewTypeError(MessageTemplate::kProxyGetNonConfigurableAccessor,
+                         name, trap_result),
+            Object);
+      }
+    } else {
+      inconsistent = PropertyDescriptor::IsAccessorDescriptor(&target_desc) &&
+                     !target_desc.configurable() &&
+                     target_desc.set()->IsUndefined(isolate);
+      if (inconsistent) {
+        THROW_NEW_ERROR(
+            isolate,
+            NewTypeError(MessageTemplate::kProxySetFrozenAccessor, name),
+            Object);
+      }
     }
   }
   // 11. Return trap_result
@@ -1987,6 +2016,77 @@ bool HasExcludedProperty(
   return false;
 }
 
+// Copies all properties of |source| into the empty object |target| by
+// migrating |target| to the map of |source| and copying the fields, instead
+// of adding the properties one by one. This is possible if |target| has the
+// root map of the transition tree of |source|, which is common for immutable
+// updates like Object.assign({}, state) and {...state}. Returns false if the
+// fast path does not apply, without side effects.
+bool TryCopyIntoEmptyObject(Handle<JSReceiver> target, Handle<JSObject> source,
+                            bool use_set) {
+  Isolate* isolate = target->GetIsolate();
+  if (!target->IsJSObject()) return false;
+  Handle<JSObject> to = Handle<JSObject>::cast(target);
+  Map* target_map = to->map();
+  Handle<Map> map(source->map(), isolate);
+  if (target_map->NumberOfOwnDescriptors() != 0 ||
+      target_map->is_dictionary_map() || target_map->is_prototype_map() ||
+      to->elements() != isolate->heap()->empty_fixed_array()) {
+    return false;
+  }
+  if (map->is_deprecated() || map->is_prototype_map() ||
+      !map->is_extensible() || map->NumberOfOwnDescriptors() == 0 ||
+      map->FindRootMap() != target_map) {
+    return false;
+  }
+
+  // Only writable, enumerable and configurable data fields can be copied, as
+  // these are the properties that Object.assign and spread would create.
+  Handle<DescriptorArray> descriptors(map->instance_descriptors(), isolate);
+  int length = map->NumberOfOwnDescriptors();
+  for (int i = 0; i < length; i++) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.kind() != kData || details.location() != kField ||
+        details.attributes() != NONE) {
+      return false;
+    }
+  }
+
+  // [[Set]] could hit setters or read-only properties on the prototype chain.
+  if (use_set) {
+    for (int i = 0; i < length; i++) {
+      Handle<Name> key(descriptors->GetKey(i), isolate);
+      LookupIterator it(to, key, to);
+      if (it.state() == LookupIterator::NOT_FOUND) continue;
+      if (it.state() != LookupIterator::DATA || it.IsReadOnly()) return false;
+    }
+  }
+
+  JSObject::MigrateToMap(to, map);
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < length; i++) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    FieldIndex index = FieldIndex::ForDescriptor(*map, i);
+    if (details.representation().IsDouble()) {
+      // Double fields that are not unboxed have their own mutable boxes.
+      uint64_t bits =
+          source->IsUnboxedDoubleField(index)
+              ? source->RawFastDoublePropertyAsBitsAt(index)
+              : HeapNumber::cast(source->RawFastPropertyAt(index))
+                    ->value_as_bits();
+      if (to->IsUnboxedDoubleField(index)) {
+        to->RawFastDoublePropertyAsBitsAtPut(index, bits);
+      } else {
+        HeapNumber::cast(to->RawFastPropertyAt(index))
+            ->set_value_as_bits(bits);
+      }
+    } else {
+      to->RawFastPropertyAtPut(index, source->RawFastPropertyAt(index));
+    }
+  }
+  return true;
+}
+
 MUST_USE_RESULT Maybe<bool> FastAssign(
     Handle<JSReceiver> target, Handle<Object> source,
     const ScopedVector<Handle<Object>>* excluded_properties, bool use_set) {
@@ -2015,6 +2115,11 @@ MUST_USE_RESULT Maybe<bool> FastAssign(
     return Just(false);
   }
 
+  if (excluded_properties == nullptr &&
+      TryCopyIntoEmptyObject(target, from, use_set)) {
+    return Just(true);
+  }
+
   Handle<DescriptorArray> descriptors(map->instance_descriptors(), isolate);
   int length = map->NumberOfOwnDescriptors();
 
@@ -2425,6 +2530,78 @@ void Smi::SmiPrint(std::ostream& os) const {  // NOLINT
   os << value();
 }
 
+// static
+CompareResult Smi::LexicographicCompare(Smi* x, Smi* y) {
+  int x_value = x->value();
+  int y_value = y->value();
+
+  // If the integers are equal so are the string representations.
+  if (x_value == y_value) return EQUAL;
+
+  // If one of the integers is zero the normal integer order is the
+  // same as the lexicographic order of the string representations.
+  if (x_value == 0 || y_value == 0)
+    return x_value < y_value ? LESS : GREATER;
+
+  // If only one of the integers is negative the negative number is
+  // smallest because the char code of '-' is less than the char code
+  // of any digit.  Otherwise, we make both values positive.
+
+  // Use unsigned values otherwise the logic is incorrect for -MIN_INT on
+  // architectures using 32-bit Smis.
+  uint32_t x_scaled = x_value;
+  uint32_t y_scaled = y_value;
+  if (x_value < 0 || y_value < 0) {
+    if (y_value >= 0) return LESS;
+    if (x_value >= 0) return GREATER;
+    x_scaled = -x_value;
+    y_scaled = -y_value;
+  }
+
+  static const uint32_t kPowersOf10[] = {
+      1,                 10,                100,         1000,
+      10 * 1000,         100 * 1000,        1000 * 1000, 10 * 1000 * 1000,
+      100 * 1000 * 1000, 1000 * 1000 * 1000};
+
+  // If the integers have the same number of decimal digits they can be
+  // compared directly as the numeric order is the same as the
+  // lexicographic order.  If one integer has fewer digits, it is scaled
+  // by some power of 10 to have the same number of digits as the longer
+  // integer.  If the scaled integers are equal it means the shorter
+  // integer comes first in the lexicographic order.
+
+  // From http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+  int x_log2 = 31 - base::bits::CountLeadingZeros32(x_scaled);
+  int x_log10 = ((x_log2 + 1) * 1233) >> 12;
+  x_log10 -= x_scaled < kPowersOf10[x_log10];
+
+  int y_log2 = 31 - base::bits::CountLeadingZeros32(y_scaled);
+  int y_log10 = ((y_log2 + 1) * 1233) >> 12;
+  y_log10 -= y_scaled < kPowersOf10[y_log10];
+
+  CompareResult tie = EQUAL;
+
+  if (x_log10 < y_log10) {
+    // X has fewer digits.  We would like to simply scale up X but that
+    // might overflow, e.g when comparing 9 with 1_000_000_000, 9 would
+    // be scaled up to 9_000_000_000. So we scale up by the next
+    // smallest power and scale down Y to drop one digit. It is OK to
+    // drop one digit from the longer integer since the final digit is
+    // past the length of the shorter integer.
+    x_scaled *= kPowersOf10[y_log10 - x_log10 - 1];
+    y_scaled /= 10;
+    tie = LESS;
+  } else if (y_log10 < x_log10) {
+    y_scaled *= kPowersOf10[x_log10 - y_log10 - 1];
+    x_scaled /= 10;
+    tie = GREATER;
+  }
+
+  if (x_scaled < y_scaled) return LESS;
+  if (x_scaled > y_scaled) return GREATER;
+  return tie;
+}
+
 Handle<String> String::SlowFlatten(Handle<ConsString> cons,
                                    PretenureFlag pretenure) {
   DCHECK(cons->second()->length() != 0);
@@ -4189,6 +4366,12 @@ MaybeHandle<Map> Map::TryUpdate(Handle<Map> old_map) {
 
   if (!old_map->is_deprecated()) return old_map;
 
+  // Instances of a deprecated map are usually migrated one after the other,
+  // reuse the result of the last replay.
+  TransitionLookupCache* cache =
+      old_map->GetIsolate()->transition_lookup_cache();
+  if (Map* cached = cache->LookupMigration(*old_map)) return handle(cached);
+
   // Check the state of the root map.
   Map* root_map = old_map->FindRootMap();
   if (root_map->is_deprecated()) {
@@ -4213,6 +4396,7 @@ MaybeHandle<Map> Map::TryUpdate(Handle<Map> old_map) {
   }
   Map* new_map = root_map->TryReplayPropertyTransitions(*old_map);
   if (new_map == nullptr) return MaybeHandle<Map>();
+  cache->UpdateMigration(*old_map, new_map);
   return handle(new_map);
 }
 
@@ -4294,8 +4478,17 @@ Map* Map::TryReplayPropertyTransitions(Map* old_map) {
 // static
 Handle<Map> Map::Update(Handle<Map> map) {
   if (!map->is_deprecated()) return map;
+  TransitionLookupCache* cache = map->GetIsolate()->transition_lookup_cache();
+  if (Map* cached = cache->LookupMigration(*map)) return handle(cached);
   MapUpdater mu(map->GetIsolate(), map);
-  return mu.Update();
+  Handle<Map> result = mu.Update();
+  // Only maps in the same transition tree can be shared by later instances,
+  // normalized copies are not cached.
+  if (!result->is_dictionary_map() && !result->is_deprecated() &&
+      result->FindRootMap() == map->FindRootMap()) {
+    cache->UpdateMigration(*map, *result);
+  }
+  return result;
 }
 
 Maybe<bool> JSObject::SetPropertyWithInterceptor(LookupIterator* it,
@@ -5107,35 +5300,42 @@ Maybe<bool> JSProxy::HasProperty(Isolate* isolate, Handle<JSProxy> proxy,
   bool boolean_trap_result = trap_result_obj->BooleanValue();
   // 9. If booleanTrapResult is false, then:
   if (!boolean_trap_result) {
-    // 9a. Let targetDesc be ? target.[[GetOwnProperty]](P).
-    PropertyDescriptor target_desc;
-    Maybe<bool> target_found = JSReceiver::GetOwnPropertyDescriptor(
-        isolate, target, name, &target_desc);
-    MAYBE_RETURN(target_found, Nothing<bool>());
-    // 9b. If targetDesc is not undefined, then:
-    if (target_found.FromJust()) {
-      // 9b i. If targetDesc.[[Configurable]] is false, throw a TypeError
-      //       exception.
-      if (!target_desc.configurable()) {
-        isolate->Throw(*isolate->factory()->NewTypeError(
-            MessageTemplate::kProxyHasNonConfigurable, name));
-        return Nothing<bool>();
-      }
-      // 9b ii. Let extensibleTarget be ? IsExtensible(target).
-      Maybe<bool> extensible_target = JSReceiver::IsExtensible(target);
-      MAYBE_RETURN(extensible_target, Nothing<bool>());
-      // 9b iii. If extensibleTarget is false, throw a TypeError exception.
-      if (!extensible_target.FromJust()) {
-        isolate->Throw(*isolate->factory()->NewTypeError(
-            MessageTemplate::kProxyHasNonExtensible, name));
-        return Nothing<bool>();
-      }
-    }
+    MAYBE_RETURN(CheckHasTrap(isolate, name, target), Nothing<bool>());
   }
   // 10. Return booleanTrapResult.
   return Just(boolean_trap_result);
 }
 
+// static
+Maybe<bool> JSProxy::CheckHasTrap(Isolate* isolate, Handle<Name> name,
+                                  Handle<JSReceiver> target) {
+  // 9a. Let targetDesc be ? target.[[GetOwnProperty]](P).
+  PropertyDescriptor target_desc;
+  Maybe<bool> target_found =
+      JSReceiver::GetOwnPropertyDescriptor(isolate, target, name, &target_desc);
+  MAYBE_RETURN(target_found, Nothing<bool>());
+  // 9b. If targetDesc is not undefined, then:
+  if (target_found.FromJust()) {
+    // 9b i. If targetDesc.[[Configurable]] is false, throw a TypeError
+    //       exception.
+    if (!target_desc.configurable()) {
+      isolate->Throw(*isolate->factory()->NewTypeError(
+          MessageTemplate::kProxyHasNonConfigurable, name));
+      return Nothing<bool>();
+    }
+    // 9b ii. Let extensibleTarget be ? IsExtensible(target).
+    Maybe<bool> extensible_target = JSReceiver::IsExtensible(target);
+    MAYBE_RETURN(extensible_target, Nothing<bool>());
+    // 9b iii. If extensibleTarget is false, throw a TypeError exception.
+    if (!extensible_target.FromJust()) {
+      isolate->Throw(*isolate->factory()->NewTypeError(
+          MessageTemplate::kProxyHasNonExtensible, name));
+      return Nothing<bool>();
+    }
+  }
+  return Just(true);
+}
+
 
 Maybe<bool> JSProxy::SetProperty(Handle<JSProxy> proxy, Handle<Name> name,
                                  Handle<Object> value, Handle<Object> receiver,
@@ -5179,29 +5379,9 @@ Maybe<bool> JSProxy::SetProperty(Handle<JSProxy> proxy, Handle<Name> name,
   }
 
   // Enforce the invariant.
-  PropertyDescriptor target_desc;
-  Maybe<bool> owned =
-      JSReceiver::GetOwnPropertyDescriptor(isolate, target, name, &target_desc);
-  MAYBE_RETURN(owned, Nothing<bool>());
-  if (owned.FromJust()) {
-    bool inconsistent = PropertyDescriptor::IsDataDescriptor(&target_desc) &&
-                        !target_desc.configurable() &&
-                        !target_desc.writable() &&
-                        !value->SameValue(*target_desc.value());
-    if (inconsistent) {
-      isolate->Throw(*isolate->factory()->NewTypeError(
-          MessageTemplate::kProxySetFrozenData, name));
-      return Nothing<bool>();
-    }
-    inconsistent = PropertyDescriptor::IsAccessorDescriptor(&target_desc) &&
-                   !target_desc.configurable() &&
-                   target_desc.set()->IsUndefined(isolate);
-    if (inconsistent) {
-      isolate->Throw(*isolate->factory()->NewTypeError(
-          MessageTemplate::kProxySetFrozenAccessor, name));
-      return Nothing<bool>();
-    }
-  }
+  MaybeHandle<Object> result =
+      CheckGetSetTrapResult(isolate, name, target, value, kSet);
+  if (result.is_null()) return Nothing<bool>();
   return Just(true);
 }
 
@@ -5245,12 +5425,18 @@ Maybe<bool> JSProxy::DeletePropertyOrElement(Handle<JSProxy> proxy,
   }
 
   // Enforce the invariant.
+  return CheckDeleteTrap(isolate, name, target);
+}
+
+// static
+Maybe<bool> JSProxy::CheckDeleteTrap(Isolate* isolate, Handle<Name> name,
+                                     Handle<JSReceiver> target) {
   PropertyDescriptor target_desc;
   Maybe<bool> owned =
       JSReceiver::GetOwnPropertyDescriptor(isolate, target, name, &target_desc);
   MAYBE_RETURN(owned, Nothing<bool>());
   if (owned.FromJust() && !target_desc.configurable()) {
-    isolate->Throw(*factory->NewTypeError(
+    isolate->Throw(*isolate->factory()->NewTypeError(
         MessageTemplate::kProxyDeletePropertyNonConfigurable, name));
     return Nothing<bool>();
   }
@@ -11672,7 +11858,9 @@ uint32_t StringHasher::GetHashField() {
     return (GetHashCore(raw_running_hash_) << String::kHashShift) |
            String::kIsNotArrayIndexMask;
   } else {
-    return (length_ << String::kHashShift) | String::kIsNotArrayIndexMask;
+    return (GetLongStringHashCore(raw_running_hash_, length_)
+            << String::kHashShift) |
+           String::kIsNotArrayIndexMask;
   }
 }
 
@@ -11706,15 +11894,17 @@ uint32_t StringHasher::ComputeUtf8Hash(Vector<const char> chars,
     bool is_two_characters = c > unibrow::Utf16::kMaxNonSurrogateCharCode;
     utf16_length += is_two_characters ? 2 : 1;
     // No need to keep hashing. But we do need to calculate utf16_length.
-    if (utf16_length > String::kMaxHashCalcLength) continue;
+    if (utf16_length > String::kMaxHashCalcLength + 1) continue;
     if (is_two_characters) {
       uint16_t c1 = unibrow::Utf16::LeadSurrogate(c);
       uint16_t c2 = unibrow::Utf16::TrailSurrogate(c);
       hasher.AddCharacter(c1);
-      hasher.AddCharacter(c2);
       if (is_index) is_index = hasher.UpdateIndex(c1);
+      // The trail surrogate may be just past the hashed prefix.
+      if (utf16_length > String::kMaxHashCalcLength) continue;
+      hasher.AddCharacter(c2);
       if (is_index) is_index = hasher.UpdateIndex(c2);
-    } else {
+    } else if (utf16_length <= String::kMaxHashCalcLength) {
       hasher.AddCharacter(c);
       if (is_index) is_index = hasher.UpdateIndex(c);
     }
@@ -13244,6 +13434,14 @@ bool SharedFunctionInfo::HasSourceCode() const {
          !reinterpret_cast<Script*>(script())->source()->IsUndefined(isolate);
 }
 
+// static
+bool SharedFunctionInfo::EnsureSourcePositionsAvailable(
+    Handle<SharedFunctionInfo> shared_info) {
+  if (!FLAG_enable_lazy_source_positions) return true;
+  if (!shared_info->HasBytecodeArray()) return true;
+  if (shared_info->bytecode_array()->HasSourcePositionTable()) return true;
+  return Compiler::CollectSourcePositions(shared_info);
+}
 
 Handle<Object> SharedFunctionInfo::GetSourceCode() {
   if (!HasSourceCode()) return GetIsolate()->factory()->undefined_value();
@@ -13689,6 +13887,8 @@ void SetStackFrameCacheCommon(Handle<Code> code,
         ->set_stack_frame_cache(*cache);
     return;
   }
+  // Positions that are not collected yet would be cached wrongly.
+  if (maybe_table->IsUndefined(code->GetIsolate())) return;
   DCHECK(maybe_table->IsByteArray());
   Handle<ByteArray> table(Handle<ByteArray>::cast(maybe_table));
   Handle<SourcePositionTableWithFrameCache> table_with_cache =
@@ -13713,6 +13913,7 @@ template <typename Code>
 void DropStackFrameCacheCommon(Code* code) {
   i::Object* maybe_table = code->source_position_table();
   if (maybe_table->IsByteArray()) return;
+  if (maybe_table->IsUndefined(code->GetIsolate())) return;
   DCHECK(maybe_table->IsSourcePositionTableWithFrameCache());
   code->set_source_position_table(
       i::SourcePositionTableWithFrameCache::cast(maybe_table)
@@ -13937,6 +14138,24 @@ void Code::PrintDeoptLocation(FILE* out, Address pc) {
 }
 
 
+bool Code::IsIsolateIndependent() {
+  static const int kModeMask =
+      RelocInfo::ModeMask(RelocInfo::CODE_TARGET) |
+      RelocInfo::ModeMask(RelocInfo::EMBEDDED_OBJECT) |
+      RelocInfo::ModeMask(RelocInfo::CELL) |
+      RelocInfo::ModeMask(RelocInfo::RUNTIME_ENTRY) |
+      RelocInfo::ModeMask(RelocInfo::EXTERNAL_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE_ENCODED) |
+      RelocInfo::ModeMask(RelocInfo::WASM_MEMORY_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::WASM_GLOBAL_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::WASM_MEMORY_SIZE_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::WASM_FUNCTION_TABLE_SIZE_REFERENCE);
+  RelocIterator it(this, kModeMask);
+  return it.done();
+}
+
+
 bool Code::CanDeoptAt(Address pc) {
   DeoptimizationInputData* deopt_data =
       DeoptimizationInputData::cast(deoptimization_data());
@@ -16884,8 +17103,8 @@ MaybeHandle<String> StringTable::LookupTwoCharsStringIfExists(
   return result;
 }
 
-void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
-                                                   int expected) {
+void StringTable::EnsureCapacityForBulkInsert(Isolate* isolate,
+                                              int expected) {
   Handle<StringTable> table = isolate->factory()->string_table();
   // We need a key instance for the virtual hash function.
   table = StringTable::EnsureCapacity(table, expected);
@@ -17167,6 +17386,16 @@ Object* StringTable::LookupStringIfExists_NoAllocate(String* string) {
   return Smi::FromInt(ResultSentinel::kNotFound);
 }
 
+int StringTable::AddWithoutGrowing(String* string) {
+  DisallowHeapAllocation no_gc;
+  DCHECK(string->IsInternalizedString());
+  if (!HasSufficientCapacityToAdd(1)) return kNotFound;
+  int entry = FindInsertionEntry(string->Hash());
+  set(EntryToIndex(entry), string, SKIP_WRITE_BARRIER);
+  ElementAdded();
+  return entry;
+}
+
 String* StringTable::LookupKeyIfExists(Isolate* isolate, StringTableKey* key) {
   Handle<StringTable> table = isolate->factory()->string_table();
   int entry = table->FindEntry(isolate, key);
@@ -17706,17 +17935,25 @@ int Dictionary<Derived, Shape>::NumberOfEnumerableProperties() {
 }
 
 
+// Sorts the first {length} entry numbers in {storage} by the enumeration
+// index of the dictionary entry they refer to. The enumeration indices are
+// read once up front and sorted together with the entry numbers in a
+// contiguous side buffer, so comparisons do not touch the dictionary.
 template <typename Dictionary>
-struct EnumIndexComparator {
-  explicit EnumIndexComparator(Dictionary* dict) : dict(dict) {}
-  bool operator()(const base::AtomicElement<Smi*>& a,
-                  const base::AtomicElement<Smi*>& b) {
-    PropertyDetails da(dict->DetailsAt(a.value()->value()));
-    PropertyDetails db(dict->DetailsAt(b.value()->value()));
-    return da.dictionary_index() < db.dictionary_index();
-  }
-  Dictionary* dict;
-};
+void SortByEnumerationIndex(Dictionary* dictionary, FixedArray* storage,
+                            int length) {
+  std::vector<uint64_t> order(length);
+  for (int i = 0; i < length; i++) {
+    int entry = Smi::cast(storage->get(i))->value();
+    PropertyDetails details = dictionary->DetailsAt(entry);
+    order[i] = (static_cast<uint64_t>(details.dictionary_index()) << 32) |
+               static_cast<uint32_t>(entry);
+  }
+  std::sort(order.begin(), order.end());
+  for (int i = 0; i < length; i++) {
+    storage->set(i, Smi::FromInt(static_cast<uint32_t>(order[i])));
+  }
+}
 
 template <typename Derived, typename Shape>
 void BaseNameDictionary<Derived, Shape>::CopyEnumKeysTo(
@@ -17755,13 +17992,7 @@ void BaseNameDictionary<Derived, Shape>::CopyEnumKeysTo(
   DisallowHeapAllocation no_gc;
   Derived* raw_dictionary = *dictionary;
   FixedArray* raw_storage = *storage;
-  EnumIndexComparator<Derived> cmp(raw_dictionary);
-  // Use AtomicElement wrapper to ensure that std::sort uses atomic load and
-  // store operations that are safe for concurrent marking.
-  base::AtomicElement<Smi*>* start =
-      reinterpret_cast<base::AtomicElement<Smi*>*>(
-          storage->GetFirstElementAddress());
-  std::sort(start, start + length, cmp);
+  SortByEnumerationIndex(raw_dictionary, raw_storage, length);
   for (int i = 0; i < length; i++) {
     int index = Smi::cast(raw_storage->get(i))->value();
     raw_storage->set(i, raw_dictionary->KeyAt(index));
@@ -17788,13 +18019,7 @@ Handle<FixedArray> BaseNameDictionary<Derived, Shape>::IterationIndices(
 
     DCHECK_EQ(array_size, length);
 
-    EnumIndexComparator<Derived> cmp(raw_dictionary);
-    // Use AtomicElement wrapper to ensure that std::sort uses atomic load and
-    // store operations that are safe for concurrent marking.
-    base::AtomicElement<Smi*>* start =
-        reinterpret_cast<base::AtomicElement<Smi*>*>(
-            array->GetFirstElementAddress());
-    std::sort(start, start + array_size, cmp);
+    SortByEnumerationIndex(raw_dictionary, *array, array_size);
   }
   array->Shrink(array_size);
   return array;
@@ -17833,13 +18058,7 @@ void BaseNameDictionary<Derived, Shape>::CollectKeysTo(
       array->set(array_size++, Smi::FromInt(i));
     }
 
-    EnumIndexComparator<Derived> cmp(raw_dictionary);
-    // Use AtomicElement wrapper to ensure that std::sort uses atomic load and
-    // store operations that are safe for concurrent marking.
-    base::AtomicElement<Smi*>* start =
-        reinterpret_cast<base::AtomicElement<Smi*>*>(
-            array->GetFirstElementAddress());
-    std::sort(start, start + array_size, cmp);
+    SortByEnumerationIndex(raw_dictionary, *array, array_size);
   }
 
   bool has_seen_symbol = false;
@@ -19014,10 +19233,8 @@ void JSArrayBuffer::FreeBackingStore() {
   if (allocation_base() == nullptr) {
     return;
   }
-  using AllocationMode = ArrayBuffer::Allocator::AllocationMode;
-  const size_t length = allocation_length();
-  const AllocationMode mode = allocation_mode();
-  GetIsolate()->array_buffer_allocator()->Free(allocation_base(), length, mode);
+  FreeBackingStore(GetIsolate(), {allocation_base(), allocation_length(),
+                                  allocation_mode()});
 
   // Zero out the backing store and allocation base to avoid dangling
   // pointers.
@@ -19029,6 +19246,12 @@ void JSArrayBuffer::FreeBackingStore() {
   set_allocation_length(0);
 }
 
+// static
+void JSArrayBuffer::FreeBackingStore(Isolate* isolate, Allocation allocation) {
+  isolate->array_buffer_allocator()->Free(allocation.allocation_base,
+                                          allocation.length, allocation.mode);
+}
+
 void JSArrayBuffer::Setup(Handle<JSArrayBuffer> array_buffer, Isolate* isolate,
                           bool is_external, void* data, size_t allocated_length,
                           SharedFlag shared) {
@@ -19458,6 +19681,10 @@ class Module::ResolveSet
 
   Zone* zone() const { return zone_; }
 
+  // Forgets the modules visited by the previous resolution, so that the set
+  // (and its zone) can be reused for the next top-level import or export.
+  void Reset() { clear(); }
+
  private:
   Zone* zone_;
 };
@@ -19672,8 +19899,10 @@ MaybeHandle<Cell> Module::ResolveExportUsingStarExports(
 
 bool Module::Instantiate(Handle<Module> module, v8::Local<v8::Context> context,
                          v8::Module::ResolveCallback callback) {
-  return PrepareInstantiate(module, context, callback) &&
-         FinishInstantiate(module, context);
+  if (!PrepareInstantiate(module, context, callback)) return false;
+  Zone zone(module->GetIsolate()->allocator(), ZONE_NAME);
+  ResolveSet resolve_set(&zone);
+  return FinishInstantiate(module, context, &resolve_set);
 }
 
 bool Module::PrepareInstantiate(Handle<Module> module,
@@ -19736,7 +19965,8 @@ bool Module::PrepareInstantiate(Handle<Module> module,
 }
 
 bool Module::FinishInstantiate(Handle<Module> module,
-                               v8::Local<v8::Context> context) {
+                               v8::Local<v8::Context> context,
+                               ResolveSet* resolve_set) {
   DCHECK_EQ(module->status(), kPrepared);
   if (module->instantiated()) return true;
 
@@ -19757,12 +19987,13 @@ bool Module::FinishInstantiate(Handle<Module> module,
   for (int i = 0, length = requested_modules->length(); i < length; ++i) {
     Handle<Module> requested_module(Module::cast(requested_modules->get(i)),
                                     isolate);
-    if (!FinishInstantiate(requested_module, context)) return false;
+    if (!FinishInstantiate(requested_module, context, resolve_set)) {
+      return false;
+    }
   }
 
-  Zone zone(isolate->allocator(), ZONE_NAME);
-
   // Resolve imports.
+  Handle<Script> script(Script::cast(shared->script()), isolate);
   Handle<ModuleInfo> module_info(shared->scope_info()->ModuleDescriptorInfo(),
                                  isolate);
   Handle<FixedArray> regular_imports(module_info->regular_imports(), isolate);
@@ -19770,14 +20001,11 @@ bool Module::FinishInstantiate(Handle<Module> module,
     Handle<ModuleInfoEntry> entry(
         ModuleInfoEntry::cast(regular_imports->get(i)), isolate);
     Handle<String> name(String::cast(entry->import_name()), isolate);
-    Handle<Script> script(
-        Script::cast(JSFunction::cast(module->code())->shared()->script()),
-        isolate);
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(&zone);
+    resolve_set->Reset();
     Handle<Cell> cell;
     if (!ResolveImport(module, name, entry->module_request(), loc, true,
-                       &resolve_set)
+                       resolve_set)
              .ToHandle(&cell)) {
       return false;
     }
@@ -19791,13 +20019,14 @@ bool Module::FinishInstantiate(Handle<Module> module,
         ModuleInfoEntry::cast(special_exports->get(i)), isolate);
     Handle<Object> name(entry->export_name(), isolate);
     if (name->IsUndefined(isolate)) continue;  // Star export.
-    Handle<Script> script(
-        Script::cast(JSFunction::cast(module->code())->shared()->script()),
-        isolate);
+    if (module->exports()->Lookup(Handle<String>::cast(name))->IsCell()) {
+      // Already resolved while resolving an import of another module.
+      continue;
+    }
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(&zone);
+    resolve_set->Reset();
     if (ResolveExport(module, Handle<String>::cast(name), loc, true,
-                      &resolve_set)
+                      resolve_set)
             .is_null()) {
       return false;
     }
@@ -988,6 +988,7 @@ template <class C> inline bool Is(Object* obj);
   V(Callable)                          \
   V(CallHandlerInfo)                   \
   V(Cell)                              \
+  V(ClassBoilerplate)                  \
   V(Code)                              \
   V(CodeCacheHashTable)                \
   V(CompilationCacheTable)             \
@@ -1607,6 +1608,10 @@ class Smi: public Object {
 
   DECLARE_CAST(Smi)
 
+  // Compares {x} and {y} as if they were converted to strings and then
+  // compared lexicographically.
+  static CompareResult LexicographicCompare(Smi* x, Smi* y);
+
   // Dispatched behavior.
   V8_EXPORT_PRIVATE void SmiPrint(std::ostream& os) const;  // NOLINT
   DECLARE_VERIFIER(Smi)
@@ -3233,9 +3238,13 @@ class BytecodeArray : public FixedArrayBase {
   DECL_ACCESSORS(handler_table, FixedArray)
 
   // Accessors for source position table containing mappings between byte code
-  // offset and source position or SourcePositionTableWithFrameCache.
+  // offset and source position or SourcePositionTableWithFrameCache. The table
+  // is undefined if source positions are collected lazily and have not been
+  // needed yet.
   DECL_ACCESSORS(source_position_table, Object)
 
+  inline bool HasSourcePositionTable();
+  // Returns the empty byte array if the table has not been collected yet.
   inline ByteArray* SourcePositionTable();
 
   DECLARE_CAST(BytecodeArray)
@@ -3898,6 +3907,11 @@ class Code: public HeapObject {
   // Returns true if pc is inside this object's instructions.
   inline bool contains(byte* pc);
 
+  // Returns true if the instructions neither refer to heap objects, code
+  // targets or external addresses nor to absolute addresses within the code
+  // itself, so that they could be shared by all isolates.
+  bool IsIsolateIndependent();
+
   // Relocate the code by delta bytes. Called to signal that this code
   // object has been moved by delta bytes.
   void Relocate(intptr_t delta);
@@ -4945,8 +4959,12 @@ class Module : public Struct {
   static MUST_USE_RESULT bool PrepareInstantiate(
       Handle<Module> module, v8::Local<v8::Context> context,
       v8::Module::ResolveCallback callback);
+  // Resolves the imports and indirect exports of all modules in the graph.
+  // Resolved cells are recorded in the export tables, so every binding is
+  // resolved at most once per graph; [resolve_set] is shared by all modules.
   static MUST_USE_RESULT bool FinishInstantiate(Handle<Module> module,
-                                                v8::Local<v8::Context> context);
+                                                v8::Local<v8::Context> context,
+                                                ResolveSet* resolve_set);
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(Module);
 };
@@ -5680,8 +5698,20 @@ class JSRegExp: public JSObject {
   // Maps names of named capture groups (at indices 2i) to their corresponding
   // (1-based) capture group indices (at indices 2i + 1).
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 6;
-
-  static const int kIrregexpDataSize = kIrregexpCaptureNameMapIndex + 1;
+  // Number of executions left in the bytecode interpreter before the regexp
+  // is compiled to native code. Only used with --regexp-tier-up.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 7;
+  // Number of backtracks after which the interpreter gives up and the regexp
+  // is matched by the linear-time RegExpNfaMatcher, or 0 for no limit. Only
+  // used with --regexp-backtrack-limit.
+  static const int kIrregexpBacktrackLimitIndex = kDataIndex + 8;
+  // A String that every match contains, or Smi 0. Used to skip the parts of
+  // the subject that cannot match.
+  static const int kIrregexpPrefilterIndex = kDataIndex + 9;
+  // Smi 1 if every match starts with the prefilter literal, or Smi 0.
+  static const int kIrregexpPrefilterIsPrefixIndex = kDataIndex + 10;
+
+  static const int kIrregexpDataSize = kIrregexpPrefilterIsPrefixIndex + 1;
 
   // In-object fields.
   static const int kLastIndexFieldIndex = 0;
@@ -6189,6 +6219,24 @@ class JSProxy: public JSReceiver {
       Isolate* isolate, Handle<JSProxy> proxy, Handle<Name> name,
       Handle<Object> receiver, bool* was_found);
 
+  enum AccessKind { kGet, kSet };
+
+  // Enforces the invariants of the get and set traps. For the set trap the
+  // {trap_result} is the value that was stored.
+  MUST_USE_RESULT static MaybeHandle<Object> CheckGetSetTrapResult(
+      Isolate* isolate, Handle<Name> name, Handle<JSReceiver> target,
+      Handle<Object> trap_result, AccessKind access_kind);
+
+  // Enforces the invariants of a has trap that returned false.
+  MUST_USE_RESULT static Maybe<bool> CheckHasTrap(Isolate* isolate,
+                                                  Handle<Name> name,
+                                                  Handle<JSReceiver> target);
+
+  // Enforces the invariants of a deleteProperty trap that returned true.
+  MUST_USE_RESULT static Maybe<bool> CheckDeleteTrap(Isolate* isolate,
+                                                     Handle<Name> name,
+                                                     Handle<JSReceiver> target);
+
   // ES6 9.5.9
   MUST_USE_RESULT static Maybe<bool> SetProperty(Handle<JSProxy> proxy,
                                                  Handle<Name> name,
@@ -6491,7 +6539,20 @@ class JSArrayBuffer: public JSObject {
 
   inline ArrayBuffer::Allocator::AllocationMode allocation_mode() const;
 
+  // The part of a JSArrayBuffer that is needed to free its backing store,
+  // which stays valid after the buffer itself has been collected.
+  struct Allocation {
+    Allocation(void* allocation_base, size_t length,
+               ArrayBuffer::Allocator::AllocationMode mode)
+        : allocation_base(allocation_base), length(length), mode(mode) {}
+
+    void* allocation_base;
+    size_t length;
+    ArrayBuffer::Allocator::AllocationMode mode;
+  };
+
   void FreeBackingStore();
+  static void FreeBackingStore(Isolate* isolate, Allocation allocation);
 
   V8_EXPORT_PRIVATE static void Setup(
       Handle<JSArrayBuffer> array_buffer, Isolate* isolate, bool is_external,
@@ -7075,6 +7136,15 @@ class FunctionTemplateInfo: public TemplateInfo {
 
   DECL_ACCESSORS(cached_property_name, Object)
 
+  // Either undefined or a Tuple2 of a Foreign holding the address of the
+  // fast C++ call handler and a Smi describing its signature, see
+  // v8::FunctionTemplate::SetFastCallHandler.
+  DECL_ACCESSORS(fast_call_info, Object)
+
+  // Bit fields of the signature Smi in {fast_call_info}.
+  class FastCallReturnsValueBit : public BitField<bool, 0, 1> {};
+  class FastCallArgumentCountBits : public BitField<int, 1, 3> {};
+
   DECLARE_CAST(FunctionTemplateInfo)
 
   // Dispatched behavior.
@@ -7106,7 +7176,9 @@ class FunctionTemplateInfo: public TemplateInfo {
   static const int kFlagOffset = kSharedFunctionInfoOffset + kPointerSize;
   static const int kLengthOffset = kFlagOffset + kPointerSize;
   static const int kCachedPropertyNameOffset = kLengthOffset + kPointerSize;
-  static const int kSize = kCachedPropertyNameOffset + kPointerSize;
+  static const int kFastCallInfoOffset =
+      kCachedPropertyNameOffset + kPointerSize;
+  static const int kSize = kFastCallInfoOffset + kPointerSize;
 
   static Handle<SharedFunctionInfo> GetOrCreateSharedFunctionInfo(
       Isolate* isolate, Handle<FunctionTemplateInfo> info);
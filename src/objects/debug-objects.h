@@ -160,6 +160,13 @@ class CoverageInfo : public FixedArray {
     return slot_count * kSlotIndexCount + kFirstSlotIndex;
   }
 
+  // Byte offset of the block count of the given slot, used by optimized code
+  // to increment the counter in place.
+  static int OffsetOfBlockCount(int slot_index) {
+    return FixedArray::OffsetOfElementAt(FirstIndexForSlot(slot_index) +
+                                         kSlotBlockCountIndex);
+  }
+
   DECLARE_CAST(CoverageInfo)
 
  private:
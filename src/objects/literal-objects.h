@@ -54,6 +54,56 @@ class ConstantElementsPair : public Tuple2 {
   DISALLOW_IMPLICIT_CONSTRUCTORS(ConstantElementsPair);
 };
 
+// ClassBoilerplate describes the methods and accessors of a {ClassLiteral}
+// without computed property names. It is built once per class literal and
+// used by {Runtime_DefineClassWithBoilerplate} to set up the prototype with
+// its final map and to install the static properties in bulk. The method
+// closures are passed as runtime arguments and referenced by their argument
+// index.
+//
+// Both property lists consist of entries of the form
+//   [name, kind, value or getter index, setter index]
+// where unused indices are kNoArgument and each name occurs only once.
+// The home object lists hold the indices of the closures that need their
+// home object set to the prototype or the constructor respectively.
+class ClassBoilerplate : public FixedArray {
+ public:
+  enum ValueKind { kData, kAccessor };
+
+  static const int kNoArgument = -1;
+
+  static const int kPrototypePropertiesIndex = 0;
+  static const int kStaticPropertiesIndex = 1;
+  static const int kPrototypeHomeObjectsIndex = 2;
+  static const int kStaticHomeObjectsIndex = 3;
+  static const int kBoilerplateLength = 4;
+
+  static const int kPrototypePropertiesOffset =
+      FixedArray::kHeaderSize + kPrototypePropertiesIndex * kPointerSize;
+  static const int kStaticPropertiesOffset =
+      FixedArray::kHeaderSize + kStaticPropertiesIndex * kPointerSize;
+  static const int kPrototypeHomeObjectsOffset =
+      FixedArray::kHeaderSize + kPrototypeHomeObjectsIndex * kPointerSize;
+  static const int kStaticHomeObjectsOffset =
+      FixedArray::kHeaderSize + kStaticHomeObjectsIndex * kPointerSize;
+
+  static const int kEntryNameIndex = 0;
+  static const int kEntryKindIndex = 1;
+  static const int kEntryFirstIndex = 2;
+  static const int kEntrySecondIndex = 3;
+  static const int kEntrySize = 4;
+
+  DECL_ACCESSORS(prototype_properties, FixedArray)
+  DECL_ACCESSORS(static_properties, FixedArray)
+  DECL_ACCESSORS(prototype_home_objects, FixedArray)
+  DECL_ACCESSORS(static_home_objects, FixedArray)
+
+  DECLARE_CAST(ClassBoilerplate)
+
+ private:
+  DISALLOW_IMPLICIT_CONSTRUCTORS(ClassBoilerplate);
+};
+
 }  // namespace internal
 }  // namespace v8
 
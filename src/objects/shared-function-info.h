@@ -326,6 +326,11 @@ class SharedFunctionInfo : public HeapObject {
   Handle<Object> GetSourceCode();
   Handle<Object> GetSourceCodeHarmony();
 
+  // Collects the source position table of the bytecode if it was left out
+  // at compile time. Returns false if the positions are still unavailable.
+  static bool EnsureSourcePositionsAvailable(
+      Handle<SharedFunctionInfo> shared_info);
+
   // Number of times the function was optimized.
   DECL_INT_ACCESSORS(opt_count)
 
@@ -32,9 +32,7 @@ class StringTableKey : public HashTableKey {
 
 class StringTableShape : public BaseShape<StringTableKey*> {
  public:
-  static inline bool IsMatch(Key key, Object* value) {
-    return key->IsMatch(value);
-  }
+  static inline bool IsMatch(Key key, Object* value);
 
   static inline uint32_t Hash(Isolate* isolate, Key key) { return key->Hash(); }
 
@@ -67,7 +65,15 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
       Isolate* isolate, uint16_t c1, uint16_t c2);
   static Object* LookupStringIfExists_NoAllocate(String* string);
 
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Makes room for |expected| new strings at once, so that adding them does
+  // not grow the table step by step.
+  static void EnsureCapacityForBulkInsert(Isolate* isolate, int expected);
+
+  // Adds an internalized string that is not in the table yet, without
+  // growing the table and without a write barrier. Used by the mark-compact
+  // collector, which cannot allocate and records the slot itself. Returns
+  // the entry, or kNotFound if the table is full.
+  int AddWithoutGrowing(String* string);
 
   DECLARE_CAST(StringTable)
 
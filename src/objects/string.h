@@ -346,8 +346,8 @@ class String : public Name {
   // Maximal string length.
   static const int kMaxLength = (1 << 28) - 16;
 
-  // Max length for computing hash. For strings longer than this limit the
-  // string length is used as the hash value.
+  // Max length for computing hash. For strings longer than this limit only
+  // the first kMaxHashCalcLength characters and the length are hashed.
   static const int kMaxHashCalcLength = 16383;
 
   // Limit for truncation in short printing.
@@ -594,6 +594,11 @@ class ConsString : public String {
   // Minimum length for a cons string.
   static const int kMinLength = 13;
 
+  // Appending a string to a cons string whose second part is not a cons
+  // string copies both into a new flat second part as long as it stays this
+  // short, which keeps chains built by repeated appends shallow.
+  static const int kMaxAppendChunkLength = 256;
+
   typedef FixedBodyDescriptor<kFirstOffset, kSecondOffset + kPointerSize, kSize>
       BodyDescriptor;
   // No weak fields.
@@ -2664,29 +2664,11 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   Expect(Token::LPAREN, CHECK_OK);
 
+  int task_start_pos = kNoSourcePosition;
   if (should_use_parse_task) {
-    int start_pos = scanner()->location().beg_pos;
-    if (function_name_location.IsValid()) {
-      start_pos = function_name_location.beg_pos;
-    }
-    // Warning!
-    // Only sets fields in compiler_hints that are currently used.
-    int compiler_hints = SharedFunctionInfo::FunctionKindBits::encode(kind);
-    if (function_type == FunctionLiteral::kDeclaration) {
-      compiler_hints |= SharedFunctionInfo::IsDeclarationBit::encode(true);
-    }
-    should_use_parse_task = compiler_dispatcher_->Enqueue(
-        source_, start_pos, source_->length(), language_mode,
-        function_literal_id, allow_natives(), parsing_module_,
-        function_type == FunctionLiteral::kNamedExpression, compiler_hints,
-        main_parse_info_, nullptr);
-    if (V8_UNLIKELY(FLAG_trace_parse_tasks)) {
-      PrintF("Spining off task for function at %d: %s\n", start_pos,
-             should_use_parse_task ? "SUCCESS" : "FAILED");
-    }
-    if (!should_use_parse_task) {
-      should_preparse = false;
-    }
+    task_start_pos = function_name_location.IsValid()
+                         ? function_name_location.beg_pos
+                         : scanner()->location().beg_pos;
   }
 
   Zone* outer_zone = zone();
@@ -2726,18 +2708,43 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
              should_use_parse_task);
       Scanner::BookmarkScope bookmark(scanner());
       bookmark.Set();
+      int last_function_literal_id = GetLastFunctionLiteralId();
       LazyParsingResult result = SkipFunction(
           function_name, kind, function_type, scope, &num_parameters,
           is_lazy_inner_function, is_lazy_top_level_function, CHECK_OK);
 
+      if (should_use_parse_task) {
+        // The preparser found the end of the function. Small functions are
+        // cheaper to parse here than to hand to a task; rewind and parse
+        // them eagerly, undoing what skipping them recorded.
+        DCHECK_EQ(kLazyParsingComplete, result);
+        int size = scope->end_position() - scope->start_position();
+        if (size < FLAG_parse_task_min_function_size &&
+            !FLAG_experimental_preparser_scope_analysis &&
+            !produce_cached_parse_data()) {
+          SkipFunctionLiterals(last_function_literal_id -
+                               GetLastFunctionLiteralId());
+          total_preparse_skipped_ -= size;
+          SetLanguageMode(scope, language_mode);
+          result = kLazyParsingAborted;
+        } else if (!EnqueueParseTask(task_start_pos, kind, function_type,
+                                     language_mode, function_literal_id)) {
+          // The function has been preparsed already; leave it to be
+          // compiled lazily, just like a failed parse task would.
+          should_use_parse_task = false;
+        }
+      }
+
       if (result == kLazyParsingAborted) {
-        DCHECK(is_lazy_top_level_function);
+        DCHECK(is_lazy_top_level_function || should_use_parse_task);
         bookmark.Apply();
-        // This is probably an initialization function. Inform the compiler it
-        // should also eager-compile this function, and that we expect it to be
-        // used once.
-        eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
-        should_be_used_once_hint = true;
+        if (is_lazy_top_level_function) {
+          // This is probably an initialization function. Inform the compiler
+          // it should also eager-compile this function, and that we expect it
+          // to be used once.
+          eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
+          should_be_used_once_hint = true;
+        }
         scope->ResetAfterPreparsing(ast_value_factory(), true);
         zone_scope.Reset();
         // Trigger eager (re-)parsing, just below this block.
@@ -2818,6 +2825,28 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   return function_literal;
 }
 
+bool Parser::EnqueueParseTask(int start_pos, FunctionKind kind,
+                              FunctionLiteral::FunctionType function_type,
+                              LanguageMode language_mode,
+                              int function_literal_id) {
+  // Warning!
+  // Only sets fields in compiler_hints that are currently used.
+  int compiler_hints = SharedFunctionInfo::FunctionKindBits::encode(kind);
+  if (function_type == FunctionLiteral::kDeclaration) {
+    compiler_hints |= SharedFunctionInfo::IsDeclarationBit::encode(true);
+  }
+  bool enqueued = compiler_dispatcher_->Enqueue(
+      source_, start_pos, source_->length(), language_mode,
+      function_literal_id, allow_natives(), parsing_module_,
+      function_type == FunctionLiteral::kNamedExpression, compiler_hints,
+      main_parse_info_, nullptr);
+  if (V8_UNLIKELY(FLAG_trace_parse_tasks)) {
+    PrintF("Spining off task for function at %d: %s\n", start_pos,
+           enqueued ? "SUCCESS" : "FAILED");
+  }
+  return enqueued;
+}
+
 Parser::LazyParsingResult Parser::SkipFunction(
     const AstRawString* function_name, FunctionKind kind,
     FunctionLiteral::FunctionType function_type,
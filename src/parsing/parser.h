@@ -562,6 +562,12 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
                                  int* num_parameters, bool is_inner_function,
                                  bool may_abort, bool* ok);
 
+  // Hand the body of an eager top-level function starting at |start_pos| to
+  // a background parse task. Returns true if a task was enqueued.
+  bool EnqueueParseTask(int start_pos, FunctionKind kind,
+                        FunctionLiteral::FunctionType function_type,
+                        LanguageMode language_mode, int function_literal_id);
+
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters, bool* ok);
   Block* BuildRejectPromiseOnException(Block* block);
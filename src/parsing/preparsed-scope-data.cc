@@ -22,6 +22,13 @@ class VariableContextAllocatedField
 
 const int kFunctionDataSize = 8;
 
+// Offset of the data length from the start of the data for a scope.
+#ifdef DEBUG
+const uint32_t kDataLengthOffset = 2;
+#else
+const uint32_t kDataLengthOffset = 1;
+#endif
+
 }  // namespace
 
 /*
@@ -31,7 +38,7 @@ const int kFunctionDataSize = 8;
   ------------------------------------
   | scope type << only in debug      |
   | inner_scope_calls_eval_          |
-  | data end index                   |
+  | data length                      |
   | ----------------------           |
   | | data for variables |           |
   | | ...                |           |
@@ -46,7 +53,10 @@ const int kFunctionDataSize = 8;
   | data for inner scope_n           |
   | ...                              |
   ------------------------------------
-  << data end index points here
+  << data length (counted from its own slot) points here
+
+  The data length is relative, so that the data for a function stays valid
+  when it is moved to another position in the backing store (see Merge).
  */
 
 void PreParsedScopeData::SaveData(Scope* scope) {
@@ -71,14 +81,17 @@ void PreParsedScopeData::SaveData(Scope* scope) {
     return;
   }
 
+  size_t function_data_start = backing_store_.size();
+  USE(function_data_start);
 #ifdef DEBUG
   backing_store_.push_back(scope->scope_type());
 #endif
   backing_store_.push_back(scope->inner_scope_calls_eval());
-  // Reserve space for the data end index (which we don't know yet). The end
-  // index is needed for skipping over data for a function scope when we skip
-  // parsing of the corresponding function.
-  size_t data_end_index = backing_store_.size();
+  // Reserve space for the data length (which we don't know yet). The length is
+  // needed for skipping over data for a function scope when we skip parsing of
+  // the corresponding function.
+  size_t data_length_index = backing_store_.size();
+  DCHECK_EQ(data_length_index, function_data_start + kDataLengthOffset);
   backing_store_.push_back(0);
 
   if (scope->scope_type() == ScopeType::FUNCTION_SCOPE) {
@@ -96,7 +109,8 @@ void PreParsedScopeData::SaveData(Scope* scope) {
   SaveDataForInnerScopes(scope);
 
   // FIXME(marja): see above.
-  backing_store_[data_end_index] = static_cast<uint32_t>(backing_store_.size());
+  backing_store_[data_length_index] =
+      static_cast<uint32_t>(backing_store_.size() - data_length_index);
 }
 
 void PreParsedScopeData::AddSkippableFunction(
@@ -137,9 +151,10 @@ void PreParsedScopeData::RestoreData(Scope* scope, uint32_t* index_ptr) const {
     // This scope is a function scope representing a function we want to
     // skip. So just skip over its data.
     DCHECK(!scope->must_use_preparsed_scope_data());
-    // Check that we're moving forward (not backward) in the data.
-    DCHECK_GT(backing_store_[index + 2], index);
-    index = backing_store_[index + 2];
+    uint32_t data_length_index = index + kDataLengthOffset;
+    DCHECK_GT(backing_store_.size(), data_length_index);
+    DCHECK_GT(backing_store_[data_length_index], 0);
+    index = data_length_index + backing_store_[data_length_index];
     return;
   }
 
@@ -161,13 +176,17 @@ void PreParsedScopeData::RestoreData(Scope* scope, uint32_t* index_ptr) const {
   }
 #endif
 
-  DCHECK_GE(backing_store_.size(), index + 3);
-  DCHECK_EQ(backing_store_[index++], scope->scope_type());
+  DCHECK_GE(backing_store_.size(), index + kDataLengthOffset + 1);
+#ifdef DEBUG
+  DCHECK_EQ(backing_store_[index], scope->scope_type());
+  index++;
+#endif
 
   if (backing_store_[index++]) {
     scope->RecordEvalCall();
   }
-  uint32_t data_end_index = backing_store_[index++];
+  uint32_t data_end_index = index + backing_store_[index];
+  index++;
   USE(data_end_index);
 
   if (scope->scope_type() == ScopeType::FUNCTION_SCOPE) {
@@ -251,6 +270,74 @@ void PreParsedScopeData::Deserialize(PodArray<uint32_t>* array) {
   }
 }
 
+// static
+Handle<PodArray<uint32_t>> PreParsedScopeData::Merge(
+    Isolate* isolate, Handle<PodArray<uint32_t>> first,
+    Handle<PodArray<uint32_t>> second) {
+  if (first->length() == 0) return second;
+  if (second->length() == 0) return first;
+  int first_count = first->get(0);
+  int second_count = second->get(0);
+  int first_entries_end = 1 + first_count * kFunctionDataSize;
+  int second_entries_end = 1 + second_count * kFunctionDataSize;
+  CHECK_GE(first->length(), first_entries_end);
+  CHECK_GE(second->length(), second_entries_end);
+
+  // Drop the entries of {second} for functions which {first} already has data
+  // for. Their data stays in the backing store, it contains the data for an
+  // enclosing function which is still needed.
+  std::set<uint32_t> first_functions;
+  for (int i = 1; i < first_entries_end; i += kFunctionDataSize) {
+    first_functions.insert(first->get(i));
+  }
+  std::vector<int> second_entries;
+  for (int i = 1; i < second_entries_end; i += kFunctionDataSize) {
+    if (first_functions.count(second->get(i)) == 0) second_entries.push_back(i);
+  }
+  if (second_entries.empty()) return first;
+
+  int first_data_length = first->length() - first_entries_end;
+  int second_data_length = second->length() - second_entries_end;
+  int count = first_count + static_cast<int>(second_entries.size());
+  int length =
+      1 + count * kFunctionDataSize + first_data_length + second_data_length;
+  Handle<PodArray<uint32_t>> array =
+      PodArray<uint32_t>::New(isolate, length, TENURED);
+
+  array->set(0, static_cast<uint32_t>(count));
+  int out = 1;
+  for (int i = 1; i < first_entries_end; ++i) array->set(out++, first->get(i));
+  for (int entry : second_entries) {
+    for (int i = 0; i < kFunctionDataSize; ++i) {
+      uint32_t value = second->get(entry + i);
+      // The data of {second} is appended after the data of {first}.
+      if (i == 1) value += static_cast<uint32_t>(first_data_length);
+      array->set(out++, value);
+    }
+  }
+  for (int i = first_entries_end; i < first->length(); ++i) {
+    array->set(out++, first->get(i));
+  }
+  for (int i = second_entries_end; i < second->length(); ++i) {
+    array->set(out++, second->get(i));
+  }
+  DCHECK_EQ(length, out);
+  return array;
+}
+
+bool PreParsedScopeData::HasFunctionData(int start_position) const {
+  uint32_t index;
+  return FindFunctionData(start_position, &index);
+}
+
+void PreParsedScopeData::Clear() {
+  backing_store_.clear();
+  function_index_ = PreParseData();
+  function_data_positions_.clear();
+  skippable_functions_.clear();
+  has_data_ = false;
+}
+
 PreParseData::FunctionData PreParsedScopeData::FindSkippableFunction(
     int start_pos) const {
   if (skippable_functions_.find(start_pos) == skippable_functions_.end()) {
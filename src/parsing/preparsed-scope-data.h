@@ -91,6 +91,23 @@ class PreParsedScopeData {
   Handle<PodArray<uint32_t>> Serialize(Isolate* isolate) const;
   void Deserialize(PodArray<uint32_t>* array);
 
+  // Combines two serialized data sets for the same script, e.g. the data
+  // produced by compiling the script and the data produced by lazily
+  // compiling a function it had no data for. Where both have data for a
+  // function, the data in {first} is kept.
+  static Handle<PodArray<uint32_t>> Merge(Isolate* isolate,
+                                          Handle<PodArray<uint32_t>> first,
+                                          Handle<PodArray<uint32_t>> second);
+
+  // Whether there is data for allocating the variables of the function
+  // starting at {start_position}.
+  bool HasFunctionData(int start_position) const;
+
+  // Drops all data, so that new data can be produced.
+  void Clear();
+
+  bool IsEmpty() const { return function_index_.size() == 0; }
+
   bool Consuming() const { return has_data_; }
 
   bool Producing() const { return !has_data_; }
@@ -350,9 +350,11 @@ DECLARATION_NODE_LIST(DEF_VISIT)
 #undef DEF_VISIT
 
 
-// Assumes code has been parsed.  Mutates the AST, so the AST should not
-// continue to be used in the case of failure.
-bool Rewriter::Rewrite(ParseInfo* info, Isolate* isolate) {
+namespace {
+
+// Returns false on stack overflow. Sets |*rewritten| if the AST was changed and
+// new values may have to be internalized.
+bool RewriteProgram(ParseInfo* info, bool* rewritten) {
   DisallowHeapAllocation no_allocation;
   DisallowHandleAllocation no_handles;
   DisallowHandleDereference no_deref;
@@ -367,6 +369,7 @@ bool Rewriter::Rewrite(ParseInfo* info, Isolate* isolate) {
   DCHECK_NOT_NULL(scope);
   DCHECK_EQ(scope, scope->GetClosureScope());
 
+  *rewritten = false;
   if (!(scope->is_script_scope() || scope->is_eval_scope() ||
         scope->is_module_scope())) {
     return true;
@@ -391,19 +394,34 @@ bool Rewriter::Rewrite(ParseInfo* info, Isolate* isolate) {
       body->Add(result_statement, info->zone());
     }
 
+    *rewritten = true;
+    if (processor.HasStackOverflow()) return false;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+// Assumes code has been parsed.  Mutates the AST, so the AST should not
+// continue to be used in the case of failure.
+bool Rewriter::Rewrite(ParseInfo* info, Isolate* isolate) {
+  bool rewritten = false;
+  bool success = RewriteProgram(info, &rewritten);
+  if (rewritten) {
     // TODO(leszeks): Remove this check and releases once internalization is
     // moved out of parsing/analysis. Also remove the parameter once done.
     DCHECK(ThreadId::Current().Equals(isolate->thread_id()));
-    no_deref.Release();
-    no_handles.Release();
-    no_allocation.Release();
 
     // Internalize any values created during rewriting.
     info->ast_value_factory()->Internalize(isolate);
-    if (processor.HasStackOverflow()) return false;
   }
+  return success;
+}
 
-  return true;
+bool Rewriter::RewriteOnBackgroundThread(ParseInfo* info) {
+  bool rewritten = false;
+  return RewriteProgram(info, &rewritten);
 }
 
 bool Rewriter::Rewrite(Parser* parser, DeclarationScope* closure_scope,
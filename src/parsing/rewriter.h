@@ -26,6 +26,11 @@ class Rewriter {
   // AST, so the AST should not continue to be used in the case of failure.
   static bool Rewrite(ParseInfo* info, Isolate* isolate);
 
+  // Like the above, but leaves the values created during rewriting
+  // uninternalized, so it can run on a background thread. The caller has to
+  // internalize the AstValueFactory on the main thread afterwards.
+  static bool RewriteOnBackgroundThread(ParseInfo* info);
+
   // Rewrite a list of statements, using the same rules as a top-level program,
   // to ensure identical behaviour of completion result.  The temporary is added
   // to the closure scope of the do-expression, which matches the closure scope
@@ -108,6 +108,10 @@ class ExternalTwoByteStringUtf16CharacterStream : public Utf16CharacterStream {
   ExternalTwoByteStringUtf16CharacterStream(Handle<ExternalTwoByteString> data,
                                             size_t start_position,
                                             size_t end_position);
+  // {data} holds the characters from {start_position} to {end_position}.
+  ExternalTwoByteStringUtf16CharacterStream(const uc16* data,
+                                            size_t start_position,
+                                            size_t end_position);
 
  private:
   bool ReadBlock() override;
@@ -121,9 +125,15 @@ ExternalTwoByteStringUtf16CharacterStream::
     ExternalTwoByteStringUtf16CharacterStream(
         Handle<ExternalTwoByteString> data, size_t start_position,
         size_t end_position)
-    : raw_data_(data->GetTwoByteData(static_cast<int>(start_position))),
-      start_pos_(start_position),
-      end_pos_(end_position) {
+    : ExternalTwoByteStringUtf16CharacterStream(
+          data->GetTwoByteData(static_cast<int>(start_position)),
+          start_position, end_position) {}
+
+ExternalTwoByteStringUtf16CharacterStream::
+    ExternalTwoByteStringUtf16CharacterStream(const uc16* data,
+                                              size_t start_position,
+                                              size_t end_position)
+    : raw_data_(data), start_pos_(start_position), end_pos_(end_position) {
   buffer_start_ = raw_data_;
   buffer_cursor_ = raw_data_;
   buffer_end_ = raw_data_ + (end_pos_ - start_pos_);
@@ -470,6 +480,21 @@ class TwoByteChunkSource : public ChunkSource {
   size_t byte_pos_ = 0;
 };
 
+// Returns the number of leading ASCII bytes in {data}, checking a word at a
+// time where possible.
+size_t AsciiPrefixLength(const uint8_t* data, size_t length) {
+  // String::NonAsciiStart may return the start of the word that contains the
+  // first non-ASCII byte, so finish byte by byte.
+  size_t prefix_length = static_cast<size_t>(
+      String::NonAsciiStart(reinterpret_cast<const char*>(data),
+                            static_cast<int>(Min<size_t>(length, kMaxInt))));
+  while (prefix_length < length &&
+         data[prefix_length] <= unibrow::Utf8::kMaxOneByteChar) {
+    ++prefix_length;
+  }
+  return prefix_length;
+}
+
 // ChunkSource that decodes incoming utf8 to two-byte chunks if needed.
 // Byte Order Mark at the beginning of the stream is skipped.
 // ASCII only chunks are kept as one-byte chunks.
@@ -485,12 +510,7 @@ class Utf8ChunkSource : public ChunkSource {
     if (incomplete_char_ != unibrow::Utf8::Utf8IncrementalBuffer(0)) {
       return 0;
     }
-    for (size_t i = 0; i < byte_length; ++i) {
-      if (data[i] > unibrow::Utf8::kMaxOneByteChar) {
-        return i;
-      }
-    }
-    return byte_length;
+    return AsciiPrefixLength(data, byte_length);
   }
   size_t ConvertToUtf16(const uint8_t* data, size_t byte_length,
                         size_t ascii_prefix_len, const uint8_t** result) {
@@ -503,6 +523,15 @@ class Utf8ChunkSource : public ChunkSource {
     i::CopyCharsUnsigned(decoded_data, data, ascii_prefix_len);
     size_t decoded_len = ascii_prefix_len;
     for (size_t i = ascii_prefix_len; i < byte_length; ++i) {
+      if (data[i] <= unibrow::Utf8::kMaxOneByteChar &&
+          incomplete_char_ == unibrow::Utf8::Utf8IncrementalBuffer(0)) {
+        // Copy runs of ASCII between other characters without decoding them.
+        size_t run_length = AsciiPrefixLength(data + i, byte_length - i);
+        i::CopyCharsUnsigned(decoded_data + decoded_len, data + i, run_length);
+        decoded_len += run_length;
+        i += run_length - 1;
+        continue;
+      }
       unibrow::uchar t =
           unibrow::Utf8::ValueOfIncremental(data[i], &incomplete_char_);
       if (t == unibrow::Utf8::kIncomplete) continue;
@@ -692,6 +721,14 @@ Utf16CharacterStream* ScannerStream::For(Handle<String> data, int start_pos,
   }
 }
 
+Utf16CharacterStream* ScannerStream::For(const uint16_t* data, int start_pos,
+                                         int end_pos) {
+  DCHECK(start_pos >= 0);
+  DCHECK(start_pos <= end_pos);
+  return new ExternalTwoByteStringUtf16CharacterStream(
+      data, static_cast<size_t>(start_pos), static_cast<size_t>(end_pos));
+}
+
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     const char* data) {
   return ScannerStream::ForTesting(data, strlen(data));
@@ -22,6 +22,12 @@ class V8_EXPORT_PRIVATE ScannerStream {
   static Utf16CharacterStream* For(Handle<String> data);
   static Utf16CharacterStream* For(Handle<String> data, int start_pos,
                                    int end_pos);
+  // A stream over characters that the caller keeps alive and in place, e.g. a
+  // copy of part of a source string. {data} holds the characters from
+  // {start_pos} to {end_pos}. Unlike streams over heap strings, it can be
+  // used on any thread.
+  static Utf16CharacterStream* For(const uint16_t* data, int start_pos,
+                                   int end_pos);
   static Utf16CharacterStream* For(
       ScriptCompiler::ExternalSourceStream* source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding,
@@ -429,6 +429,16 @@ Token::Value Scanner::PeekAhead() {
 }
 
 
+namespace {
+
+// ECMA-262, section 11.3 lists exactly four line terminators. Checking for
+// them directly is cheaper than a lookup in the unicode cache.
+inline bool IsLineTerminatorCodeUnit(uc32 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+}  // namespace
+
 Token::Value Scanner::SkipWhiteSpace() {
   int start_position = source_pos();
 
@@ -438,11 +448,14 @@ Token::Value Scanner::SkipWhiteSpace() {
       if (c0_ == kEndOfInput) break;
 
       // Advance as long as character is a WhiteSpace or LineTerminator.
-      // Remember if the latter is the case.
-      if (unicode_cache_->IsLineTerminator(c0_)) {
-        has_line_terminator_before_next_ = true;
-      } else if (!unicode_cache_->IsWhiteSpace(c0_)) {
-        break;
+      // Remember if the latter is the case. Spaces and tabs are checked
+      // first, since they are by far the most common.
+      if (c0_ != ' ' && c0_ != '\t') {
+        if (IsLineTerminatorCodeUnit(c0_)) {
+          has_line_terminator_before_next_ = true;
+        } else if (!unicode_cache_->IsWhiteSpace(c0_)) {
+          break;
+        }
       }
       Advance();
     }
@@ -489,16 +502,12 @@ Token::Value Scanner::SkipSingleHTMLComment() {
 }
 
 Token::Value Scanner::SkipSingleLineComment() {
-  Advance();
-
   // The line terminator at the end of the line is not considered
   // to be part of the single-line comment; it is recognized
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  while (c0_ != kEndOfInput && !unicode_cache_->IsLineTerminator(c0_)) {
-    Advance();
-  }
+  AdvanceUntil(IsLineTerminatorCodeUnit);
 
   return Token::WHITESPACE;
 }
@@ -506,8 +515,8 @@ Token::Value Scanner::SkipSingleLineComment() {
 
 Token::Value Scanner::SkipSourceURLComment() {
   TryToParseSourceURLComment();
-  while (c0_ != kEndOfInput && !unicode_cache_->IsLineTerminator(c0_)) {
-    Advance();
+  if (c0_ != kEndOfInput && !IsLineTerminatorCodeUnit(c0_)) {
+    AdvanceUntil(IsLineTerminatorCodeUnit);
   }
 
   return Token::WHITESPACE;
@@ -570,6 +579,13 @@ Token::Value Scanner::SkipMultiLineComment() {
   Advance();
 
   while (c0_ != kEndOfInput) {
+    if (c0_ != '*' && !IsLineTerminatorCodeUnit(c0_)) {
+      // Skip to the next character that can end the comment or make it
+      // count as a line terminator.
+      AdvanceUntil(
+          [](uc32 c) { return c == '*' || IsLineTerminatorCodeUnit(c); });
+      continue;
+    }
     uc32 ch = c0_;
     Advance();
     if (c0_ != kEndOfInput && unicode_cache_->IsLineTerminator(ch)) {
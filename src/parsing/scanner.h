@@ -7,6 +7,8 @@
 #ifndef V8_PARSING_SCANNER_H_
 #define V8_PARSING_SCANNER_H_
 
+#include <algorithm>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/char-predicates.h"
@@ -55,6 +57,28 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances past the next UTF-16 code unit {c} for which {check(c)} holds,
+  // and returns it. Skips the code units before it in a tight loop over the
+  // buffer. If there is no such code unit it returns kEndOfInput, with the
+  // same position as Advance() at the end of input.
+  template <typename FunctionType>
+  V8_INLINE uc32 AdvanceUntil(FunctionType check) {
+    while (true) {
+      const uint16_t* next_cursor =
+          std::find_if(buffer_cursor_, buffer_end_,
+                       [&check](uint16_t c) { return check(c); });
+      if (next_cursor != buffer_end_) {
+        buffer_cursor_ = next_cursor + 1;
+        return static_cast<uc32>(*next_cursor);
+      }
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked()) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -588,6 +612,14 @@ class Scanner {
     if (check_surrogate) HandleLeadSurrogate();
   }
 
+  // Advances to the next character for which {check} holds, skipping the
+  // characters in between without recording them.
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntil(FunctionType check) {
+    c0_ = source_->AdvanceUntil(check);
+    HandleLeadSurrogate();
+  }
+
   void HandleLeadSurrogate() {
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
       uc32 c1 = source_->Advance();
@@ -183,6 +183,18 @@ PerfJitLogger::~PerfJitLogger() {
   }
 }
 
+namespace {
+
+// Returns true for the per-function copies of the interpreter entry
+// trampoline created with --interpreted-frames-native-stack.
+bool IsFunctionTrampoline(AbstractCode* abstract_code,
+                          SharedFunctionInfo* shared) {
+  return shared != nullptr && abstract_code->IsCode() &&
+         abstract_code->GetCode()->is_interpreter_trampoline_builtin();
+}
+
+}  // namespace
+
 uint64_t PerfJitLogger::GetTimestamp() {
   struct timespec ts;
   int result = clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -198,7 +210,8 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
   if (FLAG_perf_basic_prof_only_functions &&
       (abstract_code->kind() != AbstractCode::FUNCTION &&
        abstract_code->kind() != AbstractCode::INTERPRETED_FUNCTION &&
-       abstract_code->kind() != AbstractCode::OPTIMIZED_FUNCTION)) {
+       abstract_code->kind() != AbstractCode::OPTIMIZED_FUNCTION &&
+       !IsFunctionTrampoline(abstract_code, shared))) {
     return;
   }
 
@@ -0,0 +1,213 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/pooling-array-buffer-allocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "src/base/bits.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/platform.h"
+#include "src/msan.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Reused blocks of at least this size are zeroed by recommitting their pages
+// instead of writing zeros.
+const size_t kMinLazilyZeroedSize = 1 * MB;
+
+base::LazyMutex allocators_mutex = LAZY_MUTEX_INITIALIZER;
+// All live pooling allocators, guarded by {allocators_mutex}.
+base::LazyInstance<std::vector<PoolingArrayBufferAllocator*>>::type
+    allocators = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+PoolingArrayBufferAllocator::PoolingArrayBufferAllocator() {
+  base::LockGuard<base::Mutex> guard(allocators_mutex.Pointer());
+  allocators.Pointer()->push_back(this);
+}
+
+PoolingArrayBufferAllocator::~PoolingArrayBufferAllocator() {
+  {
+    base::LockGuard<base::Mutex> guard(allocators_mutex.Pointer());
+    std::vector<PoolingArrayBufferAllocator*>* all = allocators.Pointer();
+    all->erase(std::remove(all->begin(), all->end(), this), all->end());
+  }
+  ClearPools();
+}
+
+void* PoolingArrayBufferAllocator::Allocate(size_t length) {
+  if (length > kMaxPooledBlockSize) return calloc(length, 1);
+  const bool zero_initialized = true;
+  return AllocateBlock(length, zero_initialized);
+}
+
+void* PoolingArrayBufferAllocator::AllocateUninitialized(size_t length) {
+  if (length > kMaxPooledBlockSize) return malloc(length);
+  const bool zero_initialized = false;
+  return AllocateBlock(length, zero_initialized);
+}
+
+void PoolingArrayBufferAllocator::Free(void* data, size_t length) {
+  if (data == nullptr) return;
+  if (length > kMaxPooledBlockSize) {
+    free(data);
+    return;
+  }
+  size_t size_class = SizeClassFor(length);
+  size_t block_size = BlockSizeOf(size_class);
+  {
+    Shard* shard = CurrentShard();
+    base::LockGuard<base::Mutex> guard(&shard->mutex);
+    if (shard->pooled_bytes + block_size <= kMaxPooledBytesPerShard) {
+      shard->blocks[size_class].push_back(data);
+      shard->pooled_bytes += block_size;
+      return;
+    }
+  }
+  ReleaseBlock(data, size_class);
+}
+
+void* PoolingArrayBufferAllocator::Reserve(size_t length) {
+  return base::VirtualMemory::ReserveRegion(length);
+}
+
+void PoolingArrayBufferAllocator::Free(void* data, size_t length,
+                                       AllocationMode mode) {
+  switch (mode) {
+    case AllocationMode::kNormal: {
+      return Free(data, length);
+    }
+    case AllocationMode::kReservation: {
+      base::VirtualMemory::ReleaseRegion(data, length);
+      return;
+    }
+  }
+}
+
+void PoolingArrayBufferAllocator::SetProtection(void* data, size_t length,
+                                                Protection protection) {
+  switch (protection) {
+    case Protection::kNoAccess: {
+      base::VirtualMemory::UncommitRegion(data, length);
+      return;
+    }
+    case Protection::kReadWrite: {
+      const bool is_executable = false;
+      base::VirtualMemory::CommitRegion(data, length, is_executable);
+      return;
+    }
+  }
+}
+
+void PoolingArrayBufferAllocator::ClearPools() {
+  for (Shard& shard : shards_) {
+    base::LockGuard<base::Mutex> guard(&shard.mutex);
+    for (size_t size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+      for (void* data : shard.blocks[size_class]) {
+        ReleaseBlock(data, size_class);
+      }
+      shard.blocks[size_class].clear();
+    }
+    shard.pooled_bytes = 0;
+  }
+}
+
+size_t PoolingArrayBufferAllocator::GetPooledBytes() {
+  size_t result = 0;
+  for (Shard& shard : shards_) {
+    base::LockGuard<base::Mutex> guard(&shard.mutex);
+    result += shard.pooled_bytes;
+  }
+  return result;
+}
+
+// static
+void PoolingArrayBufferAllocator::MemoryPressureNotification(
+    MemoryPressureLevel level) {
+  if (level == MemoryPressureLevel::kNone) return;
+  base::LockGuard<base::Mutex> guard(allocators_mutex.Pointer());
+  for (PoolingArrayBufferAllocator* allocator : *allocators.Pointer()) {
+    allocator->ClearPools();
+  }
+}
+
+// static
+size_t PoolingArrayBufferAllocator::SizeClassFor(size_t length) {
+  DCHECK_LE(length, kMaxPooledBlockSize);
+  if (length <= BlockSizeOf(0)) return 0;
+  size_t size_log2 =
+      64 - base::bits::CountLeadingZeros64(static_cast<uint64_t>(length - 1));
+  return size_log2 - kMinBlockSizeLog2;
+}
+
+PoolingArrayBufferAllocator::Shard*
+PoolingArrayBufferAllocator::CurrentShard() {
+  unsigned thread_id = static_cast<unsigned>(base::OS::GetCurrentThreadId());
+  return &shards_[thread_id % kNumShards];
+}
+
+void* PoolingArrayBufferAllocator::TakeFromPool(size_t size_class) {
+  Shard* shard = CurrentShard();
+  base::LockGuard<base::Mutex> guard(&shard->mutex);
+  std::vector<void*>& blocks = shard->blocks[size_class];
+  if (blocks.empty()) return nullptr;
+  void* data = blocks.back();
+  blocks.pop_back();
+  shard->pooled_bytes -= BlockSizeOf(size_class);
+  return data;
+}
+
+void* PoolingArrayBufferAllocator::AllocateBlock(size_t length,
+                                                 bool zero_initialized) {
+  size_t size_class = SizeClassFor(length);
+  size_t block_size = BlockSizeOf(size_class);
+  void* data = TakeFromPool(size_class);
+
+  if (IsSmallSizeClass(size_class)) {
+    if (data == nullptr) {
+      return zero_initialized ? calloc(block_size, 1) : malloc(block_size);
+    }
+    return zero_initialized ? memset(data, 0, length) : data;
+  }
+
+  if (data == nullptr) {
+    // Fresh pages are zero-initialized by the OS.
+    data = base::VirtualMemory::ReserveRegion(block_size);
+    if (data == nullptr) return nullptr;
+    if (!base::VirtualMemory::CommitRegion(data, block_size, false)) {
+      base::VirtualMemory::ReleaseRegion(data, block_size);
+      return nullptr;
+    }
+    MSAN_MEMORY_IS_INITIALIZED(data, block_size);
+    return data;
+  }
+  if (!zero_initialized) return data;
+  if (length < kMinLazilyZeroedSize) return memset(data, 0, length);
+  // Decommitting drops the old contents, the recommitted pages read as zero.
+  if (!base::VirtualMemory::UncommitRegion(data, block_size) ||
+      !base::VirtualMemory::CommitRegion(data, block_size, false)) {
+    base::VirtualMemory::ReleaseRegion(data, block_size);
+    return nullptr;
+  }
+  MSAN_MEMORY_IS_INITIALIZED(data, block_size);
+  return data;
+}
+
+void PoolingArrayBufferAllocator::ReleaseBlock(void* data, size_t size_class) {
+  if (IsSmallSizeClass(size_class)) {
+    free(data);
+  } else {
+    base::VirtualMemory::ReleaseRegion(data, BlockSizeOf(size_class));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,102 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_POOLING_ARRAY_BUFFER_ALLOCATOR_H_
+#define V8_POOLING_ARRAY_BUFFER_ALLOCATOR_H_
+
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// An ArrayBuffer::Allocator which keeps freed backing stores in size class
+// pools, so that buffers allocated at a high rate don't go to the system
+// allocator every time.
+//
+// Blocks of up to kMaxSmallBlockSize bytes come from malloc and are rounded
+// up to a power of two. Larger blocks up to kMaxPooledBlockSize are rounded
+// up to a power of two as well, but are backed by virtual memory: fresh ones
+// are zeroed by the OS, and big reused ones by decommitting and recommitting
+// them, which leaves the zeroing of the pages to the OS on first touch.
+// Bigger blocks are not pooled.
+//
+// To keep threads from contending on a single lock, the pools are split into
+// kNumShards shards, selected by the id of the current thread. All pools are
+// emptied on memory pressure.
+class V8_EXPORT_PRIVATE PoolingArrayBufferAllocator
+    : public v8::ArrayBuffer::Allocator {
+ public:
+  static const size_t kMinBlockSizeLog2 = 4;
+  static const size_t kMaxSmallBlockSizeLog2 = 16;
+  static const size_t kMaxPooledBlockSizeLog2 = 22;
+  static const size_t kMaxSmallBlockSize = size_t{1} << kMaxSmallBlockSizeLog2;
+  static const size_t kMaxPooledBlockSize = size_t{1}
+                                            << kMaxPooledBlockSizeLog2;
+  // The number of bytes each shard keeps pooled at most.
+  static const size_t kMaxPooledBytesPerShard = 8 * MB;
+  static const int kNumShards = 8;
+
+  PoolingArrayBufferAllocator();
+  ~PoolingArrayBufferAllocator() override;
+
+  void* Allocate(size_t length) override;
+  void* AllocateUninitialized(size_t length) override;
+  void Free(void* data, size_t length) override;
+
+  void* Reserve(size_t length) override;
+  void Free(void* data, size_t length, AllocationMode mode) override;
+  void SetProtection(void* data, size_t length,
+                     Protection protection) override;
+
+  // Returns all pooled blocks to the system.
+  void ClearPools();
+
+  // The number of bytes currently held in the pools.
+  size_t GetPooledBytes();
+
+  // Empties the pools of all pooling allocators unless {level} is kNone.
+  static void MemoryPressureNotification(MemoryPressureLevel level);
+
+ private:
+  static const size_t kNumSizeClasses =
+      kMaxPooledBlockSizeLog2 - kMinBlockSizeLog2 + 1;
+
+  struct Shard {
+    base::Mutex mutex;
+    size_t pooled_bytes = 0;
+    std::vector<void*> blocks[kNumSizeClasses];
+  };
+
+  // Returns the size class of a block of {length} bytes.
+  static size_t SizeClassFor(size_t length);
+  static size_t BlockSizeOf(size_t size_class) {
+    return size_t{1} << (size_class + kMinBlockSizeLog2);
+  }
+  static bool IsSmallSizeClass(size_t size_class) {
+    return BlockSizeOf(size_class) <= kMaxSmallBlockSize;
+  }
+
+  Shard* CurrentShard();
+
+  // Returns a pooled block of {size_class}, or nullptr if there is none.
+  void* TakeFromPool(size_t size_class);
+  // Allocates a block for {length} bytes, preferring pooled ones.
+  void* AllocateBlock(size_t length, bool zero_initialized);
+  // Returns the block to the system.
+  void ReleaseBlock(void* data, size_t size_class);
+
+  Shard shards_[kNumShards];
+
+  DISALLOW_COPY_AND_ASSIGN(PoolingArrayBufferAllocator);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_POOLING_ARRAY_BUFFER_ALLOCATOR_H_
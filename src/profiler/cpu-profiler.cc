@@ -272,6 +272,11 @@ void CpuProfiler::set_sampling_interval(base::TimeDelta value) {
   sampling_interval_ = value;
 }
 
+void CpuProfiler::set_streaming_interval(base::TimeDelta value) {
+  DCHECK(!is_profiling_);
+  streaming_interval_ = value;
+}
+
 void CpuProfiler::ResetProfiles() {
   profiles_.reset(new CpuProfilesCollection(isolate_));
   profiles_->set_cpu_profiler(this);
@@ -298,15 +303,17 @@ void CpuProfiler::CollectSample() {
   }
 }
 
-void CpuProfiler::StartProfiling(const char* title, bool record_samples) {
-  if (profiles_->StartProfiling(title, record_samples)) {
+void CpuProfiler::StartProfiling(const char* title, bool record_samples,
+                                 CpuProfilingMode mode) {
+  if (profiles_->StartProfiling(title, record_samples, mode)) {
     StartProcessorIfNotStarted();
   }
 }
 
 
-void CpuProfiler::StartProfiling(String* title, bool record_samples) {
-  StartProfiling(profiles_->GetName(title), record_samples);
+void CpuProfiler::StartProfiling(String* title, bool record_samples,
+                                 CpuProfilingMode mode) {
+  StartProfiling(profiles_->GetName(title), record_samples, mode);
   isolate_->debug()->feature_tracker()->Track(DebugFeatureTracker::kProfiler);
 }
 
@@ -329,6 +336,7 @@ void CpuProfiler::StartProcessorIfNotStarted() {
   profiler_listener->AddObserver(this);
   is_profiling_ = true;
   isolate_->set_is_profiling(true);
+  isolate_->CollectSourcePositionsForAllBytecodeArrays();
   // Enumerate stuff we already have in the heap.
   DCHECK(isolate_->heap()->HasBeenSetUp());
   if (!FLAG_prof_browser_mode) {
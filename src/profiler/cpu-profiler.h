@@ -196,9 +196,14 @@ class CpuProfiler : public CodeEventObserver {
   ~CpuProfiler() override;
 
   void set_sampling_interval(base::TimeDelta value);
+  // A zero interval means that profiles keep all their samples.
+  void set_streaming_interval(base::TimeDelta value);
+  base::TimeDelta streaming_interval() const { return streaming_interval_; }
   void CollectSample();
-  void StartProfiling(const char* title, bool record_samples = false);
-  void StartProfiling(String* title, bool record_samples);
+  void StartProfiling(const char* title, bool record_samples = false,
+                      CpuProfilingMode mode = kLeafNodeLineNumbers);
+  void StartProfiling(String* title, bool record_samples,
+                      CpuProfilingMode mode = kLeafNodeLineNumbers);
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String* title);
   int GetProfilesCount();
@@ -224,6 +229,7 @@ class CpuProfiler : public CodeEventObserver {
 
   Isolate* const isolate_;
   base::TimeDelta sampling_interval_;
+  base::TimeDelta streaming_interval_;
   std::unique_ptr<CpuProfilesCollection> profiles_;
   std::unique_ptr<ProfileGenerator> generator_;
   std::unique_ptr<ProfilerEventsProcessor> processor_;
@@ -97,6 +97,29 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::TakeSnapshotToStream(
+    v8::OutputStream* stream, v8::ActivityControl* control,
+    v8::HeapProfiler::ObjectNameResolver* resolver) {
+  std::unique_ptr<HeapSnapshot> snapshot(new HeapSnapshot(this, true));
+  bool generated;
+  {
+    // The generator's map from heap objects to entries is freed before
+    // serialization starts.
+    HeapSnapshotGenerator generator(snapshot.get(), control, resolver, heap());
+    generated = generator.GenerateSnapshot();
+  }
+  ids_->RemoveDeadEntries();
+  is_tracking_object_moves_ = true;
+
+  heap()->isolate()->debug()->feature_tracker()->Track(
+      DebugFeatureTracker::kHeapSnapshot);
+
+  if (!generated) return false;
+  HeapSnapshotJSONSerializer serializer(snapshot.get());
+  serializer.Serialize(stream);
+  return true;
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(
     uint64_t sample_interval, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags) {
@@ -114,9 +137,10 @@ void HeapProfiler::StopSamplingHeapProfiler() {
 }
 
 
-v8::AllocationProfile* HeapProfiler::GetAllocationProfile() {
+v8::AllocationProfile* HeapProfiler::GetAllocationProfile(
+    uint64_t since_sample_id) {
   if (sampling_heap_profiler_.get()) {
-    return sampling_heap_profiler_->GetAllocationProfile();
+    return sampling_heap_profiler_->GetAllocationProfile(since_sample_id);
   } else {
     return nullptr;
   }
@@ -30,12 +30,16 @@ class HeapProfiler {
   HeapSnapshot* TakeSnapshot(
       v8::ActivityControl* control,
       v8::HeapProfiler::ObjectNameResolver* resolver);
+  // Takes a snapshot, serializes it to |stream| and discards it.
+  bool TakeSnapshotToStream(v8::OutputStream* stream,
+                            v8::ActivityControl* control,
+                            v8::HeapProfiler::ObjectNameResolver* resolver);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
   void StopSamplingHeapProfiler();
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
-  AllocationProfile* GetAllocationProfile();
+  AllocationProfile* GetAllocationProfile(uint64_t since_sample_id = 0);
 
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
@@ -5,6 +5,7 @@
 #include "src/profiler/heap-snapshot-generator.h"
 
 #include <utility>
+#include <vector>
 
 #include "src/api.h"
 #include "src/code-stubs.h"
@@ -184,8 +185,9 @@ template <> struct SnapshotSizeConstants<8> {
 }  // namespace
 
 
-HeapSnapshot::HeapSnapshot(HeapProfiler* profiler)
+HeapSnapshot::HeapSnapshot(HeapProfiler* profiler, bool serialize_only)
     : profiler_(profiler),
+      serialize_only_(serialize_only),
       root_index_(HeapEntry::kNoEntry),
       gc_roots_index_(HeapEntry::kNoEntry),
       max_snapshot_js_object_id_(0) {
@@ -292,6 +294,33 @@ void HeapSnapshot::FillChildren() {
   }
 }
 
+void HeapSnapshot::GroupEdgesByParent() {
+  DCHECK(serialize_only());
+  // Bucket sort in place: |next[i]| is the next unfilled slot in the range of
+  // entry i, |end[i]| the end of that range.
+  int entries_count = entries().length();
+  std::vector<size_t> next(entries_count);
+  std::vector<size_t> end(entries_count);
+  size_t edges_index = 0;
+  for (int i = 0; i < entries_count; ++i) {
+    next[i] = edges_index;
+    edges_index += entries()[i].children_count();
+    end[i] = edges_index;
+  }
+  DCHECK_EQ(edges().size(), edges_index);
+  for (int i = 0; i < entries_count; ++i) {
+    while (next[i] < end[i]) {
+      HeapGraphEdge* edge = &edges()[next[i]];
+      int owner = edge->from_index();
+      if (owner == i) {
+        ++next[i];
+      } else {
+        std::swap(*edge, edges()[next[owner]++]);
+      }
+    }
+  }
+}
+
 HeapEntry* HeapSnapshot::GetEntryById(SnapshotObjectId id) {
   List<HeapEntry*>* entries_by_id = GetSortedEntriesList();
 
@@ -2529,7 +2558,11 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
-  snapshot_->FillChildren();
+  if (snapshot_->serialize_only()) {
+    snapshot_->GroupEdgesByParent();
+  } else {
+    snapshot_->FillChildren();
+  }
   snapshot_->RememberLastJSObjectId();
 
   progress_counter_ = progress_total_;
@@ -2795,7 +2828,7 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(edge_name_or_index, buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry_index(edge->to()), buffer, buffer_pos);
+  buffer_pos = utoa(edge_target_index(edge), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
   buffer[buffer_pos++] = '\0';
   writer_->AddString(buffer.start());
@@ -2803,6 +2836,15 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
 
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
+  if (snapshot_->serialize_only()) {
+    std::deque<HeapGraphEdge>& edges = snapshot_->edges();
+    for (size_t i = 0; i < edges.size(); ++i) {
+      DCHECK(i == 0 || edges[i - 1].from_index() <= edges[i].from_index());
+      SerializeEdge(&edges[i], i == 0);
+      if (writer_->aborted()) return;
+    }
+    return;
+  }
   std::deque<HeapGraphEdge*>& edges = snapshot_->children();
   for (size_t i = 0; i < edges.size(); ++i) {
     DCHECK(i == 0 ||
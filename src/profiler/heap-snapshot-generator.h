@@ -54,12 +54,15 @@ class HeapGraphEdge BASE_EMBEDDED {
   }
   INLINE(HeapEntry* from() const);
   HeapEntry* to() const { return to_entry_; }
+  int from_index() const { return FromIndexField::decode(bit_field_); }
+  // Only valid until ReplaceToIndexWithEntry is called, i.e. for snapshots
+  // that are never filled with children.
+  int to_index() const { return to_index_; }
 
   INLINE(Isolate* isolate() const);
 
  private:
   INLINE(HeapSnapshot* snapshot() const);
-  int from_index() const { return FromIndexField::decode(bit_field_); }
 
   class TypeField : public BitField<Type, 0, 3> {};
   class FromIndexField : public BitField<int, 3, 29> {};
@@ -154,9 +157,15 @@ class HeapEntry BASE_EMBEDDED {
 // HeapSnapshotGenerator fills in a HeapSnapshot.
 class HeapSnapshot {
  public:
-  explicit HeapSnapshot(HeapProfiler* profiler);
+  // A snapshot that is |serialize_only| is not exposed through the public
+  // HeapGraphNode API. Instead of building an index of each entry's children,
+  // its edges are grouped by parent in place, which is all the serializer
+  // needs and saves a pointer per edge.
+  explicit HeapSnapshot(HeapProfiler* profiler, bool serialize_only = false);
   void Delete();
 
+  bool serialize_only() const { return serialize_only_; }
+
   HeapProfiler* profiler() { return profiler_; }
   size_t RawSnapshotSize() const;
   HeapEntry* root() { return &entries_[root_index_]; }
@@ -181,6 +190,9 @@ class HeapSnapshot {
   HeapEntry* GetEntryById(SnapshotObjectId id);
   List<HeapEntry*>* GetSortedEntriesList();
   void FillChildren();
+  // Reorders the edges so that each entry's edges are adjacent, in the order
+  // of the entries.
+  void GroupEdgesByParent();
 
   void Print(int max_depth);
 
@@ -190,6 +202,7 @@ class HeapSnapshot {
   HeapEntry* AddGcSubrootEntry(int tag, SnapshotObjectId id);
 
   HeapProfiler* profiler_;
+  bool serialize_only_;
   int root_index_;
   int gc_roots_index_;
   int gc_subroot_indexes_[VisitorSynchronization::kNumberOfSyncTags];
@@ -598,6 +611,10 @@ class HeapSnapshotJSONSerializer {
 
   int GetStringId(const char* s);
   int entry_index(HeapEntry* e) { return e->index() * kNodeFieldsCount; }
+  int edge_target_index(HeapGraphEdge* edge) {
+    return snapshot_->serialize_only() ? edge->to_index() * kNodeFieldsCount
+                                       : entry_index(edge->to());
+  }
   void SerializeEdge(HeapGraphEdge* edge, bool first_edge);
   void SerializeEdges();
   void SerializeImpl();
@@ -192,21 +192,16 @@ void ProfileNode::CollectDeoptInfo(CodeEntry* entry) {
 }
 
 
-ProfileNode* ProfileNode::FindChild(CodeEntry* entry) {
-  base::HashMap::Entry* map_entry =
-      children_.Lookup(entry, CodeEntryHash(entry));
-  return map_entry != NULL ?
-      reinterpret_cast<ProfileNode*>(map_entry->value) : NULL;
+ProfileNode* ProfileNode::FindChild(CodeEntry* entry, int line_number) {
+  auto map_entry = children_.find({entry, line_number});
+  return map_entry != children_.end() ? map_entry->second : nullptr;
 }
 
 
-ProfileNode* ProfileNode::FindOrAddChild(CodeEntry* entry) {
-  base::HashMap::Entry* map_entry =
-      children_.LookupOrInsert(entry, CodeEntryHash(entry));
-  ProfileNode* node = reinterpret_cast<ProfileNode*>(map_entry->value);
+ProfileNode* ProfileNode::FindOrAddChild(CodeEntry* entry, int line_number) {
+  ProfileNode*& node = children_[{entry, line_number}];
   if (!node) {
-    node = new ProfileNode(tree_, entry, this);
-    map_entry->value = node;
+    node = new ProfileNode(tree_, entry, this, line_number);
     children_list_.Add(node);
   }
   return node;
@@ -273,9 +268,8 @@ void ProfileNode::Print(int indent) {
     base::OS::Print("%*s bailed out due to '%s'\n", indent + 10, "",
                     bailout_reason);
   }
-  for (base::HashMap::Entry* p = children_.Start(); p != NULL;
-       p = children_.Next(p)) {
-    reinterpret_cast<ProfileNode*>(p->value)->Print(indent + 2);
+  for (int i = 0; i < children_list_.length(); i++) {
+    children_list_[i]->Print(indent + 2);
   }
 }
 
@@ -317,12 +311,28 @@ unsigned ProfileTree::GetFunctionId(const ProfileNode* node) {
 
 ProfileNode* ProfileTree::AddPathFromEnd(const std::vector<CodeEntry*>& path,
                                          int src_line, bool update_stats) {
+  ProfileStackTrace trace;
+  trace.reserve(path.size());
+  for (CodeEntry* entry : path) {
+    trace.push_back({entry, v8::CpuProfileNode::kNoLineNumberInfo});
+  }
+  return AddPathFromEnd(trace, src_line, update_stats, kLeafNodeLineNumbers);
+}
+
+ProfileNode* ProfileTree::AddPathFromEnd(const ProfileStackTrace& path,
+                                         int src_line, bool update_stats,
+                                         CpuProfilingMode mode) {
   ProfileNode* node = root_;
   CodeEntry* last_entry = NULL;
+  // The line of the parent frame that the current frame was called from.
+  int parent_line_number = v8::CpuProfileNode::kNoLineNumberInfo;
   for (auto it = path.rbegin(); it != path.rend(); ++it) {
-    if (*it == NULL) continue;
-    last_entry = *it;
-    node = node->FindOrAddChild(*it);
+    if (it->code_entry == NULL) continue;
+    last_entry = it->code_entry;
+    node = node->FindOrAddChild(it->code_entry, parent_line_number);
+    parent_line_number = mode == kCallerLineNumbers
+                             ? it->line_number
+                             : v8::CpuProfileNode::kNoLineNumberInfo;
   }
   if (last_entry && last_entry->has_deopt_info()) {
     node->CollectDeoptInfo(last_entry);
@@ -389,10 +399,13 @@ void ProfileTree::TraverseDepthFirst(Callback* callback) {
 using v8::tracing::TracedValue;
 
 CpuProfile::CpuProfile(CpuProfiler* profiler, const char* title,
-                       bool record_samples)
+                       bool record_samples, CpuProfilingMode mode)
     : title_(title),
       record_samples_(record_samples),
+      mode_(mode),
+      streaming_interval_(profiler->streaming_interval()),
       start_time_(base::TimeTicks::HighResolutionNow()),
+      last_streamed_timestamp_(start_time_),
       top_down_(profiler->isolate()),
       profiler_(profiler),
       streaming_next_sample_(0) {
@@ -404,10 +417,10 @@ CpuProfile::CpuProfile(CpuProfiler* profiler, const char* title,
 }
 
 void CpuProfile::AddPath(base::TimeTicks timestamp,
-                         const std::vector<CodeEntry*>& path, int src_line,
+                         const ProfileStackTrace& path, int src_line,
                          bool update_stats) {
   ProfileNode* top_frame_node =
-      top_down_.AddPathFromEnd(path, src_line, update_stats);
+      top_down_.AddPathFromEnd(path, src_line, update_stats, mode_);
   if (record_samples_ && !timestamp.IsNull()) {
     timestamps_.Add(timestamp);
     samples_.Add(top_frame_node);
@@ -415,7 +428,10 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
   const int kSamplesFlushCount = 100;
   const int kNodesFlushCount = 10;
   if (samples_.length() - streaming_next_sample_ >= kSamplesFlushCount ||
-      top_down_.pending_nodes_count() >= kNodesFlushCount) {
+      top_down_.pending_nodes_count() >= kNodesFlushCount ||
+      (streaming_interval_ > base::TimeDelta() &&
+       samples_.length() > streaming_next_sample_ &&
+       timestamps_.last() - last_streamed_timestamp_ >= streaming_interval_)) {
     StreamPendingTraceEvents();
   }
 }
@@ -476,9 +492,7 @@ void CpuProfile::StreamPendingTraceEvents() {
   }
   if (streaming_next_sample_ != samples_.length()) {
     value->BeginArray("timeDeltas");
-    base::TimeTicks lastTimestamp =
-        streaming_next_sample_ ? timestamps_[streaming_next_sample_ - 1]
-                               : start_time();
+    base::TimeTicks lastTimestamp = last_streamed_timestamp_;
     for (int i = streaming_next_sample_; i < timestamps_.length(); ++i) {
       value->AppendInteger(
           static_cast<int>((timestamps_[i] - lastTimestamp).InMicroseconds()));
@@ -486,7 +500,13 @@ void CpuProfile::StreamPendingTraceEvents() {
     }
     value->EndArray();
     DCHECK(samples_.length() == timestamps_.length());
+    last_streamed_timestamp_ = lastTimestamp;
     streaming_next_sample_ = samples_.length();
+    if (streaming_interval_ > base::TimeDelta()) {
+      samples_.Clear();
+      timestamps_.Clear();
+      streaming_next_sample_ = 0;
+    }
   }
 
   TRACE_EVENT_SAMPLE_WITH_ID1(TRACE_DISABLED_BY_DEFAULT("v8.cpu_profiler"),
@@ -508,10 +528,19 @@ void CpuProfile::Print() {
 }
 
 void CodeMap::AddCode(Address addr, CodeEntry* entry, unsigned size) {
+  InvalidateLookupCache();
   DeleteAllCoveredCode(addr, addr + size);
   code_map_.insert({addr, CodeEntryInfo(entry, size)});
 }
 
+void CodeMap::InvalidateLookupCache() {
+  if (++generation_ == 0) {
+    // Make sure that entries from before the wrap-around cannot match.
+    for (LookupCacheEntry& cached : lookup_cache_) cached.generation = 0;
+    generation_ = 1;
+  }
+}
+
 void CodeMap::DeleteAllCoveredCode(Address start, Address end) {
   auto left = code_map_.upper_bound(start);
   if (left != code_map_.begin()) {
@@ -524,11 +553,23 @@ void CodeMap::DeleteAllCoveredCode(Address start, Address end) {
 }
 
 CodeEntry* CodeMap::FindEntry(Address addr) {
+  uintptr_t key = reinterpret_cast<uintptr_t>(addr);
+  LookupCacheEntry& cached =
+      lookup_cache_[((key >> 2) ^ (key >> 12)) & (kLookupCacheSize - 1)];
+  if (cached.generation == generation_ && cached.address == addr) {
+    return cached.entry;
+  }
+  CodeEntry* entry = nullptr;
   auto it = code_map_.upper_bound(addr);
-  if (it == code_map_.begin()) return nullptr;
-  --it;
-  Address end_address = it->first + it->second.size;
-  return addr < end_address ? it->second.entry : nullptr;
+  if (it != code_map_.begin()) {
+    --it;
+    Address end_address = it->first + it->second.size;
+    if (addr < end_address) entry = it->second.entry;
+  }
+  cached.address = addr;
+  cached.entry = entry;
+  cached.generation = generation_;
+  return entry;
 }
 
 void CodeMap::MoveCode(Address from, Address to) {
@@ -564,7 +605,8 @@ CpuProfilesCollection::~CpuProfilesCollection() {
 
 
 bool CpuProfilesCollection::StartProfiling(const char* title,
-                                           bool record_samples) {
+                                           bool record_samples,
+                                           CpuProfilingMode mode) {
   current_profiles_semaphore_.Wait();
   if (current_profiles_.length() >= kMaxSimultaneousProfiles) {
     current_profiles_semaphore_.Signal();
@@ -578,7 +620,8 @@ bool CpuProfilesCollection::StartProfiling(const char* title,
       return true;
     }
   }
-  current_profiles_.Add(new CpuProfile(profiler_, title, record_samples));
+  current_profiles_.Add(
+      new CpuProfile(profiler_, title, record_samples, mode));
   current_profiles_semaphore_.Signal();
   return true;
 }
@@ -624,8 +667,8 @@ void CpuProfilesCollection::RemoveProfile(CpuProfile* profile) {
 }
 
 void CpuProfilesCollection::AddPathToCurrentProfiles(
-    base::TimeTicks timestamp, const std::vector<CodeEntry*>& path,
-    int src_line, bool update_stats) {
+    base::TimeTicks timestamp, const ProfileStackTrace& path, int src_line,
+    bool update_stats) {
   // As starting / stopping profiles is rare relatively to this
   // method, we don't bother minimizing the duration of lock holding,
   // e.g. copying contents of the list to a local vector.
@@ -640,7 +683,8 @@ ProfileGenerator::ProfileGenerator(CpuProfilesCollection* profiles)
     : profiles_(profiles) {}
 
 void ProfileGenerator::RecordTickSample(const TickSample& sample) {
-  std::vector<CodeEntry*> entries;
+  ProfileStackTrace& entries = entries_;
+  entries.clear();
   // Conservatively reserve space for stack frames + pc + function + vm-state.
   // There could in fact be more of them because of inlined entries.
   entries.reserve(sample.frames_count + 3);
@@ -658,7 +702,8 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
       // Don't use PC when in external callback code, as it can point
       // inside callback's code, and we will erroneously report
       // that a callback calls itself.
-      entries.push_back(FindEntry(sample.external_callback_entry));
+      entries.push_back({FindEntry(sample.external_callback_entry),
+                         v8::CpuProfileNode::kNoLineNumberInfo});
     } else {
       CodeEntry* pc_entry = FindEntry(sample.pc);
       // If there is no pc_entry we're likely in native code.
@@ -679,7 +724,7 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
           src_line = pc_entry->line_number();
         }
         src_line_not_found = false;
-        entries.push_back(pc_entry);
+        entries.push_back({pc_entry, src_line});
 
         if (pc_entry->builtin_id() == Builtins::kFunctionPrototypeApply ||
             pc_entry->builtin_id() == Builtins::kFunctionPrototypeCall) {
@@ -690,7 +735,8 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
           // former case we don't so we simply replace the frame with
           // 'unresolved' entry.
           if (!sample.has_external_callback) {
-            entries.push_back(CodeEntry::unresolved_entry());
+            entries.push_back({CodeEntry::unresolved_entry(),
+                               v8::CpuProfileNode::kNoLineNumberInfo});
           }
         }
       }
@@ -699,6 +745,7 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
     for (unsigned i = 0; i < sample.frames_count; ++i) {
       Address stack_pos = reinterpret_cast<Address>(sample.stack[i]);
       CodeEntry* entry = FindEntry(stack_pos);
+      int line_number = v8::CpuProfileNode::kNoLineNumberInfo;
       if (entry) {
         // Find out if the entry has an inlining stack associated.
         int pc_offset =
@@ -706,8 +753,14 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
         const std::vector<CodeEntry*>* inline_stack =
             entry->GetInlineStack(pc_offset);
         if (inline_stack) {
-          entries.insert(entries.end(), inline_stack->rbegin(),
-                         inline_stack->rend());
+          // The return address belongs to the innermost inlined function,
+          // so it says nothing about the line of the outer frames.
+          for (auto it = inline_stack->rbegin(); it != inline_stack->rend();
+               ++it) {
+            entries.push_back({*it, v8::CpuProfileNode::kNoLineNumberInfo});
+          }
+        } else {
+          line_number = entry->GetSourceLine(pc_offset);
         }
         // Skip unresolved frames (e.g. internal frame) and get source line of
         // the first JS caller.
@@ -719,21 +772,22 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
           src_line_not_found = false;
         }
       }
-      entries.push_back(entry);
+      entries.push_back({entry, line_number});
     }
   }
 
   if (FLAG_prof_browser_mode) {
     bool no_symbolized_entries = true;
-    for (auto e : entries) {
-      if (e != NULL) {
+    for (const CodeEntryAndLineNumber& e : entries) {
+      if (e.code_entry != NULL) {
         no_symbolized_entries = false;
         break;
       }
     }
     // If no frames were symbolized, put the VM state entry in.
     if (no_symbolized_entries) {
-      entries.push_back(EntryForVMState(sample.state));
+      entries.push_back({EntryForVMState(sample.state),
+                         v8::CpuProfileNode::kNoLineNumberInfo});
     }
   }
 
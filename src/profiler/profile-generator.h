@@ -6,7 +6,9 @@
 #define V8_PROFILER_PROFILE_GENERATOR_H_
 
 #include <map>
+#include <unordered_map>
 #include "src/allocation.h"
+#include "src/base/functional.h"
 #include "src/base/hashmap.h"
 #include "src/log.h"
 #include "src/profiler/strings-storage.h"
@@ -168,19 +170,37 @@ class CodeEntry {
 };
 
 
+struct CodeEntryAndLineNumber {
+  CodeEntry* code_entry;
+  // The line the frame of {code_entry} was executing, or kNoLineNumberInfo.
+  int line_number;
+};
+
+// The frames of a sample, innermost first.
+typedef std::vector<CodeEntryAndLineNumber> ProfileStackTrace;
+
 class ProfileTree;
 
 class ProfileNode {
  public:
-  inline ProfileNode(ProfileTree* tree, CodeEntry* entry, ProfileNode* parent);
-
-  ProfileNode* FindChild(CodeEntry* entry);
-  ProfileNode* FindOrAddChild(CodeEntry* entry);
+  inline ProfileNode(
+      ProfileTree* tree, CodeEntry* entry, ProfileNode* parent,
+      int line_number = v8::CpuProfileNode::kNoLineNumberInfo);
+
+  ProfileNode* FindChild(
+      CodeEntry* entry,
+      int line_number = v8::CpuProfileNode::kNoLineNumberInfo);
+  ProfileNode* FindOrAddChild(
+      CodeEntry* entry,
+      int line_number = v8::CpuProfileNode::kNoLineNumberInfo);
   void IncrementSelfTicks() { ++self_ticks_; }
   void IncreaseSelfTicks(unsigned amount) { self_ticks_ += amount; }
   void IncrementLineTicks(int src_line);
 
   CodeEntry* entry() const { return entry_; }
+  // The line of the parent's function that this node was called from, in
+  // kCallerLineNumbers profiles.
+  int line_number() const { return line_number_; }
   unsigned self_ticks() const { return self_ticks_; }
   const List<ProfileNode*>* children() const { return &children_list_; }
   unsigned id() const { return id_; }
@@ -203,15 +223,28 @@ class ProfileNode {
   }
 
  private:
-  static uint32_t CodeEntryHash(CodeEntry* entry) { return entry->GetHash(); }
+  struct Hasher {
+    std::size_t operator()(const CodeEntryAndLineNumber& key) const {
+      return base::hash_combine(key.code_entry->GetHash(), key.line_number);
+    }
+  };
+
+  struct Equals {
+    bool operator()(const CodeEntryAndLineNumber& lhs,
+                    const CodeEntryAndLineNumber& rhs) const {
+      return lhs.code_entry->IsSameFunctionAs(rhs.code_entry) &&
+             lhs.line_number == rhs.line_number;
+    }
+  };
 
   static bool LineTickMatch(void* a, void* b) { return a == b; }
 
   ProfileTree* tree_;
   CodeEntry* entry_;
   unsigned self_ticks_;
-  // Mapping from CodeEntry* to ProfileNode*
-  base::CustomMatcherHashMap children_;
+  std::unordered_map<CodeEntryAndLineNumber, ProfileNode*, Hasher, Equals>
+      children_;
+  int line_number_;
   List<ProfileNode*> children_list_;
   ProfileNode* parent_;
   unsigned id_;
@@ -232,6 +265,8 @@ class ProfileTree {
       const std::vector<CodeEntry*>& path,
       int src_line = v8::CpuProfileNode::kNoLineNumberInfo,
       bool update_stats = true);
+  ProfileNode* AddPathFromEnd(const ProfileStackTrace& path, int src_line,
+                              bool update_stats, CpuProfilingMode mode);
   ProfileNode* root() const { return root_; }
   unsigned next_node_id() { return next_node_id_++; }
   unsigned GetFunctionId(const ProfileNode* node);
@@ -268,10 +303,11 @@ class ProfileTree {
 
 class CpuProfile {
  public:
-  CpuProfile(CpuProfiler* profiler, const char* title, bool record_samples);
+  CpuProfile(CpuProfiler* profiler, const char* title, bool record_samples,
+             CpuProfilingMode mode = kLeafNodeLineNumbers);
 
   // Add pc -> ... -> main() call path to the profile.
-  void AddPath(base::TimeTicks timestamp, const std::vector<CodeEntry*>& path,
+  void AddPath(base::TimeTicks timestamp, const ProfileStackTrace& path,
                int src_line, bool update_stats);
   void FinishProfile();
 
@@ -297,8 +333,14 @@ class CpuProfile {
 
   const char* title_;
   bool record_samples_;
+  CpuProfilingMode mode_;
+  // If not zero, samples are dropped once they were streamed, and chunks are
+  // streamed at least this often.
+  const base::TimeDelta streaming_interval_;
   base::TimeTicks start_time_;
   base::TimeTicks end_time_;
+  // Timestamp of the last streamed sample, or the start time.
+  base::TimeTicks last_streamed_timestamp_;
   List<ProfileNode*> samples_;
   List<base::TimeTicks> timestamps_;
   ProfileTree top_down_;
@@ -310,7 +352,7 @@ class CpuProfile {
 
 class CodeMap {
  public:
-  CodeMap() {}
+  CodeMap() : lookup_cache_(), generation_(1) {}
 
   void AddCode(Address addr, CodeEntry* entry, unsigned size);
   void MoveCode(Address from, Address to);
@@ -326,9 +368,23 @@ class CodeMap {
   };
 
   void DeleteAllCoveredCode(Address start, Address end);
+  void InvalidateLookupCache();
 
   std::map<Address, CodeEntryInfo> code_map_;
 
+  // Samples mostly hit the same few return addresses, so the results of
+  // recent lookups are remembered. An entry is only valid while its
+  // generation matches {generation_}, which changes with every update of
+  // the map.
+  struct LookupCacheEntry {
+    Address address;
+    CodeEntry* entry;
+    unsigned generation;
+  };
+  static const int kLookupCacheSize = 1024;
+  LookupCacheEntry lookup_cache_[kLookupCacheSize];
+  unsigned generation_;
+
   DISALLOW_COPY_AND_ASSIGN(CodeMap);
 };
 
@@ -338,7 +394,8 @@ class CpuProfilesCollection {
   ~CpuProfilesCollection();
 
   void set_cpu_profiler(CpuProfiler* profiler) { profiler_ = profiler; }
-  bool StartProfiling(const char* title, bool record_samples);
+  bool StartProfiling(const char* title, bool record_samples,
+                      CpuProfilingMode mode = kLeafNodeLineNumbers);
   CpuProfile* StopProfiling(const char* title);
   List<CpuProfile*>* profiles() { return &finished_profiles_; }
   const char* GetName(Name* name) { return resource_names_.GetName(name); }
@@ -347,8 +404,8 @@ class CpuProfilesCollection {
 
   // Called from profile generator thread.
   void AddPathToCurrentProfiles(base::TimeTicks timestamp,
-                                const std::vector<CodeEntry*>& path,
-                                int src_line, bool update_stats);
+                                const ProfileStackTrace& path, int src_line,
+                                bool update_stats);
 
   // Limits the number of profiles that can be simultaneously collected.
   static const int kMaxSimultaneousProfiles = 100;
@@ -380,6 +437,8 @@ class ProfileGenerator {
 
   CpuProfilesCollection* profiles_;
   CodeMap code_map_;
+  // Reused for the entries of each sample, to not allocate per tick.
+  ProfileStackTrace entries_;
 
   DISALLOW_COPY_AND_ASSIGN(ProfileGenerator);
 };
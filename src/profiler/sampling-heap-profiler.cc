@@ -5,7 +5,9 @@
 #include "src/profiler/sampling-heap-profiler.h"
 
 #include <stdint.h>
+#include <algorithm>
 #include <memory>
+#include <sstream>
 #include "src/api.h"
 #include "src/base/ieee754.h"
 #include "src/base/utils/random-number-generator.h"
@@ -60,7 +62,10 @@ SamplingHeapProfiler::SamplingHeapProfiler(
           heap_, static_cast<intptr_t>(rate), rate, this,
           heap->isolate()->random_number_generator())),
       names_(names),
-      profile_root_(nullptr, "(root)", v8::UnboundScript::kNoScriptId, 0),
+      last_node_id_(0),
+      last_sample_id_(0),
+      profile_root_(nullptr, "(root)", v8::UnboundScript::kNoScriptId, 0,
+                    next_node_id()),
       samples_(),
       stack_depth_(stack_depth),
       rate_(rate),
@@ -109,7 +114,7 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  Sample* sample = new Sample(size, node, loc, this);
+  Sample* sample = new Sample(size, node, loc, this, ++last_sample_id_);
   samples_.insert(sample);
   sample->global.SetWeak(sample, OnWeakCallback, WeakCallbackType::kParameter);
   sample->global.MarkIndependent();
@@ -137,18 +142,19 @@ void SamplingHeapProfiler::OnWeakCallback(
   delete sample;
 }
 
-SamplingHeapProfiler::AllocationNode*
-SamplingHeapProfiler::AllocationNode::FindOrAddChildNode(const char* name,
-                                                         int script_id,
-                                                         int start_position) {
-  FunctionId id = function_id(script_id, start_position, name);
-  auto it = children_.find(id);
-  if (it != children_.end()) {
+SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
+    AllocationNode* parent, const char* name, int script_id,
+    int start_position) {
+  AllocationNode::FunctionId id =
+      AllocationNode::function_id(script_id, start_position, name);
+  auto it = parent->children_.find(id);
+  if (it != parent->children_.end()) {
     DCHECK(strcmp(it->second->name_, name) == 0);
     return it->second;
   }
-  auto child = new AllocationNode(this, name, script_id, start_position);
-  children_.insert(std::make_pair(id, child));
+  auto child = new AllocationNode(parent, name, script_id, start_position,
+                                  next_node_id());
+  parent->children_.insert(std::make_pair(id, child));
   return child;
 }
 
@@ -189,7 +195,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
         name = "(JS)";
         break;
     }
-    return node->FindOrAddChildNode(name, v8::UnboundScript::kNoScriptId, 0);
+    return FindOrAddChildNode(node, name, v8::UnboundScript::kNoScriptId, 0);
   }
 
   // We need to process the stack in reverse order as the top of the stack is
@@ -202,7 +208,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
       Script* script = Script::cast(shared->script());
       script_id = script->id();
     }
-    node = node->FindOrAddChildNode(name, script_id, shared->start_position());
+    node = FindOrAddChildNode(node, name, script_id, shared->start_position());
   }
   return node;
 }
@@ -243,7 +249,7 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
       {ToApiHandle<v8::String>(
            isolate_->factory()->InternalizeUtf8String(node->name_)),
        script_name, node->script_id_, node->script_position_, line, column,
-       std::vector<v8::AllocationProfile::Node*>(), allocations}));
+       std::vector<v8::AllocationProfile::Node*>(), allocations, node->id_}));
   v8::AllocationProfile::Node* current = &profile->nodes().back();
   // The children map may have nodes inserted into it during translation
   // because the translation may allocate strings on the JS heap that have
@@ -257,7 +263,18 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
   return current;
 }
 
-v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
+Handle<String> SamplingHeapProfiler::GetTypeName(Handle<HeapObject> object) {
+  if (object->IsJSFunction()) return isolate_->factory()->Function_string();
+  if (object->IsJSObject()) {
+    return JSReceiver::GetConstructorName(Handle<JSObject>::cast(object));
+  }
+  std::ostringstream os;
+  os << object->map()->instance_type();
+  return isolate_->factory()->InternalizeUtf8String(os.str().c_str());
+}
+
+v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile(
+    uint64_t since_sample_id) {
   if (flags_ & v8::HeapProfiler::kSamplingForceGC) {
     isolate_->heap()->CollectAllGarbage(
         Heap::kNoGCFlags, GarbageCollectionReason::kSamplingProfiler);
@@ -273,6 +290,35 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
   }
   auto profile = new v8::internal::AllocationProfile();
   TranslateAllocationNode(profile, &profile_root_, scripts);
+
+  // Take a snapshot of the samples before resolving type names, as that
+  // allocates and a GC may dispose of samples.
+  std::vector<v8::AllocationProfile::Sample>& samples = profile->samples();
+  std::vector<Handle<HeapObject>> objects;
+  int gc_count = heap_->gc_count();
+  int ms_count = heap_->ms_count();
+  for (Sample* sample : samples_) {
+    if (sample->sample_id <= since_sample_id || sample->global.IsEmpty()) {
+      continue;
+    }
+    Local<Value> local = sample->global.Get(
+        reinterpret_cast<v8::Isolate*>(isolate_));
+    objects.push_back(Handle<HeapObject>::cast(v8::Utils::OpenHandle(*local)));
+    int full_gcs = ms_count - sample->ms_count;
+    int scavenges = gc_count - sample->gc_count - full_gcs;
+    samples.push_back({sample->owner->id_, sample->size, Local<v8::String>(),
+                       static_cast<unsigned int>(scavenges),
+                       static_cast<unsigned int>(full_gcs),
+                       sample->sample_id});
+  }
+  for (size_t i = 0; i < samples.size(); i++) {
+    samples[i].type_name = ToApiHandle<v8::String>(GetTypeName(objects[i]));
+  }
+  std::sort(samples.begin(), samples.end(),
+            [](const v8::AllocationProfile::Sample& a,
+               const v8::AllocationProfile::Sample& b) {
+              return a.sample_id < b.sample_id;
+            });
   return profile;
 }
 
@@ -31,10 +31,16 @@ class AllocationProfile : public v8::AllocationProfile {
     return nodes_.size() == 0 ? nullptr : &nodes_.front();
   }
 
+  const std::vector<v8::AllocationProfile::Sample>& GetSamples() override {
+    return samples_;
+  }
+
   std::deque<v8::AllocationProfile::Node>& nodes() { return nodes_; }
+  std::vector<v8::AllocationProfile::Sample>& samples() { return samples_; }
 
  private:
   std::deque<v8::AllocationProfile::Node> nodes_;
+  std::vector<v8::AllocationProfile::Sample> samples_;
 
   DISALLOW_COPY_AND_ASSIGN(AllocationProfile);
 };
@@ -45,7 +51,7 @@ class SamplingHeapProfiler {
                        int stack_depth, v8::HeapProfiler::SamplingFlags flags);
   ~SamplingHeapProfiler();
 
-  v8::AllocationProfile* GetAllocationProfile();
+  v8::AllocationProfile* GetAllocationProfile(uint64_t since_sample_id = 0);
 
   StringsStorage* names() const { return names_; }
 
@@ -54,17 +60,26 @@ class SamplingHeapProfiler {
   struct Sample {
    public:
     Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_)
+           SamplingHeapProfiler* profiler_, uint64_t sample_id_)
         : size(size_),
           owner(owner_),
           global(Global<Value>(
               reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_)),
-          profiler(profiler_) {}
+          profiler(profiler_),
+          sample_id(sample_id_),
+          gc_count(profiler_->heap()->gc_count()),
+          ms_count(profiler_->heap()->ms_count()) {}
     ~Sample() { global.Reset(); }
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
+    const uint64_t sample_id;
+    // The garbage collection counters of the heap at allocation time. Every
+    // collection after that was survived, as dead samples are disposed of
+    // by the weak callback.
+    const int gc_count;
+    const int ms_count;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
@@ -73,11 +88,12 @@ class SamplingHeapProfiler {
   class AllocationNode {
    public:
     AllocationNode(AllocationNode* parent, const char* name, int script_id,
-                   int start_position)
+                   int start_position, uint32_t id)
         : parent_(parent),
           script_id_(script_id),
           script_position_(start_position),
           name_(name),
+          id_(id),
           pinned_(false) {}
     ~AllocationNode() {
       for (auto child : children_) {
@@ -102,8 +118,6 @@ class SamplingHeapProfiler {
       DCHECK(static_cast<unsigned>(start_position) < (1u << 31));
       return (static_cast<uint64_t>(script_id) << 32) + (start_position << 1);
     }
-    AllocationNode* FindOrAddChildNode(const char* name, int script_id,
-                                       int start_position);
     // TODO(alph): make use of unordered_map's here. Pay attention to
     // iterator invalidation during TranslateAllocationNode.
     std::map<size_t, unsigned int> allocations_;
@@ -112,6 +126,7 @@ class SamplingHeapProfiler {
     const int script_id_;
     const int script_position_;
     const char* const name_;
+    const uint32_t id_;
     bool pinned_;
 
     friend class SamplingHeapProfiler;
@@ -138,13 +153,21 @@ class SamplingHeapProfiler {
       const std::map<int, Handle<Script>>& scripts);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count);
+  // Returns the constructor name of JavaScript objects and the instance type
+  // of other objects.
+  Handle<String> GetTypeName(Handle<HeapObject> object);
   AllocationNode* AddStack();
+  AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
+                                     int script_id, int start_position);
+  uint32_t next_node_id() { return ++last_node_id_; }
 
   Isolate* const isolate_;
   Heap* const heap_;
   std::unique_ptr<SamplingAllocationObserver> new_space_observer_;
   std::unique_ptr<SamplingAllocationObserver> other_spaces_observer_;
   StringsStorage* const names_;
+  uint32_t last_node_id_;
+  uint64_t last_sample_id_;
   AllocationNode profile_root_;
   std::set<Sample*> samples_;
   const int stack_depth_;
@@ -178,6 +201,10 @@ class SamplingAllocationObserver : public AllocationObserver {
 
   intptr_t GetNextStepSize() override { return GetNextSampleInterval(rate_); }
 
+  // Samples in new space are taken at the first allocation that refills the
+  // linear allocation area, which keeps inline allocation fast.
+  bool AllowsDelayedSteps() const override { return true; }
+
  private:
   intptr_t GetNextSampleInterval(uint64_t rate);
   SamplingHeapProfiler* const profiler_;
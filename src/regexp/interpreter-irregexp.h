@@ -7,8 +7,6 @@
 #ifndef V8_REGEXP_INTERPRETER_IRREGEXP_H_
 #define V8_REGEXP_INTERPRETER_IRREGEXP_H_
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/jsregexp.h"
 
 namespace v8 {
@@ -16,17 +14,18 @@ namespace internal {
 
 class IrregexpInterpreter {
  public:
+  // If {backtrack_limit} is positive, gives up with RE_FALLBACK_TO_LINEAR
+  // after that many backtracks or when the backtracking stack overflows.
   static RegExpImpl::IrregexpResult Match(Isolate* isolate,
                                           Handle<ByteArray> code,
                                           Handle<String> subject,
                                           int* captures,
-                                          int start_position);
+                                          int start_position,
+                                          int backtrack_limit);
 };
 
 
 }  // namespace internal
 }  // namespace v8
 
-#endif  // V8_INTERPRETED_REGEXP
-
 #endif  // V8_REGEXP_INTERPRETER_IRREGEXP_H_
@@ -19,6 +19,7 @@
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-macro-assembler.h"
+#include "src/regexp/regexp-nfa-matcher.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/runtime/runtime.h"
@@ -314,11 +315,8 @@ bool RegExpImpl::EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                         Handle<String> sample_subject,
                                         bool is_one_byte) {
   Object* compiled_code = re->DataAt(JSRegExp::code_index(is_one_byte));
-#ifdef V8_INTERPRETED_REGEXP
   if (compiled_code->IsByteArray()) return true;
-#else  // V8_INTERPRETED_REGEXP (RegExp native code)
   if (compiled_code->IsCode()) return true;
-#endif
   // We could potentially have marked this as flushable, but have kept
   // a saved version if we did not flush it yet.
   Object* saved_code = re->DataAt(JSRegExp::saved_code_index(is_one_byte));
@@ -332,6 +330,119 @@ bool RegExpImpl::EnsureCompiledIrregexp(Handle<JSRegExp> re,
 }
 
 
+namespace {
+
+// Finds runs of literal characters that every match of a regexp contains,
+// looking through captures, groups and zero-width assertions. Remembers the
+// run at the very start of every match, if any, and the longest run.
+class RequiredLiteralFinder {
+ public:
+  explicit RequiredLiteralFinder(Zone* zone)
+      : run_(zone), prefix_(zone), longest_(zone), at_start_(true) {}
+
+  void Visit(RegExpTree* node) {
+    if (node->IsAtom()) {
+      AddRun(node->AsAtom()->data());
+    } else if (node->IsText()) {
+      ZoneList<TextElement>* elements = node->AsText()->elements();
+      for (int i = 0; i < elements->length(); i++) {
+        TextElement element = elements->at(i);
+        if (element.text_type() == TextElement::ATOM) {
+          AddRun(element.atom()->data());
+        } else {
+          Break();
+        }
+      }
+    } else if (node->IsAlternative()) {
+      ZoneList<RegExpTree*>* nodes = node->AsAlternative()->nodes();
+      for (int i = 0; i < nodes->length(); i++) Visit(nodes->at(i));
+    } else if (node->IsCapture()) {
+      Visit(node->AsCapture()->body());
+    } else if (node->IsGroup()) {
+      Visit(node->AsGroup()->body());
+    } else if (node->IsAssertion() || node->IsLookaround() ||
+               node->IsEmpty()) {
+      // Zero-width, the characters around it are adjacent in the subject.
+    } else {
+      Break();
+    }
+  }
+
+  // Ends the last run; must be called before prefix() and longest().
+  void Finish() { Break(); }
+
+  const ZoneVector<uc16>& prefix() const { return prefix_; }
+  const ZoneVector<uc16>& longest() const { return longest_; }
+
+ private:
+  void AddRun(Vector<const uc16> chars) {
+    run_.insert(run_.end(), chars.begin(), chars.end());
+  }
+
+  void Break() {
+    if (at_start_) prefix_ = run_;
+    if (run_.size() > longest_.size()) longest_ = run_;
+    run_.clear();
+    at_start_ = false;
+  }
+
+  ZoneVector<uc16> run_;
+  ZoneVector<uc16> prefix_;
+  ZoneVector<uc16> longest_;
+  bool at_start_;
+};
+
+}  // namespace
+
+void RegExpImpl::SetIrregexpPrefilter(Isolate* isolate, Zone* zone,
+                                      Handle<FixedArray> re,
+                                      JSRegExp::Flags flags,
+                                      RegExpTree* tree) {
+  re->set(JSRegExp::kIrregexpPrefilterIndex, Smi::kZero);
+  re->set(JSRegExp::kIrregexpPrefilterIsPrefixIndex, Smi::kZero);
+  // Case independent and unicode literals match more than their characters,
+  // and a sticky regexp must match at the start position anyway.
+  const int kUnsupportedFlags =
+      JSRegExp::kIgnoreCase | JSRegExp::kUnicode | JSRegExp::kSticky;
+  if (!FLAG_regexp_prefilter || (flags & kUnsupportedFlags) != 0) return;
+
+  RequiredLiteralFinder finder(zone);
+  finder.Visit(tree);
+  finder.Finish();
+  const ZoneVector<uc16>* literal;
+  bool is_prefix;
+  if (finder.prefix().size() >= kPrefilterMinPrefixLength) {
+    literal = &finder.prefix();
+    is_prefix = true;
+  } else if (finder.longest().size() >= kPrefilterMinLiteralLength) {
+    literal = &finder.longest();
+    is_prefix = false;
+  } else {
+    return;
+  }
+  Handle<String> string =
+      isolate->factory()->NewStringFromTwoByte(literal, TENURED)
+          .ToHandleChecked();
+  re->set(JSRegExp::kIrregexpPrefilterIndex, *string);
+  re->set(JSRegExp::kIrregexpPrefilterIsPrefixIndex,
+          Smi::FromInt(is_prefix ? 1 : 0));
+}
+
+int RegExpImpl::IrregexpPrefilter(FixedArray* re, Handle<String> subject,
+                                  int index) {
+  Object* literal = re->get(JSRegExp::kIrregexpPrefilterIndex);
+  if (!literal->IsString()) return index;
+  bool is_prefix =
+      Smi::cast(re->get(JSRegExp::kIrregexpPrefilterIsPrefixIndex))->value() !=
+      0;
+  Isolate* isolate = subject->GetIsolate();
+  int found = String::IndexOf(isolate, subject,
+                              handle(String::cast(literal), isolate), index);
+  if (found < 0) return -1;
+  // If every match starts with the literal, no match starts before it.
+  return is_prefix ? found : index;
+}
+
 bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -375,9 +486,39 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     USE(ThrowRegExpException(re, pattern, compile_data.error));
     return false;
   }
+  // With --regexp-tier-up, regexps start out in the bytecode interpreter
+  // unless they are matched against a large subject right away. Once one
+  // encoding has native code, the other one gets native code as well.
+  Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
+  bool use_bytecode = !UsesNativeRegExp();
+  if (!use_bytecode && FLAG_regexp_tier_up) {
+    int ticks =
+        Smi::cast(data->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))->value();
+    use_bytecode =
+        ticks > 0 &&
+        sample_subject->length() < FLAG_regexp_tier_up_subject_length;
+    if (!use_bytecode) {
+      data->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::kZero);
+    }
+  }
+  // With --regexp-backtrack-limit, regexps that the linear-time matcher can
+  // handle run in the interpreter, which counts the backtracks. Native code
+  // does not. Check the tree before irregexp gets to modify it.
+  int backtrack_limit = 0;
+  if (FLAG_regexp_backtrack_limit > 0) {
+    RegExpNfaMatcher matcher(isolate, &zone, flags,
+                             compile_data.capture_count);
+    if (matcher.Compile(compile_data.tree)) {
+      backtrack_limit = FLAG_regexp_backtrack_limit;
+      use_bytecode = true;
+    }
+  }
+  data->set(JSRegExp::kIrregexpBacktrackLimitIndex,
+            Smi::FromInt(backtrack_limit));
+  SetIrregexpPrefilter(isolate, &zone, data, flags, compile_data.tree);
   RegExpEngine::CompilationResult result =
       RegExpEngine::Compile(isolate, &zone, &compile_data, flags, pattern,
-                            sample_subject, is_one_byte);
+                            sample_subject, is_one_byte, use_bytecode);
   if (result.error_message != NULL) {
     // Unable to compile regexp.
     Handle<String> error_message = isolate->factory()->NewStringFromUtf8(
@@ -386,7 +527,6 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     return false;
   }
 
-  Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
   data->set(JSRegExp::code_index(is_one_byte), result.code);
   SetIrregexpCaptureNameMap(*data, compile_data.capture_name_map);
   int register_max = IrregexpMaxRegisterCount(*data);
@@ -437,6 +577,41 @@ Code* RegExpImpl::IrregexpNativeCode(FixedArray* re, bool is_one_byte) {
 }
 
 
+bool RegExpImpl::IrregexpUsesByteCode(FixedArray* re, bool is_one_byte) {
+  return re->get(JSRegExp::code_index(is_one_byte))->IsByteArray();
+}
+
+
+void RegExpImpl::IrregexpTickTierUp(Handle<JSRegExp> re,
+                                    Handle<String> subject, bool is_one_byte) {
+  FixedArray* data = FixedArray::cast(re->data());
+  if (!IrregexpUsesByteCode(data, is_one_byte)) return;
+  // Native code cannot enforce the backtrack limit.
+  if (Smi::cast(data->get(JSRegExp::kIrregexpBacktrackLimitIndex))->value() >
+      0) {
+    return;
+  }
+  int ticks =
+      Smi::cast(data->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))->value();
+  if (ticks > 1 && subject->length() < FLAG_regexp_tier_up_subject_length) {
+    data->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+              Smi::FromInt(ticks - 1));
+    return;
+  }
+  // Drop the bytecode for both encodings, so that the next compilation
+  // produces native code.
+  data->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::kZero);
+  Smi* uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  if (IrregexpUsesByteCode(data, true)) {
+    data->set(JSRegExp::kIrregexpLatin1CodeIndex, uninitialized);
+  }
+  if (IrregexpUsesByteCode(data, false)) {
+    data->set(JSRegExp::kIrregexpUC16CodeIndex, uninitialized);
+  }
+  re->GetIsolate()->counters()->regexp_tier_up()->Increment();
+}
+
+
 void RegExpImpl::IrregexpInitialize(Handle<JSRegExp> re,
                                     Handle<String> pattern,
                                     JSRegExp::Flags flags,
@@ -456,20 +631,23 @@ int RegExpImpl::IrregexpPrepare(Handle<JSRegExp> regexp,
 
   // Check representation of the underlying storage.
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
+  if (UsesNativeRegExp() && FLAG_regexp_tier_up) {
+    IrregexpTickTierUp(regexp, subject, is_one_byte);
+  }
   if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte)) return -1;
 
-#ifdef V8_INTERPRETED_REGEXP
-  // Byte-code regexp needs space allocated for all its registers.
-  // The result captures are copied to the start of the registers array
-  // if the match succeeds.  This way those registers are not clobbered
-  // when we set the last match info from last successful match.
-  return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
-         (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#else  // V8_INTERPRETED_REGEXP
+  FixedArray* data = FixedArray::cast(regexp->data());
+  if (IrregexpUsesByteCode(data, is_one_byte)) {
+    // Byte-code regexp needs space allocated for all its registers.
+    // The result captures are copied to the start of the registers array
+    // if the match succeeds.  This way those registers are not clobbered
+    // when we set the last match info from last successful match.
+    return IrregexpNumberOfRegisters(data) +
+           (IrregexpNumberOfCaptures(data) + 1) * 2;
+  }
   // Native regexp only needs room to output captures. Registers are handled
   // internally.
-  return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#endif  // V8_INTERPRETED_REGEXP
+  return (IrregexpNumberOfCaptures(data) + 1) * 2;
 }
 
 
@@ -486,12 +664,18 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   DCHECK(index <= subject->length());
   DCHECK(subject->IsFlat());
 
+  // Skip ahead to the first position at which a match is possible.
+  index = IrregexpPrefilter(*irregexp, subject, index);
+  if (index < 0) return RE_FAILURE;
+
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
 
 #ifndef V8_INTERPRETED_REGEXP
-  DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
-  do {
+  while (true) {
     EnsureCompiledIrregexp(regexp, subject, is_one_byte);
+    // With --regexp-tier-up, the regexp may still run in the interpreter.
+    if (IrregexpUsesByteCode(*irregexp, is_one_byte)) break;
+    DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
     Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
     // The stack is used to allocate registers for the compiled regexp code.
     // This means that in case of failure, the output registers array is left
@@ -523,10 +707,10 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
     // but the characters are always the same).
     IrregexpPrepare(regexp, subject);
     is_one_byte = subject->IsOneByteRepresentationUnderneath();
-  } while (true);
-  UNREACHABLE();
-#else  // V8_INTERPRETED_REGEXP
+  }
+#endif  // V8_INTERPRETED_REGEXP
 
+  isolate->counters()->regexp_entry_interpreted()->Increment();
   DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
   // registers.
@@ -542,11 +726,15 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
                                isolate);
 
-  IrregexpResult result = IrregexpInterpreter::Match(isolate,
-                                                     byte_codes,
-                                                     subject,
-                                                     raw_output,
-                                                     index);
+  int backtrack_limit =
+      Smi::cast(irregexp->get(JSRegExp::kIrregexpBacktrackLimitIndex))
+          ->value();
+  IrregexpResult result = IrregexpInterpreter::Match(
+      isolate, byte_codes, subject, raw_output, index, backtrack_limit);
+  if (result == RE_FALLBACK_TO_LINEAR) {
+    isolate->counters()->regexp_linear_fallback()->Increment();
+    result = IrregexpExecLinear(regexp, subject, index, raw_output);
+  }
   if (result == RE_SUCCESS) {
     // Copy capture results to the start of the registers array.
     MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
@@ -556,7 +744,24 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
     isolate->StackOverflow();
   }
   return result;
-#endif  // V8_INTERPRETED_REGEXP
+}
+
+RegExpImpl::IrregexpResult RegExpImpl::IrregexpExecLinear(
+    Handle<JSRegExp> regexp, Handle<String> subject, int index,
+    int32_t* output) {
+  Isolate* isolate = regexp->GetIsolate();
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  JSRegExp::Flags flags = regexp->GetFlags();
+  Handle<String> pattern = String::Flatten(handle(regexp->Pattern(), isolate));
+  RegExpCompileData compile_data;
+  FlatStringReader reader(isolate, pattern);
+  // The pattern has been parsed successfully before, and the matcher accepted
+  // it when the backtrack limit was installed.
+  CHECK(RegExpParser::ParseRegExp(isolate, &zone, &reader, flags,
+                                  &compile_data));
+  RegExpNfaMatcher matcher(isolate, &zone, flags, compile_data.capture_count);
+  CHECK(matcher.Compile(compile_data.tree));
+  return matcher.Match(subject, index, output);
 }
 
 MaybeHandle<Object> RegExpImpl::IrregexpExec(
@@ -651,23 +856,21 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
     register_array_size_(0),
     regexp_(regexp),
     subject_(subject) {
-#ifdef V8_INTERPRETED_REGEXP
-  bool interpreted = true;
-#else
   bool interpreted = false;
-#endif  // V8_INTERPRETED_REGEXP
 
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
     registers_per_match_ = kAtomRegistersPerMatch;
     // There is no distinction between interpreted and native for atom regexps.
-    interpreted = false;
   } else {
     registers_per_match_ = RegExpImpl::IrregexpPrepare(regexp_, subject_);
     if (registers_per_match_ < 0) {
       num_matches_ = -1;  // Signal exception.
       return;
     }
+    interpreted = RegExpImpl::IrregexpUsesByteCode(
+        FixedArray::cast(regexp_->data()),
+        subject_->IsOneByteRepresentationUnderneath());
   }
 
   DCHECK_NE(0, regexp->GetFlags() & JSRegExp::kGlobal);
@@ -6680,7 +6883,7 @@ RegExpNode* OptionallyStepBackToLeadSurrogate(RegExpCompiler* compiler,
 RegExpEngine::CompilationResult RegExpEngine::Compile(
     Isolate* isolate, Zone* zone, RegExpCompileData* data,
     JSRegExp::Flags flags, Handle<String> pattern,
-    Handle<String> sample_subject, bool is_one_byte) {
+    Handle<String> sample_subject, bool is_one_byte, bool use_bytecode) {
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     return IrregexpRegExpTooBig(isolate);
   }
@@ -6754,58 +6957,62 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
   }
 
   // Create the correct assembler for the architecture.
+  std::unique_ptr<RegExpMacroAssembler> macro_assembler;
+  EmbeddedVector<byte, 1024> codes;
+  if (use_bytecode) {
+    // Interpreted regexp implementation.
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
+  } else {
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
-
-  NativeRegExpMacroAssembler::Mode mode =
-      is_one_byte ? NativeRegExpMacroAssembler::LATIN1
-                  : NativeRegExpMacroAssembler::UC16;
+    // Native regexp implementation.
+    NativeRegExpMacroAssembler::Mode mode =
+        is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                    : NativeRegExpMacroAssembler::UC16;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerIA32(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerX64(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerARM(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(isolate, zone, mode,
-                                            (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerARM64(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_S390
-  RegExpMacroAssemblerS390 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerS390(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_PPC
-  RegExpMacroAssemblerPPC macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerPPC(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerMIPS(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_MIPS64
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerMIPS(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_X87
-  RegExpMacroAssemblerX87 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerX87(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #else
 #error "Unsupported architecture"
 #endif
-
-#else  // V8_INTERPRETED_REGEXP
-  // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(isolate, codes, zone);
+#else   // V8_INTERPRETED_REGEXP
+    UNREACHABLE();
 #endif  // V8_INTERPRETED_REGEXP
+  }
 
-  macro_assembler.set_slow_safe(TooMuchRegExpCode(pattern));
+  macro_assembler->set_slow_safe(TooMuchRegExpCode(pattern));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
   static const int kMaxBacksearchLimit = 1024;
   if (is_end_anchored && !is_start_anchored && !is_sticky &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
@@ -6815,10 +7022,10 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     } else if (is_unicode) {
       mode = RegExpMacroAssembler::GLOBAL_UNICODE;
     }
-    macro_assembler.set_global_mode(mode);
+    macro_assembler->set_global_mode(mode);
   }
 
-  return compiler.Assemble(&macro_assembler,
+  return compiler.Assemble(macro_assembler.get(),
                            node,
                            data->capture_count,
                            pattern);
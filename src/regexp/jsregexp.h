@@ -73,7 +73,12 @@ class RegExpImpl {
                                  Handle<String> subject, int index,
                                  Handle<RegExpMatchInfo> last_match_info);
 
-  enum IrregexpResult { RE_FAILURE = 0, RE_SUCCESS = 1, RE_EXCEPTION = -1 };
+  enum IrregexpResult {
+    RE_FALLBACK_TO_LINEAR = -2,
+    RE_EXCEPTION = -1,
+    RE_FAILURE = 0,
+    RE_SUCCESS = 1
+  };
 
   // Prepare a RegExp for being executed one or more times (using
   // IrregexpExecOnce) on the subject.
@@ -151,6 +156,9 @@ class RegExpImpl {
   static int IrregexpNumberOfRegisters(FixedArray* re);
   static ByteArray* IrregexpByteCode(FixedArray* re, bool is_one_byte);
   static Code* IrregexpNativeCode(FixedArray* re, bool is_one_byte);
+  // Whether the compiled regexp runs in the bytecode interpreter rather than
+  // as native code.
+  static bool IrregexpUsesByteCode(FixedArray* re, bool is_one_byte);
 
   // Limit the space regexps take up on the heap.  In order to limit this we
   // would like to keep track of the amount of regexp code on the heap.  This
@@ -161,12 +169,38 @@ class RegExpImpl {
   static const size_t kRegExpCompiledLimit = 1 * MB;
   static const int kRegExpTooLargeToOptimize = 20 * KB;
 
+  // Minimal lengths of literals used to prefilter subjects, see
+  // SetIrregexpPrefilter(). Generated code leaves subjects shorter than
+  // kPrefilterMinSubjectLength to the matcher.
+  static const size_t kPrefilterMinPrefixLength = 2;
+  static const size_t kPrefilterMinLiteralLength = 3;
+  static const int kPrefilterMinSubjectLength = 1024;
+
  private:
   static bool CompileIrregexp(Handle<JSRegExp> re,
                               Handle<String> sample_subject, bool is_one_byte);
   static inline bool EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
                                             bool is_one_byte);
+  // With --regexp-tier-up, counts an execution of a regexp that runs in the
+  // interpreter and drops its bytecode once it should be compiled to native
+  // code instead.
+  static void IrregexpTickTierUp(Handle<JSRegExp> re, Handle<String> subject,
+                                 bool is_one_byte);
+  // Matches the regexp with the RegExpNfaMatcher, once the interpreter ran
+  // into the backtrack limit. Returns RE_SUCCESS or RE_FAILURE.
+  static IrregexpResult IrregexpExecLinear(Handle<JSRegExp> regexp,
+                                           Handle<String> subject, int index,
+                                           int32_t* output);
+  // Stores a literal that every match of {tree} contains, and whether every
+  // match starts with it, for IrregexpPrefilter().
+  static void SetIrregexpPrefilter(Isolate* isolate, Zone* zone,
+                                   Handle<FixedArray> re,
+                                   JSRegExp::Flags flags, RegExpTree* tree);
+  // Returns the first position from {index} on at which a match may start
+  // according to the literal, or -1 if the subject does not contain it.
+  static int IrregexpPrefilter(FixedArray* re, Handle<String> subject,
+                               int index);
 };
 
 
@@ -1506,7 +1540,7 @@ class RegExpEngine: public AllStatic {
                                    JSRegExp::Flags flags,
                                    Handle<String> pattern,
                                    Handle<String> sample_subject,
-                                   bool is_one_byte);
+                                   bool is_one_byte, bool use_bytecode);
 
   static bool TooMuchRegExpCode(Handle<String> pattern);
 
@@ -0,0 +1,436 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-nfa-matcher.h"
+
+#include <vector>
+
+#include "src/char-predicates-inl.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// Translates a regexp tree into a program for the matcher. Alternatives and
+// quantifiers become forks whose first target is the path that a backtracking
+// matcher would try first.
+class RegExpNfaMatcher::Compiler final : public RegExpVisitor {
+ public:
+  explicit Compiler(RegExpNfaMatcher* matcher)
+      : matcher_(matcher),
+        ignore_case_((matcher->flags_ & JSRegExp::kIgnoreCase) != 0),
+        ok_(true) {}
+
+  bool ok() const { return ok_; }
+
+  int Emit(Instruction::Opcode opcode, int a = 0, int b = 0,
+           ZoneList<CharacterRange>* ranges = nullptr, bool negated = false) {
+    Instruction instruction = {opcode, a, b, ranges, negated};
+    matcher_->program_.push_back(instruction);
+    if (pc() > kMaxProgramSize) ok_ = false;
+    return pc() - 1;
+  }
+
+  int pc() const { return static_cast<int>(matcher_->program_.size()); }
+
+#define DECLARE_VISIT(Name) \
+  void* Visit##Name(RegExp##Name* node, void* data) override;
+  FOR_EACH_REG_EXP_TREE_TYPE(DECLARE_VISIT)
+#undef DECLARE_VISIT
+
+ private:
+  Instruction& at(int pc) { return matcher_->program_[pc]; }
+  Zone* zone() const { return matcher_->zone_; }
+
+  void EmitCharacter(uc16 c);
+  void EmitCharacterClass(RegExpCharacterClass* node);
+  void EmitQuantifierBody(RegExpTree* body, Interval captures);
+
+  RegExpNfaMatcher* matcher_;
+  bool ignore_case_;
+  bool ok_;
+};
+
+void RegExpNfaMatcher::Compiler::EmitCharacter(uc16 c) {
+  ZoneList<CharacterRange>* ranges =
+      CharacterRange::List(zone(), CharacterRange::Singleton(c));
+  if (ignore_case_) {
+    CharacterRange::AddCaseEquivalents(matcher_->isolate_, zone(), ranges,
+                                       false);
+    CharacterRange::Canonicalize(ranges);
+  }
+  Emit(Instruction::kConsumeRange, 0, 0, ranges);
+}
+
+void RegExpNfaMatcher::Compiler::EmitCharacterClass(
+    RegExpCharacterClass* node) {
+  // Copy the ranges, irregexp modifies the ones in the tree when it adds case
+  // equivalents. As in TextNode::MakeCaseIndependent(), the standard
+  // character classes are the same in the case independent case.
+  ZoneList<CharacterRange>* ranges =
+      new (zone()) ZoneList<CharacterRange>(2, zone());
+  ranges->AddAll(*node->ranges(zone()), zone());
+  if (ignore_case_ && !node->is_standard(zone())) {
+    CharacterRange::AddCaseEquivalents(matcher_->isolate_, zone(), ranges,
+                                       false);
+  }
+  CharacterRange::Canonicalize(ranges);
+  Emit(Instruction::kConsumeRange, 0, 0, ranges, node->is_negated());
+}
+
+void RegExpNfaMatcher::Compiler::EmitQuantifierBody(RegExpTree* body,
+                                                    Interval captures) {
+  // Captures inside the body are reset at the start of every iteration.
+  if (!captures.is_empty()) {
+    Emit(Instruction::kClearRegisters, captures.from(), captures.to());
+  }
+  body->Accept(this, nullptr);
+}
+
+void* RegExpNfaMatcher::Compiler::VisitDisjunction(RegExpDisjunction* node,
+                                                   void* data) {
+  ZoneList<RegExpTree*>* alternatives = node->alternatives();
+  ZoneVector<int> jumps(zone());
+  for (int i = 0; i < alternatives->length() - 1 && ok_; i++) {
+    int fork = Emit(Instruction::kFork);
+    at(fork).a = pc();
+    alternatives->at(i)->Accept(this, nullptr);
+    jumps.push_back(Emit(Instruction::kJump));
+    at(fork).b = pc();
+  }
+  alternatives->last()->Accept(this, nullptr);
+  for (int jump : jumps) at(jump).a = pc();
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitAlternative(RegExpAlternative* node,
+                                                   void* data) {
+  ZoneList<RegExpTree*>* nodes = node->nodes();
+  for (int i = 0; i < nodes->length() && ok_; i++) {
+    nodes->at(i)->Accept(this, nullptr);
+  }
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitAssertion(RegExpAssertion* node,
+                                                 void* data) {
+  Emit(Instruction::kAssertion, node->assertion_type());
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitCharacterClass(
+    RegExpCharacterClass* node, void* data) {
+  EmitCharacterClass(node);
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitAtom(RegExpAtom* node, void* data) {
+  Vector<const uc16> chars = node->data();
+  for (int i = 0; i < chars.length() && ok_; i++) EmitCharacter(chars[i]);
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitQuantifier(RegExpQuantifier* node,
+                                                  void* data) {
+  RegExpTree* body = node->body();
+  int min = node->min();
+  int max = node->max();
+  // Optional iterations that match the empty string are rejected by the
+  // backtracking matcher, which would make threads depend on the position at
+  // which an iteration started. Leave those patterns to irregexp.
+  if (node->is_possessive() || (max > min && body->min_match() == 0)) {
+    ok_ = false;
+    return nullptr;
+  }
+  Interval captures = body->CaptureRegisters();
+  bool greedy = !node->is_non_greedy();
+  for (int i = 0; i < min && ok_; i++) EmitQuantifierBody(body, captures);
+  if (max == RegExpTree::kInfinity) {
+    int fork = Emit(Instruction::kFork);
+    EmitQuantifierBody(body, captures);
+    Emit(Instruction::kJump, fork);
+    at(fork).a = greedy ? fork + 1 : pc();
+    at(fork).b = greedy ? pc() : fork + 1;
+  } else {
+    ZoneVector<int> forks(zone());
+    for (int i = min; i < max && ok_; i++) {
+      forks.push_back(Emit(Instruction::kFork));
+      EmitQuantifierBody(body, captures);
+    }
+    for (int fork : forks) {
+      at(fork).a = greedy ? fork + 1 : pc();
+      at(fork).b = greedy ? pc() : fork + 1;
+    }
+  }
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitCapture(RegExpCapture* node,
+                                               void* data) {
+  Emit(Instruction::kSetRegister, RegExpCapture::StartRegister(node->index()));
+  node->body()->Accept(this, nullptr);
+  Emit(Instruction::kSetRegister, RegExpCapture::EndRegister(node->index()));
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitGroup(RegExpGroup* node, void* data) {
+  node->body()->Accept(this, nullptr);
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitLookaround(RegExpLookaround* node,
+                                                  void* data) {
+  ok_ = false;
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitBackReference(
+    RegExpBackReference* node, void* data) {
+  ok_ = false;
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitEmpty(RegExpEmpty* node, void* data) {
+  return nullptr;
+}
+
+void* RegExpNfaMatcher::Compiler::VisitText(RegExpText* node, void* data) {
+  ZoneList<TextElement>* elements = node->elements();
+  for (int i = 0; i < elements->length() && ok_; i++) {
+    TextElement element = elements->at(i);
+    if (element.text_type() == TextElement::ATOM) {
+      VisitAtom(element.atom(), nullptr);
+    } else {
+      EmitCharacterClass(element.char_class());
+    }
+  }
+  return nullptr;
+}
+
+RegExpNfaMatcher::RegExpNfaMatcher(Isolate* isolate, Zone* zone,
+                                   JSRegExp::Flags flags, int capture_count)
+    : isolate_(isolate),
+      zone_(zone),
+      flags_(flags),
+      register_count_((capture_count + 1) * 2),
+      program_(zone) {}
+
+bool RegExpNfaMatcher::Compile(RegExpTree* tree) {
+  DCHECK(program_.empty());
+  if ((flags_ & JSRegExp::kUnicode) != 0) return false;
+  Compiler compiler(this);
+  compiler.Emit(Instruction::kSetRegister, RegExpCapture::StartRegister(0));
+  tree->Accept(&compiler, nullptr);
+  compiler.Emit(Instruction::kSetRegister, RegExpCapture::EndRegister(0));
+  compiler.Emit(Instruction::kAccept);
+  return compiler.ok();
+}
+
+namespace {
+
+bool RangesContain(ZoneList<CharacterRange>* ranges, uc16 c) {
+  // The ranges are canonical, i.e. sorted and non-overlapping.
+  for (int i = 0; i < ranges->length(); i++) {
+    const CharacterRange& range = ranges->at(i);
+    if (c < range.from()) return false;
+    if (c <= range.to()) return true;
+  }
+  return false;
+}
+
+bool IsLineTerminator(uc16 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+template <typename Char>
+bool AssertionHolds(RegExpAssertion::AssertionType type,
+                    Vector<const Char> subject, int position) {
+  int length = subject.length();
+  switch (type) {
+    case RegExpAssertion::START_OF_INPUT:
+      return position == 0;
+    case RegExpAssertion::END_OF_INPUT:
+      return position == length;
+    case RegExpAssertion::START_OF_LINE:
+      return position == 0 || IsLineTerminator(subject[position - 1]);
+    case RegExpAssertion::END_OF_LINE:
+      return position == length || IsLineTerminator(subject[position]);
+    case RegExpAssertion::BOUNDARY:
+    case RegExpAssertion::NON_BOUNDARY: {
+      uc16 before = position > 0 ? subject[position - 1] : 0;
+      uc16 after = position < length ? subject[position] : 0;
+      bool word_before = position > 0 && IsRegExpWord(before);
+      bool word_after = position < length && IsRegExpWord(after);
+      return (word_before != word_after) ==
+             (type == RegExpAssertion::BOUNDARY);
+    }
+  }
+  UNREACHABLE();
+}
+
+// The threads of one step, in priority order. Every thread is waiting at a
+// kConsumeRange or kAccept instruction.
+class ThreadList {
+ public:
+  explicit ThreadList(int register_count) : register_count_(register_count) {}
+
+  void Add(int pc, const int32_t* registers) {
+    pcs_.push_back(pc);
+    registers_.insert(registers_.end(), registers,
+                      registers + register_count_);
+  }
+  void Clear() {
+    pcs_.clear();
+    registers_.clear();
+  }
+
+  int size() const { return static_cast<int>(pcs_.size()); }
+  bool is_empty() const { return pcs_.empty(); }
+  int pc(int i) const { return pcs_[i]; }
+  const int32_t* registers(int i) const {
+    return &registers_[i * register_count_];
+  }
+
+ private:
+  int register_count_;
+  std::vector<int> pcs_;
+  std::vector<int32_t> registers_;
+};
+
+}  // namespace
+
+template <typename Char>
+RegExpImpl::IrregexpResult RegExpNfaMatcher::MatchImpl(
+    Vector<const Char> subject, int index, int32_t* captures) {
+  const int length = subject.length();
+  const int register_count = register_count_;
+  const bool sticky = (flags_ & JSRegExp::kSticky) != 0;
+
+  ThreadList lists[2] = {ThreadList(register_count),
+                         ThreadList(register_count)};
+  ThreadList* current = &lists[0];
+  ThreadList* next = &lists[1];
+
+  // Registers of the thread whose epsilon closure is being computed.
+  std::vector<int32_t> scratch(register_count);
+  // Entries with a non-negative {pc} start a path at that instruction, the
+  // others restore {register_index} to {value} when backing out of a path.
+  struct StackEntry {
+    int pc;
+    int register_index;
+    int32_t value;
+  };
+  std::vector<StackEntry> stack;
+  // The generation in which an instruction was last reached, so that only
+  // the first, i.e. highest priority, thread that gets there survives.
+  std::vector<int> visited(program_.size(), -1);
+
+  // Follows all non-consuming instructions from {start_pc} in priority order
+  // and adds the resulting threads to {list}.
+  auto add_thread = [&](ThreadList* list, int start_pc, int position,
+                        int generation) {
+    stack.push_back({start_pc, 0, 0});
+    while (!stack.empty()) {
+      StackEntry entry = stack.back();
+      stack.pop_back();
+      if (entry.pc < 0) {
+        scratch[entry.register_index] = entry.value;
+        continue;
+      }
+      int pc = entry.pc;
+      while (pc >= 0 && visited[pc] != generation) {
+        visited[pc] = generation;
+        const Instruction& instruction = program_[pc];
+        switch (instruction.opcode) {
+          case Instruction::kJump:
+            pc = instruction.a;
+            break;
+          case Instruction::kFork:
+            stack.push_back({instruction.b, 0, 0});
+            pc = instruction.a;
+            break;
+          case Instruction::kSetRegister:
+            stack.push_back({-1, instruction.a, scratch[instruction.a]});
+            scratch[instruction.a] = position;
+            pc++;
+            break;
+          case Instruction::kClearRegisters:
+            for (int i = instruction.a; i <= instruction.b; i++) {
+              stack.push_back({-1, i, scratch[i]});
+              scratch[i] = -1;
+            }
+            pc++;
+            break;
+          case Instruction::kAssertion:
+            if (AssertionHolds(
+                    static_cast<RegExpAssertion::AssertionType>(instruction.a),
+                    subject, position)) {
+              pc++;
+            } else {
+              pc = -1;
+            }
+            break;
+          case Instruction::kConsumeRange:
+          case Instruction::kAccept:
+            list->Add(pc, scratch.data());
+            pc = -1;
+            break;
+        }
+      }
+    }
+  };
+
+  bool matched = false;
+  int generation = 0;
+  for (int position = index;; position++) {
+    // A match starting here has lower priority than all earlier starts.
+    if (!matched && (!sticky || position == index)) {
+      std::fill(scratch.begin(), scratch.end(), -1);
+      add_thread(current, 0, position, generation);
+    }
+    if (current->is_empty() && (matched || sticky || position >= length)) {
+      break;
+    }
+
+    generation++;
+    next->Clear();
+    for (int i = 0; i < current->size(); i++) {
+      const Instruction& instruction = program_[current->pc(i)];
+      const int32_t* registers = current->registers(i);
+      if (instruction.opcode == Instruction::kAccept) {
+        // Threads with a lower priority than this one are cut off.
+        matched = true;
+        std::copy(registers, registers + register_count, captures);
+        break;
+      }
+      DCHECK_EQ(Instruction::kConsumeRange, instruction.opcode);
+      if (position < length &&
+          RangesContain(instruction.ranges, subject[position]) !=
+              instruction.negated) {
+        std::copy(registers, registers + register_count, scratch.begin());
+        add_thread(next, current->pc(i) + 1, position + 1, generation);
+      }
+    }
+    std::swap(current, next);
+    if (position >= length) break;
+  }
+  return matched ? RegExpImpl::RE_SUCCESS : RegExpImpl::RE_FAILURE;
+}
+
+RegExpImpl::IrregexpResult RegExpNfaMatcher::Match(Handle<String> subject,
+                                                   int index,
+                                                   int32_t* captures) {
+  DCHECK(subject->IsFlat());
+  DCHECK(!program_.empty());
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = subject->GetFlatContent();
+  if (content.IsOneByte()) {
+    return MatchImpl(content.ToOneByteVector(), index, captures);
+  }
+  DCHECK(content.IsTwoByte());
+  return MatchImpl(content.ToUC16Vector(), index, captures);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,76 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_NFA_MATCHER_H_
+#define V8_REGEXP_REGEXP_NFA_MATCHER_H_
+
+#include "src/regexp/jsregexp.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+// A matcher for the regular subset of JavaScript regexps, used as a fallback
+// when backtracking takes too long (see --regexp-backtrack-limit). The regexp
+// tree is compiled to a small program which is run by a Pike VM: all
+// backtracking paths are simulated in lock step, so matching takes time
+// linear in the length of the subject. Threads are kept in the order in which
+// a backtracking matcher would try them, so the match and its captures are
+// the same as those found by irregexp.
+class RegExpNfaMatcher final {
+ public:
+  RegExpNfaMatcher(Isolate* isolate, Zone* zone, JSRegExp::Flags flags,
+                   int capture_count);
+
+  // Compiles {tree}. Returns false if it uses a construct that the matcher
+  // does not support: backreferences, lookarounds, possessive quantifiers,
+  // optional repetitions of subexpressions that can match the empty string,
+  // and unicode mode. Also fails if the program would get too large.
+  bool Compile(RegExpTree* tree);
+
+  // Matches the compiled program against {subject}, starting at {index}. On
+  // success, the capture positions are stored in {captures}, which must have
+  // room for (capture_count + 1) * 2 entries.
+  RegExpImpl::IrregexpResult Match(Handle<String> subject, int index,
+                                   int32_t* captures);
+
+ private:
+  class Compiler;
+
+  struct Instruction {
+    enum Opcode {
+      kConsumeRange,    // Consume a character in (or not in) {ranges}.
+      kFork,            // Continue at {a}, then at {b}.
+      kJump,            // Continue at {a}.
+      kSetRegister,     // Set register {a} to the current position.
+      kClearRegisters,  // Clear the registers from {a} to {b}.
+      kAssertion,       // Check the RegExpAssertion::AssertionType {a}.
+      kAccept
+    };
+    Opcode opcode;
+    int a;
+    int b;
+    ZoneList<CharacterRange>* ranges;
+    bool negated;
+  };
+
+  // Upper bound for the number of instructions in a program.
+  static const int kMaxProgramSize = 20000;
+
+  template <typename Char>
+  RegExpImpl::IrregexpResult MatchImpl(Vector<const Char> subject, int index,
+                                       int32_t* captures);
+
+  Isolate* isolate_;
+  Zone* zone_;
+  JSRegExp::Flags flags_;
+  int register_count_;
+  ZoneVector<Instruction> program_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_NFA_MATCHER_H_
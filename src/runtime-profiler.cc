@@ -15,6 +15,8 @@
 #include "src/full-codegen/full-codegen.h"
 #include "src/global-handles.h"
 #include "src/interpreter/interpreter.h"
+#include "src/tracing/trace-event.h"
+#include "src/tracing/traced-value.h"
 
 namespace v8 {
 namespace internal {
@@ -69,6 +71,7 @@ static const int kMaxSizeOptIgnition = 60 * KB;
   V(DoNotOptimize, "do not optimize")                          \
   V(HotAndStable, "hot and stable")                            \
   V(HotWithoutMuchTypeInfo, "not much type info but very hot") \
+  V(HotForCompileCost, "hot enough to amortize compile cost")  \
   V(SmallFunction, "small function")
 
 enum class OptimizationReason : uint8_t {
@@ -152,10 +155,47 @@ static void TraceRecompile(JSFunction* function, const char* reason,
   }
 }
 
+static void TraceOptimizationDecision(JSFunction* function,
+                                      OptimizationReason reason) {
+  bool enabled = false;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                                     &enabled);
+  if (!enabled) return;
+  SharedFunctionInfo* shared = function->shared();
+  auto value = v8::tracing::TracedValue::Create();
+  value->SetString("function", shared->DebugName()->ToCString().get());
+  value->SetString("reason", OptimizationReasonToString(reason));
+  value->SetInteger("ticks", shared->profiler_ticks());
+  if (shared->HasBytecodeArray()) {
+    value->SetInteger("bytecode_size", shared->bytecode_array()->Size());
+  }
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                       "V8.MarkForOptimization", TRACE_EVENT_SCOPE_THREAD,
+                       "data", std::move(value));
+}
+
+// Returns the number of ticks after which the interpreted work spent in
+// {shared} is expected to outweigh the cost of optimizing it. Every tick
+// stands for one interrupt budget of work, which is charged to the bytecode
+// array of the function that executed it, so ticks sample the time spent in
+// a function across all of its calls.
+static int TicksForOptimizationByCost(SharedFunctionInfo* shared) {
+  int64_t speedup = Max(FLAG_tierup_expected_speedup, 2);
+  int64_t saved_per_tick =
+      interpreter::Interpreter::InterruptBudget() * (speedup - 1) / speedup;
+  int64_t compile_cost =
+      static_cast<int64_t>(shared->bytecode_array()->Size()) *
+      Max(FLAG_tierup_compile_cost_per_byte, 0);
+  int64_t ticks = (compile_cost + saved_per_tick - 1) / saved_per_tick;
+  ticks = Min<int64_t>(ticks, kMaxInt);
+  return Max(kProfilerTicksBeforeOptimization, static_cast<int>(ticks));
+}
+
 void RuntimeProfiler::Optimize(JSFunction* function,
                                OptimizationReason reason) {
   DCHECK_NE(reason, OptimizationReason::kDoNotOptimize);
   TraceRecompile(function, OptimizationReasonToString(reason), "optimized");
+  TraceOptimizationDecision(function, reason);
   function->MarkForOptimization(ConcurrencyMode::kConcurrent);
 }
 
@@ -373,8 +413,11 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
   }
 
   int ticks_for_optimization =
-      kProfilerTicksBeforeOptimization +
-      (shared->bytecode_array()->Size() / kCodeSizeAllowancePerTickIgnition);
+      FLAG_tierup_cost_model
+          ? TicksForOptimizationByCost(shared)
+          : kProfilerTicksBeforeOptimization +
+                (shared->bytecode_array()->Size() /
+                 kCodeSizeAllowancePerTickIgnition);
   if (ticks >= ticks_for_optimization) {
     int typeinfo, generic, total, type_percentage, generic_percentage;
     GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
@@ -382,7 +425,8 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
     if (type_percentage >= FLAG_type_info_threshold) {
       // If this particular function hasn't had any ICs patched for enough
       // ticks, optimize it now.
-      return OptimizationReason::kHotAndStable;
+      return FLAG_tierup_cost_model ? OptimizationReason::kHotForCompileCost
+                                    : OptimizationReason::kHotAndStable;
     } else if (ticks >= kTicksWhenNotEnoughTypeInfo) {
       return OptimizationReason::kHotWithoutMuchTypeInfo;
     } else {
@@ -394,10 +438,11 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
       }
       return OptimizationReason::kDoNotOptimize;
     }
-  } else if (!any_ic_changed_ &&
+  } else if (!FLAG_tierup_cost_model && !any_ic_changed_ &&
              shared->bytecode_array()->Size() < kMaxSizeEarlyOptIgnition) {
     // If no IC was patched since the last tick and this function is very
-    // small, optimistically optimize it now.
+    // small, optimistically optimize it now. The cost model does not do this,
+    // as small functions are cheap to keep interpreting until they get hot.
     int typeinfo, generic, total, type_percentage, generic_percentage;
     GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
                 &generic_percentage);
@@ -416,9 +461,10 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
   } else if (FLAG_trace_opt_verbose) {
     PrintF("[not yet optimizing ");
     function->PrintName();
-    PrintF(", not enough ticks: %d/%d and ", ticks,
-           kProfilerTicksBeforeOptimization);
-    if (any_ic_changed_) {
+    PrintF(", not enough ticks: %d/%d and ", ticks, ticks_for_optimization);
+    if (FLAG_tierup_cost_model) {
+      PrintF("compile cost not yet amortized]\n");
+    } else if (any_ic_changed_) {
       PrintF("ICs changed]\n");
     } else {
       PrintF(" too large for small function optimization: %d/%d]\n",
@@ -428,9 +474,29 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
   return OptimizationReason::kDoNotOptimize;
 }
 
+void RuntimeProfiler::AllocateFeedbackVectors() {
+  // Collect the functions first, as allocating the vectors may cause a GC.
+  std::vector<Handle<JSFunction>> functions;
+  int frame_count = 0;
+  int frame_count_limit = FLAG_frame_count;
+  for (JavaScriptFrameIterator it(isolate_);
+       frame_count++ < frame_count_limit && !it.done(); it.Advance()) {
+    JSFunction* function = it.frame()->function();
+    if (!function->shared()->IsInterpreted()) continue;
+    if (function->has_feedback_vector()) continue;
+    functions.push_back(handle(function, isolate_));
+  }
+  for (Handle<JSFunction> function : functions) {
+    JSFunction::EnsureLiterals(function);
+  }
+}
+
 void RuntimeProfiler::MarkCandidatesForOptimization() {
   HandleScope scope(isolate_);
 
+  // Functions without a feedback vector have used up their initial budget.
+  if (FLAG_lazy_feedback_allocation) AllocateFeedbackVectors();
+
   if (!isolate_->use_optimizer()) return;
 
   DisallowHeapAllocation no_gc;
@@ -27,6 +27,9 @@ class RuntimeProfiler {
                                  int nesting_levels = 1);
 
  private:
+  // Allocates the feedback vectors of the interpreted functions on top of the
+  // stack that run without one, see --lazy-feedback-allocation.
+  void AllocateFeedbackVectors();
   void MaybeOptimizeFullCodegen(JSFunction* function, JavaScriptFrame* frame,
                                 int frame_count);
   void MaybeBaselineIgnition(JSFunction* function, JavaScriptFrame* frame);
@@ -56,7 +56,7 @@ RUNTIME_FUNCTION(Runtime_SpecialArrayFunctions) {
   InstallBuiltin(isolate, holder, "push", Builtins::kFastArrayPush);
   InstallBuiltin(isolate, holder, "shift", Builtins::kFastArrayShift);
   InstallBuiltin(isolate, holder, "unshift", Builtins::kArrayUnshift);
-  InstallBuiltin(isolate, holder, "slice", Builtins::kArraySlice);
+  InstallBuiltin(isolate, holder, "slice", Builtins::kFastArraySlice);
   InstallBuiltin(isolate, holder, "splice", Builtins::kArraySplice);
   InstallBuiltin(isolate, holder, "includes", Builtins::kArrayIncludes);
   InstallBuiltin(isolate, holder, "indexOf", Builtins::kArrayIndexOf);
@@ -117,6 +117,36 @@ RUNTIME_FUNCTION(Runtime_RemoveArrayHoles) {
 }
 
 
+// Sorts the first {length} elements of an object with Smi elements, whose
+// holes were already removed, in the order of the default comparison
+// function, i.e. comparing the string representations of the Smis.
+// Returns false if the elements are not all Smis.
+RUNTIME_FUNCTION(Runtime_SortSmiElementsFast) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_CHECKED(JSReceiver, object, 0);
+  CONVERT_NUMBER_CHECKED(uint32_t, length, Uint32, args[1]);
+  if (!object->IsJSObject()) return isolate->heap()->false_value();
+  ElementsKind kind = JSObject::cast(object)->GetElementsKind();
+  if (!IsFastSmiElementsKind(kind)) return isolate->heap()->false_value();
+  FixedArrayBase* elements = JSObject::cast(object)->elements();
+  // Copy-on-write elements are shared and must not be sorted in place.
+  if (elements->map() != isolate->heap()->fixed_array_map() ||
+      length > static_cast<uint32_t>(elements->length())) {
+    return isolate->heap()->false_value();
+  }
+  DisallowHeapAllocation no_gc;
+  Object** start = FixedArray::cast(elements)->data_start();
+  for (uint32_t i = 0; i < length; i++) {
+    if (!start[i]->IsSmi()) return isolate->heap()->false_value();
+  }
+  // Smis are not heap pointers, so they can be moved without write barriers.
+  std::stable_sort(start, start + length, [](Object* a, Object* b) {
+    return Smi::LexicographicCompare(Smi::cast(a), Smi::cast(b)) == LESS;
+  });
+  return isolate->heap()->true_value();
+}
+
 // Move contents of argument 0 (an array) to argument 1 (an array)
 RUNTIME_FUNCTION(Runtime_MoveArrayContents) {
   HandleScope scope(isolate);
@@ -14,6 +14,7 @@
 #include "src/frames-inl.h"
 #include "src/isolate-inl.h"
 #include "src/messages.h"
+#include "src/objects/literal-objects.h"
 #include "src/runtime/runtime.h"
 
 namespace v8 {
@@ -105,10 +106,119 @@ RUNTIME_FUNCTION(Runtime_HomeObjectSymbol) {
   return isolate->heap()->home_object_symbol();
 }
 
-static MaybeHandle<Object> DefineClass(Isolate* isolate,
-                                       Handle<Object> super_class,
-                                       Handle<JSFunction> constructor,
-                                       int start_position, int end_position) {
+namespace {
+
+// Index of the first closure argument of Runtime_DefineClassWithBoilerplate.
+const int kFirstClassValueArgumentIndex = 5;
+
+Handle<Object> ClassValueArgument(Isolate* isolate, Arguments* args,
+                                  int index) {
+  if (index == ClassBoilerplate::kNoArgument) {
+    return isolate->factory()->null_value();
+  }
+  return args->at(kFirstClassValueArgumentIndex + index);
+}
+
+// Reads the {entry}-th element of a boilerplate property list. For data
+// properties {second} is null, for accessors missing components are null.
+bool GetClassBoilerplateEntry(Isolate* isolate, FixedArray* properties,
+                              int entry, Arguments* args, Handle<Name>* name,
+                              Handle<Object>* first, Handle<Object>* second) {
+  int base = entry * ClassBoilerplate::kEntrySize;
+  *name = handle(
+      Name::cast(properties->get(base + ClassBoilerplate::kEntryNameIndex)),
+      isolate);
+  int first_index =
+      Smi::cast(properties->get(base + ClassBoilerplate::kEntryFirstIndex))
+          ->value();
+  int second_index =
+      Smi::cast(properties->get(base + ClassBoilerplate::kEntrySecondIndex))
+          ->value();
+  *first = ClassValueArgument(isolate, args, first_index);
+  *second = ClassValueArgument(isolate, args, second_index);
+  Object* kind = properties->get(base + ClassBoilerplate::kEntryKindIndex);
+  return kind == Smi::FromInt(ClassBoilerplate::kAccessor);
+}
+
+// Adds the "constructor" property and the properties described by the
+// {boilerplate} to the {map} of a fresh class prototype, so that the
+// prototype is created with its final map.
+void InitializeClassPrototypeMap(Isolate* isolate, Handle<Map> map,
+                                 Handle<JSFunction> constructor,
+                                 Handle<ClassBoilerplate> boilerplate,
+                                 Arguments* args) {
+  Handle<FixedArray> properties(boilerplate->prototype_properties(), isolate);
+  int count = properties->length() / ClassBoilerplate::kEntrySize;
+  Map::EnsureDescriptorSlack(map, count + 1);
+
+  Descriptor constructor_descriptor = Descriptor::DataConstant(
+      isolate->factory()->constructor_string(), constructor, DONT_ENUM);
+  map->AppendDescriptor(&constructor_descriptor);
+
+  for (int i = 0; i < count; i++) {
+    Handle<Name> name;
+    Handle<Object> first, second;
+    if (GetClassBoilerplateEntry(isolate, *properties, i, args, &name, &first,
+                                 &second)) {
+      Handle<AccessorPair> pair = isolate->factory()->NewAccessorPair();
+      pair->set_getter(*first);
+      pair->set_setter(*second);
+      Descriptor d = Descriptor::AccessorConstant(name, pair, DONT_ENUM);
+      map->AppendDescriptor(&d);
+    } else {
+      Descriptor d = Descriptor::DataConstant(name, first, DONT_ENUM);
+      map->AppendDescriptor(&d);
+    }
+  }
+
+  // Keep the prototype in fast mode when it is installed on the constructor.
+  Map::SetShouldBeFastPrototypeMap(map, true, isolate);
+}
+
+MaybeHandle<Object> DefineClassStaticProperties(
+    Isolate* isolate, Handle<JSFunction> constructor,
+    Handle<ClassBoilerplate> boilerplate, Arguments* args) {
+  Handle<FixedArray> properties(boilerplate->static_properties(), isolate);
+  int count = properties->length() / ClassBoilerplate::kEntrySize;
+  for (int i = 0; i < count; i++) {
+    Handle<Name> name;
+    Handle<Object> first, second;
+    // The constructor already owns "length" and possibly "name", so go
+    // through the generic definitions instead of appending descriptors.
+    if (GetClassBoilerplateEntry(isolate, *properties, i, args, &name, &first,
+                                 &second)) {
+      RETURN_ON_EXCEPTION(isolate,
+                          JSObject::DefineAccessor(constructor, name, first,
+                                                   second, DONT_ENUM),
+                          Object);
+    } else {
+      RETURN_ON_EXCEPTION(isolate,
+                          JSObject::SetOwnPropertyIgnoreAttributes(
+                              constructor, name, first, DONT_ENUM),
+                          Object);
+    }
+  }
+  return constructor;
+}
+
+void SetClassHomeObjects(Isolate* isolate, Handle<FixedArray> indices,
+                         Handle<JSObject> home_object, Arguments* args) {
+  for (int i = 0; i < indices->length(); i++) {
+    int index = Smi::cast(indices->get(i))->value();
+    Handle<JSObject> method =
+        Handle<JSObject>::cast(ClassValueArgument(isolate, args, index));
+    JSObject::AddProperty(method, isolate->factory()->home_object_symbol(),
+                          home_object, NONE);
+  }
+}
+
+}  // namespace
+
+static MaybeHandle<Object> DefineClass(
+    Isolate* isolate, Handle<Object> super_class,
+    Handle<JSFunction> constructor, int start_position, int end_position,
+    Handle<ClassBoilerplate> boilerplate = Handle<ClassBoilerplate>(),
+    Arguments* args = nullptr) {
   Handle<Object> prototype_parent;
   Handle<Object> constructor_parent;
 
@@ -147,6 +257,9 @@ static MaybeHandle<Object> DefineClass(Isolate* isolate,
   map->set_is_prototype_map(true);
   Map::SetPrototype(map, prototype_parent);
   map->SetConstructor(*constructor);
+  if (!boilerplate.is_null()) {
+    InitializeClassPrototypeMap(isolate, map, constructor, boilerplate, args);
+  }
   Handle<JSObject> prototype = isolate->factory()->NewJSObjectFromMap(map);
 
   JSFunction::SetPrototype(constructor, prototype);
@@ -163,8 +276,10 @@ static MaybeHandle<Object> DefineClass(Isolate* isolate,
                                              false, Object::THROW_ON_ERROR));
   }
 
-  JSObject::AddProperty(prototype, isolate->factory()->constructor_string(),
-                        constructor, DONT_ENUM);
+  if (boilerplate.is_null()) {
+    JSObject::AddProperty(prototype, isolate->factory()->constructor_string(),
+                          constructor, DONT_ENUM);
+  }
 
   // Install private properties that are used to construct the FunctionToString.
   RETURN_ON_EXCEPTION(
@@ -197,6 +312,34 @@ RUNTIME_FUNCTION(Runtime_DefineClass) {
                            end_position));
 }
 
+RUNTIME_FUNCTION(Runtime_DefineClassWithBoilerplate) {
+  HandleScope scope(isolate);
+  DCHECK_LE(kFirstClassValueArgumentIndex, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(Object, super_class, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, constructor, 1);
+  CONVERT_SMI_ARG_CHECKED(start_position, 2);
+  CONVERT_SMI_ARG_CHECKED(end_position, 3);
+  CONVERT_ARG_HANDLE_CHECKED(ClassBoilerplate, boilerplate, 4);
+
+  Handle<Object> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, result,
+      DefineClass(isolate, super_class, constructor, start_position,
+                  end_position, boilerplate, &args));
+  Handle<JSObject> prototype = Handle<JSObject>::cast(result);
+  SetClassHomeObjects(isolate,
+                      handle(boilerplate->prototype_home_objects(), isolate),
+                      prototype, &args);
+  SetClassHomeObjects(isolate,
+                      handle(boilerplate->static_home_objects(), isolate),
+                      constructor, &args);
+  RETURN_FAILURE_ON_EXCEPTION(
+      isolate,
+      DefineClassStaticProperties(isolate, constructor, boilerplate, &args));
+  // Caller already has access to constructor, so return the prototype.
+  return *prototype;
+}
+
 namespace {
 void InstallClassNameAccessor(Isolate* isolate, Handle<JSObject> object) {
   PropertyAttributes attrs =
@@ -11,8 +11,12 @@
 #include "src/deoptimizer.h"
 #include "src/frames-inl.h"
 #include "src/full-codegen/full-codegen.h"
+#include "src/interpreter/bytecode-array-accessor.h"
 #include "src/isolate-inl.h"
 #include "src/messages.h"
+#include "src/snapshot/snapshot.h"
+#include "src/tracing/trace-event.h"
+#include "src/tracing/traced-value.h"
 #include "src/v8threads.h"
 #include "src/vm-state-inl.h"
 
@@ -43,6 +47,37 @@ RUNTIME_FUNCTION(Runtime_CompileLazy) {
   return function->code();
 }
 
+RUNTIME_FUNCTION(Runtime_DeserializeLazy) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+
+  // The placeholder that called us carries the index of the builtin it stands
+  // in for. It is not necessarily the code of {function}, e.g. when it has
+  // been entered as a construct stub.
+  int builtin_index;
+  {
+    StackFrameIterator it(isolate, isolate->thread_local_top());
+    // On top: C entry stub.
+    DCHECK_EQ(StackFrame::EXIT, it.frame()->type());
+    it.Advance();
+    // Next: the placeholder.
+    DCHECK_EQ(StackFrame::INTERNAL, it.frame()->type());
+    builtin_index = it.frame()->LookupCode()->builtin_index();
+  }
+  DCHECK(Builtins::IsLazyDeserializationCandidate(builtin_index));
+
+  Handle<Code> code(Snapshot::EnsureBuiltinIsDeserialized(isolate,
+                                                          builtin_index));
+  if (function->shared()->code()->builtin_index() == builtin_index) {
+    function->shared()->set_code(*code);
+  }
+  if (function->code()->builtin_index() == builtin_index) {
+    function->set_code(*code);
+  }
+  return *code;
+}
+
 RUNTIME_FUNCTION(Runtime_CompileOptimized_Concurrent) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -159,6 +194,145 @@ class ActivationsFinder : public ThreadVisitor {
   }
 };
 
+namespace {
+
+// Generalizes the feedback that the bytecode at {bytecode_offset} of
+// {function} speculates on, so that the next optimization of the function
+// emits generic code for it. Returns whether the feedback changed.
+bool GeneralizeFeedbackAt(Isolate* isolate, Handle<JSFunction> function,
+                          int bytecode_offset) {
+  Handle<BytecodeArray> bytecode_array(function->shared()->bytecode_array(),
+                                       isolate);
+  interpreter::BytecodeArrayAccessor accessor(bytecode_array, bytecode_offset);
+  interpreter::Bytecode bytecode = accessor.current_bytecode();
+  if (interpreter::Bytecodes::IsJump(bytecode)) return false;
+
+  // The bytecodes that speculate on feedback take their feedback slot as the
+  // last operand.
+  int last_operand = interpreter::Bytecodes::NumberOfOperands(bytecode) - 1;
+  if (last_operand < 0 ||
+      interpreter::Bytecodes::GetOperandType(bytecode, last_operand) !=
+          interpreter::OperandType::kIdx) {
+    return false;
+  }
+  int index = static_cast<int>(accessor.GetIndexOperand(last_operand));
+  Handle<FeedbackVector> vector(function->feedback_vector(), isolate);
+  if (index < FeedbackVector::kReservedIndexCount ||
+      index >= vector->length()) {
+    return false;
+  }
+  FeedbackSlot slot = FeedbackVector::ToSlot(index);
+
+  switch (vector->GetKind(slot)) {
+    case FeedbackSlotKind::kBinaryOp: {
+      Smi* any = Smi::FromInt(BinaryOperationFeedback::kAny);
+      if (vector->Get(slot) == any) return false;
+      vector->Set(slot, any, SKIP_WRITE_BARRIER);
+      return true;
+    }
+    case FeedbackSlotKind::kCompareOp: {
+      Smi* any = Smi::FromInt(CompareOperationFeedback::kAny);
+      if (vector->Get(slot) == any) return false;
+      vector->Set(slot, any, SKIP_WRITE_BARRIER);
+      return true;
+    }
+    case FeedbackSlotKind::kCall: {
+      CallICNexus nexus(vector, slot);
+      if (nexus.ic_state() == MEGAMORPHIC) return false;
+      // Keep the call count in the feedback extra.
+      vector->Set(slot, *FeedbackVector::MegamorphicSentinel(isolate),
+                  SKIP_WRITE_BARRIER);
+      return true;
+    }
+    case FeedbackSlotKind::kLoadProperty: {
+      LoadICNexus nexus(vector, slot);
+      if (nexus.ic_state() == MEGAMORPHIC) return false;
+      nexus.ConfigureMegamorphic(PROPERTY);
+      return true;
+    }
+    case FeedbackSlotKind::kLoadKeyed: {
+      KeyedLoadICNexus nexus(vector, slot);
+      if (nexus.ic_state() == MEGAMORPHIC) return false;
+      nexus.ConfigureMegamorphic(nexus.GetKeyType());
+      return true;
+    }
+    case FeedbackSlotKind::kStoreNamedSloppy:
+    case FeedbackSlotKind::kStoreNamedStrict:
+    case FeedbackSlotKind::kStoreOwnNamed: {
+      StoreICNexus nexus(vector, slot);
+      if (nexus.ic_state() == MEGAMORPHIC) return false;
+      nexus.ConfigureMegamorphic(PROPERTY);
+      return true;
+    }
+    case FeedbackSlotKind::kStoreKeyedSloppy:
+    case FeedbackSlotKind::kStoreKeyedStrict: {
+      KeyedStoreICNexus nexus(vector, slot);
+      if (nexus.ic_state() == MEGAMORPHIC) return false;
+      nexus.ConfigureMegamorphic(nexus.GetKeyType());
+      return true;
+    }
+    case FeedbackSlotKind::kInstanceOf:
+    case FeedbackSlotKind::kHasProperty: {
+      Object* megamorphic = *FeedbackVector::MegamorphicSentinel(isolate);
+      if (vector->Get(slot) == megamorphic) return false;
+      vector->Set(slot, megamorphic, SKIP_WRITE_BARRIER);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+void TraceDeoptimizationSite(Handle<JSFunction> function,
+                             DeoptimizeReason reason, int bytecode_offset,
+                             int site_count, bool generalized) {
+  bool enabled = false;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                                     &enabled);
+  if (!enabled) return;
+  SharedFunctionInfo* shared = function->shared();
+  auto value = v8::tracing::TracedValue::Create();
+  value->SetString("function", shared->DebugName()->ToCString().get());
+  value->SetString("reason", DeoptimizeReasonToString(reason));
+  value->SetInteger("bytecode_offset", bytecode_offset);
+  value->SetInteger("site_deopt_count", site_count);
+  value->SetInteger("deopt_count", shared->deopt_count());
+  value->SetInteger("opt_count", shared->opt_count());
+  value->SetBoolean("generalized", generalized);
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                       "V8.DeoptimizationSite", TRACE_EVENT_SCOPE_THREAD,
+                       "data", std::move(value));
+}
+
+// Records the site of an eager deoptimization in the interpreted {frame}.
+// Once the same site has deoptimized for the same reason often enough, its
+// feedback is generalized instead of reoptimizing with the same speculation
+// until the function runs out of deoptimizations.
+void RecordEagerDeoptimization(Isolate* isolate, JavaScriptFrame* frame,
+                               DeoptimizeReason reason) {
+  if (!frame->is_interpreted()) return;
+  Handle<JSFunction> function(frame->function(), isolate);
+  if (!function->shared()->HasBytecodeArray()) return;
+  int bytecode_offset =
+      static_cast<InterpretedFrame*>(frame)->GetBytecodeOffset();
+  int site_count = isolate->deoptimizer_data()->RecordDeoptimizationSite(
+      function->shared(), bytecode_offset, reason);
+  bool generalized = false;
+  if (FLAG_deopt_site_generalization_threshold > 0 &&
+      site_count >= FLAG_deopt_site_generalization_threshold) {
+    generalized = GeneralizeFeedbackAt(isolate, function, bytecode_offset);
+    if (generalized && FLAG_trace_deopt) {
+      PrintF("[generalizing feedback at offset %d of ", bytecode_offset);
+      function->PrintName();
+      PrintF(" after %d deopts (%s)]\n", site_count,
+             DeoptimizeReasonToString(reason));
+    }
+  }
+  TraceDeoptimizationSite(function, reason, bytecode_offset, site_count,
+                          generalized);
+}
+
+}  // namespace
 
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   HandleScope scope(isolate);
@@ -173,6 +347,9 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
 
   Handle<JSFunction> function = deoptimizer->function();
   Handle<Code> optimized_code = deoptimizer->compiled_code();
+  DeoptimizeReason reason =
+      Deoptimizer::GetDeoptInfo(*optimized_code, deoptimizer->from())
+          .deopt_reason;
 
   DCHECK(optimized_code->kind() == Code::OPTIMIZED_FUNCTION);
   DCHECK(optimized_code->is_turbofanned());
@@ -184,8 +361,16 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   isolate->set_context(function->native_context());
 
   // Make sure to materialize objects before causing any allocation.
+  base::ElapsedTimer materialization_timer;
+  if (FLAG_print_deopt_stats) materialization_timer.Start();
   JavaScriptFrameIterator it(isolate);
   deoptimizer->MaterializeHeapObjects(&it);
+  if (FLAG_print_deopt_stats) {
+    isolate->deoptimizer_data()->RecordDeoptimizationCost(
+        reason, deoptimizer->output_count(),
+        deoptimizer->compute_output_frames_time(),
+        materialization_timer.Elapsed());
+  }
   delete deoptimizer;
 
   // Ensure the context register is updated for materialized objects.
@@ -197,6 +382,10 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
     return isolate->heap()->undefined_value();
   }
 
+  if (type == Deoptimizer::EAGER) {
+    RecordEagerDeoptimization(isolate, top_frame, reason);
+  }
+
   // Search for other activations of the same optimized code.
   // At this point {it} is at the topmost frame of all the frames materialized
   // by the deoptimizer. Note that this frame does not necessarily represent
@@ -321,13 +510,39 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
   DCHECK(!ast_id.IsNone());
 
   MaybeHandle<Code> maybe_result;
+  bool queued = false;
   if (IsSuitableForOnStackReplacement(isolate, function)) {
+    ConcurrencyMode mode = FLAG_concurrent_osr && frame->is_interpreted() &&
+                                   isolate->concurrent_recompilation_enabled()
+                               ? ConcurrencyMode::kConcurrent
+                               : ConcurrencyMode::kNotConcurrent;
+    OptimizingCompileDispatcher* dispatcher =
+        mode == ConcurrencyMode::kConcurrent
+            ? isolate->optimizing_compile_dispatcher()
+            : nullptr;
+    if (dispatcher && dispatcher->IsQueuedForOsr(*function, ast_id)) {
+      queued = true;
+    } else {
+      if (FLAG_trace_osr) {
+        PrintF("[OSR - Compiling: ");
+        function->PrintName();
+        PrintF(" at AST id %d]\n", ast_id.ToInt());
+      }
+      maybe_result =
+          Compiler::GetOptimizedCodeForOSR(function, ast_id, frame, mode);
+      queued = maybe_result.is_null() && dispatcher &&
+               dispatcher->IsQueuedForOsr(*function, ast_id);
+    }
+  }
+
+  // Keep running the loop in the interpreter while the code is compiled.
+  if (queued) {
     if (FLAG_trace_osr) {
-      PrintF("[OSR - Compiling: ");
+      PrintF("[OSR - Queued: ");
       function->PrintName();
       PrintF(" at AST id %d]\n", ast_id.ToInt());
     }
-    maybe_result = Compiler::GetOptimizedCodeForOSR(function, ast_id, frame);
+    return NULL;
   }
 
   // Check whether we ended up with usable optimized code.
@@ -1984,6 +1984,14 @@ RUNTIME_FUNCTION(Runtime_DebugToggleBlockCoverage) {
   return isolate->heap()->undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_DebugToggleBestEffortBlockCoverage) {
+  SealHandleScope shs(isolate);
+  CONVERT_BOOLEAN_ARG_CHECKED(enable, 0);
+  Coverage::SelectMode(isolate, enable ? debug::Coverage::kBlockCountBestEffort
+                                       : debug::Coverage::kBestEffort);
+  return isolate->heap()->undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_IncBlockCounter) {
   SealHandleScope scope(isolate);
   DCHECK_EQ(2, args.length());
@@ -1992,6 +2000,12 @@ RUNTIME_FUNCTION(Runtime_IncBlockCounter) {
 
   DCHECK(FLAG_block_coverage);
 
+  // Coverage infos are removed when switching back to best effort coverage,
+  // while bytecode compiled with block counters may still be running.
+  if (!function->shared()->HasCoverageInfo()) {
+    return isolate->heap()->undefined_value();
+  }
+
   DebugInfo* debug_info = function->shared()->GetDebugInfo();
   CoverageInfo* coverage_info = CoverageInfo::cast(debug_info->coverage_info());
   coverage_info->IncrementBlockCount(coverage_array_slot_index);
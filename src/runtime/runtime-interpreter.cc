@@ -24,10 +24,17 @@ RUNTIME_FUNCTION(Runtime_InterpreterNewClosure) {
   HandleScope scope(isolate);
   DCHECK_EQ(4, args.length());
   CONVERT_ARG_HANDLE_CHECKED(SharedFunctionInfo, shared, 0);
-  CONVERT_ARG_HANDLE_CHECKED(FeedbackVector, vector, 1);
+  CONVERT_ARG_HANDLE_CHECKED(Object, maybe_vector, 1);
   CONVERT_SMI_ARG_CHECKED(index, 2);
   CONVERT_SMI_ARG_CHECKED(pretenured_flag, 3);
   Handle<Context> context(isolate->context(), isolate);
+  if (!maybe_vector->IsFeedbackVector()) {
+    // The enclosing function runs without a feedback vector, so there is no
+    // cell to share between the closures; the new one gets its own vector.
+    return *isolate->factory()->NewFunctionFromSharedFunctionInfo(
+        shared, context, static_cast<PretenureFlag>(pretenured_flag));
+  }
+  Handle<FeedbackVector> vector = Handle<FeedbackVector>::cast(maybe_vector);
   FeedbackSlot slot = FeedbackVector::ToSlot(index);
   Handle<Cell> vector_cell(Cell::cast(vector->Get(slot)), isolate);
   return *isolate->factory()->NewFunctionFromSharedFunctionInfo(
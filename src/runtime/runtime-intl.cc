@@ -36,6 +36,7 @@
 #include "unicode/numsys.h"
 #include "unicode/rbbi.h"
 #include "unicode/smpdtfmt.h"
+#include "unicode/stringpiece.h"
 #include "unicode/timezone.h"
 #include "unicode/translit.h"
 #include "unicode/uchar.h"
@@ -608,13 +609,27 @@ RUNTIME_FUNCTION(Runtime_InternalCompare) {
     int32_t length2 = string2->length();
     String::FlatContent flat1 = string1->GetFlatContent();
     String::FlatContent flat2 = string2->GetFlatContent();
-    std::unique_ptr<uc16[]> sap1;
-    std::unique_ptr<uc16[]> sap2;
-    icu::UnicodeString string_val1(
-        FALSE, GetUCharBufferFromFlat(flat1, &sap1, length1), length1);
-    icu::UnicodeString string_val2(
-        FALSE, GetUCharBufferFromFlat(flat2, &sap2, length2), length2);
-    result = collator->compare(string_val1, string_val2, status);
+    if (flat1.IsOneByte() && flat2.IsOneByte() &&
+        String::IsAscii(flat1.ToOneByteVector().start(), length1) &&
+        String::IsAscii(flat2.ToOneByteVector().start(), length2)) {
+      // ASCII is valid UTF-8, so the characters can be compared in place
+      // instead of being widened into temporary UTF-16 buffers.
+      icu::StringPiece piece1(
+          reinterpret_cast<const char*>(flat1.ToOneByteVector().start()),
+          length1);
+      icu::StringPiece piece2(
+          reinterpret_cast<const char*>(flat2.ToOneByteVector().start()),
+          length2);
+      result = collator->compareUTF8(piece1, piece2, status);
+    } else {
+      std::unique_ptr<uc16[]> sap1;
+      std::unique_ptr<uc16[]> sap2;
+      icu::UnicodeString string_val1(
+          FALSE, GetUCharBufferFromFlat(flat1, &sap1, length1), length1);
+      icu::UnicodeString string_val2(
+          FALSE, GetUCharBufferFromFlat(flat2, &sap2, length2), length2);
+      result = collator->compare(string_val1, string_val2, status);
+    }
   }
   if (U_FAILURE(status)) return isolate->ThrowIllegalOperation();
 
@@ -8,6 +8,7 @@
 #include "src/arguments.h"
 #include "src/ast/ast.h"
 #include "src/ast/compile-time-value.h"
+#include "src/heap/pretenuring-decisions.h"
 #include "src/isolate-inl.h"
 #include "src/runtime/runtime.h"
 
@@ -30,7 +31,7 @@ void PreInitializeLiteralSite(Handle<FeedbackVector> vector,
 }
 
 Handle<Object> InnerCreateBoilerplate(Isolate* isolate,
-                                      Handle<FeedbackVector> vector,
+                                      PretenureFlag pretenure_flag,
                                       Handle<FixedArray> compile_time_value);
 
 enum DeepCopyHints { kNoHints = 0, kObjectIsShallow = 1 };
@@ -279,7 +280,7 @@ MaybeHandle<JSObject> DeepCopy(Handle<JSObject> object,
 
 struct ObjectBoilerplate {
   static Handle<JSObject> Create(Isolate* isolate,
-                                 Handle<FeedbackVector> vector,
+                                 PretenureFlag pretenure_flag,
                                  Handle<HeapObject> description, int flags) {
     Handle<Context> native_context = isolate->native_context();
     Handle<BoilerplateDescription> boilerplate_description =
@@ -302,9 +303,6 @@ struct ObjectBoilerplate {
             : isolate->factory()->ObjectLiteralMapFromCache(
                   native_context, number_of_properties);
 
-    PretenureFlag pretenure_flag =
-        isolate->heap()->InNewSpace(*vector) ? NOT_TENURED : TENURED;
-
     Handle<JSObject> boilerplate =
         map->is_dictionary_map()
             ? isolate->factory()->NewSlowJSObjectFromMap(
@@ -324,7 +322,8 @@ struct ObjectBoilerplate {
         // The value contains the CompileTimeValue with the boilerplate
         // properties of a simple object or array literal.
         Handle<FixedArray> compile_time_value = Handle<FixedArray>::cast(value);
-        value = InnerCreateBoilerplate(isolate, vector, compile_time_value);
+        value = InnerCreateBoilerplate(isolate, pretenure_flag,
+                                       compile_time_value);
       }
       uint32_t element_index = 0;
       if (key->ToArrayIndex(&element_index)) {
@@ -356,7 +355,7 @@ struct ObjectBoilerplate {
 
 struct ArrayBoilerplate {
   static Handle<JSObject> Create(Isolate* isolate,
-                                 Handle<FeedbackVector> vector,
+                                 PretenureFlag pretenure_flag,
                                  Handle<HeapObject> description, int flags) {
     Handle<ConstantElementsPair> elements =
         Handle<ConstantElementsPair>::cast(description);
@@ -397,16 +396,14 @@ struct ArrayBoilerplate {
                 // array literal.
                 Handle<FixedArray> compile_time_value(
                     FixedArray::cast(fixed_array_values->get(i)));
-                Handle<Object> result =
-                    InnerCreateBoilerplate(isolate, vector, compile_time_value);
+                Handle<Object> result = InnerCreateBoilerplate(
+                    isolate, pretenure_flag, compile_time_value);
                 fixed_array_values_copy->set(i, *result);
               }
             });
       }
     }
 
-    PretenureFlag pretenure_flag =
-        isolate->heap()->InNewSpace(*vector) ? NOT_TENURED : TENURED;
     return isolate->factory()->NewJSArrayWithElements(
         copied_elements_values, constant_elements_kind,
         copied_elements_values->length(), pretenure_flag);
@@ -414,15 +411,15 @@ struct ArrayBoilerplate {
 };
 
 Handle<Object> InnerCreateBoilerplate(Isolate* isolate,
-                                      Handle<FeedbackVector> vector,
+                                      PretenureFlag pretenure_flag,
                                       Handle<FixedArray> compile_time_value) {
   Handle<HeapObject> elements =
       CompileTimeValue::GetElements(compile_time_value);
   int flags = CompileTimeValue::GetLiteralTypeFlags(compile_time_value);
   if (flags == CompileTimeValue::kArrayLiteralFlag) {
-    return ArrayBoilerplate::Create(isolate, vector, elements, flags);
+    return ArrayBoilerplate::Create(isolate, pretenure_flag, elements, flags);
   }
-  return ObjectBoilerplate::Create(isolate, vector, elements, flags);
+  return ObjectBoilerplate::Create(isolate, pretenure_flag, elements, flags);
 }
 
 template <typename Boilerplate>
@@ -430,6 +427,11 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
                                     Handle<JSFunction> closure,
                                     int literals_index,
                                     Handle<HeapObject> description, int flags) {
+  if (!closure->has_feedback_vector()) {
+    // Without a feedback vector there is no literal site to cache the
+    // boilerplate in, so the fresh boilerplate is the literal itself.
+    return Boilerplate::Create(isolate, NOT_TENURED, description, flags);
+  }
   Handle<FeedbackVector> vector(closure->feedback_vector(), isolate);
   FeedbackSlot literals_slot(FeedbackVector::ToSlot(literals_index));
   CHECK(literals_slot.ToInt() < vector->slot_count());
@@ -453,7 +455,10 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
         Handle<JSObject>(JSObject::cast(site->transition_info()), isolate);
   } else {
     // Instantiate a JSArray or JSObject literal from the given {description}.
-    boilerplate = Boilerplate::Create(isolate, vector, description, flags);
+    PretenureFlag pretenure_flag =
+        isolate->heap()->InNewSpace(*vector) ? NOT_TENURED : TENURED;
+    boilerplate =
+        Boilerplate::Create(isolate, pretenure_flag, description, flags);
     // TODO(cbruni): enable pre-initialized state for boilerplates after
     // investigating regressions.
     // Install AllocationSite objects.
@@ -462,6 +467,8 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
     RETURN_ON_EXCEPTION(isolate, DeepWalk(boilerplate, &creation_context),
                         JSObject);
     creation_context.ExitScope(site, boilerplate);
+    isolate->heap()->pretenuring_decisions()->Apply(
+        handle(closure->shared(), isolate), literals_slot, site);
 
     vector->Set(literals_slot, *site);
   }
@@ -512,6 +519,10 @@ RUNTIME_FUNCTION(Runtime_CreateRegExpLiteral) {
   CONVERT_ARG_HANDLE_CHECKED(String, pattern, 2);
   CONVERT_SMI_ARG_CHECKED(flags, 3);
 
+  if (!closure->has_feedback_vector()) {
+    RETURN_RESULT_OR_FAILURE(isolate,
+                             JSRegExp::New(pattern, JSRegExp::Flags(flags)));
+  }
   Handle<FeedbackVector> vector(closure->feedback_vector(), isolate);
   FeedbackSlot literal_slot(FeedbackVector::ToSlot(index));
 
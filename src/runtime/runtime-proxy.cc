@@ -8,6 +8,7 @@
 #include "src/elements.h"
 #include "src/factory.h"
 #include "src/isolate-inl.h"
+#include "src/lookup.h"
 #include "src/objects-inl.h"
 
 namespace v8 {
@@ -165,5 +166,78 @@ RUNTIME_FUNCTION(Runtime_JSProxyRevoke) {
   return isolate->heap()->undefined_value();
 }
 
+
+// The runtime parts of the CSA proxy builtins.
+
+RUNTIME_FUNCTION(Runtime_GetPropertyWithReceiver) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, holder, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Name, name, 1);
+  CONVERT_ARG_HANDLE_CHECKED(Object, receiver, 2);
+
+  LookupIterator it =
+      LookupIterator::PropertyOrElement(isolate, receiver, name, holder);
+  RETURN_RESULT_OR_FAILURE(isolate, Object::GetProperty(&it));
+}
+
+
+RUNTIME_FUNCTION(Runtime_SetPropertyWithReceiver) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(5, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, holder, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Name, name, 1);
+  CONVERT_ARG_HANDLE_CHECKED(Object, value, 2);
+  CONVERT_ARG_HANDLE_CHECKED(Object, receiver, 3);
+  CONVERT_LANGUAGE_MODE_ARG_CHECKED(language_mode, 4);
+
+  LookupIterator it =
+      LookupIterator::PropertyOrElement(isolate, receiver, name, holder);
+  Maybe<bool> result = Object::SetSuperProperty(
+      &it, value, language_mode, Object::MAY_BE_STORE_FROM_KEYED);
+  MAYBE_RETURN(result, isolate->heap()->exception());
+  return isolate->heap()->ToBoolean(result.FromJust());
+}
+
+
+RUNTIME_FUNCTION(Runtime_CheckProxyGetSetTrapResult) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(4, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(Name, name, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, target, 1);
+  CONVERT_ARG_HANDLE_CHECKED(Object, trap_result, 2);
+  CONVERT_SMI_ARG_CHECKED(access_kind, 3);
+
+  RETURN_RESULT_OR_FAILURE(
+      isolate,
+      JSProxy::CheckGetSetTrapResult(
+          isolate, name, target, trap_result,
+          static_cast<JSProxy::AccessKind>(access_kind)));
+}
+
+
+RUNTIME_FUNCTION(Runtime_CheckProxyHasTrap) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(Name, name, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, target, 1);
+
+  Maybe<bool> result = JSProxy::CheckHasTrap(isolate, name, target);
+  MAYBE_RETURN(result, isolate->heap()->exception());
+  return isolate->heap()->ToBoolean(result.FromJust());
+}
+
+
+RUNTIME_FUNCTION(Runtime_CheckProxyDeleteTrap) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(Name, name, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, target, 1);
+
+  Maybe<bool> result = JSProxy::CheckDeleteTrap(isolate, name, target);
+  MAYBE_RETURN(result, isolate->heap()->exception());
+  return isolate->heap()->ToBoolean(result.FromJust());
+}
+
 }  // namespace internal
 }  // namespace v8
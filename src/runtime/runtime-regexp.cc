@@ -5,6 +5,7 @@
 #include "src/runtime/runtime-utils.h"
 
 #include <functional>
+#include <vector>
 
 #include "src/arguments.h"
 #include "src/conversions-inl.h"
@@ -1563,6 +1564,114 @@ RUNTIME_FUNCTION(Runtime_StringReplaceNonGlobalRegExpWithFunction) {
   RETURN_RESULT_OR_FAILURE(isolate, builder.Finish());
 }
 
+// Replaces all matches of a global {regexp} with explicit captures by the
+// results of calling {replace_obj}. Unlike the RegExpExecMultiple path, this
+// neither materializes an arguments array per match nor goes through
+// Reflect.apply: only the match offsets are collected up front, and the
+// arguments and the result are built while calling the function.
+RUNTIME_FUNCTION(Runtime_StringReplaceGlobalRegExpWithFunction) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(String, subject, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSRegExp, regexp, 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, replace_obj, 2);
+
+  DCHECK(RegExpUtils::IsUnmodifiedRegExp(isolate, regexp));
+  DCHECK(replace_obj->map()->is_callable());
+  DCHECK_NE(regexp->GetFlags() & JSRegExp::kGlobal, 0);
+
+  Factory* factory = isolate->factory();
+  subject = String::Flatten(subject);
+
+  // All matches are found before the function is first called, so that it
+  // observes the last match info of the final match and cannot affect the
+  // matching.
+  std::vector<int32_t> matches;
+  int capture_count;
+  {
+    RegExpImpl::GlobalCache global_cache(regexp, subject, isolate);
+    if (global_cache.HasException()) return isolate->heap()->exception();
+    capture_count = regexp->CaptureCount();
+    const int capture_registers = (capture_count + 1) * 2;
+    while (int32_t* current_match = global_cache.FetchNext()) {
+      matches.insert(matches.end(), current_match,
+                     current_match + capture_registers);
+    }
+    if (global_cache.HasException()) return isolate->heap()->exception();
+    if (matches.empty()) return *subject;
+    RegExpImpl::SetLastMatchInfo(isolate->regexp_last_match_info(), subject,
+                                 capture_count,
+                                 global_cache.LastSuccessfulMatch());
+  }
+
+  Handle<FixedArray> capture_map;
+  Object* maybe_capture_map = regexp->CaptureNameMap();
+  const bool has_named_captures = maybe_capture_map->IsFixedArray();
+  if (has_named_captures) {
+    capture_map = handle(FixedArray::cast(maybe_capture_map), isolate);
+  }
+  DCHECK_IMPLIES(has_named_captures, FLAG_harmony_regexp_named_captures);
+
+  // The match, the captures, the index and the subject, and the named
+  // captures if there are any.
+  const int argc =
+      has_named_captures ? capture_count + 4 : capture_count + 3;
+  ScopedVector<Handle<Object>> argv(argc);
+
+  IncrementalStringBuilder builder(isolate);
+  const size_t capture_registers = (capture_count + 1) * 2;
+  int last_match_end = 0;
+  for (size_t offset = 0; offset < matches.size();
+       offset += capture_registers) {
+    // Avoid accumulating new handles inside the loop.
+    HandleScope temp_scope(isolate);
+    const int32_t* current_match = &matches[offset];
+    const int index = current_match[0];
+    if (last_match_end < index) {
+      builder.AppendString(
+          factory->NewSubString(subject, last_match_end, index));
+    }
+    last_match_end = current_match[1];
+
+    int cursor = 0;
+    for (int i = 0; i <= capture_count; i++) {
+      const int start = current_match[i * 2];
+      if (start >= 0) {
+        const int end = current_match[i * 2 + 1];
+        DCHECK_LE(start, end);
+        argv[cursor++] = factory->NewSubString(subject, start, end);
+      } else {
+        DCHECK_LT(current_match[i * 2 + 1], 0);
+        argv[cursor++] = factory->undefined_value();
+      }
+    }
+    argv[cursor++] = handle(Smi::FromInt(index), isolate);
+    argv[cursor++] = subject;
+    if (has_named_captures) {
+      argv[cursor++] = ConstructNamedCaptureGroupsObject(
+          isolate, capture_map, [&argv](int ix) { return *argv[ix]; });
+    }
+    DCHECK_EQ(cursor, argc);
+
+    Handle<Object> replacement_obj;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, replacement_obj,
+        Execution::Call(isolate, replace_obj, factory->undefined_value(), argc,
+                        argv.start()));
+
+    Handle<String> replacement;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, replacement, Object::ToString(isolate, replacement_obj));
+    builder.AppendString(replacement);
+  }
+  if (last_match_end < subject->length()) {
+    builder.AppendString(
+        factory->NewSubString(subject, last_match_end, subject->length()));
+  }
+
+  RETURN_RESULT_OR_FAILURE(isolate, builder.Finish());
+}
+
 namespace {
 
 MUST_USE_RESULT MaybeHandle<Object> ToUint32(Isolate* isolate,
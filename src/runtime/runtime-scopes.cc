@@ -153,13 +153,18 @@ Object* DeclareGlobals(Isolate* isolate, Handle<FixedArray> declarations,
       // Copy the function and update its context. Use it as value.
       Handle<SharedFunctionInfo> shared =
           Handle<SharedFunctionInfo>::cast(initial_value);
-      FeedbackSlot literals_slot(Smi::cast(*possibly_literal_slot)->value());
-      Handle<Cell> literals(Cell::cast(feedback_vector->Get(literals_slot)),
-                            isolate);
-      Handle<JSFunction> function =
-          isolate->factory()->NewFunctionFromSharedFunctionInfo(
-              shared, context, literals, TENURED);
-      value = function;
+      if (feedback_vector.is_null()) {
+        // Declarations in code without a feedback vector have no closure
+        // cells to share.
+        value = isolate->factory()->NewFunctionFromSharedFunctionInfo(
+            shared, context, TENURED);
+      } else {
+        FeedbackSlot literals_slot(Smi::cast(*possibly_literal_slot)->value());
+        Handle<Cell> literals(Cell::cast(feedback_vector->Get(literals_slot)),
+                              isolate);
+        value = isolate->factory()->NewFunctionFromSharedFunctionInfo(
+            shared, context, literals, TENURED);
+      }
     } else {
       value = isolate->factory()->undefined_value();
     }
@@ -207,7 +212,10 @@ RUNTIME_FUNCTION(Runtime_DeclareGlobalsForInterpreter) {
   CONVERT_SMI_ARG_CHECKED(flags, 1);
   CONVERT_ARG_HANDLE_CHECKED(JSFunction, closure, 2);
 
-  Handle<FeedbackVector> feedback_vector(closure->feedback_vector(), isolate);
+  Handle<FeedbackVector> feedback_vector;
+  if (closure->has_feedback_vector()) {
+    feedback_vector = handle(closure->feedback_vector(), isolate);
+  }
   return DeclareGlobals(isolate, declarations, flags, feedback_vector);
 }
 
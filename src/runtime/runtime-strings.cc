@@ -340,6 +340,36 @@ RUNTIME_FUNCTION(Runtime_StringBuilderConcat) {
   }
 }
 
+template <typename sinkchar>
+static void JoinStringsToFlat(FixedArray* fixed_array, int array_length,
+                              String* separator, sinkchar* sink, int length) {
+  DisallowHeapAllocation no_gc;
+#ifdef DEBUG
+  sinkchar* end = sink + length;
+#endif
+  int separator_length = separator->length();
+
+  CHECK(fixed_array->get(0)->IsString());
+  String* first = String::cast(fixed_array->get(0));
+  int first_length = first->length();
+  String::WriteToFlat(first, sink, 0, first_length);
+  sink += first_length;
+
+  for (int i = 1; i < array_length; i++) {
+    DCHECK(sink + separator_length <= end);
+    String::WriteToFlat(separator, sink, 0, separator_length);
+    sink += separator_length;
+
+    CHECK(fixed_array->get(i)->IsString());
+    String* element = String::cast(fixed_array->get(i));
+    int element_length = element->length();
+    DCHECK(sink + element_length <= end);
+    String::WriteToFlat(element, sink, 0, element_length);
+    sink += element_length;
+  }
+  DCHECK(sink == end);
+}
+
 RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
   HandleScope scope(isolate);
   DCHECK_EQ(3, args.length());
@@ -372,7 +402,10 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
   if (max_nof_separators < (array_length - 1)) {
     THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
   }
+  // The first pass computes the length and whether the result can be
+  // one-byte, the second pass copies the characters.
   int length = (array_length - 1) * separator_length;
+  bool one_byte = separator->IsOneByteRepresentation();
   for (int i = 0; i < array_length; i++) {
     Object* element_obj = fixed_array->get(i);
     CHECK(element_obj->IsString());
@@ -384,43 +417,23 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
       break;
     }
     length += increment;
+    one_byte = one_byte && element->IsOneByteRepresentation();
+  }
+
+  if (one_byte) {
+    Handle<SeqOneByteString> answer;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, answer, isolate->factory()->NewRawOneByteString(length));
+    JoinStringsToFlat(*fixed_array, array_length, *separator,
+                      answer->GetChars(), length);
+    return *answer;
   }
 
   Handle<SeqTwoByteString> answer;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, answer, isolate->factory()->NewRawTwoByteString(length));
-
-  DisallowHeapAllocation no_gc;
-
-  uc16* sink = answer->GetChars();
-#ifdef DEBUG
-  uc16* end = sink + length;
-#endif
-
-  CHECK(fixed_array->get(0)->IsString());
-  String* first = String::cast(fixed_array->get(0));
-  String* separator_raw = *separator;
-
-  int first_length = first->length();
-  String::WriteToFlat(first, sink, 0, first_length);
-  sink += first_length;
-
-  for (int i = 1; i < array_length; i++) {
-    DCHECK(sink + separator_length <= end);
-    String::WriteToFlat(separator_raw, sink, 0, separator_length);
-    sink += separator_length;
-
-    CHECK(fixed_array->get(i)->IsString());
-    String* element = String::cast(fixed_array->get(i));
-    int element_length = element->length();
-    DCHECK(sink + element_length <= end);
-    String::WriteToFlat(element, sink, 0, element_length);
-    sink += element_length;
-  }
-  DCHECK(sink == end);
-
-  // Use %_FastOneByteArrayJoin instead.
-  DCHECK(!answer->IsOneByteRepresentation());
+  JoinStringsToFlat(*fixed_array, array_length, *separator, answer->GetChars(),
+                    length);
   return *answer;
 }
 
@@ -787,6 +787,32 @@ RUNTIME_FUNCTION(Runtime_InNewSpace) {
   return isolate->heap()->ToBoolean(isolate->heap()->InNewSpace(obj));
 }
 
+namespace {
+Object* RegExpCodeFor(JSRegExp* regexp, bool is_one_byte) {
+  if (regexp->TypeTag() != JSRegExp::IRREGEXP) return Smi::kZero;
+  return FixedArray::cast(regexp->data())
+      ->get(JSRegExp::code_index(is_one_byte));
+}
+}  // namespace
+
+RUNTIME_FUNCTION(Runtime_RegExpHasBytecode) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_CHECKED(JSRegExp, regexp, 0);
+  CONVERT_BOOLEAN_ARG_CHECKED(is_one_byte, 1);
+  return isolate->heap()->ToBoolean(
+      RegExpCodeFor(regexp, is_one_byte)->IsByteArray());
+}
+
+RUNTIME_FUNCTION(Runtime_RegExpHasNativeCode) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_CHECKED(JSRegExp, regexp, 0);
+  CONVERT_BOOLEAN_ARG_CHECKED(is_one_byte, 1);
+  return isolate->heap()->ToBoolean(
+      RegExpCodeFor(regexp, is_one_byte)->IsCode());
+}
+
 RUNTIME_FUNCTION(Runtime_IsAsmWasmCode) {
   SealHandleScope shs(isolate);
   DCHECK_EQ(1, args.length());
@@ -87,9 +87,9 @@ Object* ThrowRuntimeError(Isolate* isolate, int message_id, int byte_offset,
   Handle<Object> stack_trace_obj = JSReceiver::GetDataProperty(
       error, isolate->factory()->stack_trace_symbol());
   // Patch the stack trace (array of <receiver, function, code, position>).
-  if (stack_trace_obj->IsJSArray()) {
-    Handle<FrameArray> stack_elements(
-        FrameArray::cast(JSArray::cast(*stack_trace_obj)->elements()));
+  if (stack_trace_obj->IsFrameArray()) {
+    Handle<FrameArray> stack_elements =
+        Handle<FrameArray>::cast(stack_trace_obj);
     DCHECK(stack_elements->Code(0)->kind() == AbstractCode::WASM_FUNCTION);
     DCHECK(stack_elements->Offset(0)->value() >= 0);
     stack_elements->SetOffset(0, Smi::FromInt(-1 - byte_offset));
@@ -40,6 +40,7 @@ namespace internal {
   F(SpecialArrayFunctions, 0, 1)    \
   F(TransitionElementsKind, 2, 1)   \
   F(RemoveArrayHoles, 2, 1)         \
+  F(SortSmiElementsFast, 2, 1)      \
   F(MoveArrayContents, 2, 1)        \
   F(EstimateNumberOfElements, 1, 1) \
   F(GetArrayKeys, 2, 1)             \
@@ -71,23 +72,24 @@ namespace internal {
   F(AtomicsNumWaitersForTesting, 2, 1)          \
   F(SetAllowAtomicsWait, 1, 1)
 
-#define FOR_EACH_INTRINSIC_CLASSES(F)        \
-  F(ThrowUnsupportedSuperError, 0, 1)        \
-  F(ThrowConstructorNonCallableError, 1, 1)  \
-  F(ThrowStaticPrototypeError, 0, 1)         \
-  F(ThrowSuperAlreadyCalledError, 0, 1)      \
-  F(ThrowSuperNotCalled, 0, 1)               \
-  F(ThrowNotSuperConstructor, 2, 1)          \
-  F(HomeObjectSymbol, 0, 1)                  \
-  F(DefineClass, 4, 1)                       \
-  F(InstallClassNameAccessor, 1, 1)          \
-  F(InstallClassNameAccessorWithCheck, 1, 1) \
-  F(LoadFromSuper, 3, 1)                     \
-  F(LoadKeyedFromSuper, 3, 1)                \
-  F(StoreToSuper_Strict, 4, 1)               \
-  F(StoreToSuper_Sloppy, 4, 1)               \
-  F(StoreKeyedToSuper_Strict, 4, 1)          \
-  F(StoreKeyedToSuper_Sloppy, 4, 1)          \
+#define FOR_EACH_INTRINSIC_CLASSES(F)             \
+  F(ThrowUnsupportedSuperError, 0, 1)             \
+  F(ThrowConstructorNonCallableError, 1, 1)       \
+  F(ThrowStaticPrototypeError, 0, 1)              \
+  F(ThrowSuperAlreadyCalledError, 0, 1)           \
+  F(ThrowSuperNotCalled, 0, 1)                    \
+  F(ThrowNotSuperConstructor, 2, 1)               \
+  F(HomeObjectSymbol, 0, 1)                       \
+  F(DefineClass, 4, 1)                            \
+  F(DefineClassWithBoilerplate, -1 /* >= 5 */, 1) \
+  F(InstallClassNameAccessor, 1, 1)               \
+  F(InstallClassNameAccessorWithCheck, 1, 1)      \
+  F(LoadFromSuper, 3, 1)                          \
+  F(LoadKeyedFromSuper, 3, 1)                     \
+  F(StoreToSuper_Strict, 4, 1)                    \
+  F(StoreToSuper_Sloppy, 4, 1)                    \
+  F(StoreKeyedToSuper_Strict, 4, 1)               \
+  F(StoreKeyedToSuper_Sloppy, 4, 1)               \
   F(GetSuperConstructor, 1, 1)
 
 #define FOR_EACH_INTRINSIC_COLLECTIONS(F) \
@@ -127,6 +129,7 @@ namespace internal {
 
 #define FOR_EACH_INTRINSIC_COMPILER(F)    \
   F(CompileLazy, 1, 1)                    \
+  F(DeserializeLazy, 1, 1)                \
   F(CompileOptimized_Concurrent, 1, 1)    \
   F(CompileOptimized_NotConcurrent, 1, 1) \
   F(EvictOptimizedCodeSlot, 1, 1)         \
@@ -208,6 +211,7 @@ namespace internal {
   F(DebugCollectCoverage, 0, 1)                 \
   F(DebugTogglePreciseCoverage, 1, 1)           \
   F(DebugToggleBlockCoverage, 1, 1)             \
+  F(DebugToggleBestEffortBlockCoverage, 1, 1)   \
   F(IncBlockCounter, 2, 1)
 
 #define FOR_EACH_INTRINSIC_ERROR(F) F(ErrorToString, 1, 1)
@@ -484,12 +488,17 @@ namespace internal {
   F(ReportPromiseReject, 2, 1)
 
 #define FOR_EACH_INTRINSIC_PROXY(F)     \
+  F(CheckProxyDeleteTrap, 2, 1)         \
+  F(CheckProxyGetSetTrapResult, 4, 1)   \
+  F(CheckProxyHasTrap, 2, 1)            \
+  F(GetPropertyWithReceiver, 3, 1)      \
   F(IsJSProxy, 1, 1)                    \
   F(JSProxyCall, -1 /* >= 2 */, 1)      \
   F(JSProxyConstruct, -1 /* >= 3 */, 1) \
   F(JSProxyGetTarget, 1, 1)             \
   F(JSProxyGetHandler, 1, 1)            \
-  F(JSProxyRevoke, 1, 1)
+  F(JSProxyRevoke, 1, 1)                \
+  F(SetPropertyWithReceiver, 5, 1)
 
 #define FOR_EACH_INTRINSIC_REGEXP(F)                \
   F(IsRegExp, 1, 1)                                 \
@@ -501,6 +510,7 @@ namespace internal {
   F(RegExpInternalReplace, 3, 1)                    \
   F(RegExpReplace, 3, 1)                            \
   F(RegExpSplit, 3, 1)                              \
+  F(StringReplaceGlobalRegExpWithFunction, 3, 1)    \
   F(StringReplaceGlobalRegExpWithString, 4, 1)      \
   F(StringReplaceNonGlobalRegExpWithFunction, 3, 1) \
   F(StringSplit, 3, 1)
@@ -602,6 +612,8 @@ namespace internal {
   F(TraceTailCall, 0, 1)                      \
   F(HaveSameMap, 2, 1)                        \
   F(InNewSpace, 1, 1)                         \
+  F(RegExpHasBytecode, 2, 1)                  \
+  F(RegExpHasNativeCode, 2, 1)                \
   F(HasFastSmiElements, 1, 1)                 \
   F(HasFastObjectElements, 1, 1)              \
   F(HasFastSmiOrObjectElements, 1, 1)         \
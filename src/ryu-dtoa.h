@@ -0,0 +1,41 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_RYU_DTOA_H_
+#define V8_RYU_DTOA_H_
+
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Provides the shortest decimal representation of v, using the Ryu algorithm
+// (Ulf Adams, "Ryu: fast float-to-string conversion", PLDI 2018). Unlike
+// FastDtoa in FAST_DTOA_SHORTEST mode, it always succeeds and never needs to
+// fall back to bignum arithmetic.
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// The result satisfies
+//     v == (double) (buffer * 10^(point - length)).
+// The digits in the buffer are the shortest representation possible. If
+// several representations of that length would yield v when read again, the
+// buffer will contain the one closest to v, and ties are broken towards an
+// even last digit. This is the same result BignumDtoa computes in
+// BIGNUM_DTOA_SHORTEST mode.
+// There will be *length digits inside the buffer followed by a null
+// terminator. The buffer must be able to hold kRyuDtoaMaximalLength + 1
+// characters.
+void RyuDtoa(double v, Vector<char> buffer, int* length, int* decimal_point);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_RYU_DTOA_H_
@@ -0,0 +1,130 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/builtin-serializer.h"
+
+#include <bitset>
+
+#include "src/assembler-inl.h"
+#include "src/objects-inl.h"
+#include "src/snapshot/snapshot.h"
+#include "src/snapshot/startup-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+BuiltinSerializer::BuiltinSerializer(Isolate* isolate,
+                                     StartupSerializer* startup_serializer)
+    : Serializer(isolate),
+      startup_serializer_(startup_serializer),
+      code_(nullptr) {}
+
+BuiltinSerializer::~BuiltinSerializer() {
+  OutputStatistics("BuiltinSerializer");
+}
+
+void BuiltinSerializer::Serialize(Code* code) {
+  DCHECK_EQ(Code::BUILTIN, code->kind());
+  code_ = code;
+  Object* object = code;
+  VisitRootPointer(Root::kPartialSnapshotCache, &object);
+  SerializeDeferredObjects();
+  Pad();
+}
+
+void BuiltinSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
+                                        WhereToPoint where_to_point,
+                                        int skip) {
+  if (SerializeHotObject(obj, how_to_code, where_to_point, skip)) return;
+
+  int root_index = root_index_map_.Lookup(obj);
+  if (root_index != RootIndexMap::kInvalidRootIndex) {
+    PutRoot(root_index, obj, how_to_code, where_to_point, skip);
+    return;
+  }
+
+  if (SerializeBackReference(obj, how_to_code, where_to_point, skip)) return;
+
+  FlushSkip(skip);
+
+  if (!IsOwnedByCode(obj)) {
+    // Other builtins, code stubs, strings etc. are shared with the startup
+    // snapshot. References to lazily deserialized builtins resolve to their
+    // placeholder there.
+    int cache_index = startup_serializer_->PartialSnapshotCacheIndex(obj);
+    sink_.Put(kPartialSnapshotCache + how_to_code + where_to_point,
+              "PartialSnapshotCache");
+    sink_.PutInt(cache_index, "partial_snapshot_cache_index");
+    return;
+  }
+
+  // Object has not yet been serialized.  Serialize it here.
+  ObjectSerializer object_serializer(this, obj, &sink_, how_to_code,
+                                     where_to_point);
+  object_serializer.Serialize();
+}
+
+bool BuiltinSerializer::IsOwnedByCode(HeapObject* obj) {
+  if (obj == code_) return true;
+  // Metadata that has already been reached from the startup snapshot is not
+  // private to the code object and must not be duplicated.
+  if (startup_serializer_->reference_map()->Lookup(obj).is_valid()) {
+    return false;
+  }
+  return obj == code_->relocation_info() || obj == code_->handler_table() ||
+         obj == code_->deoptimization_data() ||
+         obj == code_->source_position_table();
+}
+
+// static
+Handle<FixedArray> BuiltinSerializer::CreateLazyBuiltinPlaceholders(
+    Isolate* isolate) {
+  if (!FLAG_lazy_deserialization) return Handle<FixedArray>();
+
+  // Placeholders left over from the snapshot this isolate was created from
+  // cannot be serialized without the code they stand in for.
+  Snapshot::EnsureAllBuiltinsAreDeserialized(isolate);
+
+  // The placeholders only preserve the registers of the JS calling convention,
+  // so builtins that code refers to directly, e.g. to call them as a stub,
+  // are deserialized along with the startup snapshot.
+  std::bitset<Builtins::builtin_count> referenced_from_code;
+  {
+    const int mode_mask = RelocInfo::ModeMask(RelocInfo::CODE_TARGET) |
+                          RelocInfo::ModeMask(RelocInfo::EMBEDDED_OBJECT);
+    HeapIterator iterator(isolate->heap());
+    while (HeapObject* obj = iterator.next()) {
+      if (!obj->IsCode()) continue;
+      for (RelocIterator it(Code::cast(obj), mode_mask); !it.done();
+           it.next()) {
+        RelocInfo* rinfo = it.rinfo();
+        Object* target =
+            RelocInfo::IsCodeTarget(rinfo->rmode())
+                ? Code::GetCodeFromTargetAddress(rinfo->target_address())
+                : rinfo->target_object();
+        if (!target->IsCode()) continue;
+        Code* target_code = Code::cast(target);
+        if (target_code->kind() != Code::BUILTIN) continue;
+        referenced_from_code.set(target_code->builtin_index());
+      }
+    }
+  }
+
+  Factory* factory = isolate->factory();
+  Handle<FixedArray> placeholders =
+      factory->NewFixedArray(Builtins::builtin_count, TENURED);
+  Handle<Code> deserialize_lazy = isolate->builtins()->DeserializeLazy();
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    placeholders->set(i, Smi::kZero);
+    if (!Builtins::IsLazyDeserializationCandidate(i)) continue;
+    if (referenced_from_code.test(i)) continue;
+    Handle<Code> placeholder = factory->CopyCode(deserialize_lazy);
+    placeholder->set_builtin_index(i);
+    placeholders->set(i, *placeholder);
+  }
+  return placeholders;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,48 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_BUILTIN_SERIALIZER_H_
+#define V8_SNAPSHOT_BUILTIN_SERIALIZER_H_
+
+#include "src/snapshot/serializer.h"
+
+namespace v8 {
+namespace internal {
+
+class StartupSerializer;
+
+// Serializes a single builtin that is deserialized lazily on its first call,
+// see Snapshot::EnsureBuiltinIsDeserialized. The code object and the metadata
+// it owns are serialized inline, everything else it refers to is shared with
+// the startup snapshot through the partial snapshot cache.
+class BuiltinSerializer : public Serializer {
+ public:
+  BuiltinSerializer(Isolate* isolate, StartupSerializer* startup_serializer);
+  ~BuiltinSerializer() override;
+
+  void Serialize(Code* code);
+
+  // Allocates a placeholder for each builtin that is to be deserialized
+  // lazily, and returns them in a FixedArray indexed by builtin. Entries of
+  // builtins that are deserialized along with the startup snapshot are Smis.
+  // The placeholders are copies of the DeserializeLazy builtin that carry the
+  // index of the builtin they stand in for. Returns an empty handle unless
+  // --lazy-deserialization is enabled.
+  static Handle<FixedArray> CreateLazyBuiltinPlaceholders(Isolate* isolate);
+
+ private:
+  void SerializeObject(HeapObject* o, HowToCode how_to_code,
+                       WhereToPoint where_to_point, int skip) override;
+
+  bool IsOwnedByCode(HeapObject* o);
+
+  StartupSerializer* startup_serializer_;
+  Code* code_;
+  DISALLOW_COPY_AND_ASSIGN(BuiltinSerializer);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_BUILTIN_SERIALIZER_H_
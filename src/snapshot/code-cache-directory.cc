@@ -0,0 +1,143 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/code-cache-directory.h"
+
+#include <cstdio>
+#include <memory>
+
+#include "src/base/platform/platform.h"
+#include "src/counters.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// 64-bit FNV-1a.
+const uint64_t kFnvOffsetBasis = V8_UINT64_C(0xcbf29ce484222325);
+const uint64_t kFnvPrime = V8_UINT64_C(0x100000001b3);
+
+template <typename Char>
+uint64_t HashCharacters(Vector<const Char> chars, uint64_t hash) {
+  for (int i = 0; i < chars.length(); i++) {
+    uint16_t c = chars[i];
+    hash = (hash ^ (c & 0xff)) * kFnvPrime;
+    hash = (hash ^ (c >> 8)) * kFnvPrime;
+  }
+  return hash;
+}
+
+bool IsCorruption(SerializedCodeData::SanityCheckResult result) {
+  switch (result) {
+    case SerializedCodeData::MAGIC_NUMBER_MISMATCH:
+    case SerializedCodeData::CHECKSUM_MISMATCH:
+    case SerializedCodeData::INVALID_HEADER:
+    case SerializedCodeData::LENGTH_MISMATCH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+// static
+uint64_t CodeCacheDirectory::SourceHash(Handle<String> source) {
+  source = String::Flatten(source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent();
+  DCHECK(content.IsFlat());
+  uint64_t hash = kFnvOffsetBasis;
+  if (content.IsOneByte()) {
+    hash = HashCharacters(content.ToOneByteVector(), hash);
+  } else {
+    hash = HashCharacters(content.ToUC16Vector(), hash);
+  }
+  return hash;
+}
+
+// static
+std::string CodeCacheDirectory::EntryPath(Handle<String> source) {
+  DCHECK(IsEnabled());
+  EmbeddedVector<char, 64> name;
+  SNPrintF(name, "%016" PRIx64 "-%08x.v8cache", SourceHash(source),
+           FlagList::Hash());
+  std::string path(FLAG_code_cache_dir);
+  if (!path.empty() && path.back() != '/') path += '/';
+  path += name.start();
+  return path;
+}
+
+// static
+MaybeHandle<SharedFunctionInfo> CodeCacheDirectory::Lookup(
+    Isolate* isolate, Handle<String> source) {
+  Counters* counters = isolate->counters();
+  std::string path = EntryPath(source);
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!file || file->size() == 0) {
+    counters->code_cache_dir_misses()->Increment();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  if (file->size() > static_cast<size_t>(kMaxInt)) {
+    counters->code_cache_dir_corruptions()->Increment();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  // The mapping is page aligned, so the ScriptData refers to it directly. The
+  // deserializer copies everything it needs onto the heap.
+  ScriptData data(static_cast<const byte*>(file->memory()),
+                  static_cast<int>(file->size()));
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      SerializedCodeData::CHECK_SUCCESS;
+  MaybeHandle<SharedFunctionInfo> result =
+      CodeSerializer::Deserialize(isolate, &data, source, &sanity_check_result);
+  if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
+    if (IsCorruption(sanity_check_result)) {
+      counters->code_cache_dir_corruptions()->Increment();
+    } else {
+      counters->code_cache_dir_rejects()->Increment();
+    }
+  } else if (result.is_null()) {
+    counters->code_cache_dir_misses()->Increment();
+  } else {
+    counters->code_cache_dir_hits()->Increment();
+  }
+  return result;
+}
+
+// static
+void CodeCacheDirectory::Store(Isolate* isolate,
+                               Handle<SharedFunctionInfo> info,
+                               Handle<String> source) {
+  std::unique_ptr<ScriptData> data(
+      CodeSerializer::Serialize(isolate, info, source));
+  std::string path = EntryPath(source);
+
+  // Write a file private to this thread and move it into place, so that other
+  // processes only ever see complete entries. Racing writers produce the same
+  // contents, so it does not matter which rename wins.
+  EmbeddedVector<char, 32> suffix;
+  SNPrintF(suffix, ".%d.%d.tmp", base::OS::GetCurrentProcessId(),
+           base::OS::GetCurrentThreadId());
+  std::string temp_path = path + suffix.start();
+  FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+  if (file == nullptr) return;
+  size_t length = static_cast<size_t>(data->length());
+  bool success = fwrite(data->data(), 1, length, file) == length;
+  success = (fclose(file) == 0) && success;
+  if (success && std::rename(temp_path.c_str(), path.c_str()) == 0) {
+    isolate->counters()->code_cache_dir_writes()->Increment();
+  } else {
+    base::OS::Remove(temp_path.c_str());
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
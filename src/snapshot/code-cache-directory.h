@@ -0,0 +1,54 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
+#define V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
+
+#include <string>
+
+#include "src/allocation.h"
+#include "src/flags.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class SharedFunctionInfo;
+class String;
+
+// A code cache for toplevel scripts that lives in the directory given by
+// --code-cache-dir. Entries are produced by the CodeSerializer and are named
+// after a hash of the source contents and the flag hash, so that processes
+// running the same configuration can share one directory. Entries are written
+// to a private file and renamed into place, and are mapped read-only when
+// consumed, so readers never observe partially written data. Stale entries
+// are rejected by the serializer's sanity check and replaced on the next
+// compile.
+class CodeCacheDirectory : public AllStatic {
+ public:
+  static bool IsEnabled() { return FLAG_code_cache_dir != nullptr; }
+
+  // Returns the deserialized toplevel function for {source}, or an empty
+  // handle if there is no usable entry.
+  static MaybeHandle<SharedFunctionInfo> Lookup(Isolate* isolate,
+                                                Handle<String> source);
+
+  // Serializes {info}, the toplevel function compiled for {source}, into the
+  // cache directory. Failures are silently ignored.
+  static void Store(Isolate* isolate, Handle<SharedFunctionInfo> info,
+                    Handle<String> source);
+
+  // Returns the path of the entry for {source}. Exposed for testing.
+  static std::string EntryPath(Handle<String> source);
+
+  // Returns a hash of the characters of {source}, which does not depend on the
+  // representation of the string or on the hash seed.
+  static uint64_t SourceHash(Handle<String> source);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
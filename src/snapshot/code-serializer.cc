@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "src/base/functional.h"
 #include "src/code-stubs.h"
 #include "src/counters.h"
 #include "src/log.h"
@@ -13,6 +14,7 @@
 #include "src/objects-inl.h"
 #include "src/snapshot/deserializer.h"
 #include "src/snapshot/snapshot.h"
+#include "src/trap-handler/trap-handler.h"
 #include "src/version.h"
 #include "src/visitors.h"
 #include "src/wasm/wasm-module.h"
@@ -176,7 +178,8 @@ void CodeSerializer::SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
 }
 
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
-    Isolate* isolate, ScriptData* cached_data, Handle<String> source) {
+    Isolate* isolate, ScriptData* cached_data, Handle<String> source,
+    SerializedCodeData::SanityCheckResult* rejection_result) {
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
@@ -187,6 +190,7 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   const SerializedCodeData scd = SerializedCodeData::FromCachedData(
       isolate, cached_data, SerializedCodeData::SourceHash(source),
       &sanity_check_result);
+  if (rejection_result != nullptr) *rejection_result = sanity_check_result;
   if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
     if (FLAG_profile_deserialization) PrintF("[Cached code failed check]\n");
     DCHECK(cached_data->rejected());
@@ -244,8 +248,12 @@ std::unique_ptr<ScriptData> WasmCompiledModuleSerializer::SerializeWasmModule(
     Isolate* isolate, Handle<FixedArray> input) {
   Handle<WasmCompiledModule> compiled_module =
       Handle<WasmCompiledModule>::cast(input);
-  WasmCompiledModuleSerializer wasm_cs(isolate, 0, isolate->native_context(),
-                                       handle(compiled_module->module_bytes()));
+  Handle<SeqOneByteString> module_bytes(compiled_module->module_bytes(),
+                                        isolate);
+  uint32_t source_hash = SerializedCodeData::WasmSourceHash(
+      Vector<const byte>(module_bytes->GetChars(), module_bytes->length()));
+  WasmCompiledModuleSerializer wasm_cs(isolate, source_hash,
+                                       isolate->native_context(), module_bytes);
   ScriptData* data = wasm_cs.Serialize(compiled_module);
   return std::unique_ptr<ScriptData>(data);
 }
@@ -260,9 +268,13 @@ MaybeHandle<FixedArray> WasmCompiledModuleSerializer::DeserializeWasmModule(
       SerializedCodeData::CHECK_SUCCESS;
 
   const SerializedCodeData scd = SerializedCodeData::FromCachedData(
-      isolate, data, 0, &sanity_check_result);
+      isolate, data, SerializedCodeData::WasmSourceHash(wire_bytes),
+      &sanity_check_result);
 
   if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
+    if (FLAG_profile_deserialization) {
+      PrintF("[Serialized wasm module failed check]\n");
+    }
     return nothing;
   }
 
@@ -447,6 +459,12 @@ uint32_t SerializedCodeData::SourceHash(Handle<String> source) {
   return source->length();
 }
 
+uint32_t SerializedCodeData::WasmSourceHash(Vector<const byte> wire_bytes) {
+  return static_cast<uint32_t>(
+      base::hash_combine(base::hash_range(wire_bytes.begin(), wire_bytes.end()),
+                         trap_handler::UseTrapHandler()));
+}
+
 // Return ScriptData object and relinquish ownership over it to the caller.
 ScriptData* SerializedCodeData::GetScriptData() {
   DCHECK(owns_data_);
@@ -11,68 +11,7 @@
 namespace v8 {
 namespace internal {
 
-class CodeSerializer : public Serializer {
- public:
-  static ScriptData* Serialize(Isolate* isolate,
-                               Handle<SharedFunctionInfo> info,
-                               Handle<String> source);
-
-  ScriptData* Serialize(Handle<HeapObject> obj);
-
-  MUST_USE_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
-      Isolate* isolate, ScriptData* cached_data, Handle<String> source);
-
-  const List<uint32_t>* stub_keys() const { return &stub_keys_; }
-
-  uint32_t source_hash() const { return source_hash_; }
-
- protected:
-  explicit CodeSerializer(Isolate* isolate, uint32_t source_hash)
-      : Serializer(isolate), source_hash_(source_hash) {}
-  ~CodeSerializer() override { OutputStatistics("CodeSerializer"); }
-
-  virtual void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
-                                   WhereToPoint where_to_point) {
-    UNREACHABLE();
-  }
-
-  virtual bool ElideObject(Object* obj) { return false; }
-  void SerializeGeneric(HeapObject* heap_object, HowToCode how_to_code,
-                        WhereToPoint where_to_point);
-  void SerializeBuiltin(int builtin_index, HowToCode how_to_code,
-                        WhereToPoint where_to_point);
-
- private:
-  void SerializeObject(HeapObject* o, HowToCode how_to_code,
-                       WhereToPoint where_to_point, int skip) override;
-
-  void SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
-                         WhereToPoint where_to_point);
-
-  DisallowHeapAllocation no_gc_;
-  uint32_t source_hash_;
-  List<uint32_t> stub_keys_;
-  DISALLOW_COPY_AND_ASSIGN(CodeSerializer);
-};
-
-class WasmCompiledModuleSerializer : public CodeSerializer {
- public:
-  static std::unique_ptr<ScriptData> SerializeWasmModule(
-      Isolate* isolate, Handle<FixedArray> compiled_module);
-  static MaybeHandle<FixedArray> DeserializeWasmModule(
-      Isolate* isolate, ScriptData* data, Vector<const byte> wire_bytes);
-
- protected:
-  void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
-                           WhereToPoint where_to_point) override;
-  bool ElideObject(Object* obj) override;
-
- private:
-  WasmCompiledModuleSerializer(Isolate* isolate, uint32_t source_hash,
-                               Handle<Context> native_context,
-                               Handle<SeqOneByteString> module_bytes);
-  DISALLOW_COPY_AND_ASSIGN(WasmCompiledModuleSerializer);
-};
+class CodeSerializer;
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
 class SerializedCodeData : public SerializedData {
@@ -133,6 +72,11 @@ class SerializedCodeData : public SerializedData {
   Vector<const uint32_t> CodeStubKeys() const;
 
   static uint32_t SourceHash(Handle<String> source);
+  // Serialized wasm modules are bound to all of their wire bytes, not only to
+  // their length, so that code is never deserialized for a different module.
+  // Code without explicit bounds checks is only accepted while the trap
+  // handler is in use.
+  static uint32_t WasmSourceHash(Vector<const byte> wire_bytes);
 
  private:
   explicit SerializedCodeData(ScriptData* data);
@@ -147,6 +91,72 @@ class SerializedCodeData : public SerializedData {
                                 uint32_t expected_source_hash) const;
 };
 
+class CodeSerializer : public Serializer {
+ public:
+  static ScriptData* Serialize(Isolate* isolate,
+                               Handle<SharedFunctionInfo> info,
+                               Handle<String> source);
+
+  ScriptData* Serialize(Handle<HeapObject> obj);
+
+  // If {rejection_result} is non-null, it is set to the result of the sanity
+  // check of {cached_data}.
+  MUST_USE_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
+      Isolate* isolate, ScriptData* cached_data, Handle<String> source,
+      SerializedCodeData::SanityCheckResult* rejection_result = nullptr);
+
+  const List<uint32_t>* stub_keys() const { return &stub_keys_; }
+
+  uint32_t source_hash() const { return source_hash_; }
+
+ protected:
+  explicit CodeSerializer(Isolate* isolate, uint32_t source_hash)
+      : Serializer(isolate), source_hash_(source_hash) {}
+  ~CodeSerializer() override { OutputStatistics("CodeSerializer"); }
+
+  virtual void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
+                                   WhereToPoint where_to_point) {
+    UNREACHABLE();
+  }
+
+  virtual bool ElideObject(Object* obj) { return false; }
+  void SerializeGeneric(HeapObject* heap_object, HowToCode how_to_code,
+                        WhereToPoint where_to_point);
+  void SerializeBuiltin(int builtin_index, HowToCode how_to_code,
+                        WhereToPoint where_to_point);
+
+ private:
+  void SerializeObject(HeapObject* o, HowToCode how_to_code,
+                       WhereToPoint where_to_point, int skip) override;
+
+  void SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
+                         WhereToPoint where_to_point);
+
+  DisallowHeapAllocation no_gc_;
+  uint32_t source_hash_;
+  List<uint32_t> stub_keys_;
+  DISALLOW_COPY_AND_ASSIGN(CodeSerializer);
+};
+
+class WasmCompiledModuleSerializer : public CodeSerializer {
+ public:
+  static std::unique_ptr<ScriptData> SerializeWasmModule(
+      Isolate* isolate, Handle<FixedArray> compiled_module);
+  static MaybeHandle<FixedArray> DeserializeWasmModule(
+      Isolate* isolate, ScriptData* data, Vector<const byte> wire_bytes);
+
+ protected:
+  void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
+                           WhereToPoint where_to_point) override;
+  bool ElideObject(Object* obj) override;
+
+ private:
+  WasmCompiledModuleSerializer(Isolate* isolate, uint32_t source_hash,
+                               Handle<Context> native_context,
+                               Handle<SeqOneByteString> module_bytes);
+  DISALLOW_COPY_AND_ASSIGN(WasmCompiledModuleSerializer);
+};
+
 }  // namespace internal
 }  // namespace v8
 
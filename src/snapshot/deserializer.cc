@@ -289,10 +289,8 @@ class StringTableInsertionKey : public StringTableKey {
   }
 
   bool IsMatch(Object* string) override {
-    // We know that all entries in a hash table had their hash keys created.
-    // Use that knowledge to have fast failure.
-    if (Hash() != String::cast(string)->Hash()) return false;
-    // We want to compare the content of two internalized strings here.
+    // The string table has already compared the hashes. We want to compare
+    // the content of two internalized strings here.
     return string_->SlowEquals(String::cast(string));
   }
 
@@ -375,7 +373,7 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
 }
 
 void Deserializer::CommitPostProcessedObjects(Isolate* isolate) {
-  StringTable::EnsureCapacityForDeserialization(
+  StringTable::EnsureCapacityForBulkInsert(
       isolate, new_internalized_strings_.length());
   for (Handle<String> string : new_internalized_strings_) {
     StringTableInsertionKey key(*string);
@@ -707,6 +705,15 @@ bool Deserializer::ReadData(Object** current, Object** limit, int source_space,
       // Find an code entry in the partial snapshots cache and
       // write a pointer to it to the current object.
       SINGLE_CASE(kPartialSnapshotCache, kPlain, kInnerPointer, 0)
+      // Find a code entry in the partial snapshots cache and write a pointer
+      // to its first instruction to the current code object. Required for
+      // lazily deserialized builtins.
+      SINGLE_CASE(kPartialSnapshotCache, kFromCode, kInnerPointer, 0)
+#if V8_CODE_EMBEDS_OBJECT_POINTER
+      // Find an object in the partial snapshots cache and write a pointer to
+      // it in code.
+      SINGLE_CASE(kPartialSnapshotCache, kFromCode, kStartOfObject, 0)
+#endif
       // Find an external reference and write a pointer to it to the current
       // object.
       SINGLE_CASE(kExternalReference, kPlain, kStartOfObject, 0)
@@ -90,8 +90,9 @@ void PartialSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
 
   FlushSkip(skip);
 
-  // Clear literal boilerplates.
-  if (obj->IsJSFunction()) {
+  // Clear literal boilerplates and type feedback, unless the embedder asked
+  // for functions to keep them.
+  if (obj->IsJSFunction() && startup_serializer_->clear_feedback()) {
     JSFunction* function = JSFunction::cast(obj);
     function->ClearTypeFeedbackInfo();
   }
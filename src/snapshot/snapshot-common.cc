@@ -9,8 +9,10 @@
 #include "src/api.h"
 #include "src/base/platform/platform.h"
 #include "src/full-codegen/full-codegen.h"
+#include "src/log.h"
 #include "src/objects-inl.h"
 #include "src/snapshot/deserializer.h"
+#include "src/snapshot/snapshot-compression.h"
 #include "src/snapshot/snapshot-source-sink.h"
 #include "src/version.h"
 
@@ -38,10 +40,22 @@ bool Snapshot::Initialize(Isolate* isolate) {
   if (FLAG_profile_deserialization) timer.Start();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
-  Vector<const byte> startup_data = ExtractStartupData(blob);
+  // Builtins with snapshot data of their own are serialized as placeholders
+  // into the startup snapshot.
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    if (ExtractBuiltinData(blob, i).length() > 0) {
+      isolate->builtins()->set_lazy_placeholder(i, true);
+    }
+  }
+  std::unique_ptr<byte[]> buffer;
+  Vector<const byte> startup_data =
+      MaybeDecompress(ExtractStartupData(blob), &buffer);
   SnapshotData snapshot_data(startup_data);
   Deserializer deserializer(&snapshot_data);
   bool success = isolate->Init(&deserializer);
+  if (success && !FLAG_lazy_deserialization) {
+    EnsureAllBuiltinsAreDeserialized(isolate);
+  }
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
     int bytes = startup_data.length();
@@ -50,6 +64,53 @@ bool Snapshot::Initialize(Isolate* isolate) {
   return success;
 }
 
+// static
+Code* Snapshot::EnsureBuiltinIsDeserialized(Isolate* isolate,
+                                            int builtin_index) {
+  Builtins* builtins = isolate->builtins();
+  Builtins::Name name = static_cast<Builtins::Name>(builtin_index);
+  if (!builtins->is_lazy_placeholder(builtin_index)) {
+    return builtins->builtin(name);
+  }
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  const v8::StartupData* blob = isolate->snapshot_blob();
+  std::unique_ptr<byte[]> buffer;
+  Vector<const byte> builtin_data =
+      MaybeDecompress(ExtractBuiltinData(blob, builtin_index), &buffer);
+  SnapshotData snapshot_data(builtin_data);
+  Deserializer deserializer(&snapshot_data);
+
+  HandleScope scope(isolate);
+  Handle<HeapObject> result;
+  if (!deserializer.DeserializeObject(isolate).ToHandle(&result)) {
+    V8::FatalProcessOutOfMemory("deserialize builtin");
+  }
+  Code* code = Code::cast(*result);
+  DCHECK_EQ(builtin_index, code->builtin_index());
+  builtins->set_builtin(builtin_index, code);
+  builtins->set_lazy_placeholder(builtin_index, false);
+
+  PROFILE(isolate, CodeCreateEvent(CodeEventListener::BUILTIN_TAG,
+                                   AbstractCode::cast(code),
+                                   Builtins::name(builtin_index)));
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int bytes = builtin_data.length();
+    PrintF("[Deserializing builtin %s (%d bytes) took %0.3f ms]\n",
+           Builtins::name(builtin_index), bytes, ms);
+  }
+  return code;
+}
+
+// static
+void Snapshot::EnsureAllBuiltinsAreDeserialized(Isolate* isolate) {
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    EnsureBuiltinIsDeserialized(isolate, i);
+  }
+}
+
 MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
     Isolate* isolate, Handle<JSGlobalProxy> global_proxy, size_t context_index,
     v8::DeserializeEmbedderFieldsCallback embedder_fields_deserializer) {
@@ -58,8 +119,9 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   if (FLAG_profile_deserialization) timer.Start();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
-  Vector<const byte> context_data =
-      ExtractContextData(blob, static_cast<int>(context_index));
+  std::unique_ptr<byte[]> buffer;
+  Vector<const byte> context_data = MaybeDecompress(
+      ExtractContextData(blob, static_cast<int>(context_index)), &buffer);
   SnapshotData snapshot_data(context_data);
   Deserializer deserializer(&snapshot_data);
 
@@ -78,6 +140,7 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
 }
 
 void ProfileDeserialization(const SnapshotData* startup_snapshot,
+                            const List<SnapshotData*>* builtin_snapshots,
                             const List<SnapshotData*>* context_snapshots) {
   if (FLAG_profile_deserialization) {
     int startup_total = 0;
@@ -86,6 +149,14 @@ void ProfileDeserialization(const SnapshotData* startup_snapshot,
       startup_total += reservation.chunk_size();
     }
     PrintF("%10d bytes per isolate\n", startup_total);
+    int builtins_total = 0;
+    for (const auto& builtin_snapshot : *builtin_snapshots) {
+      if (builtin_snapshot == nullptr) continue;
+      for (const auto& reservation : builtin_snapshot->Reservations()) {
+        builtins_total += reservation.chunk_size();
+      }
+    }
+    PrintF("%10d bytes for lazily deserialized builtins\n", builtins_total);
     for (int i = 0; i < context_snapshots->length(); i++) {
       int context_total = 0;
       for (const auto& reservation : context_snapshots->at(i)->Reservations()) {
@@ -98,34 +169,78 @@ void ProfileDeserialization(const SnapshotData* startup_snapshot,
 
 v8::StartupData Snapshot::CreateSnapshotBlob(
     const SnapshotData* startup_snapshot,
+    const List<SnapshotData*>* builtin_snapshots,
     const List<SnapshotData*>* context_snapshots) {
+  DCHECK_EQ(Builtins::builtin_count, builtin_snapshots->length());
   int num_contexts = context_snapshots->length();
+
+  // Chunks as they go into the blob, compressed if requested.
+  std::vector<std::vector<byte>> compressed_chunks;
+  auto chunk = [&compressed_chunks](const SnapshotData* snapshot) {
+    if (!FLAG_snapshot_compression) return snapshot->RawData();
+    compressed_chunks.push_back(
+        SnapshotCompression::Compress(snapshot->RawData()));
+    const std::vector<byte>& compressed = compressed_chunks.back();
+    return Vector<const byte>(compressed.data(),
+                              static_cast<int>(compressed.size()));
+  };
+  compressed_chunks.reserve(1 + Builtins::builtin_count + num_contexts);
+  Vector<const byte> startup_chunk = chunk(startup_snapshot);
+  List<Vector<const byte>> builtin_chunks(Builtins::builtin_count);
+  for (const auto& builtin_snapshot : *builtin_snapshots) {
+    builtin_chunks.Add(builtin_snapshot == nullptr ? Vector<const byte>()
+                                                   : chunk(builtin_snapshot));
+  }
+  List<Vector<const byte>> context_chunks(num_contexts);
+  for (const auto& context_snapshot : *context_snapshots) {
+    context_chunks.Add(chunk(context_snapshot));
+  }
+
   int startup_snapshot_offset = StartupSnapshotOffset(num_contexts);
   int total_length = startup_snapshot_offset;
-  total_length += startup_snapshot->RawData().length();
-  for (const auto& context_snapshot : *context_snapshots) {
-    total_length += context_snapshot->RawData().length();
+  total_length += startup_chunk.length();
+  for (const auto& builtin_chunk : builtin_chunks) {
+    total_length += builtin_chunk.length();
+  }
+  for (const auto& context_chunk : context_chunks) {
+    total_length += context_chunk.length();
   }
 
-  ProfileDeserialization(startup_snapshot, context_snapshots);
+  ProfileDeserialization(startup_snapshot, builtin_snapshots,
+                         context_snapshots);
 
   char* data = new char[total_length];
   memcpy(data + kNumberOfContextsOffset, &num_contexts, kInt32Size);
   int payload_offset = StartupSnapshotOffset(num_contexts);
-  int payload_length = startup_snapshot->RawData().length();
-  memcpy(data + payload_offset, startup_snapshot->RawData().start(),
-         payload_length);
+  int payload_length = startup_chunk.length();
+  memcpy(data + payload_offset, startup_chunk.start(), payload_length);
   if (FLAG_profile_deserialization) {
     PrintF("Snapshot blob consists of:\n%10d bytes for startup\n",
            payload_length);
   }
   payload_offset += payload_length;
+  int builtins_length = 0;
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    memcpy(data + BuiltinSnapshotOffsetOffset(num_contexts, i),
+           &payload_offset, kInt32Size);
+    Vector<const byte> builtin_chunk = builtin_chunks[i];
+    if (builtin_chunk.is_empty()) continue;
+    payload_length = builtin_chunk.length();
+    memcpy(data + payload_offset, builtin_chunk.start(), payload_length);
+    builtins_length += payload_length;
+    payload_offset += payload_length;
+  }
+  memcpy(data + BuiltinSnapshotOffsetOffset(num_contexts,
+                                            Builtins::builtin_count),
+         &payload_offset, kInt32Size);
+  if (FLAG_profile_deserialization) {
+    PrintF("%10d bytes for lazily deserialized builtins\n", builtins_length);
+  }
   for (int i = 0; i < num_contexts; i++) {
     memcpy(data + ContextSnapshotOffsetOffset(i), &payload_offset, kInt32Size);
-    SnapshotData* context_snapshot = context_snapshots->at(i);
-    payload_length = context_snapshot->RawData().length();
-    memcpy(data + payload_offset, context_snapshot->RawData().start(),
-           payload_length);
+    Vector<const byte> context_chunk = context_chunks[i];
+    payload_length = context_chunk.length();
+    memcpy(data + payload_offset, context_chunk.start(), payload_length);
     if (FLAG_profile_deserialization) {
       PrintF("%10d bytes for context #%d\n", payload_length, i);
     }
@@ -147,16 +262,38 @@ Vector<const byte> Snapshot::ExtractStartupData(const v8::StartupData* data) {
   int num_contexts = ExtractNumContexts(data);
   int startup_offset = StartupSnapshotOffset(num_contexts);
   CHECK_LT(startup_offset, data->raw_size);
-  int first_context_offset;
-  memcpy(&first_context_offset, data->data + ContextSnapshotOffsetOffset(0),
+  int first_builtin_offset;
+  memcpy(&first_builtin_offset,
+         data->data + BuiltinSnapshotOffsetOffset(num_contexts, 0),
          kInt32Size);
-  CHECK_LT(first_context_offset, data->raw_size);
-  int startup_length = first_context_offset - startup_offset;
+  CHECK_LT(first_builtin_offset, data->raw_size);
+  int startup_length = first_builtin_offset - startup_offset;
   const byte* startup_data =
       reinterpret_cast<const byte*>(data->data + startup_offset);
   return Vector<const byte>(startup_data, startup_length);
 }
 
+Vector<const byte> Snapshot::ExtractBuiltinData(const v8::StartupData* data,
+                                                int index) {
+  int num_contexts = ExtractNumContexts(data);
+  CHECK_LT(index, Builtins::builtin_count);
+
+  int builtin_offset;
+  memcpy(&builtin_offset,
+         data->data + BuiltinSnapshotOffsetOffset(num_contexts, index),
+         kInt32Size);
+  int next_builtin_offset;
+  memcpy(&next_builtin_offset,
+         data->data + BuiltinSnapshotOffsetOffset(num_contexts, index + 1),
+         kInt32Size);
+  CHECK_LE(next_builtin_offset, data->raw_size);
+
+  const byte* builtin_data =
+      reinterpret_cast<const byte*>(data->data + builtin_offset);
+  int builtin_length = next_builtin_offset - builtin_offset;
+  return Vector<const byte>(builtin_data, builtin_length);
+}
+
 Vector<const byte> Snapshot::ExtractContextData(const v8::StartupData* data,
                                                 int index) {
   int num_contexts = ExtractNumContexts(data);
@@ -180,6 +317,22 @@ Vector<const byte> Snapshot::ExtractContextData(const v8::StartupData* data,
   return Vector<const byte>(context_data, context_length);
 }
 
+// static
+Vector<const byte> Snapshot::MaybeDecompress(Vector<const byte> chunk,
+                                             std::unique_ptr<byte[]>* buffer) {
+  if (!SnapshotCompression::IsCompressed(chunk)) return chunk;
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+  int length = SnapshotCompression::UncompressedLength(chunk);
+  buffer->reset(new byte[length]);
+  CHECK(SnapshotCompression::Decompress(chunk, buffer->get()));
+  if (FLAG_profile_deserialization) {
+    PrintF("[Decompressing %d into %d bytes took %0.3f ms]\n", chunk.length(),
+           length, timer.Elapsed().InMillisecondsF());
+  }
+  return Vector<const byte>(buffer->get(), length);
+}
+
 SnapshotData::SnapshotData(const Serializer* serializer) {
   DisallowHeapAllocation no_gc;
   List<Reservation> reservations;
@@ -0,0 +1,161 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/snapshot-compression.h"
+
+#include <string.h>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const int kMinMatchLength = 4;
+const int kMaxMatchOffset = 0xFFFF;
+const int kHashBits = 14;
+const int kLengthMask = 0xF;
+
+uint32_t Load32(const byte* data) {
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+int Hash(uint32_t value) {
+  return static_cast<int>((value * 2654435761u) >> (32 - kHashBits));
+}
+
+void EmitLengthExtension(std::vector<byte>* out, int length) {
+  for (; length >= 0xFF; length -= 0xFF) out->push_back(0xFF);
+  out->push_back(static_cast<byte>(length));
+}
+
+void EmitLiterals(std::vector<byte>* out, const byte* literals, int length,
+                  int match_nibble) {
+  int literal_nibble = length < kLengthMask ? length : kLengthMask;
+  out->push_back(static_cast<byte>((literal_nibble << 4) | match_nibble));
+  if (length >= kLengthMask) EmitLengthExtension(out, length - kLengthMask);
+  out->insert(out->end(), literals, literals + length);
+}
+
+bool ReadLengthExtension(const byte** in, const byte* end, int limit,
+                         int* length) {
+  byte next;
+  do {
+    if (*in == end) return false;
+    next = *(*in)++;
+    *length += next;
+    if (*length > limit) return false;
+  } while (next == 0xFF);
+  return true;
+}
+
+}  // namespace
+
+std::vector<byte> SnapshotCompression::Compress(Vector<const byte> data) {
+  const byte* input = data.start();
+  int length = data.length();
+  std::vector<byte> out;
+  out.reserve(kHeaderSize + length / 2);
+  out.resize(kHeaderSize);
+  uint32_t magic = kMagicNumber;
+  memcpy(&out[kMagicNumberOffset], &magic, kInt32Size);
+  memcpy(&out[kUncompressedLengthOffset], &length, kInt32Size);
+
+  std::vector<int> last_position(1 << kHashBits, -1);
+  int literals_start = 0;
+  int position = 0;
+  while (position + kMinMatchLength <= length) {
+    uint32_t sequence = Load32(input + position);
+    int* entry = &last_position[Hash(sequence)];
+    int candidate = *entry;
+    *entry = position;
+    if (candidate < 0 || position - candidate > kMaxMatchOffset ||
+        Load32(input + candidate) != sequence) {
+      position++;
+      continue;
+    }
+    int match_length = kMinMatchLength;
+    while (position + match_length < length &&
+           input[candidate + match_length] == input[position + match_length]) {
+      match_length++;
+    }
+
+    int extra_length = match_length - kMinMatchLength;
+    EmitLiterals(&out, input + literals_start, position - literals_start,
+                 extra_length < kLengthMask ? extra_length : kLengthMask);
+    int offset = position - candidate;
+    out.push_back(static_cast<byte>(offset));
+    out.push_back(static_cast<byte>(offset >> 8));
+    if (extra_length >= kLengthMask) {
+      EmitLengthExtension(&out, extra_length - kLengthMask);
+    }
+    position += match_length;
+    literals_start = position;
+  }
+  EmitLiterals(&out, input + literals_start, length - literals_start, 0);
+  return out;
+}
+
+bool SnapshotCompression::IsCompressed(Vector<const byte> chunk) {
+  if (chunk.length() < kHeaderSize) return false;
+  return Load32(chunk.start() + kMagicNumberOffset) == kMagicNumber;
+}
+
+int SnapshotCompression::UncompressedLength(Vector<const byte> chunk) {
+  DCHECK(IsCompressed(chunk));
+  return static_cast<int>(Load32(chunk.start() + kUncompressedLengthOffset));
+}
+
+bool SnapshotCompression::Decompress(Vector<const byte> chunk, byte* out) {
+  DCHECK(IsCompressed(chunk));
+  const byte* in = chunk.start() + kHeaderSize;
+  const byte* in_end = chunk.start() + chunk.length();
+  byte* const out_start = out;
+  byte* const out_end = out + UncompressedLength(chunk);
+  int limit = static_cast<int>(out_end - out_start);
+
+  while (in < in_end) {
+    byte token = *in++;
+    int literal_length = token >> 4;
+    if (literal_length == kLengthMask &&
+        !ReadLengthExtension(&in, in_end, limit, &literal_length)) {
+      return false;
+    }
+    if (literal_length > in_end - in || literal_length > out_end - out) {
+      return false;
+    }
+    memcpy(out, in, literal_length);
+    in += literal_length;
+    out += literal_length;
+    // The last sequence has no match.
+    if (in == in_end) break;
+
+    if (in_end - in < 2) return false;
+    int offset = in[0] | (in[1] << 8);
+    in += 2;
+    if (offset == 0 || offset > out - out_start) return false;
+    int match_length = token & kLengthMask;
+    if (match_length == kLengthMask &&
+        !ReadLengthExtension(&in, in_end, limit, &match_length)) {
+      return false;
+    }
+    match_length += kMinMatchLength;
+    if (match_length > out_end - out) return false;
+    const byte* match = out - offset;
+    if (offset >= match_length) {
+      memcpy(out, match, match_length);
+      out += match_length;
+    } else {
+      // Overlapping matches repeat the last {offset} bytes.
+      for (int i = 0; i < match_length; i++) *out++ = *match++;
+    }
+  }
+  return out == out_end;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,48 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
+#define V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
+
+#include <vector>
+
+#include "src/globals.h"
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// A small LZ77 codec for the chunks of a snapshot blob. Each compressed chunk
+// is framed as
+//   [0] magic number, distinct from the one starting uncompressed chunks
+//   [1] uncompressed length
+//   ... sequences
+// where a sequence is a token byte holding the literal length in its high
+// and the match length minus 4 in its low nibble, optional length extension
+// bytes for the literal length, the literals, a 16-bit little-endian match
+// offset and optional length extension bytes for the match length. The last
+// sequence only has literals. Decompression is a single forward pass without
+// any tables, so that it costs little next to deserialization.
+class SnapshotCompression : public AllStatic {
+ public:
+  static std::vector<byte> Compress(Vector<const byte> data);
+
+  static bool IsCompressed(Vector<const byte> chunk);
+  static int UncompressedLength(Vector<const byte> chunk);
+
+  // Decompresses {chunk} into {out}, which must have room for
+  // UncompressedLength(chunk) bytes. Returns false if {chunk} is corrupt.
+  static bool Decompress(Vector<const byte> chunk, byte* out);
+
+ private:
+  static const uint32_t kMagicNumber = 0x4C5A0000;
+  static const int kMagicNumberOffset = 0;
+  static const int kUncompressedLengthOffset = kMagicNumberOffset + kInt32Size;
+  static const int kHeaderSize = kUncompressedLengthOffset + kInt32Size;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
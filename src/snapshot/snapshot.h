@@ -64,6 +64,13 @@ class Snapshot : public AllStatic {
 
   static bool HasContextSnapshot(Isolate* isolate, size_t index);
 
+  // Deserializes the builtin {builtin_index} into the builtins table if it has
+  // been left for lazy deserialization, and returns its code.
+  static Code* EnsureBuiltinIsDeserialized(Isolate* isolate, int builtin_index);
+
+  // Deserializes all builtins that have been left for lazy deserialization.
+  static void EnsureAllBuiltinsAreDeserialized(Isolate* isolate);
+
   static bool EmbedsScript(Isolate* isolate);
 
   // To be implemented by the snapshot source.
@@ -71,6 +78,7 @@ class Snapshot : public AllStatic {
 
   static v8::StartupData CreateSnapshotBlob(
       const SnapshotData* startup_snapshot,
+      const List<SnapshotData*>* builtin_snapshots,
       const List<SnapshotData*>* context_snapshots);
 
 #ifdef DEBUG
@@ -80,25 +88,50 @@ class Snapshot : public AllStatic {
  private:
   static int ExtractNumContexts(const v8::StartupData* data);
   static Vector<const byte> ExtractStartupData(const v8::StartupData* data);
+  static Vector<const byte> ExtractBuiltinData(const v8::StartupData* data,
+                                               int index);
   static Vector<const byte> ExtractContextData(const v8::StartupData* data,
                                                int index);
 
+  // Returns {chunk} itself, or, if it was compressed when the blob was
+  // created, its contents decompressed into {buffer}.
+  static Vector<const byte> MaybeDecompress(Vector<const byte> chunk,
+                                            std::unique_ptr<byte[]>* buffer);
+
   // Snapshot blob layout:
   // [0] number of contexts N
   // [1] offset to context 0
   // [2] offset to context 1
   // ...
   // ... offset to context N - 1
+  // ... offset to builtin 0
+  // ... offset to builtin 1
+  // ...
+  // ... offset to builtin M - 1
+  // ... offset to the end of the builtins snapshot data
   // ... startup snapshot data
+  // ... builtin 0 snapshot data
+  // ... builtin 1 snapshot data
+  // ...
   // ... context 0 snapshot data
   // ... context 1 snapshot data
+  //
+  // The snapshot data of builtin i ends where that of builtin i + 1 starts.
+  // Builtins that are deserialized along with the startup snapshot have empty
+  // snapshot data. With --snapshot-compression, each non-empty snapshot data
+  // is compressed on its own, and only decompressed when it is deserialized.
 
   static const int kNumberOfContextsOffset = 0;
   static const int kFirstContextOffsetOffset =
       kNumberOfContextsOffset + kInt32Size;
 
+  static int BuiltinSnapshotOffsetOffset(int num_contexts, int index) {
+    return kFirstContextOffsetOffset + (num_contexts + index) * kInt32Size;
+  }
+
   static int StartupSnapshotOffset(int num_contexts) {
-    return kFirstContextOffsetOffset + num_contexts * kInt32Size;
+    return BuiltinSnapshotOffsetOffset(num_contexts, Builtins::builtin_count) +
+           kInt32Size;
   }
 
   static int ContextSnapshotOffsetOffset(int index) {
@@ -12,10 +12,15 @@ namespace internal {
 
 StartupSerializer::StartupSerializer(
     Isolate* isolate,
-    v8::SnapshotCreator::FunctionCodeHandling function_code_handling)
+    v8::SnapshotCreator::FunctionCodeHandling function_code_handling,
+    FixedArray* lazy_builtin_placeholders)
     : Serializer(isolate),
       clear_function_code_(function_code_handling ==
                            v8::SnapshotCreator::FunctionCodeHandling::kClear),
+      clear_feedback_(
+          function_code_handling !=
+          v8::SnapshotCreator::FunctionCodeHandling::kKeepWithFeedback),
+      lazy_builtin_placeholders_(lazy_builtin_placeholders),
       serializing_builtins_(false) {
   InitializeCodeAddressMap();
 }
@@ -50,6 +55,8 @@ void StartupSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
     }
   }
 
+  if (obj->IsCode()) obj = MaybeReplaceWithLazyPlaceholder(Code::cast(obj));
+
   if (SerializeHotObject(obj, how_to_code, where_to_point, skip)) return;
 
   int root_index = root_index_map_.Lookup(obj);
@@ -92,6 +99,15 @@ void StartupSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
   }
 }
 
+Code* StartupSerializer::MaybeReplaceWithLazyPlaceholder(Code* code) {
+  if (lazy_builtin_placeholders_ == nullptr) return code;
+  if (code->kind() != Code::BUILTIN) return code;
+  // Placeholders left over from the snapshot this isolate was created from
+  // carry the index of their builtin as well.
+  Object* placeholder = lazy_builtin_placeholders_->get(code->builtin_index());
+  return placeholder->IsCode() ? Code::cast(placeholder) : code;
+}
+
 void StartupSerializer::SerializeWeakReferencesAndDeferred() {
   // This comes right after serialization of the partial snapshot, where we
   // add entries to the partial snapshot cache of the startup snapshot. Add
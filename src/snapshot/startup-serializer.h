@@ -14,9 +14,13 @@ namespace internal {
 
 class StartupSerializer : public Serializer {
  public:
+  // Builtins that have a placeholder in {lazy_builtin_placeholders} are
+  // serialized as that placeholder, see
+  // BuiltinSerializer::CreateLazyBuiltinPlaceholders.
   StartupSerializer(
       Isolate* isolate,
-      v8::SnapshotCreator::FunctionCodeHandling function_code_handling);
+      v8::SnapshotCreator::FunctionCodeHandling function_code_handling,
+      FixedArray* lazy_builtin_placeholders = nullptr);
   ~StartupSerializer() override;
 
   // Serialize the current state of the heap.  The order is:
@@ -29,6 +33,10 @@ class StartupSerializer : public Serializer {
 
   int PartialSnapshotCacheIndex(HeapObject* o);
 
+  // Whether the partial serializers should clear the type feedback of the
+  // functions they serialize.
+  bool clear_feedback() const { return clear_feedback_; }
+
  private:
   class PartialCacheIndexMap {
    public:
@@ -68,7 +76,13 @@ class StartupSerializer : public Serializer {
   // roots. In the second pass, we serialize the rest.
   bool RootShouldBeSkipped(int root_index);
 
+  // Returns the placeholder for {code} if it is a builtin that is deserialized
+  // lazily, and {code} otherwise.
+  Code* MaybeReplaceWithLazyPlaceholder(Code* code);
+
   bool clear_function_code_;
+  bool clear_feedback_;
+  FixedArray* lazy_builtin_placeholders_;
   bool serializing_builtins_;
   bool serializing_immortal_immovables_roots_;
   std::bitset<Heap::kStrongRootListLength> root_has_been_serialized_;
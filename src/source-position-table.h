@@ -35,7 +35,11 @@ struct PositionTableEntry {
 
 class V8_EXPORT_PRIVATE SourcePositionTableBuilder {
  public:
-  enum RecordingMode { OMIT_SOURCE_POSITIONS, RECORD_SOURCE_POSITIONS };
+  enum RecordingMode {
+    OMIT_SOURCE_POSITIONS,
+    LAZY_SOURCE_POSITIONS,
+    RECORD_SOURCE_POSITIONS
+  };
 
   SourcePositionTableBuilder(Zone* zone,
                              RecordingMode mode = RECORD_SOURCE_POSITIONS);
@@ -46,10 +50,13 @@ class V8_EXPORT_PRIVATE SourcePositionTableBuilder {
   Handle<ByteArray> ToSourcePositionTable(Isolate* isolate,
                                           Handle<AbstractCode> code);
 
+  // True if the positions are not recorded now but collected on demand.
+  bool Lazy() const { return mode_ == LAZY_SOURCE_POSITIONS; }
+
  private:
   void AddEntry(const PositionTableEntry& entry);
 
-  inline bool Omit() const { return mode_ == OMIT_SOURCE_POSITIONS; }
+  inline bool Omit() const { return mode_ != RECORD_SOURCE_POSITIONS; }
 
   RecordingMode mode_;
   ZoneVector<byte> bytes_;
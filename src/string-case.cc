@@ -71,37 +71,34 @@ int FastAsciiConvert(char* dst, const char* src, int length,
 
   // dst is newly allocated and always aligned.
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(dst), sizeof(uintptr_t)));
-  // Only attempt processing one word at a time if src is also aligned.
-  if (IsAligned(reinterpret_cast<intptr_t>(src), sizeof(uintptr_t))) {
-    // Process the prefix of the input that requires no conversion one aligned
-    // (machine) word at a time.
-    while (src <= limit - sizeof(uintptr_t)) {
-      const uintptr_t w = *reinterpret_cast<const uintptr_t*>(src);
-      if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
-      if (AsciiRangeMask(w, lo, hi) != 0) {
-        changed = true;
-        break;
-      }
-      *reinterpret_cast<uintptr_t*>(dst) = w;
-      src += sizeof(uintptr_t);
-      dst += sizeof(uintptr_t);
-    }
-    // Process the remainder of the input performing conversion when
-    // required one word at a time.
-    while (src <= limit - sizeof(uintptr_t)) {
-      const uintptr_t w = *reinterpret_cast<const uintptr_t*>(src);
-      if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
-      uintptr_t m = AsciiRangeMask(w, lo, hi);
-      // The mask has high (7th) bit set in every byte that needs
-      // conversion and we know that the distance between cases is
-      // 1 << 5.
-      *reinterpret_cast<uintptr_t*>(dst) = w ^ (m >> 2);
-      src += sizeof(uintptr_t);
-      dst += sizeof(uintptr_t);
+  // Process the prefix of the input that requires no conversion one
+  // (machine) word at a time. Substrings of other strings need not be
+  // aligned, so src is read with unaligned loads.
+  while (src <= limit - sizeof(uintptr_t)) {
+    const uintptr_t w = ReadUnalignedValue<uintptr_t>(src);
+    if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
+    if (AsciiRangeMask(w, lo, hi) != 0) {
+      changed = true;
+      break;
     }
+    *reinterpret_cast<uintptr_t*>(dst) = w;
+    src += sizeof(uintptr_t);
+    dst += sizeof(uintptr_t);
+  }
+  // Process the remainder of the input performing conversion when
+  // required one word at a time.
+  while (src <= limit - sizeof(uintptr_t)) {
+    const uintptr_t w = ReadUnalignedValue<uintptr_t>(src);
+    if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
+    uintptr_t m = AsciiRangeMask(w, lo, hi);
+    // The mask has high (7th) bit set in every byte that needs
+    // conversion and we know that the distance between cases is
+    // 1 << 5.
+    *reinterpret_cast<uintptr_t*>(dst) = w ^ (m >> 2);
+    src += sizeof(uintptr_t);
+    dst += sizeof(uintptr_t);
   }
-  // Process the last few bytes of the input (or the whole input if
-  // unaligned access is not supported).
+  // Process the last few bytes of the input.
   while (src < limit) {
     char c = *src;
     if ((c & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
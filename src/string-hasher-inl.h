@@ -21,10 +21,6 @@ StringHasher::StringHasher(int length, uint32_t seed)
   DCHECK(FLAG_randomize_hashes || raw_running_hash_ == 0);
 }
 
-bool StringHasher::has_trivial_hash() {
-  return length_ > String::kMaxHashCalcLength;
-}
-
 uint32_t StringHasher::AddCharacterCore(uint32_t running_hash, uint16_t c) {
   running_hash += c;
   running_hash += (running_hash << 10);
@@ -42,6 +38,16 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+uint32_t StringHasher::GetLongStringHashCore(uint32_t running_hash,
+                                             int length) {
+  DCHECK_LT(String::kMaxHashCalcLength, length);
+  // Mix in the length, so that strings with a common prefix only collide if
+  // they also have the same length.
+  running_hash = AddCharacterCore(running_hash, length & 0xffff);
+  running_hash = AddCharacterCore(running_hash, length >> 16);
+  return GetHashCore(running_hash);
+}
+
 uint32_t StringHasher::ComputeRunningHash(uint32_t running_hash,
                                           const uc16* chars, int length) {
   DCHECK_NOT_NULL(chars);
@@ -95,6 +101,7 @@ bool StringHasher::UpdateIndex(uint16_t c) {
 template <typename Char>
 inline void StringHasher::AddCharacters(const Char* chars, int length) {
   DCHECK(sizeof(Char) == 1 || sizeof(Char) == 2);
+  length = Min(length, String::kMaxHashCalcLength);
   int i = 0;
   if (is_array_index_) {
     for (; i < length; i++) {
@@ -115,7 +122,7 @@ template <typename schar>
 uint32_t StringHasher::HashSequentialString(const schar* chars, int length,
                                             uint32_t seed) {
   StringHasher hasher(length, seed);
-  if (!hasher.has_trivial_hash()) hasher.AddCharacters(chars, length);
+  hasher.AddCharacters(chars, length);
   return hasher.GetHashField();
 }
 
@@ -124,8 +131,6 @@ IteratingStringHasher::IteratingStringHasher(int len, uint32_t seed)
 
 uint32_t IteratingStringHasher::Hash(String* string, uint32_t seed) {
   IteratingStringHasher hasher(string->length(), seed);
-  // Nothing to do.
-  if (hasher.has_trivial_hash()) return hasher.GetHashField();
   ConsString* cons_string = String::VisitFlat(&hasher, string);
   if (cons_string == nullptr) return hasher.GetHashField();
   hasher.VisitConsString(cons_string);
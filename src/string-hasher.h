@@ -41,6 +41,10 @@ class V8_EXPORT_PRIVATE StringHasher {
   // Reusable parts of the hashing algorithm.
   INLINE(static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c));
   INLINE(static uint32_t GetHashCore(uint32_t running_hash));
+  // Finishes the hash of a string longer than String::kMaxHashCalcLength,
+  // given the running hash of its first kMaxHashCalcLength characters.
+  INLINE(static uint32_t GetLongStringHashCore(uint32_t running_hash,
+                                               int length));
   INLINE(static uint32_t ComputeRunningHash(uint32_t running_hash,
                                             const uc16* chars, int length));
   INLINE(static uint32_t ComputeRunningHashOneByte(uint32_t running_hash,
@@ -51,10 +55,8 @@ class V8_EXPORT_PRIVATE StringHasher {
   // Returns the value to store in the hash field of a string with
   // the given length and contents.
   uint32_t GetHashField();
-  // Returns true if the hash of this string can be computed without
-  // looking at the contents.
-  inline bool has_trivial_hash();
-  // Adds a block of characters to the hash.
+  // Adds a block of characters to the hash. Characters past the first
+  // String::kMaxHashCalcLength of a block are ignored.
   template <typename Char>
   inline void AddCharacters(const Char* chars, int len);
 
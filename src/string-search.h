@@ -6,6 +6,7 @@
 #define V8_STRING_SEARCH_H_
 
 #include "src/isolate.h"
+#include "src/utils.h"
 #include "src/vector.h"
 
 namespace v8 {
@@ -230,6 +231,61 @@ inline int FindFirstCharacter(Vector<const PatternChar> pattern,
 }
 
 
+// Returns the first position at or after {index} at which both the first and
+// the last character of {pattern} occur in {subject}, or -1 if there is none.
+// Candidate positions are filtered a word at a time: the word of subject
+// characters at a position and the word at the same position plus the pattern
+// length minus one are compared lane-wise with the first and the last pattern
+// character. A common first character is thus rarely a candidate.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(Vector<const PatternChar> pattern,
+                                     Vector<const SubjectChar> subject,
+                                     int index) {
+  const int last_index = pattern.length() - 1;
+  DCHECK_LT(0, last_index);
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char = static_cast<SubjectChar>(pattern[last_index]);
+  // Positions from max_n on leave no room for the pattern.
+  const int max_n = subject.length() - last_index;
+
+  const int kCharsPerWord = sizeof(uintptr_t) / sizeof(SubjectChar);
+  const uintptr_t lane_ones =
+      kUintptrAllBitsSet / static_cast<SubjectChar>(kMaxUInt32);
+  const uintptr_t lane_high_bits =
+      lane_ones << (kBitsPerByte * sizeof(SubjectChar) - 1);
+  const uintptr_t first_chars = lane_ones * first_char;
+  const uintptr_t last_chars = lane_ones * last_char;
+  const SubjectChar* chars = subject.start();
+  int pos = index;
+  while (pos + kCharsPerWord <= max_n) {
+    // Lanes that match become zero. The zero lanes are found with the
+    // classic bit trick, which can also flag lanes above a zero lane; those
+    // are weeded out below.
+    uintptr_t first_word =
+        ReadUnalignedValue<uintptr_t>(chars + pos) ^ first_chars;
+    uintptr_t last_word =
+        ReadUnalignedValue<uintptr_t>(chars + pos + last_index) ^ last_chars;
+    uintptr_t candidates = (first_word - lane_ones) & ~first_word &
+                           (last_word - lane_ones) & ~last_word &
+                           lane_high_bits;
+    if (candidates != 0) {
+      for (int i = pos; i < pos + kCharsPerWord; i++) {
+        if (chars[i] == first_char && chars[i + last_index] == last_char) {
+          return i;
+        }
+      }
+    }
+    pos += kCharsPerWord;
+  }
+  for (; pos < max_n; pos++) {
+    if (chars[pos] == first_char && chars[pos + last_index] == last_char) {
+      return pos;
+    }
+  }
+  return -1;
+}
+
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -282,17 +338,17 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindFirstAndLastCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
-    i++;
-    // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.start() + 1,
-                    subject.start() + i,
-                    pattern_length - 1)) {
-      return i - 1;
+    // The first and the last character are known to match. Loop extracted to
+    // separate function to allow using return to do a deeper break.
+    if (pattern_length == 2 || CharCompare(pattern.start() + 1,
+                                           subject.start() + i + 1,
+                                           pattern_length - 2)) {
+      return i;
     }
+    i++;
   }
   return -1;
 }
@@ -526,7 +582,7 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindFirstAndLastCharacter(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
       int j = 1;
@@ -18,6 +18,15 @@ void TransitionArray::Insert(Handle<Map> map, Handle<Name> name,
   Isolate* isolate = map->GetIsolate();
   target->SetBackPointer(*map);
 
+  // The new target replaces any previous transition for the same key, so
+  // the cache can be updated up front. A gc during the insertion just clears
+  // the cache.
+  if (flag != SPECIAL_TRANSITION) {
+    PropertyDetails details = GetTargetDetails(*name, *target);
+    isolate->transition_lookup_cache()->Update(
+        *map, *name, details.kind(), details.attributes(), *target);
+  }
+
   // If the map doesn't have any transitions at all yet, install the new one.
   if (CanStoreSimpleTransition(map->raw_transitions())) {
     if (flag == SIMPLE_PROPERTY_TRANSITION) {
@@ -171,10 +180,17 @@ Map* TransitionArray::SearchTransition(Map* map, PropertyKind kind, Name* name,
     return target;
   }
   if (IsFullTransitionArray(raw_transitions)) {
+    // Wide transition trees are searched repeatedly by map migration and
+    // deprecation, look in the cache of recent transitions first.
+    TransitionLookupCache* cache = map->GetIsolate()->transition_lookup_cache();
+    Map* target = cache->Lookup(map, name, kind, attributes);
+    if (target != nullptr) return target;
     TransitionArray* transitions = TransitionArray::cast(raw_transitions);
     int transition = transitions->Search(kind, name, attributes);
     if (transition == kNotFound) return nullptr;
-    return transitions->GetTarget(transition);
+    target = transitions->GetTarget(transition);
+    cache->Update(map, name, kind, attributes, target);
+    return target;
   }
   return NULL;
 }
@@ -145,7 +145,20 @@ void HandleSignal(int signum, siginfo_t* info, void* context) {
   ucontext_t* uc = reinterpret_cast<ucontext_t*>(context);
 
   if (!TryHandleSignal(signum, info, uc)) {
-    // Since V8 didn't handle this signal, we want to re-raise the same signal.
+    // Since V8 didn't handle this signal, give the handler that was installed
+    // before ours a chance to handle it. Embedders rely on this for their own
+    // SIGSEGV handlers, e.g. for crash reporting.
+    if (g_old_handler.sa_flags & SA_SIGINFO) {
+      g_old_handler.sa_sigaction(signum, info, context);
+      return;
+    }
+    if (g_old_handler.sa_handler != SIG_DFL &&
+        g_old_handler.sa_handler != SIG_IGN) {
+      g_old_handler.sa_handler(signum);
+      return;
+    }
+
+    // Otherwise we want to re-raise the same signal.
     // For kernel-generated SEGV signals, we do this by restoring the default
     // SEGV handler and then returning. The fault will happen again and the
     // usual SEGV handling will happen.
@@ -167,25 +167,43 @@ void ReleaseHandlerData(int index) {
   free(data);
 }
 
+bool g_is_trap_handler_enabled = false;
+
+namespace {
+bool g_is_default_signal_handler_registered = false;
+}  // namespace
+
 bool RegisterDefaultSignalHandler() {
 #if V8_TRAP_HANDLER_SUPPORTED
+  // Registering twice would make our own handler the one we chain to.
+  if (g_is_default_signal_handler_registered) return true;
+
   struct sigaction action;
   action.sa_sigaction = HandleSignal;
   action.sa_flags = SA_SIGINFO;
   sigemptyset(&action.sa_mask);
   // {sigaction} installs a new custom segfault handler. On success, it returns
   // 0. If we get a nonzero value, we report an error to the caller by returning
-  // false.
-  if (sigaction(SIGSEGV, &action, nullptr) != 0) {
+  // false. The previous handler is kept so that faults outside of wasm code
+  // still reach it.
+  if (sigaction(SIGSEGV, &action, &g_old_handler) != 0) {
     return false;
   }
 
+  g_is_default_signal_handler_registered = true;
   return true;
 #else
   return false;
 #endif
 }
 
+bool EnableTrapHandler(bool use_v8_handler) {
+  if (!V8_TRAP_HANDLER_SUPPORTED) return false;
+  if (use_v8_handler && !RegisterDefaultSignalHandler()) return false;
+  g_is_trap_handler_enabled = true;
+  return true;
+}
+
 }  // namespace trap_handler
 }  // namespace internal
 }  // namespace v8
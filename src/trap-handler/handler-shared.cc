@@ -25,6 +25,10 @@ namespace trap_handler {
 
 THREAD_LOCAL bool g_thread_in_wasm_code = false;
 
+#if V8_TRAP_HANDLER_SUPPORTED
+struct sigaction g_old_handler;
+#endif
+
 size_t gNumCodeObjects = 0;
 CodeProtectionInfoListEntry* gCodeObjects = nullptr;
 
@@ -43,6 +43,10 @@ class MetadataLock {
 
 #if V8_TRAP_HANDLER_SUPPORTED
 void HandleSignal(int signum, siginfo_t* info, void* context);
+
+// The SIGSEGV action that was installed before {RegisterDefaultSignalHandler}
+// replaced it. Faults that are not ours are passed on to it.
+extern struct sigaction g_old_handler;
 #endif
 
 // To enable constant time registration of handler data, we keep a free list of
@@ -61,8 +61,22 @@ void ReleaseHandlerData(int index);
 #define THREAD_LOCAL __thread
 #endif
 
+// Set by {EnableTrapHandler}. Until then, wasm code keeps explicit bounds
+// checks even if --wasm-trap-handler is set.
+extern bool g_is_trap_handler_enabled;
+
+/// Makes out of bounds memory accesses in wasm code be caught by a signal
+/// handler. If {use_v8_handler} is false, the embedder is responsible for
+/// forwarding SIGSEGV to {TryHandleSignal}.
+///
+/// This must be called before any wasm code is compiled. Returns false if
+/// trap handlers are not supported or the signal handler could not be
+/// installed.
+bool EnableTrapHandler(bool use_v8_handler);
+
 inline bool UseTrapHandler() {
-  return FLAG_wasm_trap_handler && V8_TRAP_HANDLER_SUPPORTED;
+  return FLAG_wasm_trap_handler && V8_TRAP_HANDLER_SUPPORTED &&
+         g_is_trap_handler_enabled;
 }
 
 extern THREAD_LOCAL bool g_thread_in_wasm_code;
@@ -7,7 +7,6 @@
 #include "src/char-predicates-inl.h"
 #include "src/handles.h"
 #include "src/isolate-inl.h"
-#include "src/list.h"
 #include "src/string-search.h"
 
 namespace v8 {
@@ -43,7 +42,58 @@ bool IsReplacementCharacter(const uint8_t* octets, int length) {
   return true;
 }
 
-bool DecodeOctets(const uint8_t* octets, int length, List<uc16>* buffer) {
+bool IsOneByteRun(const uint8_t* chars, int length) { return true; }
+
+bool IsOneByteRun(const uc16* chars, int length) {
+  return String::IsOneByte(chars, length);
+}
+
+// Receives the result of decoding a URI without storing it. Used by the first
+// pass of Uri::Decode to compute the length and the representation of the
+// result.
+template <typename Char>
+class DecodedUriMeasure {
+ public:
+  DecodedUriMeasure() : length_(0), is_one_byte_(true) {}
+
+  void Add(uc16 c) {
+    length_++;
+    if (c > String::kMaxOneByteCharCode) is_one_byte_ = false;
+  }
+
+  void AddRun(const Char* chars, int length) {
+    length_ += length;
+    if (is_one_byte_) is_one_byte_ = IsOneByteRun(chars, length);
+  }
+
+  int length() const { return length_; }
+  bool is_one_byte() const { return is_one_byte_; }
+
+ private:
+  int length_;
+  bool is_one_byte_;
+};
+
+// Writes the result of decoding a URI into the characters of a sequential
+// string that DecodedUriMeasure sized.
+template <typename Char, typename DestChar>
+class DecodedUriWriter {
+ public:
+  explicit DecodedUriWriter(DestChar* dest) : cursor_(dest) {}
+
+  void Add(uc16 c) { *cursor_++ = static_cast<DestChar>(c); }
+
+  void AddRun(const Char* chars, int length) {
+    CopyChars(cursor_, chars, length);
+    cursor_ += length;
+  }
+
+ private:
+  DestChar* cursor_;
+};
+
+template <typename Sink>
+bool DecodeOctets(const uint8_t* octets, int length, Sink* sink) {
   size_t cursor = 0;
   uc32 value = unibrow::Utf8::ValueOf(octets, length, &cursor);
   if (value == unibrow::Utf8::kBadChar &&
@@ -52,10 +102,10 @@ bool DecodeOctets(const uint8_t* octets, int length, List<uc16>* buffer) {
   }
 
   if (value <= static_cast<uc32>(unibrow::Utf16::kMaxNonSurrogateCharCode)) {
-    buffer->Add(value);
+    sink->Add(value);
   } else {
-    buffer->Add(unibrow::Utf16::LeadSurrogate(value));
-    buffer->Add(unibrow::Utf16::TrailSurrogate(value));
+    sink->Add(unibrow::Utf16::LeadSurrogate(value));
+    sink->Add(unibrow::Utf16::TrailSurrogate(value));
   }
   return true;
 }
@@ -70,200 +120,225 @@ int TwoDigitHex(uc16 character1, uc16 character2) {
   return (high << 4) + low;
 }
 
-template <typename T>
-void AddToBuffer(uc16 decoded, String::FlatContent* uri_content, int index,
-                 bool is_uri, List<T>* buffer) {
-  if (is_uri && IsReservedPredicate(decoded)) {
-    buffer->Add('%');
-    uc16 first = uri_content->Get(index + 1);
-    uc16 second = uri_content->Get(index + 2);
-    DCHECK_GT(std::numeric_limits<T>::max(), first);
-    DCHECK_GT(std::numeric_limits<T>::max(), second);
-
-    buffer->Add(first);
-    buffer->Add(second);
-  } else {
-    buffer->Add(decoded);
-  }
-}
-
-bool IntoTwoByte(int index, bool is_uri, int uri_length,
-                 String::FlatContent* uri_content, List<uc16>* buffer) {
-  for (int k = index; k < uri_length; k++) {
-    uc16 code = uri_content->Get(k);
-    if (code == '%') {
-      int two_digits;
-      if (k + 2 >= uri_length ||
-          (two_digits = TwoDigitHex(uri_content->Get(k + 1),
-                                    uri_content->Get(k + 2))) < 0) {
-        return false;
-      }
+// Decodes {uri} into {sink}. Runs of characters without escape sequences are
+// found with memchr and passed on in bulk. Returns false if {uri} contains a
+// malformed escape sequence or an invalid UTF-8 sequence.
+template <typename Char, typename Sink>
+bool DecodeUriChars(Vector<const Char> uri, bool is_uri, Sink* sink) {
+  Vector<const uint8_t> percent = STATIC_CHAR_VECTOR("%");
+  int uri_length = uri.length();
+  int k = 0;
+  while (k < uri_length) {
+    int escape = FindFirstCharacter(percent, uri, k);
+    if (escape < 0) escape = uri_length;
+    sink->AddRun(uri.start() + k, escape - k);
+    k = escape;
+    if (k == uri_length) break;
+
+    int two_digits;
+    if (k + 2 >= uri_length ||
+        (two_digits = TwoDigitHex(uri[k + 1], uri[k + 2])) < 0) {
+      return false;
+    }
+    uc16 decoded = static_cast<uc16>(two_digits);
+    if (decoded > unibrow::Utf8::kMaxOneByteChar) {
+      uint8_t octets[unibrow::Utf8::kMaxEncodedSize];
+      octets[0] = decoded;
       k += 2;
-      uc16 decoded = static_cast<uc16>(two_digits);
-      if (decoded > unibrow::Utf8::kMaxOneByteChar) {
-        uint8_t octets[unibrow::Utf8::kMaxEncodedSize];
-        octets[0] = decoded;
-
-        int number_of_continuation_bytes = 0;
-        while ((decoded << ++number_of_continuation_bytes) & 0x80) {
-          if (number_of_continuation_bytes > 3 || k + 3 >= uri_length) {
-            return false;
-          }
-          if (uri_content->Get(++k) != '%' ||
-              (two_digits = TwoDigitHex(uri_content->Get(k + 1),
-                                        uri_content->Get(k + 2))) < 0) {
-            return false;
-          }
-          k += 2;
-          uc16 continuation_byte = static_cast<uc16>(two_digits);
-          octets[number_of_continuation_bytes] = continuation_byte;
-        }
 
-        if (!DecodeOctets(octets, number_of_continuation_bytes, buffer)) {
+      int number_of_continuation_bytes = 0;
+      while ((decoded << ++number_of_continuation_bytes) & 0x80) {
+        if (number_of_continuation_bytes > 3 || k + 3 >= uri_length) {
           return false;
         }
-      } else {
-        AddToBuffer(decoded, uri_content, k - 2, is_uri, buffer);
+        if (uri[++k] != '%' ||
+            (two_digits = TwoDigitHex(uri[k + 1], uri[k + 2])) < 0) {
+          return false;
+        }
+        k += 2;
+        octets[number_of_continuation_bytes] =
+            static_cast<uint8_t>(two_digits);
       }
-    } else {
-      buffer->Add(code);
-    }
-  }
-  return true;
-}
 
-bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
-                       List<uint8_t>* one_byte_buffer,
-                       List<uc16>* two_byte_buffer) {
-  DisallowHeapAllocation no_gc;
-  String::FlatContent uri_content = uri->GetFlatContent();
-
-  int uri_length = uri->length();
-  for (int k = 0; k < uri_length; k++) {
-    uc16 code = uri_content.Get(k);
-    if (code == '%') {
-      int two_digits;
-      if (k + 2 >= uri_length ||
-          (two_digits = TwoDigitHex(uri_content.Get(k + 1),
-                                    uri_content.Get(k + 2))) < 0) {
+      if (!DecodeOctets(octets, number_of_continuation_bytes, sink)) {
         return false;
       }
-
-      uc16 decoded = static_cast<uc16>(two_digits);
-      if (decoded > unibrow::Utf8::kMaxOneByteChar) {
-        return IntoTwoByte(k, is_uri, uri_length, &uri_content,
-                           two_byte_buffer);
-      }
-
-      AddToBuffer(decoded, &uri_content, k, is_uri, one_byte_buffer);
-      k += 2;
+      k++;
+    } else if (is_uri && IsReservedPredicate(decoded)) {
+      // Reserved characters are left escaped by decodeURI.
+      sink->AddRun(uri.start() + k, 3);
+      k += 3;
     } else {
-      if (code > unibrow::Utf8::kMaxOneByteChar) {
-        return IntoTwoByte(k, is_uri, uri_length, &uri_content,
-                           two_byte_buffer);
-      }
-      one_byte_buffer->Add(code);
+      sink->Add(decoded);
+      k += 3;
     }
   }
   return true;
 }
 
-}  // anonymous namespace
-
-MaybeHandle<String> Uri::Decode(Isolate* isolate, Handle<String> uri,
-                                bool is_uri) {
-  uri = String::Flatten(uri);
-  List<uint8_t> one_byte_buffer;
-  List<uc16> two_byte_buffer;
-
-  if (!IntoOneAndTwoByte(uri, is_uri, &one_byte_buffer, &two_byte_buffer)) {
-    THROW_NEW_ERROR(isolate, NewURIError(), String);
+template <typename Char>
+MaybeHandle<String> DecodePrivate(Isolate* isolate, Handle<String> uri,
+                                  bool is_uri) {
+  DecodedUriMeasure<Char> measure;
+  {
+    DisallowHeapAllocation no_gc;
+    Vector<const Char> uri_chars = uri->GetCharVector<Char>();
+    if (!DecodeUriChars(uri_chars, is_uri, &measure)) {
+      AllowHeapAllocation allocate_error_and_return;
+      THROW_NEW_ERROR(isolate, NewURIError(), String);
+    }
   }
 
-  if (two_byte_buffer.is_empty()) {
-    return isolate->factory()->NewStringFromOneByte(
-        one_byte_buffer.ToConstVector());
+  // Without escape sequences the result is equal to {uri}.
+  if (measure.length() == uri->length()) return uri;
+
+  if (measure.is_one_byte()) {
+    Handle<SeqOneByteString> result;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, result,
+        isolate->factory()->NewRawOneByteString(measure.length()), String);
+    DisallowHeapAllocation no_gc;
+    Vector<const Char> uri_chars = uri->GetCharVector<Char>();
+    DecodedUriWriter<Char, uint8_t> writer(result->GetChars());
+    CHECK(DecodeUriChars(uri_chars, is_uri, &writer));
+    return result;
   }
 
   Handle<SeqTwoByteString> result;
   ASSIGN_RETURN_ON_EXCEPTION(
-      isolate, result, isolate->factory()->NewRawTwoByteString(
-                           one_byte_buffer.length() + two_byte_buffer.length()),
-      String);
+      isolate, result,
+      isolate->factory()->NewRawTwoByteString(measure.length()), String);
+  DisallowHeapAllocation no_gc;
+  Vector<const Char> uri_chars = uri->GetCharVector<Char>();
+  DecodedUriWriter<Char, uc16> writer(result->GetChars());
+  CHECK(DecodeUriChars(uri_chars, is_uri, &writer));
+  return result;
+}
 
-  CopyChars(result->GetChars(), one_byte_buffer.ToConstVector().start(),
-            one_byte_buffer.length());
-  CopyChars(result->GetChars() + one_byte_buffer.length(),
-            two_byte_buffer.ToConstVector().start(), two_byte_buffer.length());
+}  // anonymous namespace
 
-  return result;
+MaybeHandle<String> Uri::Decode(Isolate* isolate, Handle<String> uri,
+                                bool is_uri) {
+  uri = String::Flatten(uri);
+  return uri->IsOneByteRepresentationUnderneath()
+             ? DecodePrivate<uint8_t>(isolate, uri, is_uri)
+             : DecodePrivate<uc16>(isolate, uri, is_uri);
 }
 
 namespace {  // anonymous namespace for EncodeURI helper functions
-bool IsUnescapePredicateInUriComponent(uc16 c) {
-  if (IsAlphaNumeric(c)) {
-    return true;
-  }
+const uint8_t kUnescapedInUriComponent = 1 << 0;
+const uint8_t kUnescapedInUri = 1 << 1;
+
+// For each character below 0x80, whether encodeURIComponent and encodeURI
+// leave it unescaped. encodeURI additionally leaves the URI separators
+// #$&+,/:;=?@ unescaped.
+const uint8_t kUnescapedFlags[128] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 2, 2, 0, 2, 3, 3, 3, 3, 2, 2, 3, 3, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 0, 2, 0, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3,
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 0,
+};
 
-  switch (c) {
-    case '!':
-    case '\'':
-    case '(':
-    case ')':
-    case '*':
-    case '-':
-    case '.':
-    case '_':
-    case '~':
-      return true;
-    default:
-      return false;
-  }
+template <typename Char>
+bool IsUnescaped(Char c, uint8_t mask) {
+  return c < arraysize(kUnescapedFlags) && (kUnescapedFlags[c] & mask) != 0;
 }
 
-bool IsUriSeparator(uc16 c) {
-  switch (c) {
-    case '#':
-    case ':':
-    case ';':
-    case '/':
-    case '?':
-    case '$':
-    case '&':
-    case '+':
-    case ',':
-    case '@':
-    case '=':
-      return true;
-    default:
-      return false;
-  }
+// Returns the end of the run of characters starting at {start} that are left
+// unescaped.
+template <typename Char>
+int UnescapedRunEnd(Vector<const Char> uri, int start, uint8_t mask) {
+  int end = start;
+  while (end < uri.length() && IsUnescaped(uri[end], mask)) end++;
+  return end;
 }
 
-void AddEncodedOctetToBuffer(uint8_t octet, List<uint8_t>* buffer) {
-  buffer->Add('%');
-  buffer->Add(HexCharOfValue(octet >> 4));
-  buffer->Add(HexCharOfValue(octet & 0x0F));
+uint8_t* AddEncodedOctet(uint8_t octet, uint8_t* dest) {
+  dest[0] = '%';
+  dest[1] = HexCharOfValue(octet >> 4);
+  dest[2] = HexCharOfValue(octet & 0x0F);
+  return dest + 3;
 }
 
-void EncodeSingle(uc16 c, List<uint8_t>* buffer) {
+uint8_t* AddEncodedChar(uc32 c, uint8_t* dest) {
   char s[4] = {};
-  int number_of_bytes;
-  number_of_bytes =
+  int number_of_bytes =
       unibrow::Utf8::Encode(s, c, unibrow::Utf16::kNoPreviousCharacter, false);
   for (int k = 0; k < number_of_bytes; k++) {
-    AddEncodedOctetToBuffer(s[k], buffer);
+    dest = AddEncodedOctet(static_cast<uint8_t>(s[k]), dest);
   }
+  return dest;
 }
 
-void EncodePair(uc16 cc1, uc16 cc2, List<uint8_t>* buffer) {
-  char s[4] = {};
-  int number_of_bytes =
-      unibrow::Utf8::Encode(s, unibrow::Utf16::CombineSurrogatePair(cc1, cc2),
-                            unibrow::Utf16::kNoPreviousCharacter, false);
-  for (int k = 0; k < number_of_bytes; k++) {
-    AddEncodedOctetToBuffer(s[k], buffer);
+// Encodes {uri} into {dest} if it is not null, and returns the length of the
+// result, or -1 if {uri} contains a lone surrogate. Lengths beyond
+// String::kMaxLength are clamped to String::kMaxLength + 1. Runs of characters
+// that are left unescaped are copied in bulk.
+template <typename Char>
+int EncodeUriChars(Vector<const Char> uri, bool is_uri, uint8_t* dest) {
+  uint8_t mask = is_uri ? kUnescapedInUri : kUnescapedInUriComponent;
+  int uri_length = uri.length();
+  int encoded_length = 0;
+  int k = 0;
+  while (k < uri_length) {
+    int run_end = UnescapedRunEnd(uri, k, mask);
+    int run_length = run_end - k;
+    if (dest != nullptr) {
+      CopyChars(dest, uri.start() + k, run_length);
+      dest += run_length;
+    }
+    encoded_length += run_length;
+    k = run_end;
+    if (k == uri_length) break;
+
+    uc16 cc1 = uri[k];
+    uc32 c;
+    if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
+      if (k + 1 == uri_length ||
+          !unibrow::Utf16::IsTrailSurrogate(uri[k + 1])) {
+        return -1;
+      }
+      c = unibrow::Utf16::CombineSurrogatePair(cc1, uri[k + 1]);
+      k += 2;
+    } else if (unibrow::Utf16::IsTrailSurrogate(cc1)) {
+      return -1;
+    } else {
+      c = cc1;
+      k++;
+    }
+    encoded_length +=
+        3 * unibrow::Utf8::Length(c, unibrow::Utf16::kNoPreviousCharacter);
+    if (dest != nullptr) dest = AddEncodedChar(c, dest);
+    encoded_length = Min(encoded_length, String::kMaxLength + 1);
   }
+  return encoded_length;
+}
+
+template <typename Char>
+MaybeHandle<String> EncodePrivate(Isolate* isolate, Handle<String> uri,
+                                  bool is_uri) {
+  int encoded_length;
+  {
+    DisallowHeapAllocation no_gc;
+    encoded_length =
+        EncodeUriChars(uri->GetCharVector<Char>(), is_uri, nullptr);
+  }
+  if (encoded_length < 0) THROW_NEW_ERROR(isolate, NewURIError(), String);
+
+  // Without characters to escape the result is equal to {uri}.
+  if (encoded_length == uri->length()) return uri;
+
+  Handle<SeqOneByteString> result;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, result, isolate->factory()->NewRawOneByteString(encoded_length),
+      String);
+  DisallowHeapAllocation no_gc;
+  EncodeUriChars(uri->GetCharVector<Char>(), is_uri, result->GetChars());
+  return result;
 }
 
 }  // anonymous namespace
@@ -271,40 +346,9 @@ void EncodePair(uc16 cc1, uc16 cc2, List<uint8_t>* buffer) {
 MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
                                 bool is_uri) {
   uri = String::Flatten(uri);
-  int uri_length = uri->length();
-  List<uint8_t> buffer(uri_length);
-
-  {
-    DisallowHeapAllocation no_gc;
-    String::FlatContent uri_content = uri->GetFlatContent();
-
-    for (int k = 0; k < uri_length; k++) {
-      uc16 cc1 = uri_content.Get(k);
-      if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
-        k++;
-        if (k < uri_length) {
-          uc16 cc2 = uri->Get(k);
-          if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
-            EncodePair(cc1, cc2, &buffer);
-            continue;
-          }
-        }
-      } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
-        if (IsUnescapePredicateInUriComponent(cc1) ||
-            (is_uri && IsUriSeparator(cc1))) {
-          buffer.Add(cc1);
-        } else {
-          EncodeSingle(cc1, &buffer);
-        }
-        continue;
-      }
-
-      AllowHeapAllocation allocate_error_and_return;
-      THROW_NEW_ERROR(isolate, NewURIError(), String);
-    }
-  }
-
-  return isolate->factory()->NewStringFromOneByte(buffer.ToConstVector());
+  return uri->IsOneByteRepresentationUnderneath()
+             ? EncodePrivate<uint8_t>(isolate, uri, is_uri)
+             : EncodePrivate<uc16>(isolate, uri, is_uri);
 }
 
 namespace {  // Anonymous namespace for Escape and Unescape
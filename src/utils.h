@@ -659,6 +659,19 @@ inline int CompareCharsUnsigned(const lchar* lhs, const rchar* rhs,
     // strings on little-endian systems.
     return memcmp(lhs, rhs, chars);
   }
+  if (sizeof(*lhs) == sizeof(*rhs)) {
+    // Skip the common prefix a word at a time.
+    const size_t kCharsPerWord = sizeof(uintptr_t) / sizeof(*lhs);
+    while (lhs + kCharsPerWord <= limit) {
+      uintptr_t lhs_word;
+      uintptr_t rhs_word;
+      memcpy(&lhs_word, lhs, sizeof(lhs_word));
+      memcpy(&rhs_word, rhs, sizeof(rhs_word));
+      if (lhs_word != rhs_word) break;
+      lhs += kCharsPerWord;
+      rhs += kCharsPerWord;
+    }
+  }
   while (lhs < limit) {
     int r = static_cast<int>(*lhs) - static_cast<int>(*rhs);
     if (r != 0) return r;
@@ -1074,6 +1087,26 @@ inline void CopyWords(T* dst, const T* src, size_t num_words) {
   // enough to justify the extra call/setup overhead.
   static const size_t kBlockCopyLimit = 16;
 
+  // Most objects moved by the GC are only a few words long. Copies of a
+  // constant size are expanded inline into a handful of wide moves.
+  switch (num_words) {
+#define COPY_WORDS_CASE(n)              \
+  case n:                               \
+    memcpy(dst, src, n * kPointerSize); \
+    return;
+    COPY_WORDS_CASE(1)
+    COPY_WORDS_CASE(2)
+    COPY_WORDS_CASE(3)
+    COPY_WORDS_CASE(4)
+    COPY_WORDS_CASE(5)
+    COPY_WORDS_CASE(6)
+    COPY_WORDS_CASE(7)
+    COPY_WORDS_CASE(8)
+#undef COPY_WORDS_CASE
+    default:
+      break;
+  }
+
   if (num_words < kBlockCopyLimit) {
     do {
       num_words--;
@@ -1096,7 +1129,7 @@ inline void MoveWords(T* dst, const T* src, size_t num_words) {
   static const size_t kBlockCopyLimit = 16;
 
   if (num_words < kBlockCopyLimit &&
-      ((dst < src) || (dst >= (src + num_words * kPointerSize)))) {
+      ((dst < src) || (dst >= src + num_words))) {
     T* end = dst + num_words;
     do {
       num_words--;
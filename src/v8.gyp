@@ -207,6 +207,7 @@
         'builtins/builtins-object-gen.cc',
         'builtins/builtins-promise-gen.cc',
         'builtins/builtins-promise-gen.h',
+        'builtins/builtins-proxy-gen.cc',
         'builtins/builtins-regexp-gen.cc',
         'builtins/builtins-regexp-gen.h',
         'builtins/builtins-sharedarraybuffer-gen.cc',
@@ -1058,6 +1059,8 @@
         'handles.cc',
         'handles.h',
         'heap-symbols.h',
+        'heap/array-buffer-collector.cc',
+        'heap/array-buffer-collector.h',
         'heap/array-buffer-tracker-inl.h',
         'heap/array-buffer-tracker.cc',
         'heap/array-buffer-tracker.h',
@@ -1093,6 +1096,8 @@
         'heap/objects-visiting-inl.h',
         'heap/objects-visiting.cc',
         'heap/objects-visiting.h',
+        'heap/pretenuring-decisions.cc',
+        'heap/pretenuring-decisions.h',
         'heap/remembered-set.h',
         'heap/scavenge-job.h',
         'heap/scavenge-job.cc',
@@ -1288,6 +1293,8 @@
         'pending-compilation-error-handler.h',
         'perf-jit.cc',
         'perf-jit.h',
+        'pooling-array-buffer-allocator.cc',
+        'pooling-array-buffer-allocator.h',
         'profiler/allocation-tracker.cc',
         'profiler/allocation-tracker.h',
         'profiler/circular-queue-inl.h',
@@ -1336,6 +1343,8 @@
         'regexp/regexp-macro-assembler-tracer.h',
         'regexp/regexp-macro-assembler.cc',
         'regexp/regexp-macro-assembler.h',
+        'regexp/regexp-nfa-matcher.cc',
+        'regexp/regexp-nfa-matcher.h',
         'regexp/regexp-parser.cc',
         'regexp/regexp-parser.h',
         'regexp/regexp-stack.cc',
@@ -1380,12 +1389,18 @@
         'runtime/runtime-wasm.cc',
         'runtime/runtime.cc',
         'runtime/runtime.h',
+        'ryu-dtoa.cc',
+        'ryu-dtoa.h',
         'safepoint-table.cc',
         'safepoint-table.h',
         'setup-isolate.h',
         'signature.h',
         'simulator.h',
         'small-pointer-list.h',
+        'snapshot/builtin-serializer.cc',
+        'snapshot/builtin-serializer.h',
+        'snapshot/code-cache-directory.cc',
+        'snapshot/code-cache-directory.h',
         'snapshot/code-serializer.cc',
         'snapshot/code-serializer.h',
         'snapshot/deserializer.cc',
@@ -1400,6 +1415,8 @@
         'snapshot/serializer-common.h',
         'snapshot/snapshot.h',
         'snapshot/snapshot-common.cc',
+        'snapshot/snapshot-compression.cc',
+        'snapshot/snapshot-compression.h',
         'snapshot/snapshot-source-sink.cc',
         'snapshot/snapshot-source-sink.h',
         'snapshot/startup-serializer.cc',
@@ -1505,6 +1522,8 @@
         'wasm/wasm-result.h',
         'wasm/wasm-text.cc',
         'wasm/wasm-text.h',
+        'wasm/wrapper-cache.cc',
+        'wasm/wrapper-cache.h',
         'zone/accounting-allocator.cc',
         'zone/accounting-allocator.h',
         'zone/zone-segment.cc',
@@ -2301,6 +2320,8 @@
         '../include/libplatform/v8-tracing.h',
         'libplatform/default-platform.cc',
         'libplatform/default-platform.h',
+        'libplatform/delayed-task-queue.cc',
+        'libplatform/delayed-task-queue.h',
         'libplatform/task-queue.cc',
         'libplatform/task-queue.h',
         'libplatform/tracing/trace-buffer.cc',
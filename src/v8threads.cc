@@ -38,9 +38,14 @@ void Locker::Initialize(v8::Isolate* isolate) {
     isolate_->thread_manager()->Lock();
     has_lock_ = true;
 
-    // This may be a locker within an unlocker in which case we have to
-    // get the saved state for this thread and restore it.
-    if (isolate_->thread_manager()->RestoreThread()) {
+    if (isolate_->thread_manager()->ReacquiredByLastThread()) {
+      // Nothing ran in the isolate since this thread released it, so there is
+      // no archived state and the stack limits are still the right ones.
+      internal::ExecutionAccess access(isolate_);
+      isolate_->stack_guard()->ResetThread(access);
+    } else if (isolate_->thread_manager()->RestoreThread()) {
+      // This may be a locker within an unlocker in which case we have to
+      // get the saved state for this thread and restore it.
       top_level_ = false;
     } else {
       internal::ExecutionAccess access(isolate_);
@@ -98,6 +103,7 @@ namespace internal {
 
 bool ThreadManager::RestoreThread() {
   DCHECK(IsLockedByCurrentThread());
+  last_released_thread_ = ThreadId::Invalid();
   // First check whether the current thread has been 'lazily archived', i.e.
   // not archived at all.  If that is the case we put the state storage we
   // had prepared back in the free list, since we didn't need it after all.
@@ -164,6 +170,15 @@ void ThreadManager::Unlock() {
 }
 
 
+bool ThreadManager::ReacquiredByLastThread() {
+  DCHECK(IsLockedByCurrentThread());
+  bool result = last_released_thread_.Equals(ThreadId::Current());
+  last_released_thread_ = ThreadId::Invalid();
+  DCHECK(!result || (!lazily_archived_thread_.IsValid() && !IsArchived()));
+  return result;
+}
+
+
 static int ArchiveSpacePerThread() {
   return HandleScopeImplementer::ArchiveSpacePerThread() +
                         Isolate::ArchiveSpacePerThread() +
@@ -242,6 +257,7 @@ ThreadManager::ThreadManager()
     : mutex_owner_(ThreadId::Invalid()),
       lazily_archived_thread_(ThreadId::Invalid()),
       lazily_archived_thread_state_(NULL),
+      last_released_thread_(ThreadId::Invalid()),
       free_anchor_(NULL),
       in_use_anchor_(NULL) {
   free_anchor_ = new ThreadState(this);
@@ -270,6 +286,7 @@ void ThreadManager::ArchiveThread() {
   DCHECK(lazily_archived_thread_.Equals(ThreadId::Invalid()));
   DCHECK(!IsArchived());
   DCHECK(IsLockedByCurrentThread());
+  last_released_thread_ = ThreadId::Invalid();
   ThreadState* state = GetFreeThreadState();
   state->Unlink();
   Isolate::PerIsolateThreadData* per_thread =
@@ -312,6 +329,7 @@ void ThreadManager::FreeThreadResources() {
   isolate_->stack_guard()->FreeThreadResources();
   isolate_->regexp_stack()->FreeThreadResources();
   isolate_->bootstrapper()->FreeThreadResources();
+  last_released_thread_ = ThreadId::Current();
 }
 
 
@@ -72,6 +72,11 @@ class ThreadManager {
   void FreeThreadResources();
   bool IsArchived();
 
+  // Returns true if the current thread was the last one to hold the lock and
+  // released it by freeing its resources, i.e. its stack limits are still
+  // installed. Must be called right after acquiring the lock.
+  bool ReacquiredByLastThread();
+
   void Iterate(RootVisitor* v);
   void IterateArchivedThreads(ThreadVisitor* v);
   bool IsLockedByCurrentThread() {
@@ -98,6 +103,7 @@ class ThreadManager {
   ThreadId mutex_owner_;
   ThreadId lazily_archived_thread_;
   ThreadState* lazily_archived_thread_state_;
+  ThreadId last_released_thread_;
 
   // In the following two lists there is always at least one object on the list.
   // The first object is a flying anchor that is only there to simplify linking
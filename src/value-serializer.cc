@@ -44,6 +44,9 @@ static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
 
 static const int kPretenureThreshold = 100 * KB;
 
+// Minimum amount of input requested from the delegate at a time.
+static const size_t kStreamingChunkSize = 64 * KB;
+
 template <typename T>
 static size_t BytesNeededForVarint(T value) {
   static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
@@ -122,6 +125,11 @@ enum class SerializationTag : uint8_t {
   kArrayBuffer = 'B',
   // Array buffer (transferred). transferID:uint32_t
   kArrayBufferTransfer = 't',
+  // Array buffer with contents held by the delegate.
+  // byteLength:uint32_t, id:uint32_t
+  kOutOfBandArrayBuffer = 'E',
+  // String with characters held by the delegate. id:uint32_t
+  kOutOfBandString = 'e',
   // View into an array buffer.
   // subtag:ArrayBufferViewTag, byteOffset:uint32_t, byteLength:uint32_t
   // For typed arrays, byteOffset and byteLength must be divisible by the size
@@ -193,6 +201,14 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetOutOfBandThreshold(size_t threshold) {
+  out_of_band_threshold_ = threshold;
+}
+
+void ValueSerializer::SetChunkSize(size_t chunk_size) {
+  chunk_size_ = chunk_size;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -290,6 +306,20 @@ Maybe<bool> ValueSerializer::ExpandBuffer(size_t required_capacity) {
   }
 }
 
+Maybe<bool> ValueSerializer::WriteChunk(Handle<Object> object) {
+  DCHECK_NOT_NULL(delegate_);
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  bool ok;
+  if (!delegate_->WriteChunk(v8_isolate, buffer_, buffer_size_).To(&ok)) {
+    RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+    ThrowDataCloneError(MessageTemplate::kDataCloneError, object);
+    return Nothing<bool>();
+  }
+  chunked_size_ += buffer_size_;
+  buffer_size_ = 0;
+  return Just(true);
+}
+
 void ValueSerializer::WriteUint32(uint32_t value) {
   WriteVarint<uint32_t>(value);
 }
@@ -319,6 +349,11 @@ void ValueSerializer::TransferArrayBuffer(uint32_t transfer_id,
 
 Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
   out_of_memory_ = false;
+  // Chunks end between values, where nothing refers into the buffer.
+  if (V8_UNLIKELY(chunk_size_ && buffer_size_ >= chunk_size_) &&
+      !WriteChunk(object).FromMaybe(false)) {
+    return Nothing<bool>();
+  }
   if (object->IsSmi()) {
     WriteSmi(Smi::cast(*object));
     return ThrowIfOutOfMemory();
@@ -403,13 +438,16 @@ void ValueSerializer::WriteString(Handle<String> string) {
   DCHECK(flat.IsFlat());
   if (flat.IsOneByte()) {
     Vector<const uint8_t> chars = flat.ToOneByteVector();
+    if (WriteOutOfBandString(chars.start(), chars.length(), true)) return;
     WriteTag(SerializationTag::kOneByteString);
     WriteOneByteString(chars);
   } else if (flat.IsTwoByte()) {
     Vector<const uc16> chars = flat.ToUC16Vector();
+    if (WriteOutOfBandString(chars.start(), chars.length(), false)) return;
     uint32_t byte_length = chars.length() * sizeof(uc16);
     // The existing reading code expects 16-byte strings to be aligned.
-    if ((buffer_size_ + 1 + BytesNeededForVarint(byte_length)) & 1)
+    size_t offset = chunked_size_ + buffer_size_;
+    if ((offset + 1 + BytesNeededForVarint(byte_length)) & 1)
       WriteTag(SerializationTag::kPadding);
     WriteTag(SerializationTag::kTwoByteString);
     WriteTwoByteString(chars);
@@ -418,6 +456,24 @@ void ValueSerializer::WriteString(Handle<String> string) {
   }
 }
 
+bool ValueSerializer::WriteOutOfBandString(const void* data, size_t length,
+                                           bool is_one_byte) {
+  size_t byte_length = is_one_byte ? length : length * sizeof(uc16);
+  if (!delegate_ || !out_of_band_threshold_ ||
+      byte_length < out_of_band_threshold_) {
+    return false;
+  }
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  uint32_t id;
+  if (!delegate_->GetOutOfBandStringId(v8_isolate, data, length, is_one_byte)
+           .To(&id)) {
+    return false;
+  }
+  WriteTag(SerializationTag::kOutOfBandString);
+  WriteVarint(id);
+  return true;
+}
+
 Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   // If the object has already been serialized, just write its ID.
   uint32_t* id_map_entry = id_map_.Get(receiver);
@@ -506,7 +562,7 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
     if (details.IsDontEnum()) continue;
 
     Handle<Object> value;
-    if (V8_LIKELY(!map_changed)) map_changed = *map == object->map();
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
     if (V8_LIKELY(!map_changed && details.location() == kField)) {
       DCHECK_EQ(kData, details.kind());
       FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
@@ -784,6 +840,20 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
     return Nothing<bool>();
   }
+  if (delegate_ && out_of_band_threshold_ &&
+      byte_length >= out_of_band_threshold_) {
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    uint32_t id;
+    if (delegate_
+            ->GetOutOfBandArrayBufferId(
+                v8_isolate, array_buffer->backing_store(), byte_length)
+            .To(&id)) {
+      WriteTag(SerializationTag::kOutOfBandArrayBuffer);
+      WriteVarint<uint32_t>(byte_length);
+      WriteVarint(id);
+      return ThrowIfOutOfMemory();
+    }
+  }
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(byte_length);
   WriteRawBytes(array_buffer->backing_store(), byte_length);
@@ -945,8 +1015,47 @@ ValueDeserializer::~ValueDeserializer() {
   }
 }
 
+bool ValueDeserializer::ReadMoreData(size_t bytes) {
+  if (delegate_ == nullptr || end_of_input_) return false;
+
+  // Move the input that is still needed to the start of the stream buffer,
+  // and read more after it.
+  const uint8_t* keep = rewind_position_ ? rewind_position_ : position_;
+  size_t size = end_ - keep;
+  size_t offset = position_ - keep;
+  if (bytes > std::numeric_limits<size_t>::max() - offset) return false;
+  size_t required = offset + bytes;
+  if (!stream_buffer_.empty() && keep >= stream_buffer_.data() &&
+      keep <= stream_buffer_.data() + stream_buffer_.size()) {
+    memmove(stream_buffer_.data(), keep, size);
+    stream_buffer_.resize(size);
+  } else {
+    stream_buffer_.assign(keep, end_);
+  }
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  while (size < required) {
+    // Grow the buffer no faster than input arrives, so that a bogus length
+    // cannot make it allocate lots of memory up front.
+    stream_buffer_.resize(
+        std::max(size + kStreamingChunkSize, std::min(required, 2 * size)));
+    size_t read = delegate_->ReadMoreData(v8_isolate, &stream_buffer_[size],
+                                          stream_buffer_.size() - size);
+    DCHECK_LE(read, stream_buffer_.size() - size);
+    if (read == 0) {
+      end_of_input_ = true;
+      break;
+    }
+    size += read;
+  }
+  stream_buffer_.resize(size);
+  if (rewind_position_) rewind_position_ = stream_buffer_.data();
+  position_ = stream_buffer_.data() + offset;
+  end_ = stream_buffer_.data() + size;
+  return size >= required;
+}
+
 Maybe<bool> ValueDeserializer::ReadHeader() {
-  if (position_ < end_ &&
+  if (EnsureAvailable(1) &&
       *position_ == static_cast<uint8_t>(SerializationTag::kVersion)) {
     ReadTag().ToChecked();
     if (!ReadVarint<uint32_t>().To(&version_) || version_ > kLatestVersion) {
@@ -958,13 +1067,13 @@ Maybe<bool> ValueDeserializer::ReadHeader() {
   return Just(true);
 }
 
-Maybe<SerializationTag> ValueDeserializer::PeekTag() const {
-  const uint8_t* peek_position = position_;
+Maybe<SerializationTag> ValueDeserializer::PeekTag() {
+  size_t peek_offset = 0;
   SerializationTag tag;
   do {
-    if (peek_position >= end_) return Nothing<SerializationTag>();
-    tag = static_cast<SerializationTag>(*peek_position);
-    peek_position++;
+    if (!EnsureAvailable(peek_offset + 1)) return Nothing<SerializationTag>();
+    tag = static_cast<SerializationTag>(position_[peek_offset]);
+    peek_offset++;
   } while (tag == SerializationTag::kPadding);
   return Just(tag);
 }
@@ -978,7 +1087,7 @@ void ValueDeserializer::ConsumeTag(SerializationTag peeked_tag) {
 Maybe<SerializationTag> ValueDeserializer::ReadTag() {
   SerializationTag tag;
   do {
-    if (position_ >= end_) return Nothing<SerializationTag>();
+    if (!EnsureAvailable(1)) return Nothing<SerializationTag>();
     tag = static_cast<SerializationTag>(*position_);
     position_++;
   } while (tag == SerializationTag::kPadding);
@@ -998,7 +1107,7 @@ Maybe<T> ValueDeserializer::ReadVarint() {
   unsigned shift = 0;
   bool has_another_byte;
   do {
-    if (position_ >= end_) return Nothing<T>();
+    if (!EnsureAvailable(1)) return Nothing<T>();
     uint8_t byte = *position_;
     if (V8_LIKELY(shift < sizeof(T) * 8)) {
       value |= static_cast<T>(byte & 0x7f) << shift;
@@ -1026,7 +1135,7 @@ Maybe<T> ValueDeserializer::ReadZigZag() {
 
 Maybe<double> ValueDeserializer::ReadDouble() {
   // Warning: this uses host endianness.
-  if (position_ > end_ - sizeof(double)) return Nothing<double>();
+  if (!EnsureAvailable(sizeof(double))) return Nothing<double>();
   double value;
   memcpy(&value, position_, sizeof(double));
   position_ += sizeof(double);
@@ -1035,7 +1144,9 @@ Maybe<double> ValueDeserializer::ReadDouble() {
 }
 
 Maybe<Vector<const uint8_t>> ValueDeserializer::ReadRawBytes(int size) {
-  if (size > end_ - position_) return Nothing<Vector<const uint8_t>>();
+  if (size < 0 || !EnsureAvailable(size)) {
+    return Nothing<Vector<const uint8_t>>();
+  }
   const uint8_t* start = position_;
   position_ += size;
   return Just(Vector<const uint8_t>(start, size));
@@ -1054,7 +1165,7 @@ bool ValueDeserializer::ReadDouble(double* value) {
 }
 
 bool ValueDeserializer::ReadRawBytes(size_t length, const void** data) {
-  if (length > static_cast<size_t>(end_ - position_)) return false;
+  if (!EnsureAvailable(length)) return false;
   *data = position_;
   position_ += length;
   return true;
@@ -1184,6 +1295,16 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
         position_--;
         return ReadHostObject();
       }
+      // Out-of-band data is only written when the embedder opts in, and can
+      // only be read back by a delegate that understands it, so these tags
+      // did not need a new version. They are checked after the fallback
+      // above so that older data keeps handing them to the host.
+      if (tag == SerializationTag::kOutOfBandArrayBuffer) {
+        return ReadOutOfBandJSArrayBuffer();
+      }
+      if (tag == SerializationTag::kOutOfBandString) {
+        return ReadOutOfBandString();
+      }
       return MaybeHandle<Object>();
   }
 }
@@ -1249,17 +1370,35 @@ MaybeHandle<String> ValueDeserializer::ReadTwoByteString() {
   return string;
 }
 
+MaybeHandle<String> ValueDeserializer::ReadOutOfBandString() {
+  uint32_t id;
+  v8::Local<v8::String> string;
+  if (!ReadVarint<uint32_t>().To(&id) || delegate_ == nullptr ||
+      !delegate_->GetOutOfBandString(reinterpret_cast<v8::Isolate*>(isolate_),
+                                     id)
+           .ToLocal(&string)) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, String);
+    return MaybeHandle<String>();
+  }
+  return Utils::OpenHandle(*string);
+}
+
 bool ValueDeserializer::ReadExpectedString(Handle<String> expected) {
   // In the case of failure, the position in the stream is reset.
-  const uint8_t* original_position = position_;
+  DCHECK_NULL(rewind_position_);
+  rewind_position_ = position_;
 
   SerializationTag tag;
   uint32_t byte_length;
   Vector<const uint8_t> bytes;
-  if (!ReadTag().To(&tag) || !ReadVarint<uint32_t>().To(&byte_length) ||
-      byte_length >
-          static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) ||
-      !ReadRawBytes(byte_length).To(&bytes)) {
+  bool read_string =
+      ReadTag().To(&tag) && ReadVarint<uint32_t>().To(&byte_length) &&
+      byte_length <=
+          static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) &&
+      ReadRawBytes(byte_length).To(&bytes);
+  const uint8_t* original_position = rewind_position_;
+  rewind_position_ = nullptr;
+  if (!read_string) {
     position_ = original_position;
     return false;
   }
@@ -1357,34 +1496,39 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   uint32_t length;
   if (!ReadVarint<uint32_t>().To(&length) ||
       length > static_cast<uint32_t>(FixedArray::kMaxLength) ||
-      length > static_cast<size_t>(end_ - position_)) {
+      !EnsureAvailable(length)) {
     return MaybeHandle<JSArray>();
   }
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSArray> array = isolate_->factory()->NewJSArray(
-      FAST_HOLEY_ELEMENTS, length, length, INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE,
-      pretenure_);
-  AddObjectWithID(id, array);
+  Handle<JSArray> array;
+  if (ReadPackedNumberJSArray(length).ToHandle(&array)) {
+    AddObjectWithID(id, array);
+  } else {
+    array = isolate_->factory()->NewJSArray(
+        FAST_HOLEY_ELEMENTS, length, length,
+        INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE, pretenure_);
+    AddObjectWithID(id, array);
 
-  Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate_);
-  for (uint32_t i = 0; i < length; i++) {
-    SerializationTag tag;
-    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
-      ConsumeTag(SerializationTag::kTheHole);
-      continue;
-    }
+    Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate_);
+    for (uint32_t i = 0; i < length; i++) {
+      SerializationTag tag;
+      if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+        ConsumeTag(SerializationTag::kTheHole);
+        continue;
+      }
 
-    Handle<Object> element;
-    if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
+      Handle<Object> element;
+      if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
 
-    // Serialization versions less than 11 encode the hole the same as
-    // undefined. For consistency with previous behavior, store these as the
-    // hole. Past version 11, undefined means undefined.
-    if (version_ < 11 && element->IsUndefined(isolate_)) continue;
+      // Serialization versions less than 11 encode the hole the same as
+      // undefined. For consistency with previous behavior, store these as the
+      // hole. Past version 11, undefined means undefined.
+      if (version_ < 11 && element->IsUndefined(isolate_)) continue;
 
-    elements->set(i, *element);
+      elements->set(i, *element);
+    }
   }
 
   uint32_t num_properties;
@@ -1402,6 +1546,61 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   return scope.CloseAndEscape(array);
 }
 
+MaybeHandle<JSArray> ValueDeserializer::ReadPackedNumberJSArray(
+    uint32_t length) {
+  if (length == 0) return MaybeHandle<JSArray>();
+
+  // Check that all elements are numbers, and whether they all fit in Smis.
+  DCHECK_NULL(rewind_position_);
+  rewind_position_ = position_;
+  bool all_numbers = true;
+  bool all_smis = true;
+  for (uint32_t i = 0; all_numbers && i < length; i++) {
+    SerializationTag tag;
+    bool is_number = false;
+    if (ReadTag().To(&tag)) {
+      if (tag == SerializationTag::kInt32) {
+        int32_t value;
+        is_number = ReadZigZag<int32_t>().To(&value);
+        if (is_number && !Smi::IsValid(value)) all_smis = false;
+      } else if (tag == SerializationTag::kDouble) {
+        is_number = ReadDouble().IsJust();
+        all_smis = false;
+      }
+    }
+    all_numbers = is_number;
+  }
+  position_ = rewind_position_;
+  rewind_position_ = nullptr;
+  if (!all_numbers) return MaybeHandle<JSArray>();
+
+  // Read the elements again, this time straight into the backing store. All
+  // of them are available by now.
+  Handle<JSArray> array = isolate_->factory()->NewJSArray(
+      all_smis ? FAST_SMI_ELEMENTS : FAST_DOUBLE_ELEMENTS, length, length,
+      DONT_INITIALIZE_ARRAY_ELEMENTS, pretenure_);
+  DisallowHeapAllocation no_gc;
+  if (all_smis) {
+    FixedArray* elements = FixedArray::cast(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      ConsumeTag(SerializationTag::kInt32);
+      elements->set(i, Smi::FromInt(ReadZigZag<int32_t>().FromJust()));
+    }
+  } else {
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      SerializationTag tag = ReadTag().FromJust();
+      if (tag == SerializationTag::kInt32) {
+        elements->set(i, ReadZigZag<int32_t>().FromJust());
+      } else {
+        DCHECK(tag == SerializationTag::kDouble);
+        elements->set(i, ReadDouble().FromJust());
+      }
+    }
+  }
+  return array;
+}
+
 MaybeHandle<JSDate> ValueDeserializer::ReadJSDate() {
   double value;
   if (!ReadDouble().To(&value)) return MaybeHandle<JSDate>();
@@ -1558,7 +1757,7 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadJSArrayBuffer() {
   uint32_t byte_length;
   Vector<const uint8_t> bytes;
   if (!ReadVarint<uint32_t>().To(&byte_length) ||
-      byte_length > static_cast<size_t>(end_ - position_)) {
+      !EnsureAvailable(byte_length)) {
     return MaybeHandle<JSArrayBuffer>();
   }
   const bool should_initialize = false;
@@ -1594,6 +1793,28 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer(
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadOutOfBandJSArrayBuffer() {
+  uint32_t id = next_id_++;
+  uint32_t byte_length;
+  uint32_t data_id;
+  if (!ReadVarint<uint32_t>().To(&byte_length) ||
+      !ReadVarint<uint32_t>().To(&data_id) || delegate_ == nullptr) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  void* data = delegate_->GetOutOfBandArrayBufferData(
+      reinterpret_cast<v8::Isolate*>(isolate_), data_id, byte_length);
+  if (data == nullptr) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, JSArrayBuffer);
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer =
+      isolate_->factory()->NewJSArrayBuffer(SharedFlag::kNotShared, pretenure_);
+  const bool is_external = true;
+  JSArrayBuffer::Setup(array_buffer, isolate_, is_external, data, byte_length);
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     Handle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = NumberToUint32(buffer->byte_length());
@@ -1678,14 +1899,23 @@ MaybeHandle<JSObject> ValueDeserializer::ReadWasmModule() {
   Vector<const uint8_t> wire_bytes;
   uint32_t compiled_bytes_length = 0;
   Vector<const uint8_t> compiled_bytes;
-  if (!ReadVarint<uint32_t>().To(&wire_bytes_length) ||
-      wire_bytes_length > max_valid_size ||
-      !ReadRawBytes(wire_bytes_length).To(&wire_bytes) ||
-      !ReadVarint<uint32_t>().To(&compiled_bytes_length) ||
-      compiled_bytes_length > max_valid_size ||
-      !ReadRawBytes(compiled_bytes_length).To(&compiled_bytes)) {
-    return MaybeHandle<JSObject>();
-  }
+  // Reading the compiled data may move the wire bytes if input is streamed,
+  // so only their offset is kept until then.
+  DCHECK_NULL(rewind_position_);
+  rewind_position_ = position_;
+  bool read_module = false;
+  if (ReadVarint<uint32_t>().To(&wire_bytes_length) &&
+      wire_bytes_length <= max_valid_size &&
+      ReadRawBytes(wire_bytes_length).To(&wire_bytes)) {
+    size_t wire_bytes_offset = wire_bytes.start() - rewind_position_;
+    read_module = ReadVarint<uint32_t>().To(&compiled_bytes_length) &&
+                  compiled_bytes_length <= max_valid_size &&
+                  ReadRawBytes(compiled_bytes_length).To(&compiled_bytes);
+    wire_bytes = Vector<const uint8_t>(rewind_position_ + wire_bytes_offset,
+                                       wire_bytes_length);
+  }
+  rewind_position_ = nullptr;
+  if (!read_module) return MaybeHandle<JSObject>();
 
   // Try to deserialize the compiled module first.
   ScriptData script_data(compiled_bytes.start(), compiled_bytes.length());
@@ -1944,7 +2174,7 @@ ValueDeserializer::ReadObjectUsingEntireBufferForLegacyFormat() {
   DCHECK_EQ(version_, 0u);
   HandleScope scope(isolate_);
   std::vector<Handle<Object>> stack;
-  while (position_ < end_) {
+  while (EnsureAvailable(1)) {
     SerializationTag tag;
     if (!PeekTag().To(&tag)) break;
 
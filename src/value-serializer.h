@@ -94,9 +94,22 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Sets the size in bytes from which ArrayBuffer contents and strings are
+   * offered to the delegate to be written out of band. Zero disables this.
+   */
+  void SetOutOfBandThreshold(size_t threshold);
+
+  /*
+   * Passes the buffer to the delegate once it holds at least |chunk_size|
+   * bytes. Zero keeps everything in the buffer.
+   */
+  void SetChunkSize(size_t chunk_size);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
+  Maybe<bool> WriteChunk(Handle<Object> object) WARN_UNUSED_RESULT;
 
   // Writing the wire format.
   void WriteTag(SerializationTag tag);
@@ -106,6 +119,7 @@ class ValueSerializer {
   void WriteZigZag(T value);
   void WriteOneByteString(Vector<const uint8_t> chars);
   void WriteTwoByteString(Vector<const uc16> chars);
+  bool WriteOutOfBandString(const void* data, size_t length, bool is_one_byte);
   Maybe<uint8_t*> ReserveRawBytes(size_t bytes);
 
   // Writing V8 objects of various kinds.
@@ -149,8 +163,12 @@ class ValueSerializer {
   Isolate* const isolate_;
   v8::ValueSerializer::Delegate* const delegate_;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  size_t out_of_band_threshold_ = 0;
+  size_t chunk_size_ = 0;
   uint8_t* buffer_ = nullptr;
   size_t buffer_size_ = 0;
+  // Number of bytes already passed to the delegate in chunks.
+  size_t chunked_size_ = 0;
   size_t buffer_capacity_ = 0;
   bool out_of_memory_ = false;
   Zone zone_;
@@ -225,7 +243,14 @@ class ValueDeserializer {
 
  private:
   // Reading the wire format.
-  Maybe<SerializationTag> PeekTag() const WARN_UNUSED_RESULT;
+  // Makes sure that at least |bytes| bytes can be read without going past
+  // |end_|, asking the delegate for more input if necessary.
+  bool EnsureAvailable(size_t bytes) {
+    return V8_LIKELY(static_cast<size_t>(end_ - position_) >= bytes) ||
+           ReadMoreData(bytes);
+  }
+  V8_NOINLINE bool ReadMoreData(size_t bytes);
+  Maybe<SerializationTag> PeekTag() WARN_UNUSED_RESULT;
   void ConsumeTag(SerializationTag peeked_tag);
   Maybe<SerializationTag> ReadTag() WARN_UNUSED_RESULT;
   template <typename T>
@@ -254,9 +279,14 @@ class ValueDeserializer {
   MaybeHandle<String> ReadUtf8String() WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadOneByteString() WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadTwoByteString() WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadOutOfBandString() WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() WARN_UNUSED_RESULT;
+  // Reads the elements of a dense array into a packed Smi or double backing
+  // store if they are all numbers. Otherwise, nothing is consumed.
+  MaybeHandle<JSArray> ReadPackedNumberJSArray(uint32_t length)
+      WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() WARN_UNUSED_RESULT;
   MaybeHandle<JSValue> ReadJSValue(SerializationTag tag) WARN_UNUSED_RESULT;
   MaybeHandle<JSRegExp> ReadJSRegExp() WARN_UNUSED_RESULT;
@@ -265,6 +295,7 @@ class ValueDeserializer {
   MaybeHandle<JSArrayBuffer> ReadJSArrayBuffer() WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer(bool is_shared)
       WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadOutOfBandJSArrayBuffer() WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       Handle<JSArrayBuffer> buffer) WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadWasmModule() WARN_UNUSED_RESULT;
@@ -287,7 +318,13 @@ class ValueDeserializer {
   Isolate* const isolate_;
   v8::ValueDeserializer::Delegate* const delegate_;
   const uint8_t* position_;
-  const uint8_t* const end_;
+  const uint8_t* end_;
+  // If set, input from here on is kept when more data is read, and this is
+  // moved along with it. Used to rewind after reading ahead.
+  const uint8_t* rewind_position_ = nullptr;
+  // Holds the input once more has been read from the delegate.
+  std::vector<uint8_t> stream_buffer_;
+  bool end_of_input_ = false;
   PretenureFlag pretenure_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
@@ -8,14 +8,18 @@
 
 #include "src/asmjs/asm-js.h"
 #include "src/assembler-inl.h"
+#include "src/code-stubs.h"
 #include "src/counters.h"
+#include "src/debug/debug.h"
 #include "src/property-descriptor.h"
 #include "src/wasm/compilation-manager.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-js.h"
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/wasm/wasm-result.h"
+#include "src/wasm/wrapper-cache.h"
 
 #define TRACE(...)                                      \
   do {                                                  \
@@ -193,7 +197,7 @@ void ModuleCompiler::RestartCompilationTasks() {
   for (; stopped_compilation_tasks_ > 0; --stopped_compilation_tasks_) {
     V8::GetCurrentPlatform()->CallOnBackgroundThread(
         new CompilationTask(this),
-        v8::Platform::ExpectedRuntime::kShortRunningTask);
+        v8::Platform::ExpectedRuntime::kLongRunningTask);
   }
 }
 
@@ -369,12 +373,77 @@ MaybeHandle<WasmModuleObject> ModuleCompiler::CompileToModuleObject(
       &temp_instance, &function_tables, &signature_tables);
 }
 
+MaybeHandle<WasmModuleObject> ModuleCompiler::CompileToModuleObject(
+    ErrorThrower* thrower, const ModuleWireBytes& wire_bytes,
+    WasmInstance* temp_instance, Handle<FixedArray> function_tables,
+    Handle<FixedArray> signature_tables) {
+  DCHECK_EQ(module_.get(), temp_instance->module);
+  constexpr bool compile_functions = false;
+  return CompileToModuleObjectInternal(
+      thrower, wire_bytes, Handle<Script>(), Vector<const byte>(),
+      isolate_->factory(), temp_instance, &function_tables, &signature_tables,
+      compile_functions);
+}
+
 namespace {
 bool compile_lazy(const WasmModule* module) {
   return FLAG_wasm_lazy_compilation ||
          (FLAG_asm_wasm_lazy_compilation && module->is_asm_js());
 }
 
+// Returns the live instance recorded in the deoptimization data of the wasm
+// function {code}, or nullptr.
+WasmInstanceObject* GetLiveCodeOwner(Code* code) {
+  DisallowHeapAllocation no_gc;
+  FixedArray* deopt_data = code->deoptimization_data();
+  if (deopt_data->length() != 2 || !deopt_data->get(0)->IsWeakCell()) {
+    return nullptr;
+  }
+  WeakCell* cell = WeakCell::cast(deopt_data->get(0));
+  if (cell->cleared()) return nullptr;
+  return WasmInstanceObject::cast(cell->value());
+}
+
+// Adds {owner} to {owners} unless it is already there.
+void AddSharedCodeOwner(std::vector<Handle<WasmInstanceObject>>* owners,
+                        WasmInstanceObject* owner) {
+  DCHECK_NOT_NULL(owner);
+  for (Handle<WasmInstanceObject> known : *owners) {
+    if (*known == owner) return;
+  }
+  owners->push_back(handle(owner));
+}
+
+// Returns whether a new instance in the current native context can use the
+// code of wasm function {func_index} of {compiled_module} without copying it.
+// The code keeps its owner, which the runtime uses for traps, stack checks
+// and stack traces. So it must not be patched per instance, and must not
+// grow or query the owner's memory.
+bool CanShareCode(Isolate* isolate, WasmCompiledModule* compiled_module,
+                  Code* code, int func_index) {
+  DisallowHeapAllocation no_gc;
+  if (!FLAG_wasm_share_code || isolate->debug()->is_active()) return false;
+  WasmInstanceObject* owner = GetLiveCodeOwner(code);
+  if (owner == nullptr) return false;
+  if (owner->compiled_module()->ptr_to_native_context() !=
+      *isolate->native_context()) {
+    return false;
+  }
+  if (!CodeSpecialization::IsInstanceIndependent(code)) return false;
+  const byte* module_start = compiled_module->module_bytes()->GetChars();
+  const WasmFunction& func = compiled_module->module()->functions[func_index];
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  BodyLocalDecls decls(&zone);
+  for (BytecodeIterator it(module_start + func.code.offset(),
+                           module_start + func.code.end_offset(), &decls);
+       it.has_next(); it.next()) {
+    if (it.current() == kExprGrowMemory || it.current() == kExprMemorySize) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void FlushICache(Isolate* isolate, Handle<FixedArray> code_table) {
   for (int i = 0; i < code_table->length(); ++i) {
     Handle<Code> code = code_table->GetValueChecked<Code>(isolate, i);
@@ -540,10 +609,10 @@ Handle<Code> UnwrapOrCompileImportWrapper(
     imported_instances->Set(imported_instance, imported_instance);
     return UnwrapImportWrapper(target);
   }
-  // No wasm function or being debugged. Compile a new wrapper for the new
-  // signature.
-  return compiler::CompileWasmToJSWrapper(isolate, target, sig, index,
-                                          module_name, import_name, origin);
+  // No wasm function or being debugged. Get a wrapper for the new signature,
+  // which may be shared with other imports of the same callable.
+  return isolate->wasm_wrapper_cache()->GetWasmToJSWrapper(
+      isolate, target, sig, index, module_name, import_name, origin);
 }
 
 double MonotonicallyIncreasingTimeInMs() {
@@ -575,7 +644,8 @@ MaybeHandle<WasmModuleObject> ModuleCompiler::CompileToModuleObjectInternal(
     ErrorThrower* thrower, const ModuleWireBytes& wire_bytes,
     Handle<Script> asm_js_script, Vector<const byte> asm_js_offset_table_bytes,
     Factory* factory, WasmInstance* temp_instance,
-    Handle<FixedArray>* function_tables, Handle<FixedArray>* signature_tables) {
+    Handle<FixedArray>* function_tables, Handle<FixedArray>* signature_tables,
+    bool compile_functions) {
   ModuleBytesEnv module_env(module_.get(), temp_instance, wire_bytes);
 
   // The {code_table} array contains import wrappers and functions (which
@@ -596,7 +666,7 @@ MaybeHandle<WasmModuleObject> ModuleCompiler::CompileToModuleObjectInternal(
                                   : isolate_->builtins()->Illegal();
   for (int i = 0, e = static_cast<int>(module_->functions.size()); i < e; ++i) {
     code_table->set(i, *init_builtin);
-    temp_instance->function_code[i] = init_builtin;
+    if (compile_functions) temp_instance->function_code[i] = init_builtin;
   }
 
   if (is_sync_)
@@ -606,7 +676,10 @@ MaybeHandle<WasmModuleObject> ModuleCompiler::CompileToModuleObjectInternal(
                         : counters()->wasm_functions_per_asm_module())
         ->AddSample(static_cast<int>(module_->functions.size()));
 
-  if (!lazy_compile) {
+  DCHECK_IMPLIES(!compile_functions, !lazy_compile);
+  if (!compile_functions) {
+    // The functions were compiled while the module bytes were streamed.
+  } else if (!lazy_compile) {
     size_t funcs_to_compile =
         module_->functions.size() - module_->num_imported_functions;
     bool compile_parallel =
@@ -693,13 +766,13 @@ MaybeHandle<WasmModuleObject> ModuleCompiler::CompileToModuleObjectInternal(
   }
 
   // Compile JS->wasm wrappers for exported functions.
-  JSToWasmWrapperCache js_to_wasm_cache;
+  WrapperCache* wrapper_cache = isolate_->wasm_wrapper_cache();
   int func_index = 0;
   for (auto exp : module->export_table) {
     if (exp.kind != kExternalFunction) continue;
     Handle<Code> wasm_code = EnsureExportedLazyDeoptData(
         isolate_, Handle<WasmInstanceObject>::null(), code_table, exp.index);
-    Handle<Code> wrapper_code = js_to_wasm_cache.CloneOrCompileJSToWasmWrapper(
+    Handle<Code> wrapper_code = wrapper_cache->GetJSToWasmWrapper(
         isolate_, module, wasm_code, exp.index);
     int export_index = static_cast<int>(module->functions.size() + func_index);
     code_table->set(export_index, *wrapper_code);
@@ -710,38 +783,6 @@ MaybeHandle<WasmModuleObject> ModuleCompiler::CompileToModuleObjectInternal(
   return WasmModuleObject::New(isolate_, compiled_module);
 }
 
-Handle<Code> JSToWasmWrapperCache::CloneOrCompileJSToWasmWrapper(
-    Isolate* isolate, const wasm::WasmModule* module, Handle<Code> wasm_code,
-    uint32_t index) {
-  const wasm::WasmFunction* func = &module->functions[index];
-  int cached_idx = sig_map_.Find(func->sig);
-  if (cached_idx >= 0) {
-    Handle<Code> code = isolate->factory()->CopyCode(code_cache_[cached_idx]);
-    // Now patch the call to wasm code.
-    for (RelocIterator it(*code, RelocInfo::kCodeTargetMask);; it.next()) {
-      DCHECK(!it.done());
-      Code* target =
-          Code::GetCodeFromTargetAddress(it.rinfo()->target_address());
-      if (target->kind() == Code::WASM_FUNCTION ||
-          target->kind() == Code::WASM_TO_JS_FUNCTION ||
-          target->builtin_index() == Builtins::kIllegal ||
-          target->builtin_index() == Builtins::kWasmCompileLazy) {
-        it.rinfo()->set_target_address(isolate, wasm_code->instruction_start());
-        break;
-      }
-    }
-    return code;
-  }
-
-  Handle<Code> code =
-      compiler::CompileJSToWasmWrapper(isolate, module, wasm_code, index);
-  uint32_t new_cache_idx = sig_map_.FindOrInsert(func->sig);
-  DCHECK_EQ(code_cache_.size(), new_cache_idx);
-  USE(new_cache_idx);
-  code_cache_.push_back(code);
-  return code;
-}
-
 InstanceBuilder::InstanceBuilder(
     Isolate* isolate, ErrorThrower* thrower,
     Handle<WasmModuleObject> module_object, MaybeHandle<JSReceiver> ffi,
@@ -782,6 +823,10 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
   // able to relocate.
   Handle<FixedArray> old_code_table;
   MaybeHandle<WasmInstanceObject> owner;
+  // Marks the wasm functions whose code is shared with other instances
+  // (see --wasm-share-code), and holds the owners of that code.
+  std::vector<bool> shared_code;
+  std::vector<Handle<WasmInstanceObject>> shared_code_owners;
 
   TRACE("Starting new module instantiation\n");
   {
@@ -811,6 +856,7 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
       old_code_table = original->code_table();
       compiled_module_ = WasmCompiledModule::Clone(isolate_, original);
       code_table = compiled_module_->code_table();
+      shared_code.resize(code_table->length());
       // Avoid creating too many handles in the outer scope.
       HandleScope scope(isolate_);
 
@@ -834,8 +880,13 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
               code_table->set(i, *code);
             }
             break;
-          case Code::JS_TO_WASM_FUNCTION:
-          case Code::WASM_FUNCTION: {
+          case Code::WASM_FUNCTION:
+            if (CanShareCode(isolate_, *original, *orig_code, i)) {
+              shared_code[i] = true;
+              break;
+            }
+          // Fall through.
+          case Code::JS_TO_WASM_FUNCTION: {
             Handle<Code> code = factory->CopyCode(orig_code);
             code_table->set(i, *code);
             break;
@@ -851,6 +902,22 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
       old_code_table = factory->CopyFixedArray(compiled_module_->code_table());
       code_table = compiled_module_->code_table();
       TRACE("Reusing existing instance %d\n", compiled_module_->instance_id());
+      // The owner of the original may have shared code with instances that
+      // are still alive. That code must keep its current owner.
+      shared_code.resize(code_table->length());
+      for (int i = 0; i < code_table->length(); ++i) {
+        Code* code = Code::cast(code_table->get(i));
+        if (code->kind() != Code::WASM_FUNCTION) continue;
+        if (GetLiveCodeOwner(code) == nullptr) continue;
+        if (CanShareCode(isolate_, *compiled_module_, code, i)) {
+          shared_code[i] = true;
+          // Nothing else may keep the owner alive until it is linked to the
+          // new instance.
+          AddSharedCodeOwner(&shared_code_owners, GetLiveCodeOwner(code));
+        } else {
+          code_table->set(i, *factory->CopyCode(handle(code, isolate_)));
+        }
+      }
     }
     compiled_module_->set_native_context(isolate_->native_context());
   }
@@ -1003,6 +1070,11 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
        i < num_functions; ++i) {
     Handle<Code> code = handle(Code::cast(code_table->get(i)), isolate_);
     if (code->kind() == Code::WASM_FUNCTION) {
+      if (!shared_code.empty() && shared_code[i]) {
+        // Shared code stays with its owner, which this instance keeps alive.
+        AddSharedCodeOwner(&shared_code_owners, GetLiveCodeOwner(*code));
+        continue;
+      }
       Handle<FixedArray> deopt_data = factory->NewFixedArray(2, TENURED);
       deopt_data->set(0, *weak_link);
       deopt_data->set(1, Smi::FromInt(i));
@@ -1021,6 +1093,26 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
       code->deoptimization_data()->set_undefined(isolate_, i);
     }
   }
+  if (!shared_code_owners.empty()) {
+    TRACE("Sharing code of %zu instances\n", shared_code_owners.size());
+    // Like imported instances (see {ProcessImports}), the owners of shared
+    // code are kept alive through the directly called instances.
+    int num_owners = static_cast<int>(shared_code_owners.size());
+    int num_imported = 0;
+    Handle<FixedArray> instances;
+    if (instance->has_directly_called_instances()) {
+      Handle<FixedArray> imported(instance->directly_called_instances(),
+                                  isolate_);
+      num_imported = imported->length();
+      instances = factory->CopyFixedArrayAndGrow(imported, num_owners, TENURED);
+    } else {
+      instances = factory->NewFixedArray(num_owners, TENURED);
+    }
+    for (int i = 0; i < num_owners; ++i) {
+      instances->set(num_imported + i, *shared_code_owners[i]);
+    }
+    instance->set_directly_called_instances(*instances);
+  }
 
   //--------------------------------------------------------------------------
   // Set up the exports object for the new instance.
@@ -1121,8 +1213,9 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
     Handle<Code> startup_code = EnsureExportedLazyDeoptData(
         isolate_, instance, code_table, start_index);
     FunctionSig* sig = module_->functions[start_index].sig;
-    Handle<Code> wrapper_code = js_to_wasm_cache_.CloneOrCompileJSToWasmWrapper(
-        isolate_, module_, startup_code, start_index);
+    Handle<Code> wrapper_code =
+        isolate_->wasm_wrapper_cache()->GetJSToWasmWrapper(
+            isolate_, module_, startup_code, start_index);
     Handle<WasmExportedFunction> startup_fct = WasmExportedFunction::New(
         isolate_, instance, MaybeHandle<String>(), start_index,
         static_cast<int>(sig->parameter_count()), wrapper_code);
@@ -1850,7 +1943,7 @@ void InstanceBuilder::LoadTableSegments(Handle<FixedArray> code_table,
             // at module compile time and cached instead.
 
             Handle<Code> wrapper_code =
-                js_to_wasm_cache_.CloneOrCompileJSToWasmWrapper(
+                isolate_->wasm_wrapper_cache()->GetJSToWasmWrapper(
                     isolate_, module_, wasm_code, func_index);
             MaybeHandle<String> func_name;
             if (module_->is_asm_js()) {
@@ -1895,6 +1988,163 @@ void InstanceBuilder::LoadTableSegments(Handle<FixedArray> code_table,
   }
 }
 
+class StreamingModuleCompiler::CompilationTask : public CancelableTask {
+ public:
+  explicit CompilationTask(StreamingModuleCompiler* compiler)
+      : CancelableTask(&compiler->background_task_manager_),
+        compiler_(compiler) {}
+
+  void RunInternal() override {
+    constexpr bool on_background = true;
+    while (compiler_->ExecuteNextUnit(on_background)) {
+    }
+  }
+
+ private:
+  StreamingModuleCompiler* compiler_;
+};
+
+StreamingModuleCompiler::StreamingModuleCompiler(Isolate* isolate,
+                                                 const WasmModule* module)
+    : isolate_(isolate),
+      module_(module),
+      temp_instance_(new WasmInstance(module)),
+      stopped_tasks_(
+          FLAG_trace_wasm_decoder
+              ? 0
+              : Min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+                    V8::GetCurrentPlatform()
+                        ->NumberOfAvailableBackgroundThreads())) {
+  DCHECK(CanCompileWhileStreaming(isolate, module));
+  HandleScope scope(isolate);
+  // The compiled code embeds the placeholders created here, so the handles
+  // have to survive until {Finish}.
+  DeferredHandleScope deferred(isolate);
+  Factory* factory = isolate->factory();
+  temp_instance_->context = isolate->native_context();
+  temp_instance_->mem_size = WasmModule::kPageSize * module->min_mem_pages;
+  temp_instance_->mem_start = nullptr;
+  temp_instance_->globals_start = nullptr;
+
+  // Initialize the indirect tables with placeholders.
+  int function_table_count = static_cast<int>(module->function_tables.size());
+  function_tables_ = factory->NewFixedArray(function_table_count, TENURED);
+  signature_tables_ = factory->NewFixedArray(function_table_count, TENURED);
+  for (int i = 0; i < function_table_count; ++i) {
+    temp_instance_->function_tables[i] = factory->NewFixedArray(1, TENURED);
+    temp_instance_->signature_tables[i] = factory->NewFixedArray(1, TENURED);
+    function_tables_->set(i, *temp_instance_->function_tables[i]);
+    signature_tables_->set(i, *temp_instance_->signature_tables[i]);
+  }
+
+  // All call sites will be patched at instantiation.
+  Handle<Code> illegal_builtin = isolate->builtins()->Illegal();
+  for (auto& code : temp_instance_->function_code) code = illegal_builtin;
+
+  // Every compilation unit would otherwise need its own deferred handle for
+  // the stub.
+  centry_stub_ = CEntryStub(isolate, 1).GetCode();
+  deferred_handles_.push_back(deferred.Detach());
+
+  module_env_.reset(new ModuleEnv(module, temp_instance_.get()));
+}
+
+StreamingModuleCompiler::~StreamingModuleCompiler() {
+  background_task_manager_.CancelAndWait();
+  for (auto d : deferred_handles_) delete d;
+}
+
+// static
+bool StreamingModuleCompiler::CanCompileWhileStreaming(
+    Isolate* isolate, const WasmModule* module) {
+  HandleScope scope(isolate);
+  return module->is_wasm() && !compile_lazy(module) &&
+         IsWasmCodegenAllowed(isolate, isolate->native_context());
+}
+
+void StreamingModuleCompiler::CompileFunction(uint32_t func_index,
+                                              FunctionBody body) {
+  DCHECK_LT(func_index, module_->functions.size());
+  if (func_index < static_cast<uint32_t>(FLAG_skip_compiling_wasm_funcs)) {
+    return;
+  }
+  HandleScope scope(isolate_);
+  std::unique_ptr<compiler::WasmCompilationUnit> unit(
+      new compiler::WasmCompilationUnit(isolate_, module_env_.get(), body,
+                                        WasmName(),
+                                        static_cast<int>(func_index)));
+  unit->set_centry_stub(centry_stub_);
+
+  bool start_task = false;
+  {
+    base::LockGuard<base::Mutex> guard(&units_mutex_);
+    pending_units_.push_back(std::move(unit));
+    if (stopped_tasks_ > 0) {
+      --stopped_tasks_;
+      start_task = true;
+    }
+  }
+  if (start_task) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new CompilationTask(this), v8::Platform::kLongRunningTask);
+  }
+}
+
+bool StreamingModuleCompiler::ExecuteNextUnit(bool on_background) {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+  DisallowCodeDependencyChange no_dependency_change;
+
+  std::unique_ptr<compiler::WasmCompilationUnit> unit;
+  {
+    base::LockGuard<base::Mutex> guard(&units_mutex_);
+    if (pending_units_.empty()) {
+      // The task gets restarted by {CompileFunction} once there is new work.
+      if (on_background) ++stopped_tasks_;
+      return false;
+    }
+    unit = std::move(pending_units_.front());
+    pending_units_.pop_front();
+  }
+  unit->ExecuteCompilation();
+  {
+    base::LockGuard<base::Mutex> guard(&units_mutex_);
+    executed_units_.push_back(std::move(unit));
+  }
+  return true;
+}
+
+MaybeHandle<WasmModuleObject> StreamingModuleCompiler::Finish(
+    ErrorThrower* thrower, std::unique_ptr<WasmModule> module,
+    const ModuleWireBytes& wire_bytes) {
+  DCHECK_EQ(module_, module.get());
+  // Execute the units which no background task picked up yet on the main
+  // thread, then wait for the background tasks to finish the rest.
+  constexpr bool on_background = false;
+  while (ExecuteNextUnit(on_background)) {
+  }
+  background_task_manager_.CancelAndWait();
+
+  for (auto& unit : executed_units_) {
+    int func_index = unit->func_index();
+    Handle<Code> code = unit->FinishCompilation(thrower);
+    if (code.is_null()) {
+      if (!thrower->error()) {
+        thrower->CompileError("Compilation of #%d failed.", func_index);
+      }
+      return {};
+    }
+    temp_instance_->function_code[func_index] = code;
+  }
+  executed_units_.clear();
+
+  constexpr bool is_sync = true;
+  ModuleCompiler helper(isolate_, std::move(module), is_sync);
+  return helper.CompileToModuleObject(thrower, wire_bytes, temp_instance_.get(),
+                                      function_tables_, signature_tables_);
+}
+
 AsyncCompileJob::AsyncCompileJob(Isolate* isolate,
                                  std::unique_ptr<byte[]> bytes_copy,
                                  size_t length, Handle<Context> context,
@@ -2005,7 +2255,7 @@ void AsyncCompileJob::DoSync(Args&&... args) {
 
 void AsyncCompileJob::StartBackgroundTask() {
   V8::GetCurrentPlatform()->CallOnBackgroundThread(
-      new CompileTask(this, false), v8::Platform::kShortRunningTask);
+      new CompileTask(this, false), v8::Platform::kLongRunningTask);
 }
 
 template <typename State, typename... Args>
@@ -2337,16 +2587,15 @@ class AsyncCompileJob::CompileWrappers : public CompileStep {
     TRACE_COMPILE("(6) Compile wrappers...\n");
     // Compile JS->wasm wrappers for exported functions.
     HandleScope scope(job_->isolate_);
-    JSToWasmWrapperCache js_to_wasm_cache;
+    WrapperCache* wrapper_cache = job_->isolate_->wasm_wrapper_cache();
     int func_index = 0;
     WasmModule* module = job_->compiled_module_->module();
     for (auto exp : module->export_table) {
       if (exp.kind != kExternalFunction) continue;
       Handle<Code> wasm_code(Code::cast(job_->code_table_->get(exp.index)),
                              job_->isolate_);
-      Handle<Code> wrapper_code =
-          js_to_wasm_cache.CloneOrCompileJSToWasmWrapper(job_->isolate_, module,
-                                                         wasm_code, exp.index);
+      Handle<Code> wrapper_code = wrapper_cache->GetJSToWasmWrapper(
+          job_->isolate_, module, wasm_code, exp.index);
       int export_index =
           static_cast<int>(module->functions.size() + func_index);
       job_->code_table_->set(export_index, *wrapper_code);
@@ -5,6 +5,7 @@
 #ifndef V8_WASM_MODULE_COMPILER_H_
 #define V8_WASM_MODULE_COMPILER_H_
 
+#include <deque>
 #include <functional>
 
 #include "src/base/atomic-utils.h"
@@ -129,29 +130,73 @@ class ModuleCompiler {
       Handle<Script> asm_js_script,
       Vector<const byte> asm_js_offset_table_bytes);
 
+  // Creates the module object for a module whose functions were already
+  // compiled into {temp_instance}, see {StreamingModuleCompiler}.
+  MaybeHandle<WasmModuleObject> CompileToModuleObject(
+      ErrorThrower* thrower, const ModuleWireBytes& wire_bytes,
+      WasmInstance* temp_instance, Handle<FixedArray> function_tables,
+      Handle<FixedArray> signature_tables);
+
  private:
   MaybeHandle<WasmModuleObject> CompileToModuleObjectInternal(
       ErrorThrower* thrower, const ModuleWireBytes& wire_bytes,
       Handle<Script> asm_js_script,
       Vector<const byte> asm_js_offset_table_bytes, Factory* factory,
       WasmInstance* temp_instance, Handle<FixedArray>* function_tables,
-      Handle<FixedArray>* signature_tables);
+      Handle<FixedArray>* signature_tables, bool compile_functions = true);
 
   size_t stopped_compilation_tasks_ = 0;
   base::Mutex tasks_mutex_;
 };
 
-class JSToWasmWrapperCache {
+// Compiles the functions of a module while the rest of the module is still
+// being received by the {StreamingDecoder}. The compiler is created once all
+// sections before the code section are decoded, each function body is then
+// compiled on a background thread as soon as its bytes are available. The
+// results are finished on the main thread once the module is complete.
+class StreamingModuleCompiler {
  public:
-  Handle<Code> CloneOrCompileJSToWasmWrapper(Isolate* isolate,
-                                             const wasm::WasmModule* module,
-                                             Handle<Code> wasm_code,
-                                             uint32_t index);
+  // The {module} is still being decoded. It has to stay at its address until
+  // it gets passed to {Finish}.
+  StreamingModuleCompiler(Isolate* isolate, const WasmModule* module);
+  ~StreamingModuleCompiler();
+
+  // Returns whether the functions of {module} get compiled while streaming.
+  static bool CanCompileWhileStreaming(Isolate* isolate,
+                                       const WasmModule* module);
+
+  // The bytes of {body} have to stay alive until {Finish} returns.
+  void CompileFunction(uint32_t func_index, FunctionBody body);
+
+  // Finishes the compilation of all functions and creates the module object.
+  MaybeHandle<WasmModuleObject> Finish(ErrorThrower* thrower,
+                                       std::unique_ptr<WasmModule> module,
+                                       const ModuleWireBytes& wire_bytes);
 
  private:
-  // sig_map_ maps signatures to an index in code_cache_.
-  wasm::SignatureMap sig_map_;
-  std::vector<Handle<Code>> code_cache_;
+  class CompilationTask;
+
+  // Executes the compilation of the next pending unit. Returns false if there
+  // was none.
+  bool ExecuteNextUnit(bool on_background);
+
+  Isolate* isolate_;
+  const WasmModule* module_;
+  std::unique_ptr<WasmInstance> temp_instance_;
+  std::unique_ptr<ModuleEnv> module_env_;
+  Handle<FixedArray> function_tables_;
+  Handle<FixedArray> signature_tables_;
+  Handle<Code> centry_stub_;
+  std::vector<DeferredHandles*> deferred_handles_;
+  // The fields below are guarded by {units_mutex_}.
+  base::Mutex units_mutex_;
+  std::deque<std::unique_ptr<compiler::WasmCompilationUnit>> pending_units_;
+  std::vector<std::unique_ptr<compiler::WasmCompilationUnit>> executed_units_;
+  // The number of background tasks which may still be started.
+  size_t stopped_tasks_;
+  CancelableTaskManager background_task_manager_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamingModuleCompiler);
 };
 
 // A helper class to simplify instantiating a module from a compiled module.
@@ -188,7 +233,6 @@ class InstanceBuilder {
   Handle<WasmCompiledModule> compiled_module_;
   std::vector<TableInstance> table_instances_;
   std::vector<Handle<JSFunction>> js_wrappers_;
-  JSToWasmWrapperCache js_to_wasm_cache_;
   WeakCallbackInfo<void>::Callback instance_finalizer_callback_;
 
   Counters* counters() const { return async_counters_.get(); }
@@ -373,6 +373,52 @@ class ModuleDecoder : public Decoder {
     }
   }
 
+  // Decodes a section including its id and length, as it is received by the
+  // {StreamingDecoder}. {offset} is the offset of the section in the module.
+  void DecodeCompleteSection(Vector<const uint8_t> bytes, uint32_t offset) {
+    if (failed()) return;
+    Reset(bytes, offset);
+    WasmSectionIterator section_iter(*this);
+    if (failed() || section_iter.section_code() == kUnknownSectionCode) return;
+    uint32_t payload_offset = offset + static_cast<uint32_t>(
+                                           section_iter.payload_start() -
+                                           section_iter.section_start());
+    DecodeSection(section_iter.section_code(), section_iter.payload(),
+                  payload_offset, false);
+  }
+
+  // Starts decoding a code section with {functions_count} function bodies,
+  // which are then passed to {DecodeFunctionBody} one by one. {offset} is the
+  // offset of the functions count in the module.
+  void StartCodeSection(uint32_t functions_count, uint32_t offset) {
+    if (failed()) return;
+    Reset(Vector<const uint8_t>(), offset);
+    if (kCodeSectionCode < next_section_) {
+      errorf(pc(), "unexpected section: %s", SectionName(kCodeSectionCode));
+      return;
+    }
+    next_section_ = kCodeSectionCode + 1;
+    if (functions_count != module_->num_declared_functions) {
+      errorf(pc(), "function body count %u mismatch (%u expected)",
+             functions_count, module_->num_declared_functions);
+      return;
+    }
+    // All sections which define globals were decoded already. Compute the
+    // global offsets now, function bodies may get compiled before
+    // {FinishDecoding}.
+    CalculateGlobalOffsets(module_.get());
+  }
+
+  void DecodeFunctionBody(uint32_t index, uint32_t length, uint32_t offset) {
+    DCHECK(ok());
+    DCHECK_LT(index, module_->num_declared_functions);
+    WasmFunction* function =
+        &module_->functions[index + module_->num_imported_functions];
+    function->code = {offset, length};
+  }
+
+  const WasmModule* module() const { return module_.get(); }
+
   void DecodeTypeSection() {
     uint32_t signatures_count = consume_count("types count", kV8MaxWasmTypes);
     module_->signatures.reserve(signatures_count);
@@ -1213,6 +1259,48 @@ class ModuleDecoder : public Decoder {
 
 }  // namespace
 
+class IncrementalModuleDecoder::Impl : public ModuleDecoder {
+ public:
+  Impl() : ModuleDecoder(nullptr, nullptr, kWasmOrigin) {}
+};
+
+IncrementalModuleDecoder::IncrementalModuleDecoder(Isolate* isolate)
+    : impl_(new Impl()) {
+  impl_->StartDecoding(isolate);
+}
+
+IncrementalModuleDecoder::~IncrementalModuleDecoder() {}
+
+void IncrementalModuleDecoder::DecodeModuleHeader(Vector<const uint8_t> bytes) {
+  impl_->DecodeModuleHeader(bytes, 0);
+}
+
+void IncrementalModuleDecoder::DecodeSection(Vector<const uint8_t> bytes,
+                                             uint32_t offset) {
+  impl_->DecodeCompleteSection(bytes, offset);
+}
+
+void IncrementalModuleDecoder::StartCodeSection(uint32_t functions_count,
+                                                uint32_t offset) {
+  impl_->StartCodeSection(functions_count, offset);
+}
+
+void IncrementalModuleDecoder::DecodeFunctionBody(uint32_t index,
+                                                  uint32_t length,
+                                                  uint32_t offset) {
+  impl_->DecodeFunctionBody(index, length, offset);
+}
+
+ModuleResult IncrementalModuleDecoder::FinishDecoding() {
+  return impl_->FinishDecoding(false);
+}
+
+bool IncrementalModuleDecoder::ok() const { return impl_->ok(); }
+
+const WasmModule* IncrementalModuleDecoder::module() const {
+  return impl_->module();
+}
+
 ModuleResult DecodeWasmModule(Isolate* isolate, const byte* module_start,
                               const byte* module_end, bool verify_functions,
                               ModuleOrigin origin, Counters* counters,
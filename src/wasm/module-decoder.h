@@ -70,6 +70,39 @@ V8_EXPORT_PRIVATE ModuleResult AsyncDecodeWasmModule(
     Isolate* isolate, const byte* module_start, const byte* module_end,
     bool verify_functions, ModuleOrigin origin, Counters* async_counters);
 
+// Decodes a wasm module piece by piece, in the order in which the
+// {StreamingDecoder} receives it. All offsets are offsets in the complete
+// module. Function bodies are not verified.
+class V8_EXPORT_PRIVATE IncrementalModuleDecoder {
+ public:
+  explicit IncrementalModuleDecoder(Isolate* isolate);
+  ~IncrementalModuleDecoder();
+
+  void DecodeModuleHeader(Vector<const uint8_t> bytes);
+
+  // Decodes a section other than the code section. {bytes} includes the
+  // section id and the section length.
+  void DecodeSection(Vector<const uint8_t> bytes, uint32_t offset);
+
+  // The code section is decoded function by function. {offset} is the offset
+  // of the functions count.
+  void StartCodeSection(uint32_t functions_count, uint32_t offset);
+  void DecodeFunctionBody(uint32_t index, uint32_t length, uint32_t offset);
+
+  ModuleResult FinishDecoding();
+
+  bool ok() const;
+
+  // The module decoded so far. It keeps its address in {FinishDecoding}.
+  const WasmModule* module() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+
+  DISALLOW_COPY_AND_ASSIGN(IncrementalModuleDecoder);
+};
+
 // Exposed for testing. Decodes a single function signature, allocating it
 // in the given zone. Returns {nullptr} upon failure.
 V8_EXPORT_PRIVATE FunctionSig* DecodeWasmSignatureForTesting(Zone* zone,
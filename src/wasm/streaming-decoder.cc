@@ -11,16 +11,20 @@
 #include "src/objects/dictionary.h"
 #include "src/wasm/decoder.h"
 #include "src/wasm/leb-helper.h"
+#include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/wasm/wasm-result.h"
 
 using namespace v8::internal;
 using namespace v8::internal::wasm;
 
+constexpr size_t StreamingDecoder::kModuleHeaderSize;
+
 void StreamingDecoder::OnBytesReceived(Vector<const uint8_t> bytes) {
   size_t current = 0;
-  while (decoder()->ok() && current < bytes.size()) {
+  while (ok() && current < bytes.size()) {
     size_t num_bytes =
         state_->ReadBytes(this, bytes.SubVector(current, bytes.size()));
     current += num_bytes;
@@ -40,12 +44,100 @@ size_t StreamingDecoder::DecodingState::ReadBytes(StreamingDecoder* streaming,
 }
 
 MaybeHandle<WasmModuleObject> StreamingDecoder::Finish() {
-  UNIMPLEMENTED();
-  return Handle<WasmModuleObject>::null();
+  DCHECK_NOT_NULL(isolate_);
+  ErrorThrower thrower(isolate_, "StreamingDecoder::Finish()");
+  if (decoder_.failed()) {
+    Result<std::nullptr_t> result = decoder_.toResult(nullptr);
+    thrower.CompileFailed("Wasm decoding failed", result);
+    return {};
+  }
+  if (!module_decoder_->ok()) {
+    ModuleResult result = module_decoder_->FinishDecoding();
+    thrower.CompileFailed("Wasm decoding failed", result);
+    return {};
+  }
+  if (!state_->is_finishing_allowed()) {
+    thrower.CompileError("Wasm decoding failed: unexpected end of module @+%zu",
+                         module_size_);
+    return {};
+  }
+
+  // The module object keeps the wire bytes in one piece.
+  std::unique_ptr<uint8_t[]> bytes(new uint8_t[module_size_]);
+  memcpy(bytes.get(), module_header_, kModuleHeaderSize);
+  for (auto& buffer : section_buffers_) {
+    memcpy(bytes.get() + buffer->module_offset(), buffer->bytes(),
+           buffer->length());
+  }
+  ModuleWireBytes wire_bytes(bytes.get(), bytes.get() + module_size_);
+
+  if (!compiler_) {
+    // Nothing was compiled yet, e.g. because the module has no code section
+    // or gets compiled lazily.
+    return SyncCompile(isolate_, &thrower, wire_bytes);
+  }
+  ModuleResult result = module_decoder_->FinishDecoding();
+  if (result.failed()) {
+    thrower.CompileFailed("Wasm decoding failed", result);
+    return {};
+  }
+  return compiler_->Finish(&thrower, std::move(result.val), wire_bytes);
 }
 
 bool StreamingDecoder::FinishForTesting() {
-  return decoder_.ok() && state_->is_finishing_allowed();
+  return ok() && state_->is_finishing_allowed();
+}
+
+bool StreamingDecoder::ok() const {
+  return decoder_.ok() && (!module_decoder_ || module_decoder_->ok());
+}
+
+void StreamingDecoder::ProcessModuleHeader(Vector<const uint8_t> bytes) {
+  DCHECK_EQ(kModuleHeaderSize, bytes.size());
+  memcpy(module_header_, bytes.start(), kModuleHeaderSize);
+  if (module_decoder_) module_decoder_->DecodeModuleHeader(bytes);
+}
+
+void StreamingDecoder::ProcessSection(SectionBuffer* section_buffer) {
+  if (!module_decoder_) return;
+  module_decoder_->DecodeSection(
+      Vector<const uint8_t>(section_buffer->bytes(),
+                            static_cast<int>(section_buffer->length())),
+      static_cast<uint32_t>(section_buffer->module_offset()));
+}
+
+void StreamingDecoder::ProcessCodeSectionHeader(SectionBuffer* section_buffer,
+                                                size_t num_functions) {
+  if (!module_decoder_) return;
+  module_decoder_->StartCodeSection(
+      static_cast<uint32_t>(num_functions),
+      static_cast<uint32_t>(section_buffer->module_offset() +
+                            section_buffer->payload_offset()));
+  // All sections the function bodies depend on are decoded now.
+  if (module_decoder_->ok() && num_functions > 0 &&
+      StreamingModuleCompiler::CanCompileWhileStreaming(
+          isolate_, module_decoder_->module())) {
+    compiler_.reset(
+        new StreamingModuleCompiler(isolate_, module_decoder_->module()));
+  }
+}
+
+void StreamingDecoder::ProcessFunctionBody(SectionBuffer* section_buffer,
+                                           size_t buffer_offset,
+                                           size_t length) {
+  if (!module_decoder_) return;
+  uint32_t index = num_received_functions_++;
+  uint32_t offset =
+      static_cast<uint32_t>(section_buffer->module_offset() + buffer_offset);
+  module_decoder_->DecodeFunctionBody(index, static_cast<uint32_t>(length),
+                                      offset);
+  if (!compiler_) return;
+  const WasmModule* module = module_decoder_->module();
+  uint32_t func_index = module->num_imported_functions + index;
+  const uint8_t* start = section_buffer->bytes() + buffer_offset;
+  compiler_->CompileFunction(
+      func_index, FunctionBody{module->functions[func_index].sig, offset,
+                               start, start + length});
 }
 
 // An abstract class to share code among the states which decode VarInts. This
@@ -88,8 +180,6 @@ class StreamingDecoder::DecodeModuleHeader : public DecodingState {
   // Checks if the magic bytes of the module header are correct.
   void CheckHeader(Decoder* decoder);
 
-  // The size of the module header.
-  static constexpr size_t kModuleHeaderSize = 8;
   uint8_t byte_buffer_[kModuleHeaderSize];
 };
 
@@ -270,6 +360,7 @@ void StreamingDecoder::DecodeModuleHeader::CheckHeader(Decoder* decoder) {
 std::unique_ptr<StreamingDecoder::DecodingState>
 StreamingDecoder::DecodeModuleHeader::Next(StreamingDecoder* streaming) {
   CheckHeader(streaming->decoder());
+  streaming->ProcessModuleHeader(Vector<const uint8_t>(buffer(), size()));
   return base::make_unique<DecodeSectionID>();
 }
 
@@ -286,6 +377,7 @@ StreamingDecoder::DecodeSectionLength::NextWithValue(
       Vector<const uint8_t>(buffer(), static_cast<int>(bytes_needed())));
   if (value() == 0) {
     // There is no payload, we go to the next section immediately.
+    streaming->ProcessSection(buf);
     return base::make_unique<DecodeSectionID>();
   } else if (section_id() == SectionCode::kCodeSectionCode) {
     // We reached the code section. All functions of the code section are put
@@ -298,6 +390,7 @@ StreamingDecoder::DecodeSectionLength::NextWithValue(
 
 std::unique_ptr<StreamingDecoder::DecodingState>
 StreamingDecoder::DecodeSectionPayload::Next(StreamingDecoder* streaming) {
+  streaming->ProcessSection(section_buffer_);
   return base::make_unique<DecodeSectionID>();
 }
 
@@ -312,6 +405,7 @@ StreamingDecoder::DecodeNumberOfFunctions::NextWithValue(
     streaming->decoder()->error("Invalid code section length");
     return base::make_unique<DecodeSectionID>();
   }
+  streaming->ProcessCodeSectionHeader(section_buffer(), value());
 
   // {value} is the number of functions.
   if (value() > 0) {
@@ -351,7 +445,7 @@ StreamingDecoder::DecodeFunctionLength::NextWithValue(
 
 std::unique_ptr<StreamingDecoder::DecodingState>
 StreamingDecoder::DecodeFunctionBody::Next(StreamingDecoder* streaming) {
-  // TODO(ahaas): Start compilation of the function here.
+  streaming->ProcessFunctionBody(section_buffer(), buffer_offset(), size());
   if (num_remaining_functions() != 0) {
     return base::make_unique<DecodeFunctionLength>(
         section_buffer(), buffer_offset() + size(), num_remaining_functions());
@@ -373,6 +467,11 @@ StreamingDecoder::StreamingDecoder(Isolate* isolate)
     : isolate_(isolate),
       // A module always starts with a module header.
       state_(new DecodeModuleHeader()),
-      decoder_(nullptr, nullptr) {
-  USE(isolate_);
-}
+      decoder_(nullptr, nullptr),
+      module_decoder_(isolate ? new IncrementalModuleDecoder(isolate)
+                              : nullptr) {}
+
+// Defined here because of the incomplete types in the header. The {compiler_}
+// is destroyed first, which stops compilation before the section buffers go
+// away.
+StreamingDecoder::~StreamingDecoder() {}
@@ -14,12 +14,18 @@ namespace v8 {
 namespace internal {
 namespace wasm {
 
+class IncrementalModuleDecoder;
+class StreamingModuleCompiler;
+
 // The StreamingDecoder takes a sequence of byte arrays, each received by a call
 // of {OnBytesReceived}, and extracts the bytes which belong to section payloads
-// and function bodies.
+// and function bodies. If it has an isolate, it also decodes the sections as
+// they arrive and compiles each function body as soon as it was received, so
+// that compilation overlaps with the download of the module.
 class V8_EXPORT_PRIVATE StreamingDecoder {
  public:
   explicit StreamingDecoder(Isolate* isolate);
+  ~StreamingDecoder();
 
   // The buffer passed into OnBytesReceived is owned by the caller.
   void OnBytesReceived(Vector<const uint8_t> bytes);
@@ -36,24 +42,29 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
   // length), and the offset where the actual payload starts.
   class SectionBuffer {
    public:
+    // module_offset: The offset of the section in the module.
     // id: The section id.
     // payload_length: The length of the payload.
     // length_bytes: The section length, as it is encoded in the module bytes.
-    SectionBuffer(uint8_t id, size_t payload_length,
+    SectionBuffer(size_t module_offset, uint8_t id, size_t payload_length,
                   Vector<const uint8_t> length_bytes)
-        :  // ID + length + payload
+        : module_offset_(module_offset),
+          // ID + length + payload
           length_(1 + length_bytes.length() + payload_length),
           bytes_(new uint8_t[length_]),
           payload_offset_(1 + length_bytes.length()) {
       bytes_[0] = id;
       memcpy(bytes_.get() + 1, &length_bytes.first(), length_bytes.length());
     }
+    uint8_t id() const { return bytes_[0]; }
+    size_t module_offset() const { return module_offset_; }
     uint8_t* bytes() const { return bytes_.get(); }
     size_t length() const { return length_; }
     size_t payload_offset() const { return payload_offset_; }
     size_t payload_length() const { return length_ - payload_offset_; }
 
    private:
+    size_t module_offset_;
     size_t length_;
     std::unique_ptr<uint8_t[]> bytes_;
     size_t payload_offset_;
@@ -126,21 +137,44 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
   class DecodeFunctionLength;
   class DecodeFunctionBody;
 
+  // The size of the module header.
+  static constexpr size_t kModuleHeaderSize = 8;
+
   // Creates a buffer for the next section of the module.
   SectionBuffer* CreateNewBuffer(uint8_t id, size_t length,
                                  Vector<const uint8_t> length_bytes) {
-    section_buffers_.emplace_back(new SectionBuffer(id, length, length_bytes));
+    section_buffers_.emplace_back(
+        new SectionBuffer(module_size_, id, length, length_bytes));
+    module_size_ += section_buffers_.back()->length();
     return section_buffers_.back().get();
   }
 
+  // Pass the parts of the module on to the {module_decoder_} and the
+  // {compiler_}, once they were received completely.
+  void ProcessModuleHeader(Vector<const uint8_t> bytes);
+  void ProcessSection(SectionBuffer* section_buffer);
+  void ProcessCodeSectionHeader(SectionBuffer* section_buffer,
+                                size_t num_functions);
+  void ProcessFunctionBody(SectionBuffer* section_buffer, size_t buffer_offset,
+                           size_t length);
+
+  bool ok() const;
+
   Decoder* decoder() { return &decoder_; }
 
   Isolate* isolate_;
   std::unique_ptr<DecodingState> state_;
   // The decoder is an instance variable because we use it for error handling.
   Decoder decoder_;
+  uint8_t module_header_[kModuleHeaderSize];
   std::vector<std::unique_ptr<SectionBuffer>> section_buffers_;
   size_t total_size_ = 0;
+  // The size of the module header and all sections received so far.
+  size_t module_size_ = kModuleHeaderSize;
+  // Both are only used if the streaming decoder has an isolate.
+  std::unique_ptr<IncrementalModuleDecoder> module_decoder_;
+  std::unique_ptr<StreamingModuleCompiler> compiler_;
+  uint32_t num_received_functions_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(StreamingDecoder);
 };
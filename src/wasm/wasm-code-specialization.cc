@@ -167,6 +167,30 @@ bool CodeSpecialization::ApplyToWholeInstance(
   return changed;
 }
 
+// static
+bool CodeSpecialization::IsInstanceIndependent(Code* code) {
+  DisallowHeapAllocation no_gc;
+  DCHECK_EQ(Code::WASM_FUNCTION, code->kind());
+  const int mode_mask =
+      RelocInfo::ModeMask(RelocInfo::WASM_MEMORY_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::WASM_MEMORY_SIZE_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::WASM_GLOBAL_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::WASM_FUNCTION_TABLE_SIZE_REFERENCE) |
+      RelocInfo::ModeMask(RelocInfo::WASM_PROTECTED_INSTRUCTION_LANDING) |
+      RelocInfo::ModeMask(RelocInfo::EMBEDDED_OBJECT) |
+      RelocInfo::ModeMask(RelocInfo::CODE_TARGET);
+  for (RelocIterator it(code, mode_mask); !it.done(); it.next()) {
+    // Calls to builtins like stack checks and traps are the same for all
+    // instances.
+    if (RelocInfo::IsCodeTarget(it.rinfo()->rmode()) &&
+        !IsAtWasmDirectCallTarget(it)) {
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
 bool CodeSpecialization::ApplyToWasmCode(Code* code,
                                          ICacheFlushMode icache_flush_mode) {
   DisallowHeapAllocation no_gc;
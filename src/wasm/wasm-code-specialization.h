@@ -45,6 +45,11 @@ class CodeSpecialization {
   // Apply all relocations and patching to one wasm code object.
   bool ApplyToWasmCode(Code*, ICacheFlushMode = FLUSH_ICACHE_IF_NEEDED);
 
+  // Returns whether the wasm code object contains nothing that is patched
+  // per instance: no memory, globals or function table references, no
+  // embedded objects, no protected instructions and no direct wasm calls.
+  static bool IsInstanceIndependent(Code*);
+
  private:
   Address old_mem_start = 0;
   uint32_t old_mem_size = 0;
@@ -655,6 +655,9 @@ Handle<HeapObject> UnwrapWasmToJSWrapper(Isolate* isolate,
 
 class SideTable;
 
+// Marks pcs without a control transfer in {SideTable::transfer_index_}.
+constexpr uint32_t kNoControlTransfer = kMaxUInt32;
+
 // Code and metadata needed to execute a function.
 struct InterpreterCode {
   const WasmFunction* function;  // wasm function
@@ -675,9 +678,16 @@ class SideTable : public ZoneObject {
  public:
   ControlTransferMap map_;
   uint32_t max_stack_height_;
+  // The entries of {map_}, indexed by pc. Branches are resolved with a single
+  // lookup in {transfer_index_} instead of searching {map_}.
+  ZoneVector<uint32_t> transfer_index_;
+  ZoneVector<ControlTransferEntry> transfers_;
 
   SideTable(Zone* zone, const WasmModule* module, InterpreterCode* code)
-      : map_(zone), max_stack_height_(0) {
+      : map_(zone),
+        max_stack_height_(0),
+        transfer_index_(zone),
+        transfers_(zone) {
     // Create a zone for all temporary objects.
     Zone control_transfer_zone(zone->allocator(), ZONE_NAME);
 
@@ -895,12 +905,23 @@ class SideTable : public ZoneObject {
     }
     DCHECK_EQ(0, control_stack.size());
     DCHECK_EQ(func_arity, stack_height);
+
+    size_t code_size = static_cast<size_t>(code->orig_end - code->orig_start);
+    transfer_index_.resize(code_size, kNoControlTransfer);
+    transfers_.reserve(map_.size());
+    for (auto& transfer : map_) {
+      DCHECK_LT(transfer.first, code_size);
+      transfer_index_[transfer.first] =
+          static_cast<uint32_t>(transfers_.size());
+      transfers_.push_back(transfer.second);
+    }
   }
 
   ControlTransferEntry& Lookup(pc_t from) {
-    auto result = map_.find(from);
-    DCHECK(result != map_.end());
-    return result->second;
+    DCHECK_LT(from, transfer_index_.size());
+    uint32_t index = transfer_index_[from];
+    DCHECK_NE(kNoControlTransfer, index);
+    return transfers_[index];
   }
 };
 
@@ -1398,7 +1419,7 @@ class ThreadImpl {
     return static_cast<int>(code->side_table->Lookup(pc).pc_diff);
   }
 
-  int DoBreak(InterpreterCode* code, pc_t pc, size_t depth) {
+  int DoBreak(InterpreterCode* code, pc_t pc) {
     ControlTransferEntry& control_transfer_entry = code->side_table->Lookup(pc);
     DoStackTransfer(sp_ - control_transfer_entry.sp_diff,
                     control_transfer_entry.target_arity);
@@ -1645,8 +1666,7 @@ class ThreadImpl {
           break;
         }
         case kExprBr: {
-          BreakDepthOperand<false> operand(&decoder, code->at(pc));
-          len = DoBreak(code, pc, operand.depth);
+          len = DoBreak(code, pc);
           TRACE("  br => @%zu\n", pc + len);
           break;
         }
@@ -1655,7 +1675,7 @@ class ThreadImpl {
           WasmVal cond = Pop();
           bool is_true = cond.to<uint32_t>() != 0;
           if (is_true) {
-            len = DoBreak(code, pc, operand.depth);
+            len = DoBreak(code, pc);
             TRACE("  br_if => @%zu\n", pc + len);
           } else {
             TRACE("  false => fallthrough\n");
@@ -1665,15 +1685,11 @@ class ThreadImpl {
         }
         case kExprBrTable: {
           BranchTableOperand<false> operand(&decoder, code->at(pc));
-          BranchTableIterator<false> iterator(&decoder, operand);
           uint32_t key = Pop().to<uint32_t>();
-          uint32_t depth = 0;
           if (key >= operand.table_count) key = operand.table_count;
-          for (uint32_t i = 0; i <= key; i++) {
-            DCHECK(iterator.has_next());
-            depth = iterator.next();
-          }
-          len = key + DoBreak(code, pc + key, static_cast<size_t>(depth));
+          // The side table holds the resolved target of each entry at
+          // {pc + key}, so the table itself does not need to be decoded.
+          len = key + DoBreak(code, pc + key);
           TRACE("  br[%u] => @%zu\n", key, pc + key + len);
           break;
         }
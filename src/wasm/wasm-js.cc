@@ -574,7 +574,7 @@ void WebAssemblyMemory(const v8::FunctionCallbackInfo<v8::Value>& args) {
   size_t size = static_cast<size_t>(i::wasm::WasmModule::kPageSize) *
                 static_cast<size_t>(initial);
   i::Handle<i::JSArrayBuffer> buffer =
-      i::wasm::NewArrayBuffer(i_isolate, size, i::FLAG_wasm_guard_pages);
+      i::wasm::NewArrayBuffer(i_isolate, size, i::wasm::EnableGuardRegions());
   if (buffer.is_null()) {
     thrower.RangeError("could not allocate memory");
     return;
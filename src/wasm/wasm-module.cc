@@ -15,6 +15,7 @@
 #include "src/v8.h"
 
 #include "src/wasm/compilation-manager.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-code-specialization.h"
@@ -293,6 +294,32 @@ Handle<JSArrayBuffer> wasm::NewArrayBuffer(Isolate* isolate, size_t size,
                           size, is_external, enable_guard_regions);
 }
 
+void wasm::UnpackAndRegisterProtectedInstructions(Isolate* isolate,
+                                                  Handle<Code> code) {
+  DCHECK_EQ(Code::WASM_FUNCTION, code->kind());
+  const intptr_t base = reinterpret_cast<intptr_t>(code->entry());
+
+  Zone zone(isolate->allocator(), "Wasm Module");
+  ZoneVector<trap_handler::ProtectedInstructionData> unpacked(&zone);
+  const int mode_mask =
+      RelocInfo::ModeMask(RelocInfo::WASM_PROTECTED_INSTRUCTION_LANDING);
+  for (RelocIterator it(*code, mode_mask); !it.done(); it.next()) {
+    trap_handler::ProtectedInstructionData data;
+    data.instr_offset = it.rinfo()->data();
+    data.landing_offset = reinterpret_cast<intptr_t>(it.rinfo()->pc()) - base;
+    unpacked.emplace_back(data);
+  }
+  if (unpacked.size() > 0) {
+    int size = code->CodeSize();
+    const int index = RegisterHandlerData(reinterpret_cast<void*>(base), size,
+                                          unpacked.size(), &unpacked[0]);
+    // Without its landing pads, an out of bounds access in this code would
+    // crash the process, so we cannot continue.
+    CHECK_LE(0, index);
+    code->set_trap_handler_index(Smi::FromInt(index));
+  }
+}
+
 void wasm::UnpackAndRegisterProtectedInstructions(
     Isolate* isolate, Handle<FixedArray> code_table) {
   for (int i = 0; i < code_table->length(); ++i) {
@@ -306,26 +333,7 @@ void wasm::UnpackAndRegisterProtectedInstructions(
       continue;
     }
 
-    const intptr_t base = reinterpret_cast<intptr_t>(code->entry());
-
-    Zone zone(isolate->allocator(), "Wasm Module");
-    ZoneVector<trap_handler::ProtectedInstructionData> unpacked(&zone);
-    const int mode_mask =
-        RelocInfo::ModeMask(RelocInfo::WASM_PROTECTED_INSTRUCTION_LANDING);
-    for (RelocIterator it(*code, mode_mask); !it.done(); it.next()) {
-      trap_handler::ProtectedInstructionData data;
-      data.instr_offset = it.rinfo()->data();
-      data.landing_offset = reinterpret_cast<intptr_t>(it.rinfo()->pc()) - base;
-      unpacked.emplace_back(data);
-    }
-    if (unpacked.size() > 0) {
-      int size = code->CodeSize();
-      const int index = RegisterHandlerData(reinterpret_cast<void*>(base), size,
-                                            unpacked.size(), &unpacked[0]);
-      // TODO(eholk): if index is negative, fail.
-      DCHECK(index >= 0);
-      code->set_trap_handler_index(Smi::FromInt(index));
-    }
+    UnpackAndRegisterProtectedInstructions(isolate, code);
   }
 }
 
@@ -956,8 +964,95 @@ Handle<Code> wasm::CompileLazy(Isolate* isolate) {
   return compiled_code;
 }
 
+namespace {
+
+// The units for the likely callees of a lazily compiled function. They get
+// executed by background tasks until the main thread closes the queue.
+class LazyCompilationQueue {
+ public:
+  void Push(compiler::WasmCompilationUnit* unit) {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    pending_units_.push_back(unit);
+  }
+
+  // Executes the next pending unit. Returns false if there was none or the
+  // queue was closed.
+  bool ExecuteNextUnit() {
+    DisallowHeapAllocation no_allocation;
+    DisallowHandleAllocation no_handles;
+    DisallowHandleDereference no_deref;
+    DisallowCodeDependencyChange no_dependency_change;
+
+    compiler::WasmCompilationUnit* unit;
+    {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      if (closed_ || pending_units_.empty()) return false;
+      unit = pending_units_.front();
+      pending_units_.pop_front();
+    }
+    unit->ExecuteCompilation();
+    {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      executed_units_.push_back(unit);
+    }
+    return true;
+  }
+
+  // Units which were not started yet stay uncompiled.
+  void Close() {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    closed_ = true;
+  }
+
+  // Only valid once all background tasks are done.
+  const std::vector<compiler::WasmCompilationUnit*>& executed_units() const {
+    return executed_units_;
+  }
+
+ private:
+  base::Mutex mutex_;
+  bool closed_ = false;
+  std::deque<compiler::WasmCompilationUnit*> pending_units_;
+  std::vector<compiler::WasmCompilationUnit*> executed_units_;
+};
+
+class LazyCompilationTask : public CancelableTask {
+ public:
+  LazyCompilationTask(CancelableTaskManager* manager,
+                      LazyCompilationQueue* queue)
+      : CancelableTask(manager), queue_(queue) {}
+
+  void RunInternal() override {
+    while (queue_->ExecuteNextUnit()) {
+    }
+  }
+
+ private:
+  LazyCompilationQueue* queue_;
+};
+
+// Appends the indexes of all functions directly called by the body of
+// {func}.
+void CollectDirectCallees(Isolate* isolate, const byte* module_start,
+                          const WasmFunction* func,
+                          std::vector<int>* callees) {
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  wasm::BodyLocalDecls decls(&zone);
+  wasm::Decoder decoder(nullptr, nullptr);
+  for (wasm::BytecodeIterator it(module_start + func->code.offset(),
+                                 module_start + func->code.end_offset(),
+                                 &decls);
+       it.has_next(); it.next()) {
+    if (it.current() != kExprCallFunction) continue;
+    callees->push_back(ExtractDirectCallIndex(decoder, it.pc()));
+  }
+}
+
+}  // namespace
+
 void LazyCompilationOrchestrator::CompileFunction(
-    Isolate* isolate, Handle<WasmInstanceObject> instance, int func_index) {
+    Isolate* isolate, Handle<WasmInstanceObject> instance, int func_index,
+    const std::vector<int>& caller_callees) {
   Handle<WasmCompiledModule> compiled_module(instance->compiled_module(),
                                              isolate);
   if (Code::cast(compiled_module->code_table()->get(func_index))->kind() ==
@@ -968,8 +1063,6 @@ void LazyCompilationOrchestrator::CompileFunction(
   size_t num_function_tables =
       compiled_module->module()->function_tables.size();
   // Store a vector of handles to be embedded in the generated code.
-  // TODO(clemensh): For concurrent compilation, these will have to live in a
-  // DeferredHandleScope.
   std::vector<Handle<FixedArray>> fun_tables(num_function_tables);
   std::vector<Handle<FixedArray>> sig_tables(num_function_tables);
   for (size_t i = 0; i < num_function_tables; ++i) {
@@ -983,46 +1076,103 @@ void LazyCompilationOrchestrator::CompileFunction(
   wasm::ModuleEnv module_env(compiled_module->module(), &fun_tables,
                              &sig_tables);
   uint8_t* module_start = compiled_module->module_bytes()->GetChars();
-  const WasmFunction* func = &module_env.module->functions[func_index];
-  wasm::FunctionBody body{func->sig, func->code.offset(),
-                          module_start + func->code.offset(),
-                          module_start + func->code.end_offset()};
+
+  // The requested function comes first, followed by the callees to prefetch.
+  std::vector<int> func_indexes = {func_index};
+  size_t max_prefetch =
+      Min(static_cast<size_t>(Max(0, FLAG_wasm_lazy_prefetch_count)),
+          static_cast<size_t>(Max(0, FLAG_wasm_num_compilation_tasks)) > 0
+              ? V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads()
+              : 0);
+  if (max_prefetch > 0) {
+    std::vector<int> likely_callees;
+    CollectDirectCallees(isolate, module_start,
+                         &module_env.module->functions[func_index],
+                         &likely_callees);
+    likely_callees.insert(likely_callees.end(), caller_callees.begin(),
+                          caller_callees.end());
+    for (int callee : likely_callees) {
+      if (func_indexes.size() > max_prefetch) break;
+      if (Code::cast(compiled_module->code_table()->get(callee))
+              ->builtin_index() != Builtins::kWasmCompileLazy) {
+        continue;
+      }
+      if (std::find(func_indexes.begin(), func_indexes.end(), callee) !=
+          func_indexes.end()) {
+        continue;
+      }
+      func_indexes.push_back(callee);
+    }
+  }
+
   // TODO(wasm): Refactor this to only get the name if it is really needed for
   // tracing / debugging.
-  std::string func_name;
-  {
+  std::vector<std::string> func_names(func_indexes.size());
+  std::vector<std::unique_ptr<compiler::WasmCompilationUnit>> units;
+  for (size_t i = 0; i < func_indexes.size(); ++i) {
+    const WasmFunction* func = &module_env.module->functions[func_indexes[i]];
+    wasm::FunctionBody body{func->sig, func->code.offset(),
+                            module_start + func->code.offset(),
+                            module_start + func->code.end_offset()};
     wasm::WasmName name = Vector<const char>::cast(
-        compiled_module->GetRawFunctionName(func_index));
+        compiled_module->GetRawFunctionName(func_indexes[i]));
     // Copy to std::string, because the underlying string object might move on
     // the heap.
-    func_name.assign(name.start(), static_cast<size_t>(name.length()));
+    func_names[i].assign(name.start(), static_cast<size_t>(name.length()));
+    units.emplace_back(new compiler::WasmCompilationUnit(
+        isolate, &module_env, body, CStrVector(func_names[i].c_str()),
+        func_indexes[i]));
+  }
+
+  std::vector<compiler::WasmCompilationUnit*> executed_units;
+  {
+    LazyCompilationQueue queue;
+    CancelableTaskManager background_task_manager;
+    for (size_t i = 1; i < units.size(); ++i) {
+      queue.Push(units[i].get());
+      V8::GetCurrentPlatform()->CallOnBackgroundThread(
+          new LazyCompilationTask(&background_task_manager, &queue),
+          v8::Platform::kShortRunningTask);
+    }
+    units[0]->ExecuteCompilation();
+    // Don't wait for callees which did not start compiling yet, they will
+    // be compiled on their first call.
+    queue.Close();
+    background_task_manager.CancelAndWait();
+    executed_units.push_back(units[0].get());
+    executed_units.insert(executed_units.end(), queue.executed_units().begin(),
+                          queue.executed_units().end());
   }
+
   ErrorThrower thrower(isolate, "WasmLazyCompile");
-  compiler::WasmCompilationUnit unit(isolate, &module_env, body,
-                                     CStrVector(func_name.c_str()), func_index);
-  unit.ExecuteCompilation();
-  Handle<Code> code = unit.FinishCompilation(&thrower);
-
-  // If there is a pending error, something really went wrong. The module was
-  // verified before starting execution with lazy compilation.
-  // This might be OOM, but then we cannot continue execution anyway.
-  // TODO(clemensh): According to the spec, we can actually skip validation at
-  // module creation time, and return a function that always traps here.
-  CHECK(!thrower.error());
-
-  Handle<FixedArray> deopt_data = isolate->factory()->NewFixedArray(2, TENURED);
-  Handle<WeakCell> weak_instance = isolate->factory()->NewWeakCell(instance);
-  // TODO(wasm): Introduce constants for the indexes in wasm deopt data.
-  deopt_data->set(0, *weak_instance);
-  deopt_data->set(1, Smi::FromInt(func_index));
-  code->set_deoptimization_data(*deopt_data);
-
-  DCHECK_EQ(Builtins::kWasmCompileLazy,
-            Code::cast(compiled_module->code_table()->get(func_index))
-                ->builtin_index());
-  compiled_module->code_table()->set(func_index, *code);
-
-  // Now specialize the generated code for this instance.
+  std::vector<Handle<Code>> results;
+  for (compiler::WasmCompilationUnit* unit : executed_units) {
+    Handle<Code> code = unit->FinishCompilation(&thrower);
+
+    // If there is a pending error, something really went wrong. The module
+    // was verified before starting execution with lazy compilation.
+    // This might be OOM, but then we cannot continue execution anyway.
+    // TODO(clemensh): According to the spec, we can actually skip validation
+    // at module creation time, and return a function that always traps here.
+    CHECK(!thrower.error());
+
+    Handle<FixedArray> deopt_data =
+        isolate->factory()->NewFixedArray(2, TENURED);
+    Handle<WeakCell> weak_instance = isolate->factory()->NewWeakCell(instance);
+    // TODO(wasm): Introduce constants for the indexes in wasm deopt data.
+    deopt_data->set(0, *weak_instance);
+    deopt_data->set(1, Smi::FromInt(unit->func_index()));
+    code->set_deoptimization_data(*deopt_data);
+
+    DCHECK_EQ(Builtins::kWasmCompileLazy,
+              Code::cast(compiled_module->code_table()->get(unit->func_index()))
+                  ->builtin_index());
+    compiled_module->code_table()->set(unit->func_index(), *code);
+    results.push_back(code);
+  }
+
+  // Now specialize the generated code for this instance. All new functions
+  // are in the code table already, so they call each other directly.
   Zone specialization_zone(isolate->allocator(), ZONE_NAME);
   CodeSpecialization code_specialization(isolate, &specialization_zone);
   if (module_env.module->globals_size) {
@@ -1041,10 +1191,15 @@ void LazyCompilationOrchestrator::CompileFunction(
     }
   }
   code_specialization.RelocateDirectCalls(instance);
-  code_specialization.ApplyToWasmCode(*code, SKIP_ICACHE_FLUSH);
-  Assembler::FlushICache(isolate, code->instruction_start(),
-                         code->instruction_size());
-  RecordLazyCodeStats(*code, isolate->counters());
+  for (Handle<Code> code : results) {
+    code_specialization.ApplyToWasmCode(*code, SKIP_ICACHE_FLUSH);
+    Assembler::FlushICache(isolate, code->instruction_start(),
+                           code->instruction_size());
+    if (trap_handler::UseTrapHandler()) {
+      UnpackAndRegisterProtectedInstructions(isolate, code);
+    }
+    RecordLazyCodeStats(*code, isolate->counters());
+  }
 }
 
 Handle<Code> LazyCompilationOrchestrator::CompileLazy(
@@ -1095,9 +1250,13 @@ Handle<Code> LazyCompilationOrchestrator::CompileLazy(
     }
   }
 
-  // TODO(clemensh): compile all functions in non_compiled_functions in
-  // background, wait for func_to_return_idx.
-  CompileFunction(isolate, instance, func_to_return_idx);
+  // The other functions called from {caller} are likely to be called soon.
+  std::vector<int> caller_callees;
+  for (const NonCompiledFunction& func : non_compiled_functions) {
+    if (func.func_index == func_to_return_idx) continue;
+    caller_callees.push_back(func.func_index);
+  }
+  CompileFunction(isolate, instance, func_to_return_idx, caller_callees);
 
   if (is_js_to_wasm || patch_caller) {
     DisallowHeapAllocation no_gc;
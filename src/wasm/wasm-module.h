@@ -13,6 +13,7 @@
 #include "src/handles.h"
 #include "src/managed.h"
 #include "src/parsing/preparse-data.h"
+#include "src/trap-handler/trap-handler.h"
 
 #include "src/wasm/signature-map.h"
 #include "src/wasm/wasm-opcodes.h"
@@ -499,12 +500,17 @@ const bool kGuardRegionsSupported = true;
 const bool kGuardRegionsSupported = false;
 #endif
 
+// Code compiled for the trap handler has no explicit bounds checks, so every
+// memory it can see needs guard regions.
 inline bool EnableGuardRegions() {
-  return FLAG_wasm_guard_pages && kGuardRegionsSupported;
+  return (FLAG_wasm_guard_pages || trap_handler::UseTrapHandler()) &&
+         kGuardRegionsSupported;
 }
 
 void UnpackAndRegisterProtectedInstructions(Isolate* isolate,
                                             Handle<FixedArray> code_table);
+void UnpackAndRegisterProtectedInstructions(Isolate* isolate,
+                                            Handle<Code> code);
 
 // Triggered by the WasmCompileLazy builtin.
 // Walks the stack (top three frames) to determine the wasm instance involved
@@ -521,11 +527,13 @@ Handle<Code> CompileLazy(Isolate* isolate);
 // triggered by the WasmCompileLazy builtin.
 // It contains the logic for compiling and specializing wasm functions, and
 // patching the calling wasm code.
-// Once we support concurrent lazy compilation, this class will contain the
-// logic to actually orchestrate parallel execution of wasm compilation jobs.
-// TODO(clemensh): Implement concurrent lazy compilation.
+// While the requested function compiles on the main thread, up to
+// --wasm-lazy-prefetch-count of its likely callees (its own direct callees,
+// then the other uncompiled direct callees of the caller) get compiled on
+// background threads. Those that finished in time are installed as well.
 class LazyCompilationOrchestrator {
-  void CompileFunction(Isolate*, Handle<WasmInstanceObject>, int func_index);
+  void CompileFunction(Isolate*, Handle<WasmInstanceObject>, int func_index,
+                       const std::vector<int>& caller_callees);
 
  public:
   Handle<Code> CompileLazy(Isolate*, Handle<WasmInstanceObject>,
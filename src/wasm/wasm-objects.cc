@@ -358,13 +358,35 @@ Handle<JSArrayBuffer> GrowMemoryBuffer(Isolate* isolate,
     return Handle<JSArrayBuffer>::null();
   }
 
-  // TODO(gdeepti): Change the protection here instead of allocating a new
-  // buffer before guard regions are turned on, see issue #5886.
   const bool enable_guard_regions =
       (old_buffer.is_null() && EnableGuardRegions()) ||
       (!old_buffer.is_null() && old_buffer->has_guard_region());
   size_t new_size =
       static_cast<size_t>(old_pages + pages) * WasmModule::kPageSize;
+  if (enable_guard_regions && old_size != 0 && !old_buffer->is_external()) {
+    // The guard region reserves address space for the largest possible
+    // memory, so grow in place by making more of it accessible. This avoids
+    // copying the contents and keeps the memory start of all instances.
+    if (new_size > FLAG_wasm_max_mem_pages * WasmModule::kPageSize ||
+        new_size > kMaxInt) {
+      return Handle<JSArrayBuffer>::null();
+    }
+    void* allocation_base = old_buffer->allocation_base();
+    size_t allocation_length = old_buffer->allocation_length();
+    DCHECK_LE(old_mem_start + new_size,
+              static_cast<Address>(allocation_base) + allocation_length);
+    isolate->array_buffer_allocator()->SetProtection(
+        old_mem_start + old_size, new_size - old_size,
+        v8::ArrayBuffer::Allocator::Protection::kReadWrite);
+    reinterpret_cast<v8::Isolate*>(isolate)
+        ->AdjustAmountOfExternalAllocatedMemory(new_size - old_size);
+    // The new buffer takes over the allocation, so the old one must no longer
+    // free it when it dies.
+    DetachWebAssemblyMemoryBuffer(isolate, old_buffer, false);
+    return SetupArrayBuffer(isolate, allocation_base, allocation_length,
+                            old_mem_start, new_size, false, true);
+  }
+
   Handle<JSArrayBuffer> new_buffer =
       NewArrayBuffer(isolate, new_size, enable_guard_regions);
   if (new_buffer.is_null()) return new_buffer;
@@ -507,12 +529,13 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
     DCHECK(IsWasmInstance(*instance));
     uint32_t max_pages = instance->GetMaxMemoryPages();
 
-    // Grow memory object buffer and update instances associated with it.
+    // Grow memory object buffer and update instances associated with it. The
+    // old buffer may be detached by growing.
+    Address old_mem_start = static_cast<Address>(old_buffer->backing_store());
     new_buffer = GrowMemoryBuffer(isolate, old_buffer, pages, max_pages);
     if (new_buffer.is_null()) return -1;
     DCHECK(!instance_wrapper->has_previous());
     SetInstanceMemory(isolate, instance, new_buffer);
-    Address old_mem_start = static_cast<Address>(old_buffer->backing_store());
     UncheckedUpdateInstanceMemory(isolate, instance, old_mem_start, old_size);
     while (instance_wrapper->has_next()) {
       instance_wrapper = instance_wrapper->next_wrapper();
@@ -0,0 +1,171 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/wrapper-cache.h"
+
+#include <algorithm>
+
+#include "src/assembler-inl.h"
+#include "src/compiler/wasm-compiler.h"
+#include "src/global-handles.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+// Number of import wrappers after which dead ones are removed the first time.
+const size_t kInitialCleanupThreshold = 64;
+
+// Redirects the call to the wasm function in the JS-to-wasm {wrapper}.
+void PatchJSToWasmWrapper(Isolate* isolate, Code* wrapper, Code* wasm_code) {
+  for (RelocIterator it(wrapper, RelocInfo::kCodeTargetMask);; it.next()) {
+    DCHECK(!it.done());
+    Code* target = Code::GetCodeFromTargetAddress(it.rinfo()->target_address());
+    if (target->kind() == Code::WASM_FUNCTION ||
+        target->kind() == Code::WASM_TO_JS_FUNCTION ||
+        target->builtin_index() == Builtins::kIllegal ||
+        target->builtin_index() == Builtins::kWasmCompileLazy) {
+      it.rinfo()->set_target_address(isolate, wasm_code->instruction_start());
+      break;
+    }
+  }
+}
+
+void DestroyGlobalHandle(Object** location) {
+  if (location != nullptr) GlobalHandles::Destroy(location);
+}
+
+}  // namespace
+
+WrapperCache::WrapperCache()
+    : zone_(&allocator_, ZONE_NAME),
+      next_cleanup_(kInitialCleanupThreshold) {}
+
+WrapperCache::~WrapperCache() {
+  DCHECK(js_to_wasm_wrappers_.empty());
+  DCHECK(import_wrappers_.empty());
+}
+
+uint32_t WrapperCache::CanonicalizeSignature(FunctionSig* sig) {
+  int32_t index = sig_map_.Find(sig);
+  if (index >= 0) return static_cast<uint32_t>(index);
+  FunctionSig::Builder builder(&zone_, sig->return_count(),
+                               sig->parameter_count());
+  for (ValueType type : sig->returns()) builder.AddReturn(type);
+  for (ValueType type : sig->parameters()) builder.AddParam(type);
+  return sig_map_.FindOrInsert(builder.Build());
+}
+
+Handle<Code> WrapperCache::GetJSToWasmWrapper(Isolate* isolate,
+                                              const WasmModule* module,
+                                              Handle<Code> wasm_code,
+                                              uint32_t index) {
+  uint32_t sig_index = CanonicalizeSignature(module->functions[index].sig);
+  if (sig_index < js_to_wasm_wrappers_.size() &&
+      js_to_wasm_wrappers_[sig_index] != nullptr) {
+    Handle<Code> code = isolate->factory()->CopyCode(
+        handle(Code::cast(*js_to_wasm_wrappers_[sig_index]), isolate));
+    PatchJSToWasmWrapper(isolate, *code, *wasm_code);
+    return code;
+  }
+
+  Handle<Code> code =
+      compiler::CompileJSToWasmWrapper(isolate, module, wasm_code, index);
+  Handle<Code> wrapper_template = isolate->factory()->CopyCode(code);
+  PatchJSToWasmWrapper(isolate, *wrapper_template,
+                       *isolate->builtins()->Illegal());
+  if (sig_index >= js_to_wasm_wrappers_.size()) {
+    js_to_wasm_wrappers_.resize(sig_index + 1, nullptr);
+  }
+  js_to_wasm_wrappers_[sig_index] =
+      isolate->global_handles()
+          ->Create(static_cast<Object*>(*wrapper_template))
+          .location();
+  return code;
+}
+
+Handle<Code> WrapperCache::GetWasmToJSWrapper(
+    Isolate* isolate, Handle<JSReceiver> target, FunctionSig* sig,
+    uint32_t index, Handle<String> module_name,
+    MaybeHandle<String> import_name, ModuleOrigin origin) {
+  // Wrappers which only throw a TypeError are rare, don't bother caching them.
+  if (!IsJSCompatibleSignature(sig)) {
+    return compiler::CompileWasmToJSWrapper(isolate, target, sig, index,
+                                            module_name, import_name, origin);
+  }
+
+  uint32_t sig_index = CanonicalizeSignature(sig);
+  int hash = JSReceiver::GetOrCreateIdentityHash(isolate, target)->value();
+  auto range = import_wrappers_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const ImportWrapper& entry = it->second;
+    if (entry.code == nullptr || entry.target == nullptr ||
+        entry.native_context == nullptr) {
+      continue;
+    }
+    if (*entry.target != *target) continue;
+    if (*entry.native_context != *isolate->native_context()) continue;
+    if (entry.sig_index != sig_index || entry.origin != origin) continue;
+    return handle(Code::cast(*entry.code), isolate);
+  }
+
+  Handle<Code> code = compiler::CompileWasmToJSWrapper(
+      isolate, target, sig, index, module_name, import_name, origin);
+  if (code.is_null()) return code;
+
+  if (import_wrappers_.size() >= next_cleanup_) RemoveDeadImportWrappers();
+  GlobalHandles* global_handles = isolate->global_handles();
+  ImportWrapper& entry =
+      import_wrappers_.emplace(hash, ImportWrapper())->second;
+  entry.target =
+      global_handles->Create(static_cast<Object*>(*target)).location();
+  entry.native_context =
+      global_handles->Create(static_cast<Object*>(*isolate->native_context()))
+          .location();
+  entry.code = global_handles->Create(static_cast<Object*>(*code)).location();
+  entry.sig_index = sig_index;
+  entry.origin = origin;
+  // The entry lives in a node of {import_wrappers_}, so the addresses of its
+  // fields are stable until it is erased.
+  GlobalHandles::MakeWeak(&entry.target);
+  GlobalHandles::MakeWeak(&entry.native_context);
+  GlobalHandles::MakeWeak(&entry.code);
+  return code;
+}
+
+void WrapperCache::RemoveDeadImportWrappers() {
+  for (auto it = import_wrappers_.begin(); it != import_wrappers_.end();) {
+    ImportWrapper& entry = it->second;
+    if (entry.code != nullptr && entry.target != nullptr &&
+        entry.native_context != nullptr) {
+      ++it;
+      continue;
+    }
+    DestroyGlobalHandle(entry.target);
+    DestroyGlobalHandle(entry.native_context);
+    DestroyGlobalHandle(entry.code);
+    it = import_wrappers_.erase(it);
+  }
+  next_cleanup_ =
+      std::max(kInitialCleanupThreshold, 2 * import_wrappers_.size());
+}
+
+void WrapperCache::TearDown() {
+  for (Object** location : js_to_wasm_wrappers_) DestroyGlobalHandle(location);
+  js_to_wasm_wrappers_.clear();
+  for (auto& it : import_wrappers_) {
+    DestroyGlobalHandle(it.second.target);
+    DestroyGlobalHandle(it.second.native_context);
+    DestroyGlobalHandle(it.second.code);
+  }
+  import_wrappers_.clear();
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,84 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_WASM_WRAPPER_CACHE_H_
+#define V8_WASM_WRAPPER_CACHE_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "src/handles.h"
+#include "src/wasm/signature-map.h"
+#include "src/wasm/wasm-module.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+// The WrapperCache shares the code of JS-to-wasm and wasm-to-JS wrappers
+// between all modules and instances of an isolate.
+// JS-to-wasm wrappers only depend on the signature of the wrapped function, so
+// one template per signature is kept alive and copied for each export.
+// Wasm-to-JS wrappers embed the imported callable and the native context, so
+// they are shared between all imports of the same callable with the same
+// signature from the same native context. They are held weakly and die
+// together with the last instance that uses them.
+class WrapperCache {
+ public:
+  WrapperCache();
+  ~WrapperCache();
+
+  // Returns a new JS-to-wasm wrapper calling {wasm_code}, the code of the
+  // function at {index} of {module}.
+  Handle<Code> GetJSToWasmWrapper(Isolate* isolate, const WasmModule* module,
+                                  Handle<Code> wasm_code, uint32_t index);
+
+  // Returns a wasm-to-JS wrapper calling {target} with signature {sig}. The
+  // returned code may be used by other instances as well.
+  Handle<Code> GetWasmToJSWrapper(Isolate* isolate, Handle<JSReceiver> target,
+                                  FunctionSig* sig, uint32_t index,
+                                  Handle<String> module_name,
+                                  MaybeHandle<String> import_name,
+                                  ModuleOrigin origin);
+
+  // Releases all cached code. Must be called before the heap is torn down.
+  void TearDown();
+
+ private:
+  struct ImportWrapper {
+    // Weak global handles, reset when the object dies.
+    Object** target;
+    Object** native_context;
+    Object** code;
+    uint32_t sig_index;
+    ModuleOrigin origin;
+  };
+
+  // Returns the index of {sig} in {sig_map_}, inserting a copy of it that
+  // lives as long as this cache if necessary.
+  uint32_t CanonicalizeSignature(FunctionSig* sig);
+
+  void RemoveDeadImportWrappers();
+
+  AccountingAllocator allocator_;
+  Zone zone_;
+  SignatureMap sig_map_;
+  // Strong global handles to JS-to-wasm wrapper templates, indexed by
+  // signature index. The call to the wasm function in each template targets
+  // the {Illegal} builtin, so that it does not keep any wasm code alive.
+  std::vector<Object**> js_to_wasm_wrappers_;
+  // Wasm-to-JS wrappers, keyed by the identity hash of their target.
+  std::unordered_multimap<int, ImportWrapper> import_wrappers_;
+  size_t next_cleanup_;
+
+  DISALLOW_COPY_AND_ASSIGN(WrapperCache);
+};
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_WRAPPER_CACHE_H_
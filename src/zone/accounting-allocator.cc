@@ -62,7 +62,7 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
     if (total_size + (size_t(1) << (power + kMinSegmentSizePower)) <=
         max_pool_size) {
       unused_segments_max_sizes_[power] = fits_fully + 1;
-      total_size += size_t(1) << power;
+      total_size += size_t(1) << (power + kMinSegmentSizePower);
     } else {
       unused_segments_max_sizes_[power] = fits_fully;
     }
@@ -123,6 +123,10 @@ size_t AccountingAllocator::GetCurrentPoolSize() const {
   return base::Relaxed_Load(&current_pool_size_);
 }
 
+size_t AccountingAllocator::GetSegmentReuseCount() const {
+  return base::Relaxed_Load(&segment_reuse_count_);
+}
+
 Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size) {
   if (requested_size > (1 << kMaxSegmentSizePower)) {
     return nullptr;
@@ -152,6 +156,7 @@ Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size) {
 
   if (segment) {
     DCHECK_GE(segment->size(), requested_size);
+    base::Relaxed_AtomicIncrement(&segment_reuse_count_, 1);
   }
   return segment;
 }
@@ -159,7 +164,10 @@ Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size) {
 bool AccountingAllocator::AddSegmentToPool(Segment* segment) {
   size_t size = segment->size();
 
-  if (size >= (1 << (kMaxSegmentSizePower + 1))) return false;
+  // Zones allocate segments above the maximum segment size for large
+  // objects. Those would not fit into the limits set up by
+  // ConfigureSegmentPool, so they are never pooled.
+  if (size > (static_cast<size_t>(1) << kMaxSegmentSizePower)) return false;
 
   if (size < (1 << kMinSegmentSizePower)) return false;
 
@@ -194,10 +202,13 @@ void AccountingAllocator::ClearPool() {
     Segment* current = unused_segments_heads_[power];
     while (current) {
       Segment* next = current->next();
+      base::Relaxed_AtomicIncrement(
+          &current_pool_size_, -static_cast<base::AtomicWord>(current->size()));
       FreeSegment(current);
       current = next;
     }
     unused_segments_heads_[power] = nullptr;
+    unused_segments_sizes_[power] = 0;
   }
 }
 
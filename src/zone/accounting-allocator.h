@@ -20,7 +20,9 @@ namespace internal {
 
 class V8_EXPORT_PRIVATE AccountingAllocator {
  public:
-  static const size_t kMaxPoolSize = 8ul * KB;
+  // Enough to keep one segment of each size class, so that the zones of a
+  // finished compilation can be reused by the next one.
+  static const size_t kMaxPoolSize = 2ul * MB;
 
   AccountingAllocator();
   virtual ~AccountingAllocator();
@@ -35,6 +37,9 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   size_t GetMaxMemoryUsage() const;
 
   size_t GetCurrentPoolSize() const;
+  // Returns the number of segments that were handed out from the pool instead
+  // of being freshly allocated.
+  size_t GetSegmentReuseCount() const;
 
   void MemoryPressureNotification(MemoryPressureLevel level);
   // Configures the zone segment pool size limits so the pool does not
@@ -48,9 +53,11 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
  private:
   FRIEND_TEST(Zone, SegmentPoolConstraints);
+  FRIEND_TEST(Zone, SegmentPoolSkipsOversizedSegments);
 
   static const size_t kMinSegmentSizePower = 13;
-  static const size_t kMaxSegmentSizePower = 18;
+  // Zone::kMaximumSegmentSize is 1 MB.
+  static const size_t kMaxSegmentSizePower = 20;
 
   STATIC_ASSERT(kMinSegmentSizePower <= kMaxSegmentSizePower);
 
@@ -79,6 +86,7 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   base::AtomicWord current_memory_usage_ = 0;
   base::AtomicWord max_memory_usage_ = 0;
   base::AtomicWord current_pool_size_ = 0;
+  base::AtomicWord segment_reuse_count_ = 0;
 
   base::AtomicValue<MemoryPressureLevel> memory_pressure_level_;
 
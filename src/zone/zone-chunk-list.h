@@ -350,7 +350,7 @@ typename ZoneChunkList<T>::SeekResult ZoneChunkList<T>::SeekIndex(
     size_t index) const {
   DCHECK_LT(index, size());
   Chunk* current = front_;
-  while (index > current->capacity_) {
+  while (index >= current->capacity_) {
     index -= current->capacity_;
     current = current->next_;
   }
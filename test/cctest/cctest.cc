@@ -259,8 +259,8 @@ int main(int argc, char* argv[]) {
   v8::V8::Initialize();
   v8::V8::InitializeExternalStartupData(argv[0]);
 
-  if (i::trap_handler::UseTrapHandler()) {
-    v8::V8::RegisterDefaultSignalHandler();
+  if (i::FLAG_wasm_trap_handler) {
+    v8::V8::EnableWebAssemblyTrapHandler(true);
   }
 
   CcTest::set_array_buffer_allocator(
@@ -183,6 +183,7 @@
       'test-random-number-generator.cc',
       'test-regexp.cc',
       'test-representation.cc',
+      'test-ryu-dtoa.cc',
       'test-sampler-api.cc',
       'test-serialize.cc',
       'test-strings.cc',
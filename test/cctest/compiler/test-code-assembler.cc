@@ -94,6 +94,26 @@ TEST(SimpleCallRuntime1Arg) {
   CHECK_EQ(0, Handle<Smi>::cast(result.ToHandleChecked())->value());
 }
 
+TEST(IsolateDependentCode) {
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  {
+    // Embedded heap objects are specific to the isolate.
+    CodeAssemblerTester data(isolate);
+    CodeAssembler m(data.state());
+    m.Return(m.HeapConstant(isolate->factory()->NewFixedArray(1, TENURED)));
+    CHECK(!data.GenerateCode()->IsIsolateIndependent());
+  }
+  {
+    // So are calls to the runtime.
+    CodeAssemblerTester data(isolate);
+    CodeAssembler m(data.state());
+    Node* context = m.HeapConstant(Handle<Context>(isolate->native_context()));
+    m.Return(m.CallRuntime(Runtime::kNumberToSmi, context,
+                           SmiTag(m, m.Int32Constant(0))));
+    CHECK(!data.GenerateCode()->IsIsolateIndependent());
+  }
+}
+
 TEST(SimpleTailCallRuntime1Arg) {
   Isolate* isolate(CcTest::InitIsolateOnce());
   CodeAssemblerTester data(isolate);
@@ -16,9 +16,12 @@
   V(CompactionPartiallyAbortedPageWithStoreBufferEntries) \
   V(CompactionSpaceDivideMultiplePages)                   \
   V(CompactionSpaceDivideSinglePage)                      \
+  V(ConcurrentLocalAllocationBufferRefills)               \
   V(TestNewSpaceRefsInCopiedCode)                         \
   V(GCFlags)                                              \
+  V(LocalAllocationBufferInOldSpace)                      \
   V(MarkCompactCollector)                                 \
+  V(MemoryTargetLimitsHeapGrowth)                         \
   V(NoPromotion)                                          \
   V(NumberStringCacheSize)                                \
   V(ObjectGroups)                                         \
@@ -26,6 +29,7 @@
   V(Regression39128)                                      \
   V(ResetWeakHandle)                                      \
   V(StressHandles)                                        \
+  V(SweeperTasksSweepCodeAndMapSpace)                     \
   V(TestMemoryReducerSampleJsCalls)                       \
   V(TestSizeOfObjects)                                    \
   V(Regress587004)                                        \
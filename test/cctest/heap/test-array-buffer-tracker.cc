@@ -367,5 +367,52 @@ TEST(ArrayBuffer_RetainedSizeDecreases) {
   CHECK_EQ(0, retained_after - retained_before);
 }
 
+namespace {
+
+class CountingArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
+ public:
+  void* Allocate(size_t length) override { return calloc(length, 1); }
+  void* AllocateUninitialized(size_t length) override { return malloc(length); }
+  void Free(void* data, size_t length) override {
+    free(data);
+    freed_.Increment(1);
+  }
+
+  int freed() { return freed_.Value(); }
+
+ private:
+  base::AtomicNumber<int> freed_;
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(ArrayBuffer_CollectorFreesBackingStores) {
+  FLAG_concurrent_array_buffer_freeing = false;
+  CountingArrayBufferAllocator allocator;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  int freed_before_teardown;
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+    const int freed_before = allocator.freed();
+    {
+      v8::HandleScope inner_scope(isolate);
+      v8::ArrayBuffer::New(isolate, 100);
+    }
+    Local<v8::ArrayBuffer> live = v8::ArrayBuffer::New(isolate, 100);
+    heap::GcAndSweep(heap, NEW_SPACE);
+    CHECK_EQ(freed_before + 1, allocator.freed());
+    CHECK(IsTracked(*v8::Utils::OpenHandle(*live)));
+    freed_before_teardown = allocator.freed();
+  }
+  // The backing store of the buffer that is still alive is freed on tear down.
+  isolate->Dispose();
+  CHECK_LT(freed_before_teardown, allocator.freed());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/factory.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/mark-compact.h"
 #include "src/isolate.h"
 // FIXME(mstarzinger, marja): This is weird, but required because of the missing
@@ -370,5 +371,96 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithStoreBufferEntries) {
   }
 }
 
+namespace {
+
+// Replaces all recorded compaction events so that the estimated compaction
+// speed is exactly {bytes_per_ms}.
+void SetCompactionSpeed(Heap* heap, size_t bytes_per_ms) {
+  for (int i = 0; i < base::RingBuffer<BytesAndDuration>::kSize; i++) {
+    heap->tracer()->AddCompactionEvent(1.0, bytes_per_ms);
+  }
+}
+
+int SelectEvacuationCandidates(Heap* heap, size_t* selected_live_bytes) {
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  int candidates = 0;
+  *selected_live_bytes = 0;
+  collector->StartCompaction();
+  for (PagedSpace* space : {static_cast<PagedSpace*>(heap->old_space()),
+                            static_cast<PagedSpace*>(heap->code_space())}) {
+    for (Page* page : *space) {
+      if (!page->IsEvacuationCandidate()) continue;
+      candidates++;
+      *selected_live_bytes += page->LiveBytesFromFreeList();
+    }
+  }
+  collector->AbortCompaction();
+  return candidates;
+}
+
+}  // namespace
+
+TEST(CompactionPauseTargetLimitsEvacuationCandidates) {
+  if (FLAG_never_compact) return;
+  FLAG_concurrent_sweeping = false;
+  FLAG_concurrent_marking = false;
+  FLAG_stress_incremental_marking = false;
+  FLAG_compaction_pause_target_ms = 1;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  // Fill fresh pages with arrays and keep every tenth of them alive, so that
+  // each page is about 90% free after the next GC.
+  const int kPages = 8;
+  const int kKeepEvery = 10;
+  heap::SealCurrentObjects(heap);
+  Handle<FixedArray> holder;
+  {
+    HandleScope fill_scope(isolate);
+    std::vector<Handle<FixedArray>> arrays;
+    for (int i = 0; i < kPages; i++) {
+      std::vector<Handle<FixedArray>> page_arrays =
+          heap::FillOldSpacePageWithFixedArrays(heap, 0);
+      arrays.insert(arrays.end(), page_arrays.begin(), page_arrays.end());
+    }
+    Handle<FixedArray> live = isolate->factory()->NewFixedArray(
+        static_cast<int>(arrays.size() / kKeepEvery) + 1);
+    for (size_t i = 0; i < arrays.size(); i += kKeepEvery) {
+      live->set(static_cast<int>(i / kKeepEvery), *arrays[i]);
+    }
+    holder = fill_scope.CloseAndEscape(live);
+  }
+  FLAG_never_compact = true;
+  CcTest::CollectAllGarbage();
+  heap->mark_compact_collector()->EnsureSweepingCompleted();
+  FLAG_never_compact = false;
+
+  Page* fragmented_page =
+      Page::FromAddress(HeapObject::cast(holder->get(0))->address());
+  size_t live_bytes_per_page = fragmented_page->LiveBytesFromFreeList();
+  CHECK_GT(live_bytes_per_page, 0);
+
+  // With a compaction speed of three pages' worth of live bytes per
+  // millisecond, the pause target admits only a few of the fragmented pages.
+  const size_t small_budget = 3 * live_bytes_per_page;
+  SetCompactionSpeed(heap, small_budget);
+  size_t selected_live_bytes = 0;
+  int small_budget_candidates =
+      SelectEvacuationCandidates(heap, &selected_live_bytes);
+  CHECK_GT(small_budget_candidates, 0);
+  CHECK_LE(selected_live_bytes, small_budget);
+
+  // A budget that covers all fragmented pages selects all of them.
+  const size_t large_budget = 100 * live_bytes_per_page;
+  SetCompactionSpeed(heap, large_budget);
+  int large_budget_candidates =
+      SelectEvacuationCandidates(heap, &selected_live_bytes);
+  CHECK_GE(large_budget_candidates, kPages - 1);
+  CHECK_GT(large_budget_candidates, small_budget_candidates);
+  CHECK_LE(selected_live_bytes, large_budget);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,6 +6,7 @@
 
 #include "src/v8.h"
 
+#include "src/heap/concurrent-marking-deque.h"
 #include "src/heap/concurrent-marking.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
@@ -21,10 +22,55 @@ TEST(ConcurrentMarking) {
   ConcurrentMarkingDeque deque(heap);
   deque.Push(heap->undefined_value());
   ConcurrentMarking* concurrent_marking = new ConcurrentMarking(heap, &deque);
-  concurrent_marking->StartTask();
-  concurrent_marking->WaitForTaskToComplete();
+  concurrent_marking->ScheduleTasks();
+  concurrent_marking->EnsureCompleted();
+  CHECK(!concurrent_marking->IsTaskPending());
+  // Tasks that were cancelled before running leave their work behind.
+  deque.Clear();
   delete concurrent_marking;
 }
 
+TEST(ConcurrentMarkingReschedule) {
+  if (!i::FLAG_concurrent_marking) return;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  ConcurrentMarkingDeque deque(heap);
+  deque.Push(heap->undefined_value());
+  ConcurrentMarking* concurrent_marking = new ConcurrentMarking(heap, &deque);
+  concurrent_marking->ScheduleTasks();
+  concurrent_marking->EnsureCompleted();
+  deque.Push(heap->undefined_value());
+  concurrent_marking->RescheduleTasksIfNeeded();
+  concurrent_marking->EnsureCompleted();
+  CHECK(!concurrent_marking->IsTaskPending());
+  deque.Clear();
+  delete concurrent_marking;
+}
+
+TEST(ConcurrentMarkingInAtomicPause) {
+  if (!i::FLAG_concurrent_marking) return;
+  i::FLAG_parallel_marking_finalization = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  HandleScope scope(isolate);
+  const int kLength = 1024;
+  Handle<FixedArray> outer =
+      isolate->factory()->NewFixedArray(kLength, TENURED);
+  heap::SimulateIncrementalMarking(heap, false);
+  // Objects allocated and linked after the start of marking are reachable
+  // only through the strong roots and the write barrier.
+  for (int i = 0; i < kLength; i++) {
+    Handle<FixedArray> inner = isolate->factory()->NewFixedArray(1, TENURED);
+    inner->set(0, Smi::FromInt(i));
+    outer->set(i, *inner);
+  }
+  CcTest::CollectAllGarbage();
+  for (int i = 0; i < kLength; i++) {
+    FixedArray* inner = FixedArray::cast(outer->get(i));
+    CHECK_EQ(Smi::FromInt(i), inner->get(0));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -46,6 +46,7 @@
 #include "src/ic/ic.h"
 #include "src/macro-assembler-inl.h"
 #include "src/objects-inl.h"
+#include "src/objects/frame-array-inl.h"
 #include "src/regexp/jsregexp.h"
 #include "src/snapshot/snapshot.h"
 #include "src/transitions.h"
@@ -1323,6 +1324,86 @@ TEST(CompilationCacheCachingBehavior) {
   CHECK(!pair.has_shared());
 }
 
+TEST(CompilationCacheEvalGenerations) {
+  if (!FLAG_compilation_cache) return;
+  FLAG_eval_cache_generations = 2;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+
+  v8::HandleScope scope(CcTest::isolate());
+  const char* raw_source = "var evaluated = 42;";
+  Handle<String> source = factory->InternalizeUtf8String(raw_source);
+  Handle<Context> native_context = isolate->native_context();
+  Handle<SharedFunctionInfo> outer_info(native_context->closure()->shared());
+
+  // Indirect eval is cached once the same source was compiled twice.
+  for (int i = 0; i < 2; i++) {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun("(0, eval)('var evaluated = 42;')");
+  }
+  InfoVectorPair pair = compilation_cache->LookupEval(
+      source, outer_info, native_context, SLOPPY, 0);
+  CHECK(pair.has_shared());
+
+  // An entry that is used survives every GC, an unused one is evicted after
+  // --eval-cache-generations GCs.
+  CcTest::CollectAllGarbage();
+  pair = compilation_cache->LookupEval(source, outer_info, native_context,
+                                       SLOPPY, 0);
+  CHECK(pair.has_shared());
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+  pair = compilation_cache->LookupEval(source, outer_info, native_context,
+                                       SLOPPY, 0);
+  CHECK(!pair.has_shared());
+}
+
+TEST(BytecodeFlushing) {
+  if (!FLAG_age_code || FLAG_always_opt) return;
+  FLAG_flush_bytecode = true;
+  FLAG_stress_incremental_marking = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "function foo() {"
+      "  var x = 42;"
+      "  var y = 42;"
+      "  return x + y;"
+      "};"
+      "foo();");
+  Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+  Handle<JSFunction> foo = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(), foo_name)
+          .ToHandleChecked());
+  CHECK(foo->shared()->HasBytecodeArray());
+
+  // Young bytecode survives a full GC.
+  CcTest::CollectAllGarbage();
+  CHECK(foo->shared()->is_compiled());
+  CHECK(foo->is_compiled());
+
+  // Progress the bytecode age until it's old and ready for flushing.
+  const int kAgingThreshold = 6;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    foo->shared()->bytecode_array()->MakeOlder();
+  }
+  CcTest::CollectAllGarbage();
+  CHECK(!foo->shared()->is_compiled());
+  CHECK(!foo->shared()->HasBytecodeArray());
+  CHECK(!foo->is_compiled());
+
+  // The next call recompiles the function lazily.
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  CHECK_EQ(84, CompileRun("foo();")->Int32Value(context).FromJust());
+  CHECK(foo->shared()->HasBytecodeArray());
+  CHECK(foo->is_compiled());
+}
+
 
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
@@ -1934,6 +2015,41 @@ TEST(GrowAndShrinkNewSpace) {
   CHECK_EQ(old_capacity, new_capacity);
 }
 
+TEST(ResizeNewSpaceGradually) {
+  FLAG_predictable = true;
+
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  NewSpace* new_space = heap->new_space();
+
+  if (heap->MaxSemiSpaceSize() == heap->InitialSemiSpaceSize()) {
+    return;
+  }
+
+  CcTest::CollectAllGarbage();
+  const size_t initial_capacity = new_space->TotalCapacity();
+
+  // Growing towards the maximum takes one growth factor at a time.
+  new_space->ResizeTowards(new_space->MaximumCapacity());
+  size_t capacity = new_space->TotalCapacity();
+  CHECK_EQ(Min(new_space->MaximumCapacity(),
+               static_cast<size_t>(FLAG_semi_space_growth_factor) *
+                   initial_capacity),
+           capacity);
+
+  // Resizing towards the current capacity does nothing.
+  new_space->ResizeTowards(capacity);
+  CHECK_EQ(capacity, new_space->TotalCapacity());
+
+  // Shrinking halves the capacity at most and stops at the initial capacity.
+  CcTest::CollectGarbage(NEW_SPACE);
+  new_space->ResizeTowards(0);
+  CHECK_GE(new_space->TotalCapacity(), capacity / 2);
+  CHECK_LT(new_space->TotalCapacity(), capacity);
+  for (int i = 0; i < 10; i++) new_space->ResizeTowards(0);
+  CHECK_EQ(initial_capacity, new_space->TotalCapacity());
+}
+
 TEST(CollectingAllAvailableGarbageShrinksNewSpace) {
   CcTest::InitializeVM();
   Heap* heap = CcTest::heap();
@@ -5316,22 +5432,15 @@ TEST(PreprocessStackTrace) {
   Handle<Name> key = isolate->factory()->stack_trace_symbol();
   Handle<Object> stack_trace =
       Object::GetProperty(exception, key).ToHandleChecked();
-  Handle<Object> code =
-      Object::GetElement(isolate, stack_trace, 3).ToHandleChecked();
-  CHECK(code->IsCode());
+  CHECK(stack_trace->IsFrameArray());
+  Handle<FrameArray> frame_array = Handle<FrameArray>::cast(stack_trace);
+  CHECK(frame_array->get(3)->IsAbstractCode());
 
   CcTest::CollectAllAvailableGarbage();
 
-  Handle<Object> pos =
-      Object::GetElement(isolate, stack_trace, 3).ToHandleChecked();
-  CHECK(pos->IsSmi());
-
-  Handle<JSArray> stack_trace_array = Handle<JSArray>::cast(stack_trace);
-  int array_length = Smi::cast(stack_trace_array->length())->value();
-  for (int i = 0; i < array_length; i++) {
-    Handle<Object> element =
-        Object::GetElement(isolate, stack_trace, i).ToHandleChecked();
-    CHECK(!element->IsCode());
+  CHECK(frame_array->get(3)->IsSmi());
+  for (int i = 0; i < frame_array->length(); i++) {
+    CHECK(!frame_array->get(i)->IsAbstractCode());
   }
 }
 
@@ -6153,6 +6262,50 @@ TEST(ContinuousRightTrimFixedArrayInBlackArea) {
   heap::GcAndSweep(heap, OLD_SPACE);
 }
 
+TEST(BlackAllocationDoesNotAddMarkingWork) {
+  if (!FLAG_incremental_marking) return;
+  FLAG_black_allocation = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Isolate* isolate = heap->isolate();
+  CcTest::CollectAllGarbage();
+
+  i::MarkCompactCollector* collector = heap->mark_compact_collector();
+  i::IncrementalMarking* marking = heap->incremental_marking();
+  if (collector->sweeping_in_progress()) {
+    collector->EnsureSweepingCompleted();
+  }
+  CHECK(marking->IsMarking() || marking->IsStopped());
+  if (marking->IsStopped()) {
+    heap->StartIncrementalMarking(i::Heap::kNoGCFlags,
+                                  i::GarbageCollectionReason::kTesting);
+  }
+  CHECK(marking->IsMarking());
+  marking->StartBlackAllocationForTesting();
+
+  heap::SimulateFullSpace(heap->old_space());
+  size_t step_size_before =
+      marking->StepSizeToKeepUpWithAllocationsForTesting();
+
+  // Both arrays are allocated in a fresh black area.
+  Handle<FixedArray> first = isolate->factory()->NewFixedArray(10, TENURED);
+  Handle<FixedArray> second = isolate->factory()->NewFixedArray(100, TENURED);
+  CHECK(ObjectMarking::IsBlack(*first, MarkingState::Internal(*first)));
+  CHECK(ObjectMarking::IsBlack(*second, MarkingState::Internal(*second)));
+  int64_t allocated = first->Size() + second->Size();
+
+  // Black allocated bytes do not count towards the allocation-driven step
+  // size, as they need no marking.
+  size_t step_size_after =
+      marking->StepSizeToKeepUpWithAllocationsForTesting();
+  int64_t step_size_increase =
+      static_cast<int64_t>(step_size_after - step_size_before);
+  CHECK_LT(step_size_increase, allocated);
+
+  heap::GcAndSweep(heap, OLD_SPACE);
+}
+
 TEST(Regress618958) {
   if (!FLAG_incremental_marking) return;
   CcTest::InitializeVM();
@@ -6380,5 +6533,220 @@ HEAP_TEST(RegressMissingWriteBarrierInAllocate) {
   CHECK(object->map()->IsMap());
 }
 
+TEST(ParallelScavengePreservesObjectGraph) {
+  FLAG_parallel_scavenge = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  // An old space array holding references to young objects exercises the
+  // old-to-new remembered set, while the handles exercise the roots.
+  const int kLength = 1024;
+  Handle<FixedArray> old_array = factory->NewFixedArray(kLength, TENURED);
+  Handle<FixedArray> young_array = factory->NewFixedArray(kLength);
+  for (int i = 0; i < kLength; i++) {
+    Handle<FixedArray> inner = factory->NewFixedArray(2);
+    inner->set(0, Smi::FromInt(i));
+    inner->set(1, *young_array);
+    old_array->set(i, *inner);
+    young_array->set(i, *inner);
+  }
+  CHECK(!heap->InNewSpace(*old_array));
+  CHECK(heap->InNewSpace(*young_array));
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  CcTest::CollectGarbage(NEW_SPACE);
+
+  for (int i = 0; i < kLength; i++) {
+    FixedArray* inner = FixedArray::cast(old_array->get(i));
+    CHECK_EQ(inner, young_array->get(i));
+    CHECK_EQ(Smi::FromInt(i), inner->get(0));
+    CHECK_EQ(*young_array, inner->get(1));
+  }
+}
+
+static int CountUnsweptPages(PagedSpace* space) {
+  int count = 0;
+  for (Page* page : *space) {
+    if (!page->SweepingDone()) count++;
+  }
+  return count;
+}
+
+HEAP_TEST(SweeperTasksSweepCodeAndMapSpace) {
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  // Keep the sweeper tasks from starting so that the main thread can sweep
+  // with the budget of a single task.
+  heap->delay_sweeper_tasks_for_testing_ = true;
+  CcTest::CollectAllGarbage();
+  CHECK(collector->sweeping_in_progress());
+  int code_and_map_pages = CountUnsweptPages(heap->code_space()) +
+                           CountUnsweptPages(heap->map_space());
+  int old_pages = CountUnsweptPages(heap->old_space());
+  CHECK_GT(code_and_map_pages, 0);
+  // Sweeping as many pages as there are unswept code and map pages finishes
+  // those spaces before any old space page is touched.
+  collector->sweeper().SweepSpacesInTaskOrder(code_and_map_pages);
+  CHECK_EQ(0, CountUnsweptPages(heap->code_space()));
+  CHECK_EQ(0, CountUnsweptPages(heap->map_space()));
+  CHECK_EQ(old_pages, CountUnsweptPages(heap->old_space()));
+  heap->delay_sweeper_tasks_for_testing_ = false;
+  collector->sweeper().StartSweeperTasks();
+  collector->EnsureSweepingCompleted();
+  CHECK_EQ(0, CountUnsweptPages(heap->old_space()));
+  // Code lookup relies on the skip lists rebuilt by the sweeper.
+  Isolate* isolate = CcTest::i_isolate();
+  InnerPointerToCodeCache* cache = isolate->inner_pointer_to_code_cache();
+  Code* code = isolate->builtins()->builtin(Builtins::kIllegal);
+  CHECK_EQ(code,
+           cache->GcSafeFindCodeForInnerPointer(code->instruction_start()));
+}
+
+TEST(ReadOnlyRootsStayUnchanged) {
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  for (int i = 0; i < Heap::kStrongRootListLength; i++) {
+    if (!Heap::RootIsReadOnly(i)) continue;
+    Object* root = heap->root(static_cast<Heap::RootListIndex>(i));
+    CHECK(root->IsOddball() || root->IsHeapNumber() ||
+          root->IsFixedArrayBase() || root->IsInternalizedString());
+  }
+  CompileRun("var o = { length: NaN, name: undefined }; o.length = -0;");
+  CcTest::CollectAllGarbage();
+#ifdef VERIFY_HEAP
+  heap->VerifyReadOnlyRoots();
+#endif
+}
+
+static Handle<AllocationSite> LiteralSite(const char* name) {
+  Handle<JSFunction> function = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(CompileRun(name))));
+  Handle<FeedbackVector> vector(function->feedback_vector());
+  FeedbackMetadataIterator it(vector->metadata());
+  while (it.HasNext()) {
+    FeedbackSlot slot = it.Next();
+    if (it.kind() != FeedbackSlotKind::kLiteral) continue;
+    return handle(AllocationSite::cast(vector->Get(slot)));
+  }
+  UNREACHABLE();
+  return Handle<AllocationSite>();
+}
+
+UNINITIALIZED_TEST(PretenuringDecisionsSurviveIsolates) {
+  if (!FLAG_allocation_site_pretenuring) return;
+  static const char* source =
+      "function cached() { return { a: [1, 2, 3] }; }"
+      "function transient() { return { b: 1 }; }"
+      "cached(); transient();";
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::StartupData decisions;
+  {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Context::New(isolate)->Enter();
+      CompileRun(source);
+      // Pretend that allocation-site feedback decided to tenure the first
+      // literal.
+      LiteralSite("cached")->set_pretenure_decision(AllocationSite::kTenure);
+      decisions = isolate->GetPretenuringDecisions();
+    }
+    isolate->Dispose();
+  }
+  {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Context::New(isolate)->Enter();
+      CHECK(isolate->SetPretenuringDecisions(decisions));
+      CompileRun(source);
+      CHECK_EQ(AllocationSite::kTenure,
+               LiteralSite("cached")->pretenure_decision());
+      CHECK_EQ(AllocationSite::kUndecided,
+               LiteralSite("transient")->pretenure_decision());
+      // Data that does not match this configuration is rejected.
+      const_cast<char*>(decisions.data)[0] ^= 0xff;
+      CHECK(!isolate->SetPretenuringDecisions(decisions));
+    }
+    isolate->Dispose();
+  }
+  delete[] decisions.data;
+}
+
+namespace {
+
+class TestMemoryTarget : public v8::MemoryTarget {
+ public:
+  explicit TestMemoryTarget(size_t target) : target_(target) {}
+  size_t TargetResidentSetSize() override { return target_; }
+  size_t ExternalMemoryBudget() override { return MB; }
+
+ private:
+  size_t target_;
+};
+
+}  // namespace
+
+HEAP_TEST(MemoryTargetLimitsHeapGrowth) {
+  if (FLAG_heap_growing_percent > 0) return;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Heap* heap = CcTest::heap();
+  // A target below the current heap size is always near.
+  TestMemoryTarget target(1);
+  isolate->SetMemoryTarget(&target);
+  CHECK(heap->memory_reducer_->IsNearMemoryTarget());
+  CHECK_EQ(0u, heap->memory_reducer_->MemoryTargetHeadroom());
+  CcTest::CollectAllGarbage();
+  size_t old_gen_size = heap->PromotedSpaceSizeOfObjects();
+  CHECK_LE(heap->old_generation_allocation_limit(),
+           heap->CalculateOldGenerationAllocationLimit(
+               Heap::kMinHeapGrowingFactor, old_gen_size));
+  CHECK_LE(heap->external_memory_limit_,
+           Max<int64_t>(MB, heap->external_memory_ +
+                                kExternalAllocationSoftLimit / 16));
+  isolate->SetMemoryTarget(nullptr);
+  CHECK(!heap->memory_reducer_->IsNearMemoryTarget());
+}
+
+TEST(StringDeduplication) {
+  if (!FLAG_thin_strings) return;
+  FLAG_string_deduplication = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  const char* kText = "a string that is long enough to shrink";
+  Handle<String> first = factory->NewStringFromAsciiChecked(kText, TENURED);
+  Handle<String> second = factory->NewStringFromAsciiChecked(kText, TENURED);
+  Handle<String> other =
+      factory->NewStringFromAsciiChecked("a different string", TENURED);
+  CcTest::CollectAllGarbage();
+  // One copy becomes the canonical internalized string.
+  CHECK(first->IsInternalizedString());
+  CHECK(second->IsThinString());
+  CHECK_EQ(*first, ThinString::cast(*second)->actual());
+  CHECK(other->IsSeqString());
+  CHECK(!other->IsInternalizedString());
+
+  // Strings equal to an internalized string point to it.
+  Handle<String> internalized =
+      factory->InternalizeUtf8String("an internalized string value");
+  Handle<String> copy = factory->NewStringFromAsciiChecked(
+      "an internalized string value", TENURED);
+  CcTest::CollectAllGarbage();
+  CHECK(copy->IsThinString());
+  CHECK_EQ(*internalized, ThinString::cast(*copy)->actual());
+  CHECK(String::Equals(copy, internalized));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -27,6 +27,8 @@
 
 #include <stdlib.h>
 
+#include <set>
+
 #include "src/base/platform/platform.h"
 #include "src/heap/spaces-inl.h"
 // FIXME(mstarzinger, marja): This is weird, but required because of the missing
@@ -433,6 +435,36 @@ TEST(LargeObjectSpace) {
   CHECK(lo->AllocateRaw(lo_size, NOT_EXECUTABLE).IsRetry());
 }
 
+TEST(FreeUnmarkedLargeObjects) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  LargeObjectSpace* lo = heap->lo_space();
+  CcTest::CollectAllGarbage();
+  int initial_page_count = lo->PageCount();
+
+  const int kNumberOfObjects = 16;
+  Address addresses[kNumberOfObjects];
+  {
+    HandleScope scope(isolate);
+    for (int i = 0; i < kNumberOfObjects; i++) {
+      Handle<FixedArray> array = isolate->factory()->NewFixedArray(
+          FixedArray::kMaxRegularLength + 1, TENURED);
+      CHECK(lo->Contains(*array));
+      addresses[i] = array->address();
+    }
+    CHECK_EQ(initial_page_count + kNumberOfObjects, lo->PageCount());
+  }
+
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(initial_page_count, lo->PageCount());
+  for (int i = 0; i < kNumberOfObjects; i++) {
+    CHECK_NULL(lo->FindPage(addresses[i]));
+    CHECK_NULL(lo->FindPageThreadSafe(addresses[i] + Page::kPageSize));
+  }
+  heap->memory_allocator()->unmapper()->WaitUntilCompleted();
+}
+
 TEST(SizeOfInitialHeap) {
   if (i::FLAG_always_opt) return;
   // Bootstrapping without a snapshot causes more allocations.
@@ -658,6 +690,68 @@ UNINITIALIZED_TEST(InlineAllocationObserverCadence) {
   isolate->Dispose();
 }
 
+class DelayedObserver : public Observer {
+ public:
+  explicit DelayedObserver(intptr_t step_size)
+      : Observer(step_size), bytes_(0) {}
+
+  void Step(int bytes_allocated, Address soon_object, size_t size) override {
+    Observer::Step(bytes_allocated, soon_object, size);
+    bytes_ += bytes_allocated;
+  }
+
+  bool AllowsDelayedSteps() const override { return true; }
+
+  int bytes() const { return bytes_; }
+
+ private:
+  int bytes_;
+};
+
+UNINITIALIZED_TEST(InlineAllocationObserverDelayedSteps) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    i_isolate->heap()->CollectAllGarbage(
+        i::Heap::kFinalizeIncrementalMarkingMask,
+        i::GarbageCollectionReason::kTesting);
+
+    NewSpace* new_space = i_isolate->heap()->new_space();
+
+    // A small step does not shrink the linear allocation area below the
+    // minimum, but all allocated bytes are still accounted for.
+    DelayedObserver delayed(128);
+    new_space->AddAllocationObserver(&delayed);
+    for (int i = 0; i < 512; ++i) {
+      AllocateUnaligned(new_space, 32);
+    }
+    new_space->RemoveAllocationObserver(&delayed);
+    const int kAllocated = 512 * 32;
+    const int kMinimumStep =
+        static_cast<int>(NewSpace::kMinimumInlineAllocationStep);
+    CHECK_GE(delayed.count(), 1);
+    CHECK_LE(delayed.count(), kAllocated / kMinimumStep + 1);
+    CHECK_LE(delayed.bytes(), kAllocated);
+    CHECK_GT(delayed.bytes(), kAllocated - 2 * kMinimumStep);
+
+    // Observers that need exact steps still get them.
+    Observer exact(512);
+    new_space->AddAllocationObserver(&exact);
+    for (int i = 0; i < 512; ++i) {
+      AllocateUnaligned(new_space, 32);
+    }
+    new_space->RemoveAllocationObserver(&exact);
+    CHECK_EQ(exact.count(), 32);
+  }
+  isolate->Dispose();
+}
+
 TEST(ShrinkPageToHighWaterMarkFreeSpaceEnd) {
   FLAG_stress_incremental_marking = false;
   CcTest::InitializeVM();
@@ -758,5 +852,122 @@ TEST(ShrinkPageToHighWaterMarkTwoWordFiller) {
   CHECK_EQ(0u, shrinked);
 }
 
+HEAP_TEST(LocalAllocationBufferInOldSpace) {
+  FLAG_stress_incremental_marking = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  PagedSpace* old_space = heap->old_space();
+
+  heap::SealCurrentObjects(heap);
+  old_space->EmptyAllocationInfo();
+  CHECK(old_space->Expand());
+
+  const int kMinSize = 4 * KB;
+  const int kMaxSize = 32 * KB;
+  const int kObjectSize = 4 * kPointerSize;
+  const size_t size_before = old_space->Size();
+  LocalAllocationBuffer buffer =
+      old_space->AllocateLocalAllocationBuffer(kMinSize, kMaxSize);
+  CHECK(buffer.IsValid());
+  // The buffer is trimmed to its maximum size and accounted as allocated.
+  CHECK_EQ(size_before + kMaxSize, old_space->Size());
+
+  int allocated = 0;
+  while (true) {
+    AllocationResult result =
+        buffer.AllocateRawAligned(kObjectSize, kWordAligned);
+    HeapObject* object = nullptr;
+    if (!result.To(&object)) break;
+    CHECK(old_space->Contains(object));
+    heap->CreateFillerObjectAt(object->address(), kObjectSize,
+                               ClearRecordedSlots::kNo);
+    allocated += kObjectSize;
+  }
+  CHECK_EQ(kMaxSize, allocated);
+
+  old_space->FreeLocalAllocationBuffer(&buffer);
+  CHECK(!buffer.IsValid());
+  CHECK_EQ(size_before + allocated, old_space->Size());
+}
+
+namespace {
+
+class LocalAllocationBufferThread : public v8::base::Thread {
+ public:
+  static const int kBuffers = 8;
+  static const int kBufferSize = 2 * KB;
+
+  explicit LocalAllocationBufferThread(PagedSpace* space)
+      : v8::base::Thread(Options("LocalAllocationBufferThread")),
+        space_(space) {}
+
+  void Run() override {
+    for (int i = 0; i < kBuffers; i++) {
+      LocalAllocationBuffer buffer =
+          space_->AllocateLocalAllocationBuffer(kBufferSize, kBufferSize);
+      CHECK(buffer.IsValid());
+      HeapObject* object = nullptr;
+      CHECK(buffer.AllocateRawAligned(kBufferSize, kWordAligned).To(&object));
+      space_->heap()->CreateFillerObjectAt(object->address(), kBufferSize,
+                                           ClearRecordedSlots::kNo);
+      addresses_[i] = object->address();
+    }
+  }
+
+  Address address(int i) const { return addresses_[i]; }
+
+ private:
+  PagedSpace* space_;
+  Address addresses_[kBuffers];
+};
+
+}  // namespace
+
+HEAP_TEST(ConcurrentLocalAllocationBufferRefills) {
+  FLAG_stress_incremental_marking = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  PagedSpace* old_space = heap->old_space();
+
+  heap::SealCurrentObjects(heap);
+  old_space->EmptyAllocationInfo();
+  CHECK(old_space->Expand());
+
+  const int kThreads = 2;
+  const int kBuffers = LocalAllocationBufferThread::kBuffers;
+  LocalAllocationBufferThread* threads[kThreads];
+  for (int i = 0; i < kThreads; i++) {
+    threads[i] = new LocalAllocationBufferThread(old_space);
+    threads[i]->Start();
+  }
+  // The main thread keeps allocating while the buffers are refilled.
+  for (int i = 0; i < 16; i++) {
+    isolate->factory()->NewFixedArray(16, TENURED);
+  }
+  for (int i = 0; i < kThreads; i++) threads[i]->Join();
+
+  // All buffers are disjoint.
+  std::set<Address> addresses;
+  for (int i = 0; i < kThreads; i++) {
+    for (int j = 0; j < kBuffers; j++) {
+      Address address = threads[i]->address(j);
+      CHECK(old_space->ContainsSlow(address));
+      CHECK(addresses.insert(address).second);
+    }
+  }
+  Address last = nullptr;
+  for (Address address : addresses) {
+    if (last != nullptr) {
+      CHECK_LE(last + LocalAllocationBufferThread::kBufferSize, address);
+    }
+    last = address;
+  }
+  for (int i = 0; i < kThreads; i++) delete threads[i];
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -44,6 +44,7 @@ class ProgramOptions final {
         top_level_(false),
         do_expressions_(false),
         async_iteration_(false),
+        duplicate_heap_numbers_(false),
         verbose_(false) {}
 
   bool Validate() const;
@@ -63,6 +64,7 @@ class ProgramOptions final {
   bool top_level() const { return top_level_; }
   bool do_expressions() const { return do_expressions_; }
   bool async_iteration() const { return async_iteration_; }
+  bool duplicate_heap_numbers() const { return duplicate_heap_numbers_; }
   bool verbose() const { return verbose_; }
   bool suppress_runtime_errors() const { return rebaseline_ && !verbose_; }
   std::vector<std::string> input_filenames() const { return input_filenames_; }
@@ -80,6 +82,7 @@ class ProgramOptions final {
   bool top_level_;
   bool do_expressions_;
   bool async_iteration_;
+  bool duplicate_heap_numbers_;
   bool verbose_;
   std::vector<std::string> input_filenames_;
   std::string output_filename_;
@@ -169,6 +172,8 @@ ProgramOptions ProgramOptions::FromCommandLine(int argc, char** argv) {
       options.do_expressions_ = true;
     } else if (strcmp(argv[i], "--async-iteration") == 0) {
       options.async_iteration_ = true;
+    } else if (strcmp(argv[i], "--duplicate-heap-numbers") == 0) {
+      options.duplicate_heap_numbers_ = true;
     } else if (strcmp(argv[i], "--verbose") == 0) {
       options.verbose_ = true;
     } else if (strncmp(argv[i], "--output=", 9) == 0) {
@@ -273,6 +278,8 @@ void ProgramOptions::UpdateFromHeader(std::istream& stream) {
       do_expressions_ = ParseBoolean(line.c_str() + 16);
     } else if (line.compare(0, 17, "async iteration: ") == 0) {
       async_iteration_ = ParseBoolean(line.c_str() + 17);
+    } else if (line.compare(0, 24, "duplicate heap numbers: ") == 0) {
+      duplicate_heap_numbers_ = ParseBoolean(line.c_str() + 24);
     } else if (line == "---") {
       break;
     } else if (line.empty()) {
@@ -296,6 +303,7 @@ void ProgramOptions::PrintHeader(std::ostream& stream) const {  // NOLINT
   if (top_level_) stream << "\ntop level: yes";
   if (do_expressions_) stream << "\ndo expressions: yes";
   if (async_iteration_) stream << "\nasync iteration: yes";
+  if (duplicate_heap_numbers_) stream << "\nduplicate heap numbers: yes";
 
   stream << "\n\n";
 }
@@ -401,6 +409,9 @@ void GenerateExpectationsFile(std::ostream& stream,  // NOLINT
 
   if (options.do_expressions()) i::FLAG_harmony_do_expressions = true;
   if (options.async_iteration()) i::FLAG_harmony_async_iteration = true;
+  if (options.duplicate_heap_numbers()) {
+    i::FLAG_ignition_deduplicate_heap_numbers = false;
+  }
 
   stream << "#\n# Autogenerated by generate-bytecode-expectations.\n#\n\n";
   options.PrintHeader(stream);
@@ -410,6 +421,7 @@ void GenerateExpectationsFile(std::ostream& stream,  // NOLINT
 
   i::FLAG_harmony_do_expressions = false;
   i::FLAG_harmony_async_iteration = false;
+  i::FLAG_ignition_deduplicate_heap_numbers = true;
 }
 
 bool WriteExpectationsFile(const std::vector<std::string>& snippet_list,
@@ -455,6 +467,8 @@ void PrintUsage(const char* exec_path) {
          "  --top-level   Process top level code, not the top-level function.\n"
          "  --do-expressions  Enable harmony_do_expressions flag.\n"
          "  --async-iteration  Enable harmony_async_iteration flag.\n"
+         "  --duplicate-heap-numbers  Disable deduplication of heap number\n"
+         "      constants, e.g. to fill the constant pool.\n"
          "  --output=file.name\n"
          "      Specify the output file. If not specified, output goes to "
          "stdout.\n"
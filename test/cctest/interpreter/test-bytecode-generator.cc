@@ -952,6 +952,10 @@ TEST(BasicLoops) {
 }
 
 TEST(JumpsRequiringConstantWideOperands) {
+  // The constant pool is filled with equal heap numbers to force wide operands.
+  bool old_flag = FLAG_ignition_deduplicate_heap_numbers;
+  FLAG_ignition_deduplicate_heap_numbers = false;
+
   InitializedIgnitionHandleScope scope;
   BytecodeExpectationsPrinter printer(CcTest::isolate());
   const char* snippets[] = {
@@ -968,6 +972,8 @@ TEST(JumpsRequiringConstantWideOperands) {
 
   CHECK(CompareTexts(BuildActual(printer, snippets),
                      LoadGolden("JumpsRequiringConstantWideOperands.golden")));
+
+  FLAG_ignition_deduplicate_heap_numbers = old_flag;
 }
 
 TEST(UnaryOperators) {
@@ -1199,6 +1205,10 @@ TEST(RegExpLiterals) {
 }
 
 TEST(RegExpLiteralsWide) {
+  // The constant pool is filled with equal heap numbers to force wide operands.
+  bool old_flag = FLAG_ignition_deduplicate_heap_numbers;
+  FLAG_ignition_deduplicate_heap_numbers = false;
+
   InitializedIgnitionHandleScope scope;
   BytecodeExpectationsPrinter printer(CcTest::isolate());
 
@@ -1210,6 +1220,8 @@ TEST(RegExpLiteralsWide) {
 
   CHECK(CompareTexts(BuildActual(printer, snippets),
                      LoadGolden("RegExpLiteralsWide.golden")));
+
+  FLAG_ignition_deduplicate_heap_numbers = old_flag;
 }
 
 TEST(ArrayLiterals) {
@@ -1231,6 +1243,10 @@ TEST(ArrayLiterals) {
 }
 
 TEST(ArrayLiteralsWide) {
+  // The constant pool is filled with equal heap numbers to force wide operands.
+  bool old_flag = FLAG_ignition_deduplicate_heap_numbers;
+  FLAG_ignition_deduplicate_heap_numbers = false;
+
   InitializedIgnitionHandleScope scope;
   BytecodeExpectationsPrinter printer(CcTest::isolate());
 
@@ -1242,6 +1258,8 @@ TEST(ArrayLiteralsWide) {
 
   CHECK(CompareTexts(BuildActual(printer, snippets),
                      LoadGolden("ArrayLiteralsWide.golden")));
+
+  FLAG_ignition_deduplicate_heap_numbers = old_flag;
 }
 
 TEST(ObjectLiterals) {
@@ -1285,6 +1303,10 @@ TEST(ObjectLiterals) {
 }
 
 TEST(ObjectLiteralsWide) {
+  // The constant pool is filled with equal heap numbers to force wide operands.
+  bool old_flag = FLAG_ignition_deduplicate_heap_numbers;
+  FLAG_ignition_deduplicate_heap_numbers = false;
+
   InitializedIgnitionHandleScope scope;
   BytecodeExpectationsPrinter printer(CcTest::isolate());
   const char* snippets[] = {
@@ -1295,6 +1317,8 @@ TEST(ObjectLiteralsWide) {
 
   CHECK(CompareTexts(BuildActual(printer, snippets),
                      LoadGolden("ObjectLiteralsWide.golden")));
+
+  FLAG_ignition_deduplicate_heap_numbers = old_flag;
 }
 
 TEST(TopLevelObjectLiterals) {
@@ -2018,6 +2042,10 @@ TEST(LookupSlotInEval) {
 }
 
 TEST(LookupSlotWideInEval) {
+  // The constant pool is filled with equal heap numbers to force wide operands.
+  bool old_flag = FLAG_ignition_deduplicate_heap_numbers;
+  FLAG_ignition_deduplicate_heap_numbers = false;
+
   InitializedIgnitionHandleScope scope;
   BytecodeExpectationsPrinter printer(CcTest::isolate());
   printer.set_wrap(false);
@@ -2050,6 +2078,8 @@ TEST(LookupSlotWideInEval) {
                                    "f1();");
 
   CHECK(CompareTexts(actual, LoadGolden("LookupSlotWideInEval.golden")));
+
+  FLAG_ignition_deduplicate_heap_numbers = old_flag;
 }
 
 TEST(DeleteLookupSlotInEval) {
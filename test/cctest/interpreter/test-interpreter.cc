@@ -2123,6 +2123,11 @@ TEST(InterpreterInstanceOf) {
     bool expected_value = (i == 0);
     BytecodeArrayBuilder builder(isolate, zone, 1, 1);
 
+    FeedbackVectorSpec feedback_spec(zone);
+    FeedbackSlot slot = feedback_spec.AddInstanceOfSlot();
+    Handle<i::FeedbackMetadata> metadata =
+        NewFeedbackMetadata(isolate, &feedback_spec);
+
     Register r0(0);
     size_t case_entry = builder.AllocateDeferredConstantPoolEntry();
     builder.SetDeferredConstantPoolEntry(case_entry, cases[i]);
@@ -2131,15 +2136,18 @@ TEST(InterpreterInstanceOf) {
     size_t func_entry = builder.AllocateDeferredConstantPoolEntry();
     builder.SetDeferredConstantPoolEntry(func_entry, func);
     builder.LoadConstantPoolEntry(func_entry)
-        .CompareOperation(Token::Value::INSTANCEOF, r0)
+        .CompareOperation(Token::Value::INSTANCEOF, r0, GetIndex(slot))
         .Return();
 
     Handle<BytecodeArray> bytecode_array = builder.ToBytecodeArray(isolate);
-    InterpreterTester tester(isolate, bytecode_array);
+    InterpreterTester tester(isolate, bytecode_array, metadata);
     auto callable = tester.GetCallable<>();
     Handle<Object> return_value = callable().ToHandleChecked();
     CHECK(return_value->IsBoolean());
     CHECK_EQ(return_value->BooleanValue(), expected_value);
+    InstanceOfICNexus nexus(callable.vector(), slot);
+    CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
+    CHECK_EQ(*func, *nexus.GetConstructorFeedback().ToHandleChecked());
   }
 }
 
@@ -2159,6 +2167,11 @@ TEST(InterpreterTestIn) {
     bool expected_value = (i == 0);
     BytecodeArrayBuilder builder(isolate, zone, 1, 1);
 
+    FeedbackVectorSpec feedback_spec(zone);
+    FeedbackSlot slot = feedback_spec.AddHasPropertySlot();
+    Handle<i::FeedbackMetadata> metadata =
+        NewFeedbackMetadata(isolate, &feedback_spec);
+
     Register r0(0);
     builder.LoadLiteral(ast_factory.GetOneByteString(properties[i]))
         .StoreAccumulatorInRegister(r0);
@@ -2166,16 +2179,19 @@ TEST(InterpreterTestIn) {
     size_t array_entry = builder.AllocateDeferredConstantPoolEntry();
     builder.SetDeferredConstantPoolEntry(array_entry, array);
     builder.LoadConstantPoolEntry(array_entry)
-        .CompareOperation(Token::Value::IN, r0)
+        .CompareOperation(Token::Value::IN, r0, GetIndex(slot))
         .Return();
 
     ast_factory.Internalize(isolate);
     Handle<BytecodeArray> bytecode_array = builder.ToBytecodeArray(isolate);
-    InterpreterTester tester(isolate, bytecode_array);
+    InterpreterTester tester(isolate, bytecode_array, metadata);
     auto callable = tester.GetCallable<>();
     Handle<Object> return_value = callable().ToHandleChecked();
     CHECK(return_value->IsBoolean());
     CHECK_EQ(return_value->BooleanValue(), expected_value);
+    HasPropertyICNexus nexus(callable.vector(), slot);
+    CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
+    CHECK_EQ(array->map(), nexus.FindFirstMap());
   }
 }
 
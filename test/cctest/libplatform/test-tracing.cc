@@ -1,9 +1,12 @@
 // Copyright 2016 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <algorithm>
 #include <limits>
 
 #include "include/libplatform/v8-tracing.h"
+#include "src/base/platform/platform.h"
+#include "src/libplatform/tracing/trace-writer.h"
 #include "src/tracing/trace-event.h"
 #include "test/cctest/cctest.h"
 
@@ -127,6 +130,60 @@ TEST(TestTraceBufferRingBuffer) {
   delete ring_buffer;
 }
 
+class TraceEventThread : public base::Thread {
+ public:
+  TraceEventThread(TraceBuffer* buffer, const char* name, int count)
+      : base::Thread(Options("TraceEventThread")),
+        buffer_(buffer),
+        name_(name),
+        count_(count) {}
+
+  void Run() override {
+    uint8_t category_enabled_flag = 41;
+    for (int i = 0; i < count_; ++i) {
+      uint64_t handle;
+      TraceObject* trace_object = buffer_->AddTraceEvent(&handle);
+      CHECK_NOT_NULL(trace_object);
+      trace_object->Initialize('X', &category_enabled_flag, name_,
+                               "Test.Scope", 42, 123, 0, nullptr, nullptr,
+                               nullptr, nullptr, 0);
+      CHECK_EQ(trace_object, buffer_->GetEventByHandle(handle));
+    }
+  }
+
+ private:
+  TraceBuffer* buffer_;
+  const char* name_;
+  int count_;
+};
+
+TEST(TestTraceBufferRingBufferMultipleThreads) {
+  // Every thread fills two chunks of its own, so nothing is overwritten.
+  const int kThreads = 4;
+  const int kEventsPerThread = TraceBufferChunk::kChunkSize * 2;
+  const char* names[kThreads] = {"Test.Thread0", "Test.Thread1",
+                                 "Test.Thread2", "Test.Thread3"};
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer =
+      TraceBuffer::CreateTraceBufferRingBuffer(kThreads * 2, writer);
+  std::vector<std::unique_ptr<TraceEventThread>> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back(
+        new TraceEventThread(ring_buffer, names[i], kEventsPerThread));
+  }
+  for (auto& thread : threads) thread->Start();
+  for (auto& thread : threads) thread->Join();
+
+  ring_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(static_cast<size_t>(kThreads * kEventsPerThread), events.size());
+  for (int i = 0; i < kThreads; ++i) {
+    CHECK_EQ(kEventsPerThread,
+             std::count(events.begin(), events.end(), names[i]));
+  }
+  delete ring_buffer;
+}
+
 TEST(TestJSONTraceWriter) {
   std::ostringstream stream;
   v8::Platform* old_platform = i::V8::GetCurrentPlatform();
@@ -172,6 +229,62 @@ TEST(TestJSONTraceWriter) {
   i::V8::SetPlatformForTesting(old_platform);
 }
 
+TEST(TestBinaryTraceWriter) {
+  std::ostringstream stream;
+  v8::Platform* old_platform = i::V8::GetCurrentPlatform();
+  v8::Platform* default_platform = v8::platform::CreateDefaultPlatform();
+  i::V8::SetPlatformForTesting(default_platform);
+  // Create a scope for the tracing controller to terminate the trace writer.
+  {
+    TracingController tracing_controller;
+    platform::SetTracingController(default_platform, &tracing_controller);
+    TraceWriter* writer = TraceWriter::CreateBinaryTraceWriter(stream);
+
+    TraceBuffer* ring_buffer =
+        TraceBuffer::CreateTraceBufferRingBuffer(1, writer);
+    tracing_controller.Initialize(ring_buffer);
+    TraceConfig* trace_config = new TraceConfig();
+    trace_config->AddIncludedCategory("v8-cat");
+    tracing_controller.StartTracing(trace_config);
+
+    TraceObject trace_object;
+    trace_object.InitializeForTesting(
+        'X', tracing_controller.GetCategoryGroupEnabled("v8-cat"), "Test0",
+        v8::internal::tracing::kGlobalScope, 42, 123, 0, nullptr, nullptr,
+        nullptr, nullptr, TRACE_EVENT_FLAG_HAS_ID, 11, 22, 100, 50, 33, 44);
+    writer->AppendTraceEvent(&trace_object);
+    const char* arg_names[] = {"arg"};
+    const uint8_t arg_types[] = {TRACE_VALUE_TYPE_INT};
+    const uint64_t arg_values[] = {static_cast<uint64_t>(-3)};
+    trace_object.InitializeForTesting(
+        'Y', tracing_controller.GetCategoryGroupEnabled("v8-cat"), "Test0",
+        v8::internal::tracing::kGlobalScope, 43, 456, 1, arg_names, arg_types,
+        arg_values, nullptr, 0, 55, 66, 110, 45, 77, 88);
+    writer->AppendTraceEvent(&trace_object);
+    tracing_controller.StopTracing();
+  }
+
+  // Strings are written once, timestamps are zigzag encoded deltas.
+  const uint8_t expected_trace[] = {
+      'V', '8', 'T', 'B', BinaryTraceWriter::kVersion,
+      // "v8-cat" and "Test0".
+      BinaryTraceWriter::kStringRecord, 1, 6, 'v', '8', '-', 'c', 'a', 't',
+      BinaryTraceWriter::kStringRecord, 2, 5, 'T', 'e', 's', 't', '0',
+      // The first event, with a NULL scope.
+      BinaryTraceWriter::kEventRecord, 'X', 1, 2, 11, 22, 200, 1, 100, 33, 44,
+      TRACE_EVENT_FLAG_HAS_ID, 0, 42, 0,
+      // The second event, with an integer argument.
+      BinaryTraceWriter::kStringRecord, 3, 3, 'a', 'r', 'g',
+      BinaryTraceWriter::kEventRecord, 'Y', 1, 2, 55, 66, 20, 9, 77, 88, 0, 1,
+      3, TRACE_VALUE_TYPE_INT, 5};
+  std::string trace_str = stream.str();
+  CHECK_EQ(std::string(reinterpret_cast<const char*>(expected_trace),
+                       sizeof(expected_trace)),
+           trace_str);
+
+  i::V8::SetPlatformForTesting(old_platform);
+}
+
 TEST(TestTracingController) {
   v8::Platform* old_platform = i::V8::GetCurrentPlatform();
   v8::Platform* default_platform = v8::platform::CreateDefaultPlatform();
@@ -730,3 +730,47 @@ TEST(PreParserScopeAnalysis) {
     }
   }
 }
+
+TEST(PreParserScopeDataFromLazyCompile) {
+  i::FLAG_lazy_inner_functions = true;
+  i::FLAG_experimental_preparser_scope_analysis = false;
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::HandleScope scope(isolate);
+  LocalContext env;
+
+  // The script is compiled without scope analysis, so it has no data.
+  CompileRun(
+      "function f1() {"
+      "  var a = 1;"
+      "  function g() {"
+      "    var b = 2;"
+      "    function h() { return a + b; }"
+      "    return h;"
+      "  }"
+      "  return g;"
+      "}"
+      "function f2() {"
+      "  let c = 3;"
+      "  return function() { return function() { return c++; } };"
+      "}");
+  i::Handle<i::JSFunction> f1 = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("f1")));
+  i::Handle<i::Script> script(i::Script::cast(f1->shared()->script()));
+  CHECK(!script->HasPreparsedScopeData());
+
+  // Compiling f1 lazily produces data for its inner functions, which is used
+  // for compiling them.
+  i::FLAG_experimental_preparser_scope_analysis = true;
+  CHECK_EQ(3, CompileRun("f1()()()")->Int32Value(env.local()).FromJust());
+  CHECK(script->HasPreparsedScopeData());
+  int length = script->preparsed_scope_data()->length();
+
+  // Data produced for f2 is merged with the data for f1.
+  CHECK_EQ(3, CompileRun("var inner = f2()(); inner()")
+                  ->Int32Value(env.local())
+                  .FromJust());
+  CHECK_EQ(4, CompileRun("inner()")->Int32Value(env.local()).FromJust());
+  CHECK_LT(length, script->preparsed_scope_data()->length());
+  CHECK_EQ(3, CompileRun("f1()()()")->Int32Value(env.local()).FromJust());
+  i::FLAG_experimental_preparser_scope_analysis = false;
+}
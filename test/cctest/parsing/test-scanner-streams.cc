@@ -250,6 +250,30 @@ TEST(Utf8SingleByteChunks) {
   }
 }
 
+TEST(Utf8AsciiRuns) {
+  // Long ASCII runs between multi-byte characters, in chunks of all sizes so
+  // that some chunks end inside a multi-byte character.
+  std::vector<uint8_t> bytes;
+  std::vector<uint16_t> expected;
+  for (int run = 0; run < 40; run++) {
+    for (int i = 0; i < run; i++) {
+      bytes.push_back('a' + i % 26);
+      expected.push_back('a' + i % 26);
+    }
+    bytes.insert(bytes.end(), {0xc3, 0xa4});  // a Umlaut, code point 228.
+    expected.push_back(228);
+  }
+  for (size_t chunk_size = 1; chunk_size < 50; chunk_size++) {
+    ChunkSource chunk_source(bytes.data(), bytes.size(), chunk_size);
+    std::unique_ptr<i::Utf16CharacterStream> stream(i::ScannerStream::For(
+        &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8, nullptr));
+    for (size_t i = 0; i < expected.size(); i++) {
+      CHECK_EQ(expected[i], stream->Advance());
+    }
+    CHECK_EQ(i::Utf16CharacterStream::kEndOfInput, stream->Advance());
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
@@ -551,3 +575,32 @@ TEST(Regress724166) {
     }
   }
 }
+
+TEST(AdvanceUntil) {
+  // Many small chunks, so that the searches cross buffer boundaries.
+  const char* chunks[] = {"abc", "de", "f\n", "gh", "ij", "klm", "n", ""};
+  const char reference[] = "abcdef\nghijklmn";
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<i::Utf16CharacterStream> stream(i::ScannerStream::For(
+      &chunk_source, v8::ScriptCompiler::StreamedSource::ONE_BYTE, nullptr));
+  auto is_newline = [](i::uc32 c) { return c == '\n'; };
+  auto is_any = [](i::uc32 c) { return true; };
+  auto is_i = [](i::uc32 c) { return c == 'i'; };
+  auto is_l = [](i::uc32 c) { return c == 'l'; };
+  auto is_x = [](i::uc32 c) { return c == 'x'; };
+
+  CHECK_EQ('a', stream->Advance());
+  CHECK_EQ('\n', stream->AdvanceUntil(is_newline));
+  CHECK_EQ(7u, stream->pos());
+  CHECK_EQ('g', stream->AdvanceUntil(is_any));
+  CHECK_EQ('l', stream->AdvanceUntil(is_l));
+  CHECK_EQ(13u, stream->pos());
+  CHECK_EQ('m', stream->Advance());
+
+  // Searching past the end leaves the stream where Advance() would.
+  CHECK_EQ(i::Utf16CharacterStream::kEndOfInput, stream->AdvanceUntil(is_x));
+  CHECK_EQ(strlen(reference) + 1, stream->pos());
+  stream->Seek(3);
+  CHECK_EQ('i', stream->AdvanceUntil(is_i));
+  CHECK_EQ('j', stream->Advance());
+}
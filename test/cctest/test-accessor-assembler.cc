@@ -20,22 +20,28 @@ using compiler::Node;
 
 namespace {
 
-void TestStubCacheOffsetCalculation(StubCache::Table table) {
+void TestStubCacheOffsetCalculation(StubCache::Table table,
+                                    bool mix_map_bits) {
   Isolate* isolate(CcTest::InitIsolateOnce());
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams);
   AccessorAssembler m(data.state());
 
+  FLAG_stub_cache_mix_map_bits = mix_map_bits;
+  StubCache stub_cache(isolate, Code::LOAD_IC);
+
   {
     Node* name = m.Parameter(0);
     Node* map = m.Parameter(1);
-    Node* primary_offset = m.StubCachePrimaryOffsetForTesting(name, map);
+    Node* primary_offset =
+        m.StubCachePrimaryOffsetForTesting(&stub_cache, name, map);
     Node* result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(&stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -78,12 +84,12 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache.PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
           expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+              stub_cache.SecondaryOffsetForTesting(*name, primary_offset);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -97,11 +103,19 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 }  // namespace
 
 TEST(StubCachePrimaryOffset) {
-  TestStubCacheOffsetCalculation(StubCache::kPrimary);
+  TestStubCacheOffsetCalculation(StubCache::kPrimary, false);
 }
 
 TEST(StubCacheSecondaryOffset) {
-  TestStubCacheOffsetCalculation(StubCache::kSecondary);
+  TestStubCacheOffsetCalculation(StubCache::kSecondary, false);
+}
+
+TEST(StubCachePrimaryOffsetMixMapBits) {
+  TestStubCacheOffsetCalculation(StubCache::kPrimary, true);
+}
+
+TEST(StubCacheSecondaryOffsetMixMapBits) {
+  TestStubCacheOffsetCalculation(StubCache::kSecondary, true);
 }
 
 namespace {
@@ -166,22 +180,25 @@ TEST(TryProbeStubCache) {
 
   Factory* factory = isolate->factory();
 
+  const int kPrimaryTableSize = stub_cache.table_size(StubCache::kPrimary);
+  const int kSecondaryTableSize = stub_cache.table_size(StubCache::kSecondary);
+
   // Generate some number of names.
-  for (int i = 0; i < StubCache::kPrimaryTableSize / 7; i++) {
+  for (int i = 0; i < kPrimaryTableSize / 7; i++) {
     Handle<Name> name;
     switch (rand_gen.NextInt(3)) {
       case 0: {
         // Generate string.
         std::stringstream ss;
         ss << "s" << std::hex
-           << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+           << (rand_gen.NextInt(Smi::kMaxValue) % kPrimaryTableSize);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
       case 1: {
         // Generate number string.
         std::stringstream ss;
-        ss << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+        ss << (rand_gen.NextInt(Smi::kMaxValue) % kPrimaryTableSize);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
@@ -197,7 +214,7 @@ TEST(TryProbeStubCache) {
   }
 
   // Generate some number of receiver maps and receivers.
-  for (int i = 0; i < StubCache::kSecondaryTableSize / 2; i++) {
+  for (int i = 0; i < kSecondaryTableSize / 2; i++) {
     Handle<Map> map = Map::Create(isolate, 0);
     receivers.push_back(factory->NewJSObjectFromMap(map));
   }
@@ -213,7 +230,7 @@ TEST(TryProbeStubCache) {
   DisallowHeapAllocation no_gc;
 
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N = kPrimaryTableSize + kSecondaryTableSize;
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
@@ -259,5 +276,49 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheGrowsOnCollisions) {
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  Factory* factory = isolate->factory();
+  FLAG_adaptive_stub_cache = true;
+  FLAG_stub_cache_primary_table_bits = 6;
+  FLAG_stub_cache_secondary_table_bits = 5;
+
+  Code::Kind ic_kind = Code::LOAD_IC;
+  StubCache stub_cache(isolate, ic_kind);
+  stub_cache.Clear();
+  CHECK_EQ(64, stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(32, stub_cache.table_size(StubCache::kSecondary));
+
+  std::vector<Handle<Name>> names;
+  for (int i = 0; i < 16; i++) {
+    std::stringstream ss;
+    ss << "name" << i;
+    names.push_back(factory->InternalizeUtf8String(ss.str().c_str()));
+  }
+  std::vector<Handle<Map>> maps;
+  for (int i = 0; i < 32; i++) maps.push_back(Map::Create(isolate, 0));
+  Handle<Code> handler =
+      CreateCodeWithFlags(Code::ComputeHandlerFlags(ic_kind));
+
+  {
+    DisallowHeapAllocation no_gc;
+    for (Handle<Name> name : names) {
+      for (Handle<Map> map : maps) stub_cache.Set(*name, *map, *handler);
+    }
+  }
+  CHECK_EQ(names.size() * maps.size(), stub_cache.updates());
+  CHECK_LE(64u, stub_cache.collisions());
+
+  // The many collisions make the next clear grow both tables.
+  stub_cache.Clear();
+  CHECK_EQ(128, stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(64, stub_cache.table_size(StubCache::kSecondary));
+  CHECK_NULL(stub_cache.Get(*names[0], *maps[0]));
+
+  // Without further collisions the tables keep their size.
+  stub_cache.Clear();
+  CHECK_EQ(128, stub_cache.table_size(StubCache::kPrimary));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -1275,6 +1275,52 @@ THREADED_TEST(FunctionTemplateSetLength) {
 }
 
 
+static int fast_api_calls = 0;
+static int slow_api_calls = 0;
+
+static int32_t FastApiAdd(int32_t a, int32_t b) {
+  fast_api_calls++;
+  return a + b;
+}
+
+static void SlowApiAdd(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  slow_api_calls++;
+  Local<Context> context = args.GetIsolate()->GetCurrentContext();
+  int32_t a = args[0]->Int32Value(context).FromJust();
+  int32_t b = args[1]->Int32Value(context).FromJust();
+  args.GetReturnValue().Set(a + b);
+}
+
+TEST(FunctionTemplateFastCallHandler) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::FunctionTemplate> fun_templ =
+      v8::FunctionTemplate::New(isolate, SlowApiAdd);
+  fun_templ->SetFastCallHandler(v8::FastApiCallback(
+      reinterpret_cast<void*>(FastApiAdd),
+      v8::FastApiCallback::ReturnType::kInt32, 2));
+  Local<Function> fun = fun_templ->GetFunction(env.local()).ToLocalChecked();
+  CHECK(env->Global()->Set(env.local(), v8_str("add"), fun).FromJust());
+
+  fast_api_calls = slow_api_calls = 0;
+  CompileRun("function f(a, b) { return add(a, b); }");
+  ExpectInt32("f(1, 2)", 3);
+  ExpectInt32("f(3, 4)", 7);
+  ExpectInt32("%OptimizeFunctionOnNextCall(f); f(5, 6)", 11);
+  ExpectInt32("f(2.5, -1)", 1);
+  CHECK_EQ(4, fast_api_calls + slow_api_calls);
+  if (i::FLAG_opt && !i::FLAG_always_opt) CHECK_EQ(2, fast_api_calls);
+
+  // Arguments that are not numbers deoptimize to the regular callback.
+  int fast_calls_before = fast_api_calls;
+  ExpectInt32("f('7', 1)", 8);
+  ExpectInt32("add(1)", 1);
+  CHECK_EQ(fast_calls_before, fast_api_calls);
+}
+
+
 static void* expected_ptr;
 static void callback(const v8::FunctionCallbackInfo<v8::Value>& args) {
   void* ptr = v8::External::Cast(*args.Data())->Value();
@@ -1963,6 +2009,43 @@ THREADED_TEST(ObjectTemplate) {
             .FromJust());
 }
 
+static void ReturnPropertyName(
+    Local<Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  info.GetReturnValue().Set(name);
+}
+
+TEST(ObjectTemplateCachedInstances) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  Local<ObjectTemplate> templ = ObjectTemplate::New(isolate);
+  templ->SetInternalFieldCount(1);
+  for (int i = 0; i < 40; i++) {
+    i::EmbeddedVector<char, 16> name;
+    i::SNPrintF(name, "acc%d", i);
+    templ->SetAccessor(v8_str(name.start()), ReturnPropertyName);
+  }
+  templ->Set(isolate, "value", v8_num(1));
+
+  for (int i = 0; i < 2; i++) {
+    LocalContext env;
+    Local<v8::Object> first = templ->NewInstance(env.local()).ToLocalChecked();
+    Local<v8::Object> second =
+        templ->NewInstance(env.local()).ToLocalChecked();
+    CHECK(!first->StrictEquals(second));
+    CHECK_EQ(v8::Utils::OpenHandle(*first)->map(),
+             v8::Utils::OpenHandle(*second)->map());
+    CHECK_EQ(1, second->InternalFieldCount());
+
+    CHECK(env->Global()->Set(env.local(), v8_str("first"), first).FromJust());
+    CHECK(
+        env->Global()->Set(env.local(), v8_str("second"), second).FromJust());
+    CompileRun("first.value = 2");
+    ExpectInt32("second.value", 1);
+    ExpectString("second.acc39", "acc39");
+    ExpectTrue("Object.getPrototypeOf(second) === Object.prototype");
+  }
+}
+
 THREADED_TEST(IntegerValue) {
   LocalContext env;
   v8::Isolate* isolate = CcTest::isolate();
@@ -4274,6 +4357,72 @@ TEST(TwoPassPhantomCallbacksNestedGc) {
 }
 
 
+namespace {
+
+struct ThreadSafeCallbackData {
+  v8::Global<v8::Object> handle;
+  v8::base::Semaphore* done;
+};
+
+void ThreadSafeSecondPassCallback(
+    const v8::WeakCallbackInfo<ThreadSafeCallbackData>& data) {
+  v8::base::Semaphore* done = data.GetParameter()->done;
+  delete data.GetParameter();
+  done->Signal();
+}
+
+void ThreadSafeFirstPassCallback(
+    const v8::WeakCallbackInfo<ThreadSafeCallbackData>& data) {
+  data.GetParameter()->handle.Reset();
+  data.SetThreadSafeSecondPassCallback(ThreadSafeSecondPassCallback);
+}
+
+}  // namespace
+
+
+TEST(ThreadSafeSecondPassPhantomCallbacks) {
+  i::FLAG_concurrent_phantom_callbacks = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  const int kLength = 20;
+  v8::base::Semaphore done(0);
+  {
+    v8::HandleScope scope(isolate);
+    for (int i = 0; i < kLength; ++i) {
+      auto data = new ThreadSafeCallbackData();
+      data->handle.Reset(isolate, v8::Object::New(isolate));
+      data->handle.SetWeak(data, ThreadSafeFirstPassCallback,
+                           v8::WeakCallbackType::kParameter);
+      data->done = &done;
+    }
+  }
+  CcTest::CollectAllGarbage();
+  // The callbacks run on a background thread, without any help from the
+  // message loop.
+  for (int i = 0; i < kLength; ++i) done.Wait();
+}
+
+
+TEST(SecondPassPhantomCallbacksWithTimeBudget) {
+  i::FLAG_phantom_callbacks_time_budget = 1;
+  auto isolate = CcTest::isolate();
+  // Enough callbacks for the budget to be checked a number of times.
+  const size_t kLength = 1000;
+  int instance_counter = 0;
+  for (size_t i = 0; i < kLength; ++i) {
+    auto data = new TwoPassCallbackData(isolate, &instance_counter);
+    data->SetWeak();
+  }
+  CHECK_EQ(static_cast<int>(kLength), instance_counter);
+  CcTest::CollectAllGarbage();
+  // Callbacks left over when the budget runs out are deferred to new tasks,
+  // which the message loop keeps running until all callbacks are done.
+  EmptyMessageQueues(isolate);
+  CHECK_EQ(0, instance_counter);
+  i::FLAG_phantom_callbacks_time_budget = 0;
+}
+
+
 namespace {
 
 void* IntKeyToVoidPointer(int key) { return reinterpret_cast<void*>(key << 1); }
@@ -15708,6 +15857,52 @@ TEST(CreateDataProperty) {
 }
 
 
+TEST(ObjectNewWithProperties) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  Local<v8::Name> names[] = {v8_str("a"), v8_str("b"), v8_str("0"),
+                             v8_str("a")};
+  Local<v8::Value> values[] = {v8_num(1), v8_str("x"), v8_num(3), v8_num(4)};
+  Local<v8::Object> first = v8::Object::New(
+      isolate, CompileRun("Object.prototype"), names, values, 4);
+  Local<v8::Object> second = v8::Object::New(
+      isolate, CompileRun("Object.prototype"), names, values, 4);
+  CHECK_EQ(v8::Utils::OpenHandle(*first)->map(),
+           v8::Utils::OpenHandle(*second)->map());
+  CHECK(env->Global()->Set(env.local(), v8_str("o"), first).FromJust());
+  ExpectString("JSON.stringify(o)", "{\"0\":3,\"a\":4,\"b\":\"x\"}");
+
+  Local<v8::Object> proto = v8::Object::New(isolate);
+  Local<v8::Object> derived =
+      v8::Object::New(isolate, proto, names, values, 2);
+  CHECK(derived->GetPrototype()->StrictEquals(proto));
+  Local<v8::Object> bare =
+      v8::Object::New(isolate, v8::Null(isolate), names, values, 2);
+  CHECK(bare->GetPrototype()->IsNull());
+
+  // Reading properties back, including missing ones and getters.
+  CHECK(env->Global()->Set(env.local(), v8_str("bare"), bare).FromJust());
+  CompileRun(
+      "Object.defineProperty(bare, 'c',"
+      "                      {get() { return 5; }, configurable: true});");
+  Local<v8::Name> read_names[] = {v8_str("c"), v8_str("a"), v8_str("z")};
+  Local<v8::Value> read_values[3];
+  CHECK(bare->GetProperties(env.local(), read_names, read_values, 3)
+            .FromJust());
+  CHECK_EQ(5, read_values[0]->Int32Value(env.local()).FromJust());
+  CHECK_EQ(1, read_values[1]->Int32Value(env.local()).FromJust());
+  CHECK(read_values[2]->IsUndefined());
+
+  v8::TryCatch try_catch(isolate);
+  CompileRun("Object.defineProperty(bare, 'c', {get() { throw 1; }});");
+  CHECK(bare->GetProperties(env.local(), read_names, read_values, 3)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
+
 TEST(DefineOwnProperty) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -20297,6 +20492,83 @@ TEST(IsolateDifferentContexts) {
   isolate->Dispose();
 }
 
+static int reset_isolate_microtask_count = 0;
+
+TEST(IsolateResetForReuse) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  isolate->SetMicrotasksPolicy(v8::MicrotasksPolicy::kExplicit);
+  reset_isolate_microtask_count = 0;
+  v8::Global<v8::Context> old_context;
+  v8::Global<v8::Value> old_symbol;
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    old_symbol.Reset(isolate, CompileRun("var x = 1; Symbol.for('x')"));
+    isolate->EnqueueMicrotask([](void*) { reset_isolate_microtask_count++; });
+    old_context.Reset(isolate, context);
+    old_context.SetWeak();
+  }
+
+  isolate->ResetForReuse();
+  CHECK(old_context.IsEmpty());
+
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    isolate->RunMicrotasks();
+    CHECK_EQ(0, reset_isolate_microtask_count);
+    ExpectTrue("typeof x === 'undefined'");
+    // Symbol.for does not return symbols registered before the reset.
+    Local<Value> symbol = CompileRun("Symbol.for('x')");
+    CHECK(symbol->IsSymbol());
+    CHECK(!symbol->StrictEquals(old_symbol.Get(isolate)));
+    CHECK(CompileRun("Symbol.for('x') === Symbol.for('x')")->IsTrue());
+  }
+  old_symbol.Reset();
+  isolate->Dispose();
+}
+
+TEST(IsolatePool) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::IsolatePool pool(create_params, 1);
+  CHECK_EQ(0u, pool.idle_isolate_count());
+
+  v8::Isolate* first = pool.Acquire();
+  v8::Isolate* second = pool.Acquire();
+  CHECK_NE(first, second);
+  for (v8::Isolate* isolate : {first, second}) {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    ExpectTrue("var x = 1; x === 1");
+  }
+
+  // Only one isolate is kept; the other one is disposed.
+  pool.Release(first);
+  pool.Release(second);
+  CHECK_EQ(1u, pool.idle_isolate_count());
+
+  v8::Isolate* reused = pool.Acquire();
+  CHECK_EQ(first, reused);
+  CHECK_EQ(0u, pool.idle_isolate_count());
+  {
+    v8::Isolate::Scope isolate_scope(reused);
+    v8::HandleScope handle_scope(reused);
+    Local<v8::Context> context = v8::Context::New(reused);
+    v8::Context::Scope context_scope(context);
+    ExpectTrue("typeof x === 'undefined'");
+  }
+  pool.Release(reused);
+}
+
 class InitDefaultIsolateThread : public v8::base::Thread {
  public:
   enum TestCase {
@@ -23541,6 +23813,45 @@ TEST(EscapeableHandleScope) {
 }
 
 
+TEST(HandleBlockPool) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope outer_scope(isolate);
+    isolate->SetHandleBlockPoolSize(8);
+    v8::HandleScopeStatistics before;
+    CHECK(isolate->GetHandleScopeStatistics(&before));
+    size_t handles = 5 * before.handles_per_block();
+
+    // The blocks of a scope that grew are kept when it closes, so growing
+    // the next scope as much does not allocate.
+    {
+      v8::HandleScope scope(isolate);
+      for (size_t i = 0; i < handles; i++) v8::Integer::New(isolate, 1);
+    }
+    v8::HandleScopeStatistics first;
+    CHECK(isolate->GetHandleScopeStatistics(&first));
+    CHECK_LE(5, first.pooled_block_count());
+    CHECK_LE(5, first.peak_block_count());
+    {
+      v8::HandleScope scope(isolate);
+      for (size_t i = 0; i < handles; i++) v8::Integer::New(isolate, 1);
+    }
+    v8::HandleScopeStatistics second;
+    CHECK(isolate->GetHandleScopeStatistics(&second));
+    CHECK_EQ(first.allocated_block_count(), second.allocated_block_count());
+    CHECK_LE(first.reused_block_count() + 5, second.reused_block_count());
+
+    isolate->SetHandleBlockPoolSize(1);
+    CHECK(isolate->GetHandleScopeStatistics(&second));
+    CHECK_GE(1, second.pooled_block_count());
+  }
+  isolate->Dispose();
+}
+
+
 static void SetterWhichExpectsThisAndHolderToDiffer(
     Local<String>, Local<Value>, const v8::PropertyCallbackInfo<void>& info) {
   CHECK(info.Holder() != info.This());
@@ -24816,6 +25127,27 @@ TEST(StreamingBiggerScript) {
   RunStreamingTest(chunks);
 }
 
+TEST(StreamingCompileOnBackgroundThread) {
+  // Generates bytecode for the top-level code and the eagerly compiled
+  // function literal on the streaming thread, and finalizes it on the main
+  // thread.
+  i::FLAG_script_streaming_compile = true;
+  const char* chunk1 =
+      "var values = ['a', 'b', {x: 1}];\n"
+      "var counter = (function() {\n"
+      "  var count = 10;\n"
+      "  return { inc: function() { return ++count; } };\n"
+      "})();\n";
+  const char* chunks[] = {chunk1, "counter.inc(); counter.inc(); ",
+                          "counter.inc();", NULL};
+  RunStreamingTest(chunks);
+
+  // Parse errors are still reported from the main thread.
+  const char* error_chunks[] = {"var if else;", NULL};
+  RunStreamingTest(error_chunks, v8::ScriptCompiler::StreamedSource::ONE_BYTE,
+                   false);
+}
+
 
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
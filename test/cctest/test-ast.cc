@@ -65,3 +65,40 @@ TEST(List) {
   CHECK_EQ(0, list->length());
   delete list;
 }
+
+TEST(InternalizeStrings) {
+  v8::V8::Initialize();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  Handle<String> existing =
+      isolate->factory()->InternalizeUtf8String("existing-ast-string");
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  AstValueFactory value_factory(&zone, isolate->ast_string_constants(),
+                                isolate->heap()->HashSeed());
+  const AstRawString* existing_raw =
+      value_factory.GetOneByteString("existing-ast-string");
+  const AstRawString* empty_raw = value_factory.GetOneByteString("");
+  const uint16_t two_byte[] = {'n', 'e', 'w', 0x1234};
+  const AstRawString* two_byte_raw = value_factory.GetTwoByteString(
+      Vector<const uint16_t>(two_byte, arraysize(two_byte)));
+  const int kNewStrings = 100;
+  const AstRawString* new_raw[kNewStrings];
+  for (int i = 0; i < kNewStrings; i++) {
+    EmbeddedVector<char, 32> name;
+    SNPrintF(name, "new-ast-string-%d", i);
+    new_raw[i] = value_factory.GetOneByteString(name.start());
+  }
+  value_factory.Internalize(isolate);
+
+  CHECK_EQ(*existing, *existing_raw->string());
+  CHECK_EQ(isolate->heap()->empty_string(), *empty_raw->string());
+  CHECK(two_byte_raw->string()->IsInternalizedString());
+  CHECK_EQ(4, two_byte_raw->string()->length());
+  for (int i = 0; i < kNewStrings; i++) {
+    Handle<String> string = new_raw[i]->string();
+    CHECK(string->IsInternalizedString());
+    CHECK_EQ(*string, *isolate->factory()->InternalizeString(string));
+  }
+}
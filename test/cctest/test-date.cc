@@ -194,6 +194,31 @@ TEST(DateParseLegacyUseCounter) {
   CHECK_EQ(1, legacy_parse_count);
 }
 
+TEST(SharedDaylightSavingsTable) {
+#ifdef V8_INTL_SUPPORT
+  FLAG_icu_timezone_data = false;
+#endif  // V8_INTL_SUPPORT
+  DateCache date_cache;
+  v8::base::TimezoneCache* tz_cache = v8::base::OS::CreateTimezoneCache();
+  // Sample every 5 hours and 7 seconds over several decades, both forwards
+  // and out of order, and compare against the OS.
+  const int kStepInSec = 5 * 3600 + 7;
+  for (int64_t time_sec = 0; time_sec < 40LL * 365 * DateCache::kSecPerDay;
+       time_sec += kStepInSec) {
+    double time_ms = static_cast<double>(time_sec * 1000);
+    CHECK_EQ(static_cast<int>(tz_cache->DaylightSavingsOffset(time_ms)),
+             date_cache.GetDaylightSavingsOffsetFromOS(time_sec));
+  }
+  for (int64_t time_sec = DateCache::kMaxEpochTimeInSec; time_sec > 0;
+       time_sec -= 1000003) {
+    double time_ms = static_cast<double>(time_sec * 1000);
+    CHECK_EQ(static_cast<int>(tz_cache->DaylightSavingsOffset(time_ms)),
+             date_cache.GetDaylightSavingsOffsetFromOS(time_sec));
+  }
+  delete tz_cache;
+  DateCache::ResetSharedTimezoneData();
+}
+
 #ifdef V8_INTL_SUPPORT
 TEST(DateCacheVersion) {
   FLAG_allow_natives_syntax = true;
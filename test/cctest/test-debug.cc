@@ -36,6 +36,7 @@
 #include "src/debug/debug.h"
 #include "src/deoptimizer.h"
 #include "src/frames.h"
+#include "src/isolate-inl.h"
 #include "src/objects-inl.h"
 #include "src/utils.h"
 #include "test/cctest/cctest.h"
@@ -6737,3 +6738,36 @@ TEST(DebugEvaluateNoSideEffect) {
     if (failed) isolate->clear_pending_exception();
   }
 }
+
+namespace {
+class CountingConsoleDelegate : public v8::debug::ConsoleDelegate {
+ public:
+  void Log(const v8::debug::ConsoleCallArguments& args,
+           const v8::debug::ConsoleContext& context) override {
+    log_count++;
+  }
+  int log_count = 0;
+};
+}  // namespace
+
+TEST(ConsoleCallsWithoutDelegate) {
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_opt = true;
+  i::FLAG_always_opt = false;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  i::Isolate* isolate = CcTest::i_isolate();
+  CHECK(isolate->IsConsoleDelegateProtectorIntact());
+
+  CompileRun(
+      "function f(x) { console.log(x); return x; }"
+      "f(1); f(2); %OptimizeFunctionOnNextCall(f); f(3);");
+
+  // Installing a delegate deoptimizes code that dropped console calls.
+  CountingConsoleDelegate delegate;
+  v8::debug::SetConsoleDelegate(env->GetIsolate(), &delegate);
+  CHECK(!isolate->IsConsoleDelegateProtectorIntact());
+  CompileRun("f(4)");
+  CHECK_EQ(1, delegate.log_count);
+  v8::debug::SetConsoleDelegate(env->GetIsolate(), nullptr);
+}
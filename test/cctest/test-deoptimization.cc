@@ -950,3 +950,38 @@ UNINITIALIZED_TEST(DeoptimizeLoadICStoreICNested) {
   isolate->Exit();
   isolate->Dispose();
 }
+
+
+TEST(DeoptimizationCostStatistics) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  bool print_deopt_stats = i::FLAG_print_deopt_stats;
+  i::FLAG_print_deopt_stats = true;
+  i::DeoptimizerData* data = i_isolate->deoptimizer_data();
+
+  auto total_count = [data]() {
+    int count = 0;
+    for (int i = 0; i < i::kDeoptimizeReasonCount; i++) {
+      count +=
+          data->deoptimization_cost(static_cast<i::DeoptimizeReason>(i)).count;
+    }
+    return count;
+  };
+  int count_before = total_count();
+
+  {
+    AllowNativesSyntaxNoInlining options;
+    CompileRun(
+        "function f(x) { return x + 1; }"
+        "f(1); f(2);"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f(3);"
+        "f('a');");
+  }
+
+  if (i_isolate->use_optimizer()) {
+    CHECK_LT(count_before, total_count());
+  }
+  i::FLAG_print_deopt_stats = print_deopt_stats;
+}
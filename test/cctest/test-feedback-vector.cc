@@ -10,6 +10,7 @@
 #include "src/execution.h"
 #include "src/factory.h"
 #include "src/global-handles.h"
+#include "src/ic/ic-stats.h"
 #include "src/macro-assembler.h"
 #include "src/objects-inl.h"
 #include "test/cctest/test-feedback-vector.h"
@@ -645,4 +646,92 @@ TEST(StoreOwnIC) {
   CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
 }
 
+TEST(VectorInstanceOfAndInStates) {
+  if (i::FLAG_always_opt) return;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  CompileRun(
+      "function A() {} function B() {}"
+      "function f(a, C) { return a instanceof C; }"
+      "function g(k, o) { return k in o; }"
+      "f(new A, A);"
+      "g('x', { x: 1 });");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<JSFunction> a = GetFunction("A");
+  Handle<JSFunction> g = GetFunction("g");
+
+  Handle<FeedbackVector> f_vector(f->feedback_vector());
+  FeedbackVectorHelper f_helper(f_vector);
+  CHECK_EQ(1, f_helper.slot_count());
+  CHECK_SLOT_KIND(f_helper, 0, FeedbackSlotKind::kInstanceOf);
+  InstanceOfICNexus f_nexus(f_vector, f_helper.slot(0));
+  CHECK_EQ(MONOMORPHIC, f_nexus.StateFromFeedback());
+  CHECK_EQ(*a, *f_nexus.GetConstructorFeedback().ToHandleChecked());
+
+  Handle<FeedbackVector> g_vector(g->feedback_vector());
+  FeedbackVectorHelper g_helper(g_vector);
+  CHECK_EQ(1, g_helper.slot_count());
+  CHECK_SLOT_KIND(g_helper, 0, FeedbackSlotKind::kHasProperty);
+  HasPropertyICNexus g_nexus(g_vector, g_helper.slot(0));
+  CHECK_EQ(MONOMORPHIC, g_nexus.StateFromFeedback());
+
+  // The same constructor and receiver map keep the slots monomorphic.
+  CompileRun("f({}, A); g('y', { x: 2 });");
+  CHECK_EQ(MONOMORPHIC, f_nexus.StateFromFeedback());
+  CHECK_EQ(MONOMORPHIC, g_nexus.StateFromFeedback());
+
+  CompileRun("f(new B, B); g('x', []);");
+  CHECK_EQ(MEGAMORPHIC, f_nexus.StateFromFeedback());
+  CHECK(f_nexus.GetConstructorFeedback().is_null());
+  CHECK_EQ(MEGAMORPHIC, g_nexus.StateFromFeedback());
+  CHECK(!g_nexus.FindFirstMap());
+}
+
+TEST(ICTransitionStatistics) {
+  if (i::FLAG_always_opt) return;
+  FLAG_ic_transition_stats = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->GetICTransitionStatistics()->Reset();
+
+  CompileRun(
+      "function f(a) { return a.foo; }"
+      "f({ foo: 1 });"
+      "f({ foo: 1 });"
+      "f({ a: 1, foo: 2 });"
+      "f({ b: 1, foo: 2 });"
+      "f({ c: 1, foo: 2 });"
+      "f({ d: 1, foo: 2 });"
+      "f({ e: 1, foo: 2 });"
+      "f({ f: 1, foo: 2 });");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<FeedbackVector> feedback_vector(f->feedback_vector(), isolate);
+  LoadICNexus nexus(feedback_vector, FeedbackSlot(0));
+  CHECK_EQ(MEGAMORPHIC, nexus.StateFromFeedback());
+
+  ICTransitionStatistics* stats = isolate->GetICTransitionStatistics();
+  int script_id = Script::cast(f->shared()->script())->id();
+  ICTransitionStatistics::Counts slot_counts =
+      stats->ForSlot(script_id, f->shared()->start_position(), 0);
+  CHECK_EQ(3, slot_counts.polymorphic);
+  CHECK_EQ(1, slot_counts.megamorphic);
+  ICTransitionStatistics::Counts script_counts = stats->ForScript(script_id);
+  CHECK_EQ(3, script_counts.polymorphic);
+  CHECK_EQ(1, script_counts.megamorphic);
+
+  // Once megamorphic, further misses are not counted again.
+  CompileRun("f({ g: 1, foo: 2 });");
+  CHECK_EQ(1, stats->ForSlot(script_id, f->shared()->start_position(), 0)
+                  .megamorphic);
+
+  stats->Reset();
+  CHECK_EQ(0, stats->ForScript(script_id).megamorphic);
+}
+
 }  // namespace
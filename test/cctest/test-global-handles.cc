@@ -25,6 +25,8 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <vector>
+
 #include "src/api.h"
 #include "src/factory.h"
 #include "src/global-handles.h"
@@ -183,3 +185,38 @@ TEST(PhatomHandlesWithoutCallbacks) {
   CHECK_EQ(2u, isolate->NumberOfPhantomHandleResetsSinceLastCall());
   CHECK_EQ(0u, isolate->NumberOfPhantomHandleResetsSinceLastCall());
 }
+
+TEST(StrongAndWeakHandlesInManyBlocks) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+
+  // Spread the handles over several blocks, some of which only hold strong
+  // or only hold weak handles, to exercise the block skipping during GC.
+  const int kCount = 2000;
+  std::vector<v8::Global<v8::Object>> handles(kCount);
+  {
+    v8::HandleScope scope(isolate);
+    for (int i = 0; i < kCount; ++i) {
+      handles[i].Reset(isolate, v8::Object::New(isolate));
+      if (i < kCount / 2 && i % 3 != 0) handles[i].SetWeak();
+    }
+  }
+  // Turn one handle strong again.
+  handles[1].ClearWeak();
+
+  CcTest::CollectAllAvailableGarbage();
+  for (int i = 0; i < kCount; ++i) {
+    bool weak = i < kCount / 2 && i % 3 != 0 && i != 1;
+    CHECK_EQ(weak, handles[i].IsEmpty());
+  }
+
+  // Make the remaining handles weak and collect them as well.
+  {
+    v8::HandleScope scope(isolate);
+    for (int i = 0; i < kCount; ++i) {
+      if (!handles[i].IsEmpty()) handles[i].SetWeak();
+    }
+  }
+  CcTest::CollectAllAvailableGarbage();
+  for (int i = 0; i < kCount; ++i) CHECK(handles[i].IsEmpty());
+}
@@ -173,3 +173,23 @@ TEST(HashSet) {
   TestSet(Hash, 100);
   TestSet(CollisionHash, 50);
 }
+
+
+TEST(HashMapResizeKeepsValues) {
+  v8::base::HashMap map;
+  const uint32_t n = 1000;
+  for (uint32_t i = 1; i <= n; i++) {
+    v8::base::HashMap::Entry* p = map.LookupOrInsert(
+        reinterpret_cast<void*>(i), CollisionHash(i));
+    p->value = reinterpret_cast<void*>(i * 2);
+  }
+  CHECK_EQ(n, map.occupancy());
+  CHECK_LT(map.occupancy(), map.capacity());
+  for (uint32_t i = 1; i <= n; i++) {
+    v8::base::HashMap::Entry* p =
+        map.Lookup(reinterpret_cast<void*>(i), CollisionHash(i));
+    CHECK_NOT_NULL(p);
+    CHECK_EQ(reinterpret_cast<void*>(i * 2), p->value);
+    CHECK_EQ(CollisionHash(i), p->hash);
+  }
+}
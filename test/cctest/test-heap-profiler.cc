@@ -1007,6 +1007,66 @@ TEST(HeapSnapshotJSONSerialization) {
 }
 
 
+TEST(HeapSnapshotToStream) {
+  v8::Isolate* isolate = CcTest::isolate();
+  LocalContext env;
+  v8::HandleScope scope(isolate);
+  v8::HeapProfiler* heap_profiler = isolate->GetHeapProfiler();
+
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var streamed = new A('streamed string');");
+  int snapshot_count = heap_profiler->GetSnapshotCount();
+  TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  // The snapshot is not kept.
+  CHECK_EQ(snapshot_count, heap_profiler->GetSnapshotCount());
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  i::ScopedVector<char> json(stream.size());
+  stream.WriteTo(json);
+
+  OneByteResource* json_res = new OneByteResource(json);
+  v8::Local<v8::String> json_string =
+      v8::String::NewExternalOneByte(env->GetIsolate(), json_res)
+          .ToLocalChecked();
+  env->Global()
+      ->Set(env.local(), v8_str("json_snapshot"), json_string)
+      .FromJust();
+  // Edges are grouped by their parent node, so that the edge counts of the
+  // nodes add up and every edge points at a node.
+  v8::Local<v8::Value> result = CompileRun(
+      "var parsed = JSON.parse(json_snapshot);\n"
+      "var meta = parsed.snapshot.meta;\n"
+      "var node_fields_count = meta.node_fields.length;\n"
+      "var edge_fields_count = meta.edge_fields.length;\n"
+      "var edge_count_offset = meta.node_fields.indexOf('edge_count');\n"
+      "var edge_type_offset = meta.edge_fields.indexOf('type');\n"
+      "var edge_name_offset = meta.edge_fields.indexOf('name_or_index');\n"
+      "var edge_to_node_offset = meta.edge_fields.indexOf('to_node');\n"
+      "var property_type ="
+      "    meta.edge_types[edge_type_offset].indexOf('property');\n"
+      "var edges = 0;\n"
+      "for (var i = 0; i < parsed.nodes.length; i += node_fields_count) {\n"
+      "  edges += parsed.nodes[i + edge_count_offset];\n"
+      "}\n"
+      "var valid = edges * edge_fields_count === parsed.edges.length;\n"
+      "var found = false;\n"
+      "for (var i = 0; i < parsed.edges.length; i += edge_fields_count) {\n"
+      "  var to = parsed.edges[i + edge_to_node_offset];\n"
+      "  valid = valid && to % node_fields_count === 0 &&\n"
+      "      to < parsed.nodes.length;\n"
+      "  if (parsed.edges[i + edge_type_offset] === property_type &&\n"
+      "      parsed.strings[parsed.edges[i + edge_name_offset]] ===\n"
+      "          'streamed') {\n"
+      "    found = true;\n"
+      "  }\n"
+      "}\n"
+      "valid && found;");
+  CHECK(result->BooleanValue(env.local()).FromJust());
+}
+
+
 TEST(HeapSnapshotJSONSerializationAborting) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -2943,6 +3003,67 @@ TEST(SamplingHeapProfilerApiAllocation) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSampleTypesAndSurvival) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(64);
+  CompileRun(
+      "function Point(x, y) { this.x = x; this.y = y; }\n"
+      "var points = [];\n"
+      "for (var i = 0; i < 1024; ++i) points.push(new Point(i, i));\n");
+  CcTest::CollectAllGarbage();
+
+  uint64_t last_sample_id = 0;
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile());
+    CHECK(profile);
+    const std::vector<v8::AllocationProfile::Sample>& samples =
+        profile->GetSamples();
+    CHECK(!samples.empty());
+
+    std::set<uint32_t> node_ids;
+    std::vector<v8::AllocationProfile::Node*> worklist{profile->GetRootNode()};
+    while (!worklist.empty()) {
+      v8::AllocationProfile::Node* node = worklist.back();
+      worklist.pop_back();
+      CHECK(node_ids.insert(node->node_id).second);
+      for (auto child : node->children) worklist.push_back(child);
+    }
+
+    bool found_point = false;
+    for (const v8::AllocationProfile::Sample& sample : samples) {
+      CHECK_LT(last_sample_id, sample.sample_id);
+      last_sample_id = sample.sample_id;
+      CHECK(node_ids.count(sample.node_id));
+      CHECK(!sample.type_name.IsEmpty());
+      // Every sample was taken before the full GC above and is still alive.
+      CHECK_LE(1u, sample.full_gcs_survived);
+      v8::String::Utf8Value type_name(sample.type_name);
+      if (strcmp(*type_name, "Point") == 0) found_point = true;
+    }
+    CHECK(found_point);
+  }
+
+  // Incremental export only reports the samples taken since.
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile(last_sample_id));
+    CHECK(profile);
+    for (const v8::AllocationProfile::Sample& sample : profile->GetSamples()) {
+      CHECK_LT(last_sample_id, sample.sample_id);
+      CHECK_EQ(0u, sample.full_gcs_survived);
+    }
+  }
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(v8::Isolate::GetCurrent());
   LocalContext env;
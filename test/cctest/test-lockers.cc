@@ -668,6 +668,43 @@ TEST(Regress1433) {
 }
 
 
+// A thread that reacquires the lock it released last keeps its stack limits.
+TEST(LockerReacquiredBySameThread) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Persistent<v8::Context> persistent_context;
+    {
+      v8::Locker locker(isolate);
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      persistent_context.Reset(isolate, context);
+    }
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    uintptr_t real_climit = 0;
+    for (int i = 0; i < 10; i++) {
+      v8::Locker locker(isolate);
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context =
+          v8::Local<v8::Context>::New(isolate, persistent_context);
+      v8::Context::Scope context_scope(context);
+      if (i == 0) real_climit = i_isolate->stack_guard()->real_climit();
+      CHECK_EQ(real_climit, i_isolate->stack_guard()->real_climit());
+      CHECK_EQ(real_climit, i_isolate->stack_guard()->climit());
+      CalcFibAndCheck(context);
+      v8::TryCatch try_catch(isolate);
+      CHECK(CompileRun("function f() { f(); } f();").IsEmpty());
+      CHECK(try_catch.HasCaught());
+    }
+    persistent_context.Reset();
+  }
+  isolate->Dispose();
+}
+
+
 static const char* kSimpleExtensionSource =
   "(function Foo() {"
   "  return 4;"
@@ -564,6 +564,40 @@ TEST(LogVersion) {
 }
 
 
+TEST(LogAsync) {
+  SETUP_FLAGS();
+  i::FLAG_log_async = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    ScopedLoggerInitializer initialize_logger(saved_log, saved_prof, isolate);
+    // Produce enough events to wrap around the writer's buffer.
+    CompileRun(
+        "for (var i = 0; i < 20000; i++) {"
+        "  (new Function('return ' + i + ';'))();"
+        "}"
+        "function logAsyncLastFunction() { return 42; }"
+        "logAsyncLastFunction();");
+    bool exists = false;
+    i::Vector<const char> log(
+        i::ReadFile(initialize_logger.StopLoggingGetTempFile(), &exists, true));
+    CHECK(exists);
+    i::EmbeddedVector<char, 100> ref_data;
+    i::SNPrintF(ref_data, "v8-version,%d,%d,%d,%d,%d", i::Version::GetMajor(),
+                i::Version::GetMinor(), i::Version::GetBuild(),
+                i::Version::GetPatch(), i::Version::IsCandidate());
+    CHECK(StrNStr(log.start(), ref_data.start(), log.length()));
+    CHECK(StrNStr(log.start(), "logAsyncLastFunction", log.length()));
+    // Every line is complete, i.e. messages were not interleaved.
+    CHECK_EQ('\n', log[log.length() - 1]);
+    log.Dispose();
+  }
+  isolate->Dispose();
+  i::FLAG_log_async = false;
+}
+
+
 // https://crbug.com/539892
 // CodeCreateEvents with really large names should not crash.
 TEST(Issue539892) {
@@ -51,3 +51,24 @@ TEST(VirtualMemory) {
   CHECK(vm->Uncommit(block_addr, block_size));
   delete vm;
 }
+
+TEST(VirtualMemoryPreferredNumaNode) {
+  v8::base::VirtualMemory vm(1 * MB);
+  CHECK(vm.IsReserved());
+  void* block_addr = vm.address();
+  size_t block_size = 64 * KB;
+  CHECK(vm.Commit(block_addr, block_size, false));
+  int node = v8::base::OS::GetCurrentNumaNode();
+  CHECK_GE(node, -1);
+  // The hint may be rejected, e.g. in a sandbox, but it must not break the
+  // memory either way.
+  if (node >= 0) {
+    v8::base::VirtualMemory::SetPreferredNumaNode(block_addr, block_size,
+                                                  node);
+  }
+  CHECK(!v8::base::VirtualMemory::SetPreferredNumaNode(block_addr, block_size,
+                                                       -1));
+  memset(block_addr, 1, block_size);
+  CHECK_EQ(1, static_cast<char*>(block_addr)[block_size - 1]);
+  CHECK(vm.Uncommit(block_addr, block_size));
+}
@@ -41,6 +41,7 @@ using i::CodeMap;
 using i::CpuProfile;
 using i::CpuProfiler;
 using i::CpuProfilesCollection;
+using i::JITLineInfoTable;
 using i::ProfileNode;
 using i::ProfileTree;
 using i::ProfileGenerator;
@@ -324,6 +325,29 @@ TEST(CodeMapMoveAndDeleteCode) {
 }
 
 
+TEST(CodeMapRepeatedLookups) {
+  CodeMap code_map;
+  CodeEntry entry1(i::CodeEventListener::FUNCTION_TAG, "aaa");
+  CodeEntry entry2(i::CodeEventListener::FUNCTION_TAG, "bbb");
+  code_map.AddCode(ToAddress(0x1500), &entry1, 0x200);
+  for (int i = 0; i < 3; i++) {
+    CHECK_EQ(&entry1, code_map.FindEntry(ToAddress(0x1600)));
+    CHECK(!code_map.FindEntry(ToAddress(0x1800)));
+  }
+  // Remembered lookups, including failed ones, see later updates.
+  code_map.AddCode(ToAddress(0x1580), &entry2, 0x300);
+  CHECK_EQ(&entry2, code_map.FindEntry(ToAddress(0x1600)));
+  CHECK_EQ(&entry2, code_map.FindEntry(ToAddress(0x1800)));
+  code_map.MoveCode(ToAddress(0x1580), ToAddress(0x5580));
+  CHECK(!code_map.FindEntry(ToAddress(0x1600)));
+  CHECK_EQ(&entry2, code_map.FindEntry(ToAddress(0x5600)));
+  // Addresses that share a slot in the lookup cache.
+  CHECK_EQ(&entry2, code_map.FindEntry(ToAddress(0x5580)));
+  CHECK(!code_map.FindEntry(ToAddress(0x115d0)));
+  CHECK_EQ(&entry2, code_map.FindEntry(ToAddress(0x5580)));
+}
+
+
 namespace {
 
 class TestSetup {
@@ -474,6 +498,101 @@ TEST(SampleIds) {
 }
 
 
+TEST(StreamingDropsSamples) {
+  TestSetup test_setup;
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfilesCollection profiles(isolate);
+  CpuProfiler profiler(isolate);
+  profiler.set_streaming_interval(v8::base::TimeDelta::FromMilliseconds(1));
+  profiles.set_cpu_profiler(&profiler);
+  profiles.StartProfiling("", true);
+  ProfileGenerator generator(&profiles);
+  CodeEntry* entry = new CodeEntry(i::Logger::FUNCTION_TAG, "aaa");
+  generator.code_map()->AddCode(ToAddress(0x1500), entry, 0x200);
+
+  // Samples are released when a sample is at least the streaming interval
+  // after the last streamed one, and when the profile is finished. The tree
+  // still counts all of them.
+  v8::base::TimeTicks start = v8::base::TimeTicks::HighResolutionNow();
+  TickSample sample;
+  sample.pc = ToAddress(0x1600);
+  sample.frames_count = 0;
+  for (int i = 0; i < 3; i++) {
+    sample.timestamp = start + v8::base::TimeDelta::FromMicroseconds(10 * i);
+    generator.RecordTickSample(sample);
+  }
+  sample.timestamp = start + v8::base::TimeDelta::FromMilliseconds(2);
+  generator.RecordTickSample(sample);
+  sample.timestamp = start + v8::base::TimeDelta::FromMilliseconds(3);
+  generator.RecordTickSample(sample);
+  sample.timestamp = start + v8::base::TimeDelta::FromMicroseconds(3500);
+  generator.RecordTickSample(sample);
+
+  CpuProfile* profile = profiles.StopProfiling("");
+  CHECK_EQ(0, profile->samples_count());
+  CHECK_EQ(6u, profile->top_down()->root()->children()->at(0)->self_ticks());
+
+  delete entry;
+}
+
+
+TEST(CallerLineNumbers) {
+  TestSetup test_setup;
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfilesCollection profiles(isolate);
+  CpuProfiler profiler(isolate);
+  profiles.set_cpu_profiler(&profiler);
+  profiles.StartProfiling("leaf", false, v8::kLeafNodeLineNumbers);
+  profiles.StartProfiling("caller", false, v8::kCallerLineNumbers);
+  ProfileGenerator generator(&profiles);
+  JITLineInfoTable* line_info = new JITLineInfoTable();
+  line_info->SetPosition(0x30, 10);
+  line_info->SetPosition(0x80, 20);
+  CodeEntry* caller = new CodeEntry(
+      i::Logger::FUNCTION_TAG, "aaa", CodeEntry::kEmptyNamePrefix,
+      CodeEntry::kEmptyResourceName, v8::CpuProfileNode::kNoLineNumberInfo,
+      v8::CpuProfileNode::kNoColumnNumberInfo, line_info, ToAddress(0x1500));
+  CodeEntry* callee = new CodeEntry(i::Logger::FUNCTION_TAG, "bbb");
+  generator.code_map()->AddCode(ToAddress(0x1500), caller, 0x200);
+  generator.code_map()->AddCode(ToAddress(0x1900), callee, 0x100);
+
+  // "bbb" is called from two different lines of "aaa".
+  TickSample sample;
+  sample.pc = ToAddress(0x1910);
+  sample.tos = ToAddress(0x1910);
+  sample.frames_count = 1;
+  sample.stack[0] = ToAddress(0x1520);
+  generator.RecordTickSample(sample);
+  generator.RecordTickSample(sample);
+  sample.stack[0] = ToAddress(0x1560);
+  generator.RecordTickSample(sample);
+
+  CpuProfile* caller_profile = profiles.StopProfiling("caller");
+  ProfileNode* caller_node =
+      caller_profile->top_down()->root()->FindChild(caller);
+  CHECK(caller_node);
+  CHECK_EQ(2, caller_node->children()->length());
+  ProfileNode* line10 = caller_node->FindChild(callee, 10);
+  ProfileNode* line20 = caller_node->FindChild(callee, 20);
+  CHECK(line10 && line20);
+  CHECK_EQ(10, line10->line_number());
+  CHECK_EQ(2u, line10->self_ticks());
+  CHECK_EQ(20, line20->line_number());
+  CHECK_EQ(1u, line20->self_ticks());
+
+  CpuProfile* leaf_profile = profiles.StopProfiling("leaf");
+  caller_node = leaf_profile->top_down()->root()->FindChild(caller);
+  CHECK(caller_node);
+  CHECK_EQ(1, caller_node->children()->length());
+  ProfileNode* callee_node = caller_node->FindChild(callee);
+  CHECK(callee_node);
+  CHECK_EQ(v8::CpuProfileNode::kNoLineNumberInfo, callee_node->line_number());
+  CHECK_EQ(3u, callee_node->self_ticks());
+
+  delete caller;
+  delete callee;
+}
+
 TEST(NoSamples) {
   TestSetup test_setup;
   i::Isolate* isolate = CcTest::i_isolate();
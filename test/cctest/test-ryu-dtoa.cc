@@ -0,0 +1,79 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include "src/v8.h"
+
+#include "src/base/platform/platform.h"
+#include "src/double.h"
+#include "src/ryu-dtoa.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+using namespace v8::internal;
+
+static const int kBufferSize = 100;
+
+static void CheckRyuDtoa(double v, const char* expected, int expected_point) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected, buffer.start()));
+  CHECK_EQ(StrLength(expected), length);
+  CHECK_EQ(expected_point, point);
+}
+
+
+TEST(RyuDtoaVariousDoubles) {
+  CheckRyuDtoa(1.0, "1", 1);
+  CheckRyuDtoa(1.5, "15", 1);
+  CheckRyuDtoa(0.1, "1", 0);
+  CheckRyuDtoa(0.3, "3", 0);
+  CheckRyuDtoa(0.1 + 0.2, "30000000000000004", 0);
+  CheckRyuDtoa(123456.789, "123456789", 6);
+  CheckRyuDtoa(5e-324, "5", -323);
+  CheckRyuDtoa(1.7976931348623157e308, "17976931348623157", 309);
+  CheckRyuDtoa(4294967272.0, "4294967272", 10);
+  CheckRyuDtoa(4.1855804968213567e298, "4185580496821357", 299);
+  CheckRyuDtoa(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckRyuDtoa(2147483648.0, "2147483648", 10);
+  // FastDtoa cannot compute the following numbers.
+  CheckRyuDtoa(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckRyuDtoa(Double(V8_2PART_UINT64_C(0x00100000, 00000000)).value(),
+               "22250738585072014", -307);
+  CheckRyuDtoa(Double(V8_2PART_UINT64_C(0x000FFFFF, FFFFFFFF)).value(),
+               "2225073858507201", -307);
+  // Powers of two, whose lower boundary is closer.
+  CheckRyuDtoa(9007199254740992.0, "9007199254740992", 16);
+  CheckRyuDtoa(8.98846567431158e307, "898846567431158", 308);
+  // Integers beyond 2^53.
+  CheckRyuDtoa(1e23, "1", 24);
+  CheckRyuDtoa(9007199254740993.0, "9007199254740992", 16);
+  CheckRyuDtoa(4128420500802942e-24, "4128420500802942", -8);
+}
+
+
+TEST(RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool needed_max_length = false;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    double v = current_test.v;
+    RyuDtoa(v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    if (length == kRyuDtoaMaximalLength) needed_max_length = true;
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.start()));
+  }
+  CHECK(needed_max_length);
+}
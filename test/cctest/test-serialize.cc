@@ -33,6 +33,7 @@
 
 #include "src/api.h"
 #include "src/assembler-inl.h"
+#include "src/base/optional.h"
 #include "src/bootstrapper.h"
 #include "src/compilation-cache.h"
 #include "src/compiler.h"
@@ -41,10 +42,12 @@
 #include "src/macro-assembler-inl.h"
 #include "src/objects-inl.h"
 #include "src/runtime/runtime.h"
+#include "src/snapshot/code-cache-directory.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/deserializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/partial-serializer.h"
+#include "src/snapshot/snapshot-compression.h"
 #include "src/snapshot/snapshot.h"
 #include "src/snapshot/startup-serializer.h"
 #include "test/cctest/cctest.h"
@@ -905,6 +908,66 @@ TEST(CustomSnapshotDataBlobImmortalImmovableRoots) {
   source.Dispose();
 }
 
+static int CountLazyBuiltinPlaceholders(v8::Isolate* isolate) {
+  Builtins* builtins = reinterpret_cast<Isolate*>(isolate)->builtins();
+  int count = 0;
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    if (builtins->is_lazy_placeholder(i)) count++;
+  }
+  return count;
+}
+
+TEST(SnapshotDataBlobWithLazyBuiltins) {
+  DisableAlwaysOpt();
+  FLAG_lazy_deserialization = true;
+  const char* source = "function f() { return Math.abs(-1); }";
+  const char* warmup = "f()";
+  const char* script =
+      "[Math.clz32(1), Math.sign(-3), 'a b '.trim(), Object.keys({x: 1}),"
+      " [1, 2, 3].indexOf(3), String.fromCharCode(65), f()].join()";
+
+  // Snapshots are created from an isolate with lazily deserialized builtins
+  // when warming up.
+  v8::StartupData cold = v8::V8::CreateSnapshotDataBlob(source);
+  v8::StartupData warm = v8::V8::WarmUpSnapshotDataBlob(cold, warmup);
+  delete[] cold.data;
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &warm;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestIsolate::New(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+    int placeholders = CountLazyBuiltinPlaceholders(isolate);
+    CHECK_LT(0, placeholders);
+    v8::Local<v8::String> result = CompileRun(script).As<v8::String>();
+    CHECK(result->Equals(context, v8_str("31,-1,a b,x,2,A,1")).FromJust());
+    CHECK_GT(placeholders, CountLazyBuiltinPlaceholders(isolate));
+  }
+  isolate->Dispose();
+
+  // Without --lazy-deserialization, all builtins are deserialized up front.
+  FLAG_lazy_deserialization = false;
+  isolate = TestIsolate::New(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+    CHECK_EQ(0, CountLazyBuiltinPlaceholders(isolate));
+    v8::Local<v8::String> result = CompileRun(script).As<v8::String>();
+    CHECK(result->Equals(context, v8_str("31,-1,a b,x,2,A,1")).FromJust());
+  }
+  isolate->Dispose();
+  // The snapshot blob has to outlive isolates with lazy builtins.
+  delete[] warm.data;
+}
+
 TEST(TestThatAlwaysSucceeds) {
 }
 
@@ -1694,6 +1757,77 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+static void CompileAndRunWithCodeCacheDirectory(const char* source,
+                                                bool expect_cache_hit) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source script_source(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script;
+    {
+      v8::base::Optional<DisallowCompilation> no_compile;
+      if (expect_cache_hit) {
+        no_compile.emplace(reinterpret_cast<Isolate*>(isolate));
+      }
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    }
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate->Dispose();
+}
+
+TEST(CodeSerializerCacheDirectory) {
+  FLAG_serialize_toplevel = true;
+  FLAG_code_cache_dir = ".";
+
+  const char* source =
+      "function f() { return 'abc'; }; f() + 'def'  // cache directory";
+  std::string path;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    path = CodeCacheDirectory::EntryPath(
+        CcTest::i_isolate()->factory()->NewStringFromAsciiChecked(source));
+  }
+  v8::base::OS::Remove(path.c_str());
+
+  // The first isolate compiles the script and writes the entry.
+  CompileAndRunWithCodeCacheDirectory(source, false);
+  FILE* file = v8::base::OS::FOpen(path.c_str(), "rb");
+  CHECK_NOT_NULL(file);
+  fclose(file);
+
+  // Further isolates find the code on disk and don't have to compile.
+  CompileAndRunWithCodeCacheDirectory(source, true);
+  CompileAndRunWithCodeCacheDirectory(source, true);
+
+  // A corrupted entry is rejected and replaced by the compiled script.
+  file = v8::base::OS::FOpen(path.c_str(), "r+b");
+  CHECK_NOT_NULL(file);
+  CHECK_EQ(0, fseek(file, 337, SEEK_SET));
+  int c = fgetc(file);
+  CHECK_EQ(0, fseek(file, 337, SEEK_SET));
+  fputc(c ^ 0x40, file);
+  fclose(file);
+  CompileAndRunWithCodeCacheDirectory(source, false);
+  CompileAndRunWithCodeCacheDirectory(source, true);
+
+  v8::base::OS::Remove(path.c_str());
+  FLAG_code_cache_dir = nullptr;
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   FLAG_serialize_toplevel = true;
 
@@ -2169,6 +2303,137 @@ TEST(SnapshotCreatorUnknownExternalReferences) {
   delete[] blob.data;
 }
 
+static void CheckSnapshotCompressionRoundTrip(Vector<const byte> data) {
+  std::vector<byte> compressed = SnapshotCompression::Compress(data);
+  Vector<const byte> chunk(compressed.data(),
+                           static_cast<int>(compressed.size()));
+  CHECK(SnapshotCompression::IsCompressed(chunk));
+  CHECK_EQ(data.length(), SnapshotCompression::UncompressedLength(chunk));
+  std::unique_ptr<byte[]> out(new byte[data.length() + 1]);
+  CHECK(SnapshotCompression::Decompress(chunk, out.get()));
+  CHECK_EQ(0, memcmp(data.start(), out.get(), data.length()));
+
+  // Truncated chunks are rejected. Only the empty final sequence may be cut
+  // off without losing data.
+  for (int length = 9; length < chunk.length() - 1; length += 7) {
+    CHECK(!SnapshotCompression::Decompress(chunk.SubVector(0, length),
+                                           out.get()));
+  }
+}
+
+TEST(SnapshotCompressionRoundTrip) {
+  CheckSnapshotCompressionRoundTrip(Vector<const byte>());
+  const byte short_data[] = {1, 2, 3};
+  CheckSnapshotCompressionRoundTrip(ArrayVector(short_data));
+
+  // Long runs, long literal stretches and overlapping matches.
+  std::vector<byte> data;
+  for (int i = 0; i < 1000; i++) data.push_back(7);
+  for (int i = 0; i < 100000; i++) data.push_back((i * 7919) >> 3);
+  for (int i = 0; i < 5000; i++) data.push_back(i % 3);
+  for (int i = 0; i < 3000; i++) data.push_back(data[i * 11]);
+  CheckSnapshotCompressionRoundTrip(
+      Vector<const byte>(data.data(), static_cast<int>(data.size())));
+}
+
+TEST(SnapshotCreatorCompressed) {
+  DisableAlwaysOpt();
+  v8::StartupData blobs[2];
+  for (int i = 0; i < 2; i++) {
+    FLAG_snapshot_compression = i == 1;
+    v8::SnapshotCreator creator;
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun("var f = function() { return 1337; }");
+      creator.SetDefaultContext(context);
+    }
+    blobs[i] =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+  FLAG_snapshot_compression = false;
+  CHECK_LT(blobs[1].raw_size, blobs[0].raw_size);
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blobs[1];
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestIsolate::New(params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    ExpectInt32("f()", 1337);
+  }
+  isolate->Dispose();
+  delete[] blobs[0].data;
+  delete[] blobs[1].data;
+}
+
+static int CountFunctionFeedback(const char* name) {
+  i::Handle<i::JSFunction> function = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun(name)));
+  if (!function->has_feedback_vector()) return 0;
+  int with_type_info = 0;
+  int generic = 0;
+  int vector_ic_count = 0;
+  function->feedback_vector()->ComputeCounts(&with_type_info, &generic,
+                                             &vector_ic_count, true);
+  return with_type_info + generic;
+}
+
+static void TestSnapshotCreatorFeedback(
+    v8::SnapshotCreator::FunctionCodeHandling function_code_handling,
+    bool expect_feedback) {
+  DisableAlwaysOpt();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator;
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "function get(o) { return o.x; }"
+          "for (var i = 0; i < 10; i++) get({x: i});");
+      CHECK_LT(0, CountFunctionFeedback("get"));
+      creator.SetDefaultContext(context);
+    }
+    blob = creator.CreateBlob(function_code_handling);
+  }
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestIsolate::New(params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CHECK_EQ(expect_feedback, CountFunctionFeedback("get") > 0);
+    ExpectInt32("get({x: 42})", 42);
+    ExpectInt32("get({y: 0, x: 43})", 43);
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+}
+
+TEST(SnapshotCreatorClearsFeedback) {
+  TestSnapshotCreatorFeedback(v8::SnapshotCreator::FunctionCodeHandling::kKeep,
+                              false);
+}
+
+TEST(SnapshotCreatorKeepsFeedback) {
+  TestSnapshotCreatorFeedback(
+      v8::SnapshotCreator::FunctionCodeHandling::kKeepWithFeedback, true);
+}
+
 struct InternalFieldData {
   uint32_t data;
 };
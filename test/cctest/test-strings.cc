@@ -1153,6 +1153,49 @@ TEST(CachedHashOverflow) {
 }
 
 
+TEST(LongStringHash) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  const int kLength = String::kMaxHashCalcLength + 100;
+
+  // Long strings are hashed by their prefix and their length.
+  std::string chars(kLength, 'a');
+  Handle<String> a = factory->NewStringFromAsciiChecked(chars.c_str());
+  chars[kLength - 1] = 'b';
+  Handle<String> same_prefix =
+      factory->NewStringFromAsciiChecked(chars.c_str());
+  chars[10] = 'b';
+  Handle<String> other_prefix =
+      factory->NewStringFromAsciiChecked(chars.c_str());
+  Handle<String> longer =
+      factory->NewConsString(a, factory->NewStringFromStaticChars("a"))
+          .ToHandleChecked();
+  CHECK_EQ(a->Hash(), same_prefix->Hash());
+  CHECK_NE(a->Hash(), other_prefix->Hash());
+  CHECK_NE(a->Hash(), longer->Hash());
+
+  // Cons strings hash like their flat contents.
+  Handle<String> half = factory->NewStringFromAsciiChecked(
+      std::string(kLength / 2, 'a').c_str());
+  Handle<String> cons = factory->NewConsString(half, half).ToHandleChecked();
+  CHECK_EQ(a->Hash(), cons->Hash());
+
+  // UTF-8 hashing matches when a surrogate pair straddles the hashed prefix.
+  std::string utf8(String::kMaxHashCalcLength - 1, 'a');
+  utf8 += "\xF0\x9F\x98\x80xyz";
+  Handle<String> two_byte =
+      factory->NewStringFromUtf8(CStrVector(utf8.c_str())).ToHandleChecked();
+  two_byte->Hash();
+  int utf16_length;
+  uint32_t hash_field = StringHasher::ComputeUtf8Hash(
+      CStrVector(utf8.c_str()), isolate->heap()->HashSeed(), &utf16_length);
+  CHECK_EQ(two_byte->length(), utf16_length);
+  CHECK_EQ(two_byte->hash_field(), hash_field);
+}
+
+
 TEST(SliceFromCons) {
   FLAG_string_slices = true;
   CcTest::InitializeVM();
@@ -303,3 +303,51 @@ TEST(TransitionArray_SameFieldNamesDifferentAttributes) {
   CHECK(TransitionArray::IsSortedNoDuplicates(*map0));
 #endif
 }
+
+
+TEST(TransitionArray_LookupCache) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  const int PROPS_COUNT = 200;
+  Handle<String> names[PROPS_COUNT];
+  Handle<Map> maps[PROPS_COUNT];
+
+  Handle<Map> map0 = Map::Create(isolate, 0);
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "prop%d", i);
+    names[i] = factory->InternalizeUtf8String(buffer.start());
+    maps[i] = Map::CopyWithField(map0, names[i], FieldType::Any(isolate), NONE,
+                                 kMutable, Representation::Tagged(),
+                                 OMIT_TRANSITION)
+                  .ToHandleChecked();
+    TransitionArray::Insert(map0, names[i], maps[i], PROPERTY_TRANSITION);
+  }
+
+  // Repeated lookups hit the cache, also after it was cleared by a gc.
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < PROPS_COUNT; i++) {
+      CHECK_EQ(*maps[i], TransitionArray::SearchTransition(*map0, kData,
+                                                           *names[i], NONE));
+      CHECK_NULL(TransitionArray::SearchTransition(*map0, kData, *names[i],
+                                                   READ_ONLY));
+      CHECK_NULL(TransitionArray::SearchTransition(*map0, kAccessor,
+                                                   *names[i], NONE));
+    }
+    CcTest::CollectAllGarbage();
+  }
+
+  // Overwriting a transition updates the cached target.
+  Handle<Map> replacement =
+      Map::CopyWithField(map0, names[0], FieldType::Any(isolate), NONE,
+                         kMutable, Representation::Tagged(), OMIT_TRANSITION)
+          .ToHandleChecked();
+  TransitionArray::Insert(map0, names[0], replacement, PROPERTY_TRANSITION);
+  CHECK_EQ(*replacement,
+           TransitionArray::SearchTransition(*map0, kData, *names[0], NONE));
+  CHECK_EQ(PROPS_COUNT,
+           TransitionArray::NumberOfTransitions(map0->raw_transitions()));
+}
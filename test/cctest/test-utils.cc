@@ -191,6 +191,30 @@ TEST(MemMove) {
 }
 
 
+TEST(CopyAndMoveWords) {
+  static const int kWords = 64;
+  intptr_t area[2 * kWords];
+  intptr_t expected[2 * kWords];
+  for (int length = 1; length <= kWords; length++) {
+    for (int i = 0; i < 2 * kWords; i++) area[i] = expected[i] = -i;
+    CopyWords(area + kWords, area, length);
+    memcpy(expected + kWords, expected, length * sizeof(intptr_t));
+    CHECK_EQ(0, memcmp(area, expected, sizeof(area)));
+
+    // Overlapping moves in both directions.
+    for (int shift = 1; shift < length; shift++) {
+      for (int i = 0; i < 2 * kWords; i++) area[i] = expected[i] = i;
+      MoveWords(area + shift, area, length);
+      memmove(expected + shift, expected, length * sizeof(intptr_t));
+      CHECK_EQ(0, memcmp(area, expected, sizeof(area)));
+      MoveWords(area, area + shift, length);
+      memmove(expected, expected + shift, length * sizeof(intptr_t));
+      CHECK_EQ(0, memcmp(area, expected, sizeof(area)));
+    }
+  }
+}
+
+
 TEST(Collector) {
   Collector<int> collector(8);
   const int kLoops = 5;
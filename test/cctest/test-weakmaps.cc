@@ -164,6 +164,88 @@ TEST(Shrinking) {
 }
 
 
+// Test that a chain of ephemerons where each value is the key of the next entry
+// is kept alive by its first key and collected without it.
+TEST(EphemeronChain) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmap = AllocateJSWeakMap(isolate);
+  const int kLength = 1000;
+  Handle<FixedArray> keys = factory->NewFixedArray(kLength + 1);
+  {
+    HandleScope scope(isolate);
+    Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+    for (int i = 0; i <= kLength; i++) {
+      keys->set(i, *factory->NewJSObjectFromMap(map));
+    }
+    // Insert the entries in reverse order to defeat any scanning order.
+    for (int i = kLength - 1; i >= 0; i--) {
+      Handle<JSObject> key(JSObject::cast(keys->get(i)), isolate);
+      Handle<Object> value(keys->get(i + 1), isolate);
+      int32_t hash = Object::GetOrCreateHash(isolate, key)->value();
+      JSWeakCollection::Set(weakmap, key, value, hash);
+    }
+  }
+  // Only the first key stays reachable from outside of the weak map.
+  for (int i = 1; i <= kLength; i++) keys->set(i, Smi::kZero);
+
+  CcTest::CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  CHECK_EQ(kLength,
+           ObjectHashTable::cast(weakmap->table())->NumberOfElements());
+  {
+    HandleScope scope(isolate);
+    Handle<Object> key(keys->get(0), isolate);
+    for (int i = 0; i < kLength; i++) {
+      ObjectHashTable* table = ObjectHashTable::cast(weakmap->table());
+      Object* value = table->Lookup(key);
+      CHECK(value->IsJSObject());
+      key = handle(value, isolate);
+    }
+  }
+
+  keys->set(0, Smi::kZero);
+  CcTest::CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  CHECK_EQ(0, ObjectHashTable::cast(weakmap->table())->NumberOfElements());
+}
+
+
+// Test that tables that are cleared in several chunks end up with the right
+// element counts.
+TEST(ClearingLargeWeakMap) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmap = AllocateJSWeakMap(isolate);
+  const int kEntries = 20000;
+  Handle<FixedArray> live_keys = factory->NewFixedArray(kEntries / 2);
+  {
+    HandleScope scope(isolate);
+    Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+    for (int i = 0; i < kEntries; i++) {
+      Handle<JSObject> object = factory->NewJSObjectFromMap(map);
+      Handle<Smi> smi(Smi::FromInt(i), isolate);
+      int32_t object_hash = Object::GetOrCreateHash(isolate, object)->value();
+      JSWeakCollection::Set(weakmap, object, smi, object_hash);
+      if (i % 2 == 0) live_keys->set(i / 2, *object);
+    }
+  }
+  CHECK_LT(16 * KB, ObjectHashTable::cast(weakmap->table())->Capacity());
+  CHECK_EQ(kEntries,
+           ObjectHashTable::cast(weakmap->table())->NumberOfElements());
+
+  CcTest::CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  ObjectHashTable* table = ObjectHashTable::cast(weakmap->table());
+  CHECK_EQ(kEntries / 2, table->NumberOfElements());
+  for (int i = 0; i < kEntries / 2; i++) {
+    CHECK_EQ(Smi::FromInt(2 * i),
+             table->Lookup(handle(live_keys->get(i), isolate)));
+  }
+}
+
+
 // Test that weak map values on an evacuation candidate which are not reachable
 // by other paths are correctly recorded in the slots buffer.
 TEST(Regress2060a) {
@@ -9,12 +9,14 @@
 #include "src/snapshot/code-serializer.h"
 #include "src/version.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/wasm/wasm-opcodes.h"
 
 #include "test/cctest/cctest.h"
+#include "test/common/wasm/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
@@ -212,6 +214,95 @@ TEST(Run_WasmModule_Global) {
   Cleanup();
 }
 
+namespace {
+// Feeds the module into a {StreamingDecoder} in chunks of {chunk_size} bytes.
+MaybeHandle<WasmModuleObject> CompileWhileStreaming(Isolate* isolate,
+                                                    const ZoneBuffer& buffer,
+                                                    size_t chunk_size) {
+  StreamingDecoder stream(isolate);
+  for (size_t offset = 0; offset < buffer.size(); offset += chunk_size) {
+    size_t length = std::min(chunk_size, buffer.size() - offset);
+    stream.OnBytesReceived(
+        Vector<const uint8_t>(buffer.begin() + offset, length));
+  }
+  return stream.Finish();
+}
+}  // namespace
+
+TEST(Run_WasmModule_CompileWhileStreaming) {
+  {
+    v8::internal::AccountingAllocator allocator;
+    Zone zone(&allocator, ZONE_NAME);
+    TestSignatures sigs;
+
+    WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+    uint32_t global1 = builder->AddGlobal(kWasmI32, 0);
+    uint32_t global2 = builder->AddGlobal(kWasmI32, 0);
+    WasmFunctionBuilder* f1 = builder->AddFunction(sigs.i_ii());
+    byte code1[] = {WASM_I32_ADD(WASM_GET_LOCAL(0), WASM_GET_GLOBAL(global2))};
+    EMIT_CODE_WITH_END(f1, code1);
+    WasmFunctionBuilder* f2 = builder->AddFunction(sigs.i_v());
+    ExportAsMain(f2);
+    byte code2[] = {WASM_SET_GLOBAL(global1, WASM_I32V_1(56)),
+                    WASM_SET_GLOBAL(global2, WASM_I32V_1(41)),
+                    WASM_CALL_FUNCTION(f1->func_index(),
+                                       WASM_GET_GLOBAL(global1),
+                                       WASM_I32V_1(0))};
+    EMIT_CODE_WITH_END(f2, code2);
+    byte data[] = {0xaa, 0xbb, 0xcc, 0xdd};
+    builder->AddDataSegment(data, sizeof(data), 0);
+    ZoneBuffer buffer(&zone);
+    builder->WriteTo(buffer);
+
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    HandleScope scope(isolate);
+    testing::SetupIsolateForWasmModule(isolate);
+    // The function bodies get compiled between the chunks, the data section
+    // is received after that.
+    for (size_t chunk_size = 1; chunk_size < 2 * buffer.size();
+         chunk_size *= 2) {
+      Handle<WasmModuleObject> module_object =
+          CompileWhileStreaming(isolate, buffer, chunk_size).ToHandleChecked();
+      ErrorThrower thrower(isolate, "Instantiation");
+      Handle<WasmInstanceObject> instance =
+          SyncInstantiate(isolate, &thrower, module_object, {}, {})
+              .ToHandleChecked();
+      CHECK_EQ(97, testing::RunWasmModuleForTesting(isolate, instance, 0,
+                                                  nullptr));
+    }
+  }
+  Cleanup();
+}
+
+TEST(Run_WasmModule_CompileWhileStreamingFails) {
+  {
+    v8::internal::AccountingAllocator allocator;
+    Zone zone(&allocator, ZONE_NAME);
+    TestSignatures sigs;
+
+    WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+    WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+    ExportAsMain(f);
+    // The function returns a value of the wrong type.
+    byte code[] = {WASM_F32(1.0f)};
+    EMIT_CODE_WITH_END(f, code);
+    ZoneBuffer buffer(&zone);
+    builder->WriteTo(buffer);
+
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    HandleScope scope(isolate);
+    testing::SetupIsolateForWasmModule(isolate);
+    for (size_t chunk_size = 1; chunk_size < 2 * buffer.size();
+         chunk_size *= 2) {
+      v8::TryCatch try_catch(reinterpret_cast<v8::Isolate*>(isolate));
+      CHECK(CompileWhileStreaming(isolate, buffer, chunk_size).is_null());
+      CHECK(try_catch.HasCaught());
+      isolate->clear_pending_exception();
+    }
+  }
+  Cleanup();
+}
+
 // Approximate gtest TEST_F style, in case we adopt gtest.
 class WasmSerializationTest {
  public:
@@ -249,6 +340,20 @@ class WasmSerializationTest {
            wire_bytes_.second / 2);
   }
 
+  // Changes the constant which the exported function adds to its argument.
+  void ChangeIncrement(uint8_t increment) {
+    uint8_t* bytes = const_cast<uint8_t*>(wire_bytes_.first);
+    const uint8_t pattern[] = {kExprI32Const, 1, kExprI32Add};
+    uint8_t* end = bytes + wire_bytes_.second - sizeof(pattern);
+    for (uint8_t* pos = bytes; pos <= end; ++pos) {
+      if (memcmp(pos, pattern, sizeof(pattern)) == 0) {
+        pos[1] = increment;
+        return;
+      }
+    }
+    UNREACHABLE();
+  }
+
   void InvalidateLength() {
     uint32_t* slot = reinterpret_cast<uint32_t*>(
         const_cast<uint8_t*>(serialized_bytes_.first) +
@@ -264,7 +369,7 @@ class WasmSerializationTest {
     return deserialized;
   }
 
-  void DeserializeAndRun() {
+  void DeserializeAndRun(int32_t expected_result = 42) {
     ErrorThrower thrower(current_isolate(), "");
     v8::Local<v8::WasmCompiledModule> deserialized_module;
     CHECK(Deserialize().ToLocal(&deserialized_module));
@@ -288,7 +393,7 @@ class WasmSerializationTest {
         Handle<Object>(Smi::FromInt(41), current_isolate())};
     int32_t result = testing::CallWasmFunctionForTesting(
         current_isolate(), instance, &thrower, kFunctionName, 1, params);
-    CHECK(result == 42);
+    CHECK_EQ(expected_result, result);
   }
 
   Isolate* current_isolate() {
@@ -425,6 +530,19 @@ TEST(DeserializeInvalidLength) {
   Cleanup();
 }
 
+TEST(DeserializeMismatchingWireBytes) {
+  WasmSerializationTest test;
+  {
+    HandleScope scope(test.current_isolate());
+    // The serialized code does not belong to the new wire bytes, so they get
+    // compiled instead.
+    test.ChangeIncrement(2);
+    test.DeserializeAndRun(43);
+  }
+  Cleanup(test.current_isolate());
+  Cleanup();
+}
+
 TEST(DeserializeWireBytesAndSerializedDataInvalid) {
   WasmSerializationTest test;
   {
@@ -1069,6 +1187,57 @@ TEST(MemoryWithOOBEmptyDataSegment) {
   Cleanup();
 }
 
+TEST(Run_WasmModule_GrowMemoryInPlace) {
+  {
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    HandleScope scope(isolate);
+    // Initial memory size = 16 + GrowWebAssemblyMemory(4) + GrowMemory(6)
+    static const int kExpectedValue = 26;
+    TestSignatures sigs;
+    v8::internal::AccountingAllocator allocator;
+    Zone zone(&allocator, ZONE_NAME);
+
+    WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+    WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+    ExportAsMain(f);
+    byte code[] = {WASM_GROW_MEMORY(WASM_I32V_1(6)), WASM_DROP,
+                   WASM_MEMORY_SIZE};
+    EMIT_CODE_WITH_END(f, code);
+
+    ZoneBuffer buffer(&zone);
+    builder->WriteTo(buffer);
+    testing::SetupIsolateForWasmModule(isolate);
+    ErrorThrower thrower(isolate, "Test");
+    const Handle<WasmInstanceObject> instance =
+        SyncCompileAndInstantiate(isolate, &thrower,
+                                  ModuleWireBytes(buffer.begin(), buffer.end()),
+                                  {}, {})
+            .ToHandleChecked();
+    Handle<JSArrayBuffer> memory(instance->memory_buffer(), isolate);
+    byte* const mem_start = reinterpret_cast<byte*>(memory->backing_store());
+    mem_start[0] = 0xab;
+
+    Handle<WasmMemoryObject> mem_obj =
+        WasmMemoryObject::New(isolate, memory, 100);
+    CHECK_EQ(16, WasmMemoryObject::Grow(isolate, mem_obj, 4));
+    // Only memory with guard regions has the address space to grow in place.
+    // The old buffer is then detached, but its memory lives on in the new one.
+    const bool in_place = memory->has_guard_region();
+    CHECK_EQ(in_place, memory->was_neutered());
+    memory = handle(mem_obj->buffer());
+    CHECK_EQ(20 * WasmModule::kPageSize, memory->byte_length()->Number());
+    CHECK_EQ(in_place, mem_start == memory->backing_store());
+    CHECK_EQ(0xab, reinterpret_cast<byte*>(memory->backing_store())[0]);
+
+    instance->set_memory_buffer(*memory);
+    int32_t result =
+        testing::RunWasmModuleForTesting(isolate, instance, 0, nullptr);
+    CHECK_EQ(kExpectedValue, result);
+    CHECK_EQ(in_place, mem_start == instance->memory_buffer()->backing_store());
+  }
+  Cleanup();
+}
+
 TEST(Run_WasmModule_Buffer_Externalized_GrowMem) {
   {
     Isolate* isolate = CcTest::InitIsolateOnce();
@@ -1171,3 +1340,72 @@ TEST(Run_WasmModule_Buffer_Externalized_Detach) {
   }
   Cleanup();
 }
+
+TEST(Run_WasmModule_ShareInstanceIndependentCode) {
+  FlagScope<bool> share_code(&FLAG_wasm_share_code, true);
+  {
+    v8::internal::AccountingAllocator allocator;
+    Zone zone(&allocator, ZONE_NAME);
+    TestSignatures sigs;
+
+    WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+    WasmFunctionBuilder* add = builder->AddFunction(sigs.i_ii());
+    byte add_code[] = {WASM_I32_ADD(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1))};
+    EMIT_CODE_WITH_END(add, add_code);
+    WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+    ExportAsMain(f);
+    byte code[] = {
+        WASM_I32_ADD(WASM_LOAD_MEM(MachineType::Int32(), WASM_ZERO),
+                     WASM_CALL_FUNCTION(add->func_index(), WASM_I32V_1(40),
+                                        WASM_I32V_1(2)))};
+    EMIT_CODE_WITH_END(f, code);
+    ZoneBuffer buffer(&zone);
+    builder->WriteTo(buffer);
+
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    HandleScope scope(isolate);
+    testing::SetupIsolateForWasmModule(isolate);
+    ErrorThrower thrower(isolate, "ShareInstanceIndependentCode");
+    Handle<WasmModuleObject> module_object =
+        SyncCompile(isolate, &thrower,
+                    ModuleWireBytes(buffer.begin(), buffer.end()))
+            .ToHandleChecked();
+
+    Handle<WasmInstanceObject> second;
+    {
+      HandleScope inner(isolate);
+      Handle<WasmInstanceObject> first =
+          SyncInstantiate(isolate, &thrower, module_object, {}, {})
+              .ToHandleChecked();
+      Handle<WasmInstanceObject> instance =
+          SyncInstantiate(isolate, &thrower, module_object, {}, {})
+              .ToHandleChecked();
+      FixedArray* first_code = first->compiled_module()->ptr_to_code_table();
+      FixedArray* code_table =
+          instance->compiled_module()->ptr_to_code_table();
+      // The leaf function is shared, the one that accesses memory and calls
+      // another function is copied.
+      CHECK_EQ(first_code->get(add->func_index()),
+               code_table->get(add->func_index()));
+      CHECK_NE(first_code->get(f->func_index()),
+               code_table->get(f->func_index()));
+      CHECK_EQ(*first, wasm::GetOwningWasmInstance(
+                           Code::cast(code_table->get(add->func_index()))));
+      CHECK_EQ(*instance, wasm::GetOwningWasmInstance(
+                              Code::cast(code_table->get(f->func_index()))));
+      CHECK_EQ(42, testing::RunWasmModuleForTesting(isolate, first, 0,
+                                                    nullptr));
+      second = inner.CloseAndEscape(instance);
+    }
+
+    // The owner of the shared code lives as long as the instances using it.
+    Cleanup(isolate);
+    Code* shared_code = Code::cast(
+        second->compiled_module()->ptr_to_code_table()->get(
+            add->func_index()));
+    CHECK_NOT_NULL(wasm::GetOwningWasmInstance(shared_code));
+    CHECK_EQ(42,
+             testing::RunWasmModuleForTesting(isolate, second, 0, nullptr));
+  }
+  Cleanup();
+}
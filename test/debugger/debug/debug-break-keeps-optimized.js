@@ -0,0 +1,40 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --opt --no-always-opt
+
+// Setting a break point only deoptimizes code that contains the function.
+
+Debug = debug.Debug;
+
+var break_count = 0;
+Debug.setListener(function(event) {
+  if (event == Debug.DebugEvent.Break) break_count++;
+});
+
+function unrelated(x) { return x + 1; }
+function target(x) { return x * 2; }
+
+unrelated(1);
+unrelated(2);
+target(1);
+target(2);
+%OptimizeFunctionOnNextCall(unrelated);
+%OptimizeFunctionOnNextCall(target);
+unrelated(3);
+target(3);
+assertOptimized(unrelated);
+assertOptimized(target);
+
+Debug.setBreakPoint(target, 0, 0);
+assertOptimized(unrelated);
+assertUnoptimized(target);
+
+assertEquals(6, target(3));
+assertEquals(1, break_count);
+assertEquals(4, unrelated(3));
+assertOptimized(unrelated);
+
+Debug.clearAllBreakPoints();
+Debug.setListener(null);
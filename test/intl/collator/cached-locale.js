@@ -0,0 +1,35 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// localeCompare and toLocaleString reuse collators and formatters created
+// for a single locale string. Check that the cached instances give the same
+// results as fresh ones, also after evicting them from the cache.
+
+var locales = ['en', 'de', 'sv', 'fr', 'es', 'it', 'ja', 'ru', 'zh', 'nl',
+               'pl', 'pt', 'tr', 'ko', 'fi', 'da', 'nb', 'cs'];
+
+for (var round = 0; round < 2; round++) {
+  for (var locale of locales) {
+    var collator = new Intl.Collator(locale);
+    assertEquals(collator.compare('a', 'b'), 'a'.localeCompare('b', locale));
+    assertEquals(collator.compare('z', 'ä'),
+                 'z'.localeCompare('ä', locale));
+    assertEquals(collator.compare('abc', 'ABC'),
+                 'abc'.localeCompare('ABC', locale));
+    var format = new Intl.NumberFormat(locale);
+    assertEquals(format.format(1234.5), (1234.5).toLocaleString(locale));
+  }
+}
+
+// Options bypass the cache.
+assertEquals(0, 'a'.localeCompare('A', 'en', {sensitivity: 'base'}));
+assertTrue('a'.localeCompare('A', 'en') !== 0);
+
+// ASCII and non-ASCII strings compare consistently.
+assertEquals(-1, 'a'.localeCompare('b', 'en'));
+assertEquals(1, 'b'.localeCompare('a', 'en'));
+assertEquals(0, 'abc'.localeCompare('abc', 'en'));
+assertEquals(-1, 'a'.localeCompare('á', 'en'));
+assertEquals(-1, 'ab'.localeCompare('abc', 'en'));
+assertEquals(-1, ''.localeCompare('a', 'en'));
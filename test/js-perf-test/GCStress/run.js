@@ -0,0 +1,97 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Keeps a live set of the given size and shape alive while allocating
+// short-lived garbage at a fixed rate, and replaces part of the live set
+// over time so that old generation collections have work to do. Run with
+// --trace-gc-statistics-json to get the pause time percentiles of the run.
+//
+// Usage: d8 --trace-gc-statistics-json run.js --
+//            [live set MB] [allocation MB/s] [tree|list|array|map] [seconds]
+
+var args = typeof arguments !== 'undefined' ? arguments : [];
+var kLiveSetMB = Number(args[0] || 100);
+var kAllocationMBPerSecond = Number(args[1] || 200);
+var kShape = args[2] || 'tree';
+var kSeconds = Number(args[3] || 5);
+
+// Rough sizes of the objects on 64-bit platforms, used to turn megabytes
+// into object counts.
+var kNodeBytes = 40;
+var kChunkNodes = 1024;
+var kChunkBytes = kChunkNodes * kNodeBytes;
+// Fraction of the live set replaced per second.
+var kChurnPerSecond = 0.1;
+
+function Node(value, left, right) {
+  this.value = value;
+  this.left = left;
+  this.right = right;
+}
+
+function MakeTree(depth) {
+  if (depth == 0) return new Node(0, null, null);
+  return new Node(depth, MakeTree(depth - 1), MakeTree(depth - 1));
+}
+
+function MakeList(length) {
+  var head = null;
+  for (var i = 0; i < length; i++) head = new Node(i, head, null);
+  return head;
+}
+
+function MakeArray(length) {
+  var array = new Array(length);
+  for (var i = 0; i < length; i++) array[i] = {value: i};
+  return array;
+}
+
+function MakeMap(length) {
+  var map = new Map();
+  for (var i = 0; i < length; i++) map.set(i, {value: i});
+  return map;
+}
+
+// Every chunk holds roughly kChunkBytes of live objects.
+function MakeChunk() {
+  switch (kShape) {
+    case 'tree':
+      return MakeTree(Math.log2(kChunkNodes) - 1);
+    case 'list':
+      return MakeList(kChunkNodes);
+    case 'array':
+      return MakeArray(kChunkNodes);
+    case 'map':
+      return MakeMap(kChunkNodes / 2);
+  }
+  throw new Error('Unknown shape ' + kShape);
+}
+
+var chunks = new Array(Math.ceil(kLiveSetMB * 1024 * 1024 / kChunkBytes));
+for (var i = 0; i < chunks.length; i++) chunks[i] = MakeChunk();
+
+var start = Date.now();
+var end = start + kSeconds * 1000;
+var allocatedBytes = 0;
+var replacedChunks = 0;
+var sink;
+for (var now = start; now < end; now = Date.now()) {
+  var elapsed = (now - start) / 1000;
+  // Short-lived garbage at the requested rate.
+  var target = elapsed * kAllocationMBPerSecond * 1024 * 1024;
+  while (allocatedBytes < target) {
+    sink = MakeList(kChunkNodes);
+    allocatedBytes += kChunkBytes;
+  }
+  // Promoted objects that die later.
+  var replace = Math.floor(elapsed * kChurnPerSecond * chunks.length);
+  while (replacedChunks < replace) {
+    chunks[Math.floor(Math.random() * chunks.length)] = MakeChunk();
+    replacedChunks++;
+  }
+}
+
+print('GCStress(AllocatedMB): ' + Math.round(allocatedBytes / 1024 / 1024));
+print('GCStress(ReplacedMB): ' +
+      Math.round(replacedChunks * kChunkBytes / 1024 / 1024));
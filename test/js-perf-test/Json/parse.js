@@ -0,0 +1,51 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Parse', [1000], [
+  new Benchmark('Compact', false, false, 0, ParseCompact, Setup),
+  new Benchmark('Indented', false, false, 0, ParseIndented, Setup),
+  new Benchmark('LongStrings', false, false, 0, ParseLongStrings, Setup),
+]);
+
+var compact;
+var indented;
+var long_strings;
+
+function Setup() {
+  var records = [];
+  for (var i = 0; i < 100; i++) {
+    records.push({
+      id: i,
+      name: 'record number ' + i,
+      active: (i & 1) == 0,
+      score: i * 1.5,
+      tags: ['alpha', 'beta', 'gamma'],
+      address: {street: 'Main Street ' + i, city: 'Springfield'}
+    });
+  }
+  compact = JSON.stringify(records);
+  indented = JSON.stringify(records, null, 8);
+  var text = 'The quick brown fox jumps over the lazy dog. ';
+  var strings = [];
+  for (var i = 0; i < 50; i++) {
+    strings.push(text.repeat(20) + i);
+    strings.push(text.repeat(10) + '\n' + text.repeat(10));
+  }
+  long_strings = JSON.stringify(strings);
+}
+
+function ParseCompact() {
+  var result = JSON.parse(compact);
+  if (result.length != 100) throw new Error('Unexpected result');
+}
+
+function ParseIndented() {
+  var result = JSON.parse(indented);
+  if (result.length != 100) throw new Error('Unexpected result');
+}
+
+function ParseLongStrings() {
+  var result = JSON.parse(long_strings);
+  if (result.length != 100) throw new Error('Unexpected result');
+}
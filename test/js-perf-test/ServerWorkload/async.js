@@ -0,0 +1,48 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A request goes through a chain of async middleware, each awaiting a
+// simulated backend call.
+new BenchmarkSuite('AsyncHandlers', [1000, 1000], [
+  ServerBenchmark('AsyncHandlers', AsyncRequest),
+]);
+
+function Backend(value) {
+  return new Promise(function(resolve) { resolve(value + 1); });
+}
+
+async function Authenticate(context) {
+  context.user = await Backend(context.id);
+  return context;
+}
+
+async function LoadSession(context) {
+  var results = await Promise.all(
+      [Backend(context.user), Backend(context.user * 2)]);
+  context.session = results[0] + results[1];
+  return context;
+}
+
+async function Handle(context) {
+  await Authenticate(context);
+  await LoadSession(context);
+  try {
+    if (context.session % 7 == 0) throw new Error('rejected');
+    context.status = 200;
+  } catch (e) {
+    context.status = 403;
+  }
+  return context;
+}
+
+var handled;
+
+function AsyncRequest() {
+  handled = 0;
+  for (var i = 0; i < 50; i++) {
+    Handle({id: i}).then(function() { handled++; });
+  }
+  %RunMicrotasks();
+  CheckEquals(50, handled);
+}
@@ -0,0 +1,45 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Buffer-style work on typed arrays: encoding a string into bytes, framing
+// it with a length header and computing a checksum.
+new BenchmarkSuite('TypedArrayBuffers', [1000, 1000], [
+  ServerBenchmark('TypedArrayBuffers', BufferRequest, BufferSetup),
+]);
+
+var payload;
+
+function BufferSetup() {
+  payload = 'GET /index.html HTTP/1.1\r\nHost: example.com\r\n'.repeat(40);
+}
+
+function EncodeAscii(string) {
+  var bytes = new Uint8Array(string.length);
+  for (var i = 0; i < string.length; i++) bytes[i] = string.charCodeAt(i);
+  return bytes;
+}
+
+function Frame(bytes) {
+  var frame = new Uint8Array(bytes.length + 4);
+  new DataView(frame.buffer).setUint32(0, bytes.length);
+  frame.set(bytes, 4);
+  return frame;
+}
+
+function Adler32(bytes) {
+  var a = 1, b = 0;
+  for (var i = 0; i < bytes.length; i++) {
+    a = (a + bytes[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  return ((b << 16) | a) >>> 0;
+}
+
+function BufferRequest() {
+  var frame = Frame(EncodeAscii(payload));
+  var length = new DataView(frame.buffer).getUint32(0);
+  var body = frame.subarray(4, 4 + length);
+  var copy = body.slice();
+  CheckEquals(Adler32(body), Adler32(copy));
+}
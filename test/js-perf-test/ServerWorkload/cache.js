@@ -0,0 +1,59 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// An LRU cache on top of a Map, with a mix of hits, misses and evictions.
+new BenchmarkSuite('MapCache', [1000, 1000], [
+  ServerBenchmark('MapCache', CacheRequest, CacheSetup, CacheTearDown),
+]);
+
+function LruCache(capacity) {
+  this.capacity = capacity;
+  this.map = new Map();
+}
+
+LruCache.prototype.get = function(key) {
+  var value = this.map.get(key);
+  if (value === undefined) return undefined;
+  this.map.delete(key);
+  this.map.set(key, value);
+  return value;
+};
+
+LruCache.prototype.set = function(key, value) {
+  if (this.map.has(key)) {
+    this.map.delete(key);
+  } else if (this.map.size >= this.capacity) {
+    this.map.delete(this.map.keys().next().value);
+  }
+  this.map.set(key, value);
+};
+
+var cache;
+var nextKey;
+
+function CacheSetup() {
+  cache = new LruCache(1000);
+  nextKey = 0;
+}
+
+function CacheRequest() {
+  var hits = 0;
+  for (var i = 0; i < 200; i++) {
+    // Most lookups go to a hot set of keys, the rest cause evictions.
+    var key = Math.random() < 0.8
+        ? 'user:' + Math.floor(Math.random() * 500)
+        : 'user:' + (1000 + nextKey++);
+    var value = cache.get(key);
+    if (value !== undefined) {
+      hits++;
+    } else {
+      cache.set(key, {key: key, loaded: i, roles: ['reader']});
+    }
+  }
+  CheckEquals(true, hits <= 200);
+}
+
+function CacheTearDown() {
+  cache = null;
+}
@@ -0,0 +1,81 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Every benchmark in this suite handles one request per run and records how
+// long it took, so that GC pauses show up in the tail of the latency
+// distribution. Latencies go into log-scale buckets to keep the recording
+// free of allocations.
+
+var kBucketsPerDoubling = 8;
+var kBucketCount = 30 * kBucketsPerDoubling;
+var latencyBuckets = new Uint32Array(kBucketCount);
+var latencyCount = 0;
+var peakHeapUsage = 0;
+
+function BucketFor(usec) {
+  if (usec < 1) return 0;
+  var bucket = Math.floor(Math.log2(usec) * kBucketsPerDoubling) + 1;
+  return Math.min(bucket, kBucketCount - 1);
+}
+
+function BucketLimit(bucket) {
+  return Math.pow(2, bucket / kBucketsPerDoubling);
+}
+
+function Request(handler) {
+  return function() {
+    var start = performance.now();
+    handler();
+    var usec = (performance.now() - start) * 1000;
+    latencyBuckets[BucketFor(usec)]++;
+    latencyCount++;
+    var heap = %GetHeapUsage();
+    if (heap > peakHeapUsage) peakHeapUsage = heap;
+  };
+}
+
+function ResetLatencies() {
+  latencyBuckets.fill(0);
+  latencyCount = 0;
+}
+
+// Returns the given percentile of the request latencies since the last
+// reset, in microseconds.
+function LatencyPercentile(percentile) {
+  var remaining = Math.ceil(latencyCount * percentile / 100);
+  for (var i = 0; i < kBucketCount; i++) {
+    remaining -= latencyBuckets[i];
+    if (remaining <= 0) return BucketLimit(i);
+  }
+  return BucketLimit(kBucketCount - 1);
+}
+
+// Reported as the latency result of each benchmark.
+function Latency99() {
+  var result = LatencyPercentile(99);
+  ResetLatencies();
+  return result;
+}
+
+// Requests are handled for this long before measuring, so that the reported
+// latencies are those of the steady state rather than of tier-up.
+var kWarmupMs = 1000;
+
+function ServerBenchmark(name, handler, setup, tearDown) {
+  var request = Request(handler);
+  function Setup() {
+    if (setup) setup();
+    var start = performance.now();
+    while (performance.now() - start < kWarmupMs) request();
+    ResetLatencies();
+  }
+  return new Benchmark(name, false, false, 0, request, Setup, tearDown,
+                       Latency99);
+}
+
+function CheckEquals(expected, actual) {
+  if (expected !== actual) {
+    throw new Error('Expected ' + expected + ' but got ' + actual);
+  }
+}
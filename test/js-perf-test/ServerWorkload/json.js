@@ -0,0 +1,48 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Parses a large JSON request body, updates it and serializes the response.
+new BenchmarkSuite('JsonRequest', [1000, 1000], [
+  ServerBenchmark('JsonRequest', JsonRequest, JsonSetup, JsonTearDown),
+]);
+
+var requestBody;
+
+function JsonSetup() {
+  var orders = [];
+  for (var i = 0; i < 500; i++) {
+    orders.push({
+      id: 'order-' + i,
+      customer: {id: i % 37, name: 'customer ' + (i % 37), vip: i % 5 == 0},
+      items: [
+        {sku: 'sku-' + (i * 7 % 101), quantity: 1 + i % 3, price: 9.99},
+        {sku: 'sku-' + (i * 13 % 101), quantity: 2, price: 24.5}
+      ],
+      note: i % 4 == 0 ? 'leave at the door \u00e9' : null,
+      created: 1500000000000 + i * 1000
+    });
+  }
+  requestBody = JSON.stringify({orders: orders, page: 1, total: 500});
+}
+
+function JsonRequest() {
+  var request = JSON.parse(requestBody);
+  var totals = [];
+  var orders = request.orders;
+  for (var i = 0; i < orders.length; i++) {
+    var order = orders[i];
+    var sum = 0;
+    for (var j = 0; j < order.items.length; j++) {
+      sum += order.items[j].quantity * order.items[j].price;
+    }
+    totals.push({id: order.id, total: Math.round(sum * 100) / 100,
+                 vip: order.customer.vip});
+  }
+  var response = JSON.stringify({totals: totals, page: request.page});
+  CheckEquals(true, response.length > requestBody.length / 10);
+}
+
+function JsonTearDown() {
+  requestBody = null;
+}
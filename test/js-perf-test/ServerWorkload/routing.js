@@ -0,0 +1,69 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Matches request paths against a table of regexp routes and extracts the
+// parameters.
+new BenchmarkSuite('RegExpRouting', [1000, 1000], [
+  ServerBenchmark('RegExpRouting', RouteRequest, RoutingSetup),
+]);
+
+var routes;
+var paths;
+
+function Route(method, pattern) {
+  var names = [];
+  var source = pattern.replace(/:(\w+)/g, function(_, name) {
+    names.push(name);
+    return '([^/]+)';
+  });
+  this.method = method;
+  this.re = new RegExp('^' + source + '/?$', 'i');
+  this.names = names;
+}
+
+function RoutingSetup() {
+  routes = [
+    new Route('GET', '/'),
+    new Route('GET', '/users'),
+    new Route('GET', '/users/:id'),
+    new Route('PUT', '/users/:id'),
+    new Route('GET', '/users/:id/posts/:post'),
+    new Route('GET', '/search/:query'),
+    new Route('POST', '/api/v1/orders'),
+    new Route('GET', '/api/v1/orders/:order/items/:item'),
+    new Route('GET', '/static/:file'),
+  ];
+  paths = [];
+  for (var i = 0; i < 100; i++) {
+    paths.push(['GET', '/users/' + i + '/posts/' + (i * 3)]);
+    paths.push(['GET', '/api/v1/orders/' + i + '/items/x' + i + '?page=2']);
+    paths.push(['PUT', '/users/' + i]);
+    paths.push(['GET', '/missing/' + i]);
+  }
+}
+
+function Dispatch(method, url) {
+  var query = url.indexOf('?');
+  var path = query < 0 ? url : url.substring(0, query);
+  for (var i = 0; i < routes.length; i++) {
+    var route = routes[i];
+    if (route.method != method) continue;
+    var match = route.re.exec(path);
+    if (match === null) continue;
+    var params = {};
+    for (var j = 0; j < route.names.length; j++) {
+      params[route.names[j]] = decodeURIComponent(match[j + 1]);
+    }
+    return params;
+  }
+  return null;
+}
+
+function RouteRequest() {
+  var found = 0;
+  for (var i = 0; i < paths.length; i++) {
+    if (Dispatch(paths[i][0], paths[i][1]) !== null) found++;
+  }
+  CheckEquals(300, found);
+}
@@ -0,0 +1,35 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+load('../base.js');
+load('common.js');
+load('json.js');
+load('async.js');
+load('cache.js');
+load('templates.js');
+load('routing.js');
+load('buffers.js');
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-ServerWorkload(Score): ' + result);
+}
+
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
+
+// Peak heap usage over all requests, sampled after each of them.
+print('PeakHeap-ServerWorkload(KB): ' + Math.round(peakHeapUsage / 1024));
@@ -0,0 +1,79 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Renders a page from a compiled template with escaping, loops and
+// conditionals.
+new BenchmarkSuite('TemplateRendering', [1000, 1000], [
+  ServerBenchmark('TemplateRendering', RenderRequest, TemplateSetup),
+]);
+
+var kTemplate =
+    '<ul>{{#items}}<li class="{{cls}}">{{name}}: {{price}}</li>{{/items}}' +
+    '</ul><p>{{footer}}</p>';
+
+var kEscapes = {'&': '&amp;', '<': '&lt;', '>': '&gt;', '"': '&quot;'};
+
+function Escape(value) {
+  return String(value).replace(/[&<>"]/g, function(c) { return kEscapes[c]; });
+}
+
+// Compiles a template into a list of functions that append to the output.
+function Compile(template) {
+  var parts = [];
+  var re = /\{\{(#|\/)?(\w+)\}\}/g;
+  var last = 0;
+  var match;
+  var stack = [parts];
+  while ((match = re.exec(template)) !== null) {
+    var current = stack[stack.length - 1];
+    current.push(template.substring(last, match.index));
+    last = re.lastIndex;
+    if (match[1] == '#') {
+      var section = {name: match[2], parts: []};
+      current.push(section);
+      stack.push(section.parts);
+    } else if (match[1] == '/') {
+      stack.pop();
+    } else {
+      current.push({name: match[2]});
+    }
+  }
+  parts.push(template.substring(last));
+  return parts;
+}
+
+function Render(parts, data) {
+  var out = '';
+  for (var i = 0; i < parts.length; i++) {
+    var part = parts[i];
+    if (typeof part == 'string') {
+      out += part;
+    } else if (part.parts) {
+      var list = data[part.name];
+      for (var j = 0; j < list.length; j++) out += Render(part.parts, list[j]);
+    } else {
+      out += Escape(data[part.name]);
+    }
+  }
+  return out;
+}
+
+var compiled;
+var pageData;
+
+function TemplateSetup() {
+  compiled = Compile(kTemplate);
+  var items = [];
+  for (var i = 0; i < 100; i++) {
+    items.push({cls: i % 2 ? 'odd' : 'even', name: 'Item <' + i + '>',
+                price: (i * 1.25).toFixed(2)});
+  }
+  pageData = {items: items, footer: 'Tom & Jerry "Inc"'};
+}
+
+function RenderRequest() {
+  var html = `<!DOCTYPE html><html><body>${Render(compiled, pageData)}` +
+             `</body></html>`;
+  CheckEquals(true, html.indexOf('&amp;') > 0);
+}
@@ -0,0 +1,67 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Array.prototype.slice on fast arrays of all elements kinds.
+
+function check(array) {
+  var length = array.length;
+  var args = [[], [0], [1], [-1], [2, 4], [-3, -1], [4, 2], [0, 100],
+              [-100, 2], [1, undefined], [undefined, 2]];
+  for (var a of args) {
+    var result = array.slice.apply(array, a);
+    var start = a[0] === undefined ? 0 : a[0];
+    var end = a[1] === undefined ? length : a[1];
+    if (start < 0) start = Math.max(length + start, 0);
+    if (end < 0) end = Math.max(length + end, 0);
+    start = Math.min(start, length);
+    end = Math.min(end, length);
+    assertEquals(Math.max(end - start, 0), result.length);
+    for (var i = start; i < end; i++) {
+      assertEquals(i in array, (i - start) in result);
+      assertSame(array[i], result[i - start]);
+    }
+    assertTrue(%HaveSameMap(result, result.slice()));
+  }
+}
+
+check([1, 2, 3, 4, 5, 6]);
+check([1, , 3, , 5, 6]);
+check([1.5, 2.5, 3.5, 4.5, 5.5]);
+check([1.5, , 3.5, , 5.5]);
+check([{}, "a", 3, null, undefined, 6]);
+check([{}, , "a", , 5]);
+check([]);
+
+// Copy-on-write literals.
+function literal() { return [1, 2, 3, 4]; }
+var cow = literal();
+var copy = cow.slice(1);
+copy[0] = 42;
+assertEquals([42, 3, 4], copy);
+assertEquals([1, 2, 3, 4], literal());
+
+// Non-Smi arguments and elements on the prototype take the slow path.
+assertEquals([2, 3], [1, 2, 3, 4].slice(1.5, "3"));
+assertEquals([2], [1, 2, 3].slice({ valueOf() { return 1; } }, 2));
+var holey = [1, , 3];
+Array.prototype[1] = "proto";
+assertEquals([1, "proto", 3], holey.slice());
+delete Array.prototype[1];
+assertEquals([1, , 3], holey.slice());
+
+// Subclasses and @@species.
+class MyArray extends Array {}
+var my = MyArray.from([1, 2, 3]);
+assertInstanceof(my.slice(1), MyArray);
+var species = [1, 2, 3];
+species.constructor = { [Symbol.species]: function(n) { this.n = n; } };
+assertEquals(2, species.slice(1).n);
+
+// Join of strings with one-byte and two-byte separators.
+assertEquals("a-b-c", ["a", "b", "c"].join("-"));
+assertEquals("a\u1234b\u1234c", ["a", "b", "c"].join("\u1234"));
+assertEquals("\u1234-b-c", ["\u1234", "b", "c"].join("-"));
+assertEquals("1,2.5,x", [1, 2.5, "x"].join());
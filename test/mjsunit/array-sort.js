@@ -567,3 +567,59 @@ TestSortOnNonExtensible();
   })()
 
 })();
+
+// Sorting is stable, also for long arrays that are merged from many runs.
+function TestSortStability() {
+  function check(a) {
+    a.sort(function(x, y) { return x.key - y.key; });
+    for (var i = 1; i < a.length; i++) {
+      assertTrue(a[i - 1].key <= a[i].key);
+      if (a[i - 1].key == a[i].key) {
+        assertTrue(a[i - 1].index < a[i].index);
+      }
+    }
+  }
+  for (var length of [5, 64, 65, 1000, 3000]) {
+    var random = [];
+    var few_keys = [];
+    var runs = [];
+    for (var i = 0; i < length; i++) {
+      random.push({key: (Math.random() * length) | 0, index: i});
+      few_keys.push({key: i % 3, index: i});
+      runs.push({key: (i % 200 < 100) ? i % 200 : 300 - i % 200, index: i});
+    }
+    check(random);
+    check(few_keys);
+    check(runs);
+  }
+}
+TestSortStability();
+
+// Presorted and reversed input, and Smis in the default order.
+function TestSortRuns() {
+  var ascending = [];
+  var descending = [];
+  for (var i = 0; i < 2000; i++) {
+    ascending.push(i);
+    descending.push(2000 - i);
+  }
+  var calls = 0;
+  var compare = function(x, y) { calls++; return x - y; };
+  ascending.sort(compare);
+  assertTrue(calls < 2000);
+  calls = 0;
+  descending.sort(compare);
+  assertTrue(calls < 2000);
+  for (var i = 0; i < 2000; i++) {
+    assertEquals(i, ascending[i]);
+    assertEquals(i + 1, descending[i]);
+  }
+
+  var smis = [10, 9, 1, -1, 100, 2, 0, -10, 1e9, -1e9];
+  assertEquals([-1, -10, -1e9, 0, 1, 10, 100, 1e9, 2, 9], smis.sort());
+  var holey = [3, , 1, , 2];
+  assertEquals([1, 2, 3, , , ], holey.sort());
+  assertEquals(5, holey.length);
+  assertFalse(3 in holey);
+}
+TestSortRuns();
@@ -0,0 +1,44 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-always-opt --block-coverage --opt
+
+// Test that optimized code keeps incrementing block counters in the best
+// effort block coverage mode.
+
+function GetCoverage(source) {
+  for (var script of %DebugCollectCoverage()) {
+    if (script.script.source == source) return script;
+  }
+  return undefined;
+}
+
+function GetBlockCount(coverage, start) {
+  for (var range of coverage) {
+    if (range.start == start) return range.count;
+  }
+  return undefined;
+}
+
+%DebugToggleBestEffortBlockCoverage(true);
+
+var source = `
+function f(x) {
+  if (x) {
+    return 1;
+  }
+  return 2;
+}
+for (var i = 0; i < 5; i++) f(true);
+%OptimizeFunctionOnNextCall(f);
+for (var i = 0; i < 5; i++) f(true);
+assertOptimized(f);
+f(false);
+`.trim();
+
+eval(source);
+var coverage = GetCoverage(source);
+assertEquals(10, GetBlockCount(coverage, source.indexOf("{\n    return 1")));
+
+%DebugToggleBestEffortBlockCoverage(false);
@@ -0,0 +1,58 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Calls through a bound function that is only known from call feedback.
+
+(function() {
+  function target(a, b, c) { return [this, a, b, c]; }
+  var receiver = {};
+  var bound = target.bind(receiver, 1);
+
+  function foo(f, x) { return f(x, 3); }
+
+  assertEquals([receiver, 1, 2, 3], foo(bound, 2));
+  assertEquals([receiver, 1, 2, 3], foo(bound, 2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals([receiver, 1, 2, 3], foo(bound, 2));
+
+  // A different target fails the check on the feedback.
+  var other = target.bind(null, 4);
+  assertEquals([this, 4, 5, 3], foo(other, 5));
+  assertEquals([receiver, 1, 2, 3], foo(bound, 2));
+})();
+
+(function() {
+  // Bound functions in sloppy mode convert the receiver.
+  function sloppy() { return this; }
+  var bound = sloppy.bind(1);
+
+  function foo(f) { return f(); }
+
+  assertEquals(Object(1), foo(bound));
+  assertEquals(Object(1), foo(bound));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(Object(1), foo(bound));
+})();
+
+(function() {
+  // Nested bound functions and exceptions.
+  function thrower(a, b) { if (b) throw a; return a; }
+  var bound = thrower.bind(undefined).bind(undefined, "x");
+
+  function foo(b) {
+    try {
+      return bound(b);
+    } catch (e) {
+      return "caught " + e;
+    }
+  }
+
+  assertEquals("x", foo(false));
+  assertEquals("caught x", foo(true));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals("x", foo(false));
+  assertEquals("caught x", foo(true));
+})();
@@ -0,0 +1,39 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --deopt-site-generalization-threshold=1
+
+(function NamedLoad() {
+  function load(o) { return o.x; }
+  var a = {x: 1};
+  assertEquals(1, load(a));
+  assertEquals(1, load(a));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load(a));
+  assertOptimized(load);
+  // The wrong map deopt generalizes the load's feedback, so the reoptimized
+  // code handles receivers of any map.
+  assertEquals(2, load({y: 1, x: 2}));
+  assertUnoptimized(load);
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load(a));
+  assertEquals(3, load({z: 1, x: 3}));
+  assertOptimized(load);
+})();
+
+(function BinaryOperation() {
+  function add(a, b) { return a + b; }
+  assertEquals(3, add(1, 2));
+  assertEquals(3, add(1, 2));
+  %OptimizeFunctionOnNextCall(add);
+  assertEquals(3, add(1, 2));
+  assertOptimized(add);
+  assertEquals(1.5, add(1, 0.5));
+  assertUnoptimized(add);
+  %OptimizeFunctionOnNextCall(add);
+  assertEquals(3, add(1, 2));
+  assertEquals("1a", add(1, "a"));
+  assertOptimized(add);
+})();
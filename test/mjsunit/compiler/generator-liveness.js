@@ -0,0 +1,53 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Optimized generators only save and restore the registers that are live at
+// the resume point. Values that are live across a yield must survive it.
+
+function* gen(a) {
+  var dead = a * 2;
+  var live = a + 1;
+  yield dead;
+  var sum = live;
+  for (var i = 0; i < 3; i++) {
+    var temp = i * 10;
+    sum += yield temp;
+  }
+  return sum + live;
+}
+
+function run(a) {
+  var g = gen(a);
+  var values = [];
+  var result = g.next();
+  while (!result.done) {
+    values.push(result.value);
+    result = g.next(1);
+  }
+  values.push(result.value);
+  return values;
+}
+
+assertEquals([2, 0, 10, 20, 7], run(1));
+assertEquals([4, 0, 10, 20, 9], run(2));
+%OptimizeFunctionOnNextCall(gen);
+assertEquals([6, 0, 10, 20, 11], run(3));
+assertEquals([8, 0, 10, 20, 13], run(4));
+
+async function f(p) {
+  var before = p + 1;
+  var unused = p * 3;
+  var value = await p;
+  return before + value;
+}
+
+var results = [];
+f(1).then(v => results.push(v));
+f(2).then(v => results.push(v));
+%OptimizeFunctionOnNextCall(f);
+f(3).then(v => results.push(v));
+%RunMicrotasks();
+assertEquals([3, 5, 7], results);
@@ -0,0 +1,38 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-inlining-budget-by-frequency
+// Flags: --trace-turbo-inlining --max-inlined-nodes-cumulative=60
+
+// A cold call site only gets a share of the inlining budget. The hot and the
+// cold callee must behave the same whether or not they end up inlined.
+function hot(a, b) {
+  var x = a + b;
+  var y = a * b;
+  var z = x - y;
+  return x + y + z;
+}
+
+function cold(a, b) {
+  var s = 0;
+  for (var i = 0; i < b; i++) {
+    s += a * i + (a ^ i) - (a & i);
+  }
+  return s;
+}
+
+function caller(a, b, rare) {
+  var result = hot(a, b);
+  if (rare) result += cold(a, b);
+  return result;
+}
+
+for (var i = 0; i < 100; i++) {
+  assertEquals(2 * (1 + i), caller(1, i, false));
+}
+assertEquals(19, caller(2, 3, true));
+%OptimizeFunctionOnNextCall(caller);
+assertEquals(2 * (1 + 5), caller(1, 5, false));
+assertOptimized(caller);
+assertEquals(19, caller(2, 3, true));
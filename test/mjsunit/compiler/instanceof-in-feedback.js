@@ -0,0 +1,67 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// instanceof specializes to the constructor recorded by the interpreter, even
+// if the constructor is not a compile time constant.
+(function() {
+  function A() {}
+  function B() {}
+  function isInstance(o, C) { return o instanceof C; }
+
+  assertTrue(isInstance(new A, A));
+  assertFalse(isInstance({}, A));
+  %OptimizeFunctionOnNextCall(isInstance);
+  assertTrue(isInstance(new A, A));
+  assertFalse(isInstance({}, A));
+  assertFalse(isInstance(1, A));
+
+  // Changing the prototype chain is seen by the optimized code.
+  var a = new A;
+  Object.setPrototypeOf(a, B.prototype);
+  assertFalse(isInstance(a, A));
+
+  // A different constructor deoptimizes.
+  assertTrue(isInstance(new B, B));
+  assertFalse(isInstance(new A, B));
+  assertThrows(() => isInstance(new A, {}), TypeError);
+})();
+
+// in constant-folds for the receiver map recorded by the interpreter.
+(function() {
+  function has(o) { return "x" in o; }
+  function hasNot(o) { return "y" in o; }
+  function hasIndex(o) { return "0" in o; }
+
+  var proto = { x: 1 };
+  function make() { return Object.create(proto); }
+
+  assertTrue(has(make()));
+  assertFalse(hasNot(make()));
+  assertFalse(hasIndex(make()));
+  %OptimizeFunctionOnNextCall(has);
+  %OptimizeFunctionOnNextCall(hasNot);
+  %OptimizeFunctionOnNextCall(hasIndex);
+  assertTrue(has(make()));
+  assertFalse(hasNot(make()));
+  assertFalse(hasIndex(make()));
+
+  // Adding or removing properties on the prototype chain changes the result.
+  proto.y = 2;
+  assertTrue(hasNot(make()));
+  delete proto.x;
+  assertFalse(has(make()));
+  Object.prototype[0] = 0;
+  assertTrue(hasIndex(make()));
+  delete Object.prototype[0];
+  assertFalse(hasIndex(make()));
+
+  // Other receivers.
+  assertTrue(has({ x: 1 }));
+  assertFalse(has([]));
+  assertThrows(() => has(1), TypeError);
+  assertThrows(() => has(undefined), TypeError);
+  assertTrue(has(new Proxy({ x: 1 }, {})));
+})();
@@ -0,0 +1,54 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-variable
+// Flags: --turbo-loop-stack-check-max-iterations=100
+
+// Loops with a small trip count run without a stack check in their body.
+
+(function ShortCountedLoop() {
+  function f(x) {
+    var s = 0;
+    for (var i = 0; i < 16; i++) s += x;
+    for (var j = 20; j > 0; j -= 2) s -= 1;
+    return s;
+  }
+  assertEquals(6, f(1));
+  assertEquals(6, f(1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(6, f(1));
+  assertEquals(22, f(2));
+})();
+
+(function LongLoopsAreStillChecked() {
+  function f(n) {
+    var s = 0;
+    for (var i = 0; i < n; i++) s += i;
+    for (var j = 0; j < 1000000; j++) s -= 1;
+    return s;
+  }
+  assertEquals(-999994, f(4));
+  assertEquals(-999994, f(4));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(-999994, f(4));
+})();
+
+(function StackOverflowInShortLoop() {
+  function recurse(n) {
+    var s = 0;
+    for (var i = 0; i < 4; i++) s += recurse(n + 1);
+    return s;
+  }
+  function g() {
+    try {
+      recurse(0);
+    } catch (e) {
+      return e instanceof RangeError;
+    }
+    return false;
+  }
+  assertTrue(g());
+  %OptimizeFunctionOnNextCall(recurse);
+  assertTrue(g());
+})();
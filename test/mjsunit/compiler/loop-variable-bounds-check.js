@@ -0,0 +1,60 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-variable
+// Flags: --turbo-loop-bounds-check-elimination
+
+(function TypedArraySum() {
+  function sum(a) {
+    var s = 0;
+    for (var i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  var a = new Int32Array([1, 2, 3, 4]);
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(3, sum(new Int32Array([1, 2])));
+})();
+
+(function NonStrictCondition() {
+  function f(a) {
+    var r = [];
+    for (var i = 0; i <= a.length; i++) r.push(a[i]);
+    return r;
+  }
+  var a = new Int32Array([1, 2]);
+  assertEquals([1, 2, undefined], f(a));
+  assertEquals([1, 2, undefined], f(a));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([1, 2, undefined], f(a));
+})();
+
+(function DifferentLength() {
+  function f(a, b) {
+    var r = [];
+    for (var i = 0; i < a.length; i++) r.push(b[i]);
+    return r;
+  }
+  var a = new Int32Array([1, 2, 3]);
+  var b = new Int32Array([4, 5]);
+  assertEquals([4, 5, undefined], f(a, b));
+  assertEquals([4, 5, undefined], f(a, b));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([4, 5, undefined], f(a, b));
+})();
+
+(function NegativeStart() {
+  function f(a, start) {
+    var r = [];
+    for (var i = start; i < a.length; i++) r.push(a[i]);
+    return r;
+  }
+  var a = new Int32Array([1, 2]);
+  assertEquals([1, 2], f(a, 0));
+  assertEquals([1, 2], f(a, 0));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([undefined, 1, 2], f(a, -1));
+})();
@@ -0,0 +1,54 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-native-context-independent --opt
+
+// The same script evaluated in several realms shares its functions, and the
+// optimized code of a function is reused by the closures of the other realms.
+// The code must use the globals, prototypes and literals of the realm of the
+// closure it runs in.
+
+var source = `
+  var counter = 0;
+  function f(o) {
+    counter++;
+    return [o.x + counter, {}, String(o.x)];
+  }
+  f;`;
+
+function run(realm, f, x) {
+  var result = f({ x: x });
+  assertEquals(x + Realm.eval(realm, "counter"), result[0]);
+  assertEquals(String(x), result[2]);
+  assertSame(Realm.eval(realm, "Array.prototype"),
+             Object.getPrototypeOf(result));
+  assertSame(Realm.eval(realm, "Object.prototype"),
+             Object.getPrototypeOf(result[1]));
+}
+
+var r1 = Realm.create();
+var r2 = Realm.create();
+var f1 = Realm.eval(r1, source);
+var f2 = Realm.eval(r2, source);
+Realm.eval(r2, "counter = 100");
+
+run(r1, f1, 1);
+run(r1, f1, 2);
+%OptimizeFunctionOnNextCall(f1);
+run(r1, f1, 3);
+assertOptimized(f1);
+
+run(r2, f2, 1);
+run(r2, f2, 2);
+%OptimizeFunctionOnNextCall(f2);
+run(r2, f2, 3);
+assertOptimized(f2);
+run(r1, f1, 4);
+run(r2, f2, 4);
+
+// Deoptimizing the shared code doesn't break either realm.
+run(r1, f1, 1.5);
+run(r2, f2, 2.5);
+run(r1, f1, "a");
+run(r2, f2, "b");
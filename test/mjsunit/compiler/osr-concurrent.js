@@ -0,0 +1,40 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+// The loop keeps running in the interpreter while the OSR compilation is
+// blocked, and enters the optimized code once it has been installed.
+function sum(n) {
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    if (i == 100) %OptimizeOsr();
+    if (i == 1000) %UnblockConcurrentRecompilation();
+    result += i;
+  }
+  return result;
+}
+
+assertEquals(4999950000, sum(100000));
+
+// Nested loops request OSR for the inner loop.
+function nested(n) {
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    for (var j = 0; j < n; j++) {
+      if (i == 1 && j == 10) %OptimizeOsr();
+      if (i == 2 && j == 0) %UnblockConcurrentRecompilation();
+      result += j;
+    }
+  }
+  return result;
+}
+
+assertEquals(100 * 4950, nested(100));
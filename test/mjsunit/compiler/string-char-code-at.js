@@ -0,0 +1,83 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-externalize-string
+
+// Optimized charCodeAt and string iteration load characters directly from
+// all string shapes.
+
+function sum(s) {
+  var result = 0;
+  for (var i = 0; i < s.length; i++) result += s.charCodeAt(i);
+  return result;
+}
+
+function iterate(s) {
+  var result = [];
+  for (var ch of s) result.push(ch.codePointAt(0));
+  return result;
+}
+
+function expectedSum(s) {
+  var result = 0;
+  for (var i = 0; i < s.length; i++) result += s[i].charCodeAt(0);
+  return result;
+}
+%NeverOptimizeFunction(expectedSum);
+
+var one_byte = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+var two_byte = "☃☄★☆ snow ";
+var surrogates = "a😀b\uD83D";
+
+function externalized(s, two_byte) {
+  var copy = s.split("").join("");
+  try {
+    externalizeString(copy, two_byte);
+  } catch (e) { }
+  return copy;
+}
+
+var strings = [
+  one_byte,
+  two_byte,
+  surrogates,
+  one_byte + one_byte,  // cons
+  (one_byte + two_byte).substring(3),  // sliced
+  externalized(one_byte + one_byte, false),
+  externalized(two_byte + two_byte, true),
+  externalized(one_byte + one_byte, false).substring(2),  // sliced external
+  "",
+];
+
+// Internalizing a cons turns it into a thin string.
+var thin = one_byte + "abcdefghijklmnopqrstuvwxyz";
+var obj = {};
+obj[thin] = 1;
+strings.push(thin);
+
+var expected = strings.map(expectedSum);
+for (var i = 0; i < strings.length; i++) {
+  assertEquals(expected[i], sum(strings[i]));
+}
+%OptimizeFunctionOnNextCall(sum);
+for (var i = 0; i < strings.length; i++) {
+  assertEquals(expected[i], sum(strings[i]));
+}
+
+var expected_points = strings.map(s => Array.from(s, c => c.codePointAt(0)));
+for (var i = 0; i < strings.length; i++) {
+  assertEquals(expected_points[i], iterate(strings[i]));
+}
+%OptimizeFunctionOnNextCall(iterate);
+for (var i = 0; i < strings.length; i++) {
+  assertEquals(expected_points[i], iterate(strings[i]));
+}
+
+// Out of bounds positions still produce NaN.
+function at(s, i) { return s.charCodeAt(i); }
+at(one_byte + one_byte, 1);
+at(one_byte + one_byte, 1);
+%OptimizeFunctionOnNextCall(at);
+assertEquals(49, at(one_byte + one_byte, 1));
+assertEquals(NaN, at(one_byte + one_byte, 100));
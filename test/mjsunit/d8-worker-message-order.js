@@ -0,0 +1,19 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Messages queued in both directions are delivered in order.
+
+if (this.Worker) {
+  var w = new Worker(
+    `onmessage = function(msg) {
+       postMessage(msg);
+     };`);
+
+  var kMessages = 1000;
+  for (var i = 0; i < kMessages; i++) w.postMessage({index: i});
+  for (var i = 0; i < kMessages; i++) {
+    assertEquals({index: i}, w.getMessage());
+  }
+  w.terminate();
+}
@@ -103,3 +103,29 @@ var expected = ['23', '42',  // indexed from 'o'
 var actual = [];
 for (var p in o) actual.push(p);
 assertArrayEquals(expected, actual);
+
+// Large dictionary-mode objects keep insertion order, also after deletions
+// and for symbols.
+(function() {
+  var o = {};
+  var expected = [];
+  for (var i = 0; i < 2000; i++) {
+    var name = "p" + ((i * 7919) % 2000);
+    o[name] = i;
+    expected.push(name);
+  }
+  var symbol = Symbol("s");
+  o[symbol] = 0;
+  for (var i = 0; i < 2000; i += 3) delete o[expected[i]];
+  expected = expected.filter(function(name, i) { return i % 3 != 0; });
+  o.last = 1;
+  expected.push("last");
+  var actual = [];
+  for (var name in o) actual.push(name);
+  assertArrayEquals(expected, actual);
+  assertArrayEquals(expected, Object.keys(o));
+  var own = Object.getOwnPropertyNames(o);
+  assertArrayEquals(expected, own);
+  assertEquals([symbol], Object.getOwnPropertySymbols(o));
+  assertEquals(expected.concat([symbol]), Reflect.ownKeys(o));
+})();
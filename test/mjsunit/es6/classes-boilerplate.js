@@ -0,0 +1,158 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+'use strict';
+
+// Classes without computed property names are defined from a boilerplate.
+
+function descriptor(object, name) {
+  return Object.getOwnPropertyDescriptor(object, name);
+}
+
+(function TestMethodsAndAccessors() {
+  class C {
+    constructor(x) { this.x = x; }
+    get value() { return this.x; }
+    set value(x) { this.x = x; }
+    method() { return "method"; }
+    static staticMethod() { return "static"; }
+    static get staticValue() { return 42; }
+  }
+
+  assertTrue(%HasFastProperties(C.prototype));
+  assertEquals(["constructor", "value", "method"],
+               Object.getOwnPropertyNames(C.prototype));
+  assertEquals([], Object.keys(C.prototype));
+  assertEquals([], Object.keys(C));
+  assertSame(C, C.prototype.constructor);
+  assertFalse(descriptor(C.prototype, "constructor").enumerable);
+  assertTrue(descriptor(C.prototype, "constructor").writable);
+
+  var m = descriptor(C.prototype, "method");
+  assertFalse(m.enumerable);
+  assertTrue(m.writable);
+  assertTrue(m.configurable);
+  assertEquals("method", m.value.name);
+
+  var c = new C(1);
+  assertEquals(1, c.value);
+  c.value = 2;
+  assertEquals(2, c.x);
+  assertEquals("method", c.method());
+  assertEquals("static", C.staticMethod());
+  assertEquals(42, C.staticValue);
+  assertEquals("C", C.name);
+  assertEquals(1, C.length);
+  assertEquals(undefined, descriptor(C, "staticValue").set);
+})();
+
+(function TestDuplicates() {
+  class C {
+    m() { return 1; }
+    m() { return 2; }
+    get a() { return "get"; }
+    set a(v) {}
+    get b() { return "get"; }
+    b() { return "method"; }
+    c() { return "method"; }
+    set c(v) {}
+    static s() { return 1; }
+    static get s() { return 2; }
+  }
+
+  assertEquals(2, C.prototype.m());
+  var a = descriptor(C.prototype, "a");
+  assertEquals("function", typeof a.get);
+  assertEquals("function", typeof a.set);
+  assertEquals("method", C.prototype.b());
+  var c = descriptor(C.prototype, "c");
+  assertEquals(undefined, c.get);
+  assertEquals("function", typeof c.set);
+  assertEquals(undefined, c.value);
+  assertEquals(2, C.s);
+  assertEquals(["constructor", "m", "a", "b", "c"],
+               Object.getOwnPropertyNames(C.prototype));
+})();
+
+(function TestStaticNameAndLength() {
+  class C {
+    static name() { return "name"; }
+    static length() { return "length"; }
+  }
+  assertEquals("name", C.name());
+  assertEquals("length", C.length());
+  assertFalse(descriptor(C, "name").enumerable);
+  assertFalse(descriptor(C, "length").enumerable);
+
+  class D { static get length() { return 7; } }
+  assertEquals(7, D.length);
+})();
+
+(function TestSuper() {
+  class A {
+    m() { return "A"; }
+    static s() { return "static A"; }
+  }
+  class B extends A {
+    constructor() { super(); this.y = super.m(); }
+    m() { return "B" + super.m(); }
+    get g() { return super.m(); }
+    static s() { return "B" + super.s(); }
+  }
+
+  var b = new B();
+  assertEquals("A", b.y);
+  assertEquals("BA", b.m());
+  assertEquals("A", b.g);
+  assertEquals("Bstatic A", B.s());
+  assertSame(A.prototype, Object.getPrototypeOf(B.prototype));
+  assertSame(A, Object.getPrototypeOf(B));
+
+  class N extends null { m() { return 1; } }
+  assertSame(null, Object.getPrototypeOf(N.prototype));
+
+  assertThrows(() => { class X extends 1 { m() {} } }, TypeError);
+})();
+
+(function TestRepeatedDefinition() {
+  function factory(n) {
+    return class {
+      constructor() { this.n = n; }
+      get value() { return this.n; }
+      method() { return n; }
+    };
+  }
+
+  var C1 = factory(1);
+  var C2 = factory(2);
+  assertNotSame(C1, C2);
+  assertNotSame(C1.prototype.method, C2.prototype.method);
+  assertEquals(1, new C1().method());
+  assertEquals(2, new C2().method());
+  assertEquals(2, new C2().value);
+
+  // Changes to one prototype are not seen through the other.
+  C1.prototype.method = function() { return "changed"; };
+  C1.prototype.extra = 1;
+  assertEquals("changed", new C1().method());
+  assertEquals(2, new C2().method());
+  assertFalse("extra" in new C2());
+  assertTrue(%HasFastProperties(C2.prototype));
+})();
+
+(function TestIndexNames() {
+  // Array index names use the generic path.
+  class C {
+    0() { return 0; }
+    "1"() { return 1; }
+    a() { return "a"; }
+  }
+  assertEquals(0, C.prototype[0]());
+  assertEquals(1, C.prototype[1]());
+  assertEquals("a", C.prototype.a());
+  assertEquals(["0", "1", "constructor", "a"],
+               Object.getOwnPropertyNames(C.prototype));
+})();
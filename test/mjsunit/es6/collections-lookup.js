@@ -0,0 +1,86 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Smi keys, including ones stored as heap numbers.
+(function() {
+  var map = new Map();
+  var set = new Set();
+  for (var i = 0; i < 100; i++) {
+    map.set(i, i * 2);
+    set.add(i);
+  }
+  var boxed = 1000.5 - 0.5;
+  map.set(boxed, "boxed");
+  set.add(boxed);
+  for (var i = 0; i < 100; i++) {
+    assertEquals(i * 2, map.get(i));
+    assertTrue(map.has(i));
+    assertTrue(set.has(i));
+  }
+  assertEquals("boxed", map.get(1000));
+  assertTrue(map.has(1000));
+  assertTrue(set.has(1000));
+  assertEquals(0, map.get(-0));
+  assertTrue(set.has(-0));
+  assertEquals(undefined, map.get(100));
+  assertFalse(map.has(-1));
+  assertFalse(set.has(100));
+  map.delete(5);
+  set.delete(5);
+  assertEquals(undefined, map.get(5));
+  assertFalse(map.has(5));
+  assertFalse(set.has(5));
+})();
+
+// String keys, internalized or not.
+(function() {
+  var map = new Map();
+  var set = new Set();
+  for (var i = 0; i < 100; i++) {
+    map.set("key" + i, i);
+    set.add("key" + i);
+  }
+  for (var i = 0; i < 100; i++) {
+    var key = "key" + i;
+    assertEquals(i, map.get(key));
+    assertTrue(map.has(key));
+    assertTrue(set.has(key));
+    assertEquals(i, map.get("key" + i));
+    assertTrue(set.has("key" + i));
+  }
+  var prefix = "key";
+  assertEquals(42, map.get(prefix + "42"));
+  assertTrue(set.has(prefix + "42"));
+  assertEquals(undefined, map.get("key100"));
+  assertFalse(map.has(prefix + "100"));
+  assertFalse(set.has("key"));
+  assertFalse(map.has(42));
+  map.delete("key7");
+  set.delete(prefix + "7");
+  assertFalse(map.has("key7"));
+  assertFalse(set.has("key7"));
+})();
+
+// Other keys still work.
+(function() {
+  var object = {};
+  var symbol = Symbol();
+  var map = new Map([[object, 1], [symbol, 2], [NaN, 3], [1.5, 4], [null, 5],
+                     [undefined, 6], [true, 7]]);
+  assertEquals(1, map.get(object));
+  assertEquals(2, map.get(symbol));
+  assertEquals(3, map.get(NaN));
+  assertEquals(4, map.get(1.5));
+  assertEquals(5, map.get(null));
+  assertEquals(6, map.get(undefined));
+  assertEquals(7, map.get(true));
+  assertEquals(undefined, map.get({}));
+  assertEquals(undefined, map.get("1.5"));
+  var set = new Set([object, symbol, NaN, 1.5]);
+  assertTrue(set.has(object));
+  assertTrue(set.has(symbol));
+  assertTrue(set.has(NaN));
+  assertTrue(set.has(1.5));
+  assertFalse(set.has(Symbol()));
+})();
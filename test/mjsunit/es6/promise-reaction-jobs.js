@@ -0,0 +1,80 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Reaction jobs interleaved with other kinds of microtasks run in order.
+(function() {
+  var log = [];
+  var thenable = { then: function(resolve) { log.push("then"); resolve(); } };
+  Promise.resolve(1).then(function(v) { log.push("a" + v); });
+  Promise.resolve(2).then(function(v) { log.push("b" + v); });
+  Promise.resolve(thenable).then(function() { log.push("thenable"); });
+  Promise.resolve(3).then(function(v) { log.push("c" + v); });
+  %EnqueueMicrotask(function() { log.push("function"); });
+  Promise.resolve(4).then(function(v) { log.push("d" + v); });
+  %RunMicrotasks();
+  assertEquals(["a1", "b2", "then", "c3", "function", "d4", "thenable"], log);
+})();
+
+// A promise with several reactions runs them in registration order, between
+// the single reactions around it.
+(function() {
+  var log = [];
+  var p = Promise.resolve("p");
+  Promise.resolve(0).then(function() { log.push("before"); });
+  p.then(function(v) { log.push(v + 1); });
+  p.then(function(v) { log.push(v + 2); });
+  Promise.resolve(0).then(function() { log.push("after"); });
+  %RunMicrotasks();
+  assertEquals(["before", "p1", "p2", "after"], log);
+})();
+
+// Exceptions in reactions reject the derived promises without disturbing the
+// other jobs.
+(function() {
+  var log = [];
+  for (var i = 0; i < 100; i++) {
+    (function(i) {
+      Promise.resolve(i)
+          .then(function(v) {
+            if (v % 3 == 0) throw v;
+            return v;
+          })
+          .then(function(v) { log.push("fulfilled " + v); },
+                function(e) { log.push("rejected " + e); });
+    })(i);
+  }
+  %RunMicrotasks();
+  assertEquals(100, log.length);
+  for (var i = 0; i < 100; i++) {
+    assertEquals((i % 3 == 0 ? "rejected " : "fulfilled ") + i, log[i]);
+  }
+})();
+
+// Jobs enqueued while the queue is running run after the ones already queued.
+(function() {
+  var log = [];
+  Promise.resolve(1).then(function() {
+    log.push(1);
+    Promise.resolve(3).then(function() { log.push(3); });
+  });
+  Promise.resolve(2).then(function() { log.push(2); });
+  %RunMicrotasks();
+  assertEquals([1, 2, 3], log);
+})();
+
+// Reactions from another native context run in their own context.
+(function() {
+  var realm = Realm.create();
+  var log = [];
+  Realm.shared = log;
+  Promise.resolve(1).then(function(v) { log.push(v); });
+  Realm.eval(realm, "Promise.resolve(2).then(function(v) {" +
+                    "  Realm.shared.push(v, Realm.current());" +
+                    "});");
+  Promise.resolve(3).then(function(v) { log.push(v); });
+  %RunMicrotasks();
+  assertEquals([1, 2, realm, 3], log);
+})();
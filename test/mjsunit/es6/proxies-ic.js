@@ -0,0 +1,178 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Property accesses on proxies from ICs and optimized code call the traps
+// directly. Check that the traps see the right arguments and that the
+// invariants are still enforced.
+
+(function TestGet() {
+  var log = [];
+  var target = {a: 1};
+  var handler = {
+    get(t, name, receiver) {
+      log.push(name);
+      assertSame(target, t);
+      assertSame(proxy, receiver);
+      return name === "a" ? t.a + 1 : undefined;
+    }
+  };
+  var proxy = new Proxy(target, handler);
+
+  function load(o) { return o.a; }
+  assertEquals(2, load(proxy));
+  assertEquals(2, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load(proxy));
+  assertEquals(["a", "a", "a"], log);
+
+  // Other receivers still work.
+  assertEquals(1, load(target));
+
+  // Removing the trap forwards to the target.
+  delete handler.get;
+  assertEquals(1, load(proxy));
+})();
+
+(function TestGetInvariants() {
+  var target = {};
+  Object.defineProperty(target, "x", {value: 1, configurable: false});
+  Object.defineProperty(target, "y", {value: 2, configurable: true});
+  var proxy = new Proxy(target, { get() { return 42; } });
+
+  function loadX(o) { return o.x; }
+  function loadY(o) { return o.y; }
+  for (var i = 0; i < 3; i++) {
+    assertThrows(() => loadX(proxy), TypeError);
+    assertEquals(42, loadY(proxy));
+    if (i == 1) {
+      %OptimizeFunctionOnNextCall(loadX);
+      %OptimizeFunctionOnNextCall(loadY);
+    }
+  }
+})();
+
+(function TestSet() {
+  var log = [];
+  var target = {};
+  var proxy = new Proxy(target, {
+    set(t, name, value, receiver) {
+      log.push(name, value);
+      assertSame(proxy, receiver);
+      t[name] = value * 2;
+      return value !== 0;
+    }
+  });
+
+  function store(o, v) { o.a = v; }
+  function strictStore(o, v) { "use strict"; o.a = v; }
+  store(proxy, 1);
+  store(proxy, 2);
+  %OptimizeFunctionOnNextCall(store);
+  store(proxy, 3);
+  assertEquals(6, target.a);
+  assertEquals(["a", 1, "a", 2, "a", 3], log);
+
+  // A falsish result only throws in strict mode.
+  store(proxy, 0);
+  strictStore(proxy, 4);
+  strictStore(proxy, 5);
+  assertThrows(() => strictStore(proxy, 0), TypeError);
+  %OptimizeFunctionOnNextCall(strictStore);
+  assertThrows(() => strictStore(proxy, 0), TypeError);
+  strictStore(proxy, 5);
+  assertEquals(10, target.a);
+})();
+
+(function TestSetInvariants() {
+  var target = {};
+  Object.defineProperty(target, "x", {value: 1, writable: false});
+  var proxy = new Proxy(target, { set() { return true; } });
+
+  function store(o, v) { o.x = v; }
+  store(proxy, 1);
+  assertThrows(() => store(proxy, 2), TypeError);
+  %OptimizeFunctionOnNextCall(store);
+  store(proxy, 1);
+  assertThrows(() => store(proxy, 2), TypeError);
+})();
+
+(function TestSetWithoutTrap() {
+  var target = {
+    set a(v) { this.b = v; }
+  };
+  var proxy = new Proxy(target, {});
+
+  function store(o, v) { o.a = v; }
+  store(proxy, 1);
+  store(proxy, 2);
+  %OptimizeFunctionOnNextCall(store);
+  store(proxy, 3);
+  assertEquals(3, target.b);
+})();
+
+(function TestHas() {
+  var target = {a: 1};
+  Object.defineProperty(target, "frozen", {value: 1});
+  var proxy = new Proxy(target, {
+    has(t, name) { return name === "a" || name === "b"; }
+  });
+
+  function has(o, name) { return name in o; }
+  for (var i = 0; i < 3; i++) {
+    assertTrue(has(proxy, "a"));
+    assertTrue(has(proxy, "b"));
+    assertFalse(has(proxy, "c"));
+    assertFalse(has(proxy, 0));
+    assertThrows(() => has(proxy, "frozen"), TypeError);
+    if (i == 1) %OptimizeFunctionOnNextCall(has);
+  }
+
+  Object.preventExtensions(target);
+  assertThrows(() => has(new Proxy(target, { has() { return false; } }), "a"),
+               TypeError);
+})();
+
+(function TestDelete() {
+  var target = {a: 1, b: 2};
+  Object.defineProperty(target, "frozen", {value: 1});
+  var proxy = new Proxy(target, {
+    deleteProperty(t, name) { return delete t[name] && name !== "b"; }
+  });
+
+  function del(o, name) { return delete o[name]; }
+  function strictDel(o, name) { "use strict"; return delete o[name]; }
+  assertTrue(del(proxy, "a"));
+  assertFalse("a" in target);
+  assertFalse(del(proxy, "b"));
+  assertThrows(() => strictDel(proxy, "b"), TypeError);
+  assertFalse(del(proxy, "frozen"));
+  %OptimizeFunctionOnNextCall(del);
+  assertTrue(del(proxy, "c"));
+
+  var lying = new Proxy(target, { deleteProperty() { return true; } });
+  assertThrows(() => del(lying, "frozen"), TypeError);
+})();
+
+(function TestRevoked() {
+  var {proxy, revoke} = Proxy.revocable({a: 1}, {});
+  function load(o) { return o.a; }
+  function store(o) { o.a = 2; }
+  assertEquals(1, load(proxy));
+  store(proxy);
+  assertEquals(2, load(proxy));
+  revoke();
+  assertThrows(() => load(proxy), TypeError);
+  assertThrows(() => store(proxy), TypeError);
+  assertThrows(() => "a" in proxy, TypeError);
+  assertThrows(() => delete proxy.a, TypeError);
+})();
+
+(function TestTrapNotCallable() {
+  var proxy = new Proxy({}, { get: 1 });
+  function load(o) { return o.a; }
+  assertThrows(() => load(proxy), TypeError);
+  assertThrows(() => load(proxy), TypeError);
+})();
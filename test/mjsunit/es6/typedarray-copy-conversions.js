@@ -0,0 +1,73 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Bulk copies between typed arrays of all element types, with and without
+// sharing the underlying buffer.
+
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array,
+             Uint16Array, Int32Array, Uint32Array, Float32Array,
+             Float64Array];
+var values = [0, -0, 1, -1, 1.5, -2.5, 127, 128, 255, 256, 1e10, -1e10,
+              NaN, Infinity, -Infinity, 0x7fffffff, -0x80000000];
+
+function convert(type, value) {
+  var a = new type(1);
+  a[0] = value;
+  return a[0];
+}
+
+(function TestSetAndConstruct() {
+  for (var source_type of types) {
+    var source = new source_type(values);
+    for (var target_type of types) {
+      var target = new target_type(values.length + 3);
+      target.set(source, 2);
+      assertEquals(0, target[0]);
+      assertEquals(0, target[1]);
+      for (var i = 0; i < values.length; i++) {
+        assertEquals(convert(target_type, source[i]), target[i + 2]);
+      }
+      assertEquals(0, target[values.length + 2]);
+
+      var constructed = new target_type(source);
+      for (var i = 0; i < values.length; i++) {
+        assertEquals(convert(target_type, source[i]), constructed[i]);
+      }
+    }
+  }
+})();
+
+(function TestSetOverlapping() {
+  for (var source_type of types) {
+    for (var target_type of types) {
+      for (var shift = -16; shift <= 16; shift += 8) {
+        var buffer = new ArrayBuffer(128);
+        var bytes = new Uint8Array(buffer);
+        for (var i = 0; i < bytes.length; i++) bytes[i] = i * 7;
+        var source = new source_type(buffer, 32, 4);
+        var expected = Array.from(source, v => convert(target_type, v));
+        var target = new target_type(buffer, 32 + shift);
+        target.set(source, 1);
+        for (var i = 0; i < expected.length; i++) {
+          assertEquals(expected[i], target[i + 1]);
+        }
+      }
+    }
+  }
+})();
+
+(function TestSliceWithSpecies() {
+  for (var source_type of types) {
+    for (var target_type of types) {
+      var source = new source_type(values);
+      source.constructor = { [Symbol.species]: target_type };
+      var result = source.slice(3, 9);
+      assertInstanceof(result, target_type);
+      assertEquals(6, result.length);
+      for (var i = 0; i < 6; i++) {
+        assertEquals(convert(target_type, source[i + 3]), result[i]);
+      }
+    }
+  }
+})();
@@ -0,0 +1,79 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-sharedarraybuffer
+// Flags: --harmony-atomics-waitasync
+
+(function TestFailsWithNonSharedInt32Array() {
+  var ab = new ArrayBuffer(16);
+  assertThrows(() => Atomics.waitAsync(new Int32Array(ab), 0, 0), TypeError);
+  var sab = new SharedArrayBuffer(16);
+  assertThrows(() => Atomics.waitAsync(new Int16Array(sab), 0, 0), TypeError);
+  assertThrows(() => Atomics.waitAsync(new Int32Array(sab), 4, 0), RangeError);
+})();
+
+(function TestSynchronousResults() {
+  var i32a = new Int32Array(new SharedArrayBuffer(16));
+  var result = Atomics.waitAsync(i32a, 0, 42);
+  assertFalse(result.async);
+  assertEquals("not-equal", result.value);
+
+  result = Atomics.waitAsync(i32a, 0, 0, 0);
+  assertFalse(result.async);
+  assertEquals("timed-out", result.value);
+  assertEquals(0, %AtomicsNumWaitersForTesting(i32a, 0));
+})();
+
+(function TestWakeFromSameThread() {
+  var i32a = new Int32Array(new SharedArrayBuffer(16));
+  var first = Atomics.waitAsync(i32a, 1, 0);
+  var second = Atomics.waitAsync(i32a, 1, 0, Infinity);
+  var other = Atomics.waitAsync(i32a, 2, 0);
+  assertTrue(first.async);
+  assertInstanceof(first.value, Promise);
+  assertEquals(2, %AtomicsNumWaitersForTesting(i32a, 1));
+  assertEquals(1, %AtomicsNumWaitersForTesting(i32a, 2));
+
+  var log = [];
+  first.value.then(v => log.push("first " + v));
+  second.value.then(v => log.push("second " + v));
+  other.value.then(v => log.push("other " + v));
+
+  // Waking is synchronous, resolving the promises happens in a later task.
+  assertEquals(1, Atomics.wake(i32a, 1, 1));
+  assertEquals(1, %AtomicsNumWaitersForTesting(i32a, 1));
+  assertEquals(1, Atomics.wake(i32a, 1));
+  assertEquals(0, %AtomicsNumWaitersForTesting(i32a, 1));
+  assertEquals([], log);
+
+  assertPromiseResult(first.value, v => assertEquals("ok", v));
+  assertPromiseResult(second.value, v => {
+    assertEquals(["first ok", "second ok"], log);
+    // The waiter on the other address is still pending.
+    assertEquals(1, %AtomicsNumWaitersForTesting(i32a, 2));
+    Atomics.wake(i32a, 2);
+  });
+  assertPromiseResult(other.value, v => assertEquals("ok", v));
+})();
+
+if (this.Worker) {
+  (function TestWakeFromWorker() {
+    var sab = new SharedArrayBuffer(16);
+    var i32a = new Int32Array(sab);
+    var result = Atomics.waitAsync(i32a, 0, 0);
+    assertTrue(result.async);
+
+    var worker = new Worker(
+      `onmessage = function(msg) {
+         var i32a = new Int32Array(msg.sab);
+         postMessage(Atomics.wake(i32a, 0, 1));
+       };`);
+    worker.postMessage({sab: sab});
+    assertEquals(1, worker.getMessage());
+    assertEquals(0, %AtomicsNumWaitersForTesting(i32a, 0));
+    worker.terminate();
+
+    assertPromiseResult(result.value, v => assertEquals("ok", v));
+  })();
+}
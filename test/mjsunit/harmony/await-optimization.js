@@ -0,0 +1,78 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-await-optimization
+
+function ticks(log, count) {
+  var p = Promise.resolve();
+  for (var i = 1; i <= count; i++) {
+    p = p.then(function(i) { log.push("tick " + i); }.bind(null, i));
+  }
+}
+
+// Awaiting a native promise takes a single tick.
+(function() {
+  var log = [];
+  async function f(p) {
+    log.push("start");
+    log.push(await p);
+  }
+  f(Promise.resolve("resumed"));
+  ticks(log, 3);
+  %RunMicrotasks();
+  assertEquals(["start", "resumed", "tick 1", "tick 2", "tick 3"], log);
+})();
+
+// Rejections are thrown at the await.
+(function() {
+  var log = [];
+  async function f(p) {
+    try {
+      await p;
+    } catch (e) {
+      log.push("caught " + e);
+    }
+  }
+  f(Promise.reject("error"));
+  ticks(log, 1);
+  %RunMicrotasks();
+  assertEquals(["caught error", "tick 1"], log);
+})();
+
+// Promises with a custom then, subclasses and non-promise thenables are still
+// wrapped in a new promise, which calls their then.
+(function() {
+  var log = [];
+  async function f(p) {
+    log.push(await p);
+  }
+  var custom = Promise.resolve("custom");
+  custom.then = function(resolve, reject) {
+    log.push("custom then");
+    return Promise.prototype.then.call(this, resolve, reject);
+  };
+  class MyPromise extends Promise {}
+  f(custom);
+  f(MyPromise.resolve("subclass"));
+  f({ then: function(resolve) { resolve("thenable"); } });
+  f("value");
+  ticks(log, 3);
+  %RunMicrotasks();
+  assertEquals(["custom then", "value", "tick 1", "thenable", "tick 2",
+                "custom", "subclass", "tick 3"], log);
+})();
+
+// Promises from another native context are wrapped as well.
+(function() {
+  var realm = Realm.create();
+  var foreign = Realm.eval(realm, "Promise.resolve('foreign')");
+  var log = [];
+  async function f(p) {
+    log.push(await p);
+  }
+  f(foreign);
+  ticks(log, 3);
+  %RunMicrotasks();
+  assertEquals(["tick 1", "tick 2", "foreign", "tick 3"], log);
+})();
@@ -0,0 +1,68 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-object-rest-spread --allow-natives-syntax
+
+// Object.assign and spread into an empty object copy the map of a source
+// that shares the transition tree of the target.
+
+function update(state, key, value) {
+  var result = Object.assign({}, state);
+  result[key] = value;
+  return result;
+}
+
+var state = update({}, "a", 1);
+state = update(state, "b", 1.5);
+state = update(state, "c", "x");
+var copy = Object.assign({}, state);
+assertTrue(%HaveSameMap(state, copy));
+assertEquals({a: 1, b: 1.5, c: "x"}, copy);
+assertEquals(["a", "b", "c"], Object.keys(copy));
+
+// Double fields are not shared between the copies.
+copy.b = 2.5;
+assertEquals(1.5, state.b);
+assertEquals(2.5, copy.b);
+
+var spread = {...state};
+assertTrue(%HaveSameMap(state, spread));
+assertEquals({a: 1, b: 1.5, c: "x"}, spread);
+spread.b += 1;
+assertEquals(1.5, state.b);
+assertEquals(2.5, spread.b);
+
+// Properties after the spread are added to the copy.
+var extended = {...state, d: 4};
+assertEquals({a: 1, b: 1.5, c: "x", d: 4}, extended);
+
+// Non-enumerable, read-only and accessor properties are not copied as is.
+var special = update(update({}, "a", 1), "b", 2);
+Object.defineProperty(special, "b", {enumerable: false});
+assertEquals({a: 1}, Object.assign({}, special));
+assertEquals({a: 1}, {...special});
+var frozen = Object.freeze(update(update({}, "a", 1), "b", 2));
+var unfrozen = Object.assign({}, frozen);
+unfrozen.a = 3;
+assertEquals(3, unfrozen.a);
+assertFalse(Object.isFrozen({...frozen}));
+
+// Object.assign calls setters on the prototype chain, spread does not.
+var log = [];
+Object.defineProperty(Object.prototype, "c", {
+  set(v) { log.push(v); }, configurable: true
+});
+var assigned = Object.assign({}, state);
+assertEquals(["x"], log);
+assertFalse(assigned.hasOwnProperty("c"));
+assertEquals("x", {...state}.c);
+assertEquals(["x"], log);
+delete Object.prototype.c;
+
+Object.defineProperty(Object.prototype, "a", {
+  value: 0, writable: false, configurable: true
+});
+assertThrows(() => Object.assign({}, state), TypeError);
+assertEquals(1, {...state}.a);
+delete Object.prototype.a;
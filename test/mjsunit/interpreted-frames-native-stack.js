@@ -0,0 +1,42 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --interpreted-frames-native-stack --allow-natives-syntax
+
+// Interpreted functions run in their own copy of the interpreter entry
+// trampoline. Their frames still have to be recognized as interpreted
+// frames: stack traces, exceptions, optimization and deoptimization.
+
+function inner(x) {
+  if (x > 2) throw new Error("inner");
+  return new Error("stack").stack;
+}
+
+function outer(x) {
+  return inner(x);
+}
+
+var stack = outer(1);
+assertTrue(stack.indexOf("at inner") >= 0);
+assertTrue(stack.indexOf("at outer") >= 0);
+assertTrue(/interpreted-frames-native-stack.js:13:/.test(stack));
+
+assertThrows(function() { outer(3); }, Error, "inner");
+
+function add(a, b) { return a + b; }
+assertEquals(3, add(1, 2));
+assertEquals(3, add(1, 2));
+%OptimizeFunctionOnNextCall(add);
+assertEquals(3, add(1, 2));
+assertEquals("ab", add("a", "b"));
+
+function loop(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    sum += i;
+    if (i == 5) %OptimizeOsr();
+  }
+  return sum;
+}
+assertEquals(45, loop(10));
@@ -0,0 +1,32 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Quotes, backslashes, control characters and runs of spaces are found at
+// every offset and alignment.
+(function() {
+  for (var prefix = 0; prefix < 20; prefix++) {
+    var text = "abcdefghijklmnopqrstuvwxyz".repeat(2).substring(0, prefix);
+    assertEquals(text, JSON.parse('"' + text + '"'));
+    assertEquals(text + '"x', JSON.parse('"' + text + '\\"x"'));
+    assertEquals(text + 'é', JSON.parse('"' + text + 'é"'));
+    assertThrows(() => JSON.parse('"' + text + '\n"'), SyntaxError);
+    assertThrows(() => JSON.parse('"' + text + '\u001f"'), SyntaxError);
+    assertThrows(() => JSON.parse('"' + text), SyntaxError);
+
+    var spaces = " ".repeat(prefix);
+    assertEquals([1, {a: 2}],
+                 JSON.parse(spaces + "[" + spaces + "1," + spaces + "\n" +
+                            spaces + '{"a"' + spaces + ":\t" + spaces + "2}" +
+                            spaces + "]" + spaces));
+    assertThrows(() => JSON.parse("[1," + spaces), SyntaxError);
+  }
+})();
+
+// Indented output round-trips.
+(function() {
+  var value = {a: [1, 2, {b: "c d  e"}], f: "   ", g: {}};
+  for (var indent = 0; indent <= 10; indent++) {
+    assertEquals(value, JSON.parse(JSON.stringify(value, null, indent)));
+  }
+})();
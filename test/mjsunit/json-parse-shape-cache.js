@@ -0,0 +1,67 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Records with the same keys get the same map.
+(function() {
+  var records = JSON.parse(
+      '[{"a": 1, "b": "x", "c": {"d": 1.5}},' +
+      ' {"a": 2, "b": "y", "c": {"d": 2.5}},' +
+      ' {"a": 3, "b": "z", "c": {"d": 3.5}}]');
+  assertEquals(3, records.length);
+  assertTrue(%HaveSameMap(records[0], records[1]));
+  assertTrue(%HaveSameMap(records[1], records[2]));
+  assertTrue(%HaveSameMap(records[0].c, records[2].c));
+  assertEquals(3, records[2].a);
+  assertEquals("z", records[2].b);
+  assertEquals(3.5, records[2].c.d);
+})();
+
+// Records that share a prefix of keys, or have fewer or more keys.
+(function() {
+  var records = JSON.parse(
+      '[{"a": 1, "b": 2, "c": 3}, {"a": 1, "b": 2}, {"a": 1, "b": 2, "c": 3},' +
+      ' {"a": 1, "x": 2}, {"a": 1, "b": 2, "c": 3, "d": 4}, {}, {"b": 1},' +
+      ' {"a": 1, "b": 2, "c": 3}]');
+  assertEquals({a: 1, b: 2, c: 3}, records[0]);
+  assertEquals({a: 1, b: 2}, records[1]);
+  assertEquals({a: 1, x: 2}, records[3]);
+  assertEquals({a: 1, b: 2, c: 3, d: 4}, records[4]);
+  assertEquals({}, records[5]);
+  assertEquals({b: 1}, records[6]);
+  assertTrue(%HaveSameMap(records[0], records[2]));
+  assertTrue(%HaveSameMap(records[0], records[7]));
+  assertFalse(%HaveSameMap(records[0], records[1]));
+  assertEquals(["a", "b", "c", "d"], Object.keys(records[4]));
+})();
+
+// Values that don't fit the representation of the previous record.
+(function() {
+  var records = JSON.parse(
+      '[{"a": 1, "b": 1}, {"a": 1.5, "b": 1}, {"a": "s", "b": [1]},' +
+      ' {"a": null, "b": {"c": 1}}, {"a": 1, "b": 1}]');
+  assertEquals({a: 1, b: 1}, records[0]);
+  assertEquals({a: 1.5, b: 1}, records[1]);
+  assertEquals({a: "s", b: [1]}, records[2]);
+  assertEquals({a: null, b: {c: 1}}, records[3]);
+  assertEquals({a: 1, b: 1}, records[4]);
+})();
+
+// Duplicate keys, element keys and deep nesting.
+(function() {
+  var records = JSON.parse(
+      '[{"a": 1, "0": 2, "b": 3}, {"a": 1, "a": 2, "b": 3},' +
+      ' {"a": 1, "0": 2, "b": 3}]');
+  assertEquals({a: 1, 0: 2, b: 3}, records[0]);
+  assertEquals({a: 2, b: 3}, records[1]);
+  assertEquals(["a", "b"], Object.keys(records[1]));
+  assertEquals({a: 1, 0: 2, b: 3}, records[2]);
+
+  var deep = {};
+  var inner = deep;
+  for (var i = 0; i < 20; i++) inner = inner.next = {value: i};
+  var text = JSON.stringify([deep, deep, deep]);
+  assertEquals([deep, deep, deep], JSON.parse(text));
+})();
@@ -0,0 +1,58 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Objects that share a map serialize their keys the same way, including
+// keys that need escaping and with a gap.
+(function() {
+  var records = [];
+  for (var i = 0; i < 5; i++) {
+    records.push({id: i, 'a"b': i, 'c\\d': true, '\n': null, 'é': "x",
+                  skipped: undefined, f: function() {}});
+  }
+  var expected = '{"id":0,"a\\"b":0,"c\\\\d":true,"\\n":null,"é":"x"}';
+  var result = JSON.parse(JSON.stringify(records));
+  assertEquals(expected, JSON.stringify(records[0]));
+  assertEquals(5, result.length);
+  for (var i = 0; i < 5; i++) {
+    assertEquals(expected.replace(/0/g, i), JSON.stringify(records[i]));
+    assertEquals(i, result[i]["a\"b"]);
+  }
+  var indented = '[\n  {\n    "id": 0,\n    "a\\"b": 0,\n    "c\\\\d": true,' +
+                 '\n    "\\n": null,\n    "é": "x"\n  },';
+  assertEquals(indented, JSON.stringify(records, null, 2)
+                             .substring(0, indented.length));
+})();
+
+// Keys still follow the output encoding once it changes to two-byte.
+(function() {
+  var records = [{k: 1, l: "ሴ"}, {k: 2, l: "ሴ"}, {k: 3, l: "a"}];
+  assertEquals('[{"k":1,"l":"ሴ"},{"k":2,"l":"ሴ"},{"k":3,"l":"a"}]',
+               JSON.stringify(records));
+})();
+
+// toJSON and getters that change the object while it is serialized.
+(function() {
+  function make(i) {
+    return {a: i, get b() { delete this.c; return i; }, c: i};
+  }
+  var records = [make(1), make(2), make(3)];
+  assertEquals('[{"a":1,"b":1},{"a":2,"b":2},{"a":3,"b":3}]',
+               JSON.stringify(records));
+  var o = {x: {toJSON() { return "y"; }}, z: 1};
+  assertEquals('[{"x":"y","z":1},{"x":"y","z":1}]', JSON.stringify([o, o]));
+})();
+
+// Long strings with characters that need escaping at every alignment.
+(function() {
+  var text = "abcdefghijklmnopqrstuvwxyz0123456789";
+  for (var i = 0; i < text.length; i++) {
+    for (var special of ['"', '\\', '\n', '\x7f', '\xe9', ' ', '!']) {
+      var s = text.substring(0, i) + special + text.substring(i);
+      assertEquals(s, JSON.parse(JSON.stringify(s)));
+    }
+  }
+  var long_string = "x".repeat(1000) + "\"" + "y".repeat(1000);
+  assertEquals('"' + "x".repeat(1000) + '\\"' + "y".repeat(1000) + '"',
+               JSON.stringify(long_string));
+})();
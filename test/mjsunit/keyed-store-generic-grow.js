@@ -0,0 +1,83 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Appending to arrays through a megamorphic keyed store grows their backing
+// store and transitions their elements kind as needed.
+
+function store(a, i, v) { a[i] = v; }
+
+// Make the store megamorphic.
+for (var i = 0; i < 10; i++) {
+  var o = {};
+  o["p" + i] = i;
+  store(o, "q", i);
+  store([], 0, i);
+  store([1.5], 0, i);
+  store(["x"], 0, i);
+}
+
+function build(values) {
+  var a = [];
+  for (var i = 0; i < values.length; i++) store(a, i, values[i]);
+  return a;
+}
+
+var smis = [];
+var doubles = [];
+var objects = [];
+for (var i = 0; i < 100; i++) {
+  smis.push(i);
+  doubles.push(i + 0.5);
+  objects.push({i: i});
+}
+assertEquals(smis, build(smis));
+assertEquals(doubles, build(doubles));
+assertEquals(objects, build(objects));
+
+// Elements kind transitions while growing.
+var mixed = build([1, 2, 3, 4.5, 5, "six", 7, {}, 9.5]);
+assertEquals([1, 2, 3, 4.5, 5, "six", 7, {}, 9.5], mixed);
+var grow_to_double = [1, 2, 3, 4];
+store(grow_to_double, 4, 0.5);
+assertEquals([1, 2, 3, 4, 0.5], grow_to_double);
+var grow_to_object = [1.5, 2.5, 3.5, 4.5];
+store(grow_to_object, 4, "x");
+assertEquals([1.5, 2.5, 3.5, 4.5, "x"], grow_to_object);
+
+// Small gaps make the array holey.
+var gap = [1, 2, 3];
+store(gap, 10, 11);
+assertEquals(11, gap.length);
+assertFalse(5 in gap);
+assertEquals(11, gap[10]);
+var double_gap = [1.5];
+store(double_gap, 20, 2.5);
+assertEquals(21, double_gap.length);
+assertEquals(undefined, double_gap[10]);
+assertEquals(2.5, double_gap[20]);
+
+// Copy-on-write literals are copied first.
+function literal() { return [1, 2, 3]; }
+var cow = literal();
+store(cow, 3, 4);
+assertEquals([1, 2, 3, 4], cow);
+assertEquals([1, 2, 3], literal());
+
+// Non-writable length.
+var fixed = [1, 2, 3];
+Object.defineProperty(fixed, "length", {writable: false});
+store(fixed, 3, 4);
+assertEquals(3, fixed.length);
+assertEquals(undefined, fixed[3]);
+
+// Setters on the prototype chain are called.
+var log = [];
+Object.defineProperty(Array.prototype, 4, {
+  set(v) { log.push(v); }, configurable: true
+});
+var with_setter = [1, 2, 3, 4];
+store(with_setter, 4, 5);
+assertEquals([5], log);
+assertEquals(4, with_setter.length);
+delete Array.prototype[4];
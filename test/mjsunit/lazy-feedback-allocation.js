@@ -0,0 +1,74 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --lazy-feedback-allocation
+
+var global_var = 1;
+let script_let = 2;
+
+// Global loads and stores.
+(function() {
+  function f() {
+    global_var = global_var + 1;
+    script_let = script_let + global_var;
+    return typeof not_defined_anywhere;
+  }
+  assertEquals("undefined", f());
+  assertEquals(2, global_var);
+  assertEquals(4, script_let);
+  assertThrows(function() { "use strict"; undeclared_global = 1; },
+               ReferenceError);
+  assertThrows(function() { return undeclared_global; }, ReferenceError);
+})();
+
+// Property loads and stores, calls and construct.
+(function() {
+  function Point(x, y) { this.x = x; this.y = y; }
+  Point.prototype.sum = function() { return this.x + this.y; };
+  function f(a, i) {
+    var p = new Point(a[i], 2);
+    p.x += 1;
+    a[i] = p.sum();
+    return a[i];
+  }
+  var a = [1, 2, 3];
+  assertEquals(4, f(a, 0));
+  assertEquals(5, f(a, 1));
+  assertThrows(function() { "use strict"; Object.freeze(a)[0] = 1; },
+               TypeError);
+  assertEquals(4, a[0]);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(6, f(a, 2));
+})();
+
+// Literals, closures and for-in.
+(function() {
+  function f() {
+    var o = {a: 1, b: [1, 2], c: {d: 3}, get e() { return 4; }};
+    var r = /ab+c/g;
+    var keys = [];
+    for (var k in o) keys.push(k);
+    var add = function(x) { return x + o.c.d; };
+    return [keys.join(), o.b.length, r.test("abbc"), add(o.e)];
+  }
+  var expected = ["a,b,c,e", 2, true, 7];
+  assertEquals(expected, f());
+  assertEquals(expected, f());
+  function g() { return {x: [1]}; }
+  var o = g();
+  o.x[0] = 2;
+  assertEquals(1, g().x[0]);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f());
+})();
+
+// Functions get their feedback vector once they ran for a while.
+(function() {
+  function add(a, b) { return a + b; }
+  var sum = 0;
+  for (var i = 0; i < 10000; i++) sum = add(sum, i);
+  assertEquals(49995000, sum);
+  %OptimizeFunctionOnNextCall(add);
+  assertEquals(3, add(1, 2));
+})();
@@ -0,0 +1,42 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-lazy-source-positions
+
+function thrower() {
+  throw new Error("boom");
+}
+
+function caller() {
+  return thrower();
+}
+
+function lineOf(frame) {
+  return parseInt(frame.match(/:(\d+):\d+\)?$/)[1]);
+}
+
+function check() {
+  try {
+    caller();
+  } catch (e) {
+    var frames = e.stack.split("\n");
+    assertTrue(frames[1].includes("thrower"));
+    assertEquals(8, lineOf(frames[1]));
+    assertTrue(frames[2].includes("caller"));
+    assertEquals(12, lineOf(frames[2]));
+    return;
+  }
+  assertUnreachable();
+}
+
+// The first stack trace collects the positions, later ones reuse them.
+check();
+check();
+
+// Call sites collect positions for error messages.
+function callUndefined(o) {
+  return o.missing();
+}
+assertThrows(function() { callUndefined({}); }, TypeError,
+             "o.missing is not a function");
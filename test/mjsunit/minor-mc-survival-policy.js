@@ -0,0 +1,40 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --minor-mc --minor-mc-survival-rate-threshold=50 --expose-gc
+
+// Young generation GCs switch between the scavenger and the minor mark
+// compactor depending on the survival rate. Objects must survive both.
+
+var retained = [];
+
+function allocate(count, keep) {
+  for (var i = 0; i < count; i++) {
+    var o = {index: i, payload: [i, i + 1, i + 2]};
+    if (keep) retained.push(o);
+  }
+}
+
+// Low survival rate: mostly scavenges.
+for (var round = 0; round < 5; round++) {
+  allocate(10000, false);
+  gc(true);
+}
+
+// High survival rate: mostly minor mark compacts.
+for (var round = 0; round < 5; round++) {
+  allocate(10000, true);
+  gc(true);
+}
+
+allocate(10000, false);
+gc(true);
+gc();
+
+assertEquals(50000, retained.length);
+for (var i = 0; i < retained.length; i++) {
+  var o = retained[i];
+  assertEquals(i % 10000, o.index);
+  assertEquals([o.index, o.index + 1, o.index + 2], o.payload);
+}
@@ -0,0 +1,7 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+export * from "modules-skip-star-diamond2.js";
+export * from "modules-skip-star-diamond3.js";
+export {renamed} from "modules-skip-star-diamond2.js";
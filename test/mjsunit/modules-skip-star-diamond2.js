@@ -0,0 +1,7 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+export * from "modules-skip-star-diamond4.js";
+export {shared as renamed} from "modules-skip-star-diamond4.js";
+export let left = "left";
@@ -0,0 +1,26 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MODULE
+
+// The same binding is reachable through several star exports and indirect
+// exports; it resolves to a single cell no matter which import gets there
+// first.
+
+import {shared, left, right, renamed} from "modules-skip-star-diamond1.js";
+import * as ns from "modules-skip-star-diamond1.js";
+import {shared as direct, bump} from "modules-skip-star-diamond4.js";
+
+assertEquals(1, shared);
+assertEquals(1, direct);
+assertEquals(1, renamed);
+assertEquals("left", left);
+assertEquals("right", right);
+assertEquals(["bump", "left", "renamed", "right", "shared"], Object.keys(ns));
+
+bump();
+assertEquals(2, shared);
+assertEquals(2, direct);
+assertEquals(2, renamed);
+assertEquals(2, ns.shared);
@@ -0,0 +1,75 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Nested object and array literals are deep-copied from their boilerplate.
+
+function config() {
+  return {a: {b: [1, 2], c: 1.5}, d: [[3], {e: "x"}], 0: {f: null}};
+}
+
+function check(c) {
+  assertEquals({a: {b: [1, 2], c: 1.5}, d: [[3], {e: "x"}], 0: {f: null}}, c);
+}
+
+for (var i = 0; i < 5; i++) {
+  var c1 = config();
+  var c2 = config();
+  check(c1);
+  check(c2);
+  assertNotSame(c1.a, c2.a);
+  assertNotSame(c1.a.b, c2.a.b);
+  assertNotSame(c1.d[0], c2.d[0]);
+  assertNotSame(c1.d[1], c2.d[1]);
+  assertNotSame(c1[0], c2[0]);
+  assertTrue(%HaveSameMap(c1, c2));
+  assertTrue(%HaveSameMap(c1.a, c2.a));
+
+  // Changes to a copy don't affect the boilerplate.
+  c1.a.b.push(3);
+  c1.a.c = 2.5;
+  c1.d[1].e = "y";
+  c1[0].f = 1;
+  check(config());
+}
+
+// Literals nested deeper than the builtin supports.
+function deep() {
+  return {a: {b: {c: {d: {e: [1]}}}}};
+}
+for (var i = 0; i < 5; i++) {
+  var d1 = deep();
+  var d2 = deep();
+  assertEquals({a: {b: {c: {d: {e: [1]}}}}}, d1);
+  assertNotSame(d1.a.b.c.d.e, d2.a.b.c.d.e);
+  d1.a.b.c.d.e[0] = 2;
+  assertEquals(1, deep().a.b.c.d.e[0]);
+}
+
+function arrays() {
+  return [[1, 2], [3.5], [{x: 1}], []];
+}
+for (var i = 0; i < 5; i++) {
+  var a1 = arrays();
+  var a2 = arrays();
+  assertEquals([[1, 2], [3.5], [{x: 1}], []], a1);
+  assertNotSame(a1[0], a2[0]);
+  assertNotSame(a1[2][0], a2[2][0]);
+  a1[1][0] = 4.5;
+  a1[2][0].x = 2;
+  a1[3].push(1);
+  assertEquals([[1, 2], [3.5], [{x: 1}], []], arrays());
+}
+
+// The nested allocation sites receive elements kind feedback.
+function feedback() {
+  return {a: [1, 2]};
+}
+feedback();
+feedback();
+var f = feedback();
+assertTrue(%HasFastSmiElements(f.a));
+f.a[0] = 1.5;
+assertTrue(%HasFastDoubleElements(feedback().a));
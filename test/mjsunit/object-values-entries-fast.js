@@ -0,0 +1,56 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Object.values and Object.entries read data fields through the field indices
+// of the enum cache. Check the objects that cannot use that cache as well.
+
+function check(object, keys, values) {
+  // The first call fills the enum cache, the second one uses it.
+  for (var i = 0; i < 2; i++) {
+    assertEquals(keys, Object.keys(object));
+    assertEquals(values, Object.values(object));
+    assertEquals(keys.map((k, i) => [k, values[i]]), Object.entries(object));
+  }
+}
+
+check({}, [], []);
+check({a: 1, b: "x", c: null}, ["a", "b", "c"], [1, "x", null]);
+
+// Out-of-object properties.
+var o = {};
+for (var i = 0; i < 30; i++) o["p" + i] = i;
+var keys = [], values = [];
+for (var i = 0; i < 30; i++) {
+  keys.push("p" + i);
+  values.push(i);
+}
+check(o, keys, values);
+
+// Double fields.
+var d = {x: 1.5, y: 2};
+d.y = 3.5;
+check(d, ["x", "y"], [1.5, 3.5]);
+var v = Object.values(d);
+d.x = 7.5;
+assertEquals(1.5, v[0]);
+
+// Accessors, non-enumerable properties, symbols and elements.
+var a = {a: 1, get b() { return 2; }};
+check(a, ["a", "b"], [1, 2]);
+var n = {a: 1, b: 2};
+Object.defineProperty(n, "b", {enumerable: false});
+check(n, ["a"], [1]);
+var s = {a: 1, [Symbol("s")]: 2};
+check(s, ["a"], [1]);
+check({a: 1, 0: 2}, ["0", "a"], [2, 1]);
+
+// Maps sharing the descriptor array, and therefore the enum cache.
+var short = {m: 1, n: 2};
+var long = {m: 3, n: 4, o: 5};
+check(long, ["m", "n", "o"], [3, 4, 5]);
+check(short, ["m", "n"], [1, 2]);
+
+// Getters that change the object while entries are collected.
+var g = {get a() { delete this.b; return 1; }, b: 2, c: 3};
+assertEquals([1, 3], Object.values(g));
@@ -0,0 +1,128 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --turbo-inline-array-builtins
+
+// Simple map, filter, some and reduce.
+(function() {
+  var a = [1, 2, 3, 4, 5];
+  var f = function() {
+    return [a.map(function(v) { return v * 2; }),
+            a.filter(function(v) { return v & 1; }),
+            a.some(function(v) { return v == 3; }),
+            a.some(function(v) { return v == 6; }),
+            a.reduce(function(acc, v) { return acc + v; }, 10)];
+  }
+  var expected = [[2, 4, 6, 8, 10], [1, 3, 5], true, false, 25];
+  assertEquals(expected, f());
+  assertEquals(expected, f());
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f());
+})();
+
+// The callback results can be of any kind.
+(function() {
+  var a = [1, 2, 3];
+  var f = function() {
+    return a.map(function(v) { return v == 2 ? "two" : v + 0.5; });
+  }
+  assertEquals([1.5, "two", 3.5], f());
+  assertEquals([1.5, "two", 3.5], f());
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([1.5, "two", 3.5], f());
+})();
+
+// Length change detected during the loop must cause a proper eager deopt.
+(function() {
+  var f = function(deopt) {
+    var a = [1, 2, 3, 4, 5];
+    var mapped = a.map(function(v, i) {
+      if (i == 2 && deopt) a.length = 4;
+      return v + 1;
+    });
+    var filtered = [6, 7, 8, 9].filter(function(v, i, o) {
+      if (i == 1 && deopt) o.length = 3;
+      return v != 7;
+    });
+    var reduced = [1, 2, 3, 4].reduce(function(acc, v, i, o) {
+      if (i == 1 && deopt) o.length = 2;
+      return acc + v;
+    }, 0);
+    return [mapped, filtered, reduced];
+  }
+  assertEquals([[2, 3, 4, 5, 6], [6, 8, 9], 10], f());
+  assertEquals([[2, 3, 4, 5, 6], [6, 8, 9], 10], f());
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([[2, 3, 4, 5, 6], [6, 8, 9], 10], f());
+  var r = f(true);
+  assertEquals([2, 3, 4, 5, , ], r[0]);
+  assertEquals(5, r[0].length);
+  assertEquals([6, 8], r[1]);
+  assertEquals(3, r[2]);
+})();
+
+// Lazy deopt in a callback that isn't inlined must continue with the
+// callback's result.
+(function() {
+  var deopt = false;
+  var double = function(v) {
+    if (deopt) { %DeoptimizeNow(); gc(); }
+    return v * 2;
+  }
+  var odd = function(v) {
+    if (deopt) { %DeoptimizeNow(); gc(); }
+    return v & 1;
+  }
+  var isThree = function(v) {
+    if (deopt) { %DeoptimizeNow(); gc(); }
+    return v == 3;
+  }
+  var add = function(acc, v) {
+    if (deopt) { %DeoptimizeNow(); gc(); }
+    return acc + v;
+  }
+  %NeverOptimizeFunction(double);
+  %NeverOptimizeFunction(odd);
+  %NeverOptimizeFunction(isThree);
+  %NeverOptimizeFunction(add);
+  var f = function() {
+    var a = [1, 2, 3, 4, 5];
+    return [a.map(double), a.filter(odd), a.some(isThree),
+            a.reduce(add, 10)];
+  }
+  var expected = [[2, 4, 6, 8, 10], [1, 3, 5], true, 25];
+  assertEquals(expected, f());
+  assertEquals(expected, f());
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f());
+  deopt = true;
+  assertEquals(expected, f());
+})();
+
+// A non-callable callback throws even for empty arrays.
+(function() {
+  var f = function(a, callback) {
+    return a.map(callback);
+  }
+  f([1], function(v) { return v; });
+  f([1], function(v) { return v; });
+  %OptimizeFunctionOnNextCall(f);
+  assertThrows(function() { f([], 0); }, TypeError);
+})();
+
+// Changing the species constructor is respected.
+(function() {
+  var a = [1, 2, 3];
+  var f = function() {
+    return a.map(function(v) { return v; });
+  }
+  f();
+  f();
+  %OptimizeFunctionOnNextCall(f);
+  f();
+  class MyArray extends Array {}
+  Array.prototype.constructor = MyArray;
+  assertInstanceof(f(), MyArray);
+  Array.prototype.constructor = Array;
+})();
@@ -0,0 +1,38 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --compiler-dispatcher --use-parse-tasks --use-external-strings
+// Flags: --parse-task-min-function-size=200
+
+// Small eager functions are parsed on the main thread after having been
+// preparsed; large ones go to parse tasks.
+
+var small = (function(a) { return a + 1; })(1);
+assertEquals(2, small);
+
+var strict_small = (function() { "use strict"; return this; })();
+assertEquals(undefined, strict_small);
+
+var sloppy_after_strict = (function() { return this; })();
+assertEquals(this, sloppy_after_strict);
+
+var large = (function(a) {
+  // Inner functions are counted so that literal ids stay in sync with the
+  // functions parsed on the main thread.
+  function inner1() { return a; }
+  function inner2() { return inner1() + 1; }
+  var inner3 = (function() { return inner2() + 1; });
+  var padding = "................................................";
+  return inner3() + padding.length;
+})(1);
+assertEquals(51, large);
+
+var after_large = (function(a, b) {
+  function inner() { return a * b; }
+  return inner();
+})(6, 7);
+assertEquals(42, after_large);
+
+function lazy() { return small + after_large; }
+assertEquals(44, (function() { return lazy(); })());
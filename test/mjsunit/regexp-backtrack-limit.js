@@ -0,0 +1,56 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-backtrack-limit=2
+
+// With such a small limit, almost every match below ends up in the
+// linear-time matcher.
+
+// Patterns with exponential backtracking.
+var subject = "a".repeat(40) + "c";
+assertNull(/(a+)+b/.exec(subject));
+assertNull(/(a|aa)*b/.exec(subject));
+assertNull(/^(\w+\s?)*$/.exec("a".repeat(40) + "!"));
+assertEquals(["a".repeat(40) + "b", "a".repeat(40)],
+             /(a+)+b/.exec("a".repeat(40) + "b").slice());
+
+// The fallback finds the same match and captures as the backtracking matcher.
+function check(expected, re, input) {
+  assertEquals(expected, re.exec(input).slice());
+}
+check(["aaa", "aaa"], /(a+)+$/, "xxaaa");
+check(["xab", "b"], /(?:x|xx)*a(b|bc)/, "xabc");
+check(["xabc", "bc"], /(?:x|xx)*a(bc|b)/, "xabc");
+check(["xa", undefined], /(?:x|xx)*a(b)?/, "xac");
+check(["aba", "a"], /(?:(a)|b)*/, "aba");
+check(["abb", undefined], /(?:(a)|b)*/, "abb");
+check(["xxa", "xx"], /((?:x|xx)*?)a/, "xxa");
+check(["a", ""], /a(x*?)/, "xaxx");
+check(["AbC"], /abc/i, "xAbC");
+check(["K"], /k/i, "xK");
+check(["X"], /[^a\d]+/i, "aX");
+check(["aa", "a", "a"], /(a)(a){1,3}?/, "aaaa");
+check(["aaaa", "a", "a"], /(a)(a){1,3}/, "aaaa");
+
+// Anchors, word boundaries and flags.
+var text = "ooo\nfoo bar\nbaz";
+assertEquals(["bar"], /\bba\w\b/.exec(text).slice());
+assertEquals(["baz"], /^ba.$/m.exec(text).slice());
+assertNull(/^baz$/.exec(text));
+assertEquals(["ooo", "foo", "bar", "baz"], text.match(/\b[a-z]+\b/g));
+assertEquals(["o", "o"], "foo bar".match(/\Bo/g));
+var sticky = /o+\n/y;
+assertEquals(["ooo\n"], sticky.exec(text).slice());
+assertEquals(4, sticky.lastIndex);
+assertNull(sticky.exec(text));
+assertEquals("ooo\n-- bar\nbaz", text.replace(/\bf\w+/, "--"));
+
+// Two-byte subjects.
+var two_byte = "\u03b1".repeat(40) + "\u03b2";
+assertNull(/(\u03b1+)+\u03b3/.exec(two_byte));
+assertEquals([two_byte, "\u03b1"], /(\u03b1)+\u03b2/.exec(two_byte).slice());
+
+// Patterns outside of the regular subset still backtrack as before.
+assertEquals(["abab", "ab"], /(a(?=b)b)\1/.exec("xabab").slice());
+assertEquals([""], /(?:a|b?)*?(?!a)/.exec("aa").slice());
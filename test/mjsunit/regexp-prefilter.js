@@ -0,0 +1,64 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-prefilter --harmony-regexp-lookbehind
+
+// Subjects long enough for generated code to go through the prefilter.
+var padding = "x".repeat(2000);
+
+function test(subject) {
+  var length = subject.length;
+
+  // Literal prefixes.
+  var m = /foo.*bar(\d+)/.exec(subject + "foo-bar42");
+  assertEquals(["foo-bar42", "42"], m.slice());
+  assertEquals(length, m.index);
+  assertNull(/foo.*bar\d+/.exec(subject + "fo-bar42-"));
+  assertNull(/foo.*bar\d+/.exec(subject + "-foo-bar-"));
+  assertEquals(length + 1, (subject + "-(foo)bar").search(/\(foo\)/));
+  assertEquals(["ab", "b"], /(?:a)(b)/.exec(subject + "ab").slice());
+
+  // Anchors and lookarounds around the literal.
+  assertNull(/^foo/.exec(subject + "foo"));
+  assertEquals(["foo"], /^foo/m.exec(subject + "\nfoo").slice());
+  assertNull(/^foo/m.exec(subject + "-foo"));
+  assertEquals(["bar"], /\bbar\b/.exec(subject + " bar ").slice());
+  assertNull(/\bbar\b/.exec(subject + "bar"));
+  assertEquals(["bar"], /(?<=o)bar/.exec(subject + "fobar").slice());
+  assertNull(/(?<=o)bar/.exec(subject + "fabar"));
+  assertEquals(["bar"], /bar(?!x)/.exec(subject + "barxbar").slice());
+
+  // Required literals after the start of the match.
+  assertEquals(["1234abc"], /\d+abc/.exec(subject + "12abd1234abc").slice());
+  assertNull(/\d+abc/.exec(subject + "1234ab"));
+  assertEquals(["aaabbb"], /a+bbb/.exec(subject + "aaabbb").slice());
+
+  // Alternatives and classes disable the prefilter.
+  assertEquals(["bar"], /foo|bar/.exec(subject + "bar").slice());
+  assertEquals(["fob"], /fo[ob]/.exec(subject + "fob").slice());
+
+  // Global and sticky regexps.
+  assertEquals(["foo1", "foo2", "foo3"],
+               (subject + "foo1foo2-foo3").match(/foo\d/g));
+  assertEquals(subject + "[foo1][foo2]-[foo3]",
+               (subject + "foo1foo2-foo3").replace(/(foo\d)/g, "[$1]"));
+  assertEquals(["", "1", "2-", "3"],
+               ("foo1foo2-foo3").split(/fo{2}(?=\d)/));
+  var sticky = /foo\d/y;
+  sticky.lastIndex = length;
+  assertNull(sticky.exec(subject + "-foo1"));
+  sticky.lastIndex = length + 1;
+  assertEquals(["foo1"], sticky.exec(subject + "-foo1").slice());
+  var global = /(foo)\d/g;
+  global.lastIndex = length + 4;
+  assertNull(global.exec(subject + "foo1foo"));
+  assertEquals(0, global.lastIndex);
+
+  // Case independent regexps.
+  assertEquals(["FOO1"], /foo\d/i.exec(subject + "FOO1").slice());
+}
+
+test(padding);
+test(padding.substring(1900));
+test("\u1234" + padding);
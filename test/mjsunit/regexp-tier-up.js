@@ -0,0 +1,82 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=2 --allow-natives-syntax
+
+// Results stay the same when the regexp moves from the bytecode interpreter
+// to native code.
+(function() {
+  var re = /(a+)(b*)c/;
+  for (var i = 0; i < 5; i++) {
+    var m = re.exec("xxaabbbcyy");
+    assertEquals(["aabbbc", "aa", "bbb"], m);
+    assertEquals(2, m.index);
+    assertNull(re.exec("xxbbbyy"));
+  }
+})();
+
+// Global and sticky regexps keep their lastIndex semantics.
+(function() {
+  var re = /o(\w)/g;
+  for (var i = 0; i < 5; i++) {
+    assertEquals("f-or b-ar b-az", "for bar baz".replace(/(\w)(\w\w)/g,
+                                                         "$1-$2"));
+    assertEquals(["ob", "oc", "od"], "obocod".match(re));
+    re.lastIndex = 0;
+    assertEquals(["ob", "b"], re.exec("xobxoc"));
+    assertEquals(3, re.lastIndex);
+    assertEquals(["oc", "c"], re.exec("xobxoc"));
+    assertEquals(6, re.lastIndex);
+    assertNull(re.exec("xobxoc"));
+    assertEquals(0, re.lastIndex);
+  }
+  var sticky = /a/y;
+  for (var i = 0; i < 5; i++) {
+    sticky.lastIndex = 0;
+    assertTrue(sticky.test("aab"));
+    assertTrue(sticky.test("aab"));
+    assertFalse(sticky.test("aab"));
+  }
+})();
+
+// One-byte and two-byte subjects share the tick count and tier up together.
+(function() {
+  var re = /\u00e9(.)/;
+  assertEquals(["\u00e9x", "x"], re.exec("caf\u00e9x"));
+  assertEquals(["\u00e9\u2603", "\u2603"], re.exec("caf\u00e9\u2603"));
+  assertTrue(%RegExpHasBytecode(re, true));
+  assertTrue(%RegExpHasBytecode(re, false));
+  // The second tick, here on the two-byte subject, drops the bytecode for
+  // both encodings.
+  assertEquals(["\u00e9x", "x"], re.exec("caf\u00e9x"));
+  assertEquals(["\u00e9\u2603", "\u2603"], re.exec("caf\u00e9\u2603"));
+  assertTrue(%RegExpHasNativeCode(re, false));
+  assertFalse(%RegExpHasBytecode(re, true));
+  assertEquals(["\u00e9x", "x"], re.exec("caf\u00e9x"));
+  assertTrue(%RegExpHasNativeCode(re, true));
+  for (var i = 0; i < 5; i++) {
+    assertEquals(["\u00e9x", "x"], re.exec("caf\u00e9x"));
+    assertEquals(["\u00e9\u2603", "\u2603"], re.exec("caf\u00e9\u2603"));
+  }
+  assertTrue(%RegExpHasNativeCode(re, true));
+  assertTrue(%RegExpHasNativeCode(re, false));
+})();
+
+// Large subjects are matched with native code right away.
+(function() {
+  var subject = "a".repeat(5000) + "b";
+  var re = /a*b/;
+  assertEquals(5001, re.exec(subject)[0].length);
+  assertEquals(["ab"], re.exec("ab"));
+  assertEquals(["b"], "xb".match(/a*b/));
+})();
+
+// Patterns that backtrack a lot work in both tiers.
+(function() {
+  var re = new RegExp("(?:a+)+b");
+  for (var i = 0; i < 5; i++) {
+    assertEquals(["aab"], re.exec("aab"));
+    assertNull(re.exec("aa"));
+  }
+})();
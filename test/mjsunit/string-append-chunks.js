@@ -0,0 +1,53 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Repeated appends merge short right hand sides into flat chunks. Check that
+// the contents are preserved for all combinations of encodings and for cons
+// strings that have already been flattened.
+
+function build(parts, count) {
+  var s = "";
+  var expected = [];
+  for (var i = 0; i < count; i++) {
+    var part = parts[i % parts.length] + i;
+    s += part;
+    expected.push(part);
+  }
+  return [s, expected.join("")];
+}
+
+function check(parts, count) {
+  var result = build(parts, count);
+  assertEquals(result[1].length, result[0].length);
+  assertEquals(result[1], result[0]);
+  // Indexing into the unflattened rope.
+  for (var i = 0; i < result[1].length; i += 97) {
+    assertEquals(result[1].charCodeAt(i), result[0].charCodeAt(i));
+  }
+}
+
+check(["a", "bc", "def"], 10000);
+check(["\u1234", "x\u4321"], 10000);
+check(["ab", "\u1234"], 10000);
+check(["a".repeat(200), "b"], 1000);
+check(["a".repeat(300), "\u1234".repeat(20)], 200);
+
+// Optimized code goes through the StringAdd stub for short constants.
+function appendConstant(s) {
+  return s + "<li>some item</li>";
+}
+var s = "start-of-the-list:";
+for (var i = 0; i < 100; i++) s = appendConstant(s);
+%OptimizeFunctionOnNextCall(appendConstant);
+for (var i = 0; i < 100; i++) s = appendConstant(s);
+assertEquals("start-of-the-list:".length + 200 * 18, s.length);
+assertEquals("start-of-the-list:" + "<li>some item</li>".repeat(200), s);
+
+// Appending to a flattened cons string.
+var cons = %ConstructConsString("0123456789abc", "defghijklmnop");
+%FlattenString(cons);
+assertEquals("0123456789abcdefghijklmnopq", cons + "q");
+assertEquals("0123456789abcdefghijklmnop\u1234", cons + "\u1234");
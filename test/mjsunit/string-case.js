@@ -84,3 +84,39 @@ for (var i = 1; i <= 128; i <<= 1); {
     }
   }
 }
+
+// Sliced strings at every alignment, with non-ASCII characters at every
+// position of a word.
+(function() {
+  var base = "The Quick Brown Fox Jumps Over The Lazy Dog 0123456789";
+  for (var start = 0; start < 16; start++) {
+    for (var special of ["", "\xe9", "\xdf", "\u0130"]) {
+      for (var position = 0; position < 16; position++) {
+        var text = base.substring(0, position) + special +
+                   base.substring(position);
+        var slice = text.substring(start);
+        var expected_lower = "";
+        var expected_upper = "";
+        for (var i = 0; i < slice.length; i++) {
+          expected_lower += slice[i].toLowerCase();
+          expected_upper += slice[i].toUpperCase();
+        }
+        assertEquals(expected_lower, slice.toLowerCase());
+        assertEquals(expected_upper, slice.toUpperCase());
+      }
+    }
+  }
+})();
+
+// Equality and ordering of two-byte strings that differ at every position.
+(function() {
+  var base = "\u1234abcdefghijklmnopqrstuvwxyz\u4321";
+  for (var i = 0; i < base.length; i++) {
+    var changed = base.substring(0, i) + "\u2000" + base.substring(i + 1);
+    var copy = (base + "!").substring(0, base.length);
+    assertTrue(base == copy);
+    assertFalse(base == changed);
+    assertEquals(base.charCodeAt(i) < 0x2000, base < changed);
+    assertEquals(base.charCodeAt(i) > 0x2000, changed < base);
+  }
+})();
@@ -301,3 +301,29 @@ for (var lengthIndex = 0; lengthIndex < lengths.length; lengthIndex++) {
   }
   assertEquals(3, f4());
 })();
+
+// Short and medium patterns at every offset, in one-byte and two-byte
+// subjects.
+(function() {
+  var subjects = ["abcabdabeabfabgabhabiabjabkablabmabnabo",
+                  "ሴbcሴbdሴbeሴbfሴbgሴbhሴbi"];
+  for (var subject of subjects) {
+    for (var length = 2; length < 12; length++) {
+      for (var start = 0; start + length <= subject.length; start++) {
+        var pattern = subject.substring(start, start + length);
+        var expected = 0;
+        while (subject.substring(expected, expected + length) != pattern) {
+          expected++;
+        }
+        assertEquals(expected, subject.indexOf(pattern));
+        assertEquals(start, subject.indexOf(pattern, start));
+        assertTrue(subject.includes(pattern));
+        assertEquals(-1, subject.indexOf(pattern + "#"));
+        assertEquals(subject.split(pattern).join(pattern), subject);
+      }
+    }
+  }
+  assertEquals(-1, "aaaaaaaaaaaaaaaaaaaaaaaaaaab".indexOf("aac"));
+  assertEquals(25, "aaaaaaaaaaaaaaaaaaaaaaaaaaab".indexOf("aab"));
+  assertEquals(25, "aaaaaaaaaaaaaaaaaaaaaaaaaaab".search(/aab/));
+})();
@@ -0,0 +1,75 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-regexp-named-captures
+
+// Global replace with a function and explicit captures.
+var calls = [];
+var result = "a1b22c333".replace(/([a-z])(\d+)?/g, function() {
+  calls.push(Array.prototype.slice.call(arguments));
+  return arguments[1].toUpperCase();
+});
+assertEquals("ABC", result);
+assertEquals([["a1", "a", "1", 0, "a1b22c333"],
+              ["b22", "b", "22", 2, "a1b22c333"],
+              ["c333", "c", "333", 5, "a1b22c333"]], calls);
+
+// Unmatched captures are passed as undefined, unmatched parts are kept.
+assertEquals("-x[undefined]-y[z]-",
+             "-x-yz-".replace(/(x|y)(z)?/g, function(m, a, b) {
+               return a + "[" + b + "]";
+             }));
+
+// No matches.
+assertEquals("abc", "abc".replace(/(\d)/g, function() { return "x"; }));
+
+// Empty matches.
+assertEquals("<>a<>b<>", "ab".replace(/()/g, function() { return "<>"; }));
+
+// Named captures are passed as the last argument.
+assertEquals("2017/10/31 2018/01/02",
+             "31.10.2017 02.01.2018".replace(
+                 /(?<day>\d+)\.(?<month>\d+)\.(?<year>\d+)/g,
+                 function(m, d, mo, y, index, subject, groups) {
+                   assertEquals(d, groups.day);
+                   return groups.year + "/" + groups.month + "/" +
+                          groups.day;
+                 }));
+
+// All matches are found before the function is called, and it observes the
+// last match.
+var re = /(\w)/g;
+var seen = [];
+assertEquals("xyz", "abc".replace(re, function(m, c) {
+  seen.push(RegExp.$1 + re.lastIndex);
+  re.lastIndex = 2;
+  "123".replace(/(\d)$/, "");
+  return String.fromCharCode(c.charCodeAt(0) + 23);
+}));
+assertEquals(["c0", "32", "32"], seen);
+assertEquals(2, re.lastIndex);
+
+// Results are converted to strings.
+assertEquals("1,2|null|undefined", "a|b|c".replace(/(\w)/g, function(m, c) {
+  return {a: [1, 2], b: null, c: undefined}[c];
+}));
+
+// Exceptions are propagated.
+assertThrows(function() {
+  "aaa".replace(/(a)/g, function() { throw new Error("stop"); });
+}, Error, "stop");
+assertThrows(function() {
+  "aaa".replace(/(a)/g, function() {
+    return {toString: null, valueOf: null};
+  });
+}, TypeError);
+
+// Two-byte subjects and long inputs.
+var long = "\u1234ab".repeat(5000);
+var count = 0;
+assertEquals("\u1234".repeat(5000), long.replace(/(a)(b)/g, function() {
+  count++;
+  return "";
+}));
+assertEquals(5000, count);
@@ -0,0 +1,65 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short decimal strings are converted without calling into the runtime.
+// Make sure the inline path agrees with the full conversion.
+
+function check(expected, s) {
+  assertEquals(expected, Number(s), "Number(" + s + ")");
+  assertEquals(expected, +s, "+" + s);
+}
+
+check(123, "123");
+check(5, "+5");
+check(-5, "-5");
+check(-0, "-0");
+check(7, "007");
+check(0.5, ".5");
+check(1, "1.");
+check(0.1, "0.10");
+check(-12.25, "-12.25");
+check(123456789012345, "123456789012345");
+check(1234567890123456, "1234567890123456");
+check(0.123456789012345, "0.123456789012345");
+check(1.2345678901234567, "1.2345678901234567");
+check(12345678901234567890, "12345678901234567890");
+check(1e5, "1e5");
+check(16, "0x10");
+check(12, " 12 ");
+check(NaN, "");
+check(NaN, ".");
+check(NaN, "-");
+check(NaN, "+-1");
+check(NaN, "1.2.3");
+check(NaN, "12abc");
+check(42, "42");
+check(NaN, "4€");
+
+assertEquals(12.5, parseFloat("12.5"));
+assertEquals(-0, parseFloat("-0"));
+assertEquals(12, parseFloat("12abc"));
+assertEquals(1.5, parseFloat("1.5.3"));
+assertEquals(0.3, parseFloat("0.3"));
+assertEquals(12, parseFloat(" 12"));
+assertEquals(NaN, parseFloat("."));
+
+assertEquals(12, parseInt("12"));
+assertEquals(-12, parseInt("-12"));
+assertEquals(-0, parseInt("-0"));
+assertEquals(12, parseInt("12.5"));
+assertEquals(12, parseInt("12abc"));
+assertEquals(16, parseInt("0x10"));
+assertEquals(10, parseInt("010"));
+assertEquals(12, parseInt("12", 10));
+assertEquals(18, parseInt("12", 16));
+assertEquals(NaN, parseInt("-"));
+assertEquals(123456789012345, parseInt("123456789012345"));
+assertEquals(1234567890123456, parseInt("1234567890123456"));
+
+// Strings that are not flat or not one-byte.
+var cons = "1234567" + String(Math.random() >= 0 ? "89" : "");
+check(123456789, cons);
+assertEquals(123456789, parseInt(cons));
+assertEquals(123456789, parseFloat(cons));
+check(12, "12Ā".substring(0, 2));
@@ -0,0 +1,87 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+function dense(x) {
+  switch (x) {
+    case 0: return "zero";
+    case 1: return "one";
+    case 2: return "two";
+    case 3: return "three";
+    case 5: return "five";
+    case 6: return "six";
+    case 7:
+    case 8: return "seven or eight";
+    default: return "other";
+  }
+}
+
+function denseWithoutDefault(x) {
+  var result = "none";
+  switch (x) {
+    case -3: result = "minus three"; break;
+    case -2: result = "minus two"; break;
+    case -1: result = "minus one"; break;
+    case 0: result = "zero"; break;
+    case 2: result = "two"; break;
+    case 3: result = "three";  // fall-through
+    case 4: result += " four"; break;
+  }
+  return result;
+}
+
+function denseWithDefaultInTheMiddle(x) {
+  switch (x) {
+    case 10: return 10;
+    case 11: return 11;
+    default: return -1;
+    case 12: return 12;
+    case 13: return 13;
+    case 15: return 15;
+    case 16: return 16;
+  }
+}
+
+function test() {
+  assertEquals("zero", dense(0));
+  assertEquals("three", dense(3));
+  assertEquals("other", dense(4));
+  assertEquals("six", dense(6));
+  assertEquals("seven or eight", dense(7));
+  assertEquals("seven or eight", dense(8));
+  assertEquals("other", dense(9));
+  assertEquals("other", dense(-1));
+  assertEquals("one", dense(1.0));
+  assertEquals("zero", dense(-0));
+  assertEquals("two", dense(0.5 + 1.5));
+  assertEquals("other", dense(1.5));
+  assertEquals("other", dense("1"));
+  assertEquals("other", dense(undefined));
+  assertEquals("other", dense({valueOf() { return 1; }}));
+
+  assertEquals("minus three", denseWithoutDefault(-3));
+  assertEquals("minus one", denseWithoutDefault(-1));
+  assertEquals("none", denseWithoutDefault(1));
+  assertEquals("three four", denseWithoutDefault(3));
+  assertEquals("none four", denseWithoutDefault(4));
+  assertEquals("none", denseWithoutDefault(5));
+  assertEquals("none", denseWithoutDefault(-4));
+  assertEquals("minus two", denseWithoutDefault(-2.0));
+  assertEquals("none", denseWithoutDefault(null));
+
+  assertEquals(10, denseWithDefaultInTheMiddle(10));
+  assertEquals(12, denseWithDefaultInTheMiddle(12));
+  assertEquals(-1, denseWithDefaultInTheMiddle(14));
+  assertEquals(16, denseWithDefaultInTheMiddle(16));
+  assertEquals(-1, denseWithDefaultInTheMiddle(17));
+  assertEquals(-1, denseWithDefaultInTheMiddle("12"));
+}
+
+test();
+test();
+%OptimizeFunctionOnNextCall(dense);
+%OptimizeFunctionOnNextCall(denseWithoutDefault);
+%OptimizeFunctionOnNextCall(denseWithDefaultInTheMiddle);
+test();
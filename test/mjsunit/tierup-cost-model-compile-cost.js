@@ -0,0 +1,24 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --tierup-cost-model --no-concurrent-recompilation
+// Flags: --tierup-compile-cost-per-byte=1000000
+
+// With a high compile cost the cost model keeps even a small hot function in
+// the interpreter. Without the cost model it would be optimized early as a
+// small function.
+function cheap(a) {
+  return a + 1;
+}
+
+function drive(n) {
+  var s = 0;
+  for (var i = 0; i < n; i++) s = cheap(s);
+  return s;
+}
+%NeverOptimizeFunction(drive);
+
+assertEquals(100000, drive(100000));
+assertUnoptimized(cheap);
@@ -98,3 +98,49 @@ test("ab\u1234<\u0123");
   assertEquals('abc', encodeURI('abc'));
   assertEquals('abc', decodeURI('abc'));
 })();
+
+(function TestLongRuns() {
+  var plain = "abcdefghijklmnopqrstuvwxyz0123456789-_.!~*'()";
+  var query = "key=" + plain + "&value=" + plain + "#x";
+  assertEquals(query, encodeURI(query));
+  assertEquals(plain, encodeURIComponent(plain));
+  assertEquals(plain + "%3D%26%23", encodeURIComponent(plain + "=&#"));
+  assertEquals(plain + "%20" + plain,
+               encodeURIComponent(plain + " " + plain));
+  assertEquals(plain + " =%3D#%23", decodeURI(plain + "%20=%3D#%23"));
+  assertEquals(plain + " ==##", decodeURIComponent(plain + "%20=%3D#%23"));
+  // Two-byte strings that only contain ASCII characters.
+  var two_byte = ("\u1234" + plain + " " + plain).substring(1);
+  assertEquals(plain + "%20" + plain, encodeURIComponent(two_byte));
+  assertEquals(plain + " " + plain,
+               decodeURIComponent(encodeURIComponent(two_byte)));
+  // Sliced strings.
+  for (var i = 0; i < 16; i++) {
+    var sliced = (plain + "%C3%A9" + plain + " ").substring(i);
+    assertEquals(plain.substring(i) + "\xe9" + plain + " ",
+                 decodeURIComponent(sliced));
+    assertEquals(plain.substring(i) + "%25C3%25A9" + plain + "%20",
+                 encodeURIComponent(sliced));
+  }
+})();
+
+(function TestDecodedRepresentation() {
+  assertEquals("\xe9t\xe9", decodeURIComponent("%C3%A9t%C3%A9"));
+  assertEquals("\u1234\xe9", decodeURIComponent("%E1%88%B4%C3%A9"));
+  assertEquals("\u1234\xe9", decodeURIComponent("\u1234%C3%A9"));
+  assertEquals("\ud834\udd1e", decodeURIComponent("%F0%9D%84%9E"));
+  assertEquals("%F0%9D%84%9E", encodeURIComponent("\ud834\udd1e"));
+  assertEquals("%E1%88%B4%C3%A9", encodeURIComponent("\u1234\xe9"));
+})();
+
+(function TestErrors() {
+  assertThrows(function() { decodeURIComponent("abc%"); }, URIError);
+  assertThrows(function() { decodeURIComponent("abc%4"); }, URIError);
+  assertThrows(function() { decodeURIComponent("abc%4g"); }, URIError);
+  assertThrows(function() { decodeURIComponent("abc%C3"); }, URIError);
+  assertThrows(function() { decodeURIComponent("abc%C3%41"); }, URIError);
+  assertThrows(function() { decodeURIComponent("abc%80"); }, URIError);
+  assertThrows(function() { encodeURIComponent("abc\ud834"); }, URIError);
+  assertThrows(function() { encodeURIComponent("abc\udd1e"); }, URIError);
+  assertThrows(function() { encodeURI("abc\udd1e\ud834"); }, URIError);
+})();
@@ -0,0 +1,82 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --wasm-baseline
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+var builder = new WasmModuleBuilder();
+builder.addMemory(1, 1, false);
+
+var sig_i_ii = builder.addType(kSig_i_ii);
+var mul = builder.addImport("q", "mul", sig_i_ii);
+
+// Multiplies all numbers from 1 to the argument, calling out to JS.
+var factorial = builder.addFunction("factorial", kSig_i_i)
+  .addLocals({i32_count: 1})
+  .addBody([
+    kExprI32Const, 1, kExprSetLocal, 1,
+    kExprLoop, kWasmStmt,
+      kExprGetLocal, 1, kExprGetLocal, 0, kExprCallFunction, mul,
+      kExprSetLocal, 1,
+      kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub, kExprTeeLocal, 0,
+      kExprI32Const, 1, kExprI32GtS,
+      kExprBrIf, 0,
+    kExprEnd,
+    kExprGetLocal, 1
+  ])
+  .exportFunc();
+
+var add = builder.addFunction("add", sig_i_ii)
+  .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Add]);
+
+builder.addFunction("store", kSig_v_ii)
+  .addBody([
+    kExprGetLocal, 0, kExprGetLocal, 1, kExprI32StoreMem, 0, 0
+  ])
+  .exportFunc();
+
+builder.addFunction("load", kSig_i_i)
+  .addBody([kExprGetLocal, 0, kExprI32LoadMem, 0, 0])
+  .exportFunc();
+
+builder.addFunction("dispatch", kSig_i_iii)
+  .addBody([
+    kExprGetLocal, 1, kExprGetLocal, 2, kExprGetLocal, 0,
+    kExprCallIndirect, sig_i_ii, kTableZero
+  ])
+  .exportFunc();
+
+builder.addFunction("twice", kSig_i_ii)
+  .addBody([
+    kExprGetLocal, 0, kExprGetLocal, 1, kExprCallFunction, add.index,
+    kExprGetLocal, 1, kExprCallFunction, add.index
+  ])
+  .exportFunc();
+
+builder.appendToTable([mul, add.index, factorial.index]);
+
+var instance = builder.instantiate(
+    {q: {mul: function(a, b) { return a * b | 0; }}});
+var exports = instance.exports;
+
+assertEquals(1, exports.factorial(1));
+assertEquals(120, exports.factorial(5));
+assertEquals(3628800, exports.factorial(10));
+
+// Functions that were already called and functions that get compiled on
+// their first call through another function.
+assertEquals(7, exports.twice(1, 3));
+assertEquals(11, exports.twice(5, 3));
+
+exports.store(8, 1234);
+assertEquals(1234, exports.load(8));
+assertEquals(0, exports.load(12));
+assertTraps(kTrapMemOutOfBounds, "exports.load(65536)");
+
+assertEquals(36, exports.dispatch(0, 4, 9));
+assertEquals(13, exports.dispatch(1, 4, 9));
+assertTraps(kTrapFuncSigMismatch, "exports.dispatch(2, 4, 9)");
+assertTraps(kTrapFuncInvalid, "exports.dispatch(3, 4, 9)");
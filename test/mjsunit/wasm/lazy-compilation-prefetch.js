@@ -0,0 +1,72 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --wasm-lazy-prefetch-count=4
+
+load('test/mjsunit/wasm/wasm-constants.js');
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// The likely callees of a lazily compiled function are compiled along with it.
+// Every function must still behave the same, whether it was prefetched or
+// compiled on its own first call.
+(function testCallChain() {
+  let builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  builder.addGlobal(kWasmI32, true);
+  let leaf = builder.addFunction('leaf', kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI32Const, 1, kExprI32Add])
+      .exportFunc();
+  let store = builder.addFunction('store', kSig_v_i)
+      .addBody([
+        kExprI32Const, 0, kExprGetLocal, 0, kExprI32StoreMem, 0, 0,
+        kExprGetLocal, 0, kExprSetGlobal, 0
+      ])
+      .exportFunc();
+  let middle = builder.addFunction('middle', kSig_i_i)
+      .addBody([
+        kExprGetLocal, 0, kExprCallFunction, leaf.index,
+        kExprCallFunction, leaf.index
+      ])
+      .exportFunc();
+  builder.addFunction('load', kSig_i_v)
+      .addBody([kExprI32Const, 0, kExprI32LoadMem, 0, 0])
+      .exportFunc();
+  builder.addFunction('global', kSig_i_v)
+      .addBody([kExprGetGlobal, 0])
+      .exportFunc();
+  builder.addFunction('main', kSig_i_i)
+      .addBody([
+        kExprGetLocal, 0, kExprCallFunction, store.index,
+        kExprGetLocal, 0, kExprCallFunction, middle.index
+      ])
+      .exportFunc();
+
+  let exports = builder.instantiate().exports;
+  assertEquals(12, exports.main(10));
+  assertEquals(10, exports.load());
+  assertEquals(10, exports.global());
+  assertEquals(3, exports.middle(1));
+  assertEquals(8, exports.leaf(7));
+  assertEquals(22, exports.main(20));
+  assertEquals(20, exports.load());
+})();
+
+// Many callees, more than get prefetched.
+(function testManyCallees() {
+  let builder = new WasmModuleBuilder();
+  let body = [kExprI32Const, 0];
+  let callees = [];
+  for (let i = 0; i < 10; ++i) {
+    let callee = builder.addFunction('f' + i, kSig_i_i)
+        .addBody([kExprGetLocal, 0, kExprI32Const, i, kExprI32Add])
+        .exportFunc();
+    body.push(kExprCallFunction, callee.index);
+  }
+  builder.addFunction('main', kSig_i_v).addBody(body).exportFunc();
+
+  let exports = builder.instantiate().exports;
+  assertEquals(45, exports.main());
+  assertEquals(45, exports.main());
+  for (let i = 0; i < 10; ++i) assertEquals(i + 1, exports['f' + i](1));
+})();
@@ -0,0 +1,81 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --expose-gc
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Modules with the same signatures share their import and export wrappers.
+function buildModule(constant) {
+  var builder = new WasmModuleBuilder();
+  var sig_i_ii = builder.addType(kSig_i_ii);
+  builder.addImport("m", "f", sig_i_ii);
+  builder.addImport("m", "g", kSig_i_i);
+  builder.addFunction("call_f", kSig_i_ii)
+    .addBody([
+      kExprGetLocal, 0, kExprGetLocal, 1, kExprCallFunction, 0,
+      kExprI32Const, constant, kExprI32Add
+    ])
+    .exportFunc();
+  builder.addFunction("call_g", kSig_i_i)
+    .addBody([kExprGetLocal, 0, kExprCallFunction, 1])
+    .exportFunc();
+  builder.addFunction("id", kSig_i_i)
+    .addBody([kExprGetLocal, 0])
+    .exportFunc();
+  return builder.toModule();
+}
+
+function sub(a, b) { return a - b; }
+function twice(a) { return 2 * a; }
+function add(a, b) { return a + b; }
+
+var modules = [buildModule(1), buildModule(2), buildModule(3)];
+var instances = [];
+for (var i = 0; i < 10; i++) {
+  var module = modules[i % modules.length];
+  // Alternate between the same and different callables for one import.
+  var f = i % 2 ? sub : add;
+  instances.push(new WebAssembly.Instance(module, {m: {f: f, g: twice}}));
+}
+
+function check() {
+  for (var i = 0; i < instances.length; i++) {
+    var exports = instances[i].exports;
+    var expected = (i % 2 ? 7 - 3 : 7 + 3) + (i % modules.length) + 1;
+    assertEquals(expected, exports.call_f(7, 3));
+    assertEquals(10, exports.call_g(5));
+    assertEquals(i, exports.id(i));
+  }
+}
+
+check();
+// Drop some of the instances and use the survivors after a GC.
+instances.length = 4;
+gc();
+check();
+for (var i = 4; i < 10; i++) {
+  var module = modules[i % modules.length];
+  var f = i % 2 ? sub : add;
+  instances.push(new WebAssembly.Instance(module, {m: {f: f, g: twice}}));
+}
+gc();
+check();
+
+// The same callable imported with different signatures.
+(function() {
+  var builder = new WasmModuleBuilder();
+  builder.addImport("m", "f", kSig_i_i);
+  builder.addImport("m", "f2", kSig_d_dd);
+  builder.addFunction("a", kSig_i_i)
+    .addBody([kExprGetLocal, 0, kExprCallFunction, 0])
+    .exportFunc();
+  builder.addFunction("b", kSig_d_dd)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprCallFunction, 1])
+    .exportFunc();
+  var exports = builder.instantiate({m: {f: add, f2: add}}).exports;
+  assertEquals(NaN, exports.a(1));
+  assertEquals(1.75, exports.b(1.5, 0.25));
+})();
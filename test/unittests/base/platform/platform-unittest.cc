@@ -10,6 +10,11 @@
 #include <unistd.h>  // NOLINT
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#include <sys/resource.h>
+#endif
+
 #if V8_OS_WIN
 #include "src/base/win32-headers.h"
 #endif
@@ -199,5 +204,43 @@ TEST_F(MemoryAllocationPermissionsTest, DoTest) {
 }  // namespace
 #endif  // V8_OS_POSIX
 
+#if V8_OS_LINUX
+namespace {
+
+class SchedulingTestThread : public Thread {
+ public:
+  SchedulingTestThread() : Thread(Options("SchedulingTest")) {}
+
+  void Run() final {
+    // Lowering the priority never needs privileges.
+    int tid = OS::GetCurrentThreadId();
+    int nice_level = getpriority(PRIO_PROCESS, tid);
+    if (nice_level < 19) {
+      EXPECT_TRUE(Thread::SetCurrentThreadNiceLevel(nice_level + 1));
+      EXPECT_EQ(nice_level + 1, getpriority(PRIO_PROCESS, tid));
+    }
+
+    cpu_set_t set;
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(set), &set));
+    int cpu = 0;
+    while (cpu < 64 && !CPU_ISSET(cpu, &set)) cpu++;
+    if (cpu == 64) return;
+    EXPECT_TRUE(Thread::SetCurrentThreadAffinity(static_cast<uint64_t>(1)
+                                                 << cpu));
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(set), &set));
+    EXPECT_EQ(1, CPU_COUNT(&set));
+    EXPECT_TRUE(CPU_ISSET(cpu, &set));
+  }
+};
+
+}  // namespace
+
+TEST(Thread, SetCurrentThreadScheduling) {
+  SchedulingTestThread thread;
+  thread.Start();
+  thread.Join();
+}
+#endif  // V8_OS_LINUX
+
 }  // namespace base
 }  // namespace v8
@@ -1246,5 +1246,105 @@ TEST_F(CompilerDispatcherTest, CompileMultipleOnBackgroundThread) {
   ASSERT_FALSE(platform.IdleTaskPending());
 }
 
+TEST_F(CompilerDispatcherTest, PublishAfterBackgroundCompile) {
+  MockPlatform platform;
+  FLAG_compiler_dispatcher_batch_publish = true;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+  FLAG_compiler_dispatcher_batch_publish = false;
+
+  const char script[] = TEST_SCRIPT();
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  dispatcher.tracer_->RecordCompile(50000.0, 1);
+  platform.RunIdleTask(10.0, 0.0);
+  ASSERT_TRUE(dispatcher.jobs_.begin()->second->status() ==
+              CompileJobStatus::kReadyToCompile);
+  ASSERT_TRUE(platform.BackgroundTasksPending());
+
+  platform.RunBackgroundTasksAndBlock(V8::GetCurrentPlatform());
+
+  // The main thread step is done by a foreground task, not during idle time.
+  ASSERT_FALSE(platform.IdleTaskPending());
+  ASSERT_TRUE(platform.ForegroundTasksPending());
+  ASSERT_TRUE(dispatcher.jobs_.begin()->second->status() ==
+              CompileJobStatus::kCompiled);
+
+  platform.RunForegroundTasks();
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+  ASSERT_FALSE(platform.ForegroundTasksPending());
+  ASSERT_FALSE(platform.IdleTaskPending());
+}
+
+TEST_F(CompilerDispatcherTest, PublishMultipleJobsInOneBatch) {
+  MockPlatform platform;
+  FLAG_compiler_dispatcher_batch_publish = true;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+  FLAG_compiler_dispatcher_batch_publish = false;
+
+  const char script1[] = TEST_SCRIPT();
+  Handle<JSFunction> f1 =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script1));
+  Handle<SharedFunctionInfo> shared1(f1->shared(), i_isolate());
+  const char script2[] = TEST_SCRIPT();
+  Handle<JSFunction> f2 =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script2));
+  Handle<SharedFunctionInfo> shared2(f2->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(shared1));
+  ASSERT_TRUE(dispatcher.Enqueue(shared2));
+  dispatcher.tracer_->RecordCompile(50000.0, 1);
+  platform.RunIdleTask(10.0, 0.0);
+  ASSERT_TRUE(platform.BackgroundTasksPending());
+
+  platform.RunBackgroundTasksAndBlock(V8::GetCurrentPlatform());
+
+  ASSERT_EQ(dispatcher.jobs_.size(), 2u);
+  ASSERT_EQ(dispatcher.jobs_to_publish_.size(), 2u);
+  ASSERT_TRUE(platform.ForegroundTasksPending());
+
+  // A single publish task finishes both jobs.
+  platform.RunForegroundTasks();
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared1));
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared2));
+  ASSERT_TRUE(shared1->is_compiled());
+  ASSERT_TRUE(shared2->is_compiled());
+  ASSERT_FALSE(platform.ForegroundTasksPending());
+}
+
+TEST_F(CompilerDispatcherTest, PublishSkipsFinishedJobs) {
+  MockPlatform platform;
+  FLAG_compiler_dispatcher_batch_publish = true;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+  FLAG_compiler_dispatcher_batch_publish = false;
+
+  const char script[] = TEST_SCRIPT();
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  dispatcher.tracer_->RecordCompile(50000.0, 1);
+  platform.RunIdleTask(10.0, 0.0);
+  platform.RunBackgroundTasksAndBlock(V8::GetCurrentPlatform());
+  ASSERT_TRUE(platform.ForegroundTasksPending());
+
+  // Finishing the job on the main thread removes it from the publish set.
+  ASSERT_TRUE(dispatcher.FinishNow(shared));
+  ASSERT_TRUE(dispatcher.jobs_to_publish_.empty());
+
+  platform.RunForegroundTasks();
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+  ASSERT_FALSE(platform.ForegroundTasksPending());
+  ASSERT_FALSE(platform.IdleTaskPending());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -112,6 +112,30 @@ class EscapeAnalysisTest : public TypedGraphTest {
                             control);
   }
 
+  Node* LoadElement(const ElementAccess& access, Node* from, Node* index,
+                    Node* effect = nullptr, Node* control = nullptr) {
+    if (!effect) {
+      effect = effect_;
+    }
+    if (!control) {
+      control = control_;
+    }
+    return graph()->NewNode(simplified()->LoadElement(access), from, index,
+                            effect, control);
+  }
+
+  Node* CheckBounds(Node* index, Node* length, Node* effect = nullptr,
+                    Node* control = nullptr) {
+    if (!effect) {
+      effect = effect_;
+    }
+    if (!control) {
+      control = control_;
+    }
+    return effect_ = graph()->NewNode(simplified()->CheckBounds(), index,
+                                      length, effect, control);
+  }
+
   Node* Return(Node* value, Node* effect = nullptr, Node* control = nullptr) {
     if (!effect) {
       effect = effect_;
@@ -253,6 +277,29 @@ TEST_F(EscapeAnalysisTest, StraightNonEscapeNonConstStore) {
 }
 
 
+TEST_F(EscapeAnalysisTest, StraightNonEscapeCheckedConstIndex) {
+  Node* object1 = Constant(1);
+  Node* length = Constant(2);
+  BeginRegion();
+  Node* allocation = Allocate(Constant(kPointerSize * 2));
+  StoreElement(MakeElementAccess(0), allocation, Constant(1), object1);
+  Node* finish = FinishRegion(allocation);
+  Node* load_index = CheckBounds(Constant(1), length);
+  Node* load = LoadElement(MakeElementAccess(0), finish, load_index);
+  Node* result = Return(load);
+  EndGraph();
+
+  Analysis();
+
+  ExpectVirtual(allocation);
+  ExpectReplacement(load, object1);
+
+  Transformation();
+
+  ASSERT_EQ(object1, NodeProperties::GetValueInput(result, 1));
+}
+
+
 TEST_F(EscapeAnalysisTest, StraightEscape) {
   Node* object1 = Constant(1);
   BeginRegion();
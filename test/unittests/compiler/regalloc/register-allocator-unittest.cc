@@ -217,6 +217,90 @@ TEST_F(RegisterAllocatorTest, DiamondManyPhis) {
   Allocate();
 }
 
+class FastRegisterAllocatorTest : public RegisterAllocatorTest {
+ public:
+  FastRegisterAllocatorTest()
+      : saved_threshold_(FLAG_turbo_fast_regalloc_threshold) {
+    FLAG_turbo_fast_regalloc_threshold = 1;
+  }
+  ~FastRegisterAllocatorTest() override {
+    FLAG_turbo_fast_regalloc_threshold = saved_threshold_;
+  }
+
+ private:
+  int saved_threshold_;
+};
+
+TEST_F(FastRegisterAllocatorTest, LoopWithManyPhisAndCall) {
+  const int kPhis = kDefaultNRegs * 2;
+
+  StartBlock();
+  VReg vals[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    vals[i] = DefineConstant();
+  }
+  EndBlock();
+
+  StartLoop(2);
+
+  StartBlock();
+  PhiInstruction* phis[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    phis[i] = Phi(vals[i], 2);
+  }
+  EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+  StartBlock();
+  TestOperand uses[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    uses[i] = Use(phis[i]);
+  }
+  EmitCall(Slot(-1), kPhis, uses);
+  for (int i = 0; i < kPhis; ++i) {
+    SetInput(phis[i], 1, EmitOI(Same(), Reg(phis[i]), Use(DefineConstant())));
+  }
+  EndBlock(Jump(-1));
+
+  EndLoop();
+
+  StartBlock();
+  Return(Reg(phis[0]));
+  EndBlock();
+
+  Allocate();
+}
+
+TEST_F(FastRegisterAllocatorTest, DiamondManyPhis) {
+  const int kPhis = kDefaultNRegs * 2;
+
+  StartBlock();
+  EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+  StartBlock();
+  VReg t_vals[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    t_vals[i] = DefineConstant();
+  }
+  EndBlock(Jump(2));
+
+  StartBlock();
+  VReg f_vals[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    f_vals[i] = DefineConstant();
+  }
+  EndBlock(Jump(1));
+
+  StartBlock();
+  TestOperand merged[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    merged[i] = Use(Phi(t_vals[i], f_vals[i]));
+  }
+  Return(EmitCall(Slot(-1), kPhis, merged));
+  EndBlock();
+
+  Allocate();
+}
+
 TEST_F(RegisterAllocatorTest, DoubleDiamondManyRedundantPhis) {
   const int kPhis = kDefaultNRegs * 2;
 
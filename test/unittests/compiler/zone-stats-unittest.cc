@@ -155,6 +155,21 @@ TEST_F(ZoneStatsTest, SimpleAllocationLoop) {
   ExpectForPool(0, max_loop_allocation, total_allocated);
 }
 
+TEST_F(ZoneStatsTest, SegmentReuse) {
+  EXPECT_EQ(0u, zone_stats()->GetReusedSegmentCount());
+  {
+    ZoneStats::Scope scope(zone_stats(), ZONE_NAME);
+    Allocate(scope.zone());
+  }
+  EXPECT_EQ(0u, zone_stats()->GetReusedSegmentCount());
+  EXPECT_LT(0u, zone_stats()->GetSegmentPoolSize());
+  {
+    ZoneStats::Scope scope(zone_stats(), ZONE_NAME);
+    Allocate(scope.zone());
+  }
+  EXPECT_EQ(1u, zone_stats()->GetReusedSegmentCount());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -504,5 +504,41 @@ TEST_F(RuntimeCallStatsTest, NestedScopes) {
   EXPECT_IN_RANGE(100, counter3()->time().InMilliseconds(), 100 + kEpsilonMs);
 }
 
+TEST_F(RuntimeCallStatsTest, Sampling) {
+  FLAG_runtime_stats =
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING;
+  RuntimeCallStatsSampler sampler(stats());
+  sampler.Start();
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    EXPECT_FALSE(stats()->current_timer()->IsStarted());
+    EXPECT_EQ(counter(), stats()->current_counter());
+    {
+      RuntimeCallTimerScope scope(stats(), counter_id2());
+      EXPECT_EQ(counter2(), stats()->current_counter());
+      Sleep(100);
+    }
+    EXPECT_EQ(counter(), stats()->current_counter());
+    {
+      RuntimeCallTimerScope scope(stats(), counter_id2());
+    }
+  }
+  EXPECT_EQ(nullptr, stats()->current_counter());
+  sampler.Stop();
+
+  // Counts are exact, times are only estimated from the samples.
+  EXPECT_EQ(1, counter()->count());
+  EXPECT_EQ(2, counter2()->count());
+  EXPECT_EQ(0, counter3()->count());
+  EXPECT_LT(0, counter2()->samples());
+  EXPECT_EQ(0, counter3()->samples());
+  EXPECT_EQ(counter2()->samples() * FLAG_runtime_call_stats_sampling_interval,
+            counter2()->time().InMicroseconds());
+  EXPECT_GE(100 + kEpsilonMs, counter()->time().InMilliseconds() +
+                                  counter2()->time().InMilliseconds());
+  stats()->Reset();
+  EXPECT_EQ(0, counter2()->samples());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -16,6 +16,8 @@ namespace internal {
 
 class ConcurrentMarkingDequeTest : public TestWithIsolate {
  public:
+  static const int kTaskId = 1;
+
   ConcurrentMarkingDequeTest() {
     marking_deque_ = new ConcurrentMarkingDeque(i_isolate()->heap());
     object_ = i_isolate()->heap()->undefined_value();
@@ -42,15 +44,48 @@ TEST_F(ConcurrentMarkingDequeTest, SharedDeque) {
   marking_deque()->Push(object());
   EXPECT_FALSE(marking_deque()->IsEmpty());
   EXPECT_EQ(1, marking_deque()->Size());
-  EXPECT_EQ(object(), marking_deque()->Pop(MarkingThread::kConcurrent));
+  marking_deque()->FlushToGlobal(ConcurrentMarkingDeque::kMainThread);
+  EXPECT_FALSE(marking_deque()->IsEmpty());
+  EXPECT_TRUE(marking_deque()->HasWorkForConcurrentTasks());
+  EXPECT_EQ(object(), marking_deque()->Pop(kTaskId));
+  EXPECT_TRUE(marking_deque()->IsEmpty());
+}
+
+TEST_F(ConcurrentMarkingDequeTest, LocalWorkIsNotStolen) {
+  marking_deque()->Push(object());
+  EXPECT_FALSE(marking_deque()->HasWorkForConcurrentTasks());
+  EXPECT_EQ(nullptr, marking_deque()->Pop(kTaskId));
+  EXPECT_EQ(object(), marking_deque()->Pop());
+  EXPECT_TRUE(marking_deque()->IsEmpty());
+}
+
+TEST_F(ConcurrentMarkingDequeTest, StealBetweenTasks) {
+  const int kOtherTaskId = kTaskId + 1;
+  marking_deque()->Push(object(), kTaskId);
+  marking_deque()->FlushToGlobal(kTaskId);
+  EXPECT_EQ(object(), marking_deque()->Pop(kOtherTaskId));
+  EXPECT_EQ(nullptr, marking_deque()->Pop(kTaskId));
+  EXPECT_TRUE(marking_deque()->IsEmpty());
+}
+
+TEST_F(ConcurrentMarkingDequeTest, Update) {
+  marking_deque()->Push(object());
+  marking_deque()->Push(object(), kTaskId);
+  EXPECT_EQ(1, marking_deque()->Size());
+  marking_deque()->Update([](HeapObject* object) -> HeapObject* {
+    return nullptr;
+  });
+  EXPECT_EQ(nullptr, marking_deque()->Pop(kTaskId));
+  EXPECT_TRUE(marking_deque()->IsEmpty());
 }
 
 TEST_F(ConcurrentMarkingDequeTest, BailoutDeque) {
-  marking_deque()->Push(object(), MarkingThread::kConcurrent,
-                        TargetDeque::kBailout);
+  marking_deque()->Push(object(), kTaskId, TargetDeque::kBailout);
   EXPECT_FALSE(marking_deque()->IsEmpty());
   EXPECT_EQ(1, marking_deque()->Size());
-  EXPECT_EQ(nullptr, marking_deque()->Pop(MarkingThread::kConcurrent));
+  EXPECT_EQ(nullptr, marking_deque()->Pop(kTaskId));
+  EXPECT_EQ(object(), marking_deque()->Pop());
+  EXPECT_TRUE(marking_deque()->IsEmpty());
 }
 
 }  // namespace internal
@@ -158,6 +158,55 @@ TEST(LocalEmbedderHeapTracer, TraceDoesNotFinish) {
   EXPECT_EQ(0u, local_tracer.NumberOfCachedWrappersToTrace());
 }
 
+TEST(LocalEmbedderHeapTracer, RegisterConcurrentlyFoundWrappers) {
+  LocalEmbedderHeapTracer local_tracer;
+  StrictMock<MockEmbedderHeapTracer> remote_tracer;
+  local_tracer.SetRemoteTracer(&remote_tracer);
+  std::vector<LocalEmbedderHeapTracer::WrapperInfo> wrappers(
+      2, CreateWrapperInfo());
+  local_tracer.AddWrappersToTraceConcurrently(wrappers);
+  local_tracer.AddWrapperToTrace(CreateWrapperInfo());
+  EXPECT_EQ(1u, local_tracer.NumberOfCachedWrappersToTrace());
+  EXPECT_EQ(2u, local_tracer.NumberOfConcurrentlyFoundWrappersToTrace());
+  EXPECT_CALL(remote_tracer, RegisterV8References(testing::SizeIs(3)));
+  local_tracer.RegisterWrappersWithRemoteTracer();
+  EXPECT_EQ(0u, local_tracer.NumberOfCachedWrappersToTrace());
+  EXPECT_EQ(0u, local_tracer.NumberOfConcurrentlyFoundWrappersToTrace());
+}
+
+TEST(LocalEmbedderHeapTracer, FlushExternalReferences) {
+  LocalEmbedderHeapTracer local_tracer;
+  StrictMock<MockEmbedderHeapTracer> remote_tracer;
+  local_tracer.SetRemoteTracer(&remote_tracer);
+  Object* slots[2] = {nullptr, nullptr};
+  local_tracer.AddExternalReferenceConcurrently(&slots[0]);
+  local_tracer.AddExternalReferenceConcurrently(&slots[1]);
+  std::vector<Object**> references;
+  local_tracer.FlushExternalReferences(&references);
+  EXPECT_EQ(2u, references.size());
+  EXPECT_EQ(&slots[0], references[0]);
+  references.clear();
+  local_tracer.FlushExternalReferences(&references);
+  EXPECT_TRUE(references.empty());
+}
+
+TEST(LocalEmbedderHeapTracer, AbortTracingClearsConcurrentQueues) {
+  LocalEmbedderHeapTracer local_tracer;
+  StrictMock<MockEmbedderHeapTracer> remote_tracer;
+  local_tracer.SetRemoteTracer(&remote_tracer);
+  local_tracer.AddWrappersToTraceConcurrently(
+      std::vector<LocalEmbedderHeapTracer::WrapperInfo>(1,
+                                                        CreateWrapperInfo()));
+  Object* slot = nullptr;
+  local_tracer.AddExternalReferenceConcurrently(&slot);
+  EXPECT_CALL(remote_tracer, AbortTracing());
+  local_tracer.AbortTracing();
+  EXPECT_EQ(0u, local_tracer.NumberOfConcurrentlyFoundWrappersToTrace());
+  std::vector<Object**> references;
+  local_tracer.FlushExternalReferences(&references);
+  EXPECT_TRUE(references.empty());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -185,6 +185,33 @@ TEST_F(GCTracerTest, IncrementalScope) {
       200.0, tracer->current_.scopes[GCTracer::Scope::MC_INCREMENTAL_FINALIZE]);
 }
 
+TEST_F(GCTracerTest, ParallelJobs) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  ItemParallelJob::Stats stats;
+  stats.tasks = 2;
+  stats.items = 10;
+  stats.stolen_items = 3;
+  stats.longest_task_ms = 30;
+  stats.total_task_ms = 40;
+  tracer->AddParallelJob(GCTracer::Scope::MC_EVACUATE_COPY, stats);
+  tracer->AddParallelJob(GCTracer::Scope::MC_EVACUATE_COPY, stats);
+  tracer->Stop(MARK_COMPACTOR);
+  const GCTracer::ParallelJobInfos& infos =
+      tracer->parallel_jobs(GCTracer::Scope::MC_EVACUATE_COPY);
+  EXPECT_EQ(2, infos.jobs);
+  EXPECT_EQ(4, infos.tasks);
+  EXPECT_EQ(20u, infos.items);
+  EXPECT_EQ(6u, infos.stolen_items);
+  EXPECT_DOUBLE_EQ(30.0, infos.longest_task);
+  EXPECT_DOUBLE_EQ(80.0, infos.total_task_time);
+  EXPECT_DOUBLE_EQ(1.5, infos.Imbalance());
+  EXPECT_EQ(0, tracer->parallel_jobs(GCTracer::Scope::MC_MARK).jobs);
+}
+
 TEST_F(GCTracerTest, IncrementalMarkingDetails) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
@@ -294,5 +321,63 @@ TEST_F(GCTracerTest, IncrementalMarkingSpeed) {
                        tracer->IncrementalMarkingSpeedInBytesPerMillisecond()));
 }
 
+TEST_F(GCTracerTest, PauseHistograms) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 3);
+  tracer->AddScopeSample(GCTracer::Scope::MC_SWEEP, 0.1);
+  tracer->Stop(MARK_COMPACTOR);
+  const GCTracer::PauseHistogram& marking =
+      tracer->pause_histogram(v8::GCStatistics::kMarking);
+  EXPECT_EQ(1u, marking.count);
+  EXPECT_DOUBLE_EQ(3.0, marking.total);
+  EXPECT_DOUBLE_EQ(3.0, marking.max);
+  // 2ms <= 3ms < 4ms.
+  EXPECT_EQ(1u, marking.buckets[5]);
+  EXPECT_EQ(1u,
+            tracer->pause_histogram(v8::GCStatistics::kSweeping).buckets[0]);
+  EXPECT_EQ(1u, tracer->pause_histogram(v8::GCStatistics::kMarkCompact).count);
+  // No wrappers were traced.
+  EXPECT_EQ(0u,
+            tracer->pause_histogram(v8::GCStatistics::kEmbedderTracing).count);
+  EXPECT_EQ(0u, tracer->pause_histogram(v8::GCStatistics::kScavenge).count);
+
+  tracer->AddScopeSample(GCTracer::Scope::MC_INCREMENTAL, 1000);
+  const GCTracer::PauseHistogram& incremental =
+      tracer->pause_histogram(v8::GCStatistics::kIncrementalMarking);
+  EXPECT_EQ(1u, incremental.count);
+  EXPECT_EQ(1u, incremental.buckets[GCTracer::PauseHistogram::kBuckets - 1]);
+}
+
+TEST_F(GCTracerTest, StatisticsJSON) {
+  bool saved_flag = FLAG_trace_gc_statistics_json;
+  FLAG_trace_gc_statistics_json = true;
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  for (int i = 1; i <= 2; i++) {
+    tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                  "collector unittest");
+    tracer->AddScopeSample(GCTracer::Scope::MC_MARK, i);
+    tracer->Stop(MARK_COMPACTOR);
+  }
+  const std::vector<double>& marking =
+      tracer->recorded_pauses_[v8::GCStatistics::kMarking];
+  ASSERT_EQ(2u, marking.size());
+  EXPECT_DOUBLE_EQ(1.0, marking[0]);
+  EXPECT_DOUBLE_EQ(2.0, marking[1]);
+  EXPECT_EQ(2u,
+            tracer->recorded_pauses_[v8::GCStatistics::kMarkCompact].size());
+  EXPECT_DOUBLE_EQ(3.0, tracer->cumulative_scopes_[GCTracer::Scope::MC_MARK]);
+  tracer->PrintStatisticsJSON();
+
+  tracer->ResetForTesting();
+  EXPECT_TRUE(tracer->recorded_pauses_[v8::GCStatistics::kMarking].empty());
+  FLAG_trace_gc_statistics_json = saved_flag;
+}
+
 }  // namespace internal
 }  // namespace v8
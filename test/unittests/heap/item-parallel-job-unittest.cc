@@ -146,6 +146,62 @@ class ItemB : public BaseItem {
   void ProcessItem(TaskForDifferentItems* task) override { task->ProcessB(); }
 };
 
+class SplittingItem : public SimpleItem {
+ public:
+  SplittingItem(bool* was_processed, int parts, bool* part_was_processed)
+      : SimpleItem(was_processed),
+        parts_(parts),
+        part_was_processed_(part_was_processed) {}
+
+  void Split(ItemParallelJob::Task* task) {
+    for (int i = 0; i < parts_; i++) {
+      task->PushItem(new SplittingItem(&part_was_processed_[i], 0, nullptr));
+    }
+  }
+
+ private:
+  int parts_;
+  bool* part_was_processed_;
+};
+
+class SplittingTask : public ItemParallelJob::Task {
+ public:
+  explicit SplittingTask(Isolate* isolate) : ItemParallelJob::Task(isolate) {}
+
+  void RunInParallel() override {
+    SplittingItem* item = nullptr;
+    while ((item = GetItem<SplittingItem>()) != nullptr) {
+      item->Split(this);
+      item->Process();
+      item->MarkFinished();
+    }
+  }
+};
+
+class TaskProcessingAfterBarrier : public ItemParallelJob::Task {
+ public:
+  TaskProcessingAfterBarrier(Isolate* isolate, OneShotBarrier* barrier,
+                             bool process_items)
+      : ItemParallelJob::Task(isolate),
+        barrier_(barrier),
+        process_items_(process_items) {}
+
+  void RunInParallel() override {
+    // Ensure that all tasks are running before deciding who does the work.
+    barrier_->Wait();
+    if (!process_items_) return;
+    SimpleItem* item = nullptr;
+    while ((item = GetItem<SimpleItem>()) != nullptr) {
+      item->Process();
+      item->MarkFinished();
+    }
+  }
+
+ private:
+  OneShotBarrier* barrier_;
+  bool process_items_;
+};
+
 }  // namespace
 
 TEST_F(ItemParallelJobTest, EmptyTaskRuns) {
@@ -173,6 +229,9 @@ TEST_F(ItemParallelJobTest, FinishAllItems) {
   for (int i = 0; i < kItems; i++) {
     EXPECT_TRUE(was_processed[i]);
   }
+  EXPECT_EQ(1, job.stats().tasks);
+  EXPECT_EQ(static_cast<size_t>(kItems), job.stats().items);
+  EXPECT_EQ(0u, job.stats().stolen_items);
 }
 
 TEST_F(ItemParallelJobTest, DistributeItemsMultipleTasks) {
@@ -207,5 +266,49 @@ TEST_F(ItemParallelJobTest, DifferentItems) {
   EXPECT_TRUE(item_b);
 }
 
+TEST_F(ItemParallelJobTest, IdleTaskStealsItems) {
+  const int kTasks = 2;
+  const int kItems = 4;
+  bool was_processed[kItems];
+  OneShotBarrier barrier(kTasks);
+  for (int i = 0; i < kItems; i++) {
+    was_processed[i] = false;
+  }
+  ItemParallelJob job(i_isolate()->cancelable_task_manager(),
+                      parallel_job_semaphore());
+  for (int i = 0; i < kItems; i++) {
+    job.AddItem(new SimpleItem(&was_processed[i]));
+  }
+  // The main thread task leaves its items to the background task.
+  job.AddTask(new TaskProcessingAfterBarrier(i_isolate(), &barrier, false));
+  job.AddTask(new TaskProcessingAfterBarrier(i_isolate(), &barrier, true));
+  job.Run();
+  for (int i = 0; i < kItems; i++) {
+    EXPECT_TRUE(was_processed[i]);
+  }
+  EXPECT_EQ(kTasks, job.stats().tasks);
+  EXPECT_EQ(static_cast<size_t>(kItems), job.stats().items);
+  EXPECT_EQ(static_cast<size_t>(kItems / kTasks), job.stats().stolen_items);
+}
+
+TEST_F(ItemParallelJobTest, PushedItemsAreProcessed) {
+  const int kParts = 10;
+  bool was_processed = false;
+  bool part_was_processed[kParts];
+  for (int i = 0; i < kParts; i++) {
+    part_was_processed[i] = false;
+  }
+  ItemParallelJob job(i_isolate()->cancelable_task_manager(),
+                      parallel_job_semaphore());
+  job.AddItem(new SplittingItem(&was_processed, kParts, part_was_processed));
+  job.AddTask(new SplittingTask(i_isolate()));
+  job.Run();
+  EXPECT_TRUE(was_processed);
+  for (int i = 0; i < kParts; i++) {
+    EXPECT_TRUE(part_was_processed[i]);
+  }
+  EXPECT_EQ(static_cast<size_t>(kParts + 1), job.stats().items);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #include <limits>
 #include <map>
 
+#include "src/base/platform/platform.h"
 #include "src/globals.h"
 #include "src/heap/slot-set.h"
 #include "src/heap/spaces.h"
@@ -44,6 +45,45 @@ TEST(SlotSet, InsertAndLookup2) {
   }
 }
 
+namespace {
+
+class SlotSetInsertionThread final : public base::Thread {
+ public:
+  SlotSetInsertionThread(SlotSet* set, int start)
+      : base::Thread(base::Thread::Options("SlotSetInsertionThread")),
+        set_(set),
+        start_(start) {}
+
+  void Run() override {
+    for (int i = start_; i < Page::kPageSize; i += 4 * kPointerSize) {
+      set_->Insert<AccessMode::ATOMIC>(i);
+    }
+  }
+
+ private:
+  SlotSet* set_;
+  int start_;
+};
+
+}  // namespace
+
+TEST(SlotSet, ConcurrentInsert) {
+  SlotSet set;
+  set.SetPageStart(0);
+  SlotSetInsertionThread* threads[4];
+  for (int i = 0; i < 4; i++) {
+    threads[i] = new SlotSetInsertionThread(&set, i * kPointerSize);
+    threads[i]->Start();
+  }
+  for (int i = 0; i < 4; i++) {
+    threads[i]->Join();
+    delete threads[i];
+  }
+  for (int i = 0; i < Page::kPageSize; i += kPointerSize) {
+    EXPECT_TRUE(set.Lookup(i));
+  }
+}
+
 TEST(SlotSet, Iterate) {
   SlotSet set;
   set.SetPageStart(0);
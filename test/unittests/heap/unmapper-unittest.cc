@@ -7,6 +7,9 @@
 #undef MAP_TYPE
 #endif  // __linux__
 
+#include <algorithm>
+#include <vector>
+
 #include "src/heap/heap-inl.h"
 #include "src/heap/spaces-inl.h"
 #include "src/isolate.h"
@@ -82,6 +85,34 @@ TEST_F(SequentialUnmapperTest, UnmapOnTeardown) {
   EXPECT_EQ(-1, msync(start_address, page_size, MS_SYNC));
 }
 
+TEST_F(SequentialUnmapperTest, PoolIsBounded) {
+  int old_max_pooled_pages = FLAG_max_pooled_pages;
+  FLAG_max_pooled_pages = 1;
+  const size_t pooled_before = unmapper()->NumberOfPooledChunks();
+  std::vector<Page*> pages;
+  for (int i = 0; i < 2; i++) {
+    Page* page =
+        allocator()->AllocatePage(MemoryAllocator::PageAreaSize(OLD_SPACE),
+                                  static_cast<PagedSpace*>(heap()->old_space()),
+                                  Executability::NOT_EXECUTABLE);
+    EXPECT_NE(nullptr, page);
+    heap()->old_space()->UnlinkFreeListCategories(page);
+    pages.push_back(page);
+  }
+  for (Page* page : pages) {
+    allocator()->Free<MemoryAllocator::kPooledAndQueue>(page);
+  }
+  unmapper()->FreeQueuedChunks();
+  EXPECT_EQ(std::max<size_t>(pooled_before, 1),
+            unmapper()->NumberOfPooledChunks());
+  const int page_size = getpagesize();
+  // The chunk that did not fit into the pool has been unmapped.
+  EXPECT_EQ(-1, msync(static_cast<void*>(pages[0]->address()), page_size,
+                      MS_SYNC));
+  unmapper()->TearDown();
+  FLAG_max_pooled_pages = old_max_pooled_pages;
+}
+
 #endif  // __linux__
 
 }  // namespace internal
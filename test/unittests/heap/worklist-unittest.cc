@@ -192,5 +192,68 @@ TEST(Worklist, MultipleSegmentsStolen) {
   EXPECT_TRUE(worklist.IsGlobalEmpty());
 }
 
+TEST(Worklist, FlushToGlobalPublishesLocalSegments) {
+  Worklist worklist;
+  WorklistView worklist_view1(&worklist, 0);
+  WorklistView worklist_view2(&worklist, 1);
+  HeapObject dummy;
+  HeapObject* retrieved = nullptr;
+  EXPECT_TRUE(worklist_view1.Push(&dummy));
+  EXPECT_FALSE(worklist_view2.Pop(&retrieved));
+  worklist_view1.FlushToGlobal();
+  EXPECT_TRUE(worklist_view1.IsLocalEmpty());
+  EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+  EXPECT_EQ(&dummy, retrieved);
+  EXPECT_FALSE(worklist_view1.Pop(&retrieved));
+  EXPECT_TRUE(worklist.IsGlobalEmpty());
+}
+
+TEST(Worklist, FlushToGlobalOfEmptyWorklist) {
+  Worklist worklist;
+  WorklistView worklist_view1(&worklist, 0);
+  WorklistView worklist_view2(&worklist, 1);
+  HeapObject* retrieved = nullptr;
+  worklist_view1.FlushToGlobal();
+  EXPECT_FALSE(worklist_view2.Pop(&retrieved));
+  EXPECT_TRUE(worklist.IsGlobalEmpty());
+}
+
+TEST(Worklist, UpdateRemovesAndReplacesObjects) {
+  Worklist worklist;
+  WorklistView worklist_view1(&worklist, 0);
+  WorklistView worklist_view2(&worklist, 1);
+  HeapObject dummy1, dummy2;
+  HeapObject* retrieved = nullptr;
+  for (size_t i = 0; i < Worklist::kSegmentCapacity; i++) {
+    EXPECT_TRUE(worklist_view1.Push(&dummy1));
+  }
+  EXPECT_TRUE(worklist_view2.Push(&dummy2));
+  worklist_view1.FlushToGlobal();
+  EXPECT_EQ(static_cast<size_t>(Worklist::kSegmentCapacity),
+            worklist.GlobalPoolSize());
+  worklist.Update([&dummy1](HeapObject* object) -> HeapObject* {
+    return object == &dummy1 ? nullptr : &dummy1;
+  });
+  EXPECT_TRUE(worklist.IsGlobalPoolEmpty());
+  EXPECT_EQ(1u, worklist.LocalSize(1));
+  EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+  EXPECT_EQ(&dummy1, retrieved);
+  EXPECT_TRUE(worklist.IsGlobalEmpty());
+}
+
+TEST(Worklist, ClearRemovesAllObjects) {
+  Worklist worklist;
+  WorklistView worklist_view1(&worklist, 0);
+  WorklistView worklist_view2(&worklist, 1);
+  HeapObject dummy;
+  for (size_t i = 0; i < Worklist::kSegmentCapacity + 1; i++) {
+    EXPECT_TRUE(worklist_view1.Push(&dummy));
+  }
+  EXPECT_TRUE(worklist_view2.Push(&dummy));
+  EXPECT_FALSE(worklist.IsGlobalPoolEmpty());
+  worklist.Clear();
+  EXPECT_TRUE(worklist.IsGlobalEmpty());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -235,8 +235,8 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
       .CompareOperation(Token::Value::LTE, reg, 5)
       .CompareOperation(Token::Value::GTE, reg, 6)
       .CompareTypeOf(TestTypeOfFlags::LiteralFlag::kNumber)
-      .CompareOperation(Token::Value::INSTANCEOF, reg)
-      .CompareOperation(Token::Value::IN, reg)
+      .CompareOperation(Token::Value::INSTANCEOF, reg, 7)
+      .CompareOperation(Token::Value::IN, reg, 8)
       .CompareUndetectable()
       .CompareUndefined()
       .CompareNull();
@@ -302,6 +302,8 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
   // Emit Smi table switch bytecode.
   BytecodeJumpTable* jump_table = builder.AllocateJumpTable(1, 0);
   builder.SwitchOnSmiNoFeedback(jump_table).Bind(jump_table, 0);
+  jump_table = builder.AllocateJumpTable(1, 0);
+  builder.SwitchOnSmi(jump_table).Bind(jump_table, 0);
 
   // Emit set pending message bytecode.
   builder.SetPendingMessage();
@@ -89,7 +89,8 @@ TEST(OperandScaling, ScalableAndNonScalable) {
              1 + 2 + 2 * scale);
     CHECK_EQ(Bytecodes::Size(Bytecode::kCreateObjectLiteral, operand_scale),
              1 + 2 * scale + 1 + 1 * scale);
-    CHECK_EQ(Bytecodes::Size(Bytecode::kTestIn, operand_scale), 1 + scale);
+    CHECK_EQ(Bytecodes::Size(Bytecode::kTestIn, operand_scale),
+             1 + 2 * scale);
   }
 }
 
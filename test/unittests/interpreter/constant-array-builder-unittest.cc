@@ -48,6 +48,19 @@ TEST_F(ConstantArrayBuilderTest, AllocateAllEntries) {
   }
 }
 
+TEST_F(ConstantArrayBuilderTest, HeapNumbersAreShared) {
+  CanonicalHandleScope canonical(isolate());
+  ConstantArrayBuilder builder(zone());
+  AstValueFactory ast_factory(zone(), isolate()->ast_string_constants(),
+                              isolate()->heap()->HashSeed());
+  size_t first = builder.Insert(ast_factory.NewNumber(3.14));
+  size_t second = builder.Insert(ast_factory.NewNumber(1.414));
+  CHECK_EQ(first, builder.Insert(ast_factory.NewNumber(3.14)));
+  CHECK_EQ(second, builder.Insert(ast_factory.NewNumber(1.414)));
+  CHECK_NE(first, second);
+  CHECK_EQ(builder.size(), 2u);
+}
+
 TEST_F(ConstantArrayBuilderTest, ToFixedArray) {
   CanonicalHandleScope canonical(isolate());
   ConstantArrayBuilder builder(zone());
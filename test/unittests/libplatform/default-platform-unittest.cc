@@ -3,6 +3,8 @@
 // found in the LICENSE file.
 
 #include "src/libplatform/default-platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
 #include "testing/gmock/include/gmock/gmock.h"
 
 using testing::InSequence;
@@ -25,6 +27,15 @@ struct MockIdleTask : public IdleTask {
   MOCK_METHOD0(Die, void());
 };
 
+class SignalingTask : public Task {
+ public:
+  explicit SignalingTask(base::Semaphore* semaphore) : semaphore_(semaphore) {}
+  void Run() override { semaphore_->Signal(); }
+
+ private:
+  base::Semaphore* semaphore_;
+};
+
 class DefaultPlatformWithMockTime : public DefaultPlatform {
  public:
   DefaultPlatformWithMockTime()
@@ -132,6 +143,31 @@ TEST(DefaultPlatformTest, PendingDelayedTasksAreDestroyedOnShutdown) {
   }
 }
 
+TEST(DefaultPlatformTest, DelayedBackgroundTask) {
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(1);
+  EXPECT_TRUE(platform.DelayedBackgroundTasksEnabled());
+
+  base::Semaphore semaphore(0);
+  base::TimeTicks start = base::TimeTicks::Now();
+  platform.CallDelayedOnBackgroundThread(new SignalingTask(&semaphore),
+                                         Platform::kShortRunningTask, 0.01);
+  semaphore.Wait();
+  EXPECT_LE(10, (base::TimeTicks::Now() - start).InMilliseconds());
+}
+
+TEST(DefaultPlatformTest, PendingDelayedBackgroundTasksAreDestroyedOnShutdown) {
+  InSequence s;
+
+  {
+    DefaultPlatform platform;
+    StrictMock<MockTask>* task = new StrictMock<MockTask>;
+    platform.CallDelayedOnBackgroundThread(task, Platform::kLongRunningTask,
+                                           100);
+    EXPECT_CALL(*task, Die());
+  }
+}
+
 TEST(DefaultPlatformTest, RunIdleTasks) {
   InSequence s;
 
@@ -45,6 +45,43 @@ TEST(TaskQueueTest, Basic) {
 }
 
 
+TEST(TaskQueueTest, Priorities) {
+  TaskQueue queue;
+  MockTask low, normal1, normal2, high;
+  queue.Append(&low, TaskQueue::Priority::kLow);
+  queue.Append(&normal1, TaskQueue::Priority::kNormal);
+  queue.Append(&high, TaskQueue::Priority::kHigh);
+  queue.Append(&normal2);
+  EXPECT_EQ(&high, queue.GetNext());
+  EXPECT_EQ(&normal1, queue.GetNext());
+  EXPECT_EQ(&normal2, queue.GetNext());
+  EXPECT_EQ(&low, queue.GetNext());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(), IsNull());
+}
+
+
+TEST(TaskQueueTest, WaitStatistics) {
+  TaskQueue queue;
+  MockTask task1, task2;
+  queue.Append(&task1, TaskQueue::Priority::kHigh);
+  queue.Append(&task2, TaskQueue::Priority::kHigh);
+  base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+  EXPECT_EQ(&task1, queue.GetNext());
+  EXPECT_EQ(&task2, queue.GetNext());
+  TaskQueue::WaitStatistics high =
+      queue.GetWaitStatistics(TaskQueue::Priority::kHigh);
+  EXPECT_EQ(2u, high.task_count);
+  EXPECT_LE(base::TimeDelta::FromMilliseconds(1).InMicroseconds(),
+            high.max_wait_time.InMicroseconds());
+  EXPECT_LE(high.max_wait_time.InMicroseconds(),
+            high.total_wait_time.InMicroseconds());
+  EXPECT_EQ(0u,
+            queue.GetWaitStatistics(TaskQueue::Priority::kLow).task_count);
+  queue.Terminate();
+}
+
+
 TEST(TaskQueueTest, TerminateMultipleReaders) {
   TaskQueue queue;
   TaskQueueThread thread1(&queue);
@@ -60,5 +60,27 @@ TEST(WorkerThreadTest, PostSingleTask) {
   queue.Terminate();
 }
 
+TEST(WorkerThreadTest, StealTasks) {
+  static const size_t kNumTasks = 20;
+
+  TaskQueue queue;
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    StrictMock<MockTask>* task = new StrictMock<MockTask>;
+    EXPECT_CALL(*task, Run());
+    EXPECT_CALL(*task, Die());
+    queue.Append(task, i % 2 ? TaskQueue::Priority::kHigh
+                             : TaskQueue::Priority::kLow);
+  }
+
+  // All tasks were posted to the shared deque before any worker existed, so
+  // the workers have to steal them.
+  WorkerThread thread1(&queue);
+  WorkerThread thread2(&queue);
+  WorkerThread thread3(&queue);
+
+  queue.BlockUntilQueueEmptyForTesting();
+  queue.Terminate();
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -0,0 +1,95 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/pooling-array-buffer-allocator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+bool IsZero(void* data, size_t length) {
+  uint8_t* bytes = reinterpret_cast<uint8_t*>(data);
+  for (size_t i = 0; i < length; i++) {
+    if (bytes[i] != 0) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(PoolingArrayBufferAllocator, ReusesSmallBlocks) {
+  PoolingArrayBufferAllocator allocator;
+  void* data = allocator.Allocate(100);
+  ASSERT_NE(nullptr, data);
+  EXPECT_TRUE(IsZero(data, 100));
+  memset(data, 0xab, 100);
+  allocator.Free(data, 100);
+  EXPECT_EQ(128u, allocator.GetPooledBytes());
+
+  // Sizes in the same size class get the pooled block, zeroed again.
+  void* reused = allocator.Allocate(120);
+  EXPECT_EQ(data, reused);
+  EXPECT_TRUE(IsZero(reused, 120));
+  EXPECT_EQ(0u, allocator.GetPooledBytes());
+  allocator.Free(reused, 120);
+}
+
+TEST(PoolingArrayBufferAllocator, ReusesLargeBlocks) {
+  PoolingArrayBufferAllocator allocator;
+  const size_t length = 3 * MB;
+  void* data = allocator.AllocateUninitialized(length);
+  ASSERT_NE(nullptr, data);
+  memset(data, 0xab, length);
+  allocator.Free(data, length);
+  EXPECT_EQ(4 * MB, allocator.GetPooledBytes());
+
+  void* reused = allocator.Allocate(length);
+  EXPECT_EQ(data, reused);
+  EXPECT_TRUE(IsZero(reused, length));
+  allocator.Free(reused, length);
+}
+
+TEST(PoolingArrayBufferAllocator, DoesNotPoolHugeBlocks) {
+  PoolingArrayBufferAllocator allocator;
+  const size_t length = PoolingArrayBufferAllocator::kMaxPooledBlockSize + 1;
+  void* data = allocator.Allocate(length);
+  ASSERT_NE(nullptr, data);
+  allocator.Free(data, length);
+  EXPECT_EQ(0u, allocator.GetPooledBytes());
+}
+
+TEST(PoolingArrayBufferAllocator, LimitsPoolSize) {
+  PoolingArrayBufferAllocator allocator;
+  const size_t length = PoolingArrayBufferAllocator::kMaxPooledBlockSize;
+  const size_t count =
+      PoolingArrayBufferAllocator::kMaxPooledBytesPerShard / length + 2;
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < count; i++) {
+    blocks.push_back(allocator.AllocateUninitialized(length));
+  }
+  for (void* data : blocks) allocator.Free(data, length);
+  EXPECT_EQ(PoolingArrayBufferAllocator::kMaxPooledBytesPerShard,
+            allocator.GetPooledBytes());
+}
+
+TEST(PoolingArrayBufferAllocator, MemoryPressureClearsPools) {
+  PoolingArrayBufferAllocator allocator;
+  void* small = allocator.Allocate(16);
+  void* large = allocator.Allocate(100 * KB);
+  allocator.Free(small, 16);
+  allocator.Free(large, 100 * KB);
+  EXPECT_EQ(16u + 128 * KB, allocator.GetPooledBytes());
+
+  PoolingArrayBufferAllocator::MemoryPressureNotification(
+      MemoryPressureLevel::kNone);
+  EXPECT_NE(0u, allocator.GetPooledBytes());
+  PoolingArrayBufferAllocator::MemoryPressureNotification(
+      MemoryPressureLevel::kCritical);
+  EXPECT_EQ(0u, allocator.GetPooledBytes());
+}
+
+}  // namespace internal
+}  // namespace v8
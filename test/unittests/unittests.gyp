@@ -130,6 +130,7 @@
       'locked-queue-unittest.cc',
       'object-unittest.cc',
       'parser/preparser-unittest.cc',
+      'pooling-array-buffer-allocator-unittest.cc',
       'register-configuration-unittest.cc',
       'run-all-unittests.cc',
       'source-position-table-unittest.cc',
@@ -1297,6 +1297,44 @@ TEST_F(ValueSerializerTest, DecodeDenseArrayContainingUndefined) {
              });
 }
 
+TEST_F(ValueSerializerTest, RoundTripDenseNumberArray) {
+  // Dense arrays of numbers are read straight into a packed backing store.
+  auto elements_kind = [](Local<Value> value) {
+    return i::Handle<i::JSArray>::cast(Utils::OpenHandle(*value))
+        ->GetElementsKind();
+  };
+  RoundTripTest("[1, -2, 3]", [this, &elements_kind](Local<Value> value) {
+    ASSERT_TRUE(value->IsArray());
+    EXPECT_EQ(i::FAST_SMI_ELEMENTS, elements_kind(value));
+    EXPECT_TRUE(EvaluateScriptForResultBool(
+        "result.length === 3 && result[1] === -2 && result[2] === 3"));
+  });
+  RoundTripTest("[1, 0.5, -0, NaN]",
+                [this, &elements_kind](Local<Value> value) {
+                  ASSERT_TRUE(value->IsArray());
+                  EXPECT_EQ(i::FAST_DOUBLE_ELEMENTS, elements_kind(value));
+                  EXPECT_TRUE(EvaluateScriptForResultBool(
+                      "result[0] === 1 && result[1] === 0.5 && "
+                      "Object.is(result[2], -0)"));
+                  EXPECT_TRUE(
+                      EvaluateScriptForResultBool("Number.isNaN(result[3])"));
+                });
+  // Other elements still take the general path.
+  RoundTripTest("[1, 2, 'a']", [this, &elements_kind](Local<Value> value) {
+    ASSERT_TRUE(value->IsArray());
+    EXPECT_EQ(i::FAST_HOLEY_ELEMENTS, elements_kind(value));
+    EXPECT_TRUE(EvaluateScriptForResultBool(
+        "result[0] === 1 && result[1] === 2 && result[2] === 'a'"));
+  });
+  // Properties following the elements are still read.
+  RoundTripTest("var x = [1.5, 2.5]; x.foo = 3; x",
+                [this, &elements_kind](Local<Value> value) {
+                  EXPECT_EQ(i::FAST_DOUBLE_ELEMENTS, elements_kind(value));
+                  EXPECT_TRUE(EvaluateScriptForResultBool(
+                      "result[1] === 2.5 && result.foo === 3"));
+                });
+}
+
 TEST_F(ValueSerializerTest, RoundTripDate) {
   RoundTripTest("new Date(1e6)", [](Local<Value> value) {
     ASSERT_TRUE(value->IsDate());
@@ -3049,5 +3087,303 @@ TEST_F(ValueSerializerTestWithWasm, DecodeWasmModuleWithInvalidDataLength) {
   InvalidDecodeTest({0xff, 0x09, 0x3f, 0x00, 0x57, 0x79, 0x00, 0x7f});
 }
 
+class ValueSerializerTestWithOutOfBandData : public ValueSerializerTest {
+ protected:
+  static const size_t kThreshold = 256;
+
+  ValueSerializerTestWithOutOfBandData()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  size_t block_count() const { return blocks_.size(); }
+  const void* block_data(size_t index) const { return blocks_[index].data(); }
+
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetOutOfBandThreshold(kThreshold);
+  }
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+ private:
+  struct Block {
+    std::vector<uint8_t> bytes;
+    size_t length;
+    bool is_one_byte;
+    const uint8_t* data() const { return bytes.data(); }
+  };
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithOutOfBandData* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    Maybe<uint32_t> GetOutOfBandArrayBufferId(Isolate* isolate,
+                                              const void* data,
+                                              size_t byte_length) override {
+      return Just(test_->AddBlock(data, byte_length, byte_length, true));
+    }
+    Maybe<uint32_t> GetOutOfBandStringId(Isolate* isolate, const void* data,
+                                         size_t length,
+                                         bool is_one_byte) override {
+      size_t byte_length = is_one_byte ? length : length * sizeof(uint16_t);
+      return Just(test_->AddBlock(data, byte_length, length, is_one_byte));
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandData* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(ValueSerializerTestWithOutOfBandData* test)
+        : test_(test) {}
+    void* GetOutOfBandArrayBufferData(Isolate* isolate, uint32_t id,
+                                      size_t byte_length) override {
+      EXPECT_LT(id, test_->blocks_.size());
+      Block& block = test_->blocks_[id];
+      EXPECT_EQ(byte_length, block.length);
+      return block.bytes.data();
+    }
+    MaybeLocal<String> GetOutOfBandString(Isolate* isolate,
+                                          uint32_t id) override {
+      EXPECT_LT(id, test_->blocks_.size());
+      const Block& block = test_->blocks_[id];
+      int length = static_cast<int>(block.length);
+      if (block.is_one_byte) {
+        return String::NewFromOneByte(isolate, block.data(),
+                                      NewStringType::kNormal, length);
+      }
+      return String::NewFromTwoByte(
+          isolate, reinterpret_cast<const uint16_t*>(block.data()),
+          NewStringType::kNormal, length);
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandData* test_;
+  };
+
+  uint32_t AddBlock(const void* data, size_t byte_length, size_t length,
+                    bool is_one_byte) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    blocks_.push_back({std::vector<uint8_t>(bytes, bytes + byte_length),
+                       length, is_one_byte});
+    return static_cast<uint32_t>(blocks_.size() - 1);
+  }
+
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+  std::vector<Block> blocks_;
+};
+
+TEST_F(ValueSerializerTestWithOutOfBandData, RoundTripArrayBuffer) {
+  RoundTripTest("new Uint8Array(1024).fill(7)", [this](Local<Value> value) {
+    ASSERT_TRUE(value->IsUint8Array());
+    ASSERT_EQ(1u, block_count());
+    Local<ArrayBuffer> buffer = value.As<Uint8Array>()->Buffer();
+    EXPECT_TRUE(buffer->IsExternal());
+    EXPECT_EQ(block_data(0), buffer->GetContents().Data());
+    EXPECT_TRUE(EvaluateScriptForResultBool("result.length === 1024"));
+    EXPECT_TRUE(EvaluateScriptForResultBool("result[1023] === 7"));
+  });
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, RoundTripSharedReference) {
+  RoundTripTest("var b = new ArrayBuffer(512); ({a: b, c: b})",
+                [this](Local<Value> value) {
+                  EXPECT_EQ(1u, block_count());
+                  EXPECT_TRUE(EvaluateScriptForResultBool(
+                      "result.a instanceof ArrayBuffer"));
+                  EXPECT_TRUE(EvaluateScriptForResultBool(
+                      "result.a === result.c"));
+                });
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, SmallDataIsInline) {
+  RoundTripTest("[new ArrayBuffer(16), 'abc']", [this](Local<Value> value) {
+    EXPECT_EQ(0u, block_count());
+    EXPECT_TRUE(EvaluateScriptForResultBool(
+        "result[0].byteLength === 16 && result[1] === 'abc'"));
+  });
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, RoundTripStrings) {
+  RoundTripTest("['a'.repeat(1000), '\\u1234'.repeat(200)]",
+                [this](Local<Value> value) {
+                  EXPECT_EQ(2u, block_count());
+                  EXPECT_TRUE(EvaluateScriptForResultBool(
+                      "result[0] === 'a'.repeat(1000)"));
+                  EXPECT_TRUE(EvaluateScriptForResultBool(
+                      "result[1] === '\\u1234'.repeat(200)"));
+                });
+  // Strings nested in other objects are supported as well.
+  RoundTripTest("new String('b'.repeat(300))", [this](Local<Value> value) {
+    ASSERT_TRUE(value->IsStringObject());
+    EXPECT_EQ(3u, block_count());
+    EXPECT_TRUE(EvaluateScriptForResultBool(
+        "result.valueOf() === 'b'.repeat(300)"));
+  });
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, DecodeWithoutDelegateSupport) {
+  // Out-of-band data cannot be read without a delegate that provides it.
+  std::vector<uint8_t> data;
+  EncodeTest(
+      [this]() { return EvaluateScriptForInput("new ArrayBuffer(1024)"); },
+      [&data](const std::vector<uint8_t>& encoded) { data = encoded; });
+  Local<Context> context = deserialization_context();
+  Context::Scope scope(context);
+  TryCatch try_catch(isolate());
+  ValueDeserializer::Delegate default_delegate;
+  ValueDeserializer deserializer(isolate(), &data[0],
+                                 static_cast<int>(data.size()),
+                                 &default_delegate);
+  ASSERT_TRUE(deserializer.ReadHeader(context).FromMaybe(false));
+  EXPECT_TRUE(deserializer.ReadValue(context).IsEmpty());
+  EXPECT_TRUE(try_catch.HasCaught());
+}
+
+class ValueSerializerTestWithStreaming : public ValueSerializerTest {
+ protected:
+  static const size_t kChunkSize = 64;
+  // Input is handed to the deserializer in small, odd-sized pieces, so that
+  // reads of all kinds cross piece boundaries.
+  static const size_t kInputPieceSize = 7;
+
+  ValueSerializerTestWithStreaming() : serializer_delegate_(this) {}
+
+  size_t chunk_count() const { return chunk_count_; }
+
+  // Serializes the value in chunks, and deserializes it from input that is
+  // read in pieces.
+  template <typename OutputFunctor>
+  void StreamingRoundTripTest(const char* source,
+                              const OutputFunctor& output_functor) {
+    {
+      Context::Scope scope(serialization_context());
+      TryCatch try_catch(isolate());
+      ValueSerializer serializer(isolate(), &serializer_delegate_);
+      serializer.SetChunkSize(kChunkSize);
+      serializer.WriteHeader();
+      ASSERT_TRUE(serializer
+                      .WriteValue(serialization_context(),
+                                  EvaluateScriptForInput(source))
+                      .FromMaybe(false));
+      ASSERT_FALSE(try_catch.HasCaught());
+      // The remaining data is appended to the chunks already written.
+      std::pair<uint8_t*, size_t> buffer = serializer.Release();
+      data_.insert(data_.end(), buffer.first, buffer.first + buffer.second);
+      free(buffer.first);
+    }
+
+    Local<Context> context = deserialization_context();
+    Context::Scope scope(context);
+    TryCatch try_catch(isolate());
+    DeserializerDelegate deserializer_delegate(data_);
+    // The first piece is passed to the constructor, the rest is read.
+    ValueDeserializer deserializer(isolate(), data_.data(), kInputPieceSize,
+                                   &deserializer_delegate);
+    ASSERT_TRUE(deserializer.ReadHeader(context).FromMaybe(false));
+    Local<Value> result;
+    ASSERT_TRUE(deserializer.ReadValue(context).ToLocal(&result));
+    ASSERT_FALSE(try_catch.HasCaught());
+    ASSERT_TRUE(
+        context->Global()
+            ->CreateDataProperty(context, StringFromUtf8("result"), result)
+            .FromMaybe(false));
+    output_functor(result);
+    ASSERT_FALSE(try_catch.HasCaught());
+  }
+
+ private:
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithStreaming* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    Maybe<bool> WriteChunk(Isolate* isolate, const uint8_t* data,
+                           size_t size) override {
+      EXPECT_GE(size, kChunkSize);
+      test_->data_.insert(test_->data_.end(), data, data + size);
+      test_->chunk_count_++;
+      return Just(true);
+    }
+
+   private:
+    ValueSerializerTestWithStreaming* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(const std::vector<uint8_t>& data)
+        : data_(data), position_(kInputPieceSize) {}
+    size_t ReadMoreData(Isolate* isolate, uint8_t* buffer,
+                        size_t capacity) override {
+      size_t size = std::min(
+          {capacity, kInputPieceSize, data_.size() - position_});
+      memcpy(buffer, data_.data() + position_, size);
+      position_ += size;
+      return size;
+    }
+
+   private:
+    const std::vector<uint8_t>& data_;
+    size_t position_;
+  };
+
+  SerializerDelegate serializer_delegate_;
+  std::vector<uint8_t> data_;
+  size_t chunk_count_ = 0;
+};
+
+const size_t ValueSerializerTestWithStreaming::kChunkSize;
+const size_t ValueSerializerTestWithStreaming::kInputPieceSize;
+
+TEST_F(ValueSerializerTestWithStreaming, RoundTripObjectGraph) {
+  StreamingRoundTripTest(
+      "var shared = {s: 'shared'};"
+      "var list = [];"
+      "for (var i = 0; i < 100; i++) {"
+      "  list.push({id: i, name: 'item' + i, value: i + 0.5, shared});"
+      "}"
+      "({list, numbers: [1, 2, 3, 4.5], text: '\\u1234'.repeat(100),"
+      "  bytes: new Uint8Array(300).fill(9)})",
+      [this](Local<Value> value) {
+        EXPECT_LT(10u, chunk_count());
+        EXPECT_TRUE(EvaluateScriptForResultBool("result.list.length === 100"));
+        EXPECT_TRUE(EvaluateScriptForResultBool(
+            "result.list.every((e, i) => e.id === i && e.name === 'item' + i "
+            "&& e.value === i + 0.5 && e.shared === result.list[0].shared)"));
+        EXPECT_TRUE(EvaluateScriptForResultBool(
+            "result.numbers.join() === '1,2,3,4.5'"));
+        EXPECT_TRUE(EvaluateScriptForResultBool(
+            "result.text === '\\u1234'.repeat(100)"));
+        EXPECT_TRUE(EvaluateScriptForResultBool(
+            "result.bytes.length === 300 && result.bytes[299] === 9"));
+      });
+}
+
+TEST_F(ValueSerializerTestWithStreaming, DecodeTruncatedInput) {
+  // Without more input, truncated data is rejected as before.
+  Local<Context> context = deserialization_context();
+  Context::Scope scope(context);
+  TryCatch try_catch(isolate());
+  const std::vector<uint8_t> data = {0xff, 0x0d, 0x6f, 0x22, 0x03, 0x61};
+  ValueDeserializer::Delegate default_delegate;
+  ValueDeserializer deserializer(isolate(), data.data(), data.size(),
+                                 &default_delegate);
+  ASSERT_TRUE(deserializer.ReadHeader(context).FromMaybe(false));
+  EXPECT_TRUE(deserializer.ReadValue(context).IsEmpty());
+  EXPECT_TRUE(try_catch.HasCaught());
+}
+
 }  // namespace
 }  // namespace v8
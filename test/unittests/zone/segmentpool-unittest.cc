@@ -21,12 +21,61 @@ TEST(Zone, SegmentPoolConstraints) {
     size_t total_size = 0;
     for (size_t power = 0; power < AccountingAllocator::kNumberBuckets;
          ++power) {
-      total_size +=
-          allocator.unused_segments_max_sizes_[power] * (size_t(1) << power);
+      size_t segment_size =
+          size_t(1) << (power + AccountingAllocator::kMinSegmentSizePower);
+      total_size += allocator.unused_segments_max_sizes_[power] * segment_size;
     }
     EXPECT_LE(total_size, size);
   }
 }
 
+TEST(Zone, SegmentPoolReuse) {
+  static const size_t kSegmentSize = 64 * KB;
+
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(AccountingAllocator::kMaxPoolSize);
+
+  Segment* segment = allocator.GetSegment(kSegmentSize);
+  EXPECT_EQ(0u, allocator.GetSegmentReuseCount());
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentMemoryUsage());
+
+  Segment* reused = allocator.GetSegment(kSegmentSize);
+  EXPECT_EQ(segment, reused);
+  EXPECT_EQ(1u, allocator.GetSegmentReuseCount());
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(reused);
+
+  // Memory pressure releases the pool and stops segments from being pooled
+  // until it is over.
+  allocator.MemoryPressureNotification(MemoryPressureLevel::kCritical);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  allocator.ReturnSegment(allocator.GetSegment(kSegmentSize));
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(1u, allocator.GetSegmentReuseCount());
+
+  // The pool is usable again after a full release.
+  allocator.MemoryPressureNotification(MemoryPressureLevel::kNone);
+  allocator.ReturnSegment(allocator.GetSegment(kSegmentSize));
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentPoolSize());
+}
+
+TEST(Zone, SegmentPoolSkipsOversizedSegments) {
+  static const size_t kLargestPooledSize =
+      size_t(1) << AccountingAllocator::kMaxSegmentSizePower;
+
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(AccountingAllocator::kMaxPoolSize);
+
+  allocator.ReturnSegment(allocator.GetSegment(kLargestPooledSize + KB));
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+
+  allocator.ReturnSegment(allocator.GetSegment(kLargestPooledSize));
+  EXPECT_EQ(kLargestPooledSize, allocator.GetCurrentPoolSize());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -177,6 +177,30 @@ TEST(ZoneChunkList, SmallCopyToTest) {
   }
 }
 
+TEST(ZoneChunkList, FindAndRewindTest) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+
+  ZoneChunkList<uint8_t> zone_chunk_list(&zone);
+
+  for (size_t i = 0; i < kItemCount; ++i) {
+    zone_chunk_list.push_back(static_cast<uint8_t>(i & 0xFF));
+  }
+
+  // Every index, including the first one of each chunk, is found.
+  for (size_t i = 0; i < kItemCount; ++i) {
+    EXPECT_EQ(*zone_chunk_list.Find(i), static_cast<uint8_t>(i & 0xFF));
+  }
+
+  for (size_t limit = kItemCount; limit-- > 0;) {
+    zone_chunk_list.Rewind(limit);
+    EXPECT_EQ(zone_chunk_list.size(), limit);
+    zone_chunk_list.push_back(42);
+    EXPECT_EQ(*zone_chunk_list.Find(limit), 42);
+    zone_chunk_list.Rewind(limit);
+  }
+}
+
 struct Fubar {
   size_t a_;
   size_t b_;
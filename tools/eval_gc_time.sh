@@ -97,6 +97,7 @@ INTERESTING_OLD_GEN_KEYS="\
   clear.weak_cells \
   clear.weak_collections \
   clear.weak_lists \
+  clear.weak_tables \
   evacuate.candidates \
   evacuate.clean_up \
   evacuate.copy \